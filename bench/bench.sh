@@ -0,0 +1,122 @@
+#!/bin/sh
+#
+# Benchmark the compiler on the programs in bench/<target>/
+#
+# usage: bench.sh <nqc> <results> [<baseline>]
+#
+# For each program this records the compile time and peak memory of
+# nqc, the bytes of each task and sub, and the instructions and time the
+# program takes on the emulator.  Given a baseline (the results of an
+# earlier run), a program that got bigger or runs more instructions is
+# a regression, and the script fails.  Compile time and memory vary
+# from run to run, so their changes are only reported.
+#
+# Programs are built with full optimization (-opt 2), which is what
+# the sizes and instruction counts are meant to track.
+#
+
+NQC=$1
+RESULTS=$2
+BASELINE=$3
+DIR=`dirname "$0"`
+TMP=${TMPDIR:-/tmp}/nqc-bench.$$
+
+# long enough for every program in the corpus to finish
+EMULATE_MS=60000
+
+if [ -z "$NQC" ] || [ -z "$RESULTS" ]; then
+    echo "usage: $0 <nqc> <results> [<baseline>]" >&2
+    exit 2
+fi
+
+: > "$RESULTS" || exit 2
+
+for file in "$DIR"/*/*.nqc; do
+    sub=`dirname "$file"`
+    sub=`basename "$sub"`
+    case $sub in
+        rcx)    target=RCX ;;
+        cm)     target=CM ;;
+        rcx2)   target=RCX2 ;;
+        scout)  target=Scout ;;
+        spy)    target=Spy ;;
+        swan)   target=Swan ;;
+        *)      continue ;;
+    esac
+    name=$sub/`basename "$file" .nqc`
+
+    "$NQC" -T$target -opt 2 -stats_json -l -emulate $EMULATE_MS "$file" > "$TMP" 2>&1
+    status=$?
+
+    awk -v name="$name" -v status=$status '
+        /^\{"file":/ {
+            if (match($0, /"times_ms":\{[^}]*\}/)) {
+                n = split(substr($0, RSTART + 12, RLENGTH - 13), times, ",")
+                ms = 0
+                for (i = 1; i <= n; i++) {
+                    split(times[i], kv, ":")
+                    ms += kv[2]
+                }
+                printf "%s compile_ms %.3f\n", name, ms
+            }
+            if (match($0, /"peak_memory_kb":[0-9]+/))
+                printf "%s peak_kb %s\n", name, substr($0, RSTART + 17, RLENGTH - 17)
+        }
+        /^\*\*\* [A-Za-z]+ [0-9]+ = .*, size: [0-9]+ bytes$/ {
+            printf "%s bytes.%s%s %s\n", name, $2, $3, $(NF-1)
+        }
+        /^Total size: / { printf "%s bytes %s\n", name, $3 }
+        /^Time: / {
+            printf "%s emulated_ms %s\n", name, $2
+            printf "%s instructions %s\n", name, $4
+        }
+        /^Error: / { ++errors }
+        END { printf "%s errors %d\n", name, errors + (status != 0) }
+    ' "$TMP" >> "$RESULTS"
+done
+
+rm -f "$TMP"
+
+if [ -z "$BASELINE" ]; then
+    echo "Results in $RESULTS"
+    exit 0
+fi
+
+if [ ! -f "$BASELINE" ]; then
+    echo "No baseline in $BASELINE (make bench-baseline records one)"
+    exit 0
+fi
+
+# compare the results with the baseline, metric by metric
+awk '
+    FNR == NR { base[$1 " " $2] = $3; next }
+    {
+        key = $1 " " $2
+        if (!(key in base)) {
+            printf "%-40s %12s (new)\n", key, $3
+            next
+        }
+        old = base[key]
+        delete base[key]
+        if ($3 == old) next
+
+        change = old ? sprintf("%+.1f%%", 100 * ($3 - old) / old) : "new"
+        if ($2 == "compile_ms" || $2 == "peak_kb")
+            printf "%-40s %12s -> %-12s %s\n", key, old, $3, change
+        else if ($3 + 0 > old + 0) {
+            printf "%-40s %12s -> %-12s %s REGRESSION\n", key, old, $3, change
+            ++regressions
+        }
+        else
+            printf "%-40s %12s -> %-12s %s\n", key, old, $3, change
+    }
+    END {
+        for (key in base)
+            printf "%-40s %12s (gone)\n", key, base[key]
+        if (regressions) {
+            printf "%d regression%s\n", regressions, regressions == 1 ? "" : "s"
+            exit 1
+        }
+        print "No regressions"
+    }
+' "$BASELINE" "$RESULTS"
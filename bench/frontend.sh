@@ -0,0 +1,79 @@
+#!/bin/sh
+#
+# Time the lexer, preprocessor and parser on large generated programs
+#
+# usage: frontend.sh <nqc> <dir> [<functions>]
+#
+# Three programs are written to <dir>, each with <functions> (default
+# 2000) inline functions that are never called, so that only the front
+# end has any work to do:
+#   macros.nqc - every statement expands a few of 50 macros
+#   nested.nqc - if statements nested 30 deep
+#   exprs.nqc  - long chains of additions and subtractions
+# and nqc -frontend_bench reports the tokens per second of each stage,
+# and the nodes per second of the parser.
+#
+
+NQC=$1
+DIR=$2
+FUNCTIONS=${3:-2000}
+
+if [ -z "$NQC" ] || [ -z "$DIR" ]; then
+    echo "usage: $0 <nqc> <dir> [<functions>]" >&2
+    exit 2
+fi
+
+mkdir -p "$DIR" || exit 2
+
+awk -v n=$FUNCTIONS 'BEGIN {
+    for (m = 1; m <= 50; m++)
+        printf "#define ADD%d(a, b) ((a) + (b) + %d)\n", m, m
+    print "int x, y, z;"
+    for (f = 1; f <= n; f++) {
+        printf "void f%d()\n{\n", f
+        for (s = 0; s < 10; s++) {
+            m = (f * 7 + s * 3) % 50 + 1
+            k = (f + s * 11) % 50 + 1
+            printf "\tx = ADD%d(y, z) - ADD%d(x, %d);\n", m, k, s
+        }
+        print "}"
+    }
+    print "task main()\n{\n\tf1();\n}"
+}' > "$DIR/macros.nqc"
+
+awk -v n=$FUNCTIONS 'BEGIN {
+    depth = 30
+    print "int x, y, z;"
+    for (f = 1; f <= n; f++) {
+        printf "void f%d()\n{\n", f
+        for (d = 1; d <= depth; d++)
+            printf "%*sif (x > %d) {\n", d, "", d
+        printf "%*sy = y + z;\n", depth + 1, ""
+        for (d = depth; d >= 1; d--)
+            printf "%*s}\n", d, ""
+        print "}"
+    }
+    print "task main()\n{\n\tf1();\n}"
+}' > "$DIR/nested.nqc"
+
+awk -v n=$FUNCTIONS 'BEGIN {
+    terms = 100
+    print "int x, y, z;"
+    for (f = 1; f <= n; f++) {
+        printf "void f%d()\n{\n\tx = y", f
+        for (t = 1; t <= terms; t++)
+            printf " %s %s", (t % 2) ? "+" : "-", (t % 3) ? "z" : t
+        print ";\n}"
+    }
+    print "task main()\n{\n\tf1();\n}"
+}' > "$DIR/exprs.nqc"
+
+status=0
+for name in macros nested exprs; do
+    echo "# $name.nqc (`wc -c < "$DIR/$name.nqc"` bytes)"
+    for stage in lex preproc parse; do
+        "$NQC" -frontend_bench $stage "$DIR/$name.nqc" || status=1
+    done
+done
+
+exit $status
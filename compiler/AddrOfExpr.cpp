@@ -12,6 +12,7 @@
  *
  */
 #include "AddrOfExpr.h"
+#include "VarTranslator.h"
 #include "Variable.h"
 #include "Mapping.h"
 #include "Bytecode.h"
@@ -53,10 +54,9 @@ RCX_Value AddrOfExpr::EmitAny_(Bytecode &) const
 }
 
 
-void AddrOfExpr::Translate(int from, int to)
+void AddrOfExpr::Translate(const VarTranslator &vt)
 {
-    if (fValue == from)
-        fValue = to;
+    fValue = vt.Translate(fValue);
 }
 
 
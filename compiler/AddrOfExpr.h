@@ -18,11 +18,7 @@
 #include "Expr.h"
 #endif
 
-#ifndef __VarTranslator_h
-#include "VarTranslator.h"
-#endif
-
-class AddrOfExpr : public Expr, public Translatable
+class AddrOfExpr : public Expr
 {
 public:
     AddrOfExpr(int value, int offset, const LexLocation &loc);
@@ -37,7 +33,7 @@ public:
     virtual RCX_Value   GetStaticEA_() const;
     virtual bool        LValueIsPointer() const;
 
-    void                Translate(int from, int to);
+    void                Translate(const VarTranslator &vt);
 private:
     int                 fValue;
     int                 foffset;
@@ -12,10 +12,12 @@
  *
  */
 #include "ArrayExpr.h"
+#include "VarTranslator.h"
 #include "Mapping.h"
 #include "RCX_Cmd.h"
 #include "Bytecode.h"
 #include "Program.h"
+#include "Variable.h"
 
 Expr* ArrayExpr::Clone(Mapping *m) const
 {
@@ -24,6 +26,49 @@ Expr* ArrayExpr::Clone(Mapping *m) const
 }
 
 
+/*
+ * An element with a constant index (which inlining often leaves behind)
+ * is just a variable, so it can be used like one.  The var is only
+ * known once the array isn't a virtual var any more.
+ */
+int ArrayExpr::GetConstantVar() const
+{
+    int value;
+
+    if (fVar & kVirtualVarBase) return kIllegalVar;
+    if (!Get(0)->Evaluate(value)) return kIllegalVar;
+
+    return fVar + value;
+}
+
+
+int ArrayExpr::GetLValue() const
+{
+    return GetConstantVar();
+}
+
+
+RCX_Value ArrayExpr::GetStaticEA_() const
+{
+    int var = GetConstantVar();
+    if (var == kIllegalVar) return kIllegalEA;
+
+    return RCX_VALUE(kRCX_VariableType, var);
+}
+
+
+bool ArrayExpr::Contains(int var) const
+{
+    if (NodeExpr::Contains(var)) return true;
+
+    // any element could be read through a computed index
+    int value;
+    if (!Get(0)->Evaluate(value)) return var >= fVar;
+
+    return var == fVar + value;
+}
+
+
 RCX_Value ArrayExpr::EmitAny_(Bytecode &b) const
 {
     int value;
@@ -50,8 +95,32 @@ RCX_Value ArrayExpr::EmitAny_(Bytecode &b) const
 }
 
 
-void ArrayExpr::Translate(int from, int to)
+/*
+ * The element's index can be worked out in the destination itself,
+ * which is then loaded through, so no temp is needed.
+ */
+bool ArrayExpr::EmitTo_(Bytecode &b, int dst) const
+{
+    int value;
+
+    if (gProgram->GetOptimize() < Program::kBasicOptimize ||
+        Get(0)->Evaluate(value))
+        return Expr::EmitTo_(b, dst);
+
+    if (!Get(0)->EmitTo(b, dst)) return false;
+
+    if (fVar) {
+        RCX_Cmd cmd;
+        cmd.MakeVar(kRCX_AddVar, dst, RCX_VALUE(kRCX_ConstantType, fVar));
+        b.Add(cmd);
+    }
+
+    b.AddMove(dst, RCX_VALUE(kRCX_IndirectType, dst));
+    return true;
+}
+
+
+void ArrayExpr::Translate(const VarTranslator &vt)
 {
-    if (fVar == from)
-        fVar = to;
+    fVar = vt.Translate(fVar);
 }
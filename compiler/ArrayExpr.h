@@ -17,12 +17,7 @@
 
 #include "NodeExpr.h"
 
-#ifndef __VarTranslator_h
-#include "VarTranslator.h"
-#endif
-
-
-class ArrayExpr : public NodeExpr, public Translatable
+class ArrayExpr : public NodeExpr
 {
 public:
     ArrayExpr(int var, Expr *e) : NodeExpr(e), fVar(var) {}
@@ -30,12 +25,18 @@ public:
     virtual Expr*       Clone(Mapping *b) const;
     virtual bool        PromiseConstant() const  { return false; }
     virtual bool        PotentialLValue() const { return true; }
+    virtual int         GetLValue() const;
+    virtual bool        Contains(int var) const;
 
     virtual RCX_Value   EmitAny_(Bytecode &b) const;
+    virtual RCX_Value   GetStaticEA_() const;
+    virtual bool        EmitTo_(Bytecode &b, int dst) const;
 
-    virtual void        Translate(int from, int to);
+    virtual void        Translate(const VarTranslator &vt);
 
 private:
+    int     GetConstantVar() const;
+
     int     fVar;
 };
 
@@ -55,20 +55,38 @@ Stmt* AsmStmt::CloneActual(Mapping *m) const
 }
 
 
-void AsmStmt::GetExprs(vector<Expr *> &v) const
+int AsmStmt::GetExprCount() const
 {
-    Field *f;
+    int n = 0;
+
+    for (Field *f = fFields.GetHead(); f; f=f->GetNext())
+        ++n;
 
-    for (f = fFields.GetHead(); f; f=f->GetNext()) {
-        v.push_back(f->GetExpr());
-    }
+    return n;
+}
+
+
+Expr* AsmStmt::GetExpr(int i) const
+{
+    return GetField(i)->GetExpr();
+}
+
+
+const Field* AsmStmt::GetField(int i) const
+{
+    Field *f = fFields.GetHead();
+
+    while(i--)
+        f = f->GetNext();
+
+    return f;
 }
 
 
 
 Field::~Field()
 {
-    delete fExpr;
+    Expr::Release(fExpr);
 }
 
 
@@ -113,6 +131,14 @@ void EAField::PreEmit(Bytecode &b)
 }
 
 
+bool EAField::AcceptsConstant() const
+{
+    // a field with no sources listed takes anything, which may
+    // include an operand the instruction writes to
+    return (fRestrictor & kSourceMask & TYPEMASK(kRCX_ConstantType)) != 0;
+}
+
+
 void EAField::Emit(Bytecode &b, vector<UByte> &v) const
 {
     if (!(fRestrictor & kNoTypeCode))
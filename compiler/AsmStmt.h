@@ -41,7 +41,10 @@ public:
     virtual void    PreEmit(Bytecode &)     {};
     virtual void    Emit(Bytecode &b, vector<UByte> &v) const = 0;
 
-    Expr*           GetExpr() { return fExpr; }
+    Expr*           GetExpr() const { return fExpr; }
+
+    /// True if the field only reads its expression, and takes a constant
+    virtual bool    AcceptsConstant() const { return false; }
 
 protected:
     Expr*   fExpr;
@@ -58,7 +61,9 @@ public:
 
     void        Add(Field *f)   { fFields.InsertTail(f); }
 
-    virtual void    GetExprs(vector<Expr*> & v) const;
+    virtual int     GetExprCount() const;
+    virtual Expr*   GetExpr(int i) const;
+    const Field*    GetField(int i) const;
 
 private:
     PListS<Field>   fFields;
@@ -95,6 +100,7 @@ public:
     virtual Field*  Clone(Mapping *m) const;
     virtual void    PreEmit(Bytecode &b);
     virtual void    Emit(Bytecode &b, vector<UByte> &v) const;
+    virtual bool    AcceptsConstant() const;
 
 private:
     ULong       fRestrictor;
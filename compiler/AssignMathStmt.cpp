@@ -17,6 +17,10 @@
 #include "Bytecode.h"
 #include "Expr.h"
 #include "Error.h"
+#include "Program.h"
+#include "ExprSharer.h"
+
+static bool IsIdentity(RCX_VarCode code, const Expr *value);
 
 
 AssignMathStmt::AssignMathStmt(Expr *lval, RCX_VarCode code, Expr * value)
@@ -27,6 +31,7 @@ AssignMathStmt::AssignMathStmt(Expr *lval, RCX_VarCode code, Expr * value)
 
 void AssignMathStmt::EmitActual(Bytecode &b)
 {
+    ExprSharer sharer(b, this);
     RCX_Value dst = fLval->EmitAny(b);
 
     if (RCX_VALUE_TYPE(dst) == kRCX_VariableType) {
@@ -45,6 +50,8 @@ void AssignMathStmt::EmitActual(Bytecode &b)
 
 void AssignMathStmt::EmitOperation(Bytecode &b, int var)
 {
+    if (IsIdentity(fCode, fValue)) return;
+
     RCX_Value ea = fValue->EmitMath(b);
     if (ea != Expr::kIllegalEA) {
         RCX_Cmd cmd;
@@ -56,6 +63,8 @@ void AssignMathStmt::EmitOperation(Bytecode &b, int var)
 
 void AssignMathStmt::EmitValueOperation(Bytecode &b, RCX_Value dst)
 {
+    if (IsIdentity(fCode, fValue)) return;
+
     RCX_Value ea = fValue->EmitMath(b);
     if (ea != Expr::kIllegalEA){
         RCX_Cmd cmd;
@@ -70,3 +79,28 @@ Stmt* AssignMathStmt::CloneActual(Mapping *m) const
 {
     return new AssignMathStmt(fLval->Clone(m), fCode, fValue->Clone(m));
 }
+
+
+// x += 0, x *= 1 and the like don't need an instruction
+bool IsIdentity(RCX_VarCode code, const Expr *value)
+{
+    int v;
+
+    if (gProgram->GetOptimize() < Program::kBasicOptimize) return false;
+    if (!value->Evaluate(v)) return false;
+
+    switch(code) {
+        case kRCX_AddVar:
+        case kRCX_SubVar:
+        case kRCX_OrVar:
+        case kRCX_XOrVar:
+        case kRCX_ShlVar:
+        case kRCX_ShrVar:
+            return v == 0;
+        case kRCX_MulVar:
+        case kRCX_DivVar:
+            return v == 1;
+        default:
+            return false;
+    }
+}
@@ -16,8 +16,10 @@
 #include "RCX_Cmd.h"
 #include "Bytecode.h"
 #include "Expr.h"
+#include "BinaryExpr.h"
 #include "RCX_Target.h"
 #include "Error.h"
+#include "ExprSharer.h"
 
 AssignStmt::AssignStmt(Expr *lval, Expr * value)
  :	fLval(lval),
@@ -28,13 +30,14 @@ AssignStmt::AssignStmt(Expr *lval, Expr * value)
 
 AssignStmt::~AssignStmt()
 {
-	delete fLval;
-	delete fValue;
+	Expr::Release(fLval);
+	Expr::Release(fValue);
 }
 
 
 void AssignStmt::EmitActual(Bytecode &b)
 {
+	ExprSharer sharer(b, this);
 	RCX_Value dst = fLval->EmitAny(b);
 	int type = RCX_VALUE_TYPE(dst);
 
@@ -46,6 +49,12 @@ void AssignStmt::EmitActual(Bytecode &b)
 	{
 		if (b.GetTarget()->SourceWritable(type))
 		{
+			if (b.GetTarget()->fHasExtendedMathOps && EmitSourceMath(b, dst))
+			{
+				b.ReleaseTempEA(dst);
+				return;
+			}
+
 			RCX_Cmd cmd;
 			RCX_Value ea = fValue->EmitAny(b);
 
@@ -63,14 +72,55 @@ void AssignStmt::EmitActual(Bytecode &b)
 }
 
 
-Stmt* AssignStmt::CloneActual(Mapping *m) const
+/*
+ * Firmware with math on any source (Swan) doesn't need a temp for
+ * src = src op b, which is a single src op= b, or for src = a op c,
+ * which is src = a followed by src op= c.  Only a constant c is used in
+ * the second form, since anything else might read src after it has
+ * been set.
+ */
+bool AssignStmt::EmitSourceMath(Bytecode &b, RCX_Value dst)
 {
-	return new AssignStmt(fLval->Clone(m), fValue->Clone(m));
+	const BinaryExpr *math = dynamic_cast<const BinaryExpr*>(fValue);
+	if (!math) return false;
+
+	RCX_VarCode code = math->GetCode();
+	if (code == kRCX_IllegalVar) return false;
+
+	const Expr *lhs = math->GetLeft();
+	const Expr *rhs = math->GetRight();
+	bool inPlace = fLval->Matches(lhs);
+	int v;
+
+	if (!inPlace && !rhs->Evaluate(v)) return false;
+
+	RCX_Cmd cmd;
+	RCX_Value ea;
+
+	if (!inPlace) {
+		ea = lhs->EmitAny(b);
+		if (ea == Expr::kIllegalEA) return true;
+
+		cmd.MakeSet(dst, ea);
+		b.Add(cmd);
+		b.ReleaseTempEA(ea);
+	}
+
+	if (rhs->Evaluate(v) && BinaryExpr::IsIdentity(math->GetOp(), v, true))
+		return true;
+
+	ea = rhs->EmitMath(b);
+	if (ea == Expr::kIllegalEA) return true;
+
+	cmd.MakeSetMath(dst, ea, code);
+	b.Add(cmd);
+	b.ReleaseTempEA(ea);
+
+	return true;
 }
 
 
-void AssignStmt::GetExprs(vector<Expr *> &v) const
+Stmt* AssignStmt::CloneActual(Mapping *m) const
 {
-	v.push_back(fLval);
-	v.push_back(fValue);
+	return new AssignStmt(fLval->Clone(m), fValue->Clone(m));
 }
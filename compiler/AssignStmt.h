@@ -18,6 +18,10 @@
 #include "Stmt.h"
 #endif
 
+#ifndef __RCX_Constants_h
+#include "RCX_Constants.h"
+#endif
+
 class Expr;
 
 class AssignStmt : public LeafStmt
@@ -27,9 +31,12 @@ public:
 				~AssignStmt();
 
 	void		EmitActual(Bytecode &b);
+	bool		EmitSourceMath(Bytecode &b, RCX_Value dst);
 	Stmt*		CloneActual(Mapping *b) const;
 
-	virtual void	GetExprs(vector<Expr*> & v) const;
+	virtual int	GetExprCount() const	{ return 2; }
+	virtual Expr*	GetExpr(int i) const	{ return i ? fValue : fLval; }
+	const Expr*	GetLval() const		{ return fLval; }
 
 protected:
 	Expr*		fLval;
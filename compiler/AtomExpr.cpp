@@ -12,6 +12,7 @@
  *
  */
 #include "AtomExpr.h"
+#include "VarTranslator.h"
 #include "Variable.h"
 #include "Mapping.h"
 #include "Bytecode.h"
@@ -84,13 +85,10 @@ RCX_Value AtomExpr::EmitAny_(Bytecode &) const
 }
 
 
-void AtomExpr::Translate(int from, int to)
+void AtomExpr::Translate(const VarTranslator &vt)
 {
-	if (((fType == kRCX_VariableType) || (fType == kRCX_IndirectType)) &&
-		fValue == from)
-	{
-		fValue = to;
-	}
+	if ((fType == kRCX_VariableType) || (fType == kRCX_IndirectType))
+		fValue = vt.Translate(fValue);
 }
 
 
@@ -113,10 +111,23 @@ Expr* AtomExpr::Clone(Mapping *m) const
 		}
 	}
 
+	// variables are renumbered and propagated into for each expansion
+	// (see ScopeStmt and ConstPropagator), anything else can be shared
+	if (m && fType != kRCX_VariableType && fType != kRCX_IndirectType)
+		return Share();
+
 	return new AtomExpr(fType, fValue, GetLoc(), fPtr);
 }
 
 
+bool AtomExpr::Matches(const Expr *e) const
+{
+	const AtomExpr *a = dynamic_cast<const AtomExpr*>(e);
+
+	return a && a->fType == fType && a->fValue == fValue && a->fPtr == fPtr;
+}
+
+
 
 RCX_Value AtomExpr::GetStaticEA_() const
 {
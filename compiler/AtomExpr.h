@@ -19,11 +19,7 @@
 #include "Expr.h"
 #endif
 
-#ifndef __VarTranslator_h
-#include "VarTranslator.h"
-#endif
-
-class AtomExpr : public Expr, public Translatable
+class AtomExpr : public Expr
 {
 public:
 		AtomExpr(RCX_ValueType type, int value, const LexLocation &loc, bool ptr = false);
@@ -33,6 +29,8 @@ public:
 
 	virtual bool		Evaluate(int &value) const;
 	virtual Expr*		Clone(Mapping *b) const;
+	virtual bool		Fold()	{ return true; }
+	virtual bool		Matches(const Expr *e) const;
 
 	virtual bool		PotentialLValue() const;
 	virtual int			GetLValue() const;
@@ -42,7 +40,10 @@ public:
 	virtual RCX_Value	EmitAny_(Bytecode &b) const;
 	virtual RCX_Value	GetStaticEA_() const;
 
-	void				Translate(int from, int to);
+	void				Translate(const VarTranslator &vt);
+
+	/// Turn a variable into a constant whose value it is known to hold
+	void				SetConstant(int value)	{ fType = kRCX_ConstantType; fValue = value; }
 private:
 	RCX_ValueType	fType;
 	int				fValue;
@@ -12,67 +12,98 @@
  *
  */
 #include "AutoFree.h"
+#include "CompileContext.h"
 
 AutoFreeGroup& GetAutoFreeGroup()
 {
-    static AutoFreeGroup afGroup;
+    return CompileContext::Get()->fAutoFreeGroup;
+}
+
 
-    return afGroup;
+AutoFreeGroup::AutoFreeGroup() :
+    current_(0),
+    allocations_(0)
+{
 }
 
 
-AutoFreeGroup::AutoFreeGroup()
+AutoFreeGroup::~AutoFreeGroup()
 {
-    head_.next_ = &tail_;
-    head_.prev_ = 0;
-    tail_.next_ = 0;
-    tail_.prev_ = &head_;
+    freeAll();
 }
 
 
 void* AutoFreeGroup::allocate(size_t n)
 {
-    // allocate memory plus overhead for link
-    Link *link = (Link *) ::operator new(n + sizeof(Link));
+    // keep every object aligned
+    n = (n + kAlignment - 1) & ~(size_t)(kAlignment - 1);
+
+    if (!current_ || current_->size_ - current_->used_ < n)
+        newChunk(n);
+
+    void *ptr = current_->data() + current_->used_;
+    current_->used_ += n;
+
+    // mark() allocates nothing and isn't an object
+    if (n) ++allocations_;
+
+    return ptr;
+}
+
+
+void AutoFreeGroup::free(void * /* ptr */)
+{
+    // the memory is reclaimed along with the rest of the group
+}
+
+
+void AutoFreeGroup::freeAll()
+{
+    while(current_)
+        releaseChunk();
+}
 
-    // link memory into pool list
-    link->next_ = head_.next_;
-    link->prev_ = &head_;
-    link->next_->prev_ = link;
-    link->prev_->next_ = link;
 
-    // return pointer to memory past the link
-    return (void *)((char *)link + sizeof(Link));
+void* AutoFreeGroup::mark()
+{
+    // the marker is the current top of the arena
+    return allocate(0);
 }
 
 
-void AutoFreeGroup::free(void *ptr)
+void AutoFreeGroup::freeTo(void *marker)
 {
-    if (ptr==0) return;
+    char *m = (char *)marker;
 
-    // determine pointer to link
-    Link *link = (Link *)((char *)ptr - sizeof(Link));
+    // discard whole chunks allocated after the marker
+    while(current_ && (m < current_->data() || m > current_->data() + current_->size_))
+        releaseChunk();
 
-    dispose(link);
+    if (current_)
+        current_->used_ = m - current_->data();
 }
 
 
-void AutoFreeGroup::dispose(Link *link)
+void AutoFreeGroup::newChunk(size_t n)
 {
-    // unlink memory from pool list
-    link->prev_->next_ = link->next_;
-    link->next_->prev_ = link->prev_;
+    // oversized requests get a chunk of their own
+    size_t size = (n > kChunkSize) ? n : kChunkSize;
 
-    // free the memory
-    ::operator delete((void*)link);
+    Chunk *c = (Chunk *) ::operator new(kHeaderSize + size);
+    c->prev_ = current_;
+    c->size_ = size;
+    c->used_ = 0;
+
+    current_ = c;
+    CompileStats::Get().Allocate(CompileStats::kNodePool, (long)(kHeaderSize + size));
 }
 
 
-void AutoFreeGroup::freeAll()
+void AutoFreeGroup::releaseChunk()
 {
-    Link *link;
+    Chunk *c = current_;
 
-    while((link = head_.next_)->next_ != 0) {
-        dispose(link);
-    }
+    current_ = c->prev_;
+    CompileStats::Get().Release(CompileStats::kNodePool, (long)(kHeaderSize + c->size_));
+    ::operator delete((void*)c);
 }
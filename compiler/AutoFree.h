@@ -18,10 +18,18 @@
 
 using std::size_t;
 
+/**
+ * An arena for compiler objects.  Memory comes from large chunks
+ * that are carved up by bumping a pointer, so allocating is cheap
+ * and objects allocated together stay close together.  Freeing an
+ * individual object does nothing; the memory is reclaimed when the
+ * whole group is released by freeAll() or freeTo().
+ */
 class AutoFreeGroup
 {
 public:
     AutoFreeGroup();
+    ~AutoFreeGroup();
 
     /// Called by ::new operator
     void* allocate(size_t);
@@ -31,19 +39,38 @@ public:
     /// Call this to release all remaining objects
     void freeAll();
 
+    /// Place a marker in the pool; objects allocated before it
+    /// survive a subsequent call to freeTo()
+    void* mark();
+    /// Release all objects allocated since the marker was placed
+    void freeTo(void *marker);
+
+    /// Number of objects allocated over the life of the group
+    size_t allocations() const { return allocations_; }
+
 private:
-    struct Link
+    enum {
+        kChunkSize = 64 * 1024,
+        kAlignment = 2 * sizeof(void*)
+    };
+
+    struct Chunk
     {
-        Link* next_;
-        Link* prev_;
+        Chunk* prev_;
+        size_t size_;
+        size_t used_;
+
+        char* data() { return (char *)this + kHeaderSize; }
     };
 
-    // internal call to unlink and dispose an item
-    void dispose(Link *link);
+    // chunk data starts on an aligned boundary
+    enum { kHeaderSize = (sizeof(Chunk) + kAlignment - 1) & ~(kAlignment - 1) };
 
+    void newChunk(size_t n);
+    void releaseChunk();
 
-    Link head_;
-    Link tail_;
+    Chunk* current_;
+    size_t allocations_;
 };
 
 
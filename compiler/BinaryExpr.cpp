@@ -12,6 +12,7 @@
  *
  */
 #include "BinaryExpr.h"
+#include "AtomExpr.h"
 #include "parser.h"
 #include "Bytecode.h"
 #include "RCX_Cmd.h"
@@ -38,22 +39,22 @@ static RCX_VarCode GetBinaryCode(int op)
 		case '|':
 			return kRCX_OrVar;
 		case '%':
-			if (t->fType == kRCX_SwanTarget)
+			if (t->fHasExtendedMathOps)
 				return kRCX_ModVar;
 			else
 				return kRCX_IllegalVar;
 		case LEFT:
-			if (t->fType == kRCX_SwanTarget)
+			if (t->fHasExtendedMathOps)
 				return kRCX_ShlVar;
 			else
 				return kRCX_IllegalVar;
 		case RIGHT:
-			if (t->fType == kRCX_SwanTarget)
+			if (t->fHasExtendedMathOps)
 				return kRCX_ShrVar;
 			else
 				return kRCX_IllegalVar;
 		case '^':
-			if (t->fType == kRCX_SwanTarget)
+			if (t->fHasExtendedMathOps)
 				return kRCX_XOrVar;
 			else
 				return kRCX_IllegalVar;
@@ -72,7 +73,16 @@ BinaryExpr::BinaryExpr(Expr *lhs, int op, Expr *rhs)
 
 Expr* BinaryExpr::Clone(Mapping *b) const
 {
-	return new BinaryExpr(Get(0)->Clone(b), fOp, Get(1)->Clone(b));
+	Expr *e[2];
+
+	if (CloneExprs(b, e)) return Share();
+	return new BinaryExpr(e[0], fOp, e[1]);
+}
+
+
+bool BinaryExpr::Matches(const Expr *e) const
+{
+	return MatchesExprs(e) && static_cast<const BinaryExpr*>(e)->fOp == fOp;
 }
 
 
@@ -123,6 +133,58 @@ bool BinaryExpr::Evaluate(int &value) const
 }
 
 
+bool BinaryExpr::Fold()
+{
+	bool pure = FoldExprs();
+
+	// (a op c1) op c2 becomes a op (c1 op c2), saving an instruction
+	// and keeping the constant out of a temp
+	BinaryExpr *lhs = dynamic_cast<BinaryExpr*>(Get(0));
+	int c1, c2, c;
+
+	if (!lhs || !Get(1)->Evaluate(c2) || !lhs->Get(1)->Evaluate(c1))
+		return pure;
+
+	switch(fOp)
+	{
+		case '+':
+		case '-':
+			if (lhs->fOp != '+' && lhs->fOp != '-') return pure;
+			c = (lhs->fOp == fOp) ? c1 + c2 : c1 - c2;
+			break;
+		case '&':
+		case '|':
+			if (lhs->fOp != fOp) return pure;
+			c = (fOp == '&') ? (c1 & c2) : (c1 | c2);
+			break;
+		default:
+			return pure;
+	}
+
+	if (c < kMinConstant || c > kMaxConstant)
+		return pure;
+
+	int op = lhs->fOp;
+
+	// a - (-1) reads better as a + 1
+	if (c < 0 && (op == '+' || op == '-')) {
+		c = -c;
+		op = (op == '+') ? '-' : '+';
+	}
+
+	Expr *rhs = Get(1);
+	Set(1, new AtomExpr(kRCX_ConstantType, c, rhs->GetLoc()));
+	Release(rhs);
+
+	// lhs may be shared, so it keeps its own operand
+	Set(0, lhs->Get(0)->Share());
+	fOp = op;
+	Release(lhs);
+
+	return pure;
+}
+
+
 RCX_Value BinaryExpr::EmitAny_(Bytecode &b) const
 {
 	RCX_Cmd cmd;
@@ -130,8 +192,14 @@ RCX_Value BinaryExpr::EmitAny_(Bytecode &b) const
 	RCX_Value dstEA;
 	int dst;
 	RCX_VarCode code;
+	if (const Expr *e = GetIdentityOperand())
+		return e->EmitAny(b);
 
-	ea = Get(0)->EmitAny(b);
+	bool swap = SwapOperands(kIllegalVar);
+	const Expr *first = Get(swap ? 1 : 0);
+	const Expr *second = Get(swap ? 0 : 1);
+
+	ea = first->EmitAny(b);
 	if (ea == kIllegalEA) return ea;
 
 	if (b.IsTempEA(ea))
@@ -147,7 +215,7 @@ RCX_Value BinaryExpr::EmitAny_(Bytecode &b) const
 
 	code = GetBinaryCode(fOp);
 	dstEA = RCX_VALUE(kRCX_VariableType, dst);
-	ea = Get(1)->EmitMath(b);
+	ea = second->EmitMath(b);
 	if (ea == kIllegalEA)
 	{
 		b.ReleaseTempEA(dstEA);
@@ -164,15 +232,22 @@ RCX_Value BinaryExpr::EmitAny_(Bytecode &b) const
 
 bool BinaryExpr::EmitTo_(Bytecode &b, int dst) const
 {
-	if (Get(1)->Contains(dst))
+	if (const Expr *e = GetIdentityOperand())
+		return e->EmitTo(b, dst);
+
+	bool swap = SwapOperands(dst);
+	const Expr *first = Get(swap ? 1 : 0);
+	const Expr *second = Get(swap ? 0 : 1);
+
+	if (second->Contains(dst))
 		return Expr::EmitTo_(b, dst);
 	else
 	{
-		Get(0)->EmitTo(b, dst);
+		first->EmitTo(b, dst);
 
 		RCX_Cmd cmd;
 		RCX_VarCode code = GetBinaryCode(fOp);
-		RCX_Value ea = Get(1)->EmitMath(b);
+		RCX_Value ea = second->EmitMath(b);
 		if (ea == kIllegalEA) return false;
 
 		cmd.MakeVar(code, dst, ea);
@@ -182,6 +257,106 @@ bool BinaryExpr::EmitTo_(Bytecode &b, int dst) const
 	}
 }
 
+/*
+ * For commutative operators, evaluate the right side first when only
+ * it needs code.  The left side can then be applied directly instead
+ * of being moved into the destination first, which also frees up the
+ * temp the right side would have needed.
+ */
+bool BinaryExpr::SwapOperands(int dst) const
+{
+	if (gProgram->GetOptimize() < Program::kBasicOptimize)
+		return false;
+
+	switch(fOp) {
+		case '+':
+		case '*':
+		case '&':
+		case '|':
+		case '^':
+			break;
+		default:
+			return false;
+	}
+
+	RCX_Value ea = Get(0)->GetStaticEA();
+	if (ea == kIllegalEA || Get(1)->GetStaticEA() != kIllegalEA)
+		return false;
+
+	// the right side must not change what the left side reads
+	switch(RCX_VALUE_TYPE(ea)) {
+		case kRCX_VariableType:
+			if (Get(1)->Contains(RCX_VALUE_DATA(ea))) return false;
+			break;
+		case kRCX_IndirectType:
+			return false;
+		default:
+			break;
+	}
+
+	return dst == kIllegalVar || !Get(0)->Contains(dst);
+}
+
+
+RCX_Value BinaryExpr::GetStaticEA_() const
+{
+	const Expr *e = GetIdentityOperand();
+	return e ? e->GetStaticEA() : kIllegalEA;
+}
+
+
+/*
+ * Generated code (macros, inline functions with constant arguments)
+ * is full of things like x*1 and x+0.  There is no cheaper way to
+ * multiply or divide on these targets since every math operation is a
+ * single instruction, but operations that don't change the value can
+ * be left out entirely.
+ */
+const Expr* BinaryExpr::GetIdentityOperand() const
+{
+	int v;
+
+	if (gProgram->GetOptimize() < Program::kBasicOptimize)
+		return 0;
+
+	if (Get(1)->Evaluate(v) && IsIdentity(fOp, v, true))
+		return Get(0);
+
+	if (Get(0)->Evaluate(v) && IsIdentity(fOp, v, false))
+		return Get(1);
+
+	return 0;
+}
+
+
+bool BinaryExpr::IsIdentity(int op, int value, bool right)
+{
+	switch(op)
+	{
+		case '+':
+		case '|':
+		case '^':
+			return value == 0;
+		case '*':
+			return value == 1;
+		case '-':
+		case LEFT:
+		case RIGHT:
+			return right && value == 0;
+		case '/':
+			return right && value == 1;
+		default:
+			return false;
+	}
+}
+
+
+RCX_VarCode BinaryExpr::GetCode() const
+{
+	return GetBinaryCode(fOp);
+}
+
+
 bool BinaryExpr::NeedsConstant(int op)
 {
 	return GetBinaryCode(op) == kRCX_IllegalVar;
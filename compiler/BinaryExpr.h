@@ -23,13 +23,25 @@ public:
 
 	virtual bool		Evaluate(int &value) const;
 	virtual Expr*		Clone(Mapping *b) const;
+	virtual bool		Fold();
+	virtual bool		Matches(const Expr *e) const;
 
 	virtual RCX_Value	EmitAny_(Bytecode &b) const;
 	virtual bool		EmitTo_(Bytecode &b, int dst) const;
+	virtual RCX_Value	GetStaticEA_() const;
+
+	int			GetOp() const	{ return fOp; }
+	const Expr*	GetLeft() const	{ return Get(0); }
+	const Expr*	GetRight() const	{ return Get(1); }
+	RCX_VarCode	GetCode() const;
 
 	static bool	NeedsConstant(int op);
+	static bool	IsIdentity(int op, int value, bool right);
 
 private:
+	bool		SwapOperands(int dst) const;
+	const Expr*	GetIdentityOperand() const;
+
 	int			fOp;
 };
 
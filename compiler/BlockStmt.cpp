@@ -12,6 +12,19 @@
  *
  */
 #include "BlockStmt.h"
+#include "CaseStmt.h"
+#include "DeclareStmt.h"
+#include "SwitchStmt.h"
+#include "Program.h"
+
+class CaseFinder
+{
+public:
+            CaseFinder() : fFound(false) {}
+    bool    operator()(Stmt *s);
+
+    bool    fFound;
+};
 
 BlockStmt::BlockStmt()
 {
@@ -53,9 +66,74 @@ void BlockStmt::Prepend(Stmt *s)
 
 void BlockStmt::EmitActual(Bytecode &b)
 {
+    bool prune = gProgram->GetOptimize() >= Program::kBasicOptimize;
+    bool reachable = true;
+    bool resumes = false;
+
     for(Stmt *s = fList.GetHead(); s; s = s->GetNext()) {
+        if (!reachable) {
+            // declarations must still be emitted if code using them
+            // can be jumped to later on
+            if (IsEntry(s))
+                reachable = true;
+            else if (!resumes || !dynamic_cast<DeclareStmt*>(s))
+                continue;
+        }
+
         s->Emit(b);
+
+        if (prune && reachable && !s->FallsThrough()) {
+            reachable = false;
+            resumes = false;
+            for(Stmt *t = s->GetNext(); t && !resumes; t = t->GetNext())
+                resumes = IsEntry(t);
+        }
+    }
+}
+
+
+bool BlockStmt::FallsThrough()
+{
+    bool reachable = true;
+
+    for(Stmt *s = fList.GetHead(); s; s = s->GetNext()) {
+        if (!reachable) {
+            if (!IsEntry(s)) continue;
+            reachable = true;
+        }
+
+        if (!s->FallsThrough())
+            reachable = false;
     }
+
+    return reachable;
+}
+
+
+bool BlockStmt::IsEntry(Stmt *s)
+{
+    // goto targets mark their ancestors as MustEmit, but case
+    // labels have to be searched for
+    if (s->GetMustEmit()) return true;
+
+    CaseFinder f;
+    Apply(s, f);
+    return f.fFound;
+}
+
+
+bool CaseFinder::operator()(Stmt *s)
+{
+    // cases in a nested switch belong to that switch
+    if (fFound || dynamic_cast<SwitchStmt*>(s))
+        return false;
+
+    if (dynamic_cast<CaseStmt*>(s)) {
+        fFound = true;
+        return false;
+    }
+
+    return true;
 }
 
 
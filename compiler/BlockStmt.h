@@ -35,8 +35,11 @@ public:
 
     virtual void    EmitActual(Bytecode &b);
     virtual Stmt*   CloneActual(Mapping *b) const;
+    virtual bool    FallsThrough();
 
 private:
+    static bool     IsEntry(Stmt *s);
+
     PListS<Stmt>    fList;
 };
 
@@ -12,12 +12,25 @@
  *
  */
 
+#include <cctype>
 #include <cstdio>
 #include <cstring>
+#include <algorithm>
 
 #include "Buffer.h"
+#include "CompileStats.h"
+
+#if defined(WIN32) || defined(macintosh)
+#define NO_MMAP
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 
 using std::fopen;
+using std::upper_bound;
 using std::memcpy;
 using std::strlen;
 
@@ -33,7 +46,8 @@ using std::strcpy;
 Buffer::Buffer() :
     fName(0),
     fData(0),
-    fLength(0)
+    fLength(0),
+    fMapped(false)
 {
 }
 
@@ -41,12 +55,25 @@ Buffer::Buffer() :
 Buffer::~Buffer()
 {
     delete [] fName;
-    delete [] fData;
+#ifndef NO_MMAP
+    if (fMapped)
+        munmap(fData, fLength);
+    else
+#endif
+    {
+        CompileStats::Get().Release(CompileStats::kBufferPool, fLength);
+        delete [] fData;
+    }
 }
 
 
 bool Buffer::Create(const char *name, const char *pathname)
 {
+    if (Map(pathname)) {
+        FinishCreate(name);
+        return true;
+    }
+
     FILE *fp = fopen(pathname, "rb");
     if (!fp) return false;
 
@@ -117,31 +144,85 @@ void Buffer::FinishCreate(const char *name)
     fName = new char[strlen(name) + 1];
     strcpy(fName, name);
 
-    ConvertLineEndings();
+    // the last line must be terminated (the heap copies all have
+    // room for it, and a mapping is only used if it already ends
+    // with a line break)
+    if (fLength==0 || (fData[fLength-1] != CR && fData[fLength-1] != LF))
+        fData[fLength++] = '\n';
 
-    // do this after ConvertLineEndings() since mac files might
-    // end with CR and \n is an LF, so CRLF would get reduced if
-    // \n was added before conversion
-    fData[fLength++] = '\n';
+    // a mapped file is paged in from the file, not allocated
+    if (!fMapped)
+        CompileStats::Get().Allocate(CompileStats::kBufferPool, fLength);
 }
 
 
-const char *Buffer::GetLine(int line) const
+/**
+ * bool Buffer::Map(const char *pathname)
+ *
+ * map the file read-only instead of copying it.  This fails for empty
+ * files and files that don't end with a line break, which are read
+ * into memory instead.
+ */
+
+#ifdef NO_MMAP
+bool Buffer::Map(const char * /* pathname */)
 {
-    if (line < 1) return 0;
+    return false;
+}
+#else
+bool Buffer::Map(const char *pathname)
+{
+    int fd = open(pathname, O_RDONLY);
+    if (fd < 0) return false;
 
-    const char *ptr = fData;
-    const char *end = fData + fLength;
+    struct stat stat_buf;
+    if (fstat(fd, &stat_buf) != 0 || !S_ISREG(stat_buf.st_mode) || stat_buf.st_size == 0) {
+        close(fd);
+        return false;
+    }
+
+    int length = (int)stat_buf.st_size;
+    void *ptr = mmap(0, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (ptr == MAP_FAILED) return false;
 
-    --line;
-    while (line) {
-        if (ptr == end)
-            return 0;
-        if (*ptr++ == '\n')
-            --line;
+    char last = ((const char *)ptr)[length-1];
+    if (last != CR && last != LF) {
+        munmap(ptr, length);
+        return false;
     }
 
-    return ptr;
+    fData = (char *)ptr;
+    fLength = length;
+    fMapped = true;
+    return true;
+}
+#endif
+
+
+/**
+ * bool Buffer::IsLineEnd(const char *ptr) const
+ *
+ * true if the character ends a line: an LF, or a CR that isn't the
+ * first half of a CR-LF pair.
+ */
+
+bool Buffer::IsLineEnd(const char *ptr) const
+{
+    if (*ptr == LF) return true;
+    return *ptr == CR && (ptr+1 == fData + fLength || ptr[1] != LF);
+}
+
+
+const char *Buffer::GetLine(int line) const
+{
+    if (line < 1) return 0;
+
+    const vector<int> &starts = GetLineStarts();
+    if (line > (int)starts.size()) return 0;
+
+    return fData + starts[line-1];
 }
 
 
@@ -154,22 +235,16 @@ const char *Buffer::GetLine(int line) const
 
 int Buffer::FindLine(int &offset) const
 {
-    const char *ptr = fData;
-    const char *lineStart = fData;
-    int line = 1;
+    const vector<int> &starts = GetLineStarts();
 
     // clip the offset to fLength-1 since fData[fLength-1] is implicitly
     // the last line of the buffer and no line can start after it
-    const char *end = ptr + ((offset < (fLength-1)) ? offset : fLength-1);
+    int clipped = (offset < (fLength-1)) ? offset : fLength-1;
 
-    while (ptr < end) {
-        if (*ptr++ == '\n') {
-            ++line;
-            lineStart = ptr; // ptr is already adjusted past the NL
-        }
-    }
+    // the line is the number of line starts at or before the offset
+    int line = upper_bound(starts.begin(), starts.end(), clipped) - starts.begin();
 
-    offset = lineStart - fData;
+    offset = starts[line-1];
     return line;
 }
 
@@ -183,13 +258,9 @@ int Buffer::FindLine(int &offset) const
 
 int Buffer::FindStartOfLine(int offset) const
 {
-    const char *ptr = fData + offset;
-    while (ptr > fData) {
-        --ptr;
-        if (*ptr == '\n') return (ptr - fData + 1);
-    }
+    const vector<int> &starts = GetLineStarts();
 
-    return 0;
+    return *(upper_bound(starts.begin(), starts.end(), offset) - 1);
 }
 
 
@@ -198,51 +269,197 @@ int Buffer::FindStartOfLine(int offset) const
  * int Buffer::FindEndOfLine(int offset) const
  *
  * return the offset of the newline ending the line containing the
- * specified offset.
+ * specified offset (the LF of a CR-LF pair).
  */
 
 int Buffer::FindEndOfLine(int offset) const
 {
-    const char *ptr = fData + offset;
-    const char *end = fData + fLength;
+    const vector<int> &starts = GetLineStarts();
 
-    while (ptr < end) {
-        if (*ptr == '\n') return ptr - fData;
-        ++ptr;
-    }
+    // the newline is just before the start of the next line
+    vector<int>::const_iterator next = upper_bound(starts.begin(), starts.end(), offset);
+    if (next == starts.end())
+        return fLength - 1;
 
-    return fLength - 1;
+    return *next - 1;
 }
 
 
-void Buffer::ConvertLineEndings()
+/**
+ * const vector<int> &Buffer::GetLineStarts() const
+ *
+ * return the offset of the start of each line, building the table the
+ * first time it is needed.  The last entry is fLength since the buffer
+ * always ends with a newline.
+ */
+
+const vector<int> &Buffer::GetLineStarts() const
 {
-    const char *src, *end;
-    char *dst;
-
-    src = fData;
-    end = src + fLength;
-    dst = fData;
-
-    while (src < end) {
-        char c = *src++;
-
-        switch(c) {
-            case CR:
-                *dst++ = '\n';
-                // skip second part of CR-LF pair
-                if (src < end && *src==LF)
-                    src++;
-                break;
-            case LF:
-                *dst++ = '\n';
-                break;
-            default:
-                *dst++ = c;
-                break;
+    if (fLineStarts.empty()) {
+        fLineStarts.push_back(0);
+        for(const char *ptr = fData; ptr < fData + fLength; ++ptr) {
+            if (IsLineEnd(ptr))
+                fLineStarts.push_back(ptr - fData + 1);
         }
     }
 
-    fLength = dst - fData;
+    return fLineStarts;
 }
 
+
+/**
+ * bool Buffer::FindDeclarations(vector<Declaration> &decls) const
+ *
+ * find the tasks, subs and inline functions at the top level.  The
+ * header of one is matched a token at a time: "task", "sub" or "void",
+ * then the name, the arguments in parentheses and the body's '{'.
+ * Anything else starts over.
+ */
+
+bool Buffer::FindDeclarations(vector<Declaration> &decls) const
+{
+    enum { kNone, kKeyword, kName, kArgs, kHead };
+
+    const char *p = fData;
+    const char *end = fData + fLength;
+    int depth = 0;
+    int parens = 0;
+    int state = kNone;
+    bool lineStart = true;	// nothing but spaces since the line began
+    bool inBody = false;	// in the body of d
+    bool directive = false;	// and it has a directive
+    Declaration d;
+
+    decls.clear();
+
+    while(p < end) {
+        char c = *p;
+
+        if (c == LF || c == CR) {
+            lineStart = true;
+            ++p;
+            continue;
+        }
+
+        if (isspace((unsigned char)c)) {
+            ++p;
+            continue;
+        }
+
+        if (c == '#' && lineStart) {
+            // skip the directive, and the lines it continues on
+            if (depth > 0)
+                directive = true;
+            else
+                state = kNone;
+
+            while(p < end && *p != LF && *p != CR) {
+                if (*p == '\\' && p+1 < end && (p[1] == LF || p[1] == CR)) {
+                    p += 2;
+                    if (p[-1] == CR && p < end && *p == LF) ++p;
+                }
+                else
+                    ++p;
+            }
+            continue;
+        }
+
+        lineStart = false;
+
+        if (c == '/' && p+1 < end && p[1] == '/') {
+            while(p < end && *p != LF && *p != CR)
+                ++p;
+            continue;
+        }
+
+        if (c == '/' && p+1 < end && p[1] == '*') {
+            const char *close = p + 2;
+            while(close+1 < end && !(close[0] == '*' && close[1] == '/'))
+                ++close;
+            if (close+1 >= end) return false;
+
+            p = close + 2;
+            continue;
+        }
+
+        if (c == '"' || c == '\'') {
+            // an unterminated literal ends at the line end, as for the lexer
+            for(++p; p < end && *p != c && *p != LF && *p != CR; ++p) {
+                if (*p == '\\' && p+1 < end) ++p;
+            }
+            if (p < end && *p == c) ++p;
+            if (depth == 0) state = kNone;
+            continue;
+        }
+
+        if (isalpha((unsigned char)c) || c == '_') {
+            const char *start = p;
+            while(p < end && (isalnum((unsigned char)*p) || *p == '_'))
+                ++p;
+            string word(start, p - start);
+
+            if (inBody)
+                d.fUses.insert(word);
+            else if (depth == 0 && state != kArgs) {
+                if (state == kKeyword) {
+                    d.fName = word;
+                    state = kName;
+                }
+                else if (word == "task" || word == "sub" || word == "void") {
+                    d.fKind = (word == "task") ? Declaration::kTask :
+                        (word == "sub") ? Declaration::kSub : Declaration::kFunction;
+                    d.fStart = (int)(start - fData);
+                    state = kKeyword;
+                }
+                else
+                    state = kNone;
+            }
+            continue;
+        }
+
+        if (isdigit((unsigned char)c)) {
+            while(p < end && (isalnum((unsigned char)*p) || *p == '_' || *p == '.'))
+                ++p;
+            if (depth == 0 && state != kArgs) state = kNone;
+            continue;
+        }
+
+        if (depth == 0) {
+            if (c == '(' && state == kName) {
+                state = kArgs;
+                parens = 1;
+            }
+            else if (c == '(' && state == kArgs)
+                ++parens;
+            else if (c == ')' && state == kArgs) {
+                if (--parens == 0) state = kHead;
+            }
+            else if (c == '{' && state == kHead) {
+                inBody = true;
+                directive = false;
+                d.fBodyStart = (int)(p - fData);
+                d.fUses.clear();
+            }
+            else if (state != kArgs)
+                state = kNone;
+        }
+
+        if (c == '{')
+            ++depth;
+        else if (c == '}') {
+            if (--depth < 0) return false;
+
+            if (depth == 0 && inBody) {
+                d.fEnd = (int)(p + 1 - fData);
+                if (!directive)
+                    decls.push_back(d);
+                inBody = false;
+                state = kNone;
+            }
+        }
+
+        ++p;
+    }
+
+    return depth == 0;
+}
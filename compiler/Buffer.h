@@ -11,11 +11,28 @@
  * All Rights Reserved.
  *
  */
+#ifndef __Buffer_h
+#define __Buffer_h
+
 #ifndef _STDIO_H
 #include <cstdio>
 using std::FILE;
 #endif
 
+#include <set>
+#include <string>
+#include <vector>
+
+using std::set;
+using std::string;
+using std::vector;
+
+/*
+ * A Buffer holds the text of one source file.  Files are memory mapped
+ * where possible, and the text always keeps its original line endings
+ * (LF, CR-LF, or CR); the lexer and the line functions below accept
+ * all three.
+ */
 class Buffer
 {
 public:
@@ -37,11 +54,38 @@ public:
 	int				FindStartOfLine(int offset) const;
 	int				FindEndOfLine(int offset) const;
 
+	// a task, sub or inline function at the top level of the text
+	struct Declaration
+	{
+		enum Kind { kTask, kSub, kFunction };
+
+		Kind		fKind;
+		string		fName;
+		int			fStart;		// offset of "task", "sub" or "void"
+		int			fBodyStart;	// offset of the body's '{'
+		int			fEnd;		// offset just past the body's '}'
+		set<string>	fUses;		// the names in the body
+	};
+
+	// Find the declarations by scanning the text, without preprocessing
+	// it.  Those with a directive in their body are left out, since
+	// what the body holds then depends on more than its own text.
+	// Returns false if the braces don't balance or a comment doesn't end.
+	bool			FindDeclarations(vector<Declaration> &decls) const;
+
 protected:
 	void	FinishCreate(const char *name);
-	void	ConvertLineEndings();
+	bool	Map(const char *pathname);
+	bool	IsLineEnd(const char *ptr) const;
+	const vector<int>&	GetLineStarts() const;
 
 	char*	fName;
 	char*	fData;
 	int		fLength;
+	bool	fMapped;
+
+	// offset of each line, computed on first use
+	mutable vector<int>	fLineStarts;
 };
+
+#endif
@@ -13,18 +13,26 @@
  */
 #include <cstring>
 #include "Bytecode.h"
+#include "CompileStats.h"
 #include "RCX_Cmd.h"
 #include "RCX_Target.h"
+#include "Program.h"
 
+using std::memcmp;
 using std::memcpy;
 using std::memset;
 
 Bytecode::Bytecode(VarAllocator &varAllocator, const RCX_Target *target, RCX_Image *image) :
 	fVarAllocator(varAllocator),
 	fTarget(target),
-	fImage(image)
+	fImage(image),
+	fLoopCounterInUse(false),
+	fOptimize(gProgram->GetOptimize()),
+	fSourceTags(gProgram->GetSourceTags() || gProgram->GetSizeReport()),
+	fFixed(false)
 {
 	fData.reserve(256);
+	CompileStats::Get().Allocate(CompileStats::kCodePool, (long)fData.capacity());
 	fLabels.reserve(50);
 
 	for(int i=0; i<kFlowCount; ++i)
@@ -38,24 +46,26 @@ Bytecode::Bytecode(VarAllocator &varAllocator, const RCX_Target *target, RCX_Ima
 
 Bytecode::~Bytecode()
 {
-	Fixup *f;
-
-	while((f=fFixups.RemoveHead()) != nil)
-		delete f;
+	CompileStats::Get().Release(CompileStats::kCodePool, (long)fData.capacity());
 }
 
 
 void Bytecode::Add(const UByte *data, int count)
 {
 	int n = fData.size();
+	size_t capacity = fData.capacity();
 
 	fData.resize(n + count);
 	memcpy(&fData[n], data, (size_t) count);
+
+	if (fData.capacity() != capacity)
+		CompileStats::Get().Allocate(CompileStats::kCodePool, (long)(fData.capacity() - capacity));
 }
 
 
 void Bytecode::Add(const RCX_Cmd &cmd)
 {
+	fInstructions.push_back((UShort)GetLength());
 	Add(cmd.GetBody(), cmd.GetLength());
 }
 
@@ -68,15 +78,12 @@ void Bytecode::Truncate(int length)
 	// shrink the data
 	fData.resize(length);
 
-	// disable any fixups in the truncated region
-	Fixup *f;
-	for(f=fFixups.GetHead(); f; f=f->GetNext())
-	{
-		if (f->fLocation >= length)
-		{
-			f->fType = kNoFixup;
-		}
-	}
+	while(!fInstructions.empty() && fInstructions.back() >= length)
+		fInstructions.pop_back();
+
+	// drop any fixups in the truncated region
+	while(!fFixups.empty() && fFixups.back().fLocation >= length)
+		fFixups.pop_back();
 }
 
 
@@ -168,7 +175,7 @@ void Bytecode::SetLabel(int label, int target)
 
 void Bytecode::AddFixup(FixupCode type, int label, int opcodeOffset, UByte shortOpcode)
 {
-	Fixup *f;
+	Fixup f;
 	int size;
 
 	// determine size of the fixup
@@ -186,15 +193,472 @@ void Bytecode::AddFixup(FixupCode type, int label, int opcodeOffset, UByte short
 			break;
 	}
 
-	f = new Fixup();
+	f.fType = type;
+	f.fLocation = GetLength()-size;
+	f.fLabel = label;
+	f.fOpcodeOffset = opcodeOffset;
+	f.fShortOpcode = shortOpcode;
+
+	// fixups are always added at the end of the code, so the list
+	// stays sorted by location
+	fFixups.push_back(f);
+}
+
+
+/*
+ * Code that ends the same way right before a jump and right before
+ * the jump's target only needs to be there once.  This is mostly the
+ * tails of if/else branches and switch cases:
+ *	A			    A
+ *	C			    jmp	L1
+ *	jmp	L2	=>	    B
+ *	B			L1: C
+ *	C			L2:
+ *   L2:
+ * This executes the same instructions as before.  Optimizing for size,
+ * two jumps to the same target share their tails as well, which costs
+ * a jump each time the first one is taken.
+ */
+bool Bytecode::MergeTails()
+{
+	int codeLength = GetLength();
+	int count = fInstructions.size();
+	bool shareJumps = fOptimize == Program::kSizeOptimize;
+	Fixup *f;
+	int i;
+
+	// the instruction each byte belongs to, and the one starting at
+	// each position (or -1)
+	vector<int> owner(codeLength+1, count);
+	vector<int> index(codeLength+1, -1);
+	for(i=0; i<count; ++i) {
+		index[fInstructions[i]] = i;
+		int end = fInstructions[i] + GetInstructionLength(i);
+		for(int pos=fInstructions[i]; pos<end; ++pos)
+			owner[pos] = i;
+	}
+	index[codeLength] = count;
+
+	// instructions that something branches to, and ones with a fixup;
+	// fixups aren't filled in yet, so their bytes can't be compared
+	TailState state;
+	state.fTargets.resize(count+1, false);
+	state.fFixed.resize(count+1, false);
+	state.fRemoved.resize(count+1, false);
+	for(f=FirstFixup(); f!=EndFixup(); ++f) {
+		if (f->fType == kNoFixup) continue;
+
+		int target = fLabels[f->fLabel];
+		if (target <= codeLength)
+			state.fTargets[owner[target]] = true;
+		state.fFixed[owner[f->fLocation]] = true;
+	}
+
+	int *remove = new int[codeLength+1];
+	memset(remove, 0, (codeLength+1) * sizeof(int));
+	bool changed = false;
+
+	// jumps that kept their tails, by target
+	vector< vector<int> > kept(count+1);
+
+	for(f=FirstFixup(); f!=EndFixup(); ++f) {
+		if (f->fType != kSignBitLongFixup ||
+			f->fShortOpcode != kRCX_SJumpOp ||
+			f->fOpcodeOffset != 1 ||
+			fData[f->fLocation - 1] != kRCX_JumpOp)
+			continue;
+
+		int jump = index[f->fLocation - 1];
+		int target = fLabels[f->fLabel];
+		if (jump < 0 || target > codeLength || index[target] < 0)
+			continue;
+		target = index[target];
+
+		// the longest tail shared with the code falling into the target,
+		// or with another jump there
+		int end = target;
+		int n = MatchTail(state, jump, target);
+
+		for(i=0; shareJumps && i<(int)kept[target].size(); ++i) {
+			int m = MatchTail(state, jump, kept[target][i]);
+			if (m > n) {
+				n = m;
+				end = kept[target][i];
+			}
+		}
+
+		if (n == 0) {
+			kept[target].push_back(jump);
+			continue;
+		}
+
+		int label = NewLabel();
+		SetLabel(label, fInstructions[end - n]);
+		f->fLabel = label;
+		fLiveLabels.push_back(label);
+		state.fTargets[end - n] = true;
+
+		for(i=jump-n; i<jump; ++i) {
+			state.fRemoved[i] = true;
+			int length = GetInstructionLength(i);
+			for(int k=0; k<length; ++k)
+				remove[fInstructions[i] + k] = 1;
+		}
+		changed = true;
+	}
+
+	if (changed) Compact(remove);
+	delete [] remove;
+
+	return changed;
+}
+
+
+/*
+ * Returns how many instructions before jump match the ones before end.
+ * Only the first instruction of the stretch before the jump may be
+ * branched to, since that stretch goes away, and the stretches can't
+ * overlap.
+ */
+int Bytecode::MatchTail(const TailState &state, int jump, int end) const
+{
+	if (state.fTargets[jump]) return 0;
+
+	int n = 0;
+	while(true) {
+		int a = jump - n - 1;
+		int b = end - n - 1;
+
+		if (a < 0 || b < 0 || state.fTargets[a+1]) break;
+		if (end > jump ? b <= jump : end > a) break;
+		if (state.fRemoved[a] || state.fRemoved[b] ||
+			state.fFixed[a] || state.fFixed[b])
+			break;
+		if (!SameInstruction(a, b)) break;
+		++n;
+	}
+
+	return n;
+}
+
+
+bool Bytecode::SameInstruction(int i, int j) const
+{
+	int length = GetInstructionLength(i);
+
+	return length == GetInstructionLength(j) &&
+		memcmp(&fData[fInstructions[i]], &fData[fInstructions[j]], length) == 0;
+}
+
+
+void Bytecode::Peephole()
+{
+	int codeLength = GetLength();
+	Fixup *f;
+
+	// find the long jumps, indexed by the position of their opcode
+	vector<Fixup*> jumps(codeLength, (Fixup*)0);
+	for(f=FirstFixup(); f!=EndFixup(); ++f) {
+		if (f->fType == kSignBitLongFixup &&
+			f->fShortOpcode == kRCX_SJumpOp &&
+			f->fOpcodeOffset == 1 &&
+			fData[f->fLocation - 1] == kRCX_JumpOp)
+		{
+			jumps[f->fLocation - 1] = f;
+		}
+	}
+
+	ThreadJumps(jumps);
+
+	int *remove = new int[codeLength+1];
+	memset(remove, 0, (codeLength+1) * sizeof(int));
+
+	InvertTests(jumps, remove);
+	RemoveDeadJumps(jumps, remove);
+	RemoveNextJumps(jumps, remove);
+	RemoveOutputs(remove);
+	MergePops(remove);
+
+	Compact(remove);
+	delete [] remove;
+}
+
+
+void Bytecode::ThreadJumps(const vector<Fixup*> &jumps)
+{
+	for(Fixup *f=FirstFixup(); f!=EndFixup(); ++f) {
+		if (f->fType == kNoFixup) continue;
+
+		// follow the chain of jumps, but not forever (jumps can loop)
+		int label = f->fLabel;
+		for(int i=0; i<(int)jumps.size(); ++i) {
+			int target = fLabels[label];
+			if (target >= (int)jumps.size() || !jumps[target]) break;
+
+			int next = jumps[target]->fLabel;
+			if (next == label) break;
+			label = next;
+		}
+
+		// simple fixups can only branch forward
+		if ((f->fType == kSimpleLongFixup || f->fType == kSimpleShortFixup) &&
+			fLabels[label] < f->fLocation)
+			continue;
+
+		// don't trade a short branch for a long one
+		Fixup original = *f;
+		Fixup threaded = *f;
+		threaded.fLabel = label;
+		if (ShortenFixup(threaded) || !ShortenFixup(original))
+			f->fLabel = label;
+	}
+}
+
+
+void Bytecode::InvertTests(const vector<Fixup*> &jumps, int *remove)
+{
+	int codeLength = GetLength();
+	Fixup *f;
+
+	// positions that something branches to
+	vector<bool> targets(codeLength+1, false);
+	for(f=FirstFixup(); f!=EndFixup(); ++f) {
+		int target = fLabels[f->fLabel];
+		if (f->fType != kNoFixup && target <= codeLength)
+			targets[target] = true;
+	}
+
+	// a test that only skips over a jump can take the jump itself
+	// when its relation is reversed:
+	//	chk	rel, L1		=>	chk	!rel, L2
+	//	jmp	L2		    L1:
+	//   L1:
+	for(f=FirstFixup(); f!=EndFixup(); ++f) {
+		if (f->fType != kSimpleLongFixup ||
+			f->fShortOpcode != kRCX_STestOp ||
+			f->fOpcodeOffset != 6)
+			continue;
+
+		int test = f->fLocation - 6;
+		int jump = test + 8;
+		if (fData[test] != kRCX_TestOp ||
+			jump >= codeLength ||
+			!jumps[jump] ||
+			jumps[jump]->fType == kNoFixup ||
+			fLabels[f->fLabel] != jump + 3 ||
+			targets[jump])
+			continue;
+
+		if (!InvertTest(test)) continue;
+
+		f->fLabel = jumps[jump]->fLabel;
+		jumps[jump]->fType = kNoFixup;
+		remove[jump] = remove[jump+1] = remove[jump+2] = 1;
+	}
+}
+
+
+bool Bytecode::InvertTest(int position)
+{
+	UByte *ptr = &fData[position+1];
+	RCX_Relation rel = (RCX_Relation)(ptr[0] >> 6);
+	int type = ptr[0] & 0x3f;
+	short value = (short)(ptr[2] + (ptr[3] << 8));
+
+	// there are no strict relations, so reversing <= or >= means
+	// moving a constant first operand by one
+	switch(rel) {
+		case kRCX_EqualTo:
+			rel = kRCX_NotEqualTo;
+			break;
+		case kRCX_NotEqualTo:
+			rel = kRCX_EqualTo;
+			break;
+		case kRCX_LessOrEqual:
+			// !(c <= x) is (c-1 >= x)
+			if (type != kRCX_ConstantType || value == -32768) return false;
+			rel = kRCX_GreaterOrEqual;
+			--value;
+			break;
+		case kRCX_GreaterOrEqual:
+			// !(c >= x) is (c+1 <= x)
+			if (type != kRCX_ConstantType || value == 32767) return false;
+			rel = kRCX_LessOrEqual;
+			++value;
+			break;
+	}
+
+	ptr[0] = (UByte)((rel << 6) | type);
+	ptr[2] = (UByte)(value & 0xff);
+	ptr[3] = (UByte)((value >> 8) & 0xff);
+	return true;
+}
+
+
+void Bytecode::RemoveNextJumps(const vector<Fixup*> &jumps, int *remove)
+{
+	// backwards, so a jump over jumps that go away goes away as well
+	for(int pos=(int)jumps.size()-1; pos>=0; --pos) {
+		Fixup *f = jumps[pos];
+		if (!f || f->fType == kNoFixup) continue;
+
+		// skip over code that is already going away
+		int next = pos + 3;
+		while(next < (int)jumps.size() && remove[next]) ++next;
+		if (fLabels[f->fLabel] != next) continue;
+
+		f->fType = kNoFixup;
+		remove[pos] = remove[pos+1] = remove[pos+2] = 1;
+	}
+}
+
 
-	f->fType = type;
-	f->fLocation = GetLength()-size;
-	f->fLabel = label;
-	f->fOpcodeOffset = opcodeOffset;
-	f->fShortOpcode = shortOpcode;
+void Bytecode::RemoveDeadJumps(const vector<Fixup*> &jumps, int *remove)
+{
+	int codeLength = GetLength();
+	Fixup *f;
 
-	fFixups.InsertHead(f);
+	vector<bool> targets(codeLength+1, false);
+	for(f=FirstFixup(); f!=EndFixup(); ++f) {
+		int target = fLabels[f->fLabel];
+		if (f->fType != kNoFixup && target <= codeLength)
+			targets[target] = true;
+	}
+
+	// a jump right after another one can only be reached by branching
+	// to it (merged tails leave these behind); the jumps removed so far
+	// fall through now
+	for(int pos=3; pos<(int)jumps.size(); ++pos) {
+		f = jumps[pos];
+		Fixup *previous = jumps[pos-3];
+		if (!f || f->fType == kNoFixup || targets[pos] ||
+			!previous || previous->fType == kNoFixup)
+			continue;
+
+		f->fType = kNoFixup;
+		remove[pos] = remove[pos+1] = remove[pos+2] = 1;
+	}
+}
+
+
+void Bytecode::RemoveOutputs(int *remove)
+{
+	int count = fInstructions.size();
+	int i = 0;
+
+	while(i < count) {
+		// find a run of output commands
+		int end = i;
+		while(end < count) {
+			int pos = fInstructions[end];
+			int length = GetInstructionLength(end);
+			UByte op = fData[pos];
+
+			if (!((op == kRCX_OutputModeOp && length == 2) ||
+				(op == kRCX_OutputDirOp && length == 2) ||
+				(op == kRCX_OutputPowerOp && length == 4)))
+				break;
+			++end;
+		}
+
+		if (end == i) {
+			++i;
+			continue;
+		}
+
+		// working backwards, a command can go if later commands of the
+		// same kind set all of its outputs
+		UByte modeSet = 0, dirSet = 0, powerSet = 0;
+		for(int j=end-1; j>=i; --j) {
+			int pos = fInstructions[j];
+			UByte outputs = fData[pos+1] & 7;
+			UByte *set;
+			bool absolute;
+
+			switch(fData[pos]) {
+				case kRCX_OutputModeOp:
+					set = &modeSet;
+					absolute = true;
+					break;
+				case kRCX_OutputDirOp:
+					// toggling depends on the previous direction
+					set = &dirSet;
+					absolute = (fData[pos+1] & 0xc0) != kRCX_OutputToggle;
+					break;
+				default:
+					set = &powerSet;
+					absolute = fData[pos+2] == kRCX_ConstantType ||
+						fData[pos+2] == kRCX_VariableType;
+					break;
+			}
+
+			if (absolute && (outputs & ~*set) == 0) {
+				int length = GetInstructionLength(j);
+				for(int k=0; k<length; ++k)
+					remove[pos+k] = 1;
+			}
+			else if (absolute)
+				*set |= outputs;
+		}
+
+		i = end;
+	}
+}
+
+
+/*
+ * Pops of sub parameters that follow each other (with only code that
+ * is going away between them) are done as one:
+ *
+ *	pop	a		=>	pop	a+b
+ *	pop	b
+ *
+ * unless something branches to the second one.
+ */
+void Bytecode::MergePops(int *remove)
+{
+	int codeLength = GetLength();
+	int count = fInstructions.size();
+	Fixup *f;
+
+	vector<bool> targets(codeLength+1, false);
+	for(f=FirstFixup(); f!=EndFixup(); ++f) {
+		int target = fLabels[f->fLabel];
+		if (f->fType != kNoFixup && target <= codeLength)
+			targets[target] = true;
+	}
+
+	for(int i=0; i<count; ++i) {
+		int pos = fInstructions[i];
+		if (fData[pos] != kRCX_PopStackEntryOp || GetInstructionLength(i) != 2 ||
+			remove[pos])
+			continue;
+
+		int next = i + 1;
+		while(next < count && remove[fInstructions[next]]) ++next;
+		if (next == count) break;
+
+		int npos = fInstructions[next];
+		if (fData[npos] != kRCX_PopStackEntryOp || GetInstructionLength(next) != 2 ||
+			fData[pos+1] + fData[npos+1] > 0xff)
+			continue;
+
+		// a branch to the code that goes away ends up at the second pop
+		bool target = false;
+		for(int p=pos+2; p<=npos; ++p)
+			if (targets[p]) target = true;
+		if (target) continue;
+
+		fData[npos+1] += fData[pos+1];
+		remove[pos] = remove[pos+1] = 1;
+	}
+}
+
+
+int Bytecode::GetInstructionLength(int i) const
+{
+	int next = (i+1 < (int)fInstructions.size()) ? fInstructions[i+1] : GetLength();
+	return next - fInstructions[i];
 }
 
 
@@ -207,18 +671,40 @@ void Bytecode::OptimizeFixups()
 	// are to be deleted, then later it becomes the map
 	// from old index to new one
 	int *remap = new int[codeLength+1];
-	memset(remap, 0, (codeLength+1) * sizeof(int));
 
-	for(f=fFixups.GetHead(); f; f=f->GetNext()) {
-		if (ShortenFixup(*f)) {
-			// mark byte to be deleted
-			remap[f->fLocation+1] = 1;
-
-			// change the opcode
-			fData[f->fLocation - f->fOpcodeOffset] = f->fShortOpcode;
+	// shortening brings other branches closer, so keep going
+	// until nothing else fits (without optimization one pass will do)
+	bool again = fOptimize >= Program::kBasicOptimize;
+	bool changed = true;
+	while(changed) {
+		changed = false;
+		codeLength = GetLength();
+		memset(remap, 0, (codeLength+1) * sizeof(int));
+
+		for(f=FirstFixup(); f!=EndFixup(); ++f) {
+			if (ShortenFixup(*f)) {
+				// mark byte to be deleted
+				remap[f->fLocation+1] = 1;
+
+				// change the opcode
+				fData[f->fLocation - f->fOpcodeOffset] = f->fShortOpcode;
+				changed = true;
+			}
 		}
+
+		if (changed) Compact(remap);
+		if (!again) break;
 	}
 
+	delete [] remap;
+}
+
+
+void Bytecode::Compact(int *remap)
+{
+	int codeLength = GetLength();
+	Fixup *f;
+
 	// trim the code and compute the remap array
 	int offset = 0;
 	for(int i=0; i<codeLength; ++i) {
@@ -235,15 +721,17 @@ void Bytecode::OptimizeFixups()
 	// add remap entry for end-of-program
 	remap[codeLength] = offset;
 
-	// adjust the labels
+	// adjust the labels (ones left past a Truncate() go to the end)
 	int i;
-	for(i=0; i<(int)fLabels.size(); ++i) {
-		fLabels[i] = remap[fLabels[i]];
+	for(i=0; i<(int)fLiveLabels.size(); ++i) {
+		UShort &label = fLabels[fLiveLabels[i]];
+		label = remap[label < codeLength ? label : codeLength];
 	}
 
 	// adjust the fixups
-	for(f=fFixups.GetHead(); f; f=f->GetNext()) {
-		f->fLocation = remap[f->fLocation];
+	for(f=FirstFixup(); f!=EndFixup(); ++f) {
+		if (f->fType != kNoFixup)
+			f->fLocation = remap[f->fLocation];
 	}
 
 	// adjust source tags
@@ -251,7 +739,15 @@ void Bytecode::OptimizeFixups()
 		fTags[i].fAddress = remap[fTags[i].fAddress];
 	}
 
-	delete [] remap;
+	// drop instructions that were deleted entirely
+	int n = 0;
+	for(i=0; i<(int)fInstructions.size(); ++i) {
+		int start = fInstructions[i];
+		if (n && remap[start] == fInstructions[n-1]) continue;
+		if (remap[start] == offset) continue;
+		fInstructions[n++] = (UShort)remap[start];
+	}
+	fInstructions.resize(n);
 }
 
 
@@ -281,13 +777,38 @@ bool Bytecode::ShortenFixup(Fixup &f)
 	return false;
 }
 
+void Bytecode::FindLiveLabels()
+{
+	vector<bool> live(fLabels.size(), false);
+
+	fLiveLabels.clear();
+	for(Fixup *f=FirstFixup(); f!=EndFixup(); ++f) {
+		if (f->fType == kNoFixup || live[f->fLabel]) continue;
+
+		live[f->fLabel] = true;
+		fLiveLabels.push_back(f->fLabel);
+	}
+}
+
+
 void Bytecode::ApplyFixups()
 {
+	if (fFixed) return;
+
+	// only the labels of fixups need to follow the code as it shrinks
+	FindLiveLabels();
+
+	if (fOptimize >= Program::kBasicOptimize)
+		Peephole();
+
+	// merging can leave jumps to jumps or to the next instruction
+	if (fOptimize >= Program::kFullOptimize && MergeTails())
+		Peephole();
 	OptimizeFixups();
 
 	Fixup *f;
 
-	while((f = fFixups.RemoveHead()) != nil)
+	for(f=FirstFixup(); f!=EndFixup(); ++f)
 	{
 		int offset = fLabels[f->fLabel] - f->fLocation;
 
@@ -318,9 +839,10 @@ void Bytecode::ApplyFixups()
 				}
 				break;
 		}
-
-		delete f;
 	}
+
+	fFixups.clear();
+	fLiveLabels.clear();
 }
 
 
@@ -400,9 +922,9 @@ void Bytecode::EndHandler(int type)
 }
 
 
-int Bytecode::GetTempVar(bool canUseLocals)
+int Bytecode::GetTempVar(bool canUseLocals, bool scratch)
 {
-	return fVarAllocator.Allocate(true, canUseLocals, 1);
+	return fVarAllocator.Allocate(true, canUseLocals, 1, scratch);
 }
 
 
@@ -433,7 +955,7 @@ bool Bytecode::IsLocalEA(RCX_Value ea) const
 
 void Bytecode::AddSourceTag(int type, const LexLocation &loc)
 {
-	if (loc.fIndex == kIllegalSrcIndex) return;
+	if (!fSourceTags || loc.fIndex == kIllegalSrcIndex) return;
 
 	int n = fTags.size();
 	fTags.resize(n+1);
@@ -444,3 +966,19 @@ void Bytecode::AddSourceTag(int type, const LexLocation &loc)
 	t.fSrcOffset = loc.fOffset + loc.fLength-1;
 	t.fAddress = GetLength();
 }
+
+
+void Bytecode::AddVariableName(int index, const char *name)
+{
+	fImage->SetVariable(index, name);
+	fVariableNames.push_back(std::make_pair(index, string(name)));
+}
+
+
+void Bytecode::SetFixedCode(const vector<UByte> &data, const vector<RCX_SourceTag> &tags)
+{
+	fData = data;
+	fTags = tags;
+	fFixups.clear();
+	fFixed = true;
+}
@@ -14,10 +14,6 @@
 #ifndef __Bytecode_h
 #define __Bytecode_h
 
-#ifndef __PListS_h
-#include "PListS.h"
-#endif
-
 #ifndef __PTypes_h
 #include "PTypes.h"
 #endif
@@ -42,8 +38,12 @@
 #include "RCX_SourceTag.h"
 #endif
 
+#include <string>
+#include <utility>
 #include <vector>
 
+using std::pair;
+using std::string;
 using std::vector;
 
 class RCX_Cmd;
@@ -101,24 +101,36 @@ public:
 	void		SetLabel(int label, int target = kCurrentPosition);
 	int		GetLabelPosition(int label) const { return fLabels[label]; }
 	void		AddFixup(FixupCode code, int label, int opcodeOffset=0, UByte shortOpcode=0);
+	// optimizes the code and resolves the labels; this only touches the
+	// Bytecode, so fragments may have their fixups applied in parallel
 	void		ApplyFixups();
 
+	// code already fixed up in an earlier compile (see FragmentCache),
+	// which ApplyFixups() leaves alone
+	void		SetFixedCode(const vector<UByte> &data, const vector<RCX_SourceTag> &tags);
+
 	int		PushFlow(FlowCode code, bool legal=true);
 	void		PopFlow(FlowCode code)		{ fFlowContexts[code].pop_back(); }
 
 	bool		BeginHandler(int type);
 	void		EndHandler(int type);
 
-	int		GetTempVar(bool canUseLocal);
+	// a scratch temp must be released before the statement ends
+	int		GetTempVar(bool canUseLocal, bool scratch = true);
 	void		ReleaseTempEA(RCX_Value ea);
 	bool		IsTempEA(RCX_Value ea) const;
 	bool		IsLocalEA(RCX_Value ea) const;
 
 	VarAllocator&	GetVarAllocator()	{ return fVarAllocator; }
 
+	// the RCX loop counter can only be used by one repeat at a time
+	bool		IsLoopCounterInUse() const	{ return fLoopCounterInUse; }
+	void		SetLoopCounterInUse(bool inUse)	{ fLoopCounterInUse = inUse; }
+
 	const RCX_Target*	GetTarget() const	{ return fTarget; }
 
-	void		AddVariableName(int index, const char *name) { fImage->SetVariable(index, name); }
+	void		AddVariableName(int index, const char *name);
+	const vector<pair<int, string> >&	GetVariableNames() const	{ return fVariableNames; }
 
 	// source tags
 	void			AddSourceTag(int type, const LexLocation &loc);
@@ -126,7 +138,7 @@ public:
 	int			GetSourceTagCount() const	{ return fTags.size(); }
 
 private:
-	class Fixup : public PLinkS<Fixup>
+	class Fixup
 	{
 	public:
 		FixupCode 	fType;
@@ -148,13 +160,40 @@ private:
 	int		GetFlowLabel(FlowCode code);
 	void		Add(const UByte *data, int count);
 	void		AddHandlerExit(int i);
+	struct TailState
+	{
+		vector<bool>	fTargets;
+		vector<bool>	fFixed;
+		vector<bool>	fRemoved;
+	};
+
+	bool		MergeTails();
+	int		MatchTail(const TailState &state, int jump, int end) const;
+	bool		SameInstruction(int i, int j) const;
+	void		Peephole();
+	void		ThreadJumps(const vector<Fixup*> &jumps);
+	void		InvertTests(const vector<Fixup*> &jumps, int *remove);
+	bool		InvertTest(int position);
+	void		RemoveNextJumps(const vector<Fixup*> &jumps, int *remove);
+	void		RemoveDeadJumps(const vector<Fixup*> &jumps, int *remove);
+	void		RemoveOutputs(int *remove);
+	void		MergePops(int *remove);
+	int		GetInstructionLength(int i) const;
 	void		OptimizeFixups();
 	bool		ShortenFixup(Fixup &f);
+	Fixup*		FirstFixup()	{ return fFixups.empty() ? 0 : &fFixups[0]; }
+	Fixup*		EndFixup()	{ return FirstFixup() + fFixups.size(); }
+	void		Compact(int *remap);
+	void		FindLiveLabels();
 
 	vector<UByte>	fData;
+	vector<UShort>	fInstructions;	// start of each Add(RCX_Cmd)
 
-	PListSS<Fixup>	fFixups;
+	vector<Fixup>	fFixups;	// sorted by location
 	vector<UShort>	fLabels;
+	// the labels that fixups branch to, while ApplyFixups() runs; the
+	// rest (most flow labels) are no longer looked at
+	vector<int>	fLiveLabels;
 
 	vector<int>	fFlowContexts[kFlowCount];
 	HandlerContext	fHandlerContexts[kHandlerCount];
@@ -162,6 +201,13 @@ private:
 	VarAllocator&		fVarAllocator;
 	const RCX_Target*	fTarget;
 	RCX_Image*		fImage; // used to hold symbolic information
+	bool			fLoopCounterInUse;
+	int			fOptimize;	// gProgram's, when the code was begun
+	bool			fSourceTags;	// likewise
+	bool			fFixed;		// by SetFixedCode()
+
+	// the names given to the image
+	vector<pair<int, string> >	fVariableNames;
 
 	// source info (used for mixed source/code listings
 	vector<RCX_SourceTag>	fTags;
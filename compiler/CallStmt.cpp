@@ -29,26 +29,78 @@
 #include "BlockStmt.h"
 #include "ScopeStmt.h"
 #include "Resource.h"
+#include "CompileStats.h"
+#include "AsmStmt.h"
+#include "AssignStmt.h"
+#include "CaseStmt.h"
+#include "LabelStmt.h"
+#include "AddrOfExpr.h"
+#include "BinaryExpr.h"
+#include "IncDecExpr.h"
+#include "LogicalExpr.h"
+#include "ModExpr.h"
+#include "NegateExpr.h"
+#include "RelExpr.h"
+#include "ShiftExpr.h"
+#include "TernaryExpr.h"
+#include "UnaryExpr.h"
+
+#include <algorithm>
+
+
+/// The local vars that statements write, for FindRepeats()
+class CallStmt::Writes
+{
+public:
+			Writes() : fUnknown(false) {}
+
+	bool	operator()(Stmt *s);
+	bool	operator()(Expr *e);
+
+	bool	Touches(const vector<int> &vars) const;
+	bool	IsUnknown() const	{ return fUnknown; }
+
+private:
+	vector<int>	fVars;
+	bool		fUnknown;
+};
+
+
+static bool IsStable(const Expr *e, const set<int> &locals, vector<int> &vars);
+static void FindLocals(Stmt *s, set<int> &locals);
 
 CallStmt::CallStmt()
 {
 	fName = 0;
+	fRepeat = false;
 }
 
 
 CallStmt::~CallStmt()
 {
 	for(size_t i=0; i<fParams.size(); i++)
-		delete fParams[i];
+		Expr::Release(fParams[i]);
 
 }
 
 
 void CallStmt::Expand(Fragment *fragment)
 {
-	if (Fragment *sub = gProgram->GetSub(fName))
+	// the earlier call already left the result in place
+	if (fRepeat) return;
+
+	CompileStats::Timer timer(CompileStats::kExpandPhase);
+	const RCX_Target *t = gProgram->GetTarget();
+	Fragment *sub = gProgram->GetSub(fName);
+
+	// an outlined function is still inlined where a sub can't be called,
+	// and where the profile says the call is run a lot
+	if (sub && sub->GetFunction() &&
+		((!t->fSubParams && !fragment->IsTask()) || gProgram->IsHot(this)))
+		sub = 0;
+
+	if (sub)
 	{
-                const RCX_Target *t = gProgram->GetTarget();
                 if (!t->fSubParams)
                 {
                         // sub call
@@ -107,6 +159,7 @@ Stmt *CallStmt::CloneActual(Mapping *b) const
 
 	c->fName = fName;
 	c->fLocation = fLocation;
+	c->fRepeat = fRepeat;
 	const Stmt *body = GetBody();
 	c->SetBody(body ? body->Clone(b) : 0);
 
@@ -143,6 +196,7 @@ void CallStmt::ExpandFunction(FunctionDef *func, Fragment *fragment)
 	SetBody( new InlineStmt(new ScopeStmt(block), func));
 
 	Mapping mapping;
+	vector<int> constants;
 
 	for(size_t i=0; i<argCount; i++)
 	{
@@ -159,6 +213,7 @@ void CallStmt::ExpandFunction(FunctionDef *func, Fragment *fragment)
 					return;
 				}
 				mapping.Add(var, new AtomExpr(kRCX_ConstantType, val, fLocation));
+				constants.push_back(val);
 				break;
 			case FunctionDef::kIntegerArg:
 				val = gProgram->NextVirtualVar();
@@ -218,34 +273,311 @@ void CallStmt::ExpandFunction(FunctionDef *func, Fragment *fragment)
 	}
 
 
-	// add body of inline and then expand
-	block->Add(func->GetBody()->Clone(&mapping));
+	// add body of inline and then expand; when every argument is a
+	// constant the substitution only needs to be done once.  Either
+	// way the copy shares what it doesn't change (see Expr::Clone()).
+	if (argCount && constants.size() == argCount)
+	{
+		Mapping none;
+		block->Add(gProgram->GetExpansion(func, constants, &mapping)->Clone(&none));
+	}
+	else
+		block->Add(gProgram->GetFunctionBody(func)->Clone(&mapping));
 
 	Expander e(fragment);
 	Apply(GetBody(), e);
 }
 
 
-void CallStmt::GetExprs(vector<Expr *> &v) const
+bool CallStmt::Expander::operator()(Stmt *s)
 {
-	int n = fParams.size();
+	CallStmt *cs;
+
+	// blocks are seen before the calls in them are expanded
+	if (BlockStmt *b = dynamic_cast<BlockStmt*>(s))
+	{
+		if (gProgram->GetOptimize() >= Program::kFullOptimize)
+			FindRepeats(b);
+	}
 
-	for(int i=0; i<n; ++i)
-		v.push_back(fParams[i]);
+	if ((cs=dynamic_cast<CallStmt*>(s)) != 0)
+	{
+		cs->Expand(fFragment);
+		return false;
+	}
+
+	return true;
 }
 
 
+void CallStmt::FindRepeats(BlockStmt *block)
+{
+	struct Available
+	{
+		CallStmt*	fCall;
+		vector<int>	fVars;	// args and results
+	};
 
-bool CallStmt::Expander::operator()(Stmt *s)
+	// other tasks can change globals at any time
+	set<int> locals;
+	FindLocals(block, locals);
+	if (locals.empty()) return;
+
+	vector<Available> available;
+
+	for(Stmt *s=block->GetHead(); s; s=s->GetNext())
+	{
+		CallStmt *cs = dynamic_cast<CallStmt*>(s);
+
+		if (cs)
+		{
+			size_t i;
+			for(i=0; i<available.size(); i++)
+				if (cs->Repeats(available[i].fCall)) break;
+
+			if (i < available.size())
+			{
+				cs->fRepeat = true;
+				continue;
+			}
+		}
+
+		Writes w;
+		Apply(s, w);
+
+		if (w.IsUnknown())
+			available.clear();
+		else
+		{
+			for(size_t i=available.size(); i>0; i--)
+				if (w.Touches(available[i-1].fVars))
+					available.erase(available.begin() + (i-1));
+		}
+
+		Available a;
+		if (cs && cs->GetPureVars(locals, a.fVars))
+		{
+			a.fCall = cs;
+			available.push_back(a);
+		}
+	}
+}
+
+
+/**
+ * Find the vars a call of a pure function reads and writes.  Returns
+ * false if the call isn't one, or its args aren't all constants and
+ * locals, or it reads what it writes.
+ */
+bool CallStmt::GetPureVars(const set<int> &locals, vector<int> &vars) const
 {
-	CallStmt *cs;
+	FunctionDef *func = gProgram->GetFunction(fName);
 
-	if ((cs=dynamic_cast<CallStmt*>(s)) != 0)
+	if (gProgram->GetSub(fName) || !func || !func->IsPure() ||
+		func->GetArgCount() != (int)fParams.size())
+		return false;
+
+	vector<int> reads;
+	vector<int> writes;
+
+	for(size_t i=0; i<fParams.size(); i++)
 	{
-		cs->Expand(fFragment);
+		const Expr *arg = fParams[i];
+		int val;
+
+		switch(func->GetArgType(i))
+		{
+			case FunctionDef::kConstantArg:
+				if (!arg->Evaluate(val)) return false;
+				break;
+			case FunctionDef::kIntegerArg:
+			case FunctionDef::kConstRefArg:
+				if (!IsStable(arg, locals, reads)) return false;
+				break;
+			case FunctionDef::kReferenceArg:
+				val = arg->GetLValue();
+				if (!dynamic_cast<const AtomExpr*>(arg) || !locals.count(val))
+					return false;
+				writes.push_back(val);
+				break;
+			default:
+				return false;
+		}
+	}
+
+	for(size_t i=0; i<writes.size(); i++)
+		if (std::find(reads.begin(), reads.end(), writes[i]) != reads.end())
+			return false;
+
+	vars = reads;
+	vars.insert(vars.end(), writes.begin(), writes.end());
+	return true;
+}
+
+
+/// True if this calls the same function as c with the same args
+bool CallStmt::Repeats(const CallStmt *c) const
+{
+	if (c->fName != fName || c->fParams.size() != fParams.size())
 		return false;
+
+	for(size_t i=0; i<fParams.size(); i++)
+	{
+		int a, b;
+
+		if (fParams[i]->Evaluate(a) && c->fParams[i]->Evaluate(b))
+		{
+			if (a != b) return false;
+		}
+		else if (!fParams[i]->Matches(c->fParams[i]))
+			return false;
 	}
 
 	return true;
 }
 
+
+bool CallStmt::Writes::operator()(Stmt *s)
+{
+	if (fUnknown) return false;
+
+	// control can arrive at a label without the calls before it
+	if (dynamic_cast<LabelStmt*>(s) ||
+		dynamic_cast<CaseStmt*>(s) ||
+		dynamic_cast<AsmStmt*>(s) ||
+		dynamic_cast<GosubParamStmt*>(s))
+	{
+		fUnknown = true;
+		return false;
+	}
+
+	if (DeclareStmt *ds = dynamic_cast<DeclareStmt*>(s))
+		fVars.push_back(ds->GetVar());
+
+	if (AssignStmt *a = dynamic_cast<AssignStmt*>(s))
+	{
+		int var = a->GetLval()->GetLValue();
+		if (var == kIllegalVar)
+			fUnknown = true;
+		else
+			fVars.push_back(var);
+	}
+
+	// a function can only write the caller's locals through its
+	// reference args
+	if (CallStmt *cs = dynamic_cast<CallStmt*>(s))
+	{
+		FunctionDef *func = gProgram->GetFunction(cs->fName);
+
+		if (gProgram->GetSub(cs->fName) || !func)
+			fUnknown = true;
+		else
+		{
+			for(size_t i=0; i<cs->fParams.size() && (int)i<func->GetArgCount(); i++)
+			{
+				switch(func->GetArgType(i))
+				{
+					case FunctionDef::kReferenceArg:
+						{
+							int var = cs->fParams[i]->GetLValue();
+							if (var == kIllegalVar)
+								fUnknown = true;
+							else
+								fVars.push_back(var);
+						}
+						break;
+					case FunctionDef::kPointerArg:
+					case FunctionDef::kConstPtrArg:
+						fUnknown = true;
+						break;
+					default:
+						break;
+				}
+			}
+		}
+	}
+
+	int n = s->GetExprCount();
+	for(int i=0; i<n; i++)
+		Apply(s->GetExpr(i), *this);
+
+	return !fUnknown;
+}
+
+
+bool CallStmt::Writes::operator()(Expr *e)
+{
+	if (IncDecExpr *id = dynamic_cast<IncDecExpr*>(e))
+		fVars.push_back(id->GetVar());
+
+	if (dynamic_cast<AddrOfExpr*>(e) || dynamic_cast<DerefExpr*>(e))
+		fUnknown = true;
+
+	return !fUnknown;
+}
+
+
+bool CallStmt::Writes::Touches(const vector<int> &vars) const
+{
+	for(size_t i=0; i<fVars.size(); i++)
+		if (std::find(vars.begin(), vars.end(), fVars[i]) != vars.end())
+			return true;
+
+	return false;
+}
+
+
+/// True if e is arithmetic on constants and locals, whose vars are added
+static bool IsStable(const Expr *e, const set<int> &locals, vector<int> &vars)
+{
+	int val;
+	if (e->Evaluate(val)) return true;
+
+	if (dynamic_cast<const AtomExpr*>(e))
+	{
+		RCX_Value ea = e->GetStaticEA();
+		int var = RCX_VALUE_DATA_INT(ea);
+
+		if (RCX_VALUE_TYPE(ea) != kRCX_VariableType || !locals.count(var))
+			return false;
+
+		vars.push_back(var);
+		return true;
+	}
+
+	if (!dynamic_cast<const BinaryExpr*>(e) &&
+		!dynamic_cast<const UnaryExpr*>(e) &&
+		!dynamic_cast<const NegateExpr*>(e) &&
+		!dynamic_cast<const ShiftExpr*>(e) &&
+		!dynamic_cast<const ModExpr*>(e) &&
+		!dynamic_cast<const RelExpr*>(e) &&
+		!dynamic_cast<const LogicalExpr*>(e) &&
+		!dynamic_cast<const TernaryExpr*>(e))
+		return false;
+
+	int n = e->GetExprCount();
+	for(int i=0; i<n; i++)
+		if (!IsStable(e->GetExpr(i), locals, vars)) return false;
+
+	return true;
+}
+
+
+/// The single (non-pointer) locals declared in the blocks around s
+static void FindLocals(Stmt *s, set<int> &locals)
+{
+	for(; s; s=s->GetParent())
+	{
+		BlockStmt *b = dynamic_cast<BlockStmt*>(s);
+		if (!b) continue;
+
+		for(Stmt *c=b->GetHead(); c; c=c->GetNext())
+		{
+			DeclareStmt *ds = dynamic_cast<DeclareStmt*>(c);
+
+			if (ds && (ds->GetVar() & kVirtualVarBase) &&
+				ds->GetCount() == 1 && !ds->GetPointer())
+				locals.insert(ds->GetVar());
+		}
+	}
+}
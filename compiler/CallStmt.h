@@ -22,12 +22,15 @@
 #include "parser.h"
 #endif
 
+#include <set>
 #include <vector>
 
+using std::set;
 using std::vector;
 
 class Symbol;
 class Expr;
+class BlockStmt;
 
 class CallStmt : public ChainStmt
 {
@@ -38,14 +41,21 @@ public:
 	void		EmitActual(Bytecode &b);
 	Stmt*		CloneActual(Mapping *b) const;
 
-	virtual void	GetExprs(vector<Expr*> & v) const;
+	virtual int	GetExprCount() const	{ return fParams.size(); }
+	virtual Expr*	GetExpr(int i) const	{ return fParams[i]; }
 
 	void	SetName(const Symbol *name)	{ fName = name; }
+	const Symbol*	GetName() const		{ return fName; }
 	void	SetLocation(const struct LexLocation &loc)	{ fLocation = loc; }
 	void	AddParam(Expr *c)			{ fParams.push_back(c); }
 
 	void	Expand(Fragment *f);
 
+	// Marks the calls in a block that repeat an earlier call of a pure
+	// function (see FunctionDef::IsPure()) with the same args, when
+	// nothing in between writes those args, so Expand() leaves them out
+	static void	FindRepeats(BlockStmt *block);
+
 	class Expander
 	{
 	public:
@@ -57,12 +67,16 @@ public:
 	};
 
 private:
+	class Writes;
 
 	void	ExpandFunction(FunctionDef *func, Fragment *fragment);
+	bool	GetPureVars(const set<int> &locals, vector<int> &vars) const;
+	bool	Repeats(const CallStmt *c) const;
 
 	const Symbol*	fName;
 	struct LexLocation fLocation;
 	vector<Expr*>	fParams;
+	bool		fRepeat;
 };
 
 
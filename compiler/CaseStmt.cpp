@@ -15,6 +15,7 @@
 #include "Bytecode.h"
 #include "Error.h"
 #include "SwitchStmt.h"
+#include "Program.h"
 
 CaseStmt::CaseStmt(int v, const LexLocation &loc, Stmt *s) :
 	ChainStmt(s),
@@ -52,20 +53,13 @@ void CaseStmt::EmitSwitchCases(Bytecode &b, SwitchState &state)
 		Error(kErr_DuplicateCase).Raise(&fLocation);
 	}
 
-	// add the case
-	state.AddCase(fValue);
-
+	// create a label for the case, the switch emits the tests
 	if (fValue == kDefaultValue)
-	{
-		// don't emit a test - just remember this is the default case
 		fLabel = state.GetDefaultLabel();
-	}
 	else
-	{
-		// create label for the case and emit the test
 		fLabel = b.NewLabel();
-		b.AddTest(RCX_VALUE(kRCX_ConstantType, fValue), kRCX_EqualTo, state.GetSelector(), fLabel);
-	}
+
+	state.AddCase(fValue, fLabel, gProgram->GetHeat(GetBody()));
 }
 
 
@@ -73,3 +67,10 @@ Stmt* CaseStmt::CloneActual(Mapping *m) const
 {
 	return new CaseStmt(fValue, fLocation, GetBody()->Clone(m));
 }
+
+
+bool CaseStmt::FallsThrough()
+{
+	Stmt *body = GetBody();
+	return body ? body->FallsThrough() : true;
+}
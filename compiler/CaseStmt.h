@@ -53,6 +53,7 @@ public:
 
 	virtual void	EmitActual(Bytecode &b);
 	virtual Stmt*	CloneActual(Mapping *b) const;
+	virtual bool	FallsThrough();
 
 	void			EmitSwitchCases(Bytecode &b, SwitchState &s);
 
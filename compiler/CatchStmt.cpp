@@ -21,7 +21,8 @@
 CatchStmt::CatchStmt(int v, Stmt *s, const LexLocation &loc) :
 	ChainStmt(s),
 	fValue(v),
-	fLocation(loc)
+	fLocation(loc),
+	fLabel(kIllegalLabel)
 {
 }
 
@@ -39,6 +40,14 @@ void CatchStmt::EmitActual(Bytecode &b)
 		return;
 	}
 
+	// MonitorStmt leaves out the label when optimizing and the events
+	// that can still be active are all in the mask
+	if (fLabel == kIllegalLabel)
+	{
+		GetBody()->Emit(b);
+		return;
+	}
+
 	int var = b.GetTempVar(true);
 
 	if (var == kIllegalVar)
@@ -34,7 +34,10 @@ public:
 	virtual void	EmitActual(Bytecode &b);
 	virtual Stmt*	CloneActual(Mapping *b) const;
 
+	/// the label to go to when the events don't match, or kIllegalLabel
+	/// if the handler is known to match
 	void			SetLabel(int l)	{ fLabel = l; }
+	int				GetValue() const	{ return fValue; }
 
 private:
 	int			fValue;
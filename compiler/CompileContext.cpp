@@ -0,0 +1,89 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include "CompileContext.h"
+#include "Program.h"
+#include "PreProc.h"
+#include "Symbol.h"
+
+#ifndef NO_THREADS
+#include <mutex>
+
+static thread_local CompileContext *sCurrent = 0;
+static std::recursive_mutex sFrontEndMutex;
+#else
+static CompileContext *sCurrent = 0;
+#endif
+
+static CompileContext *GetDefault();
+
+
+CompileContext::CompileContext() :
+    fProgram(0),
+    fPreProc(new PreProc()),
+    fSymbolTable(new SymbolTable()),
+    fCompiler(0),
+    fErrorHandler(0)
+{
+}
+
+
+CompileContext::~CompileContext()
+{
+    // objects being deleted may still look up the current context
+    Scope scope(this);
+
+    delete fProgram;
+    delete fPreProc;
+    fSymbolTable->DeleteAll();
+    delete fSymbolTable;
+    fAutoFreeGroup.freeAll();
+}
+
+
+CompileContext* CompileContext::Get()
+{
+    return sCurrent ? sCurrent : GetDefault();
+}
+
+
+void CompileContext::Set(CompileContext *c)
+{
+    sCurrent = c;
+}
+
+
+void CompileContext::Lock()
+{
+#ifndef NO_THREADS
+    sFrontEndMutex.lock();
+#endif
+}
+
+
+void CompileContext::Unlock()
+{
+#ifndef NO_THREADS
+    sFrontEndMutex.unlock();
+#endif
+}
+
+
+CompileContext* GetDefault()
+{
+    // never deleted, since static objects elsewhere (such as a global
+    // Compiler) may refer to it while they are being destroyed
+    static CompileContext *sDefault = new CompileContext();
+
+    return sDefault;
+}
@@ -0,0 +1,116 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __CompileContext_h
+#define __CompileContext_h
+
+#ifndef __AutoFree_h
+#include "AutoFree.h"
+#endif
+
+#ifndef __CompileStats_h
+#include "CompileStats.h"
+#endif
+
+#ifndef __LocationTable_h
+#include "LocationTable.h"
+#endif
+
+// threads need C++11 (thread_local and <mutex>), and emscripten
+// only supports them when building with pthreads
+#if !defined(NO_THREADS) && (__cplusplus < 201103L || \
+    (defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)))
+#define NO_THREADS
+#endif
+
+class Program;
+class PreProc;
+class SymbolTable;
+class Compiler;
+class ErrorHandler;
+
+/**
+ * A CompileContext holds everything that used to be a process
+ * wide singleton in the compiler: the program being built, the
+ * preprocessor, the symbol table, the AutoFree pool and the source
+ * locations of its nodes, the stats for
+ * the last compile, and the Compiler and ErrorHandler that are
+ * currently registered.
+ *
+ * Each thread has a current context.  Threads that never set one
+ * share the default context, so single threaded code does not need
+ * to know that contexts exist.  To compile on several threads, give
+ * each thread its own context (via Scope) and create a Compiler
+ * while that context is current.
+ *
+ * The lexer and parser are generated code with static state, so
+ * only one thread at a time may be lexing or parsing.  Code that
+ * drives them must hold a FrontEndLock; everything after parsing
+ * (code generation, image creation, listing) runs concurrently.
+ */
+class CompileContext
+{
+public:
+            CompileContext();
+            ~CompileContext();
+
+    /// the calling thread's context
+    static CompileContext*  Get();
+
+    /// Make c the calling thread's context (0 selects the
+    /// default context)
+    static void Set(CompileContext *c);
+
+    /// Makes a context current for the lifetime of the scope
+    class Scope
+    {
+    public:
+                Scope(CompileContext *c) : fSaved(Get()) { Set(c); }
+                ~Scope() { Set(fSaved); }
+    private:
+        CompileContext* fSaved;
+    };
+
+    /// Serializes use of the lexer and parser between threads;
+    /// the lock is recursive
+    class FrontEndLock
+    {
+    public:
+                FrontEndLock() : fLocked(true) { Lock(); }
+                ~FrontEndLock() { Release(); }
+
+        void    Release()   { if (fLocked) { fLocked = false; Unlock(); } }
+
+    private:
+        bool    fLocked;
+    };
+
+    Program*        fProgram;
+    PreProc*        fPreProc;
+    SymbolTable*    fSymbolTable;
+    Compiler*       fCompiler;
+    ErrorHandler*   fErrorHandler;
+    AutoFreeGroup   fAutoFreeGroup;
+    LocationTable   fLocations;
+    CompileStats    fStats;
+
+private:
+    static void Lock();
+    static void Unlock();
+
+    // a context can't be copied
+            CompileContext(const CompileContext &);
+    void    operator=(const CompileContext &);
+};
+
+#endif
@@ -0,0 +1,297 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include "CompileStats.h"
+#include "CompileContext.h"
+#include "Error.h"
+
+#if __cplusplus >= 201103L
+#include <chrono>
+#else
+#include <ctime>
+#endif
+
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(__wasm__)
+#define HAVE_GETRUSAGE
+#include <sys/resource.h>
+#endif
+
+using std::fprintf;
+using std::fputc;
+using std::fputs;
+
+static const char *sPhaseNames[] = {
+    "preprocess",
+    "parse",
+    "expand",
+    "image",
+    "encode",
+    "fixups"
+};
+
+static const char *sCounterNames[] = {
+    "tokens",
+    "macro_expansions",
+    "nodes",
+    "bytes",
+    "bytes_saved",
+    "bytes_reused"
+};
+
+static const char *sPoolNames[] = {
+    "nodes",
+    "buffers",
+    "macros",
+    "bytecode",
+    "image"
+};
+
+static void PrintJSONString(FILE *fp, const char *s);
+static long KB(long bytes)  { return (bytes + 1023) / 1024; }
+
+bool CompileStats::sTiming = false;
+long CompileStats::sMemoryLimit = 0;
+
+
+CompileStats::CompileStats() :
+    fNodeBase(0),
+    fTotalInUse(0)
+{
+    for(int i=0; i<kPoolCount; ++i)
+        fInUse[i] = 0;
+
+    Clear();
+}
+
+
+CompileStats& CompileStats::Get()
+{
+    return CompileContext::Get()->fStats;
+}
+
+
+void CompileStats::Reset()
+{
+    // the last image belongs to whoever asked for it
+    fTotalInUse -= fInUse[kImagePool];
+    fInUse[kImagePool] = 0;
+
+    Clear();
+
+    // nodes are counted by the AutoFree pool, which outlives a compile
+    fNodeBase = (long)CompileContext::Get()->fAutoFreeGroup.allocations();
+}
+
+
+void CompileStats::Clear()
+{
+    for(int i=0; i<kPhaseCount; ++i) {
+        fTimes[i] = 0;
+        fDepth[i] = 0;
+    }
+
+    for(int i=0; i<kCounterCount; ++i)
+        fCounts[i] = 0;
+
+    // what the pools already hold is where this compile's peak starts
+    for(int i=0; i<kPoolCount; ++i)
+        fPeak[i] = fInUse[i];
+    fTotalPeak = fTotalInUse;
+
+    for(int i=0; i<kPhaseCount; ++i)
+        fAllocated[i] = 0;
+
+    fOverLimit = false;
+}
+
+
+void CompileStats::Allocate(Pool p, long bytes)
+{
+    fInUse[p] += bytes;
+    fTotalInUse += bytes;
+
+    if (fInUse[p] > fPeak[p])
+        fPeak[p] = fInUse[p];
+    if (fTotalInUse > fTotalPeak)
+        fTotalPeak = fTotalInUse;
+
+    // phases are only tracked while timing
+    for(int i=0; i<kPhaseCount; ++i) {
+        if (fDepth[i])
+            fAllocated[i] += bytes;
+    }
+
+    if (sMemoryLimit && fTotalInUse > sMemoryLimit && !fOverLimit) {
+        fOverLimit = true;
+        Error(kErr_MemoryLimit, KB(sMemoryLimit)).Raise(0);
+    }
+}
+
+
+long CompileStats::GetCount(Counter c) const
+{
+    if (c == kNodeCounter)
+        return (long)CompileContext::Get()->fAutoFreeGroup.allocations() - fNodeBase;
+
+    return fCounts[c];
+}
+
+
+const char *CompileStats::GetName(Phase p)
+{
+    return sPhaseNames[p];
+}
+
+
+const char *CompileStats::GetName(Counter c)
+{
+    return sCounterNames[c];
+}
+
+
+const char *CompileStats::GetName(Pool p)
+{
+    return sPoolNames[p];
+}
+
+
+void CompileStats::Print(FILE *fp, const char *fileName) const
+{
+    fprintf(fp, "# Stats for %s\n", fileName);
+
+    if (sTiming) {
+        for(int i=0; i<kPhaseCount; ++i)
+            fprintf(fp, "%-18s %10.3f ms\n", sPhaseNames[i], fTimes[i] * 1000);
+    }
+
+    for(int i=0; i<kCounterCount; ++i)
+        fprintf(fp, "%-18s %10ld\n", sCounterNames[i], GetCount((Counter)i));
+
+    fprintf(fp, "%-18s %10ld KB\n", "allocated_peak", KB(fTotalPeak));
+    for(int i=0; i<kPoolCount; ++i)
+        fprintf(fp, "  %-16s %10ld KB\n", sPoolNames[i], KB(fPeak[i]));
+
+    if (sTiming) {
+        fputs("allocated during\n", fp);
+        for(int i=0; i<kPhaseCount; ++i)
+            fprintf(fp, "  %-16s %10ld KB\n", sPhaseNames[i], KB(fAllocated[i]));
+    }
+
+    long peak = GetPeakMemory();
+    if (peak >= 0)
+        fprintf(fp, "%-18s %10ld KB\n", "peak_memory", peak);
+}
+
+
+void CompileStats::PrintJSON(FILE *fp, const char *fileName) const
+{
+    fputs("{\"file\":", fp);
+    PrintJSONString(fp, fileName);
+
+    if (sTiming) {
+        fputs(",\"times_ms\":{", fp);
+        for(int i=0; i<kPhaseCount; ++i)
+            fprintf(fp, "%s\"%s\":%.3f", i ? "," : "", sPhaseNames[i], fTimes[i] * 1000);
+        fputc('}', fp);
+    }
+
+    fputs(",\"counts\":{", fp);
+    for(int i=0; i<kCounterCount; ++i)
+        fprintf(fp, "%s\"%s\":%ld", i ? "," : "", sCounterNames[i], GetCount((Counter)i));
+    fputc('}', fp);
+
+    fprintf(fp, ",\"allocated_kb\":{\"peak\":%ld", KB(fTotalPeak));
+    for(int i=0; i<kPoolCount; ++i)
+        fprintf(fp, ",\"%s\":%ld", sPoolNames[i], KB(fPeak[i]));
+    fputc('}', fp);
+
+    if (sTiming) {
+        fputs(",\"phase_allocated_kb\":{", fp);
+        for(int i=0; i<kPhaseCount; ++i)
+            fprintf(fp, "%s\"%s\":%ld", i ? "," : "", sPhaseNames[i], KB(fAllocated[i]));
+        fputc('}', fp);
+    }
+
+    long peak = GetPeakMemory();
+    if (peak >= 0)
+        fprintf(fp, ",\"peak_memory_kb\":%ld", peak);
+    fputs("}\n", fp);
+}
+
+
+long CompileStats::GetPeakMemory()
+{
+#ifdef HAVE_GETRUSAGE
+    struct rusage usage;
+
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return -1;
+#ifdef __APPLE__
+    // bytes on macOS, KB elsewhere
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+#else
+    return -1;
+#endif
+}
+
+
+double CompileStats::Now()
+{
+#if __cplusplus >= 201103L
+    return std::chrono::duration<double>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#else
+    return (double)std::clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+
+CompileStats::Timer::Timer(Phase p) :
+    fStats(0),
+    fPhase(p),
+    fStart(0)
+{
+    if (!sTiming) return;
+
+    fStats = &CompileStats::Get();
+    if (fStats->fDepth[p]++ == 0)
+        fStart = Now();
+}
+
+
+CompileStats::Timer::~Timer()
+{
+    if (!fStats) return;
+
+    if (--fStats->fDepth[fPhase] == 0)
+        fStats->fTimes[fPhase] += Now() - fStart;
+}
+
+
+void PrintJSONString(FILE *fp, const char *s)
+{
+    fputc('"', fp);
+    for(; *s; ++s) {
+        unsigned char c = (unsigned char)*s;
+
+        if (c == '"' || c == '\\')
+            fprintf(fp, "\\%c", c);
+        else if (c < 0x20)
+            fprintf(fp, "\\u%04x", c);
+        else
+            fputc(c, fp);
+    }
+    fputc('"', fp);
+}
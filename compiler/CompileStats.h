@@ -0,0 +1,154 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __CompileStats_h
+#define __CompileStats_h
+
+#include <cstdio>
+
+using std::FILE;
+
+/**
+ * Timings and counters for a single compile.  Each CompileContext
+ * has its own CompileStats, which Compiler::Compile() resets, so
+ * compiles on different threads don't mix their numbers.
+ *
+ * Counters are always kept since they only cost an increment.  The
+ * clock is only read once timing has been enabled (see SetTiming()).
+ * Phase times are inclusive: preprocessing happens while parsing,
+ * and encoding happens while creating the image, so the inner phase
+ * is also part of the outer one.
+ *
+ * Memory is accounted by pool: the AutoFree pool's chunks, the text
+ * of source buffers, the tokens of macro definitions, the code being
+ * generated, and the chunks of the image.  The bytes a pool holds
+ * outlive a compile, but its peak and the bytes allocated during each
+ * phase are for the last compile only.  A memory limit makes a compile
+ * that goes over it raise an error and stop reading its source.
+ */
+class CompileStats
+{
+public:
+    enum Phase {
+        kPreProcPhase = 0,
+        kParsePhase,
+        kExpandPhase,
+        kImagePhase,
+        kEncodePhase,
+        kFixupPhase,
+        kPhaseCount
+    };
+
+    enum Counter {
+        kTokenCounter = 0,
+        kExpansionCounter,
+        kNodeCounter,
+        kByteCounter,
+        kSavedByteCounter,
+        kReusedByteCounter,
+        kCounterCount
+    };
+
+    enum Pool {
+        kNodePool = 0,
+        kBufferPool,
+        kMacroPool,
+        kCodePool,
+        kImagePool,
+        kPoolCount
+    };
+
+            CompileStats();
+
+    /// the stats for the calling thread's context
+    static CompileStats&    Get();
+
+    /// Turn timing on or off for every context; this should be
+    /// done before any compiles start
+    static void SetTiming(bool on)  { sTiming = on; }
+    static bool GetTiming()         { return sTiming; }
+
+    void    Reset();
+
+    void    Count(Counter c, long n = 1)    { fCounts[c] += n; }
+    long    GetCount(Counter c) const;
+    /// seconds spent in the phase
+    double  GetTime(Phase p) const          { return fTimes[p]; }
+
+    /// Account for bytes taken from or given back to a pool
+    void    Allocate(Pool p, long bytes);
+    void    Release(Pool p, long bytes)     { fInUse[p] -= bytes; fTotalInUse -= bytes; }
+
+    /// the most bytes held at once, by one pool or all of them
+    long    GetPeak(Pool p) const           { return fPeak[p]; }
+    long    GetPeak() const                 { return fTotalPeak; }
+    /// bytes allocated while the phase was running
+    long    GetAllocated(Phase p) const     { return fAllocated[p]; }
+
+    /// Stop compiles that hold more than this many bytes (0 for no
+    /// limit)
+    static void SetMemoryLimit(long bytes)  { sMemoryLimit = bytes; }
+    static long GetMemoryLimit()            { return sMemoryLimit; }
+    /// true once the compile has gone over the limit
+    bool    OverLimit() const               { return fOverLimit; }
+
+    static const char*  GetName(Phase p);
+    static const char*  GetName(Counter c);
+    static const char*  GetName(Pool p);
+
+    /// the most memory the process has used so far, in KB, or -1 where
+    /// the platform can't say
+    static long GetPeakMemory();
+
+    /// seconds on a clock that only goes forward
+    static double Now();
+
+    /// Print the stats as a table, or as a single line JSON object
+    void    Print(FILE *fp, const char *fileName) const;
+    void    PrintJSON(FILE *fp, const char *fileName) const;
+
+    /// Adds the time until the end of the scope to a phase.  Only the
+    /// outermost timer of a phase counts, so recursion isn't counted
+    /// twice.
+    class Timer
+    {
+    public:
+                Timer(Phase p);
+                ~Timer();
+
+    private:
+        CompileStats*   fStats;
+        Phase           fPhase;
+        double          fStart;
+    };
+
+private:
+    void            Clear();
+
+    double  fTimes[kPhaseCount];
+    int     fDepth[kPhaseCount];
+    long    fCounts[kCounterCount];
+    long    fNodeBase;
+
+    long    fInUse[kPoolCount];
+    long    fPeak[kPoolCount];
+    long    fTotalInUse;
+    long    fTotalPeak;
+    long    fAllocated[kPhaseCount];
+    bool    fOverLimit;
+
+    static bool sTiming;
+    static long sMemoryLimit;
+};
+
+#endif
@@ -11,6 +11,7 @@
  * All Rights Reserved.
  *
  */
+#include <cctype>
 #include <cstring>
 #include "Compiler.h"
 #include "PreProc.h"
@@ -18,7 +19,12 @@
 #include "Program.h"
 #include "Buffer.h"
 #include "Macro.h"
+#include "PrecompiledHeader.h"
+#include "CompileContext.h"
+#include "CompileStats.h"
+#ifndef NQC_LAZY_COMPAT_API
 #include "rcx1_nqh.h"
+#endif
 #include "rcx2_nqh.h"
 #include "Error.h"
 #include "RCX_Image.h"
@@ -29,8 +35,47 @@ using std::sprintf;
 
 //#define NO_AUTO_FREE
 
+// the flags that change how a snapshot's text is parsed (xor is
+// rewritten differently once optimizing)
+static const int kSnapshotFlags = Compiler::kCompat_Flag |
+	Compiler::kOptimize1_Flag | Compiler::kOptimize2_Flag |
+	Compiler::kOptimizeSize_Flag;
 
-Compiler* Compiler::sCompiler = 0;
+
+struct Compiler::Snapshot
+{
+	const RCX_Target*	fTarget;
+	int					fFlags;
+	string				fPrefix;	// leading #includes, if any
+	vector<Buffer*>		fBuffers;
+	int					fFirstFile;	// of the buffers read for fPrefix
+	vector<PrecompiledHeader*>	fPrecompiled;
+	vector<Symbol*>		fSymbols;
+	vector<Macro*>		fMacros;
+	Program::State		fProgram;
+	set<string>			fOnceFiles;
+	map<string, Symbol*>	fGuards;
+};
+
+
+Compiler::Compiler()
+{
+	CompileContext::Get()->fCompiler = this;
+	fDirty = false;
+	fCustomDefines = false;
+	fSharedBuffers = 0;
+	fSnapshotsEnabled = false;
+	fProfile = 0;
+	fSnapshotMark = 0;
+	fSnapshotLocations = 0;
+	fFragmentCache = 0;
+}
+
+
+Compiler* Compiler::Get()
+{
+	return CompileContext::Get()->fCompiler;
+}
 
 
 void Compiler::Reset()
@@ -38,24 +83,96 @@ void Compiler::Reset()
 	// this function resets the state of the compiler, freeing
 	// up any memory used by it.  Beware, any references to
 	// program fragments, statements, conditions, or symbols
-	// will become invalid after this
+	// will become invalid after this (symbols survive if there
+	// are any snapshots, but their definitions do not)
 
+	// held back diagnostics refer to the buffers
+	if (ErrorHandler::Get())
+		ErrorHandler::Get()->Flush();
+
+	CompileContext::FrontEndLock lock;
 	LexReset();
+	lock.Release();
 
 	delete gPreProc;
 	delete gProgram;
 	gProgram = 0;
-	Symbol::GetSymbolTable()->DeleteAll();
 
+	if (fSnapshots.empty())
+	{
+		Symbol::GetSymbolTable()->DeleteAll();
 #ifndef NO_AUTO_FREE
-	GetAutoFreeGroup().freeAll();
+		GetAutoFreeGroup().freeAll();
+#endif
+		LocationTable::Get().Truncate(0);
+	}
+	else
+	{
+		// snapshots refer to symbols and to the function
+		// definitions from the API header
+		UndefineAll();
+#ifndef NO_AUTO_FREE
+		GetAutoFreeGroup().freeTo(fSnapshotMark);
 #endif
+		LocationTable::Get().Truncate(fSnapshotLocations);
+	}
 
 	gPreProc = new PreProc();
 
 	ReleaseBuffers();
 
 	fDirty = false;
+	fCustomDefines = false;
+}
+
+
+void Compiler::SetSnapshotsEnabled(bool enabled)
+{
+	fSnapshotsEnabled = enabled;
+	if (enabled || fSnapshots.empty()) return;
+
+	// the program may still refer to snapshot state
+	if (gProgram)
+		Reset();
+
+	for(size_t i=0; i<fSnapshots.size(); ++i)
+	{
+		Snapshot *s = fSnapshots[i];
+
+		for(size_t j=0; j<s->fBuffers.size(); ++j)
+			delete s->fBuffers[j];
+
+		for(size_t j=0; j<s->fPrecompiled.size(); ++j)
+			delete s->fPrecompiled[j];
+
+		for(size_t j=0; j<s->fMacros.size(); ++j)
+			delete s->fMacros[j];
+
+		delete s;
+	}
+	fSnapshots.resize(0);
+	fPlainPrefixes.clear();
+
+	Symbol::GetSymbolTable()->DeleteAll();
+#ifndef NO_AUTO_FREE
+	GetAutoFreeGroup().freeAll();
+#endif
+	LocationTable::Get().Truncate(0);
+	fSnapshotMark = 0;
+	fSnapshotLocations = 0;
+}
+
+
+void Compiler::SetFragmentCacheEnabled(bool enabled)
+{
+	if (enabled == (fFragmentCache != 0)) return;
+
+	// the program may still refer to the cache
+	if (gProgram)
+		gProgram->SetFragmentCache(0);
+
+	delete fFragmentCache;
+	fFragmentCache = enabled ? new FragmentCache() : 0;
 }
 
 
@@ -67,38 +184,114 @@ int Compiler::AddBuffer(Buffer *b)
 }
 
 
-RCX_Image *Compiler::Compile(Buffer *b, const RCX_Target *target, int flags)
+RCX_Image *Compiler::Compile(Buffer *b, const RCX_Target *target, int flags,
+	PrecompiledHeader *tokens)
 {
+	// only one thread at a time can be lexing and parsing
+	CompileContext::FrontEndLock lock;
+
 	// reset compiler if needed
 	if (fDirty)
 	{
 		Reset();
 	}
 
+	// a snapshot of the API header can only be used if nothing could
+	// have changed the way the header was preprocessed
+	bool useSnapshot = fSnapshotsEnabled && !fCustomDefines &&
+		(flags & kNoSysFile_Flag) == 0;
+	bool useCache = fFragmentCache && !fCustomDefines;
+
 	fDirty = true;
 	gProgram = new Program(target);
+	if (flags & kOptimizeSize_Flag)
+		gProgram->SetOptimize(Program::kSizeOptimize);
+	else if (flags & kOptimize2_Flag)
+		gProgram->SetOptimize(Program::kFullOptimize);
+	else if (flags & kOptimize1_Flag)
+		gProgram->SetOptimize(Program::kBasicOptimize);
+	else
+		gProgram->SetOptimize(Program::kNoOptimize);
+	if (flags & kNoSourceTags_Flag)
+		gProgram->SetSourceTags(false);
+	if (flags & kObject_Flag)
+		gProgram->SetObject(true);
+	if (flags & kSizeReport_Flag)
+		gProgram->SetSizeReport(true);
+	if (flags & kMainFirst_Flag)
+		gProgram->SetMainFirst(true);
+	gProgram->SetProfile(fProfile);
+	gProgram->SetFragmentCache(useCache ? fFragmentCache : 0);
+	CompileStats::Get().Reset();
+
+	// the leading #includes of the source, which a snapshot can cover
+	long prefixLength = (useSnapshot && !tokens) ? GetLeadingIncludes(b) : 0;
+	string prefix(b->GetData(), prefixLength);
+	if (fPlainPrefixes.count(prefix))
+	{
+		prefixLength = 0;
+		prefix.clear();
+	}
 
-	// define compiler target and compat mode
-	Define(target->fDefine, target->fDefValue);
-	if (flags & kCompat_Flag)
-		Define("__NQC1");
+	// the files read to check snapshots are kept with the compile's
+	// buffers, since they are the compile's includes
+	vector<Buffer*> checked;
+	Snapshot *snapshot = useSnapshot ? FindSnapshot(target, flags, prefix, checked) : 0;
+	if (snapshot)
+	{
+		RestoreSnapshot(snapshot);
+		ErrorHandler::Get()->Reset();
+	}
+	else
+	{
+		// define compiler target and compat mode
+		Define(target->fDefine, target->fDefValue);
+		if (flags & kCompat_Flag)
+			Define("__NQC1");
 
-	// define NQC version number
-	char versionCode[5];
-	sprintf(versionCode, "%d", MAJOR_VERSION * 100 + MINOR_VERSION);
-	Define("__NQC__", versionCode);
+		// define NQC version number
+		char versionCode[5];
+		sprintf(versionCode, "%d", MAJOR_VERSION * 100 + MINOR_VERSION);
+		Define("__NQC__", versionCode);
 
-	LexPush(b);
+		ErrorHandler::Get()->Reset();
+
+		// parse the system file (and the leading #includes) on its own
+		// so its state can be saved
+		if (useSnapshot)
+		{
+			Buffer *p = 0;
+			if (prefixLength)
+			{
+				p = new Buffer();
+				p->Create(b->GetName(), b->GetData(), (int)prefixLength);
+			}
+			ParseApi(target, flags, p);
+		}
+	}
+
+	if (tokens)
+	{
+		AddPrecompiled(tokens);
+		LexPushTokens(b, tokens);
+	}
+	else
+		LexPushFrom(b, prefixLength);
+
+	for(size_t i=0; i<checked.size(); ++i)
+		AddBuffer(checked[i]);
 
 	// system file
-	if ((flags & kNoSysFile_Flag) == 0)
+	if (!useSnapshot && (flags & kNoSysFile_Flag) == 0)
 	{
 		LexPush(CreateApiBuffer(flags & kCompat_Flag));
 	}
 
-	ErrorHandler::Get()->Reset();
-
-	yyparse();
+	{
+		CompileStats::Timer timer(CompileStats::kParsePhase);
+		yyparse();
+	}
+	lock.Release();
 
 	RCX_Image *image = 0;
 	if (ErrorHandler::Get()->GetErrorCount() == 0)
@@ -111,28 +304,302 @@ RCX_Image *Compiler::Compile(Buffer *b, const RCX_Target *target, int flags)
 		}
 	}
 
+	ErrorHandler::Get()->Flush();
 	return image;
 }
 
 
+void Compiler::PrintSizeReport(FILE *fp) const
+{
+	if (gProgram && gProgram->GetSizeReport())
+		gProgram->PrintSizeReport(fp);
+}
+
+
+RCX_Image *Compiler::CompileText(const char *text, int length, const RCX_Target *target, int flags)
+{
+	// the buffer takes its own copy of the text
+	Buffer *b = new Buffer();
+	b->Create("<input>", text, length);
+
+	RCX_Image *image = Compile(b, target, flags);
+	Reset();
+
+	return image;
+}
+
+
+long Compiler::Scan(Buffer *b, const RCX_Target *target, bool preprocess)
+{
+	CompileContext::FrontEndLock lock;
+
+	if (fDirty)
+	{
+		Reset();
+	}
+
+	// the preprocessor's pragmas need a program
+	fDirty = true;
+	gProgram = new Program(target);
+	CompileStats::Get().Reset();
+	Define(target->fDefine, target->fDefValue);
+	ErrorHandler::Get()->Reset();
+
+	LexPush(b);
+
+	long count = 0;
+	TokenVal v;
+
+	if (preprocess)
+	{
+		while(gPreProc->Get(v))
+			++count;
+	}
+	else
+	{
+		while(LexGetToken(v))
+			++count;
+	}
+
+	return count;
+}
+
+
 Buffer *Compiler::CreateApiBuffer(bool compatMode)
 {
 	Buffer *b = new Buffer();
 
+#ifdef NQC_LAZY_COMPAT_API
+	// The 1.x header is left out of the binary; whoever needs it
+	// puts it in kCompatApiFile first.
+	if (compatMode)
+	{
+		if (!b->Create("rcx.nqh", kCompatApiFile))
+		{
+			static const char missing[] = "#error \"" kCompatApiFile " has not been loaded\"\n";
+			b->Create("rcx.nqh", missing, sizeof(missing) - 1);
+		}
+		return b;
+	}
+#else
 	if (compatMode)
 		b->Create("rcx.nqh", rcx1_nqh, sizeof(rcx1_nqh));
 	else
+#endif
 		b->Create("rcx.nqh", rcx2_nqh, sizeof(rcx2_nqh));
 
 	return b;
 }
 
 
+void Compiler::ParseApi(const RCX_Target *target, int flags, Buffer *prefix)
+{
+	// the API header comes first, then any files that prefix includes
+	if (prefix)
+		LexPush(prefix);
+	int firstFile = (int)fBuffers.size() + 1;
+	LexPush(CreateApiBuffer(flags & kCompat_Flag));
+	{
+		CompileStats::Timer timer(CompileStats::kParsePhase);
+		yyparse();
+	}
+
+	// the preprocessor latches the end of input, so a new one carries on
+	set<string> onceFiles;
+	map<string, Symbol*> guards;
+	gPreProc->GetIncludedFiles(onceFiles, guards);
+	delete gPreProc;
+	gPreProc = new PreProc();
+	gPreProc->SetIncludedFiles(onceFiles, guards);
+
+	// don't keep a snapshot of a broken header
+	if (ErrorHandler::Get()->GetErrorCount()) return;
+
+	if (prefix)
+	{
+		string text(prefix->GetData(), prefix->GetLength());
+
+		// a global, task or sub isn't part of the state that's saved,
+		// and warnings wouldn't be seen again
+		if (!gProgram->HasOnlyFunctions() || ErrorHandler::Get()->GetWarningCount())
+		{
+			fPlainPrefixes.insert(text);
+			return;
+		}
+
+		int count = 0;
+		for(size_t i=0; i<fSnapshots.size(); ++i)
+			if (!fSnapshots[i]->fPrefix.empty()) ++count;
+		if (count >= kMaxIncludeSnapshots) return;
+	}
+
+	Snapshot *s = new Snapshot;
+	s->fTarget = target;
+	s->fFlags = flags & kSnapshotFlags;
+	if (prefix)
+		s->fPrefix.assign(prefix->GetData(), prefix->GetLength());
+
+	// the snapshot takes ownership of all buffers used so far, and of
+	// the tokens that macros may have been defined from
+	s->fBuffers = fBuffers;
+	s->fFirstFile = prefix ? firstFile : (int)fBuffers.size();
+	fSharedBuffers = fBuffers.size();
+	s->fPrecompiled = fPrecompiled;
+	fPrecompiled.resize(0);
+
+	SymbolTable *table = Symbol::GetSymbolTable();
+	for(int i=0; i<table->GetSlotCount(); ++i)
+	{
+		Symbol *sym = table->GetSlot(i);
+		Macro *m = sym ? sym->GetDefinition() : 0;
+		if (!m) continue;
+
+		s->fSymbols.push_back(sym);
+		s->fMacros.push_back(new Macro(m->GetTokens(), m->GetTokenCount(), m->GetArgCount()));
+	}
+
+	gProgram->SaveState(s->fProgram);
+	s->fOnceFiles = onceFiles;
+	s->fGuards = guards;
+
+	// everything allocated so far (including earlier snapshots) must
+	// survive a Reset()
+	fSnapshotMark = GetAutoFreeGroup().mark();
+	fSnapshotLocations = LocationTable::Get().GetCount();
+
+	fSnapshots.push_back(s);
+}
+
+
+/*
+ * A snapshot of leading #includes is only good while the files it
+ * read are the same.  Each is read again (into checked, whether it
+ * matches or not), which is much less work than parsing it.
+ */
+Compiler::Snapshot *Compiler::FindSnapshot(const RCX_Target *target, int flags,
+	const string &prefix, vector<Buffer*> &checked)
+{
+	for(size_t i=0; i<fSnapshots.size(); ++i)
+	{
+		Snapshot *s = fSnapshots[i];
+		if (s->fTarget == target && s->fFlags == (flags & kSnapshotFlags) &&
+			s->fPrefix == prefix && IsCurrent(s, checked))
+			return s;
+	}
+
+	return 0;
+}
+
+
+bool Compiler::IsCurrent(const Snapshot *s, vector<Buffer*> &checked)
+{
+	for(size_t i=s->fFirstFile; i<s->fBuffers.size(); ++i)
+	{
+		const Buffer *was = s->fBuffers[i];
+		Buffer *now = CreateBuffer(was->GetName());
+		if (!now) return false;
+
+		checked.push_back(now);
+		if (now->GetLength() != was->GetLength() ||
+			memcmp(now->GetData(), was->GetData(), (size_t)was->GetLength()) != 0)
+			return false;
+	}
+
+	return true;
+}
+
+
+void Compiler::RestoreSnapshot(const Snapshot *s)
+{
+	// buffer indices must match the ones recorded in the header's locations
+	ReleaseBuffers();
+	fBuffers = s->fBuffers;
+	fSharedBuffers = fBuffers.size();
+
+	// most of the header's macros go unused, so each is only copied
+	// once the source uses it
+	UndefineAll();
+	for(size_t i=0; i<s->fSymbols.size(); ++i)
+		s->fSymbols[i]->DefineLater(s->fMacros[i]);
+
+	gProgram->RestoreState(s->fProgram);
+	gPreProc->SetIncludedFiles(s->fOnceFiles, s->fGuards);
+}
+
+
+/*
+ * The length of the #include lines (and the blank lines and comments
+ * around them) that b begins with, 0 if it doesn't begin with any.
+ */
+long Compiler::GetLeadingIncludes(const Buffer *b)
+{
+	const char *start = b->GetData();
+	const char *end = start + b->GetLength();
+	const char *p = start;
+	long length = 0;
+
+	while(p < end)
+	{
+		if (isspace((unsigned char)*p))
+			++p;
+		else if (end - p >= 2 && p[0] == '/' && p[1] == '/')
+		{
+			while(p < end && *p != '\n') ++p;
+		}
+		else if (end - p >= 2 && p[0] == '/' && p[1] == '*')
+		{
+			const char *close = p + 2;
+			while(end - close >= 2 && !(close[0] == '*' && close[1] == '/')) ++close;
+			if (end - close < 2) break;
+			p = close + 2;
+		}
+		else if (*p == '#')
+		{
+			const char *q = p + 1;
+			while(q < end && (*q == ' ' || *q == '\t')) ++q;
+			if (end - q < 7 || strncmp(q, "include", 7) != 0) break;
+			q += 7;
+			while(q < end && (*q == ' ' || *q == '\t')) ++q;
+			if (q == end || (*q != '"' && *q != '<')) break;
+
+			char close = (*q == '"') ? '"' : '>';
+			++q;
+			while(q < end && *q != close && *q != '\n') ++q;
+			if (q == end || *q != close) break;
+			++q;
+
+			// nothing else may follow on the line
+			while(q < end && (*q == ' ' || *q == '\t' || *q == '\r')) ++q;
+			if (q < end && *q != '\n') break;
+
+			p = (q < end) ? q + 1 : q;
+			length = p - start;
+		}
+		else
+			break;
+	}
+
+	return length;
+}
+
+
+void Compiler::UndefineAll()
+{
+	SymbolTable *table = Symbol::GetSymbolTable();
+
+	for(int i=0; i<table->GetSlotCount(); ++i)
+		if (Symbol *s = table->GetSlot(i))
+			s->Undefine();
+}
+
+
 void Compiler::Define(const char *name, const char *value)
 {
 	Symbol *s = Symbol::Get(name);
 	Macro *m;
 
+	fCustomDefines = true;
+
 	if (value)
 	{
 		vector<Token> tokens;
@@ -144,6 +611,8 @@ void Compiler::Define(const char *name, const char *value)
 		buf = new Buffer();
 
 		buf->Create("<cmdline>", value, (int)strlen(value));
+
+		CompileContext::FrontEndLock lock;
 		LexPush(buf);
 
 		while((t=yylex(v)) != 0)
@@ -164,17 +633,27 @@ void Compiler::Define(const char *name, const char *value)
 
 void Compiler::Undefine(const char *name)
 {
+	fCustomDefines = true;
 	Symbol::Get(name)->Undefine();
 }
 
 
 void Compiler::ReleaseBuffers()
 {
-	for(size_t i=0; i<fBuffers.size(); i++)
+	// leading buffers may be owned by a snapshot
+	for(size_t i=fSharedBuffers; i<fBuffers.size(); i++)
 		delete fBuffers[i];
 
 
 	fBuffers.resize(0);
+	fSharedBuffers = 0;
+
+	// tokens played back from these may still have been referenced
+	// by macros up until now
+	for(size_t i=0; i<fPrecompiled.size(); i++)
+		delete fPrecompiled[i];
+
+	fPrecompiled.resize(0);
 }
 
 
@@ -185,10 +664,45 @@ long Compiler::Print(RCX_Printer *dst, short index, long start, long end)
 
 	const Buffer *b = fBuffers[index];
 
+	// offsets may come from an image whose source has since changed
+	if (start < 0) start = 0;
+
 	start = b->FindStartOfLine(start);
 	end = b->FindEndOfLine(end);
 
-	dst->Print(b->GetData() + start, end - start + 1);
+	// the buffer keeps the file's own line endings, but the listing
+	// always uses plain newlines
+	const char *data = b->GetData();
+	while (start <= end)
+	{
+		long lineEnd = b->FindEndOfLine(start);
+		long length = lineEnd - start;
+
+		if (data[lineEnd] == '\n' && length > 0 && data[lineEnd-1] == '\r')
+			--length;
+
+		dst->Print(data + start, length);
+		dst->Print("\n", 1);
+		start = lineEnd + 1;
+	}
 
 	return end;
 }
+
+
+const char *Compiler::GetName(short index)
+{
+	if (index < 0 || index >= (short)fBuffers.size()) return 0;
+
+	return fBuffers[index]->GetName();
+}
+
+
+long Compiler::GetLine(short index, long offset)
+{
+	if (index < 0 || index >= (short)fBuffers.size() ||
+		fBuffers[index]->GetLength() == 0) return 0;
+
+	int o = (int)offset;
+	return fBuffers[index]->FindLine(o);
+}
@@ -14,16 +14,28 @@
 #ifndef __Compiler_h
 #define __Compiler_h
 
+#include <cstdio>
+#include <set>
 #include <vector>
+#include <string>
 
 #include "RCX_Constants.h"
 #include "RCX_Target.h"
 #include "RCX_Disasm.h"
 
+using std::set;
 using std::vector;
+using std::string;
+
+// where the NQC 1.x API header is read from when it isn't built in
+// (WebAssembly builds define NQC_LAZY_COMPAT_API to leave it out)
+#define kCompatApiFile "rcx1.nqh"
 
 class RCX_Image;
 class Buffer;
+class PrecompiledHeader;
+class RCX_Profile;
+class FragmentCache;
 
 class Compiler : public RCX_SourceFiles
 {
@@ -31,39 +43,137 @@ public:
 	enum
 	{
 		kCompat_Flag = 1 << 0,
-		kNoSysFile_Flag = 1 << 2
+		kNoSysFile_Flag = 1 << 2,
+		// no optimization (nqc -opt 0) unless one of these is set
+		kOptimize2_Flag = 1 << 3,
+		kOptimize1_Flag = 1 << 4,
+		kOptimizeSize_Flag = 1 << 5,
+		// leave source tags out of the image, for when nothing will
+		// list the code or map it back to the source
+		kNoSourceTags_Flag = 1 << 6,
+		// make an RCX_Object to be linked with others, rather than
+		// an image of the whole program
+		kObject_Flag = 1 << 7,
+		// keep what PrintSizeReport() prints
+		kSizeReport_Flag = 1 << 8,
+		// put main and what it can run ahead of the other tasks
+		kMainFirst_Flag = 1 << 9
 	};
 
-			Compiler()	 { sCompiler = this; fDirty = false; }
+			Compiler();
 	virtual ~Compiler() {}
 
-	static Compiler*	Get()	{ return sCompiler; }
+	// the compiler registered with the current CompileContext
+	static Compiler*	Get();
 
 	void	Reset();
-	RCX_Image *	Compile(Buffer *buffer, const RCX_Target *target, int flags);
+
+	// If tokens are given they are played back in place of lexing the
+	// buffer, which they must have been lexed from.  The compiler owns
+	// them from then on.
+	RCX_Image *	Compile(Buffer *buffer, const RCX_Target *target, int flags,
+					PrecompiledHeader *tokens = 0);
+
+	// Compile text held in memory, then reset everything but the API
+	// snapshots, so that nothing carries over to the next compile.
+	// This is for running many compiles in one process (fuzzing and
+	// load tests).  The image (0 if there were errors) is the caller's.
+	RCX_Image *	CompileText(const char *text, int length, const RCX_Target *target, int flags);
+
+	// Count the tokens of a buffer (without the API header), read
+	// straight from the lexer or through the preprocessor, without
+	// parsing them.  This is for timing the front end.
+	long	Scan(Buffer *buffer, const RCX_Target *target, bool preprocess);
 
 	void	Define(const char *name, const char *value=0);
 	void	Undefine(const char *name);
 
+	// Snapshots keep the state produced by the API header for each
+	// target so that later compiles can restore it instead of parsing
+	// the header again.  They are not used when macros have been
+	// defined or undefined ahead of the compile.
+	//
+	// A source that begins with #includes (of a library of inline
+	// functions, say) gets a snapshot of the state after them too, as
+	// long as they only define macros and functions, and the source is
+	// then read from after them.  Such a snapshot is used again while
+	// the files it read are unchanged.
+	void	SetSnapshotsEnabled(bool enabled);
+
+	// Keep the code of each task and sub between compiles, so that a
+	// recompile reuses the code of the ones that are unchanged (see
+	// FragmentCache).  Like snapshots, the cache isn't used when
+	// macros have been defined or undefined ahead of the compile.
+	void	SetFragmentCacheEnabled(bool enabled);
+
+	// Line counts from an emulated run of the program, which later
+	// compiles use to lay out branches and choose what to inline (see
+	// Program::GetHeat()).  The caller keeps the profile.
+	void	SetProfile(const RCX_Profile *profile)	{ fProfile = profile; }
+
+	// After a compile with kSizeReport_Flag, print the bytes and the
+	// globals, locals and temps of each task and sub, and the bytes
+	// of each inline function, biggest first.
+	void	PrintSizeReport(FILE *fp) const;
+
 	// hooks for the lexer
 	int				AddBuffer(Buffer *b);
 	Buffer*			GetBuffer(int i)		{ return fBuffers[i]; }
 
 	virtual Buffer *CreateBuffer(const char *name) = 0;
 
+	// the file that CreateBuffer(name) would read, so that a file
+	// included by different names can be recognized (returns false
+	// if there is no such file)
+	virtual bool GetIncludePath(const char *name, string &path) { path = name; return true; }
+
+	// an identity for the file that CreateBuffer(name) would read, the
+	// same for every name and path it can be reached by (returns false
+	// if there is no such file)
+	virtual bool GetFileId(const char *name, string &id) { return GetIncludePath(name, id); }
+
+	// an up to date precompiled version of an included file (if any)
+	virtual PrecompiledHeader *CreatePrecompiled(const char * /* name */, const Buffer * /* source */) { return 0; }
+	void			AddPrecompiled(PrecompiledHeader *h)	{ fPrecompiled.push_back(h); }
+
 	// access to system API buffer
 	static	Buffer*		CreateApiBuffer(bool compatMode);
 
 	// used to insert source code into assembly listings (from RCX_SourceFiles)
 	virtual long Print(RCX_Printer *printer, short index, long start, long end);
+	virtual int			GetCount()		{ return (int)fBuffers.size(); }
+	virtual const char*	GetName(short index);
+	virtual long		GetLine(short index, long offset);
 
 private:
+	struct Snapshot;
+
 	void	ReleaseBuffers();
+	void	UndefineAll();
+	void	ParseApi(const RCX_Target *target, int flags, Buffer *prefix);
+	Snapshot*	FindSnapshot(const RCX_Target *target, int flags, const string &prefix,
+					vector<Buffer*> &checked);
+	bool	IsCurrent(const Snapshot *s, vector<Buffer*> &checked);
+	void	RestoreSnapshot(const Snapshot *s);
+	static long	GetLeadingIncludes(const Buffer *b);
 
 	vector<Buffer*>	fBuffers;
+	int				fSharedBuffers;
+	vector<PrecompiledHeader*>	fPrecompiled;
 	bool			fDirty;
+	bool			fCustomDefines;
+	const RCX_Profile*	fProfile;
+
+	// snapshots of leading #includes beyond which more aren't made
+	enum { kMaxIncludeSnapshots = 8 };
+
+	bool				fSnapshotsEnabled;
+	vector<Snapshot*>	fSnapshots;
+	set<string>			fPlainPrefixes;	// leading #includes that can't have one
+	void*				fSnapshotMark;
+	int					fSnapshotLocations;	// LocationTable count at the mark
 
-	static Compiler*	sCompiler;
+	FragmentCache*		fFragmentCache;
 };
 
 #endif
@@ -15,6 +15,7 @@
 #include <cstdio>
 #include "CondParser.h"
 #include "Symbol.h"
+#include "Macro.h"
 #include "PreProc.h"
 #include "Error.h"
 
@@ -30,6 +31,7 @@ CondParser::CondParser()
 	fMaxDepth = kDefaultDepth;
 	fStack = new long[kDefaultDepth];
 	fDefinedSymbol = nil;
+	fRecording = false;
 }
 
 CondParser::~CondParser()
@@ -38,14 +40,53 @@ CondParser::~CondParser()
 }
 
 
-bool CondParser::Parse(long &value)
+bool CondParser::Parse(long &value, bool cache)
 {
-	int t;
-	TokenVal v;
-
 	Init();
 	value = 0;	// default value in case of error
 
+	ReadLine();
+
+	string key;
+	if (cache && !Encode(fLine.empty() ? 0 : &fLine[0], fLine.size(), key))
+		cache = false;
+
+	if (cache)
+	{
+		map<string, Result>::const_iterator i = fResults.find(key);
+		if (i != fResults.end() && IsCurrent(i->second))
+		{
+			value = i->second.fValue;
+			return true;
+		}
+	}
+
+	// evaluate the line from the tokens that were just read
+	fUses.resize(0);
+	fRecording = true;
+	gPreProc->Replay(fLine.empty() ? 0 : &fLine[0], fLine.size());
+
+	bool ok = Evaluate(value);
+
+	fRecording = false;
+
+	// skip whatever is left of the line after an error
+	TokenVal v;
+	while(gPreProc->GetReplayPos() < (int)fLine.size())
+		gPreProc->GetRawToken(v);
+
+	if (ok && cache)
+		Save(key, value);
+
+	return ok;
+}
+
+
+bool CondParser::Evaluate(long &value)
+{
+	int t;
+	TokenVal v;
+
 	while((t=gPreProc->GetReplacedToken(v)) != 0)
 	{
 		bool ok;
@@ -59,20 +100,20 @@ bool CondParser::Parse(long &value)
 
 		if (!ok)
 		{
-			Error(kErr_CondExpression).RaiseLex();
+			Raise(kErr_CondExpression);
 			return false;
 		}
 	}
 
 	if (fState == kValueState)
 	{
-		Error(kErr_UnexpectedEOL).RaiseLex();
+		Raise(kErr_UnexpectedEOL);
 		return false;
 	}
 
 	if (fParen != 0)
 	{
-		Error(kErr_UnbalancedParens).RaiseLex();
+		Raise(kErr_UnbalancedParens);
 		return false;
 	}
 
@@ -83,6 +124,142 @@ bool CondParser::Parse(long &value)
 }
 
 
+void CondParser::ReadLine()
+{
+	int t;
+	Token token;
+
+	fLine.resize(0);
+	fLocations.resize(0);
+
+	do
+	{
+		t = gPreProc->GetRawToken(token.fValue);
+		if (t == 0) break;
+
+		token.fType = t;
+		fLine.push_back(token);
+
+		LexLocation loc;
+		LexCurrentLocation(loc);
+		fLocations.push_back(loc);
+	} while(t != NL);
+}
+
+
+void CondParser::Raise(ErrorCode code)
+{
+	// the lexer has already read the whole line, so use the location
+	// of the last token that was played back
+	int pos = gPreProc->GetReplayPos();
+
+	if (pos > 0)
+		Error(code).Raise(&fLocations[pos-1]);
+	else
+		Error(code).RaiseLex();
+}
+
+
+void CondParser::AddUse(Symbol *s)
+{
+	for(size_t i=0; i<fUses.size(); ++i)
+		if (fUses[i] == s) return;
+
+	fUses.push_back(s);
+}
+
+
+bool CondParser::IsCurrent(const Result &r) const
+{
+	string definition;
+
+	for(size_t i=0; i<r.fUses.size(); ++i)
+	{
+		const Use &u = r.fUses[i];
+
+		if (!Describe(u.fSymbol, definition) || definition != u.fDefinition)
+			return false;
+	}
+
+	return true;
+}
+
+
+bool CondParser::Save(const string &key, long value)
+{
+	Result r;
+
+	r.fValue = value;
+	r.fUses.resize(fUses.size());
+
+	for(size_t i=0; i<fUses.size(); ++i)
+	{
+		r.fUses[i].fSymbol = fUses[i];
+		if (!Describe(fUses[i], r.fUses[i].fDefinition))
+			return false;
+	}
+
+	fResults[key] = r;
+	return true;
+}
+
+
+/*
+ * Append a description of the tokens to s that is the same for two
+ * token sequences exactly when they are.  Tokens whose values can't
+ * be compared this way (strings, for example) make it fail.
+ */
+bool CondParser::Encode(const Token *tokens, int count, string &s)
+{
+	for(int i=0; i<count; ++i)
+	{
+		const Token &t = tokens[i];
+
+		s.append((const char *)&t.fType, sizeof(t.fType));
+
+		switch(t.fType)
+		{
+			case ID:
+				s.append((const char *)&t.fValue.fSymbol, sizeof(t.fValue.fSymbol));
+				break;
+			case NUMBER:
+			case PP_ARG:
+				s.append((const char *)&t.fValue.fInt, sizeof(t.fValue.fInt));
+				break;
+			case NL:
+			case LEFT:
+			case RIGHT:
+			case REL_GE:
+			case REL_LE:
+			case REL_EQ:
+			case REL_NE:
+			case AND:
+			case OR:
+				break;
+			default:
+				if (t.fType >= 256) return false;
+				break;
+		}
+	}
+
+	return true;
+}
+
+
+bool CondParser::Describe(Symbol *s, string &definition)
+{
+	definition.resize(0);
+
+	const Macro *m = s->GetDefinition();
+	if (!m) return true;
+
+	int argCount = m->GetArgCount();
+	definition.append((const char *)&argCount, sizeof(argCount));
+
+	return Encode(m->GetTokens(), m->GetTokenCount(), definition);
+}
+
+
 void CondParser::Init()
 {
 	fState = kValueState;
@@ -175,6 +352,7 @@ bool CondParser::ParseDefined(long &value)
 
 	t = gPreProc->GetRawToken(v);
 	if (t != ID) return false;
+	AddUse(v.fSymbol);
 	value = v.fSymbol->IsDefined();
 
 	t = gPreProc->GetReplacedToken(v);
@@ -22,17 +22,69 @@
 #include "PTypes.h"
 #endif
 
+#ifndef __LexLocation_h
+#include "LexLocation.h"
+#endif
+
+#ifndef __Error_h
+#include "Error.h"
+#endif
+
+#include <vector>
+#include <map>
+#include <string>
+
+using std::vector;
+using std::map;
+using std::string;
+
 class Symbol;
 
+/*
+ * Evaluates the expression of an #if or #elif.  The result of each
+ * line is remembered along with the definitions of every symbol that
+ * was looked at while evaluating it, so when the same line shows up
+ * again (as conditionals in headers tend to) and none of those
+ * symbols have changed, the expression isn't evaluated again.
+ */
 class CondParser
 {
 public:
 			CondParser();
 			~CondParser();
 
-	bool	Parse(long &value);
+	// results are only cached if cache is set, which should be
+	// false when macros aren't being expanded
+	bool	Parse(long &value, bool cache=true);
+
+	// called by the preprocessor for each identifier it looks up
+	void	Uses(Symbol *s)	{ if (fRecording) AddUse(s); }
+	// true while the identifiers looked up are being recorded
+	bool	IsRecording() const	{ return fRecording; }
 
 private:
+	struct Use
+	{
+		Symbol*	fSymbol;
+		string	fDefinition;
+	};
+
+	struct Result
+	{
+		long		fValue;
+		vector<Use>	fUses;
+	};
+
+	bool	Evaluate(long &value);
+	void	ReadLine();
+	void	Raise(ErrorCode code);
+	void	AddUse(Symbol *s);
+	bool	IsCurrent(const Result &r) const;
+	bool	Save(const string &key, long value);
+
+	static bool	Encode(const Token *tokens, int count, string &s);
+	static bool	Describe(Symbol *s, string &definition);
+
 	enum State
 	{
 		kValueState,
@@ -58,6 +110,12 @@ private:
 	int		fMaxDepth;
 	long*	fStack;
 	Symbol*	fDefinedSymbol;
+
+	vector<Token>		fLine;
+	vector<LexLocation>	fLocations;
+	bool				fRecording;
+	vector<Symbol*>		fUses;
+	map<string, Result>	fResults;
 };
 
 #endif
@@ -0,0 +1,315 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include "ConstPropagator.h"
+#include "AsmStmt.h"
+#include "AssignMathStmt.h"
+#include "BlockStmt.h"
+#include "CallStmt.h"
+#include "CaseStmt.h"
+#include "DeclareStmt.h"
+#include "GosubParamStmt.h"
+#include "GotoStmt.h"
+#include "IfStmt.h"
+#include "LabelStmt.h"
+#include "RepeatStmt.h"
+#include "ScopeStmt.h"
+#include "SwitchStmt.h"
+#include "AddrOfExpr.h"
+#include "AtomExpr.h"
+#include "DerefExpr.h"
+#include "IncDecExpr.h"
+#include "Variable.h"
+
+
+/// Finds the variables to track, and anything that rules the fragment out
+class ConstPropagator::Finder
+{
+public:
+            Finder(set<int> &tracked) : fTracked(tracked), fUnsafe(false) {}
+
+    bool    operator()(Stmt *s);
+    bool    operator()(Expr *e);
+
+    bool    IsUnsafe() const    { return fUnsafe; }
+
+private:
+    set<int>&   fTracked;
+    bool        fUnsafe;
+};
+
+
+/// The expressions that statements write to
+class ConstPropagator::Writes
+{
+public:
+            Writes() : fUnknown(false) {}
+
+    bool    operator()(Stmt *s);
+    void    FindIncDecs(Expr *e);
+
+    const vector<const Expr*>&  Get() const { return fWrites; }
+    bool    IsUnknown() const   { return fUnknown; }
+
+private:
+    vector<const Expr*> fWrites;
+    bool                fUnknown;
+};
+
+
+void ConstPropagator::Propagate(Stmt *body)
+{
+    Finder f(fTracked);
+    Apply(body, f);
+    if (f.IsUnsafe() || fTracked.empty()) return;
+
+    Values values;
+    Walk(body, values, Values());
+}
+
+
+void ConstPropagator::Walk(Stmt *s, Values &values, const Values &entry)
+{
+    if (dynamic_cast<BlockStmt*>(s) || dynamic_cast<ScopeStmt*>(s)) {
+        for(Stmt *c = s->GetChildren(); c; c = c->GetNext())
+            Walk(c, values, entry);
+    }
+    else if (CaseStmt *cs = dynamic_cast<CaseStmt*>(s)) {
+        // the switch can jump here with only what it started with
+        values = entry;
+        if (cs->GetBody()) Walk(cs->GetBody(), values, entry);
+    }
+    else if (DeclareStmt *ds = dynamic_cast<DeclareStmt*>(s)) {
+        values.erase(ds->GetVar());
+        if (ds->GetBody()) Walk(ds->GetBody(), values, entry);
+    }
+    else if (dynamic_cast<LeafStmt*>(s))
+        WalkLeaf(s, values);
+    else
+        WalkCompound(s, values);
+}
+
+
+void ConstPropagator::WalkLeaf(Stmt *s, Values &values)
+{
+    // the params aren't in GetExprs()
+    if (dynamic_cast<GosubParamStmt*>(s)) {
+        values.clear();
+        return;
+    }
+
+    int n = s->GetExprCount();
+    AssignStmt *assign = dynamic_cast<AssignStmt*>(s);
+    AsmStmt *a = dynamic_cast<AsmStmt*>(s);
+
+    // the order of ++ and -- against the other reads isn't defined
+    Writes incDecs;
+    for(int i=0; i<n; ++i)
+        incDecs.FindIncDecs(s->GetExpr(i));
+    Kill(values, incDecs.Get());
+
+    vector<const Expr*> writes;
+
+    for(int i=0; i<n; ++i) {
+        Expr *e = s->GetExpr(i);
+
+        if (assign && i == 0) {
+            // only the index of an array element is read
+            vector<Expr*> children;
+            e->GetExprs(children);
+            for(size_t j=0; j<children.size(); ++j)
+                Substitute(children[j], values);
+        }
+        else if (a && !a->GetField(i)->AcceptsConstant())
+            writes.push_back(e);
+        else
+            Substitute(e, values);
+    }
+
+    Kill(values, writes);
+
+    if (assign) {
+        // arrays and pointers could write to anything
+        int var = assign->GetLval()->GetLValue();
+        if (var == kIllegalVar) {
+            values.clear();
+            return;
+        }
+
+        values.erase(var);
+
+        int value;
+        if (!dynamic_cast<AssignMathStmt*>(s) && fTracked.count(var) &&
+            assign->GetExpr(1)->Evaluate(value))
+            values[var] = value;
+    }
+}
+
+
+void ConstPropagator::WalkCompound(Stmt *s, Values &values)
+{
+    Writes w;
+    Apply(s, w);
+
+    Values base;
+    if (!w.IsUnknown()) {
+        base = values;
+        Kill(base, w.Get());
+    }
+
+    // an if, switch or repeat computes its expression once on the way
+    // in, the others may do so again after their statements have run
+    Values in = base;
+    if (dynamic_cast<IfStmt*>(s) || dynamic_cast<SwitchStmt*>(s) ||
+        dynamic_cast<RepeatStmt*>(s)) {
+        Writes incDecs;
+        for(int i=0; i<s->GetExprCount(); ++i)
+            incDecs.FindIncDecs(s->GetExpr(i));
+        in = values;
+        Kill(in, incDecs.Get());
+    }
+
+    // the arguments of an expanded call aren't emitted
+    if (!dynamic_cast<CallStmt*>(s)) {
+        for(int i=0; i<s->GetExprCount(); ++i)
+            Substitute(s->GetExpr(i), in);
+    }
+
+    const Values &entry = dynamic_cast<SwitchStmt*>(s) ? base : Values();
+
+    for(Stmt *c = s->GetChildren(); c; c = c->GetNext()) {
+        Values v = base;
+        Walk(c, v, entry);
+    }
+
+    values = base;
+}
+
+
+void ConstPropagator::Substitute(Expr *e, const Values &values)
+{
+    if (AtomExpr *atom = dynamic_cast<AtomExpr*>(e)) {
+        Values::const_iterator i = values.find(atom->GetLValue());
+        if (i != values.end())
+            atom->SetConstant(i->second);
+        return;
+    }
+
+    int n = e->GetExprCount();
+    for(int i=0; i<n; ++i)
+        Substitute(e->GetExpr(i), values);
+}
+
+
+void ConstPropagator::Kill(Values &values, const vector<const Expr*> &writes)
+{
+    Values::iterator i = values.begin();
+
+    while(i != values.end()) {
+        bool written = false;
+        for(size_t j=0; j<writes.size() && !written; ++j)
+            written = writes[j]->Contains(i->first);
+
+        if (written)
+            values.erase(i++);
+        else
+            ++i;
+    }
+}
+
+
+bool ConstPropagator::Finder::operator()(Stmt *s)
+{
+    if (dynamic_cast<GotoStmt*>(s) || dynamic_cast<LabelStmt*>(s))
+        fUnsafe = true;
+
+    if (DeclareStmt *ds = dynamic_cast<DeclareStmt*>(s)) {
+        int var = ds->GetVar();
+        if ((var & kVirtualVarBase) && ds->GetCount() == 1 &&
+            !ds->GetPointer())
+            fTracked.insert(var);
+    }
+
+    // a case label that isn't in a list of statements could be
+    // jumped to from the middle of a loop or if
+    if (CaseStmt *cs = dynamic_cast<CaseStmt*>(s)) {
+        Stmt *p = cs->GetParent();
+        while(p && (dynamic_cast<BlockStmt*>(p) ||
+                    dynamic_cast<ScopeStmt*>(p) ||
+                    dynamic_cast<CaseStmt*>(p)))
+            p = p->GetParent();
+
+        if (!dynamic_cast<SwitchStmt*>(p))
+            fUnsafe = true;
+    }
+
+    int n = s->GetExprCount();
+    for(int i=0; i<n; ++i)
+        Apply(s->GetExpr(i), *this);
+
+    return !fUnsafe;
+}
+
+
+bool ConstPropagator::Finder::operator()(Expr *e)
+{
+    if (dynamic_cast<AddrOfExpr*>(e) || dynamic_cast<DerefExpr*>(e))
+        fUnsafe = true;
+
+    return !fUnsafe;
+}
+
+
+bool ConstPropagator::Writes::operator()(Stmt *s)
+{
+    if (dynamic_cast<GosubParamStmt*>(s)) {
+        fUnknown = true;
+        return false;
+    }
+
+    int n = s->GetExprCount();
+
+    // asm can only name locals through its expressions, and only
+    // the fields that take a constant are sure to be read
+    if (AsmStmt *a = dynamic_cast<AsmStmt*>(s)) {
+        for(int i=0; i<n; ++i)
+            if (!a->GetField(i)->AcceptsConstant())
+                fWrites.push_back(s->GetExpr(i));
+    }
+
+    if (AssignStmt *a = dynamic_cast<AssignStmt*>(s)) {
+        const Expr *lval = a->GetLval();
+        if (lval->GetLValue() == kIllegalVar) {
+            fUnknown = true;
+            return false;
+        }
+
+        fWrites.push_back(lval);
+    }
+
+    for(int i=0; i<n; ++i)
+        FindIncDecs(s->GetExpr(i));
+
+    return true;
+}
+
+
+void ConstPropagator::Writes::FindIncDecs(Expr *e)
+{
+    if (dynamic_cast<IncDecExpr*>(e))
+        fWrites.push_back(e);
+
+    int n = e->GetExprCount();
+    for(int i=0; i<n; ++i)
+        FindIncDecs(e->GetExpr(i));
+}
@@ -0,0 +1,61 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __ConstPropagator_h
+#define __ConstPropagator_h
+
+#include <map>
+#include <set>
+#include <vector>
+
+using std::map;
+using std::set;
+using std::vector;
+
+class Stmt;
+class Expr;
+
+/**
+ * Replaces reads of a fragment's variables with the constants they
+ * are known to hold, so that folding can see them.  The statements
+ * are walked in order, and an assignment of a constant is known until
+ * the variable is written again.  A loop, if, switch or any other
+ * statement with more than one way through starts with only what none
+ * of its statements can change, and leaves with the same.
+ *
+ * Only the variables the fragment declares are tracked, since other
+ * tasks can change globals at any time.  A fragment with gotos, or
+ * that takes the address of anything, is left alone.
+ */
+class ConstPropagator
+{
+public:
+    void    Propagate(Stmt *body);
+
+private:
+    class Finder;
+    class Writes;
+
+    typedef map<int, int> Values;   // var -> the constant it holds
+
+    void    Walk(Stmt *s, Values &values, const Values &entry);
+    void    WalkLeaf(Stmt *s, Values &values);
+    void    WalkCompound(Stmt *s, Values &values);
+
+    static void Substitute(Expr *e, const Values &values);
+    static void Kill(Values &values, const vector<const Expr*> &writes);
+
+    set<int>    fTracked;
+};
+
+#endif
@@ -12,6 +12,7 @@
  *
  */
 #include "DerefExpr.h"
+#include "VarTranslator.h"
 #include "Variable.h"
 #include "Mapping.h"
 #include "Bytecode.h"
@@ -39,6 +40,14 @@ bool DerefExpr::Evaluate(int &) const
 }
 
 
+bool DerefExpr::Matches(const Expr *e) const
+{
+        const DerefExpr *d = dynamic_cast<const DerefExpr*>(e);
+
+        return d && d->fValue == fValue;
+}
+
+
 bool DerefExpr::Contains(int var) const
 {
         return (fValue==var);
@@ -69,10 +78,9 @@ RCX_Value DerefExpr::EmitAny_(Bytecode &) const
 }
 
 
-void DerefExpr::Translate(int from, int to)
+void DerefExpr::Translate(const VarTranslator &vt)
 {
-        if (fValue == from)
-                fValue = to;
+        fValue = vt.Translate(fValue);
 }
 
 
@@ -19,11 +19,7 @@
 #include "Expr.h"
 #endif
 
-#ifndef __VarTranslator_h
-#include "VarTranslator.h"
-#endif
-
-class DerefExpr : public Expr, public Translatable
+class DerefExpr : public Expr
 {
 public:
         DerefExpr(int value, const LexLocation &loc);
@@ -32,6 +28,7 @@ public:
 
         virtual bool		Evaluate(int &value) const;
         virtual Expr*		Clone(Mapping *b) const;
+        virtual bool		Matches(const Expr *e) const;
 
         virtual bool		PotentialLValue() const;
         virtual int		GetLValue() const;
@@ -40,7 +37,7 @@ public:
         virtual RCX_Value	EmitAny_(Bytecode &b) const;
         virtual RCX_Value	GetStaticEA_() const;
 
-        void			Translate(int from, int to);
+        void			Translate(const VarTranslator &vt);
 private:
         int			fValue;
 };
@@ -14,6 +14,7 @@
 #include "DoStmt.h"
 #include "Bytecode.h"
 #include "JumpStmt.h"
+#include "LoopHoister.h"
 
 DoStmt::DoStmt(Expr *c, Stmt *s) :
 	ChainStmt(s)
@@ -24,7 +25,7 @@ DoStmt::DoStmt(Expr *c, Stmt *s) :
 
 DoStmt::~DoStmt()
 {
-	delete fCondition;
+	Expr::Release(fCondition);
 }
 
 
@@ -38,6 +39,10 @@ void DoStmt::EmitActual(Bytecode &b)
 	 bLabel:
 	*/
 
+	LoopHoister hoister(b, this);
+	hoister.Hoist(GetBody());
+	hoister.Hoist(fCondition);
+
 	int cLabel = b.PushFlow(Bytecode::kContinueFlow);
 	int bLabel = b.PushFlow(Bytecode::kBreakFlow);
 	int sLabel = b.NewLabel();
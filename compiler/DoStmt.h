@@ -31,7 +31,8 @@ public:
 	void	EmitActual(Bytecode &b);
 	Stmt*	CloneActual(Mapping *b) const;
 
-	virtual void	GetExprs(vector<Expr*> & v) const	{ v.push_back(fCondition); }
+	virtual int	GetExprCount() const	{ return 1; }
+	virtual Expr*	GetExpr(int) const	{ return fCondition; }
 
 private:
 	Expr*	fCondition;
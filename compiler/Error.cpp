@@ -16,6 +16,7 @@
 #include "Buffer.h"
 #include "Error.h"
 #include "LexLocation.h"
+#include "CompileContext.h"
 
 using std::sprintf;
 
@@ -92,6 +93,10 @@ static const char *sErrorText[] = {
 
         "cannot take the address of an array with a non-constant index",
 
+	"\'%s\' is declared but not defined",
+	"%s cannot be compiled into an object",
+	"compile needs more than the memory limit of %d KB",
+
 	// catch-all for things in progress
 	"%s is not yet supported",
 
@@ -101,9 +106,6 @@ static const char *sErrorText[] = {
 	"preprocessor #warning directive",
 };
 
-ErrorHandler* ErrorHandler::sErrorHandler = 0;
-
-
 void Error::RaiseLex() const
 {
 	LexLocation loc;
@@ -137,6 +139,18 @@ void Error::SPrint(char *str) const
 }
 
 
+ErrorHandler::ErrorHandler()
+{
+	CompileContext::Get()->fErrorHandler = this;
+}
+
+
+ErrorHandler* ErrorHandler::Get()
+{
+	return CompileContext::Get()->fErrorHandler;
+}
+
+
 void ErrorHandler::Reset()
 {
 	fErrorCount = 0;
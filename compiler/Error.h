@@ -88,6 +88,10 @@ enum ErrorCode {
 
     kErr_AddrOfNonConstantIndex,
 
+    kErr_DeclaredOnly,
+    kErr_NotRelocatable,
+    kErr_MemoryLimit,
+
     // catch-all for things in progress
     kErr_NotSupported,
 
@@ -139,17 +143,19 @@ public:
 
     virtual void ClearErrors();
     virtual void AddError(const Error &e, const LexLocation *loc) = 0;
+    /// report anything AddError() has held back; the compiler calls
+    /// this at the end of each compile, while the source is still there
+    virtual void Flush() {}
 
-    static ErrorHandler* Get() { return sErrorHandler; }
+    // the handler registered with the current CompileContext
+    static ErrorHandler* Get();
 
 protected:
-    ErrorHandler() { sErrorHandler = this; }
+    ErrorHandler();
 
 private:
     int fErrorCount;
     int fWarningCount;
-
-    static ErrorHandler* sErrorHandler;
 };
 
 #endif
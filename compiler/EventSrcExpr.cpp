@@ -21,7 +21,10 @@ static int ConvertSpyboticsSource(int type, int data);
 
 Expr* EventSrcExpr::Clone(Mapping *b) const
 {
-    return new EventSrcExpr(Get(0)->Clone(b), fTargetType);
+    Expr *e[1];
+
+    if (CloneExprs(b, e)) return Share();
+    return new EventSrcExpr(e[0], fTargetType);
 }
 
 
@@ -11,80 +11,89 @@
  * All Rights Reserved.
  *
  */
-#include <cstring>
 #include "Expansion.h"
 #include "Macro.h"
 #include "parser.h"
 #include "Symbol.h"
 
-using std::memcpy;
+Expansion::Expansion() :
+	fDef(nil),
+	fArena(nil),
+	fTokens(nil),
+	fPos(0),
+	fEnd(0),
+	fArgCount(0),
+	fFirstArg(0)
+{
+}
+
 
-Expansion::Expansion(Macro *def)
+Expansion::~Expansion()
+{
+	End();
+}
+
+
+void Expansion::BeginMacro(Macro *def, ExpansionArena *arena, int firstArg)
 {
 	fDef = def;
 	fDef->SetMark();
+	fArena = arena;
 	fTokens = def->GetTokens();
-	fEnd = fTokens + def->GetTokenCount();
+	fPos = 0;
+	fEnd = def->GetTokenCount();
 	fArgCount = def->GetArgCount();
-	if (fArgCount > 0)
-	{
-		fArgs = new Token*[fArgCount];
-		fArgLengths = new int[fArgCount];
-		for(int i=0; i<fArgCount; i++)
-		{
-			fArgs[i] = nil;
-			fArgLengths[i] = 0;
-		}
-	}
-	else
-	{
-		fArgs = nil;
-		fArgLengths = nil;
-	}
+	fFirstArg = firstArg;
+}
+
+
+void Expansion::BeginArg(const Expansion *e, int i)
+{
+	const int *span = &e->fArena->fSpans[e->fFirstArg + 2*i];
+
+	fDef = nil;
+	fArena = e->fArena;
+	fTokens = nil;
+	fPos = span[0];
+	fEnd = span[0] + span[1];
+	fArgCount = 0;
+	fFirstArg = 0;
 }
 
 
-Expansion::Expansion(const Expansion *e, int i)
+void Expansion::BeginTokens(ExpansionArena *arena, int start, int count)
 {
 	fDef = nil;
-	fTokens = e->fArgs[i];
-	fEnd = fTokens + e->fArgLengths[i];
+	fArena = arena;
+	fTokens = nil;
+	fPos = start;
+	fEnd = start + count;
 	fArgCount = 0;
-	fArgs = nil;
-	fArgLengths = nil;
+	fFirstArg = 0;
 }
 
 
-Expansion::~Expansion()
+void Expansion::End()
 {
 	if (fDef) fDef->ClearMark();
-	if (fArgs)
-	{
-		for(int i=0; i<fArgCount; i++)
-			delete [] fArgs[i];
-		delete [] fArgs;
-	}
-	delete [] fArgLengths;
+	fDef = nil;
 }
 
 
 int Expansion::NextToken(TokenVal &v)
 {
-	int t;
-
-	t = fTokens->fType;
-	v = fTokens->fValue;
+	const Token *t = fTokens ? fTokens + fPos : &fArena->fTokens[fPos];
 
-	fTokens++;
-	return t;
+	v = t->fValue;
+	fPos++;
+	return t->fType;
 }
 
 
-void Expansion::SetArg(int i, const Token *t, int count)
+void Expansion::SetArg(int i, int start, int count)
 {
-	Token *tokens = new Token[count];
-	memcpy(tokens, t, count * sizeof(Token));
+	int *span = &fArena->fSpans[fFirstArg + 2*i];
 
-	fArgs[i] = tokens;
-	fArgLengths[i] = count;
+	span[0] = start;
+	span[1] = count;
 }
@@ -22,27 +22,60 @@
 #include "PListS.h"
 #endif
 
+#include <vector>
+
+using std::vector;
+
 class Macro;
 
+/*
+ * The arguments of all active expansions share one arena: their tokens
+ * are appended to fTokens, and each argument is a (start, length) pair
+ * in fSpans.  The arena only grows while expansions are active, so it
+ * is referred to by index rather than by pointer.
+ */
+struct ExpansionArena
+{
+	vector<Token>	fTokens;
+	vector<int>		fSpans;
+
+	void		Clear()	{ fTokens.resize(0); fSpans.resize(0); }
+};
+
+
+/*
+ * An expansion plays back either the body of a macro or one of the
+ * arguments of another expansion.  Expansions are reused, so they are
+ * set up by BeginMacro() or BeginArg() and finished by End() rather
+ * than by their constructor and destructor.
+ */
 class Expansion : public PLinkS<Expansion> {
 public:
-				Expansion(Macro *def);
-				Expansion(const Expansion *e, int i);
-
+				Expansion();
 				~Expansion();
 
+	/// play back def, with its arguments starting at span firstArg
+	void		BeginMacro(Macro *def, ExpansionArena *arena, int firstArg);
+	/// play back argument i of e
+	void		BeginArg(const Expansion *e, int i);
+	/// play back count tokens of the arena, starting at start
+	void		BeginTokens(ExpansionArena *arena, int start, int count);
+	void		End();
+
 	int			NextToken(TokenVal &v);
-	bool		IsDone() const	{ return fTokens==fEnd; }
+	bool		IsDone() const	{ return fPos==fEnd; }
 	int			GetArgCount() const { return fArgCount; }
-	void		SetArg(int i, const Token *t, int count);
+	/// record that argument i is the count tokens starting at start
+	void		SetArg(int i, int start, int count);
 
 private:
-	Macro*	fDef;
-	const Token*	fTokens;
-	const Token*	fEnd;
-	int			fArgCount;
-	Token**		fArgs;
-	int*		fArgLengths;
+	Macro*			fDef;
+	ExpansionArena*	fArena;
+	const Token*	fTokens;	// macro body, or 0 for an argument
+	int				fPos;
+	int				fEnd;
+	int				fArgCount;
+	int				fFirstArg;
 };
 
 
@@ -12,14 +12,12 @@
  *
  */
 #include "Expr.h"
+#include "Stmt.h"
 #include "RCX_Cmd.h"
 #include "Bytecode.h"
 #include "Error.h"
 #include "RCX_Target.h"
 
-#define MAX_INT 65535
-#define MIN_INT -32768
-
 // suitable sources for math operations (if target has constrained math)
 #define MATH_MASK   (TYPEMASK(kRCX_VariableType) + \
                     TYPEMASK(kRCX_ConstantType))
@@ -32,13 +30,30 @@ Expr::~Expr()
 }
 
 
+void Expr::Release(Expr *e)
+{
+    if (e && e->fShares)
+        --e->fShares;
+    else
+        delete e;
+}
+
+
+void Expr::GetExprs(vector<Expr*> &v) const
+{
+    int n = GetExprCount();
+    for(int i=0; i<n; ++i)
+        v.push_back(GetExpr(i));
+}
+
+
 RCX_Value Expr::EmitAny(Bytecode &b) const
 {
     int v;
 
     if (Evaluate(v)) {
-        if (v < MIN_INT || v > MAX_INT)
-            Error(kErr_NumberRange).Raise(&fLoc);
+        if (v < kMinConstant || v > kMaxConstant)
+            Error(kErr_NumberRange).Raise(&GetLoc());
 
         return RCX_VALUE(kRCX_ConstantType, v);
     }
@@ -181,10 +196,9 @@ bool Expr::EmitTo_(Bytecode &b, int dst) const
 
 bool Expr::EmitSide_(Bytecode &b) const
 {
-    vector<Expr *> v;
-    GetExprs(v);
-    for(int i=0; i<(int)v.size(); ++i)
-        if (!v[i]->EmitSide(b)) return false;
+    int n = GetExprCount();
+    for(int i=0; i<n; ++i)
+        if (!GetExpr(i)->EmitSide(b)) return false;
 
     return true;
 }
@@ -270,3 +284,13 @@ int Expr::GetTempVar(Bytecode &b, bool canUseLocals) const
 
     return var;
 }
+
+
+bool Expr::Folder::operator()(Stmt *s)
+{
+    int n = s->GetExprCount();
+    for(int i=0; i<n; ++i)
+        s->GetExpr(i)->Fold();
+
+    return true;
+}
@@ -30,6 +30,10 @@
 #include "LexLocation.h"
 #endif
 
+#ifndef __LocationTable_h
+#include "LocationTable.h"
+#endif
+
 #include <vector>
 
 using std::vector;
@@ -37,6 +41,8 @@ using std::vector;
 class Bytecode;
 class Mapping;
 class RCX_Target;
+class Stmt;
+class VarTranslator;
 
 /**
  * The Expr class is the base class for expressions.  It declares
@@ -51,11 +57,17 @@ public:
 		kIllegalEA = -1
 	};
 
-			Expr(const LexLocation &loc) : fLoc(loc) {}
+	// range of a constant operand
+	enum {
+		kMinConstant = -32768,
+		kMaxConstant = 65535
+	};
+
+			Expr(const LexLocation &loc) : fLoc(LocationTable::Get().Add(loc)), fShares(0) {}
 	virtual	~Expr() = 0;
 
-	const LexLocation&	GetLoc() const { return fLoc; }
-	void				SetLoc(const LexLocation &loc)	{ fLoc = loc; }
+	const LexLocation&	GetLoc() const { return LocationTable::Get().GetLocation(fLoc); }
+	void				SetLoc(const LexLocation &loc)	{ fLoc = LocationTable::Get().Add(loc); }
 
     /*
      * Used to clone an expression while making
@@ -64,8 +76,42 @@ public:
      */
 	virtual Expr*		Clone(Mapping *) const = 0;
 
+    /*
+     * With a mapping, Clone() shares the sub-expressions that hold no
+     * variables instead of copying them, so an expression can have
+     * several owners.  Share() adds one, and Release() drops one,
+     * deleting the expression along with the last.  Apart from Fold(),
+     * which doesn't change what they mean, and the replacements that
+     * ExprSharer and LoopHoister undo once the code is emitted, shared
+     * expressions are left as they are.
+     */
+	Expr*				Share() const	{ ++fShares; return const_cast<Expr*>(this); }
+	static void			Release(Expr *e);
+
 	virtual bool		Evaluate(int & /*value */) const	{ return false; }
 
+    /*
+     * Replace constant sub-expressions with AtomExprs.  Emitting
+     * calls Evaluate() at every level of an expression, so folding
+     * once when the tree is final (after inline expansion and task
+     * id patching) saves re-evaluating the same subtrees, and lets
+     * nodes combine constants that are split across them.  Returns
+     * true if the expression is pure arithmetic, in which case a
+     * parent may replace it by its value.  Some Evaluate() methods
+     * raise errors, so only pure expressions are evaluated here.
+     */
+	virtual bool		Fold()	{ return false; }
+
+	/// Apply() functor that folds the expressions of each statement
+	class Folder
+	{
+	public:
+		bool	operator()(Stmt *s);
+	};
+
+	/// True if e is the same arithmetic as this one (see ExprSharer)
+	virtual bool		Matches(const Expr * /* e */) const	{ return false; }
+
     /*
      * Determine if an expression is
      * a potential candidate as an LValue.  This does not guarantee
@@ -84,8 +130,15 @@ public:
 	virtual bool		Contains(int /* var */) const { return false; }
         virtual bool            LValueIsPointer() const { return false; }
 
+	/// Replace the variables the translator maps (see VarTranslator)
+	virtual void		Translate(const VarTranslator & /* vt */) { }
+
+	/// The sub-expressions, which can be walked without allocating
+	virtual int			GetExprCount() const	{ return 0; }
+	virtual Expr*		GetExpr(int /* i */) const	{ return 0; }
+
 	/// Append sub-expressions into vector
-	virtual void		GetExprs(vector<Expr*> & /* v */) const { }
+	void				GetExprs(vector<Expr*> &v) const;
 
 	// calls to emit code
 	RCX_Value	EmitAny(Bytecode &b) const;
@@ -116,7 +169,8 @@ protected:
 	int GetTempVar(Bytecode &b, bool canUseLocals=true) const;
 
 private:
-	LexLocation		fLoc;
+	int				fLoc;	// index in the LocationTable
+	mutable int		fShares;	// owners besides the first
 };
 
 
@@ -133,12 +187,9 @@ private:
 template <class OP> void Apply(Expr *base, OP &op)
 {
 	if (op(base)) {
-		vector<Expr*> v;
-		base->GetExprs(v);
-
-		int n = v.size();
+		int n = base->GetExprCount();
 		for (int i=0; i<n; ++i)
-			Apply(v[i], op);
+			Apply(base->GetExpr(i), op);
 	}
 }
 
@@ -0,0 +1,207 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include "ExprSharer.h"
+#include "Bytecode.h"
+#include "Stmt.h"
+#include "AtomExpr.h"
+#include "BinaryExpr.h"
+#include "IncDecExpr.h"
+#include "LogicalExpr.h"
+#include "ModExpr.h"
+#include "NegateExpr.h"
+#include "ShiftExpr.h"
+#include "TernaryExpr.h"
+#include "UnaryExpr.h"
+#include "Program.h"
+
+// a shared value holds a var for the whole statement, so only a
+// few are shared, and only while there are vars to spare
+#define kMaxShared      4
+#define kMinFreeVars    4
+
+
+ExprSharer::ExprSharer(Bytecode &b, Stmt *s) :
+    fBytecode(b),
+    fUnknown(false)
+{
+    if (gProgram->GetOptimize() < Program::kFullOptimize) return;
+
+    vector<Expr*> exprs;
+    s->GetExprs(exprs);
+
+    for(size_t i=0; i<exprs.size(); ++i)
+        FindUses(exprs[i], true);
+
+    if (fUnknown) return;
+
+    // earlier copies hold the later ones, so the largest shared
+    // expressions are found first
+    for(size_t i=0; i<fUses.size() && fShared.size() < kMaxShared; ++i)
+        Share(i);
+}
+
+
+ExprSharer::~ExprSharer()
+{
+    for(size_t i=fShared.size(); i>0; --i) {
+        Shared &s = fShared[i-1];
+
+        s.fParent->Replace(s.fVar, s.fExpr);
+        delete s.fVar;
+    }
+
+    // every copy of a value holds the same var
+    for(size_t i=0; i<fVars.size(); ++i)
+        fBytecode.GetVarAllocator().Release(fVars[i]);
+}
+
+
+void ExprSharer::FindUses(Expr *e, bool always)
+{
+    if (dynamic_cast<IncDecExpr*>(e)) {
+        fUnknown = true;
+        return;
+    }
+
+    NodeExpr *node = dynamic_cast<NodeExpr*>(e);
+    if (!node) return;
+
+    // only the first operand of && || and ?: is always computed
+    bool conditional = dynamic_cast<LogicalExpr*>(e) || dynamic_cast<TernaryExpr*>(e);
+
+    vector<Expr*> children;
+    node->GetExprs(children);
+
+    for(size_t i=0; i<children.size(); ++i) {
+        Expr *c = children[i];
+        bool a = always && (i == 0 || !conditional);
+
+        if (!IsShareable(c)) {
+            FindUses(c, a);
+            continue;
+        }
+
+        size_t index = fUses.size();
+        Use u;
+        u.fParent = node;
+        u.fExpr = c;
+        u.fAlways = a;
+        fUses.push_back(u);
+
+        FindUses(c, a);
+        fUses[index].fEnd = fUses.size();
+    }
+}
+
+
+bool ExprSharer::IsShareable(const Expr *e) const
+{
+    int v;
+
+    // atoms and constants don't need computing
+    if (e->GetStaticEA() != Expr::kIllegalEA || e->Evaluate(v))
+        return false;
+
+    return IsStable(e);
+}
+
+
+bool ExprSharer::IsStable(const Expr *e) const
+{
+    if (dynamic_cast<const AtomExpr*>(e)) {
+        RCX_Value ea = e->GetStaticEA();
+
+        switch(RCX_VALUE_TYPE(ea)) {
+            case kRCX_ConstantType:
+                return true;
+            case kRCX_VariableType:
+                return !(RCX_VALUE_DATA(ea) & kVirtualVarBase);
+            case kRCX_TimerType:
+            case kRCX_TenMSTimerType:
+            case kRCX_InputValueType:
+            case kRCX_InputRawType:
+            case kRCX_InputBooleanType:
+            case kRCX_EventStateType:
+            case kRCX_CounterType:
+            case kRCX_ClickCounterType:
+            case kRCX_MessageType:
+                return !gProgram->GetVolatileSources();
+            default:
+                return false;
+        }
+    }
+
+    if (!dynamic_cast<const BinaryExpr*>(e) &&
+        !dynamic_cast<const NegateExpr*>(e) &&
+        !dynamic_cast<const UnaryExpr*>(e) &&
+        !dynamic_cast<const ShiftExpr*>(e) &&
+        !dynamic_cast<const ModExpr*>(e))
+        return false;
+
+    vector<Expr*> children;
+    e->GetExprs(children);
+
+    for(size_t i=0; i<children.size(); ++i)
+        if (!IsStable(children[i])) return false;
+
+    return true;
+}
+
+
+void ExprSharer::Share(size_t first)
+{
+    Use &u = fUses[first];
+    if (!u.fExpr || !u.fAlways) return;
+
+    vector<size_t> copies;
+    copies.push_back(first);
+    for(size_t i=u.fEnd; i<fUses.size(); ++i) {
+        if (fUses[i].fExpr && u.fExpr->Matches(fUses[i].fExpr)) {
+            copies.push_back(i);
+            i = fUses[i].fEnd - 1;
+        }
+    }
+
+    if (copies.size() < 2) return;
+
+    VarAllocator &allocator = fBytecode.GetVarAllocator();
+    if (allocator.GetFreeCount() <= kMinFreeVars) return;
+
+    // allocate it like a local so the statement's code doesn't mistake
+    // it for a temp it may overwrite
+    int var = allocator.Allocate(false, true, 1);
+    if (var == kIllegalVar) return;
+
+    if (!allocator.IsLocal(var) || !u.fExpr->EmitTo(fBytecode, var)) {
+        allocator.Release(var);
+        return;
+    }
+
+    fVars.push_back(var);
+
+    for(size_t i=0; i<copies.size(); ++i) {
+        Use &c = fUses[copies[i]];
+
+        Shared s;
+        s.fParent = c.fParent;
+        s.fExpr = c.fExpr;
+        s.fVar = new AtomExpr(kRCX_VariableType, var, c.fExpr->GetLoc());
+        c.fParent->Replace(c.fExpr, s.fVar);
+        fShared.push_back(s);
+
+        // the copy and what is inside it are done
+        for(size_t j=copies[i]; j<c.fEnd; ++j)
+            fUses[j].fExpr = 0;
+    }
+}
@@ -0,0 +1,75 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __ExprSharer_h
+#define __ExprSharer_h
+
+#include <cstddef>
+#include <vector>
+
+using std::size_t;
+using std::vector;
+
+class Bytecode;
+class Stmt;
+class Expr;
+class NodeExpr;
+
+/**
+ * Computes arithmetic that a statement does more than once into a
+ * var before the statement, and uses the var instead.  A statement
+ * that evaluates its expressions once creates one at the start of
+ * EmitActual(), and the original expressions are put back when it
+ * goes out of scope.
+ *
+ * Only arithmetic on constants and variables is shared, plus sensor,
+ * timer and event state reads after '#pragma nonvolatile'.  Random
+ * numbers are never shared, and a statement with ++ or -- in it is
+ * left alone.  The first copy must be computed whatever the outcome
+ * of && || and ?:, so sharing never adds work.
+ */
+class ExprSharer
+{
+public:
+            ExprSharer(Bytecode &b, Stmt *s);
+            ~ExprSharer();
+
+private:
+    struct Use
+    {
+        NodeExpr*   fParent;
+        Expr*       fExpr;
+        bool        fAlways;    // computed whatever && || ?: do
+        size_t      fEnd;       // the first use after this one's inside
+    };
+
+    struct Shared
+    {
+        NodeExpr*   fParent;
+        Expr*       fExpr;
+        Expr*       fVar;
+    };
+
+    void    FindUses(Expr *e, bool always);
+    bool    IsShareable(const Expr *e) const;
+    bool    IsStable(const Expr *e) const;
+    void    Share(size_t first);
+
+    Bytecode&       fBytecode;
+    vector<Use>     fUses;
+    vector<Shared>  fShared;
+    vector<int>     fVars;
+    bool            fUnknown;
+};
+
+#endif
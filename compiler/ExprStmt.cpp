@@ -25,7 +25,7 @@ ExprStmt::ExprStmt(Expr * value)
 
 ExprStmt::~ExprStmt()
 {
-	delete fValue;
+	Expr::Release(fValue);
 }
 
 
@@ -39,11 +39,3 @@ Stmt* ExprStmt::CloneActual(Mapping *b) const
 {
 	return new ExprStmt(fValue->Clone(b));
 }
-
-
-void ExprStmt::GetExprs(vector<Expr *> &v) const
-{
-	v.push_back(fValue);
-}
-
-
@@ -28,7 +28,8 @@ public:
 
 	void		EmitActual(Bytecode &b);
 	Stmt*		CloneActual(Mapping *b) const;
-	virtual void	GetExprs(vector<Expr*> & v) const;
+	virtual int	GetExprCount() const	{ return 1; }
+	virtual Expr*	GetExpr(int) const	{ return fValue; }
 
 private:
 	Expr*		fValue;
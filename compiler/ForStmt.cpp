@@ -12,7 +12,9 @@
  *
  */
 #include "ForStmt.h"
+#include "JumpStmt.h"
 #include "Bytecode.h"
+#include "LoopHoister.h"
 
 
 ForStmt::ForStmt(Stmt *init, Expr *c, Stmt *iterate, Stmt *body) :
@@ -37,7 +39,7 @@ ForStmt::ForStmt(Stmt *init, Expr *c, Stmt *iterate, Stmt *body) :
 ForStmt::~ForStmt()
 {
     delete fInit;
-    delete fCondition;
+    Expr::Release(fCondition);
     delete fIterate;
     delete fBody;
 }
@@ -56,6 +58,14 @@ void ForStmt::EmitActual(Bytecode &b)
         break:
     */
 
+    // init only runs once, so it doesn't need hoisting
+    LoopHoister hoister(b, this);
+    if (fCondition)
+        hoister.Hoist(fCondition);
+    hoister.Hoist(fBody);
+    if (fIterate)
+        hoister.Hoist(fIterate);
+
     if (fInit)
         fInit->Emit(b);
 
@@ -88,3 +98,15 @@ Stmt* ForStmt::CloneActual(Mapping *b) const
         fIterate ? fIterate->Clone(b) : 0,
         fBody->Clone(b));
 }
+
+
+bool ForStmt::FallsThrough()
+{
+    int value;
+
+    // for(;;) only ends with a break
+    if (!fCondition || (fCondition->Evaluate(value) && value))
+        return JumpStmt::ContainsBreak(fBody);
+
+    return true;
+}
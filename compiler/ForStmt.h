@@ -30,10 +30,12 @@ public:
                     ~ForStmt();
 
     virtual Stmt*   GetChildren()                       { return fChildren.GetHead(); }
-    virtual void    GetExprs(vector<Expr*> & v) const   { if (fCondition) v.push_back(fCondition); }
+    virtual int     GetExprCount() const    { return fCondition ? 1 : 0; }
+    virtual Expr*   GetExpr(int) const      { return fCondition; }
 
     virtual void    EmitActual(Bytecode &b);
     virtual Stmt*   CloneActual(Mapping *b) const;
+    virtual bool    FallsThrough();
 
 
 private:
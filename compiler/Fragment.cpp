@@ -21,6 +21,8 @@
 #include "DeclareStmt.h"
 #include "TaskIdExpr.h"
 #include "GotoStmt.h"
+#include "InlineStmt.h"
+#include "ConstPropagator.h"
 
 #ifdef DEBUG
 //#ifdef __MWERKS__
@@ -34,9 +36,11 @@
 Fragment::Fragment(bool isTask, Symbol *name, Stmt *body)
 {
     fIsTask = isTask;
+    fDeclaration = false;
     fName = name;
     fBody = body;
 
+    fFunction = 0;
     fNumber = gProgram->AddFragment(this);
     fTaskID = isTask ? fNumber : kNoTaskID;
 
@@ -44,7 +48,7 @@ Fragment::Fragment(bool isTask, Symbol *name, Stmt *body)
     fEnd.fIndex = kIllegalSrcIndex;
 }
 
-Fragment::Fragment(bool isTask) : fName(0), fBody(0)
+Fragment::Fragment(bool isTask) : fDeclaration(false), fName(0), fBody(0), fTaskID(kNoTaskID), fFunction(0)
 {
         fIsTask = isTask;
 
@@ -53,6 +57,40 @@ Fragment::Fragment(bool isTask) : fName(0), fBody(0)
 }
 
 
+Fragment::Fragment(bool isTask, Symbol *name, int number)
+{
+    fIsTask = isTask;
+    fDeclaration = true;
+    fName = name;
+    fBody = 0;
+    fNumber = number;
+    fTaskID = isTask ? number : kNoTaskID;
+    fLocalMask = 0;
+    fFunction = 0;
+
+    fStart.fIndex = kIllegalSrcIndex;
+    fEnd.fIndex = kIllegalSrcIndex;
+}
+
+
+Fragment::Fragment(FunctionDef *func)
+{
+    // the InlineStmt gives return a target and lists the source
+    // just like an inlined copy would
+    fIsTask = false;
+    fDeclaration = false;
+    fName = const_cast<Symbol *>(func->GetName());
+    fBody = new InlineStmt(func->GetBody()->Clone(0), func);
+    fFunction = func;
+
+    fNumber = gProgram->AddFragment(this);
+    fTaskID = kNoTaskID;
+
+    fStart.fIndex = kIllegalSrcIndex;
+    fEnd.fIndex = kIllegalSrcIndex;
+}
+
+
 Fragment::~Fragment()
 {
     delete fBody;
@@ -158,6 +196,17 @@ void Fragment::Emit(Bytecode &b)
     TaskIdExpr::Patcher p(fTaskID);
     Apply(fBody, p);
 
+    // the expressions are final now, so the values known to be in
+    // vars can be put in them, and constants can be folded
+    if (gProgram->GetOptimize() >= Program::kFullOptimize) {
+        ConstPropagator cp;
+        cp.Propagate(fBody);
+    }
+
+    if (gProgram->GetOptimize() >= Program::kBasicOptimize) {
+        Expr::Folder f;
+        Apply(fBody, f);
+    }
 
     // resolve gotos - must be done in Emit() rather than
     // Check() since bytecode labels need to be generated
@@ -170,8 +219,8 @@ void Fragment::Emit(Bytecode &b)
     b.SetLabel(rLabel);
     b.PopFlow(Bytecode::kReturnFlow);
 
-    b.ApplyFixups();
-
+    // the caller applies the fixups, which moves this tag to the end
+    // of the optimized code
     b.AddSourceTag(RCX_SourceTag::kEnd, fEnd);
 }
 
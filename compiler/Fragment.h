@@ -56,6 +56,10 @@ public:
 
         Fragment(bool isTask, Symbol *name, Stmt *body);
         Fragment(bool isTask);
+	// a declaration of a task or sub defined elsewhere (see Program::DeclareFragment)
+	Fragment(bool isTask, Symbol *name, int number);
+	// a sub made from an inline function (see Program::OutlineFunctions)
+	Fragment(FunctionDef *func);
 	~Fragment();
 
         bool		AddArg(const Symbol *name, FunctionDef::ArgType type);
@@ -65,6 +69,8 @@ public:
         int		GetArgVar(int i) const	{ return fArgs[i].fVar; }
 
 	void		SetLocations(LocationNode *start, LocationNode *end);
+	const LexLocation& GetStartLoc() const	{ return fStart; }
+	const LexLocation& GetEndLoc() const	{ return fEnd; }
 
         void		CreateArgVars();
 
@@ -72,6 +78,7 @@ public:
         void		SetName(Symbol *name);
 	Symbol*		GetName() const		{ return fName; }
 	bool		IsTask() const		{ return fIsTask; }
+	bool		IsDeclaration() const	{ return fDeclaration; }
 	RCX_ChunkType	GetChunkType() const	{ return fIsTask ? kRCX_TaskChunk : kRCX_SubChunk; }
 	int		GetTaskID() const	{ return fTaskID; }
         void		SetBody(Stmt *stmt);
@@ -80,7 +87,9 @@ public:
 	void		SetLocalMask(int m)	{ fLocalMask = m; }
 
 	void		SetNumber(int n)	{ fNumber = n; }
+	FunctionDef*	GetFunction() const	{ return fFunction; }
 	void		AssignTaskID(int n);	// only affects kRCX_SubFragment types
+	void		RestoreTaskID(int n)	{ fTaskID = n; }
 
 	void		Emit(Bytecode &b);
 	void		Check();
@@ -95,11 +104,13 @@ private:
 
         vector<Arg>	fArgs;
 	bool		fIsTask;
+	bool		fDeclaration;
 	Symbol*		fName;
 	Stmt*		fBody;
 	int		fNumber;
 	int		fTaskID;
 	int		fLocalMask;
+	FunctionDef*	fFunction;
 	LexLocation	fStart;
 	LexLocation	fEnd;
 };
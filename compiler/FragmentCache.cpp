@@ -0,0 +1,118 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include "FragmentCache.h"
+
+
+void FragmentCache::Hash::Add(const void *data, size_t length)
+{
+	const UByte *ptr = (const UByte *)data;
+	const UByte *end = ptr + length;
+
+	while(ptr < end)
+	{
+		fLow = ((fLow ^ *ptr) * 16777619UL) & 0xffffffffUL;
+		fHigh = ((fHigh ^ *ptr) * 0x5bd1e995UL) & 0xffffffffUL;
+		++ptr;
+	}
+}
+
+
+FragmentCache::FragmentCache() :
+	fCompile(0)
+{
+}
+
+
+FragmentCache::~FragmentCache()
+{
+	for(map<Key, Entry*>::iterator i=fEntries.begin(); i!=fEntries.end(); ++i)
+		delete i->second;
+}
+
+
+void FragmentCache::Begin()
+{
+	++fCompile;
+
+	map<Key, Entry*>::iterator i = fEntries.begin();
+	while(i != fEntries.end())
+	{
+		if (fCompile - i->second->fLastUsed > kMaxAge)
+		{
+			delete i->second;
+			fEntries.erase(i++);
+		}
+		else
+			++i;
+	}
+}
+
+
+const FragmentCache::Entry* FragmentCache::Find(const Key &key)
+{
+	map<Key, Entry*>::iterator i = fEntries.find(key);
+	if (i == fEntries.end()) return 0;
+
+	i->second->fLastUsed = fCompile;
+	return i->second;
+}
+
+
+bool FragmentCache::Add(const Key &key, Entry *e, const UByte *data, int length,
+	const RCX_SourceTag *tags, int tagCount, const vector<Span> &spans)
+{
+	e->fData.assign(data, data + length);
+
+	for(int i=0; i<tagCount; ++i)
+	{
+		RCX_SourceTag t = tags[i];
+		size_t s = 0;
+
+		while(s < spans.size() && (spans[s].fIndex != t.fSrcIndex ||
+			t.fSrcOffset < spans[s].fStart || t.fSrcOffset > spans[s].fEnd))
+			++s;
+
+		if (s == spans.size())
+		{
+			delete e;
+			return false;
+		}
+
+		t.fSrcIndex = (short)s;
+		t.fSrcOffset -= spans[s].fStart;
+		e->fTags.push_back(t);
+	}
+
+	e->fLastUsed = fCompile;
+
+	Entry *&slot = fEntries[key];
+	delete slot;
+	slot = e;
+
+	return true;
+}
+
+
+void FragmentCache::GetTags(const Entry &e, const vector<Span> &spans, vector<RCX_SourceTag> &tags)
+{
+	tags = e.fTags;
+
+	for(size_t i=0; i<tags.size(); ++i)
+	{
+		const Span &s = spans[tags[i].fSrcIndex];
+
+		tags[i].fSrcIndex = s.fIndex;
+		tags[i].fSrcOffset += s.fStart;
+	}
+}
@@ -0,0 +1,128 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __FragmentCache_h
+#define __FragmentCache_h
+
+#ifndef __PTypes_h
+#include "PTypes.h"
+#endif
+
+#ifndef __RCX_SourceTag_h
+#include "RCX_SourceTag.h"
+#endif
+
+#ifndef __VarAllocator_h
+#include "VarAllocator.h"
+#endif
+
+#include <cstddef>
+#include <cstring>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+using std::map;
+using std::pair;
+using std::size_t;
+using std::string;
+using std::vector;
+
+/*
+ * The fixed up code of tasks and subs, kept from one compile to the
+ * next so that a recompile (in watch or server mode) can reuse the
+ * code of the ones that haven't changed instead of encoding them
+ * again.  Program::EncodeFragment() finds code by a hash of everything
+ * the encoding depends on:
+ *
+ *  - the options, and the number of every task and sub
+ *  - the statements and expressions of the fragment, after inlining
+ *    and the other passes
+ *  - the text of the fragment and of the inline functions in it
+ *  - the rest of the program's text (declarations, macros, ...)
+ *  - the state of the VarAllocator before it
+ *
+ * The source tags are kept relative to the text they point into (a
+ * span), so reused code lists right even if the fragment has moved.
+ */
+class FragmentCache
+{
+public:
+	// two 32 bit FNV-1a style hashes with different multipliers
+	class Hash
+	{
+	public:
+			Hash() : fLow(2166136261UL), fHigh(2166136261UL) {}
+
+		void	Add(const void *data, size_t length);
+		void	Add(long n)		{ Add(&n, sizeof(n)); }
+		void	Add(const char *s)	{ Add(s, std::strlen(s) + 1); }
+
+		pair<ULong, ULong>	Get() const	{ return std::make_pair(fLow, fHigh); }
+
+	private:
+		ULong	fLow;
+		ULong	fHigh;
+	};
+
+	typedef pair<ULong, ULong> Key;
+
+	// text that source tags point into: a fragment or an inline function
+	struct Span
+	{
+		short	fIndex;
+		long	fStart;
+		long	fEnd;
+	};
+
+	struct Entry
+	{
+			Entry(const VarAllocator &after) : fAllocator(after) {}
+
+		vector<UByte>		fData;
+		vector<RCX_SourceTag>	fTags;		// fSrcIndex is the span
+		vector<pair<int, string> >	fVariables;	// names for the image
+		VarAllocator		fAllocator;	// after the fragment
+		int			fLocalMask;
+		VarAllocator::Usage	fUsage;
+		int			fLastUsed;	// compile it was last found in
+	};
+
+			FragmentCache();
+			~FragmentCache();
+
+	// starts a compile, dropping the entries that the last few haven't used
+	void		Begin();
+
+	// the entry for key (0 if there isn't one)
+	const Entry*	Find(const Key &key);
+
+	// keeps e (which the cache then owns) under key, with its code and
+	// tags from data and tags; returns false and deletes e if a tag is
+	// outside the spans
+	bool		Add(const Key &key, Entry *e, const UByte *data, int length,
+				const RCX_SourceTag *tags, int tagCount, const vector<Span> &spans);
+
+	// e's tags pointing into spans
+	static void	GetTags(const Entry &e, const vector<Span> &spans, vector<RCX_SourceTag> &tags);
+
+private:
+	// compiles an entry may go unused before it is dropped
+	enum { kMaxAge = 8 };
+
+	map<Key, Entry*>	fEntries;
+	int			fCompile;
+};
+
+#endif
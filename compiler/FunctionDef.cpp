@@ -16,12 +16,59 @@
 #include "Stmt.h"
 #include "Scope.h"
 #include "Program.h"
+#include "AssignMathStmt.h"
+#include "BlockStmt.h"
+#include "CaseStmt.h"
+#include "DeclareStmt.h"
+#include "DoStmt.h"
+#include "ExprStmt.h"
+#include "ForStmt.h"
+#include "IfStmt.h"
+#include "JumpStmt.h"
+#include "RepeatStmt.h"
+#include "ScopeStmt.h"
+#include "SwitchStmt.h"
+#include "WhileStmt.h"
+#include "AtomExpr.h"
+#include "BinaryExpr.h"
+#include "IncDecExpr.h"
+#include "LogicalExpr.h"
+#include "ModExpr.h"
+#include "NegateExpr.h"
+#include "RelExpr.h"
+#include "ShiftExpr.h"
+#include "TernaryExpr.h"
+#include "UnaryExpr.h"
+
+#include <set>
+
+using std::set;
+
+
+/// Apply() functor that looks for anything a pure function can't do
+class FunctionDef::PureChecker
+{
+public:
+		PureChecker(const FunctionDef *f);
+
+	bool	operator()(Stmt *s);
+	bool	operator()(Expr *e);
+
+	bool	IsPure() const	{ return fPure; }
+
+private:
+	set<int>	fReadable;	// args and locals
+	set<int>	fWritable;	// integer args and locals
+	set<int>	fOutputs;	// reference args
+	bool		fPure;
+};
 
 FunctionDef::FunctionDef()
 {
 	fBody = 0;
 	fName = 0;
 	fExpanded = false;
+	fPure = -1;
 	fListingEnabled = true;
 }
 
@@ -93,6 +140,133 @@ void FunctionDef::CreateArgVars()
 }
 
 
+bool FunctionDef::IsPure()
+{
+	if (fPure < 0)
+	{
+		PureChecker pc(this);
+		if (fBody) Apply(fBody, pc);
+		fPure = pc.IsPure();
+	}
+
+	return fPure != 0;
+}
+
+
+FunctionDef::PureChecker::PureChecker(const FunctionDef *f) : fPure(true)
+{
+	for(int i=0; i<f->GetArgCount(); i++)
+	{
+		int var = f->GetArgVar(i);
+
+		switch(f->GetArgType(i))
+		{
+			case kIntegerArg:
+				fWritable.insert(var);
+				// fall through
+			case kConstantArg:
+			case kConstRefArg:
+				fReadable.insert(var);
+				break;
+			case kReferenceArg:
+				fOutputs.insert(var);
+				break;
+			default:
+				// sensors and pointers read or write outside the call
+				fPure = false;
+				break;
+		}
+	}
+}
+
+
+bool FunctionDef::PureChecker::operator()(Stmt *s)
+{
+	if (!fPure) return false;
+
+	if (DeclareStmt *ds = dynamic_cast<DeclareStmt*>(s))
+	{
+		if (ds->GetCount() != 1 || ds->GetPointer())
+			fPure = false;
+
+		fReadable.insert(ds->GetVar());
+		fWritable.insert(ds->GetVar());
+		return fPure;
+	}
+
+	if (AssignStmt *a = dynamic_cast<AssignStmt*>(s))
+	{
+		// an output is only ever assigned, so what it held before the
+		// call doesn't matter
+		int var = a->GetLval()->GetLValue();
+		bool math = dynamic_cast<AssignMathStmt*>(s) != 0;
+
+		if (!dynamic_cast<const AtomExpr*>(a->GetLval()) ||
+			!(fWritable.count(var) || (!math && fOutputs.count(var))))
+		{
+			fPure = false;
+			return false;
+		}
+
+		Apply(a->GetExpr(1), *this);
+		return fPure;
+	}
+
+	if (!dynamic_cast<BlockStmt*>(s) &&
+		!dynamic_cast<ScopeStmt*>(s) &&
+		!dynamic_cast<ExprStmt*>(s) &&
+		!dynamic_cast<IfStmt*>(s) &&
+		!dynamic_cast<WhileStmt*>(s) &&
+		!dynamic_cast<DoStmt*>(s) &&
+		!dynamic_cast<ForStmt*>(s) &&
+		!dynamic_cast<RepeatStmt*>(s) &&
+		!dynamic_cast<SwitchStmt*>(s) &&
+		!dynamic_cast<CaseStmt*>(s) &&
+		!dynamic_cast<JumpStmt*>(s))
+	{
+		// calls, asm, gotos and the like
+		fPure = false;
+		return false;
+	}
+
+	int n = s->GetExprCount();
+	for(int i=0; i<n; i++)
+		Apply(s->GetExpr(i), *this);
+
+	return fPure;
+}
+
+
+bool FunctionDef::PureChecker::operator()(Expr *e)
+{
+	if (!fPure) return false;
+
+	if (dynamic_cast<AtomExpr*>(e))
+	{
+		// sensors, timers, messages and globals can change between calls
+		RCX_Value ea = e->GetStaticEA();
+		if (RCX_VALUE_TYPE(ea) == kRCX_ConstantType)
+			return true;
+
+		fPure = RCX_VALUE_TYPE(ea) == kRCX_VariableType &&
+			fReadable.count(RCX_VALUE_DATA_INT(ea));
+	}
+	else if (IncDecExpr *id = dynamic_cast<IncDecExpr*>(e))
+		fPure = fWritable.count(id->GetVar()) != 0;
+	else if (!dynamic_cast<BinaryExpr*>(e) &&
+		!dynamic_cast<UnaryExpr*>(e) &&
+		!dynamic_cast<NegateExpr*>(e) &&
+		!dynamic_cast<ShiftExpr*>(e) &&
+		!dynamic_cast<ModExpr*>(e) &&
+		!dynamic_cast<RelExpr*>(e) &&
+		!dynamic_cast<LogicalExpr*>(e) &&
+		!dynamic_cast<TernaryExpr*>(e))
+		fPure = false;
+
+	return fPure;
+}
+
+
 void FunctionDef::SetLocations(LocationNode *start, LocationNode *end)
 {
 	fStart = start->GetLoc();
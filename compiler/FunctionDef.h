@@ -78,7 +78,14 @@ public:
 	bool		IsExpanded() const	{ return fExpanded; }
 	void		SetExpanded(bool b)	{ fExpanded = b; }
 
+	// true if the function only does arithmetic on its args and locals,
+	// and its reference args are only assigned to (never read), so a
+	// second call with the same args leaves everything as it was
+	bool		IsPure();
+
 private:
+	class PureChecker;
+
 	const Symbol*	fName;
 
 	struct Arg
@@ -92,6 +99,7 @@ private:
 	Stmt*			fBody;
 
 	bool			fExpanded;
+	int			fPure;		// -1 until IsPure() finds out
 
 	bool			fListingEnabled;
 	LexLocation		fStart;
@@ -16,6 +16,7 @@
 #include "AtomExpr.h"
 #include "Fragment.h"
 #include "Error.h"
+#include "Symbol.h"
 #include "RCX_Cmd.h"
 
 void GosubParamStmt::AddParams(vector<Expr*> &params)
@@ -27,6 +28,13 @@ void GosubParamStmt::AddParams(vector<Expr*> &params)
 
 void GosubParamStmt::EmitActual(Bytecode &b)
 {
+	// there are no objects for targets with sub parameters
+	if (fFragment->IsDeclaration())
+	{
+		Error(kErr_DeclaredOnly, fFragment->GetName()->GetKey()).Raise(&fLocation);
+		return;
+	}
+
   // subroutines with parameters do not use the variable allocator for its parameters
   // instead they use the stack
         if (!b.GetVarAllocator().CheckLocalMask(fFragment->GetLocalMask()))
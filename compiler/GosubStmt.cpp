@@ -15,10 +15,19 @@
 #include "Bytecode.h"
 #include "Fragment.h"
 #include "Error.h"
+#include "Program.h"
+#include "Symbol.h"
 #include "RCX_Cmd.h"
 
 void GosubStmt::EmitActual(Bytecode &b)
 {
+	// only an object can leave the sub to another one
+	if (fFragment->IsDeclaration() && !gProgram->IsObject())
+	{
+		Error(kErr_DeclaredOnly, fFragment->GetName()->GetKey()).Raise(&fLocation);
+		return;
+	}
+
 	if (!b.GetVarAllocator().CheckLocalMask(fFragment->GetLocalMask()))
 	{
 		Error(kErr_NoMoreVars).Raise(&fLocation);
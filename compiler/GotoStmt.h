@@ -32,6 +32,7 @@ public:
 	bool	Check(CheckState &state);
 	void	EmitActual(Bytecode &b);
 	Stmt*	CloneActual(Mapping *b) const;
+	bool	FallsThrough()	{ return false; }
 
 	void	SetLabel(int l)	{ fLabel = l; }
 
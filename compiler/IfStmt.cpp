@@ -13,6 +13,8 @@
  */
 #include "IfStmt.h"
 #include "Bytecode.h"
+#include "Program.h"
+#include "ExprSharer.h"
 
 IfStmt::IfStmt(Expr *c, Stmt *s1, Stmt *s2) :
 	BinaryStmt(s1, s2), fCondition(c)
@@ -22,12 +24,13 @@ IfStmt::IfStmt(Expr *c, Stmt *s1, Stmt *s2) :
 
 IfStmt::~IfStmt()
 {
-	delete fCondition;
+	Expr::Release(fCondition);
 }
 
 
 void IfStmt::EmitActual(Bytecode &b)
 {
+	ExprSharer sharer(b, this);
 	int value;
 
 	if (fCondition->Evaluate(value))
@@ -64,14 +67,24 @@ void IfStmt::EmitIf(Bytecode &b)
 
 void IfStmt::EmitIfElse(Bytecode &b)
 {
+	// the branch that ran more in the profile falls through
+	if (gProgram->GetOptimize() >= Program::kBasicOptimize &&
+		gProgram->GetHeat(GetSecondary()) > gProgram->GetHeat(GetPrimary()))
+	{
+		EmitElseFirst(b);
+		return;
+	}
+
 	int testLabel = b.NewLabel();
 	int outLabel= b.NewLabel();
 
 	fCondition->EmitBranch(b, testLabel, false);
 
-	// generate A and jump
+	// generate A and jump (unless A never gets to the end)
 	GetPrimary()->Emit(b);
-	b.AddJump(outLabel);
+	if (GetPrimary()->FallsThrough() ||
+		gProgram->GetOptimize() < Program::kBasicOptimize)
+		b.AddJump(outLabel);
 	b.SetLabel(testLabel);
 
 	// generate B
@@ -80,6 +93,25 @@ void IfStmt::EmitIfElse(Bytecode &b)
 }
 
 
+void IfStmt::EmitElseFirst(Bytecode &b)
+{
+	int testLabel = b.NewLabel();
+	int outLabel= b.NewLabel();
+
+	fCondition->EmitBranch(b, testLabel, true);
+
+	// generate B and jump (unless B never gets to the end)
+	GetSecondary()->Emit(b);
+	if (GetSecondary()->FallsThrough())
+		b.AddJump(outLabel);
+	b.SetLabel(testLabel);
+
+	// generate A
+	GetPrimary()->Emit(b);
+	b.SetLabel(outLabel);
+}
+
+
 Stmt* IfStmt::CloneActual(Mapping *b) const
 {
 	return new IfStmt(
@@ -87,3 +119,11 @@ Stmt* IfStmt::CloneActual(Mapping *b) const
 		GetPrimary()->Clone(b),
 		GetSecondary() ? GetSecondary()->Clone(b) : 0);
 }
+
+
+bool IfStmt::FallsThrough()
+{
+	if (!GetSecondary()) return true;
+
+	return GetPrimary()->FallsThrough() || GetSecondary()->FallsThrough();
+}
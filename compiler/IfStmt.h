@@ -30,12 +30,15 @@ public:
 
 	void	EmitActual(Bytecode &b);
 	Stmt*	CloneActual(Mapping *b) const;
+	bool	FallsThrough();
 
-	virtual void	GetExprs(vector<Expr*> & v) const	{ v.push_back(fCondition); }
+	virtual int	GetExprCount() const	{ return 1; }
+	virtual Expr*	GetExpr(int) const	{ return fCondition; }
 
 private:
 	void	EmitIf(Bytecode &b);
 	void	EmitIfElse(Bytecode &b);
+	void	EmitElseFirst(Bytecode &b);
 
 	Expr*	fCondition;
 };
@@ -13,6 +13,7 @@
  */
 
 #include "IncDecExpr.h"
+#include "VarTranslator.h"
 #include "RCX_Cmd.h"
 #include "Bytecode.h"
 #include "Mapping.h"
@@ -96,9 +97,8 @@ bool IncDecExpr::EmitSide_(Bytecode &b) const
 }
 
 
-void IncDecExpr::Translate(int from, int to)
+void IncDecExpr::Translate(const VarTranslator &vt)
 {
-    if (fVar == from)
-        fVar = to;
+    fVar = vt.Translate(fVar);
 }
 
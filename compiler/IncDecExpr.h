@@ -20,11 +20,7 @@
 #include "Expr.h"
 #endif
 
-#ifndef __VarTranslator_h
-#include "VarTranslator.h"
-#endif
-
-class IncDecExpr : public Expr, public Translatable
+class IncDecExpr : public Expr
 {
 public:
             IncDecExpr(int var, bool inc, bool pre, const LexLocation &loc);
@@ -37,7 +33,9 @@ public:
     virtual bool        EmitTo_(Bytecode &b, int dst) const;
     virtual bool        EmitSide_(Bytecode &b) const;
 
-    void                Translate(int from, int to);
+    void                Translate(const VarTranslator &vt);
+
+    int                 GetVar() const  { return fVar; }
 private:
     int         fVar;
     bool        fInc;
@@ -15,10 +15,14 @@
 #include "Mapping.h"
 #include "RCX_Cmd.h"
 #include "Bytecode.h"
+#include "Program.h"
 
 Expr* IndirectExpr::Clone(Mapping *m) const
 {
-	return new IndirectExpr(Get(0)->Clone(m), Get(1)->Clone(m));
+	Expr *e[2];
+
+	if (CloneExprs(m, e)) return Share();
+	return new IndirectExpr(e[0], e[1]);
 }
 
 
@@ -54,3 +58,27 @@ RCX_Value IndirectExpr::EmitAny_(Bytecode &b) const
 
 	return RCX_VALUE(indirectSrc, dst) + kRCX_ValueUsesTemp;
 }
+
+
+// an index that needs computing can go in the destination, which is
+// then loaded through, so no temp is needed
+bool IndirectExpr::EmitTo_(Bytecode &b, int dst) const
+{
+	if (gProgram->GetOptimize() < Program::kBasicOptimize)
+		return Expr::EmitTo_(b, dst);
+
+	int src, idx;
+	if (!Get(0)->Evaluate(src))
+		return false;
+	int directSrc = (src >> 8) & 0xff;
+	int indirectSrc = (src) & 0xff;
+
+	if ((directSrc && Get(1)->Evaluate(idx)) ||
+		Get(1)->GetLValue() != kIllegalVar)
+		return Expr::EmitTo_(b, dst);
+
+	if (!Get(1)->EmitTo(b, dst)) return false;
+
+	b.AddMove(dst, RCX_VALUE(indirectSrc, dst));
+	return true;
+}
@@ -28,6 +28,7 @@ public:
 	virtual bool		PotentialLValue() const	{ return true; }
 
 	virtual RCX_Value	EmitAny_(Bytecode &b) const;
+	virtual bool		EmitTo_(Bytecode &b, int dst) const;
 
 private:
 };
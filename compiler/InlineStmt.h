@@ -33,6 +33,8 @@ public:
     void    EmitActual(Bytecode &b);
     Stmt*   CloneActual(Mapping *b) const;
 
+    FunctionDef*    GetFunction() const { return fFunction; }
+
 private:
     FunctionDef*    fFunction;
 };
@@ -14,6 +14,21 @@
 #include "JumpStmt.h"
 #include "Bytecode.h"
 #include "Error.h"
+#include "WhileStmt.h"
+#include "DoStmt.h"
+#include "ForStmt.h"
+#include "RepeatStmt.h"
+#include "SwitchStmt.h"
+
+
+class BreakFinder
+{
+public:
+			BreakFinder() : fFound(false) {}
+	bool	operator()(Stmt *s);
+
+	bool	fFound;
+};
 
 
 JumpStmt::JumpStmt(int type, const LexLocation &loc)
@@ -38,3 +53,35 @@ Stmt* JumpStmt::CloneActual(Mapping *) const
 {
 	return new JumpStmt(fType, fLocation);
 }
+
+
+bool JumpStmt::ContainsBreak(Stmt *s)
+{
+	BreakFinder f;
+
+	Apply(s, f);
+	return f.fFound;
+}
+
+
+bool BreakFinder::operator()(Stmt *s)
+{
+	if (fFound) return false;
+
+	if (JumpStmt *j = dynamic_cast<JumpStmt*>(s))
+	{
+		if (j->fType == Bytecode::kBreakFlow)
+			fFound = true;
+		return false;
+	}
+
+	// loops and switches have their own break
+	if (dynamic_cast<WhileStmt*>(s) ||
+		dynamic_cast<DoStmt*>(s) ||
+		dynamic_cast<ForStmt*>(s) ||
+		dynamic_cast<RepeatStmt*>(s) ||
+		dynamic_cast<SwitchStmt*>(s))
+		return false;
+
+	return true;
+}
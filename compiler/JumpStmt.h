@@ -30,6 +30,13 @@ public:
 
 	void	EmitActual(Bytecode &b);
 	Stmt*	CloneActual(Mapping *b) const;
+	bool	FallsThrough()	{ return false; }
+
+	/// True if the loop body s holds a break for the loop, rather
+	/// than one for a loop or switch nested within it
+	static bool	ContainsBreak(Stmt *s);
+
+	friend class BreakFinder;
 
 private:
 	int		fType;
@@ -41,3 +41,10 @@ Stmt* LabelStmt::CloneActual(Mapping *m) const
 {
 	return new LabelStmt(fName, fLocation, GetBody()->Clone(m));
 }
+
+
+bool LabelStmt::FallsThrough()
+{
+	Stmt *body = GetBody();
+	return body ? body->FallsThrough() : true;
+}
@@ -39,6 +39,7 @@ public:
 
 	virtual void	EmitActual(Bytecode &b);
 	virtual Stmt*	CloneActual(Mapping *b) const;
+	virtual bool	FallsThrough();
 
 	const Symbol*	GetName() const	{ return fName; }
 	int				GetLabel() const { return fLabel; }
@@ -0,0 +1,79 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include "LocationTable.h"
+#include "CompileContext.h"
+
+using std::map;
+
+
+LocationTable& LocationTable::Get()
+{
+    return CompileContext::Get()->fLocations;
+}
+
+
+LocationTable::LocationTable() :
+    fCount(0)
+{
+    LexLocation illegal;
+    illegal.fIndex = kIllegalSrcIndex;
+    illegal.fLength = 0;
+    illegal.fOffset = 0;
+    Add(illegal);
+}
+
+
+LocationTable::~LocationTable()
+{
+    for(size_t i=0; i<fBlocks.size(); ++i)
+        delete [] fBlocks[i];
+}
+
+
+int LocationTable::Add(const LexLocation &loc)
+{
+    if (fCount && loc.fIndex == kIllegalSrcIndex)
+        return 0;
+
+    // find the block that would hold loc, if any
+    map<const LexLocation*, int>::const_iterator it = fBlockNumbers.upper_bound(&loc);
+    if (it != fBlockNumbers.begin()) {
+        --it;
+        const LexLocation *block = it->first;
+        if (&loc < block + kBlockSize) {
+            int index = it->second * kBlockSize + (int)(&loc - block);
+            if (index < fCount)
+                return index;
+        }
+    }
+
+    if (fCount == (int)fBlocks.size() * kBlockSize) {
+        LexLocation *block = new LexLocation[kBlockSize];
+        fBlockNumbers[block] = (int)fBlocks.size();
+        fBlocks.push_back(block);
+    }
+
+    int index = fCount++;
+    fBlocks[index / kBlockSize][index % kBlockSize] = loc;
+    return index;
+}
+
+
+void LocationTable::Truncate(int count)
+{
+    // the illegal location always stays
+    if (count < 1) count = 1;
+    if (count < fCount)
+        fCount = count;
+}
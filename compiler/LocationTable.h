@@ -0,0 +1,66 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __LocationTable_h
+#define __LocationTable_h
+
+#ifndef __LexLocation_h
+#include "LexLocation.h"
+#endif
+
+#include <map>
+#include <vector>
+
+/**
+ * The source locations of the statements and expressions being
+ * compiled.  A node keeps a 32 bit index into the table rather than a
+ * whole LexLocation, and a clone shares the index of its original.
+ *
+ * Entries are kept in fixed blocks and never move, so a reference
+ * from GetLocation() stays good until the table is truncated below
+ * it.  Index 0 is the illegal location.
+ */
+class LocationTable
+{
+public:
+            LocationTable();
+            ~LocationTable();
+
+    /// the current CompileContext's table
+    static LocationTable&   Get();
+
+    /// the index of loc; if loc is itself an entry its index is
+    /// returned, so copying a node's location adds nothing
+    int     Add(const LexLocation &loc);
+
+    const LexLocation&  GetLocation(int index) const
+        { return fBlocks[index / kBlockSize][index % kBlockSize]; }
+
+    int     GetCount() const    { return fCount; }
+
+    /// forget the entries from count on (their blocks are reused)
+    void    Truncate(int count);
+
+private:
+    enum { kBlockSize = 1024 };
+
+    std::vector<LexLocation*>           fBlocks;
+    std::map<const LexLocation*, int>   fBlockNumbers;  // by address
+    int                                 fCount;
+
+    // a table can't be copied
+            LocationTable(const LocationTable &);
+    void    operator=(const LocationTable &);
+};
+
+#endif
@@ -24,7 +24,10 @@ LogicalExpr::LogicalExpr (Expr *lhs, int op, Expr *rhs)
 
 Expr* LogicalExpr::Clone(Mapping *b) const
 {
-	return new LogicalExpr(Get(0)->Clone(b), fOp, Get(1)->Clone(b));
+	Expr *e[2];
+
+	if (CloneExprs(b, e)) return Share();
+	return new LogicalExpr(e[0], fOp, e[1]);
 }
 
 
@@ -29,6 +29,7 @@ public:
 
 	virtual bool		Evaluate(int &value) const;
 	virtual Expr*		Clone(Mapping *b) const;
+	virtual bool		Fold()	{ return FoldExprs(); }
 
 	virtual bool		EmitBranch_(Bytecode &b, int label, bool condition) const;
 
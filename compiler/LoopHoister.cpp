@@ -0,0 +1,252 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include "LoopHoister.h"
+#include "Bytecode.h"
+#include "AssignStmt.h"
+#include "AsmStmt.h"
+#include "CallStmt.h"
+#include "GosubParamStmt.h"
+#include "AtomExpr.h"
+#include "BinaryExpr.h"
+#include "IncDecExpr.h"
+#include "ModExpr.h"
+#include "NegateExpr.h"
+#include "ShiftExpr.h"
+#include "UnaryExpr.h"
+#include "Program.h"
+
+// each hoisted expression holds a temp for the whole loop, so only a
+// few are moved, and only while there are vars to spare
+#define kMaxHoisted     4
+#define kMinFreeVars    4
+
+
+/// The expressions that a loop writes to
+class LoopHoister::Writes
+{
+public:
+            Writes() : fUnknown(false) {}
+
+    bool    operator()(Stmt *s);
+    bool    Contains(int var) const;
+
+    bool    IsUnknown() const   { return fUnknown; }
+
+private:
+    void    FindIncDecs(Expr *e);
+
+    vector<const Expr*> fWrites;
+    bool                fUnknown;
+};
+
+
+class HoistFinder
+{
+public:
+            HoistFinder(vector<Expr*> &exprs) : fExprs(exprs) {}
+    bool    operator()(Stmt *s);
+
+private:
+    vector<Expr*>&  fExprs;
+};
+
+
+LoopHoister::LoopHoister(Bytecode &b, Stmt *loop) :
+    fBytecode(b),
+    fWrites(0)
+{
+    // hoisting is left to the full optimization level
+    if (gProgram->GetOptimize() < Program::kFullOptimize) return;
+
+    fWrites = new Writes();
+    Apply(loop, *fWrites);
+}
+
+
+LoopHoister::~LoopHoister()
+{
+    for(size_t i=0; i<fHoisted.size(); ++i) {
+        Hoisted &h = fHoisted[i];
+
+        h.fParent->Replace(h.fTemp, h.fExpr);
+        fBytecode.GetVarAllocator().Release(RCX_VALUE_DATA(h.fTemp->GetStaticEA()));
+        delete h.fTemp;
+    }
+
+    delete fWrites;
+}
+
+
+void LoopHoister::Hoist(Stmt *s)
+{
+    if (!fWrites || fWrites->IsUnknown()) return;
+
+    vector<Expr*> exprs;
+    HoistFinder finder(exprs);
+    Apply(s, finder);
+
+    for(size_t i=0; i<exprs.size(); ++i)
+        Hoist(exprs[i]);
+}
+
+
+void LoopHoister::Hoist(Expr *e)
+{
+    NodeExpr *node = dynamic_cast<NodeExpr*>(e);
+    if (!node || !fWrites || fWrites->IsUnknown()) return;
+
+    // the top level expression is only computed once anyway, so
+    // look at the sub-expressions
+    vector<Expr*> children;
+    node->GetExprs(children);
+
+    for(size_t i=0; i<children.size(); ++i) {
+        Expr *c = children[i];
+        int v;
+
+        if (c->GetStaticEA() == Expr::kIllegalEA && !c->Evaluate(v) &&
+            IsInvariant(c))
+            Hoist(node, c);
+        else
+            Hoist(c);
+    }
+}
+
+
+bool LoopHoister::IsInvariant(const Expr *e) const
+{
+    if (dynamic_cast<const AtomExpr*>(e)) {
+        RCX_Value ea = e->GetStaticEA();
+        int var = RCX_VALUE_DATA(ea);
+
+        switch(RCX_VALUE_TYPE(ea)) {
+            case kRCX_ConstantType:
+                return true;
+            case kRCX_VariableType:
+                return !(var & kVirtualVarBase) &&
+                    fBytecode.GetVarAllocator().IsLocal(var) &&
+                    !fWrites->Contains(var);
+            default:
+                return false;
+        }
+    }
+
+    if (!dynamic_cast<const BinaryExpr*>(e) &&
+        !dynamic_cast<const NegateExpr*>(e) &&
+        !dynamic_cast<const UnaryExpr*>(e) &&
+        !dynamic_cast<const ShiftExpr*>(e) &&
+        !dynamic_cast<const ModExpr*>(e))
+        return false;
+
+    vector<Expr*> children;
+    e->GetExprs(children);
+
+    for(size_t i=0; i<children.size(); ++i)
+        if (!IsInvariant(children[i])) return false;
+
+    return true;
+}
+
+
+void LoopHoister::Hoist(NodeExpr *parent, Expr *e)
+{
+    if (fHoisted.size() >= kMaxHoisted) return;
+
+    VarAllocator &allocator = fBytecode.GetVarAllocator();
+    if (allocator.GetFreeCount() <= kMinFreeVars) return;
+
+    // allocate it like a local so the loop's code doesn't mistake it
+    // for a temp it may overwrite
+    int var = allocator.Allocate(false, true, 1);
+    if (var == kIllegalVar) return;
+
+    if (!e->EmitTo(fBytecode, var)) {
+        allocator.Release(var);
+        return;
+    }
+
+    Hoisted h;
+    h.fParent = parent;
+    h.fExpr = e;
+    h.fTemp = new AtomExpr(kRCX_VariableType, var, e->GetLoc());
+    parent->Replace(e, h.fTemp);
+
+    fHoisted.push_back(h);
+}
+
+
+bool LoopHoister::Writes::operator()(Stmt *s)
+{
+    // the params aren't in GetExprs()
+    if (dynamic_cast<GosubParamStmt*>(s)) {
+        fUnknown = true;
+        return false;
+    }
+
+    vector<Expr*> exprs;
+    s->GetExprs(exprs);
+
+    // asm can only name locals through its expressions, but it may
+    // write to any of them
+    if (dynamic_cast<AsmStmt*>(s))
+        fWrites.insert(fWrites.end(), exprs.begin(), exprs.end());
+
+    if (AssignStmt *a = dynamic_cast<AssignStmt*>(s)) {
+        // arrays and pointers could write to anything
+        const Expr *lval = a->GetLval();
+        if (lval->GetLValue() == kIllegalVar) {
+            fUnknown = true;
+            return false;
+        }
+
+        fWrites.push_back(lval);
+    }
+
+    for(size_t i=0; i<exprs.size(); ++i)
+        FindIncDecs(exprs[i]);
+
+    return true;
+}
+
+
+void LoopHoister::Writes::FindIncDecs(Expr *e)
+{
+    if (dynamic_cast<IncDecExpr*>(e))
+        fWrites.push_back(e);
+
+    vector<Expr*> children;
+    e->GetExprs(children);
+
+    for(size_t i=0; i<children.size(); ++i)
+        FindIncDecs(children[i]);
+}
+
+
+bool LoopHoister::Writes::Contains(int var) const
+{
+    for(size_t i=0; i<fWrites.size(); ++i)
+        if (fWrites[i]->Contains(var)) return true;
+
+    return false;
+}
+
+
+bool HoistFinder::operator()(Stmt *s)
+{
+    // the arguments of an expanded call aren't emitted
+    if (!dynamic_cast<CallStmt*>(s))
+        s->GetExprs(fExprs);
+
+    return true;
+}
@@ -0,0 +1,65 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __LoopHoister_h
+#define __LoopHoister_h
+
+#include <vector>
+
+using std::vector;
+
+class Bytecode;
+class Stmt;
+class Expr;
+class NodeExpr;
+
+/**
+ * Computes the parts of a loop's expressions that can't change while
+ * the loop runs into temps before the loop, and uses the temps within
+ * the loop instead.  A loop statement creates one at the start of
+ * EmitActual(), passes it the parts that run on every iteration, and
+ * the original expressions are put back when it goes out of scope.
+ *
+ * Only arithmetic on constants and on the fragment's own variables
+ * is moved, since globals, sensors and timers can change between
+ * iterations without the loop writing them.  A loop with sub
+ * parameters, or writes through arrays or pointers, is left alone.
+ */
+class LoopHoister
+{
+public:
+            LoopHoister(Bytecode &b, Stmt *loop);
+            ~LoopHoister();
+
+    void    Hoist(Stmt *s);
+    void    Hoist(Expr *e);
+
+private:
+    class Writes;
+
+    bool    IsInvariant(const Expr *e) const;
+    void    Hoist(NodeExpr *parent, Expr *e);
+
+    struct Hoisted
+    {
+        NodeExpr*   fParent;
+        Expr*       fExpr;
+        Expr*       fTemp;
+    };
+
+    Bytecode&           fBytecode;
+    Writes*             fWrites;
+    vector<Hoisted>     fHoisted;
+};
+
+#endif
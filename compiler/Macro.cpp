@@ -15,6 +15,7 @@
 using std::memcpy;
 
 #include "Macro.h"
+#include "CompileStats.h"
 
 
 Macro::Macro(const Token *tokens, int count, int argCount)
@@ -24,6 +25,7 @@ Macro::Macro(const Token *tokens, int count, int argCount)
     if (count) {
         fTokens = new Token[count];
         memcpy(fTokens, tokens, sizeof(Token) * count);
+        CompileStats::Get().Allocate(CompileStats::kMacroPool, (long)(sizeof(Token) * count));
     }
     else {
         fTokens = nil;
@@ -36,5 +38,7 @@ Macro::Macro(const Token *tokens, int count, int argCount)
 
 Macro::~Macro()
 {
+    if (fTokens)
+        CompileStats::Get().Release(CompileStats::kMacroPool, (long)(sizeof(Token) * fTokenCount));
     delete [] fTokens;
 }
@@ -27,12 +27,33 @@ Mapping::~Mapping()
 
 void Mapping::Add(int var, Expr *e)
 {
+	if (var & kVirtualVarBase)
+	{
+		size_t n = var & kVirtualVarMask;
+
+		if (n >= fIndex.size())
+			fIndex.resize(n + 1, 0);
+
+		// an earlier pair for the same var wins, like the search did
+		if (!fIndex[n])
+			fIndex[n] = fPairs.size() + 1;
+	}
+
 	fPairs.push_back(Pair(var, e));
 }
 
 
 const Expr* Mapping::Get(int var) const
 {
+	if (var & kVirtualVarBase)
+	{
+		size_t n = var & kVirtualVarMask;
+		if (n >= fIndex.size() || !fIndex[n]) return 0;
+
+		const Pair &p = fPairs[fIndex[n] - 1];
+		return p.fVar == var ? p.fValue : 0;
+	}
+
 	for(size_t i=0; i<fPairs.size(); ++i)
 		if (fPairs[i].fVar == var) return fPairs[i].fValue;
 
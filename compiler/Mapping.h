@@ -45,6 +45,10 @@ private:
     };
 
     vector<Pair> fPairs;
+
+    // 1 + the position in fPairs for each virtual var number (0 if
+    // the var isn't mapped), so cloning doesn't search fPairs
+    vector<int> fIndex;
 };
 
 #endif
@@ -14,6 +14,7 @@
 #include "ModExpr.h"
 #include "Bytecode.h"
 #include "RCX_Cmd.h"
+#include "Program.h"
 
 #define NON_VOLATILE_MASK   (TYPEMASK(kRCX_VariableType) + \
                              TYPEMASK(kRCX_ConstantType))
@@ -21,7 +22,10 @@
 
 Expr* ModExpr::Clone(Mapping *b) const
 {
-    return new ModExpr(Get(0)->Clone(b), Get(1)->Clone(b));
+    Expr *e[2];
+
+    if (CloneExprs(b, e)) return Share();
+    return new ModExpr(e[0], e[1]);
 }
 
 
@@ -80,10 +84,30 @@ bool ModExpr::EmitCalculation(Bytecode &b, int dst) const
 {
     RCX_Value m, n;
     RCX_Cmd cmd;
+    int v;
 
     m = Get(0)->EmitConstrained(b, NON_VOLATILE_MASK);
     if (m == kIllegalEA) return false;
 
+    // with a constant divisor, m - (m/n)*n is m + (m/n)*-n, which
+    // saves negating the result
+    if (gProgram->GetOptimize() >= Program::kBasicOptimize &&
+        Get(1)->Evaluate(v) && v > -32768 && v < 32768) {
+        b.AddMove(dst, m);
+
+        cmd.MakeVar(kRCX_DivVar, dst, RCX_VALUE(kRCX_ConstantType, v));
+        b.Add(cmd);
+
+        cmd.MakeVar(kRCX_MulVar, dst, RCX_VALUE(kRCX_ConstantType, -v));
+        b.Add(cmd);
+
+        cmd.MakeVar(kRCX_AddVar, dst, m);
+        b.Add(cmd);
+
+        b.ReleaseTempEA(m);
+        return true;
+    }
+
     n = Get(1)->EmitConstrained(b, NON_VOLATILE_MASK);
     if (n== kIllegalEA) {
         b.ReleaseTempEA(m);
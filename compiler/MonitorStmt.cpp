@@ -18,6 +18,7 @@
 #include "RCX_Target.h"
 #include "Error.h"
 #include "CatchStmt.h"
+#include "Program.h"
 
 #define SCOUT_MONITOR_MASK (TYPEMASK(kRCX_VariableType) + \
 							TYPEMASK(kRCX_ConstantType) + \
@@ -32,13 +33,7 @@ MonitorStmt::MonitorStmt(Expr *events, Stmt* body, BlockStmt *handlers, const Le
 
 MonitorStmt::~MonitorStmt()
 {
-	delete fEvents;
-}
-
-
-void MonitorStmt::GetExprs(vector<Expr*> & v) const
-{
-	v.push_back(fEvents);
+	Expr::Release(fEvents);
 }
 
 
@@ -61,6 +56,12 @@ void MonitorStmt::EmitActual(Bytecode &b)
 	int handlerLabel = b.NewLabel();
 	int endLabel = b.NewLabel();
 
+	// with a constant mask, the events a handler can still see are the
+	// monitored ones that no earlier handler caught
+	bool prune = gProgram->GetOptimize() >= Program::kBasicOptimize;
+	int remaining = 0;
+	bool known = prune && fEvents->Evaluate(remaining);
+
 	// get EA of event mask
 	if (b.GetTarget()->fType == kRCX_ScoutTarget)
 		ea = fEvents->EmitConstrained(b, SCOUT_MONITOR_MASK);
@@ -90,21 +91,24 @@ void MonitorStmt::EmitActual(Bytecode &b)
 			b.AddJump(endLabel);
 			b.SetLabel(handlerLabel);
 
-			// prepare next handler test
-//                        handlerLabel = b.NewLabel();
-                        b.NewLabel();
-
 			CatchStmt* cs = dynamic_cast<CatchStmt*>(h);
-			if (cs)
+			if (cs && !(known && (cs->GetValue() & remaining) == remaining))
 			{
 				// conditional catch needs a daisy-chained label
 				handlerLabel  = b.NewLabel();
 				cs->SetLabel(handlerLabel);
+				remaining &= ~cs->GetValue();
 			}
 			else
+			{
 				handlerLabel = kIllegalLabel;
+				if (cs) cs->SetLabel(kIllegalLabel);
+			}
 
 			h->Emit(b);
+
+			// the handlers after one that always runs never do
+			if (prune && handlerLabel == kIllegalLabel) break;
 		}
 	}
 	if (handlerLabel != kIllegalLabel)
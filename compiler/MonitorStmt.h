@@ -28,7 +28,8 @@ public:
 			MonitorStmt(Expr *events, Stmt *body, BlockStmt *handlers, const LexLocation &loc);
 			~MonitorStmt();
 
-	void	GetExprs(vector<Expr*> & v) const;
+	int	GetExprCount() const	{ return 1; }
+	Expr*	GetExpr(int) const	{ return fEvents; }
 
 	void	EmitActual(Bytecode &b);
 	Stmt*	CloneActual(Mapping *b) const;
@@ -17,7 +17,10 @@
 
 Expr* NegateExpr::Clone(Mapping *b) const
 {
-	return new NegateExpr(Get(0)->Clone(b));
+	Expr *e[1];
+
+	if (CloneExprs(b, e)) return Share();
+	return new NegateExpr(e[0]);
 }
 
 
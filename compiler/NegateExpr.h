@@ -25,6 +25,8 @@ public:
 		NegateExpr(Expr *e) : NodeExpr(e) {}
 
 	virtual Expr*		Clone(Mapping *b) const;
+	virtual bool		Fold()	{ return FoldExprs(); }
+	virtual bool		Matches(const Expr *e) const	{ return MatchesExprs(e); }
 
 	virtual bool		EmitBranch_(Bytecode &b, int label, bool condition) const;
 	virtual bool		Evaluate(int & value) const;
@@ -12,6 +12,9 @@
  *
  */
 #include "NodeExpr.h"
+#include "AtomExpr.h"
+
+#include <typeinfo>
 
 NodeExpr::NodeExpr(Expr *e)
 	: Expr(e->GetLoc())
@@ -43,7 +46,7 @@ NodeExpr::NodeExpr(Expr *a, Expr *b, Expr *c)
 NodeExpr::~NodeExpr()
 {
 	for(int i=0; i<fCount; ++i)
-		delete fExprs[i];
+		Release(fExprs[i]);
 }
 
 
@@ -63,8 +66,70 @@ bool NodeExpr::PromiseConstant() const
 }
 
 
-void NodeExpr::GetExprs(vector<Expr*> &v) const
+void NodeExpr::Replace(Expr *e, Expr *with)
 {
 	for(int i=0; i<fCount; ++i)
-		v.push_back(fExprs[i]);
+		if (fExprs[i] == e) fExprs[i] = with;
+}
+
+
+bool NodeExpr::Fold()
+{
+	// the node itself may not be pure, but its sub-expressions can
+	// still be folded
+	FoldExprs();
+	return false;
+}
+
+
+bool NodeExpr::CloneExprs(Mapping *m, Expr **e) const
+{
+	bool same = true;
+
+	for(int i=0; i<fCount; ++i) {
+		e[i] = fExprs[i]->Clone(m);
+		if (e[i] != fExprs[i]) same = false;
+	}
+
+	// the node can be shared too
+	if (same) {
+		for(int i=0; i<fCount; ++i)
+			Release(e[i]);
+	}
+
+	return same;
+}
+
+
+bool NodeExpr::MatchesExprs(const Expr *e) const
+{
+	if (typeid(*e) != typeid(*this)) return false;
+
+	const NodeExpr *n = static_cast<const NodeExpr*>(e);
+	if (n->fCount != fCount) return false;
+
+	for(int i=0; i<fCount; ++i)
+		if (!fExprs[i]->Matches(n->fExprs[i])) return false;
+
+	return true;
+}
+
+
+bool NodeExpr::FoldExprs()
+{
+	bool pure = true;
+
+	for(int i=0; i<fCount; ++i) {
+		Expr *e = fExprs[i];
+		int v;
+
+		if (!e->Fold())
+			pure = false;
+		else if (!dynamic_cast<AtomExpr*>(e) && e->Evaluate(v)) {
+			fExprs[i] = new AtomExpr(kRCX_ConstantType, v, e->GetLoc());
+			Release(e);
+		}
+	}
+
+	return pure;
 }
@@ -28,12 +28,31 @@ public:
 
 	virtual bool		Contains(int var) const;
 	virtual bool		PromiseConstant() const;
-	virtual void		GetExprs(vector<Expr*> & /* v */) const;
+	virtual int			GetExprCount() const	{ return fCount; }
+	virtual Expr*		GetExpr(int i) const	{ return fExprs[i]; }
+	virtual bool		Fold();
+
+	/// Replace the sub-expression e without deleting it
+	void		Replace(Expr *e, Expr *with);
 
 protected:
 	Expr*		Get(int i)			{ return fExprs[i]; }
 	const Expr*	Get(int i) const	{ return fExprs[i]; }
 
+	/// Replace a sub-expression without deleting the old one
+	void		Set(int i, Expr *e)	{ fExprs[i] = e; }
+
+	/// Fold the sub-expressions, returning true if all are pure
+	bool		FoldExprs();
+
+	/// Clone the sub-expressions into e, returning true (with the
+	/// clones released) if every one came back shared rather than
+	/// copied, in which case the node itself can be shared
+	bool		CloneExprs(Mapping *m, Expr **e) const;
+
+	/// True if e is the same kind of node with matching sub-expressions
+	bool		MatchesExprs(const Expr *e) const;
+
 private:
 	static const int MAX_EXPRS = 3;
 	Expr*	fExprs[MAX_EXPRS];
@@ -25,7 +25,7 @@
  *      be expanded.
  *
  * GetRawToken() - maintains the queue of expansions, subsitutes arguments during
- *      expansion, manages the lexer (calls yylex(), maintains fNLRead, etc)
+ *      expansion, manages the lexer (calls LexGetToken(), maintains fNLRead, etc)
  */
 
 #include <cstring>
@@ -35,6 +35,8 @@
 #include "Expansion.h"
 #include "Program.h"
 #include "Error.h"
+#include "CompileStats.h"
+#include "Compiler.h"
 
 // make sure we get an error if we try to use yylval
 #define yylval
@@ -43,18 +45,26 @@
 #define kErrorArgs -2
 
 
-PreProc *gPreProc = new PreProc();
-
-
 PreProc::PreProc()
 {
     fActive = fConditional.IsActive();
     fEndOfFiles = false;
+    fReplay = 0;
+    fReplayPos = 0;
+    fReplayCount = 0;
+    fRecorded = 0;
+    fRecordErrors = 0;
+    fArgDepth = 0;
 }
 
 
 PreProc::~PreProc()
 {
+    while(Expansion *e = fExpList.RemoveHead())
+        delete e;
+
+    while(Expansion *e = fFreeExpansions.RemoveHead())
+        delete e;
 }
 
 
@@ -62,10 +72,14 @@ int PreProc::Get(TokenVal &v)
 {
     int t;
     long x;
+    CompileStats::Timer timer(CompileStats::kPreProcPhase);
+
+    // a compile over the memory limit reads no further
+    if (CompileStats::Get().OverLimit()) return 0;
 
     // read token from lexer, and process any preprocessor commands;
     while(1) {
-        t = GetReplacedToken(v);
+        t = IsPlain() ? GetPlainToken(v) : GetReplacedToken(v);
 
         // strip newlines
         if (t==NL) continue;
@@ -92,36 +106,36 @@ int PreProc::Get(TokenVal &v)
                 break;
             case PP_IFDEF:
                 DoIfdef((bool)v.fInt);
-                fActive = fConditional.IsActive();
+                SetActive(fConditional.IsActive());
                 DiscardLine();
                 break;
             case PP_IF:
-                fParser.Parse(x);
+                fParser.Parse(x, fActive);
                 fConditional.If(x ? true : false);
-                fActive = fConditional.IsActive();
+                SetActive(fConditional.IsActive());
                 DiscardLine();
                 break;
             case PP_ELIF:
-                fActive=true;
+                SetActive(true);
                 fParser.Parse(x);
                 if (!fConditional.Elif(x ? true : false))
                     Error(kErr_UnexpectedElse, "#elif").RaiseLex();
                 else
-                    fActive = fConditional.IsActive();
+                    SetActive(fConditional.IsActive());
                 DiscardLine();
                 break;
             case PP_ELSE:
                 if (!fConditional.Else())
                     Error(kErr_UnexpectedElse, "#else").RaiseLex();
                 else
-                    fActive = fConditional.IsActive();
+                    SetActive(fConditional.IsActive());
                 DiscardLine();
                 break;
             case PP_ENDIF:
                 if (!fConditional.Endif())
                     Error(kErr_UnexpectedElse, "#endif").RaiseLex();
                 else
-                    fActive = fConditional.IsActive();
+                    SetActive(fConditional.IsActive());
                 DiscardLine();
                 break;
             case PP_UNDEF:
@@ -149,13 +163,41 @@ int PreProc::Get(TokenVal &v)
                 DiscardLine();
                 break;
             default:
-                if (fActive) return t;
+                if (fActive) {
+                    CompileStats::Get().Count(CompileStats::kTokenCounter);
+                    return t;
+                }
                 break;
         }
     }
 }
 
 
+/*
+ * GetReplacedToken() and GetRawToken() cut down to what they do when
+ * IsPlain().  A macro (an API one, usually) starts an expansion, and
+ * its tokens come the usual way.
+ */
+int PreProc::GetPlainToken(TokenVal &v)
+{
+    int t = LexGetToken(v);
+
+    if (t==ID) {
+        fParser.Uses(v.fSymbol);
+        if (v.fSymbol->IsDefined()) {
+            BeginExpansion(v.fSymbol);
+            return GetReplacedToken(v);
+        }
+    }
+    else if (t==NL)
+        fNLRead = true;
+    else if (t==0)
+        fEndOfFiles = true;
+
+    return t;
+}
+
+
 int PreProc::GetReplacedToken(TokenVal &v)
 {
     int t;
@@ -164,11 +206,22 @@ int PreProc::GetReplacedToken(TokenVal &v)
         t = GetRawToken(v);
 
         // macro substitution
-        if (t==ID && (v.fSymbol->IsDefined()) && fActive) {
-            BeginExpansion(v.fSymbol);
+        if (t==ID && fActive) {
+            fParser.Uses(v.fSymbol);
+            if (v.fSymbol->IsDefined()) {
+                BeginExpansion(v.fSymbol);
+                continue;
+            }
         }
-        else
-            return t;
+
+        if (fRecorded) {
+            Token token;
+            token.fType = t;
+            token.fValue = v;
+            fRecording.fTokens.push_back(token);
+        }
+
+        return t;
     }
 }
 
@@ -182,23 +235,37 @@ int PreProc::GetRawToken(TokenVal &v)
 
         if (e) {
             if (e->IsDone()) {
+                // a macro still reading its arguments has gone past the
+                // end of the recorded expansion
+                if (e == fRecorded)
+                    EndRecording(fArgDepth == 0);
                 fExpList.RemoveHead();
-                delete e;
+                ReleaseExpansion(e);
             }
             else {
                 t = e->NextToken(v);
                 if (t == PP_ARG) {
-                    fExpList.InsertHead(new Expansion(e, v.fInt));
+                    Expansion *arg = NewExpansion();
+                    arg->BeginArg(e, v.fInt);
+                    fExpList.InsertHead(arg);
                 }
                 else
                     return t;
             }
         } else {
+            if (fReplayPos < fReplayCount) {
+                v = fReplay[fReplayPos].fValue;
+                return fReplay[fReplayPos++].fType;
+            }
+
             if (fEndOfFiles) {
                 return 0;
             }
 
-            t = yylex(v);
+            t = LexGetToken(v);
+
+            if (!fGuardFiles.empty())
+                TrackGuard(t, v);
 
             if (t==NL)
                 fNLRead = true;
@@ -211,6 +278,14 @@ int PreProc::GetRawToken(TokenVal &v)
 }
 
 
+void PreProc::Replay(const Token *tokens, int count)
+{
+    fReplay = tokens;
+    fReplayPos = 0;
+    fReplayCount = count;
+}
+
+
 bool PreProc::DoInclude()
 {
     TokenVal v;
@@ -223,11 +298,29 @@ bool PreProc::DoInclude()
         return false;
     }
 
-    if (!LexFindAndPushFile(v.fString)) {
-        Error(kErr_FileOpen, v.fString);
+    const char *name = LexGetString(v.fInt);
+
+    GuardFile f;
+    if (Compiler::Get()->GetFileId(name, f.fId)) {
+        if (fOnceFiles.count(f.fId))
+            return true;
+
+        map<string, Symbol*>::const_iterator guard = fGuards.find(f.fId);
+        if (guard != fGuards.end() && guard->second->IsDefined())
+            return true;
+    }
+
+    if (!LexFindAndPushFile(name)) {
+        Error(kErr_FileOpen, name);
         return false;
     }
 
+    f.fDepth = LexGetFileDepth();
+    f.fState = GuardFile::kStart;
+    f.fLevel = 0;
+    f.fGuard = 0;
+    fGuardFiles.push_back(f);
+
     return true;
 }
 
@@ -254,6 +347,8 @@ bool PreProc::DoDefine()
     argCount = ReadDefineArgs();
     if (argCount == kErrorArgs) return false;
 
+    ClearExpansions();
+
     // hack to detect empty macro
     if (fNLRead) {
         s->Define(new Macro(0, nil, -1));
@@ -368,19 +463,167 @@ bool PreProc::BeginExpansion(Symbol *s)
         return false;
     }
 
-    e = new Expansion(def);
+    // nothing refers to the arena once every expansion is done
+    if (!fExpList.GetHead())
+        fArena.Clear();
 
-    if (!ReadExpansionArgs(e)) {
-        delete e;
+    int firstArg = fArena.fSpans.size();
+    if (def->GetArgCount() > 0)
+        fArena.fSpans.resize(firstArg + 2 * def->GetArgCount());
+
+    e = NewExpansion();
+    e->BeginMacro(def, &fArena, firstArg);
+
+    fArgDepth++;
+    bool ok = ReadExpansionArgs(e);
+    fArgDepth--;
+
+    if (!ok) {
+        ReleaseExpansion(e);
         Error(kErr_WrongArgCount, s->GetKey()).RaiseLex();
         return false;
     }
 
+    CompileStats::Get().Count(CompileStats::kExpansionCounter);
+
+    if (FindExpansion(s, e, firstArg))
+        return true;
+
+    fExpList.InsertHead(e);
+    return true;
+}
+
+
+/**
+ * Play back what a call of a function-like macro expanded to before,
+ * in place of e, or else start recording what e expands to.  Nothing
+ * is cached while an #if is being evaluated, since that has to see
+ * every identifier the expansion looks up.
+ *
+ * @return true if e was replaced by the recorded tokens
+ */
+bool PreProc::FindExpansion(Symbol *s, Expansion *e, int firstArg)
+{
+    Macro *def = s->GetDefinition();
+    int argCount = def->GetArgCount();
+
+    // every macro expanded while recording is part of the recording
+    if (fRecorded)
+        fRecording.fMacros.push_back(def);
+
+    if (argCount == Macro::kNoArgs || fParser.IsRecording()) return false;
+
+    // the macro, then each argument's length and tokens
+    string key((const char *)&def, sizeof(def));
+    for(int i=0; i<argCount; ++i) {
+        const int *span = &fArena.fSpans[firstArg + 2*i];
+
+        key.append((const char *)&span[1], sizeof(span[1]));
+        if (!EncodeArgs(span[1] ? &fArena.fTokens[span[0]] : 0, span[1], key))
+            return false;
+    }
+
+    map<string, CachedExpansion>::const_iterator i = fExpansions.find(key);
+    if (i != fExpansions.end()) {
+        const vector<Macro*> &macros = i->second.fMacros;
+
+        for(size_t j=0; j<macros.size(); ++j) {
+            if (macros[j]->IsMarked()) {
+                i = fExpansions.end();
+                break;
+            }
+        }
+    }
+
+    if (i == fExpansions.end()) {
+        // only the outermost expansion is recorded
+        if (!fRecorded) {
+            fRecorded = e;
+            fRecordKey = key;
+            fRecording.fTokens.resize(0);
+            fRecording.fMacros.resize(0);
+            fRecordErrors = ErrorHandler::Get()->GetErrorCount();
+            fRecording.fMacros.push_back(def);
+        }
+        return false;
+    }
+
+    if (fRecorded) {
+        const vector<Macro*> &macros = i->second.fMacros;
+        fRecording.fMacros.insert(fRecording.fMacros.end(), macros.begin(), macros.end());
+    }
+
+    // the tokens are copied into the arena, so the cache can change
+    // while they are played back
+    const vector<Token> &tokens = i->second.fTokens;
+    int start = fArena.fTokens.size();
+    fArena.fTokens.insert(fArena.fTokens.end(), tokens.begin(), tokens.end());
+
+    ReleaseExpansion(e);
+    e = NewExpansion();
+    e->BeginTokens(&fArena, start, tokens.size());
     fExpList.InsertHead(e);
     return true;
 }
 
 
+void PreProc::EndRecording(bool save)
+{
+    // an expansion with an error in it has to raise it again
+    if (save && ErrorHandler::Get()->GetErrorCount() == fRecordErrors)
+        fExpansions[fRecordKey] = fRecording;
+
+    fRecorded = 0;
+    fRecording.fTokens.resize(0);
+    fRecording.fMacros.resize(0);
+}
+
+
+void PreProc::ClearExpansions()
+{
+    fExpansions.clear();
+    if (fRecorded)
+        EndRecording(false);
+}
+
+
+/**
+ * Add the tokens of a macro argument to a key.
+ *
+ * @return false if the tokens can't be part of a key (strings, whose
+ * text is elsewhere)
+ */
+bool PreProc::EncodeArgs(const Token *tokens, int count, string &key)
+{
+    for(int i=0; i<count; ++i) {
+        const Token &t = tokens[i];
+
+        key.append((const char *)&t.fType, sizeof(t.fType));
+
+        switch(t.fType) {
+            case ID:
+                key.append((const char *)&t.fValue.fSymbol, sizeof(t.fValue.fSymbol));
+                break;
+            case NUMBER:
+            case ASSIGN:
+            case ASSIGN2:
+            case INCDEC:
+            case JUMP:
+            case TASKOP:
+            case PP_IFDEF:
+                key.append((const char *)&t.fValue.fInt, sizeof(t.fValue.fInt));
+                break;
+            case STRING:
+                return false;
+            default:
+                break;
+        }
+    }
+
+    return true;
+}
+
+
 bool PreProc::ReadExpansionArgs(Expansion *e)
 {
     int argCount = e->GetArgCount();
@@ -409,12 +652,10 @@ bool PreProc::ReadExpansionArgs(Expansion *e)
 bool PreProc::ReadExpansionArg(Expansion *e, int i, int delim)
 {
     int nesting = 0;
-    int count = 0;
+    int start = fArena.fTokens.size();
     int t;
     TokenVal v;
 
-    fTokenBuf.resize(0);
-
     while(1) {
         t = GetRawToken(v);
 
@@ -433,19 +674,82 @@ bool PreProc::ReadExpansionArg(Expansion *e, int i, int delim)
             case ',':
                 if (nesting) break;
                 if (t != delim) return false;
-                e->SetArg(i, &fTokenBuf[0], fTokenBuf.size());
+                e->SetArg(i, start, fArena.fTokens.size() - start);
                 return true;
         }
 
-        fTokenBuf.resize(count+1);
-        fTokenBuf[count].fType = t;
-        fTokenBuf[count].fValue = v;
-        count++;
+        Token token;
+        token.fType = t;
+        token.fValue = v;
+        fArena.fTokens.push_back(token);
     }
 
 }
 
 
+Expansion *PreProc::NewExpansion()
+{
+    Expansion *e = fFreeExpansions.RemoveHead();
+
+    return e ? e : new Expansion();
+}
+
+
+void PreProc::ReleaseExpansion(Expansion *e)
+{
+    e->End();
+    fFreeExpansions.InsertHead(e);
+}
+
+
+void PreProc::TrackGuard(int t, const TokenVal &v)
+{
+    int depth = LexGetFileDepth();
+
+    // remember the guards of files that have ended
+    while(!fGuardFiles.empty() && fGuardFiles.back().fDepth > depth) {
+        const GuardFile &f = fGuardFiles.back();
+        if (f.fState == GuardFile::kEnded)
+            fGuards[f.fId] = f.fGuard;
+        fGuardFiles.pop_back();
+    }
+
+    // only the innermost file is tracked, so ignore tokens from
+    // files that aren't being tracked
+    if (fGuardFiles.empty() || fGuardFiles.back().fDepth != depth) return;
+    if (t == NL || t == WS) return;
+
+    GuardFile &f = fGuardFiles.back();
+    switch(f.fState) {
+        case GuardFile::kStart:
+            f.fState = (t == PP_IFDEF && !v.fInt) ? GuardFile::kName : GuardFile::kNotGuarded;
+            break;
+        case GuardFile::kName:
+            if (t == ID) {
+                f.fGuard = v.fSymbol;
+                f.fLevel = 1;
+                f.fState = GuardFile::kGuarded;
+            }
+            else
+                f.fState = GuardFile::kNotGuarded;
+            break;
+        case GuardFile::kGuarded:
+            if (t == PP_IF || t == PP_IFDEF)
+                f.fLevel++;
+            else if (t == PP_ENDIF && --f.fLevel == 0)
+                f.fState = GuardFile::kEnded;
+            else if ((t == PP_ELSE || t == PP_ELIF) && f.fLevel == 1)
+                f.fState = GuardFile::kNotGuarded;
+            break;
+        case GuardFile::kEnded:
+            f.fState = GuardFile::kNotGuarded;
+            break;
+        case GuardFile::kNotGuarded:
+            break;
+    }
+}
+
+
 bool PreProc::DoIfdef(bool b)
 {
     TokenVal v;
@@ -477,6 +781,7 @@ bool PreProc::DoUndef()
     }
 
     v.fSymbol->Undefine();
+    ClearExpansions();
     return true;
 }
 
@@ -494,6 +799,22 @@ bool PreProc::DoPragma()
         gProgram->SetInitName(0, 0);
         return true;
     }
+    else if (strcmp(pragma, "once") == 0) {
+        // an included file is never read again (the main file is only
+        // read once anyway)
+        if (!fGuardFiles.empty() && fGuardFiles.back().fDepth == LexGetFileDepth() &&
+            !fGuardFiles.back().fId.empty())
+            fOnceFiles.insert(fGuardFiles.back().fId);
+        return true;
+    }
+    else if (strcmp(pragma, "outline") == 0) {
+        gProgram->SetOutline(true);
+        return true;
+    }
+    else if (strcmp(pragma, "nonvolatile") == 0) {
+        gProgram->SetVolatileSources(false);
+        return true;
+    }
     else if (strcmp(pragma, "init") == 0) {
         t = GetRawToken(v);
         if (t != ID) return false;
@@ -527,6 +848,15 @@ bool PreProc::DoPragma()
 }
 
 
+void PreProc::SetActive(bool active)
+{
+    fActive = active;
+
+    // the lexer can skip over inactive blocks
+    LexSkipInactive(!active);
+}
+
+
 void PreProc::DiscardLine()
 {
     TokenVal v;
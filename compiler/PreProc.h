@@ -30,12 +30,22 @@
 #include "Conditional.h"
 #endif
 
+#ifndef __Expansion_h
+#include "Expansion.h"
+#endif
+
 #include <vector>
+#include <map>
+#include <set>
+#include <string>
 
 using std::vector;
+using std::map;
+using std::set;
+using std::string;
 
 class Symbol;
-class Expansion;
+class Macro;
 
  /*
   * Reads tokens from the Lexer and emits a preprocessed token stream.
@@ -67,11 +77,46 @@ public:
     /**
      * Get next queued token (either from macro or file).
      * Maintains the queue of expansions, subsitutes arguments during
-     * expansion, manages the lexer (calls yylex(), maintains fNLRead, etc.)
+     * expansion, manages the lexer (calls LexGetToken(), maintains fNLRead, etc.)
      */
     int     GetRawToken(TokenVal &v);
 
+    /**
+     * Play back tokens that were already read from the lexer, as if the
+     * lexer returned them again.  The tokens must stay valid until they
+     * have all been read.
+     */
+    void    Replay(const Token *tokens, int count);
+    /// number of tokens from the last Replay() that have been read
+    int     GetReplayPos() const    { return fReplayPos; }
+
+    /**
+     * The files that including again would add nothing to: the #pragma
+     * once ones, and the ones with a guard (see GuardFile).  They are
+     * handed on to a preprocessor that carries on where this one left
+     * off (see Compiler snapshots).
+     */
+    void    GetIncludedFiles(set<string> &once, map<string, Symbol*> &guards) const {
+        once = fOnceFiles;
+        guards = fGuards;
+    }
+    void    SetIncludedFiles(const set<string> &once, const map<string, Symbol*> &guards) {
+        fOnceFiles = once;
+        fGuards = guards;
+    }
+
 private:
+    /**
+     * With no macro being expanded, nothing recorded or played back, no
+     * guard to track and no inactive block being skipped (all of most
+     * programs that #define nothing themselves), the layers in between
+     * have nothing to do, and Get() reads straight from the lexer.
+     */
+    bool    IsPlain() const {
+        return fActive && !fRecorded && !fExpList.GetHead() &&
+            fReplayPos >= fReplayCount && fGuardFiles.empty() && !fEndOfFiles;
+    }
+    int     GetPlainToken(TokenVal &v);
 
     bool    DoDefine();
     bool    DoInclude();
@@ -86,23 +131,92 @@ private:
     int     MatchArg(const Symbol *s);
 
     void    DiscardLine();
+    void    SetActive(bool active);
 
     bool    BeginExpansion(Symbol *s);
     bool    ReadExpansionArgs(Expansion *e);
     bool    ReadExpansionArg(Expansion *e, int i, int delim);
 
+    Expansion*  NewExpansion();
+    void        ReleaseExpansion(Expansion *e);
+
+    void    TrackGuard(int t, const TokenVal &v);
+
+    bool    FindExpansion(Symbol *s, Expansion *e, int firstArg);
+    void    EndRecording(bool save);
+    void    ClearExpansions();
+    static bool EncodeArgs(const Token *tokens, int count, string &key);
+
     bool    fNLRead;
 
     PListS<Expansion>   fExpList;
+    PListS<Expansion>   fFreeExpansions;
+    ExpansionArena      fArena;
     vector<Symbol*>     fArguments;
     vector<Token>       fTokenBuf;
     Conditional         fConditional;
     bool                fActive;
     CondParser          fParser;
     bool                fEndOfFiles;
+    const Token*        fReplay;
+    int                 fReplayPos;
+    int                 fReplayCount;
+
+    /*
+     * An included file whose only content is an #ifndef ... #endif
+     * block is remembered along with the symbol it tests.  Once that
+     * symbol is defined, including the file again would produce
+     * nothing, so the file isn't read at all.
+     */
+    struct GuardFile {
+        enum State {
+            kStart,         // nothing seen yet
+            kName,          // saw #ifndef, waiting for the symbol
+            kGuarded,       // inside the #ifndef block
+            kEnded,         // after the block's #endif
+            kNotGuarded
+        };
+
+        string  fId;        // see Compiler::GetFileId()
+        int     fDepth;     // lexer file depth of the file
+        State   fState;
+        int     fLevel;     // conditional nesting within the file
+        Symbol* fGuard;
+    };
+
+    vector<GuardFile>       fGuardFiles;    // files being read
+    map<string, Symbol*>    fGuards;
+    set<string>             fOnceFiles;     // ids of #pragma once files
+
+    /*
+     * What a function-like macro expanded to, keyed by the macro and
+     * its arguments, so that the same call made again just plays the
+     * tokens back.  The first call is recorded as its tokens come out,
+     * which only works if the expansion produced them all itself (the
+     * last macro in a body can read its arguments from beyond the
+     * body).  The macros it used are kept too, since one of them being
+     * expanded already would make the call circular.  Any #define or
+     * #undef could change an expansion, so they start the cache over.
+     */
+    struct CachedExpansion {
+        vector<Token>   fTokens;
+        vector<Macro*>  fMacros;
+    };
+
+    map<string, CachedExpansion> fExpansions;
+    Expansion*              fRecorded;      // expansion being recorded, or 0
+    string                  fRecordKey;
+    CachedExpansion         fRecording;
+    int                     fRecordErrors;  // error count when it began
+    int                     fArgDepth;      // macros reading their arguments
 };
 
 
-extern PreProc *gPreProc;
+#ifndef __CompileContext_h
+#include "CompileContext.h"
+#endif
+
+// the preprocessor for the current context
+#define gPreProc (CompileContext::Get()->fPreProc)
 
 #endif
@@ -0,0 +1,338 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <map>
+
+#include "PrecompiledHeader.h"
+#include "Buffer.h"
+#include "Symbol.h"
+#include "parser.h"
+#include "CompileContext.h"
+
+#if defined(WIN32) || defined(macintosh)
+#define NO_MMAP
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+using std::fopen;
+using std::string;
+using std::map;
+
+#define kHeaderSize     24
+#define kTokenSize      12
+
+static void Put4(ULong d, vector<UByte> &data);
+static void Put2(UShort d, vector<UByte> &data);
+static ULong Get4(const UByte *ptr);
+static UShort Get2(const UByte *ptr);
+
+
+PrecompiledHeader::PrecompiledHeader() :
+    fData(0),
+    fLength(0),
+    fMapped(false),
+    fBorrowed(false),
+    fTokenCount(0),
+    fTokens(0),
+    fStrings(0)
+{
+}
+
+
+PrecompiledHeader::~PrecompiledHeader()
+{
+    Close();
+}
+
+
+void PrecompiledHeader::Lex(Buffer *source, vector<UByte> &data)
+{
+    vector<Token> tokens;
+    vector<LexLocation> locations;
+    vector<ULong> nameOffsets;
+    map<const Symbol*, int> names;
+    string strings;
+    Token t;
+    LexLocation loc;
+
+    // record every token, including whitespace, so that playback can
+    // satisfy the preprocessor in either whitespace mode
+    CompileContext::FrontEndLock lock;
+    LexPush(source);
+    LexReturnWhitespace(1);
+    while((t.fType = yylex(t.fValue)) != 0) {
+        LexCurrentLocation(loc);
+
+        if (t.fType == ID) {
+            map<const Symbol*, int>::iterator it = names.find(t.fValue.fSymbol);
+            if (it == names.end()) {
+                int index = (int)nameOffsets.size();
+                names[t.fValue.fSymbol] = index;
+                nameOffsets.push_back(strings.size());
+                strings.append(t.fValue.fSymbol->GetKey());
+                strings.push_back(0);
+                t.fValue.fInt = index;
+            }
+            else {
+                t.fValue.fInt = it->second;
+            }
+        }
+        else if (t.fType == STRING) {
+            int offset = (int)strings.size();
+            strings.append(t.fValue.fString);
+            strings.push_back(0);
+            t.fValue.fInt = offset;
+        }
+
+        tokens.push_back(t);
+        locations.push_back(loc);
+    }
+    LexReturnWhitespace(0);
+    lock.Release();
+
+    data.clear();
+    data.reserve(kHeaderSize + tokens.size() * kTokenSize +
+        nameOffsets.size() * 4 + strings.size());
+
+    Put4(kSignature, data);
+    Put2(kVersion, data);
+    Put2(0, data);
+    Put4(source->GetLength(), data);
+    Put4(tokens.size(), data);
+    Put4(nameOffsets.size(), data);
+    Put4(strings.size(), data);
+
+    for(size_t i=0; i<tokens.size(); ++i) {
+        Put2((UShort)tokens[i].fType, data);
+        Put2((UShort)locations[i].fLength, data);
+        Put4(locations[i].fOffset, data);
+        Put4(tokens[i].fValue.fInt, data);
+    }
+
+    for(size_t i=0; i<nameOffsets.size(); ++i) {
+        Put4(nameOffsets[i], data);
+    }
+
+    data.insert(data.end(), strings.begin(), strings.end());
+}
+
+
+bool PrecompiledHeader::Create(Buffer *source, const char *filename)
+{
+    vector<UByte> data;
+    Lex(source, data);
+
+    FILE *fp = fopen(filename, "wb");
+    if (!fp) return false;
+
+    fwrite(&data[0], 1, data.size(), fp);
+
+    bool ok = (ferror(fp) == 0);
+    if (fclose(fp) != 0) ok = false;
+
+    return ok;
+}
+
+
+bool PrecompiledHeader::Open(const char *filename, int sourceLength)
+{
+    Close();
+
+#ifdef NO_MMAP
+    FILE *fp = fopen(filename, "rb");
+    if (!fp) return false;
+
+    fseek(fp, 0, SEEK_END);
+    fLength = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+
+    UByte *data = new UByte[fLength ? fLength : 1];
+    if (fread(data, 1, fLength, fp) != (size_t)fLength) {
+        fclose(fp);
+        delete [] data;
+        return false;
+    }
+    fclose(fp);
+    fData = data;
+#else
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat stat_buf;
+    if (fstat(fd, &stat_buf) != 0 || stat_buf.st_size < kHeaderSize) {
+        close(fd);
+        return false;
+    }
+
+    fLength = stat_buf.st_size;
+    void *ptr = mmap(0, fLength, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (ptr == MAP_FAILED) return false;
+    fData = (const UByte *)ptr;
+    fMapped = true;
+#endif
+
+    return Load(sourceLength);
+}
+
+
+bool PrecompiledHeader::Open(const UByte *data, long length, int sourceLength)
+{
+    Close();
+
+    fData = data;
+    fLength = length;
+    fBorrowed = true;
+
+    return Load(sourceLength);
+}
+
+
+bool PrecompiledHeader::Load(int sourceLength)
+{
+    // validate the header and the section sizes
+    if (fLength < kHeaderSize ||
+        Get4(fData) != kSignature ||
+        Get2(fData + 4) != kVersion ||
+        (int)Get4(fData + 8) != sourceLength) {
+        Close();
+        return false;
+    }
+
+    ULong tokenCount = Get4(fData + 12);
+    ULong nameCount = Get4(fData + 16);
+    ULong stringBytes = Get4(fData + 20);
+
+    // check each count on its own first, so the sum can't overflow
+    if (tokenCount > (ULong)fLength / kTokenSize ||
+        nameCount > (ULong)fLength / 4 ||
+        stringBytes > (ULong)fLength ||
+        kHeaderSize + tokenCount * kTokenSize + nameCount * 4 + stringBytes != (ULong)fLength ||
+        (stringBytes && fData[fLength-1] != 0)) {
+        Close();
+        return false;
+    }
+
+    fTokenCount = tokenCount;
+    fTokens = fData + kHeaderSize;
+    const UByte *names = fTokens + tokenCount * kTokenSize;
+    fStrings = (const char *)(names + nameCount * 4);
+
+    // intern each identifier once rather than once per token
+    fSymbols.resize(nameCount);
+    for(ULong i=0; i<nameCount; ++i) {
+        ULong offset = Get4(names + i * 4);
+        if (offset >= stringBytes) {
+            Close();
+            return false;
+        }
+        fSymbols[i] = Symbol::Get(fStrings + offset);
+    }
+
+    // GetToken() indexes the names and strings with token values, so a
+    // damaged file is rejected here and the source is lexed instead
+    for(ULong i=0; i<tokenCount; ++i) {
+        const UByte *ptr = fTokens + i * kTokenSize;
+        int type = Get2(ptr);
+        ULong value = Get4(ptr + 8);
+
+        if ((type == ID && value >= nameCount) ||
+            (type == STRING && value >= stringBytes)) {
+            Close();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+int PrecompiledHeader::GetToken(int i, TokenVal &v, LexLocation &loc) const
+{
+    if (i >= fTokenCount) return 0;
+
+    const UByte *ptr = fTokens + i * kTokenSize;
+    int type = Get2(ptr);
+    int value = (int)Get4(ptr + 8);
+
+    loc.fLength = Get2(ptr + 2);
+    loc.fOffset = Get4(ptr + 4);
+
+    if (type == ID)
+        v.fSymbol = fSymbols[value];
+    else if (type == STRING)
+        v.fString = (char *)fStrings + value;
+    else
+        v.fInt = value;
+
+    return type;
+}
+
+
+void PrecompiledHeader::Close()
+{
+    if (fData && !fBorrowed) {
+#ifndef NO_MMAP
+        if (fMapped)
+            munmap((void *)fData, fLength);
+        else
+#endif
+            delete [] fData;
+    }
+
+    fData = 0;
+    fLength = 0;
+    fMapped = false;
+    fBorrowed = false;
+    fTokenCount = 0;
+    fTokens = 0;
+    fStrings = 0;
+    fSymbols.resize(0);
+}
+
+
+void Put4(ULong d, vector<UByte> &data)
+{
+    data.push_back((UByte)d);
+    data.push_back((UByte)(d>>8));
+    data.push_back((UByte)(d>>16));
+    data.push_back((UByte)(d>>24));
+}
+
+
+void Put2(UShort d, vector<UByte> &data)
+{
+    data.push_back((UByte)d);
+    data.push_back((UByte)(d>>8));
+}
+
+
+ULong Get4(const UByte *ptr)
+{
+    return (ULong)ptr[0] | ((ULong)ptr[1] << 8) |
+        ((ULong)ptr[2] << 16) | ((ULong)ptr[3] << 24);
+}
+
+
+UShort Get2(const UByte *ptr)
+{
+    return (UShort)(ptr[0] | (ptr[1] << 8));
+}
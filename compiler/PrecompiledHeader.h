@@ -0,0 +1,100 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __PrecompiledHeader_h
+#define __PrecompiledHeader_h
+
+#ifndef __Token_h
+#include "Token.h"
+#endif
+
+#ifndef __LexLocation_h
+#include "LexLocation.h"
+#endif
+
+#ifndef __PTypes_h
+#include "PTypes.h"
+#endif
+
+#include <vector>
+
+using std::vector;
+
+class Buffer;
+class Symbol;
+
+/**
+ * A precompiled header (.nqp file) holds the complete token stream
+ * that the lexer produced for a header file, including whitespace and
+ * directive tokens.  When a header is included and an up to date .nqp
+ * file exists, the tokens are played back to the preprocessor instead
+ * of running the lexer over the source again.  Macro definitions are
+ * then recreated by PreProc exactly as they would be from the source.
+ *
+ * File layout (all values little endian):
+ *
+ *  header:  signature, version, reserved, source length,
+ *           token count, name count, string bytes (4 bytes each,
+ *           except version and reserved which are 2 bytes)
+ *  tokens:  type (2), length (2), offset (4), value (4)
+ *  names:   offset of each identifier within the strings (4)
+ *  strings: nul terminated identifiers and string literals
+ *
+ * An identifier token's value is an index into the names, and a string
+ * token's value is an offset into the strings.
+ */
+class PrecompiledHeader
+{
+public:
+    enum {
+        kSignature = 0x5043514e,    // "NQCP"
+        kVersion = 0x101
+    };
+
+            PrecompiledHeader();
+            ~PrecompiledHeader();
+
+    /// Lex the entire buffer into the layout of a .nqp file
+    static void Lex(Buffer *source, vector<UByte> &data);
+
+    /// Lex the entire buffer and write the tokens to a file
+    static bool Create(Buffer *source, const char *filename);
+
+    /// Map an existing file; sourceLength must match the
+    /// length of the Buffer the tokens were lexed from
+    bool Open(const char *filename, int sourceLength);
+
+    /// Use tokens from Lex(), which must outlive the header
+    bool Open(const UByte *data, long length, int sourceLength);
+
+    int     GetTokenCount() const   { return fTokenCount; }
+
+    /// Fetch token i, returns 0 past the last token
+    int     GetToken(int i, TokenVal &v, LexLocation &loc) const;
+
+private:
+    bool    Load(int sourceLength);
+    void    Close();
+
+    const UByte*    fData;
+    long            fLength;
+    bool            fMapped;
+    bool            fBorrowed;      // fData belongs to someone else
+
+    int             fTokenCount;
+    const UByte*    fTokens;
+    const char*     fStrings;
+    vector<Symbol*> fSymbols;
+};
+
+#endif
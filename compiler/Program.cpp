@@ -14,6 +14,7 @@
 #include "Program.h"
 #include "Fragment.h"
 #include "RCX_Image.h"
+#include "RCX_Object.h"
 #include "Bytecode.h"
 #include "parser.h"
 #include "Symbol.h"
@@ -26,9 +27,104 @@
 #include "DeclareStmt.h"
 #include "PDebug.h"
 #include "Resource.h"
+#include "CompileStats.h"
+#include "GosubStmt.h"
+#include "GosubParamStmt.h"
+#include "InlineStmt.h"
+#include "TaskStmt.h"
+#include "AsmStmt.h"
+#include "Compiler.h"
+#include "RCX_Profile.h"
+#include "AtomExpr.h"
+#include "Buffer.h"
+
+#include <algorithm>
+#include <typeinfo>
+
+#ifndef NO_THREADS
+#include <atomic>
+#include <thread>
+#endif
+
+// outline only if it saves at least this many bytes
+#define kMinOutlineSavings	8
+#define kMinSizeSavings		2	// the sub's return and a byte more
+// bytes for calling a sub instead of inlining it
+#define kGosubSize		2
+// a line is hot if it ran at least 1/kHotFraction as often as the
+// most run line of the profile
+#define kHotFraction		16
+
+
+class SubFinder
+{
+public:
+			SubFinder(set<Fragment*> &subs, vector<Fragment*> &pending)
+				: fSubs(subs), fPending(pending) {}
+	bool	operator()(Stmt *s);
+
+private:
+	set<Fragment*>&		fSubs;
+	vector<Fragment*>&	fPending;
+};
+
+
+// finds the subs and tasks some statements can call or start; asm
+// that might do either makes it give up
+class StartFinder
+{
+public:
+			StartFinder(vector<Fragment*> &found)
+				: fFound(found), fUnknown(false) {}
+	bool	operator()(Stmt *s);
+
+	bool	IsUnknown() const	{ return fUnknown; }
+
+private:
+	vector<Fragment*>&	fFound;
+	bool			fUnknown;
+};
+
+
+class CallCounter
+{
+public:
+			CallCounter(map<const Symbol*, int> &calls) : fCalls(calls) {}
+	bool	operator()(Stmt *s);
+
+private:
+	map<const Symbol*, int>&	fCalls;
+};
+
+
+// finds the count of the most run line of some statements
+class HeatFinder
+{
+public:
+			HeatFinder() : fHeat(0) {}
+	bool	operator()(Stmt *s);
 
-Program *gProgram;
+	long	GetHeat() const	{ return fHeat; }
 
+private:
+	long	fHeat;
+};
+
+
+// keeps the errors of a dry run away from the real handler
+class ProbeErrors : public ErrorHandler
+{
+public:
+			// the base class registers the probe, so the caller has to
+			// pass the handler to put back
+			ProbeErrors(ErrorHandler *previous) : fPrevious(previous) { Reset(); }
+			~ProbeErrors()	{ CompileContext::Get()->fErrorHandler = fPrevious; }
+
+	void	AddError(const Error &, const LexLocation *) {}
+
+private:
+	ErrorHandler*	fPrevious;
+};
 
 
 Program::Program(const RCX_Target *target) :
@@ -49,30 +145,78 @@ Program::Program(const RCX_Target *target) :
 	fInitLocation.fIndex = kIllegalSrcIndex;
 	fGlobalDecls = new BlockStmt();
 	fVirtualVarCount = 0;
+	fSharedFunctions = 0;
+	fOutline = false;
+	fOptimize = kFullOptimize;
+	fVolatileSources = true;
+	fSourceTags = true;
+	fObject = false;
+	fMainFirst = false;
+	fProfile = 0;
+	fFragmentCache = 0;
+	fSizeReport = false;
 }
 
 
 Program::~Program()
 {
+	// symbols outlive the program
+	for(Fragment *f=fTasks.GetHead(); f; f=f->GetNext())
+		f->GetName()->GetProgramNames().fTask = 0;
+	for(Fragment *f=fSubs.GetHead(); f; f=f->GetNext())
+		f->GetName()->GetProgramNames().fSub = 0;
+	for(Fragment *f=fDeclarations.GetHead(); f; f=f->GetNext())
+	{
+		ProgramNames &names = f->GetName()->GetProgramNames();
+		(f->IsTask() ? names.fTask : names.fSub) = 0;
+	}
+	for(FunctionDef *f=fFunctions.GetHead(); f; f=f->GetNext())
+		f->GetName()->GetProgramNames().fFunction = 0;
+	for(Resource *r=fResources.GetHead(); r; r=r->GetNext())
+		r->GetName()->GetProgramNames().fResource = 0;
+
 	while(Fragment *f=fTasks.RemoveHead())
 		delete f;
 
 	while(Fragment *f=fSubs.RemoveHead())
 		delete f;
 
+	while(Fragment *f=fDeclarations.RemoveHead())
+		delete f;
+
 	while(Scope *s=fScopes.RemoveHead())
 		delete s;
 
+	// functions at the head of the list belong to a saved State
+	for(int i=0; i<fSharedFunctions; ++i)
+		fFunctions.RemoveHead();
+
 	while(FunctionDef *func = fFunctions.RemoveHead())
 		delete func;
 
 	delete fGlobalDecls;
+
+	for(map<ExpansionKey, Stmt*>::iterator i=fExpansions.begin(); i!=fExpansions.end(); ++i)
+		delete i->second;
+
+	for(map<const FunctionDef*, Stmt*>::iterator i=fFunctionBodies.begin(); i!=fFunctionBodies.end(); ++i)
+		delete i->second;
 }
 
 
 int Program::AddFragment(Fragment *f)
 {
-	CheckName(f->GetName());
+	ProgramNames &names = f->GetName()->GetProgramNames();
+	Fragment *&first = f->IsTask() ? names.fTask : names.fSub;
+
+	// the definition of a declared task or sub takes its number
+	Fragment *declaration = (first && first->IsDeclaration()) ? first : 0;
+
+	// outlined functions keep the function's name
+	if (!f->GetFunction() && !declaration)
+		CheckName(f->GetName());
+
+	if (!first || declaration) first = f;
 
 	if (f->IsTask()) {
 		if (f->GetName() == Symbol::Get("main"))
@@ -91,16 +235,135 @@ int Program::AddFragment(Fragment *f)
 		fSubs.InsertTail(f);
 	}
 
+	if (declaration)
+		return declaration->GetNumber();
+
 	int type = f->GetChunkType();
 	return fChunkNumbers[type]++;
 }
 
 
+void Program::DeclareFragment(bool isTask, Symbol *name)
+{
+	ProgramNames &names = name->GetProgramNames();
+	Fragment *&first = isTask ? names.fTask : names.fSub;
+
+	// declaring it again, or after its definition, changes nothing
+	if (first) return;
+
+	CheckName(name);
+
+	RCX_ChunkType type = isTask ? kRCX_TaskChunk : kRCX_SubChunk;
+	int number;
+	if (isTask && name == Symbol::Get("main"))
+		number = fTarget->fRanges[type].fBase;
+	else
+		number = fChunkNumbers[type]++;
+
+	first = new Fragment(isTask, name, number);
+	fDeclarations.InsertTail(first);
+}
+
+
+
+const Stmt* Program::GetExpansion(FunctionDef *func, const vector<int> &args, Mapping *mapping)
+{
+	Stmt *&body = fExpansions[ExpansionKey(func, args)];
+
+	if (!body)
+		body = GetFunctionBody(func)->Clone(mapping);
+
+	return body;
+}
+
+
+/*
+ * Expansions share what they don't change with the body they were
+ * cloned from, and folding an expansion folds those parts of the body
+ * too.  That is fine for this program, but the functions of a saved
+ * State outlive it: the folded nodes would be freed along with the
+ * program, and later programs may fold differently (or not at all).
+ * So the bodies of those are copied for each program.
+ */
+const Stmt* Program::GetFunctionBody(FunctionDef *func)
+{
+	map<const FunctionDef*, Stmt*>::iterator i = fFunctionBodies.find(func);
+	if (i == fFunctionBodies.end())
+	{
+		Stmt *copy = 0;
+
+		// functions at the head of the list belong to a saved State
+		int n = 0;
+		for(FunctionDef *f=fFunctions.GetHead(); f && n<fSharedFunctions; f=f->GetNext(), ++n)
+		{
+			if (f == func)
+			{
+				copy = func->GetBody()->Clone(0);
+				break;
+			}
+		}
+
+		i = fFunctionBodies.insert(std::make_pair(func, copy)).first;
+	}
+
+	return i->second ? i->second : func->GetBody();
+}
+
 
 void Program::AddFunction(FunctionDef *f)
 {
 	CheckName(f->GetName());
 	fFunctions.InsertTail(f);
+
+	ProgramNames &names = f->GetName()->GetProgramNames();
+	if (!names.fFunction) names.fFunction = f;
+}
+
+
+void Program::SaveState(State &state)
+{
+	state.fFunctions.clear();
+	for(FunctionDef *f = fFunctions.GetHead(); f; f=f->GetNext())
+		state.fFunctions.push_back(f);
+
+	state.fVirtualVarCount = fVirtualVarCount;
+	state.fInitName = fInitName;
+	state.fInitLocation = fInitLocation;
+	state.fOutline = fOutline;
+	state.fVolatileSources = fVolatileSources;
+	state.fVarAllocator = fVarAllocator;
+
+	// the functions are now owned by the state
+	fSharedFunctions = state.fFunctions.size();
+}
+
+
+void Program::RestoreState(const State &state)
+{
+	// names were already checked when the state was saved
+	for(size_t i=0; i<state.fFunctions.size(); ++i)
+	{
+		FunctionDef *f = state.fFunctions[i];
+
+		fFunctions.InsertTail(f);
+		f->GetName()->GetProgramNames().fFunction = f;
+	}
+
+	fSharedFunctions = state.fFunctions.size();
+	fVirtualVarCount = state.fVirtualVarCount;
+	fInitName = state.fInitName;
+	fInitLocation = state.fInitLocation;
+	fOutline = state.fOutline;
+	fVolatileSources = state.fVolatileSources;
+	fVarAllocator = state.fVarAllocator;
+}
+
+
+bool Program::HasOnlyFunctions() const
+{
+	return !fTasks.GetHead() && !fSubs.GetHead() && !fDeclarations.GetHead() &&
+		!fResources.GetHead() && !fGlobalDecls->GetHead() &&
+		fScopes.GetTail()->IsEmpty();
 }
 
 
@@ -133,14 +396,32 @@ void Program::AddResource(Resource *r)
 		return;
 	}
 
-	if (fChunkNumbers[type] >= fTarget->GetChunkLimit(type))
+	// resources can't change, so identical ones can share a chunk
+	Resource *same = 0;
+	if (fOptimize >= kBasicOptimize)
+	{
+		for(same=fResources.GetHead(); same; same=same->GetNext())
+			if (!same->IsAlias() && same->Matches(r)) break;
+	}
+
+	if (same)
+	{
+		r->SetNumber(same->GetNumber());
+		r->SetAlias(true);
+		CompileStats::Get().Count(CompileStats::kSavedByteCounter, r->GetLength());
+	}
+	else if (fChunkNumbers[type] >= fTarget->GetChunkLimit(type))
 	{
 		Error(kErr_TooManyResources, fTarget->fRanges[type].fCount).RaiseLex();
 		return;
 	}
+	else
+		r->SetNumber(fChunkNumbers[type]++);
 
-	r->SetNumber(fChunkNumbers[type]++);
 	fResources.InsertTail(r);
+
+	ProgramNames &names = r->GetName()->GetProgramNames();
+	if (!names.fResource) names.fResource = r;
 }
 
 
@@ -213,37 +494,203 @@ void Program::SetInitName(Symbol *name, LexLocation *location)
 
 RCX_Image*	Program::CreateImage()
 {
+	CompileStats::Timer timer(CompileStats::kImagePhase);
 	RCX_Image *image;
 
-	image = new RCX_Image();
+	image = fObject ? new RCX_Object() : new RCX_Image();
 	image->SetTargetType(fTarget->fType);
 
+	if (fObject && !CheckObject()) return image;
 	if (!AllocateGlobals(image)) return image;
-	if (!PrepareMainTask()) return image;
+	// an object without main leaves the globals to the one with it
+	if ((fMainAdded || !fObject) && !PrepareMainTask()) return image;
 	if (!CheckFragments()) return image;
 
-	// emit subs
+	// the tasks of other objects may call any of an object's subs
+	if (fObject)
+	{
+		for(Fragment *sub=fSubs.GetHead(); sub; sub=sub->GetNext())
+			sub->AssignTaskID(Fragment::kMultiTaskID);
+	}
+
+	// emit subs, leaving out the ones no task can reach, then tasks
+	set<Fragment*> called;
+	FindCalledSubs(called);
+
+	vector<Fragment*> fragments;
 	for(Fragment *sub=fSubs.GetHead(); sub; sub=sub->GetNext())
-		EncodeFragment(image, sub);
+	{
+		if (called.count(sub) || fOptimize < kBasicOptimize || fObject)
+			fragments.push_back(sub);
+	}
 
-	// emit tasks
 	for(Fragment *task=fTasks.GetHead(); task; task=task->GetNext())
-		EncodeFragment(image, task);
+		fragments.push_back(task);
+
+	// the chunks main needs, if the rest can wait until it's running
+	int startChunks = 0;
+	if (fMainFirst && !fObject)
+		startChunks = OrderMainFirst(fragments);
+
+	fFragmentSizes.clear();
+	fFunctionSizes.clear();
+
+	if (fFragmentCache && !fProfile)
+	{
+		fFragmentCache->Begin();
+		fProgramKey = GetProgramKey();
+	}
+
+	vector<Bytecode*> code;
+	vector<CachedCode> cached(fragments.size());
+	for(size_t i=0; i<fragments.size(); ++i)
+		code.push_back(EncodeFragment(image, fragments[i], cached[i]));
+
+	ApplyFixups(code);
+
+	for(size_t i=0; i<fragments.size(); ++i)
+	{
+		FragmentCache::Entry *e = cached[i].fEntry;
+		if (!e) continue;
+
+		if (ErrorHandler::Get()->GetErrorCount())
+		{
+			delete e;
+			continue;
+		}
+
+		Bytecode *b = code[i];
+		fFragmentCache->Add(cached[i].fKey, e, b->GetData(), b->GetLength(),
+			b->GetSourceTags(), b->GetSourceTagCount(), cached[i].fSpans);
+	}
+
+	// an inline function's code starts with a tag at its start
+	map<pair<int, long>, const FunctionDef*> starts;
+	if (fSizeReport)
+	{
+		for(FunctionDef *func=fFunctions.GetHead(); func; func=func->GetNext())
+		{
+			const LexLocation &loc = func->GetStartLoc();
+			starts[std::make_pair((int)loc.fIndex, loc.fOffset + loc.fLength-1)] = func;
+		}
+	}
+
+	for(size_t i=0; i<fragments.size(); ++i)
+	{
+		Fragment *f = fragments[i];
+		Bytecode *b = code[i];
+
+		if (fSizeReport)
+		{
+			fFragmentSizes[i].fLength = b->GetLength();
+			CountInlineCode(b, starts);
+		}
+
+		image->AddChunk(f->GetChunkType(), f->GetNumber(),
+			b->GetData(), b->GetLength(), f->GetName()->GetKey(),
+			fSourceTags ? b->GetSourceTags() : 0,
+			fSourceTags ? b->GetSourceTagCount() : 0);
+		CompileStats::Get().Count(CompileStats::kByteCounter, b->GetLength());
+		CompileStats::Get().Allocate(CompileStats::kImagePool, b->GetLength());
+
+		delete b;
+	}
 
 	// copy resources
 	for(Resource *r=fResources.GetHead(); r; r=r->GetNext())
 	{
+		if (r->IsAlias()) continue;
+
 		image->AddChunk(r->GetType(), r->GetNumber(),
 			r->GetData(), r->GetLength(), r->GetName()->GetKey(),
 			0, 0);
+		CompileStats::Get().Allocate(CompileStats::kImagePool, r->GetLength());
+
+		// main might play any sound
+		startChunks = 0;
+	}
+
+	if (startChunks < image->GetChunkCount())
+		image->SetStartChunks(startChunks);
+
+	if (fObject)
+	{
+		RCX_Object *object = static_cast<RCX_Object *>(image);
+		string bad;
+
+		if (object->FindRelocations(bad))
+			AddImports(object);
+		else
+			Error(kErr_NotRelocatable, ("the arrays, pointers or asm of '" + bad + "'").c_str()).Raise(0);
 	}
 
 	return image;
 }
 
 
-void Program::EncodeFragment(RCX_Image *image, Fragment *f)
+/**
+ * Checks what an object can't have: a target whose code can't be
+ * relocated, or initial values for globals when main (which would
+ * set them) is in another object.
+ */
+bool Program::CheckObject()
 {
+	if (!RCX_Object::CanRelocate(fTarget->fType))
+	{
+		Error(kErr_NotRelocatable, (string(fTarget->fName) + " code").c_str()).Raise(0);
+		return false;
+	}
+
+	if (fMainAdded) return true;
+
+	bool ok = true;
+	for(Stmt *s=fGlobalDecls->GetHead(); s; s=s->GetNext())
+	{
+		DeclareStmt *dec = dynamic_cast<DeclareStmt*>(s);
+		if (dec && dec->GetBody())
+		{
+			Error(kErr_NotRelocatable, "an initialized global without task main").Raise(&dec->GetLoc());
+			ok = false;
+		}
+	}
+
+	return ok;
+}
+
+
+/**
+ * Adds the declared tasks and subs that an object's code uses, and
+ * that it doesn't define, as imports.
+ */
+void Program::AddImports(RCX_Object *object)
+{
+	set<int> used[kRCX_ChunkTypeCount];
+
+	for(int i=0; i<object->GetRelocationCount(); ++i)
+	{
+		const RCX_Object::Relocation &r = object->GetRelocation(i);
+		const RCX_Image::Chunk *c = object->FindCode(r.fChunkType, r.fChunkNumber);
+
+		if (r.fType == RCX_Disasm::Reference::kSub)
+			used[kRCX_SubChunk].insert(c->GetData()[r.fOffset]);
+		else if (r.fType == RCX_Disasm::Reference::kTask)
+			used[kRCX_TaskChunk].insert(c->GetData()[r.fOffset]);
+	}
+
+	for(Fragment *f=fDeclarations.GetHead(); f; f=f->GetNext())
+	{
+		ProgramNames &names = f->GetName()->GetProgramNames();
+		Fragment *current = f->IsTask() ? names.fTask : names.fSub;
+
+		if (current == f && used[f->GetChunkType()].count(f->GetNumber()))
+			object->AddImport(f->GetChunkType(), f->GetNumber(), f->GetName()->GetKey());
+	}
+}
+
+
+Bytecode* Program::EncodeFragment(RCX_Image *image, Fragment *f, CachedCode &cached)
+{
+	CompileStats::Timer timer(CompileStats::kEncodePhase);
 	Bytecode *b = new Bytecode(fVarAllocator, fTarget, image);
 
 	// determine variable allocation mode
@@ -255,16 +702,431 @@ void Program::EncodeFragment(RCX_Image *image, Fragment *f)
 	else
 		mode = VarAllocator::kSingleSubMode;
 
-	fVarAllocator.Begin(mode);
+	int group = VarAllocator::kNoGroup;
+	if (f->GetTaskID() >= 0 && fOptimize >= kFullOptimize)
+		group = f->GetTaskID();
 
-	f->Emit(*b);
-	image->AddChunk(f->GetChunkType(), f->GetNumber(),
-		b->GetData(), b->GetLength(), f->GetName()->GetKey(),
-		b->GetSourceTags(), b->GetSourceTagCount());
+	cached.fEntry = 0;
+	bool cache = fFragmentCache && !fProfile && GetFragmentKey(f, mode, group, cached);
+	const FragmentCache::Entry *e = cache ? fFragmentCache->Find(cached.fKey) : 0;
+	VarAllocator::Usage usage;
 
-	f->SetLocalMask(fVarAllocator.End());
+	if (e)
+	{
+		vector<RCX_SourceTag> tags;
+		FragmentCache::GetTags(*e, cached.fSpans, tags);
+		b->SetFixedCode(e->fData, tags);
 
-	delete b;
+		for(size_t i=0; i<e->fVariables.size(); ++i)
+			b->AddVariableName(e->fVariables[i].first, e->fVariables[i].second.c_str());
+
+		fVarAllocator = e->fAllocator;
+		f->SetLocalMask(e->fLocalMask);
+		usage = e->fUsage;
+		CompileStats::Get().Count(CompileStats::kReusedByteCounter, b->GetLength());
+	}
+	else
+	{
+		ErrorHandler *errors = ErrorHandler::Get();
+		int raised = errors->GetErrorCount() + errors->GetWarningCount();
+
+		fVarAllocator.Begin(mode, group);
+		f->Emit(*b);
+		fVarAllocator.GetUsage(usage);
+		f->SetLocalMask(fVarAllocator.End());
+
+		// reused code wouldn't raise the warnings again
+		if (cache && errors->GetErrorCount() + errors->GetWarningCount() == raised)
+		{
+			cached.fEntry = new FragmentCache::Entry(fVarAllocator);
+			cached.fEntry->fVariables = b->GetVariableNames();
+			cached.fEntry->fLocalMask = f->GetLocalMask();
+			cached.fEntry->fUsage = usage;
+		}
+	}
+
+	if (fSizeReport)
+	{
+		FragmentSize size;
+		size.fType = f->GetChunkType();
+		size.fNumber = f->GetNumber();
+		size.fName = f->GetName()->GetKey();
+		size.fLength = 0;
+		size.fUsage = usage;
+		fFragmentSizes.push_back(size);
+	}
+
+	return b;
+}
+
+
+/**
+ * The text from start to end (or to the end of the buffer if end is
+ * past it), as a FragmentCache span.  Returns false if start isn't
+ * in the source.
+ */
+static bool GetSpan(const LexLocation &start, const LexLocation &end, FragmentCache::Span &span)
+{
+	if (start.fIndex == kIllegalSrcIndex) return false;
+
+	span.fIndex = start.fIndex;
+	span.fStart = start.fOffset;
+
+	if (end.fIndex == start.fIndex && end.fOffset >= start.fOffset)
+		span.fEnd = end.fOffset + end.fLength;
+	else
+		span.fEnd = Compiler::Get()->GetBuffer(start.fIndex)->GetLength();
+
+	return true;
+}
+
+
+static bool SpanBefore(const FragmentCache::Span &a, const FragmentCache::Span &b)
+{
+	return a.fIndex < b.fIndex || (a.fIndex == b.fIndex && a.fStart < b.fStart);
+}
+
+
+/**
+ * A hash of what the code of every fragment depends on besides its own
+ * statements and text: the options, the chunk numbers, and the text of
+ * every buffer outside of the tasks, subs and functions (but not
+ * their names, so a file compiled under a new name can reuse code).
+ */
+FragmentCache::Key Program::GetProgramKey() const
+{
+	FragmentCache::Hash h;
+
+	h.Add((long)fTarget->fType);
+	h.Add((long)fOptimize);
+	h.Add((long)fVolatileSources);
+	h.Add((long)fSourceTags);
+	h.Add((long)fSizeReport);
+	h.Add((long)fObject);
+	h.Add((long)fOutline);
+
+	vector<FragmentCache::Span> spans;
+	FragmentCache::Span span;
+	const Fragment *lists[] = { fTasks.GetHead(), fSubs.GetHead(), fDeclarations.GetHead() };
+
+	for(int i=0; i<3; ++i)
+	{
+		for(const Fragment *f=lists[i]; f; f=f->GetNext())
+		{
+			h.Add((long)f->GetChunkType());
+			h.Add((long)f->GetNumber());
+			h.Add(f->GetName()->GetKey());
+
+			if (!f->IsDeclaration() && GetSpan(f->GetStartLoc(), f->GetEndLoc(), span))
+				spans.push_back(span);
+		}
+	}
+
+	for(const Resource *r=fResources.GetHead(); r; r=r->GetNext())
+	{
+		h.Add((long)r->GetType());
+		h.Add((long)r->GetNumber());
+		h.Add(r->GetName()->GetKey());
+	}
+
+	for(const FunctionDef *func=fFunctions.GetHead(); func; func=func->GetNext())
+	{
+		if (GetSpan(func->GetStartLoc(), func->GetEndLoc(), span))
+			spans.push_back(span);
+	}
+
+	sort(spans.begin(), spans.end(), SpanBefore);
+
+	Compiler *compiler = Compiler::Get();
+	size_t next = 0;
+
+	for(int i=0; i<compiler->GetCount(); ++i)
+	{
+		const Buffer *buf = compiler->GetBuffer(i);
+		const char *data = buf->GetData();
+		long pos = 0;
+
+		for(; next < spans.size() && spans[next].fIndex == i; ++next)
+		{
+			if (spans[next].fStart > pos)
+				h.Add(data + pos, spans[next].fStart - pos);
+			if (spans[next].fEnd > pos)
+				pos = spans[next].fEnd;
+		}
+
+		if (buf->GetLength() > pos)
+			h.Add(data + pos, buf->GetLength() - pos);
+		h.Add((long)i);
+	}
+
+	return h.Get();
+}
+
+
+static void HashExpr(FragmentCache::Hash &h, const Expr *e)
+{
+	if (!e)
+	{
+		h.Add(0L);
+		return;
+	}
+
+	h.Add(typeid(*e).name());
+	h.Add((long)e->GetLValue());
+
+	// other expressions can raise errors when evaluated
+	if (dynamic_cast<const AtomExpr*>(e))
+		h.Add((long)e->GetStaticEA());
+
+	h.Add((long)e->GetExprCount());
+	for(int i=0; i<e->GetExprCount(); ++i)
+		HashExpr(h, e->GetExpr(i));
+}
+
+
+/**
+ * Adds the kind of each statement and expression in s to h, with the
+ * values and vars of the atoms, and appends the inline functions
+ * expanded in s to functions (each once).
+ */
+static void HashStmt(FragmentCache::Hash &h, Stmt *s, vector<const FunctionDef*> &functions)
+{
+	h.Add(typeid(*s).name());
+	h.Add((long)s->GetMustEmit());
+
+	if (InlineStmt *in = dynamic_cast<InlineStmt*>(s))
+	{
+		const FunctionDef *func = in->GetFunction();
+		size_t i = find(functions.begin(), functions.end(), func) - functions.begin();
+
+		if (i == functions.size())
+			functions.push_back(func);
+		h.Add((long)i);
+	}
+
+	h.Add((long)s->GetExprCount());
+	for(int i=0; i<s->GetExprCount(); ++i)
+		HashExpr(h, s->GetExpr(i));
+
+	for(Stmt *c=s->GetChildren(); c; c=c->GetNext())
+		HashStmt(h, c, functions);
+
+	// the end of the children
+	h.Add(-1L);
+}
+
+
+/**
+ * The FragmentCache key of f's code, when encoded in the given
+ * VarAllocator mode and group from the allocator's current state, and
+ * the spans that its source tags point into.  Returns false if its
+ * code can't be kept.
+ */
+bool Program::GetFragmentKey(Fragment *f, int mode, int group, CachedCode &cached) const
+{
+	FragmentCache::Hash h;
+	FragmentCache::Span span;
+
+	h.Add(&fProgramKey, sizeof(fProgramKey));
+	h.Add((long)mode);
+	h.Add((long)group);
+	h.Add((long)f->GetChunkType());
+	h.Add((long)f->GetNumber());
+	h.Add((long)f->GetTaskID());
+
+	for(int i=0; i<f->GetArgCount(); ++i)
+	{
+		h.Add((long)f->GetArgType(i));
+		h.Add((long)f->GetArgVar(i));
+	}
+
+	// an outlined function's sub has no text of its own
+	bool hasSpan = GetSpan(f->GetStartLoc(), f->GetEndLoc(), span);
+	h.Add((long)hasSpan);
+
+	cached.fSpans.clear();
+	if (hasSpan)
+		cached.fSpans.push_back(span);
+
+	vector<const FunctionDef*> functions;
+	HashStmt(h, f->GetBody(), functions);
+
+	for(size_t i=0; i<functions.size(); ++i)
+	{
+		if (!GetSpan(functions[i]->GetStartLoc(), functions[i]->GetEndLoc(), span))
+			return false;
+		cached.fSpans.push_back(span);
+	}
+
+	for(size_t i=0; i<cached.fSpans.size(); ++i)
+	{
+		const FragmentCache::Span &s = cached.fSpans[i];
+		const char *data = Compiler::Get()->GetBuffer(s.fIndex)->GetData();
+
+		h.Add(data + s.fStart, s.fEnd - s.fStart);
+		h.Add(s.fEnd - s.fStart);
+	}
+
+	vector<ULong> state;
+	fVarAllocator.GetState(state);
+	h.Add(&state[0], state.size() * sizeof(ULong));
+
+	cached.fKey = h.Get();
+	return true;
+}
+
+
+/**
+ * Adds the bytes between the begin and end tags of each inline function
+ * in b to the function's size.  A function inlined in another one counts
+ * toward both.
+ */
+void Program::CountInlineCode(const Bytecode *b, const map<pair<int, long>, const FunctionDef*> &starts)
+{
+	const RCX_SourceTag *tags = b->GetSourceTags();
+	// the function (0 for the fragment) and address of each open begin tag
+	vector<pair<const FunctionDef*, int> > open;
+
+	for(int i=0; i<b->GetSourceTagCount(); ++i)
+	{
+		const RCX_SourceTag &t = tags[i];
+
+		if (t.fType == RCX_SourceTag::kBegin || t.fType == RCX_SourceTag::kBeginNoList)
+		{
+			map<pair<int, long>, const FunctionDef*>::const_iterator start =
+				starts.find(std::make_pair((int)t.fSrcIndex, t.fSrcOffset));
+			open.push_back(std::make_pair(start == starts.end() ? (const FunctionDef*)0 : start->second,
+				(int)t.fAddress));
+		}
+		else if (t.fType == RCX_SourceTag::kEnd && !open.empty())
+		{
+			if (open.back().first)
+			{
+				FunctionSize &size = fFunctionSizes[open.back().first];
+				size.fCount++;
+				size.fLength += t.fAddress - open.back().second;
+			}
+			open.pop_back();
+		}
+	}
+}
+
+
+typedef pair<const FunctionDef*, pair<int, int> > FunctionCount;
+
+static bool MoreBytes(const FunctionCount &a, const FunctionCount &b)
+{
+	return a.second.first > b.second.first;
+}
+
+
+/**
+ * Prints the bytes and variables of each task and sub, then the bytes
+ * of each inline function from the most to the least, as found by the
+ * last CreateImage() with SetSizeReport(true).
+ */
+void Program::PrintSizeReport(FILE *fp) const
+{
+	fprintf(fp, "%-4s %3s %-24s %6s %7s %6s %5s\n",
+		"", "", "", "bytes", "globals", "locals", "temps");
+
+	for(size_t i=0; i<fFragmentSizes.size(); ++i)
+	{
+		const FragmentSize &f = fFragmentSizes[i];
+
+		fprintf(fp, "%-4s %3d %-24s %6d %7d %6d %5d\n",
+			f.fType == kRCX_TaskChunk ? "task" : "sub", f.fNumber,
+			f.fName.c_str(), f.fLength, f.fUsage.fGlobals,
+			f.fUsage.fLocals, f.fUsage.fTemps);
+	}
+
+	// bytes and times inlined
+	vector<FunctionCount> functions;
+	for(map<const FunctionDef*, FunctionSize>::const_iterator i=fFunctionSizes.begin();
+		i!=fFunctionSizes.end(); ++i)
+	{
+		functions.push_back(std::make_pair(i->first, std::make_pair(i->second.fLength, i->second.fCount)));
+	}
+
+	if (functions.empty()) return;
+
+	stable_sort(functions.begin(), functions.end(), MoreBytes);
+
+	fprintf(fp, "%-33s %6s %5s\n", "inline function", "bytes", "times");
+	for(size_t i=0; i<functions.size(); ++i)
+	{
+		fprintf(fp, "%-33s %6d %5d\n", functions[i].first->GetName()->GetKey(),
+			functions[i].second.first, functions[i].second.second);
+	}
+}
+
+
+#ifndef NO_THREADS
+
+struct FixupQueue
+{
+	const vector<Bytecode*>	*fCode;
+	std::atomic<size_t>	fNext;
+};
+
+static void RunFixups(FixupQueue *queue)
+{
+	size_t i;
+	while((i = queue->fNext++) < queue->fCode->size())
+		(*queue->fCode)[i]->ApplyFixups();
+}
+
+#endif
+
+
+/*
+ * Emitting shares the variable allocator, the error handler and the
+ * rest of the compiler's state, so fragments are emitted one at a time.
+ * Optimizing and fixing up the code only touches each fragment's own
+ * Bytecode, so for a big program that work is shared between threads.
+ */
+void Program::ApplyFixups(const vector<Bytecode*> &code)
+{
+	CompileStats::Timer timer(CompileStats::kFixupPhase);
+	int length = 0;
+
+	for(size_t i=0; i<code.size(); ++i)
+		length += code[i]->GetLength();
+
+#ifndef NO_THREADS
+	size_t jobs = std::thread::hardware_concurrency();
+	if (jobs > code.size())
+		jobs = code.size();
+
+	if (jobs > 1 && length >= kParallelFixupLength)
+	{
+		FixupQueue queue;
+		queue.fCode = &code;
+		queue.fNext = 0;
+
+		// the calling thread is one of the workers
+		vector<std::thread *> threads;
+		for(size_t i=1; i<jobs; ++i)
+			threads.push_back(new std::thread(RunFixups, &queue));
+
+		RunFixups(&queue);
+
+		for(size_t i=0; i<threads.size(); ++i) {
+			threads[i]->join();
+			delete threads[i];
+		}
+	}
+	else
+#endif
+	{
+		for(size_t i=0; i<code.size(); ++i)
+			code[i]->ApplyFixups();
+	}
+
+	for(size_t i=0; i<code.size(); ++i)
+		length -= code[i]->GetLength();
+
+	CompileStats::Get().Count(CompileStats::kSavedByteCounter, length);
 }
 
 
@@ -314,6 +1176,11 @@ bool Program::CheckFragments()
 {
 	bool ok = true;
 
+	// an outlined sub keeps the function's name, which another object
+	// could give its own copy
+	if (((fOutline && fOptimize >= kFullOptimize) || fOptimize == kSizeOptimize) && !fObject)
+		OutlineFunctions();
+
 	if (fChunkNumbers[kRCX_TaskChunk] > fTarget->GetChunkLimit(kRCX_TaskChunk))
 	{
 		Error(kErr_TooManyTasks, fTarget->fRanges[kRCX_TaskChunk].fCount).Raise(0);
@@ -341,12 +1208,265 @@ bool Program::CheckFragments()
 }
 
 
+void Program::FindCalledSubs(set<Fragment*> &subs)
+{
+	vector<Fragment*> pending;
+	SubFinder finder(subs, pending);
+
+	for(Fragment *task=fTasks.GetHead(); task; task=task->GetNext())
+		Apply(task->GetBody(), finder);
+
+	// subs can call other subs on targets with sub parameters
+	while(!pending.empty())
+	{
+		Fragment *sub = pending.back();
+		pending.pop_back();
+		Apply(sub->GetBody(), finder);
+	}
+}
+
+
+/**
+ * Puts main first in fragments, then what it can call or start, nearest
+ * first and subs before tasks, then the rest.  Returns how many it can
+ * reach (and so have to be on the brick before it starts), or 0 if an
+ * asm statement might call or start anything.
+ */
+int Program::OrderMainFirst(vector<Fragment*> &fragments)
+{
+	set<Fragment*> emitted(fragments.begin(), fragments.end());
+	set<Fragment*> placed;
+	vector<Fragment*> order;
+	bool unknown = false;
+
+	order.push_back(fTasks.GetHead());
+	placed.insert(order[0]);
+
+	for(size_t i=0; i<order.size(); ++i)
+	{
+		vector<Fragment*> found;
+		StartFinder finder(found);
+		Apply(order[i]->GetBody(), finder);
+		unknown = unknown || finder.IsUnknown();
+
+		for(int tasks=0; tasks<2; ++tasks)
+		{
+			for(size_t j=0; j<found.size(); ++j)
+			{
+				Fragment *f = found[j];
+				if ((f->GetChunkType() == kRCX_TaskChunk) != (tasks != 0)) continue;
+				if (emitted.count(f) && placed.insert(f).second)
+					order.push_back(f);
+			}
+		}
+	}
+
+	int reached = (int)order.size();
+	for(size_t i=0; i<fragments.size(); ++i)
+	{
+		if (!placed.count(fragments[i]))
+			order.push_back(fragments[i]);
+	}
+
+	fragments.swap(order);
+	return unknown ? 0 : reached;
+}
+
+
+/**
+ * Turns inline functions into subs when the copies cost more than a
+ * single sub plus a gosub for each call.  Only functions without
+ * arguments are candidates, so that the generated code doesn't
+ * depend on the target's sub parameters.  The size of a copy comes
+ * from a dry run of the expansion.
+ */
+void Program::OutlineFunctions()
+{
+	map<const Symbol*, int> calls;
+	CallCounter counter(calls);
+	Fragment *f;
+
+	for(f=fTasks.GetHead(); f; f=f->GetNext())
+		Apply(f->GetBody(), counter);
+	for(f=fSubs.GetHead(); f; f=f->GetNext())
+		Apply(f->GetBody(), counter);
+	for(FunctionDef *func=fFunctions.GetHead(); func; func=func->GetNext())
+		Apply(func->GetBody(), counter);
+
+	for(FunctionDef *func=fFunctions.GetHead(); func; func=func->GetNext())
+	{
+		const Symbol *name = func->GetName();
+		int count = calls[name];
+
+		if (count < 2 || func->GetArgCount() != 0 || name == fInitName)
+			continue;
+		if (fChunkNumbers[kRCX_SubChunk] >= fTarget->GetChunkLimit(kRCX_SubChunk))
+			break;
+
+		int size = MeasureFunction(func);
+		int savings = (fOptimize == kSizeOptimize) ? kMinSizeSavings : kMinOutlineSavings;
+		if (size < 0 || count * size < size + count * kGosubSize + savings)
+			continue;
+
+		new Fragment(func);
+	}
+}
+
+
+/**
+ * Returns the size of an expanded copy of a function, or -1 if it
+ * can't be turned into a sub without errors.
+ */
+int Program::MeasureFunction(FunctionDef *func)
+{
+	// expanding calls to subs assigns task ids, which the dry run
+	// must leave alone
+	vector<int> taskIDs;
+	Fragment *sub;
+	for(sub=fSubs.GetHead(); sub; sub=sub->GetNext())
+		taskIDs.push_back(sub->GetTaskID());
+
+	int size = -1;
+	{
+		ProbeErrors errors(ErrorHandler::Get());
+		Fragment *probe = new Fragment(false);
+		probe->SetBody(new InlineStmt(func->GetBody()->Clone(0), func));
+
+		probe->Check();
+		if (errors.GetErrorCount() == 0)
+		{
+			VarAllocator allocator(fTarget->fMaxGlobalVars, fTarget->fMaxTaskVars);
+			RCX_Image image;
+			Bytecode b(allocator, fTarget, &image);
+
+			allocator.Begin(VarAllocator::kMultiSubMode);
+			probe->Emit(b);
+			allocator.End();
+
+			// fixups are left to CreateImage(), but the size has to be
+			// measured after them
+			b.ApplyFixups();
+
+			if (errors.GetErrorCount() == 0)
+				size = b.GetLength();
+		}
+
+		delete probe;
+	}
+
+	size_t i = 0;
+	for(sub=fSubs.GetHead(); sub; sub=sub->GetNext())
+		sub->RestoreTaskID(taskIDs[i++]);
+
+	return size;
+}
+
+
+bool CallCounter::operator()(Stmt *s)
+{
+	// hot calls stay inline, so only the others would share a sub
+	if (CallStmt *c = dynamic_cast<CallStmt*>(s))
+		if (!gProgram->IsHot(c))
+			fCalls[c->GetName()]++;
+
+	return true;
+}
+
+
+bool HeatFinder::operator()(Stmt *s)
+{
+	long heat = gProgram->GetHeat(s->GetLoc());
+	if (heat > fHeat) fHeat = heat;
+
+	return true;
+}
+
+
+long Program::GetHeat(const LexLocation &loc) const
+{
+	if (!fProfile) return -1;
+
+	Compiler *c = Compiler::Get();
+	return fProfile->GetCount(c->GetName(loc.fIndex), c->GetLine(loc.fIndex, loc.fOffset));
+}
+
+
+long Program::GetHeat(const Stmt *s) const
+{
+	if (!fProfile || !s) return -1;
+
+	HeatFinder h;
+	Apply(const_cast<Stmt*>(s), h);
+	return h.GetHeat();
+}
+
+
+bool Program::IsHot(Stmt *s) const
+{
+	if (!fProfile || fProfile->GetMax() == 0) return false;
+
+	// the code of an inline function is counted on the function's
+	// lines, so a call is as hot as the statements next to it
+	long heat = GetHeat(s);
+	if (BlockStmt *b = dynamic_cast<BlockStmt*>(s->GetParent()))
+	{
+		Stmt *prev = 0;
+		for(Stmt *c=b->GetHead(); c && c != s; c=c->GetNext())
+			prev = c;
+
+		heat = std::max(heat, std::max(GetHeat(prev), GetHeat(s->GetNext())));
+	}
+
+	return heat * kHotFraction >= fProfile->GetMax();
+}
+
+
+bool SubFinder::operator()(Stmt *s)
+{
+	Fragment *f = 0;
+
+	if (GosubStmt *g = dynamic_cast<GosubStmt*>(s))
+		f = g->GetFragment();
+	else if (GosubParamStmt *g = dynamic_cast<GosubParamStmt*>(s))
+		f = g->GetFragment();
+
+	if (f && fSubs.insert(f).second)
+		fPending.push_back(f);
+
+	return true;
+}
+
+
+bool StartFinder::operator()(Stmt *s)
+{
+	Fragment *f = 0;
+
+	if (GosubStmt *g = dynamic_cast<GosubStmt*>(s))
+		f = g->GetFragment();
+	else if (GosubParamStmt *g = dynamic_cast<GosubParamStmt*>(s))
+		f = g->GetFragment();
+	else if (TaskStmt *t = dynamic_cast<TaskStmt*>(s))
+		f = gProgram->GetTask(t->GetName());
+	else if (AsmStmt *a = dynamic_cast<AsmStmt*>(s))
+	{
+		int op;
+		if (a->GetExprCount() && (!a->GetExpr(0)->Evaluate(op) ||
+			(op & 0xf7) == kRCX_StartTaskOp || (op & 0xf7) == kRCX_GoSubOp))
+			fUnknown = true;
+	}
+
+	if (f) fFound.push_back(f);
+
+	return true;
+}
+
+
 bool Program::Defined(const Symbol *name) const
 {
-	if (Find(fTasks, name)) return true;
-	if (Find(fSubs, name)) return true;
-	if (Find(fFunctions, name)) return true;
-	if (Find(fResources, name)) return true;
+	const ProgramNames &names = name->GetProgramNames();
+
+	if (names.fTask || names.fSub || names.fFunction || names.fResource)
+		return true;
 
 	return fScopes.GetTail()->Contains(name);
 }
@@ -368,6 +1488,8 @@ void Program::PopScope()
 
 bool Program::AllocateGlobals(RCX_Image *image)
 {
+	VarTranslator vt;
+
 	for(Stmt *s=fGlobalDecls->GetHead(); s; s=s->GetNext())
 	{
 		DeclareStmt *dec = dynamic_cast<DeclareStmt*>(s);
@@ -384,17 +1506,18 @@ bool Program::AllocateGlobals(RCX_Image *image)
 		}
 
 		image->SetVariable(to, dec->GetName()->GetKey());
-		TranslateVar(from, to);
+		if (fObject)
+			static_cast<RCX_Object *>(image)->AddGlobal(to, dec->GetCount(), dec->GetName()->GetKey());
+		vt.Add(from, to);
 	}
 
+	TranslateVars(vt);
 	return true;
 }
 
 
-void Program::TranslateVar(int from, int to)
+void Program::TranslateVars(VarTranslator &vt)
 {
-	VarTranslator vt(from, to);
-
 	for(Fragment *f=fTasks.GetHead(); f; f=f->GetNext())
 		Apply(f->GetBody(), vt);
 
@@ -54,10 +54,22 @@
 #include "Resource.h"
 #endif
 
+#ifndef __FragmentCache_h
+#include "FragmentCache.h"
+#endif
+
 
 
+#include <cstdio>
+#include <map>
+#include <set>
+#include <string>
 #include <vector>
 
+using std::map;
+using std::pair;
+using std::set;
+using std::string;
 using std::vector;
 
 class Fragment;
@@ -65,32 +77,25 @@ class Resource;
 class FunctionDef;
 class Symbol;
 class RCX_Image;
+class RCX_Object;
 class Stmt;
 class BlockStmt;
+class Mapping;
+class Bytecode;
+class VarTranslator;
+class RCX_Profile;
 
-// useful templates to search through a list of named items
-
-template <class T> T*Find(PListS<T> &list, const Symbol *name)
-{
-	for(T *t = list.GetHead(); t; t=t->GetNext())
-	{
-		if (t->GetName() == name) return t;
-	}
-	return 0;
-}
-
-template <class T> const T*Find(const PListS<T> &list, const Symbol *name)
-{
-	for(T *t = list.GetHead(); t; t=t->GetNext())
-	{
-		if (t->GetName() == name) return t;
-	}
-	return 0;
-}
-
-
+#ifndef __Symbol_h
+#include "Symbol.h"
+#endif
 
 
+/*
+ * Tasks, subs, functions and resources are found through the
+ * ProgramNames of their symbols, which the Program fills in as they
+ * are added and clears when it is destroyed.  If a name is defined
+ * twice (an error), the first definition is the one that's found.
+ */
 class Program
 {
 public:
@@ -102,6 +107,8 @@ public:
 
 	// adding tasks and other stuff...
 	int	AddFragment(Fragment *f);
+	// a task or sub that is defined later, or in another object
+	void	DeclareFragment(bool isTask, Symbol *name);
 	void	AddResource(Resource *r);
 	void	AddFunction(FunctionDef *f);
 	void	AddGlobalDecls(BlockStmt *s);
@@ -115,10 +122,10 @@ public:
 	void	DefineVar(const Symbol *name, int var, bool array, bool ptr, bool stack);
 
 	// getting tasks, etc
-	Fragment*	GetTask(const Symbol *name) { return Find(fTasks, name); }
-	Fragment*	GetSub(const Symbol *name) { return Find(fSubs, name); }
-	FunctionDef*	GetFunction(const Symbol *name) { return Find(fFunctions, name); }
-	const Resource*	GetResource(const Symbol *name) const { return Find(fResources, name); }
+	Fragment*	GetTask(const Symbol *name) { return name->GetProgramNames().fTask; }
+	Fragment*	GetSub(const Symbol *name) { return name->GetProgramNames().fSub; }
+	FunctionDef*	GetFunction(const Symbol *name) { return name->GetProgramNames().fFunction; }
+	const Resource*	GetResource(const Symbol *name) const { return name->GetProgramNames().fResource; }
 
 	// check all symbols (tasks, variables, etc)
 	bool		Defined(const Symbol *name) const;
@@ -130,20 +137,138 @@ public:
 
 	bool		ReserveVars(int start, int end);
 
+	// the body of a function whose arguments are all constants, with
+	// the arguments substituted; calls with the same constants share it
+	const Stmt*	GetExpansion(FunctionDef *func, const vector<int> &args, Mapping *mapping);
+
+	// the body that a function's expansions are cloned from
+	const Stmt*	GetFunctionBody(FunctionDef *func);
+
+	// turn repeated inline functions into subs where that is smaller
+	void		SetOutline(bool outline)	{ fOutline = outline; }
+
+	// which passes run: kNoOptimize emits the code as written,
+	// kBasicOptimize adds the cheap local ones (folding, unreachable
+	// code, peephole, ...), and kFullOptimize adds the ones that look at
+	// whole loops, switches or the call graph.  kSizeOptimize runs the
+	// same passes as kFullOptimize, but picks the smaller code where
+	// they differ, merges common tails and outlines without a pragma.
+	enum
+	{
+		kNoOptimize = 0,
+		kBasicOptimize,
+		kFullOptimize,
+		kSizeOptimize
+	};
+
+	void		SetOptimize(int level)		{ fOptimize = level; }
+	int		GetOptimize() const		{ return fOptimize; }
+
+	// whether sensor, timer and event state reads may change within
+	// a statement (see ExprSharer); '#pragma nonvolatile' turns it off
+	// for the whole program
+	void		SetVolatileSources(bool v)	{ fVolatileSources = v; }
+	bool		GetVolatileSources() const	{ return fVolatileSources; }
+
+	// whether the code's source tags are recorded in the image
+	void		SetSourceTags(bool t)		{ fSourceTags = t; }
+	bool		GetSourceTags() const		{ return fSourceTags; }
+
+	// whether CreateImage() makes an RCX_Object, for linking with
+	// others: main and the subs that are only declared may be in
+	// other objects, and every sub may be called by their tasks
+	void		SetObject(bool o)		{ fObject = o; }
+	bool		IsObject() const		{ return fObject; }
+
+	// whether CreateImage() puts main first, then the subs it calls,
+	// then the rest of what it can run, so a download can start main
+	// before the tasks it can't run are sent (see SetStartChunks())
+	void		SetMainFirst(bool m)		{ fMainFirst = m; }
+
+	// whether CreateImage() records the bytes and variables of each
+	// task and sub, and the bytes of each inline function (found from
+	// the source tags, which are then kept even if the image doesn't
+	// get them), for PrintSizeReport()
+	void		SetSizeReport(bool r)		{ fSizeReport = r; }
+	bool		GetSizeReport() const		{ return fSizeReport; }
+	void		PrintSizeReport(FILE *fp) const;
+
+	// where CreateImage() keeps the code of each task and sub, and
+	// finds the ones that are the same as in an earlier compile (0 for
+	// none); the caller keeps the cache, which isn't used with a profile
+	void		SetFragmentCache(FragmentCache *c)	{ fFragmentCache = c; }
+
+	// how often each line ran in an emulated run (0 if there is no
+	// profile), so branches can lay out the code that runs most to
+	// fall through, and hot calls can stay inline
+	void		SetProfile(const RCX_Profile *p)	{ fProfile = p; }
+	bool		HasProfile() const		{ return fProfile != 0; }
+	// how many times the most run line of s ran (-1 without a profile)
+	long		GetHeat(const Stmt *s) const;
+	// how many times the line of loc ran (-1 without a profile)
+	long		GetHeat(const LexLocation &loc) const;
+	// true if s, or the code around it, is among the most run lines
+	bool		IsHot(Stmt *s) const;
+
+	// state that can be saved after parsing the API header (and the
+	// headers a source begins by including) and restored into a new
+	// Program (see Compiler snapshots)
+	struct State
+	{
+				State() : fVarAllocator(0, 0) {}
+
+		vector<FunctionDef*>	fFunctions;
+		int			fVirtualVarCount;
+		Symbol*			fInitName;
+		LexLocation		fInitLocation;
+		bool			fOutline;
+		bool			fVolatileSources;
+		VarAllocator		fVarAllocator;	// for #pragma reserve
+	};
+
+	void		SaveState(State &state);
+	void		RestoreState(const State &state);
+
+	// true if nothing but functions have been defined, so that the
+	// program is all in a State
+	bool		HasOnlyFunctions() const;
+
 private:
-	void		EncodeFragment(RCX_Image *image, Fragment *f);
+	// bytes of code below which fixups are applied without threads
+	enum { kParallelFixupLength = 4096 };
+
+	// a fragment's code to add to the FragmentCache once it's fixed up
+	struct CachedCode
+	{
+		FragmentCache::Key		fKey;
+		vector<FragmentCache::Span>	fSpans;
+		FragmentCache::Entry*		fEntry;
+	};
+
+	Bytecode*	EncodeFragment(RCX_Image *image, Fragment *f, CachedCode &cached);
+	FragmentCache::Key	GetProgramKey() const;
+	bool		GetFragmentKey(Fragment *f, int mode, int group, CachedCode &cached) const;
+	void		ApplyFixups(const vector<Bytecode*> &code);
 	void		CheckName(const Symbol *name);
 	bool		AllocateGlobals(RCX_Image *image);
 	bool		SetMainTask();
 	bool		PrepareMainTask();
+	bool		CheckObject();
+	void		AddImports(RCX_Object *object);
 	bool		CheckFragments();
+	void		FindCalledSubs(set<Fragment*> &subs);
+	int		OrderMainFirst(vector<Fragment*> &fragments);
+	void		OutlineFunctions();
+	int		MeasureFunction(FunctionDef *func);
 
-	void		TranslateVar(int from, int to);
+	void		TranslateVars(VarTranslator &vt);
+	void		CountInlineCode(const Bytecode *b, const map<pair<int, long>, const FunctionDef*> &starts);
 
 	// fields
 	VarAllocator	        fVarAllocator;
 	PListS<Fragment>	fTasks;
 	PListS<Fragment>	fSubs;
+	PListS<Fragment>	fDeclarations;
 	PListS<FunctionDef>	fFunctions;
 	PListS<Resource>	fResources;
 
@@ -158,9 +283,49 @@ private:
 	const RCX_Target*	fTarget;
 
 	int		fVirtualVarCount;
+	int		fSharedFunctions;
+	bool		fOutline;
+	int		fOptimize;
+	bool		fVolatileSources;
+	bool		fSourceTags;
+	bool		fObject;
+	bool		fMainFirst;
+	const RCX_Profile*	fProfile;
+	FragmentCache*		fFragmentCache;
+	FragmentCache::Key	fProgramKey;	// of the CreateImage() in progress
+
+	// what CreateImage() found for the size report
+	struct FragmentSize
+	{
+		RCX_ChunkType		fType;
+		int			fNumber;
+		string			fName;
+		int			fLength;
+		VarAllocator::Usage	fUsage;
+	};
+
+	struct FunctionSize
+	{
+		int	fCount;		// times it was inlined
+		int	fLength;	// bytes of all of them
+	};
+
+	bool				fSizeReport;
+	vector<FragmentSize>		fFragmentSizes;
+	map<const FunctionDef*, FunctionSize>	fFunctionSizes;
+
+	typedef pair<const FunctionDef*, vector<int> > ExpansionKey;
+	map<ExpansionKey, Stmt*>	fExpansions;
+	// copies of the bodies of saved functions (0 for the others)
+	map<const FunctionDef*, Stmt*>	fFunctionBodies;
 };
 
 
-extern Program *gProgram;
+#ifndef __CompileContext_h
+#include "CompileContext.h"
+#endif
+
+// the program being compiled in the current context
+#define gProgram (CompileContext::Get()->fProgram)
 
 #endif
@@ -13,6 +13,7 @@
  */
 #include "RelExpr.h"
 #include "Bytecode.h"
+#include "Program.h"
 /*
 #include "parser.h"
 #include "RCX_Constants.h"
@@ -43,7 +44,10 @@ RelExpr::RelExpr (Expr *lhs, int relation, Expr *rhs)
 
 Expr* RelExpr::Clone(Mapping *b) const
 {
-	return new RelExpr(Get(0)->Clone(b), fRelation, Get(1)->Clone(b));
+	Expr *e[2];
+
+	if (CloneExprs(b, e)) return Share();
+	return new RelExpr(e[0], fRelation, e[1]);
 }
 
 
@@ -88,8 +92,23 @@ bool RelExpr::Evaluate(int &v) const
 
 bool RelExpr::EmitBranch_(Bytecode &b, int label, bool condition) const
 {
-	bool ok = true;
 	int r = fRelation;
+	int v;
+
+	// e != 0 and e == 0 are just e and !e, so a comparison or logical
+	// expression on the other side branches by itself rather than
+	// having its value worked out first
+	if ((r == kEqualTo || r == kNotEqualTo) &&
+		gProgram->GetOptimize() >= Program::kBasicOptimize)
+	{
+		bool truth = (r == kNotEqualTo) ? condition : !condition;
+
+		if (Get(1)->Evaluate(v) && v == 0)
+			return Get(0)->EmitBranch(b, label, truth);
+		if (Get(0)->Evaluate(v) && v == 0)
+			return Get(1)->EmitBranch(b, label, truth);
+	}
+
 	RCX_Value ea1 = Get(0)->EmitConstrained(b, TEST_MASK);
 	RCX_Value ea2 = Get(1)->EmitConstrained(b, TEST_MASK);
 
@@ -138,12 +157,9 @@ bool RelExpr::EmitBranch_(Bytecode &b, int label, bool condition) const
 
 				c = RCX_VALUE_DATA(ea1);
 
-				// check for impossible range
+				// nothing is beyond the limit, so never branch
 				if (c == limit)
-				{
-					ok = false;
 					break;
-				}
 
 				// test for adjusted range
 				b.AddTest(RCX_VALUE(kRCX_ConstantType, c+adjust), rel, ea2, label);
@@ -160,5 +176,5 @@ bool RelExpr::EmitBranch_(Bytecode &b, int label, bool condition) const
 
 	b.ReleaseTempEA(ea1);
 	b.ReleaseTempEA(ea2);
-	return ok;
+	return true;
 }
@@ -33,6 +33,7 @@ public:
 
 	virtual bool		Evaluate(int &value) const;
 	virtual Expr*		Clone(Mapping *b) const;
+	virtual bool		Fold()	{ return FoldExprs(); }
 
 	// glue to emit values based on EmitBranch_()
 	virtual RCX_Value	EmitAny_(Bytecode &b) const { return EmitBoolAny(b); }
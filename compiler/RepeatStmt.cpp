@@ -18,13 +18,23 @@
 #include "Expr.h"
 #include "Error.h"
 #include "RCX_Constants.h"
+#include "LoopHoister.h"
+#include "Program.h"
 
 #define REPEAT_MASK	(TYPEMASK(kRCX_VariableType) + \
 					TYPEMASK(kRCX_ConstantType) + \
 					TYPEMASK(kRCX_RandomType))
 
 
-bool RepeatStmt::sRCXLoopInUse = false;
+class LoopCounterFinder
+{
+public:
+			LoopCounterFinder() : fFound(false) {}
+	bool	operator()(Stmt *s);
+
+	bool	fFound;
+};
+
 
 RepeatStmt::RepeatStmt(Expr *c, Stmt *s) :
 	ChainStmt(s)
@@ -35,31 +45,33 @@ RepeatStmt::RepeatStmt(Expr *c, Stmt *s) :
 
 RepeatStmt::~RepeatStmt()
 {
-	delete fCount;
+	Expr::Release(fCount);
 }
 
 
 void RepeatStmt::EmitActual(Bytecode &b)
 {
-	RCX_TargetType tt = b.GetTarget()->fType;
+	const RCX_Target *t = b.GetTarget();
+
+	// the count is only computed once
+	LoopHoister hoister(b, this);
+	hoister.Hoist(GetBody());
 
-	if (tt == kRCX_RCXTarget || tt == kRCX_CMTarget)
+	if (t->fLoopCounter)
 	{
-		// see if loop is candidate for loop counter
-		int n;
-		bool bCountEval = fCount->Evaluate(n);
-
-		if (bCountEval &&
-			n >= 0 &&
-			n < 256 &&
-			!sRCXLoopInUse)
+		// see if loop is candidate for loop counter; a nested repeat
+		// that can use it runs more often, so it gets the counter
+		if (FitsLoopCounter() &&
+			!b.IsLoopCounterInUse() &&
+			(gProgram->GetOptimize() < Program::kBasicOptimize ||
+			 !NestedFitsLoopCounter()))
 		{
 			// mark the loop counter in use, then emit code
-			sRCXLoopInUse = true;
+			b.SetLoopCounterInUse(true);
 			EmitRCXLoop(b);
 
 			// loop counter is now available for future use
-			sRCXLoopInUse = false;
+			b.SetLoopCounterInUse(false);
 		}
 		else
 		{
@@ -67,15 +79,43 @@ void RepeatStmt::EmitActual(Bytecode &b)
 			EmitRCXVar(b);
 		}
 	}
-        else if (tt == kRCX_SwanTarget)
-        {
-		// Swan can't use EmitDecJump because if uses global variables
-                EmitRCXVar(b);
-        }
-        else
+	else if (t->fDecJumps)
 	{
 		EmitDecJump(b);
 	}
+	else
+	{
+		// Swan can't use EmitDecJump because it uses global variables
+		EmitRCXVar(b);
+	}
+}
+
+
+bool RepeatStmt::FitsLoopCounter() const
+{
+	int n;
+
+	return fCount->Evaluate(n) && n >= 0 && n < 256;
+}
+
+
+bool RepeatStmt::NestedFitsLoopCounter()
+{
+	LoopCounterFinder finder;
+	Apply(GetBody(), finder);
+
+	return finder.fFound;
+}
+
+
+bool LoopCounterFinder::operator()(Stmt *s)
+{
+	RepeatStmt *r = dynamic_cast<RepeatStmt*>(s);
+
+	if (r && r->FitsLoopCounter())
+		fFound = true;
+
+	return !fFound;
 }
 
 
@@ -208,7 +248,8 @@ void RepeatStmt::EmitDecJump(Bytecode &b)
 
 int RepeatStmt::EmitCountToTemp(Bytecode &b)
 {
-	int var = b.GetTempVar(true);
+	// the count lives for the whole loop
+	int var = b.GetTempVar(true, false);
 	if (var == kIllegalVar)
 		Error(kErr_NoMoreTemps).Raise(&fCount->GetLoc());
 	else
@@ -221,9 +262,3 @@ Stmt* RepeatStmt::CloneActual(Mapping *b) const
 {
 	return new RepeatStmt(fCount->Clone(b), GetBody()->Clone(b));
 }
-
-
-void RepeatStmt::GetExprs(vector<Expr *> &v) const
-{
-	v.push_back(fCount);
-}
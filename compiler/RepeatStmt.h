@@ -29,18 +29,20 @@ public:
 	void	EmitActual(Bytecode &b);
 	Stmt*	CloneActual(Mapping *b) const;
 
-	virtual void	GetExprs(vector<Expr*> & v) const;
+	virtual int	GetExprCount() const	{ return 1; }
+	virtual Expr*	GetExpr(int) const	{ return fCount; }
+
+	// true if the count fits the RCX loop counter
+	bool	FitsLoopCounter() const;
 
 private:
+	bool	NestedFitsLoopCounter();
 	void	EmitRCXLoop(Bytecode &b);
 	void	EmitRCXVar(Bytecode &b);
 	void	EmitDecJump(Bytecode &b);
 	int		EmitCountToTemp(Bytecode &b);
 
 	Expr*	fCount;
-
-	// flag to indicate if rcx loop counter can be used
-	static bool sRCXLoopInUse;
 };
 
 
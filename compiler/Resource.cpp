@@ -16,6 +16,7 @@
 
 Resource::Resource()
 {
+	fAlias = false;
 }
 
 
@@ -31,3 +32,7 @@ void Resource::SetInfo(RCX_ChunkType type, Symbol *name)
 }
 
 
+bool Resource::Matches(const Resource *r) const
+{
+	return r->fType == fType && r->fData == fData;
+}
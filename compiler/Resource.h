@@ -58,10 +58,17 @@ public:
 	int				GetLength() const	{ return fData.size(); }
 	const UByte*	GetData() const	{ return &fData[0]; }
 
+	// a resource with the same type and data as an earlier one shares
+	// its chunk, and isn't put in the image itself
+	bool			Matches(const Resource *r) const;
+	void			SetAlias(bool a)	{ fAlias = a; }
+	bool			IsAlias() const		{ return fAlias; }
+
 private:
 	RCX_ChunkType	fType;
 	Symbol*			fName;
 	int				fNumber;
+	bool			fAlias;
 	vector<UByte>	fData;
 };
 
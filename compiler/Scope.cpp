@@ -14,13 +14,24 @@
 
 #include "Scope.h"
 #include "Variable.h"
+#include "Symbol.h"
+#include "PDebug.h"
 
-Scope::Scope()
+Scope::Scope() :
+	fBindings(0)
 {
 }
 
 Scope::~Scope()
 {
+	// unshadow the outer bindings
+	while(ScopeBinding *b = fBindings)
+	{
+		PASSERT(b->fName->GetBinding() == b);
+		b->fName->SetBinding(b->fShadowed);
+		fBindings = b->fNext;
+		delete b;
+	}
 }
 
 
@@ -29,37 +40,41 @@ bool Scope::Define(const Symbol *name, int var, bool array, bool ptr, bool stack
 	if (Contains(name))
 		return false;
 
-	fBindings.push_back(ScopeData(name, var, array, ptr, stack));
+	ScopeBinding *b = new ScopeBinding;
+	b->fName = name;
+	b->fScope = this;
+	b->fShadowed = name->GetBinding();
+	b->fNext = fBindings;
+	b->fVar = var;
+	b->fArray = array;
+	b->fPtr = ptr;
+	b->fStack = stack;
+
+	fBindings = b;
+	name->SetBinding(b);
 	return true;
 }
 
 
 int Scope::Lookup(const Symbol *name, bool &array, bool &ptr, bool &stack)
 {
-	Scope *s;
+	const ScopeBinding *b = name->GetBinding();
 
-	for(s=this; s; s=s->GetNext())
-	{
-		int var = s->Lookup1(name, &array, &ptr, &stack);
-		if (var != kIllegalVar) return var;
-	}
+	if (!b) return kIllegalVar;
 
-	return kIllegalVar;
+	array = b->fArray;
+	ptr = b->fPtr;
+	stack = b->fStack;
+	return b->fVar;
 }
 
 
-int	Scope::Lookup1(const Symbol *name, bool *array, bool *ptr, bool *stack)
+bool Scope::Contains(const Symbol *name)
 {
-	for(size_t i=0; i<fBindings.size(); i++)
-	{
-		if (fBindings[i].fName == name)
-		{
-			if (array) *array = fBindings[i].fArray;
-                        if (ptr) *ptr = fBindings[i].fPtr;
-                        if (stack) *stack = fBindings[i].fStack;
-			return fBindings[i].fVar;
-		}
-	}
+	// bindings of inner scopes come first; they are only walked
+	// when checking an outer scope
+	for(const ScopeBinding *b = name->GetBinding(); b; b=b->fShadowed)
+		if (b->fScope == this) return true;
 
-	return kIllegalVar;
+	return false;
 }
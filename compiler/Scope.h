@@ -27,13 +27,33 @@
 #include "AutoFree.h"
 #endif
 
-#include <vector>
+class Symbol;
+class Scope;
 
-using std::vector;
 
-class Symbol;
+/*
+ * A variable bound to a symbol.  Each symbol points at its innermost
+ * binding, and each binding points at the one it shadows, so looking
+ * up a name doesn't depend on how deeply scopes are nested.
+ */
+struct ScopeBinding : public AutoFree
+{
+	const Symbol*	fName;
+	Scope*		fScope;
+	ScopeBinding*	fShadowed;	// outer binding of the same symbol
+	ScopeBinding*	fNext;		// next binding in the same scope
+	int		fVar;
+	bool		fArray;
+	bool		fPtr;
+	bool		fStack;
+};
 
 
+/*
+ * Scopes must be destroyed in the reverse order that they were created
+ * (Program keeps them as a stack), since destroying a scope removes its
+ * bindings from their symbols.
+ */
 class Scope : public PLinkS<Scope>, public AutoFree
 {
 public:
@@ -41,26 +61,13 @@ public:
 	~Scope();
 
 	bool	Define(const Symbol *name, int var, bool array, bool ptr, bool stack);
+	/// look up the innermost binding of name in any scope
 	int	Lookup(const Symbol *name, bool &array, bool &ptr, bool &stack);
-	bool	Contains(const Symbol *name)	{ return Lookup1(name)!= kIllegalVar; }
+	bool	Contains(const Symbol *name);
+	bool	IsEmpty() const	{ return fBindings == 0; }
 
 private:
-	struct ScopeData
-	{
-		ScopeData() : fName(0), fVar(kIllegalVar), fArray(0), fPtr(0), fStack(0) {}
-		ScopeData(const Symbol *name, int var, bool a, bool ptr, bool stack) :
-                  fName(name), fVar(var), fArray(a), fPtr(ptr), fStack(stack) {}
-
-		const Symbol *	fName;
-		int	fVar;
-		bool	fArray;
-                bool    fPtr;
-                bool    fStack;
-	};
-
-	int	Lookup1(const Symbol *name, bool *array = 0, bool *ptr = 0, bool *stack = 0);
-
-	vector<ScopeData>	fBindings;
+	ScopeBinding*	fBindings;	// most recent first
 };
 
 #endif
@@ -49,3 +49,10 @@ void ScopeStmt::RemapVar(int from, int to, int count)
 	while(count--)
 		fVariables.push_back(to++);
 }
+
+
+bool ScopeStmt::FallsThrough()
+{
+	Stmt *body = GetBody();
+	return body ? body->FallsThrough() : true;
+}
@@ -30,6 +30,7 @@ public:
 
 	void			EmitActual(Bytecode &b);
 	Stmt*			CloneActual(Mapping *b) const;
+	bool			FallsThrough();
 
 	void			RemapVar(int from, int to, int count);
 private:
@@ -18,7 +18,10 @@
 
 Expr* SensorExpr::Clone(Mapping *b) const
 {
-	return new SensorExpr(Get(0)->Clone(b));
+	Expr *e[1];
+
+	if (CloneExprs(b, e)) return Share();
+	return new SensorExpr(e[0]);
 }
 
 
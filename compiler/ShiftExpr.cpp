@@ -14,11 +14,21 @@
 #include "ShiftExpr.h"
 #include "Bytecode.h"
 #include "RCX_Cmd.h"
+#include "Program.h"
 
 
 Expr* ShiftExpr::Clone(Mapping *b) const
 {
-	return new ShiftExpr(Get(0)->Clone(b), Get(1)->Clone(b), fDirection);
+	Expr *e[2];
+
+	if (CloneExprs(b, e)) return Share();
+	return new ShiftExpr(e[0], e[1], fDirection);
+}
+
+
+bool ShiftExpr::Matches(const Expr *e) const
+{
+	return MatchesExprs(e) && static_cast<const ShiftExpr*>(e)->fDirection == fDirection;
 }
 
 
@@ -79,6 +89,10 @@ bool ShiftExpr::EmitTo_(Bytecode &b, int dst) const
 	// evaluate Get(0) into dst
 	if (!Get(0)->EmitTo(b,dst)) return false;
 
+	// nothing to shift
+	if (shiftCount == 0 &&
+		gProgram->GetOptimize() >= Program::kBasicOptimize) return true;
+
 	RCX_Cmd cmd;
 	if (fDirection==kRight)
 	{
@@ -16,10 +16,10 @@
 
 
 Stmt::Stmt() :
-    fParent(0),
-    fMustEmit(false)
+    fLoc(0),
+    fMustEmit(false),
+    fParent(0)
 {
-    fLoc.fIndex = kIllegalSrcIndex;
 }
 
 Stmt::~Stmt()
@@ -27,6 +27,14 @@ Stmt::~Stmt()
 }
 
 
+void Stmt::GetExprs(vector<Expr*> &v) const
+{
+    int n = GetExprCount();
+    for(int i=0; i<n; ++i)
+        v.push_back(GetExpr(i));
+}
+
+
 bool Stmt::IsDescendantOf(const Stmt *ancestor) const
 {
     const Stmt *s = this;
@@ -40,7 +48,7 @@ bool Stmt::IsDescendantOf(const Stmt *ancestor) const
 
 
 void Stmt::SetLocation(LocationNode *node) {
-    fLoc = node->GetLoc();
+    fLoc = LocationTable::Get().Add(node->GetLoc());
     delete node;
 }
 
@@ -51,7 +59,7 @@ void Stmt::Emit(Bytecode &b)
     // applies to all statements.  For now, just add a source tag and
     // then call EmitActual() which is virtual and does all the work
 
-    b.AddSourceTag(RCX_SourceTag::kNormal, fLoc);
+    b.AddSourceTag(RCX_SourceTag::kNormal, GetLoc());
 
     EmitActual(b);
 }
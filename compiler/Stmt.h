@@ -26,6 +26,10 @@
 #include "LocationNode.h"
 #endif
 
+#ifndef __LocationTable_h
+#include "LocationTable.h"
+#endif
+
 #include <vector>
 
 using std::vector;
@@ -47,7 +51,7 @@ public:
     virtual ~Stmt();
 
     void SetLocation(LocationNode *node);
-    const LexLocation&  GetLoc() const { return fLoc; }
+    const LexLocation&  GetLoc() const { return LocationTable::Get().GetLocation(fLoc); }
 
     Stmt* GetParent() const { return fParent; }
     bool IsDescendantOf(const Stmt* ancestor) const;
@@ -63,19 +67,28 @@ public:
 
     virtual void EmitActual(Bytecode &b) = 0;
 
+    /// True if control can continue past the end of the statement.
+    /// Code after a statement that doesn't fall through is unreachable
+    /// (unless it holds a case label or goto target) and isn't emitted.
+    virtual bool FallsThrough() { return true; }
+
     Stmt* Clone(Mapping *b) const;
     virtual Stmt* CloneActual(Mapping *b) const = 0;
 
-    /// Append sub-expressions into vector and return number added
-    virtual void GetExprs(vector<Expr*> & /* v */) const { }
+    /// The sub-expressions, which can be walked without allocating
+    virtual int GetExprCount() const { return 0; }
+    virtual Expr* GetExpr(int /* i */) const { return 0; }
+
+    /// Append sub-expressions into vector
+    void GetExprs(vector<Expr*> &v) const;
 
 
 protected:
     void Adopt(Stmt *c)  { if (c) c->fParent = this; }
 
-    LexLocation fLoc;
-    Stmt* fParent;
+    int fLoc;   // index in the LocationTable
     bool fMustEmit;
+    Stmt* fParent;
 };
 
 
@@ -15,6 +15,15 @@
 #include "Bytecode.h"
 #include "CaseStmt.h"
 #include "Error.h"
+#include "Program.h"
+
+#include <algorithm>
+
+// switches with at least this many cases test the selector with a
+// binary search instead of testing each case in turn
+#define kMinTreeCases	8
+// the largest group of cases that the search tests one by one
+#define kMaxLeafCases	3
 
 class SwitchCaseEmitter
 {
@@ -37,7 +46,7 @@ SwitchStmt::SwitchStmt(Expr *c, Stmt *s) :
 
 SwitchStmt::~SwitchStmt()
 {
-	delete fSelector;
+	Expr::Release(fSelector);
 }
 
 
@@ -60,8 +69,10 @@ void SwitchStmt::EmitActual(Bytecode &b)
 	 *
 	 * Note that cases will be tested in the order they appear,
 	 * with the exception of the default case, which is never tested.
-	 * Code is emited for the body in the exact order it appears -
-	 * default case may be in the middle!
+	 * Large switches test the cases with a binary search instead
+	 * (see EmitTree), and with a profile the cases that ran most are
+	 * tested first (see EmitTests).  Code is emited for the body in the exact order
+	 * it appears - default case may be in the middle!
 	 */
 
 	RCX_Value selector;
@@ -71,18 +82,16 @@ void SwitchStmt::EmitActual(Bytecode &b)
 	selector = fSelector->EmitConstrained(b,TYPEMASK(kRCX_VariableType));
 	if (selector == Expr::kIllegalEA) return;
 
-	// emit the code that tests cases (and in the process assign bytecode
-	// labels to any LabelStmts
+	// find the cases (and in the process assign bytecode labels to
+	// any CaseStmts), then emit the code that tests them
 	SwitchState switchState(selector, defaultLabel);
 	SwitchCaseEmitter emitter(b, switchState);
 	Apply(GetBody(), emitter);
+	EmitTests(b, switchState);
 
 	// don't need the selector anymore
 	b.ReleaseTempEA(selector);
 
-	// we always jump to the default label after all cases
-	b.AddJump(defaultLabel);
-
 	// emit body - push partial loop context so 'break' will work
 	int bLabel = b.PushFlow(Bytecode::kBreakFlow);
 	GetBody()->Emit(b);
@@ -96,6 +105,105 @@ void SwitchStmt::EmitActual(Bytecode &b)
 }
 
 
+class CaseOrder
+{
+public:
+			CaseOrder(const SwitchState &s) : fState(s) {}
+	bool	operator()(int a, int b) const	{ return fState.GetCase(a) < fState.GetCase(b); }
+
+private:
+	const SwitchState&	fState;
+};
+
+
+class HotterCase
+{
+public:
+			HotterCase(const SwitchState &s) : fState(s) {}
+	bool	operator()(int a, int b) const	{ return fState.GetHeat(a) > fState.GetHeat(b); }
+
+private:
+	const SwitchState&	fState;
+};
+
+
+void SwitchStmt::EmitTests(Bytecode &b, const SwitchState &s)
+{
+	vector<int> order;
+
+	for(int i=0; i<s.GetCaseCount(); ++i)
+	{
+		if (s.GetCase(i) != CaseStmt::kDefaultValue)
+			order.push_back(i);
+	}
+
+	// with a profile, the cases are tested in the order of how often
+	// they ran, which beats the tree when one case runs most of the time
+	long total = 0, hottest = 0;
+	for(size_t i=0; i<order.size(); ++i)
+	{
+		long heat = s.GetHeat(order[i]);
+		if (heat > 0) total += heat;
+		if (heat > hottest) hottest = heat;
+	}
+
+	bool tree = order.size() >= kMinTreeCases &&
+		gProgram->GetOptimize() == Program::kFullOptimize;
+
+	if (total > 0 && (!tree || 2 * hottest >= total) &&
+		gProgram->GetOptimize() >= Program::kBasicOptimize)
+	{
+		std::stable_sort(order.begin(), order.end(), HotterCase(s));
+		tree = false;
+	}
+
+	// the tree is faster, but it takes more tests
+	if (tree)
+	{
+		std::sort(order.begin(), order.end(), CaseOrder(s));
+		EmitTree(b, s, order, 0, order.size());
+		return;
+	}
+
+	// test the cases in the order they appear (or ran most)
+	for(size_t i=0; i<order.size(); ++i)
+		b.AddTest(RCX_VALUE(kRCX_ConstantType, s.GetCase(order[i])), kRCX_EqualTo, s.GetSelector(), s.GetLabel(order[i]));
+
+	// we always jump to the default label after all cases
+	b.AddJump(s.GetDefaultLabel());
+}
+
+
+/**
+ * Emits the tests for the cases order[lo] to order[hi-1], which are
+ * sorted by value.  Each split compares the selector with the middle
+ * case and jumps to the tests for the upper half, so a case is found
+ * in about log2(n) tests.  Every path ends with a jump to the default
+ * label.
+ */
+void SwitchStmt::EmitTree(Bytecode &b, const SwitchState &s,
+	const vector<int> &order, int lo, int hi)
+{
+	if (hi - lo <= kMaxLeafCases)
+	{
+		for(int i=lo; i<hi; ++i)
+			b.AddTest(RCX_VALUE(kRCX_ConstantType, s.GetCase(order[i])), kRCX_EqualTo, s.GetSelector(), s.GetLabel(order[i]));
+
+		b.AddJump(s.GetDefaultLabel());
+		return;
+	}
+
+	int mid = (lo + hi) / 2;
+	int upper = b.NewLabel();
+
+	b.AddTest(RCX_VALUE(kRCX_ConstantType, s.GetCase(order[mid])), kRCX_LessOrEqual, s.GetSelector(), upper);
+	EmitTree(b, s, order, lo, mid);
+
+	b.SetLabel(upper);
+	EmitTree(b, s, order, mid, hi);
+}
+
+
 bool SwitchCaseEmitter::operator()(Stmt *s)
 {
 	CaseStmt *ls;
@@ -118,12 +226,6 @@ Stmt* SwitchStmt::CloneActual(Mapping *b) const
 }
 
 
-void SwitchStmt::GetExprs(vector<Expr *> &v) const
-{
-	v.push_back(fSelector);
-}
-
-
 bool SwitchState::ContainsCase(int v)
 {
 	size_t i;
@@ -133,4 +235,3 @@ bool SwitchState::ContainsCase(int v)
 
 	return false;
 }
-
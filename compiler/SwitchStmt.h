@@ -26,6 +26,8 @@
 
 using std::vector;
 
+class SwitchState;
+
 class SwitchStmt : public ChainStmt
 {
 public:
@@ -35,9 +37,14 @@ public:
 	virtual	void	EmitActual(Bytecode &b);
 
 	Stmt*	CloneActual(Mapping *b) const;
-	virtual void	GetExprs(vector<Expr*> & v) const;
+	virtual int	GetExprCount() const	{ return 1; }
+	virtual Expr*	GetExpr(int) const	{ return fSelector; }
 
 private:
+	void	EmitTests(Bytecode &b, const SwitchState &s);
+	void	EmitTree(Bytecode &b, const SwitchState &s,
+				const vector<int> &order, int lo, int hi);
+
 	Expr*		fSelector;
 };
 
@@ -51,7 +58,14 @@ public:
 					{}
 
 	bool		ContainsCase(int v);
-	void		AddCase(int v)			{ fCases.push_back(v); }
+	void		AddCase(int v, int label, long heat = -1)
+				{ fCases.push_back(v); fLabels.push_back(label); fHeats.push_back(heat); }
+
+	int			GetCaseCount() const	{ return fCases.size(); }
+	int			GetCase(int i) const	{ return fCases[i]; }
+	int			GetLabel(int i) const	{ return fLabels[i]; }
+	// how often the case ran in the profile (-1 if there is none)
+	long		GetHeat(int i) const	{ return fHeats[i]; }
 
 	RCX_Value	GetSelector() const		{ return fSelector; }
 	int			GetDefaultLabel() const	{ return fDefaultLabel; }
@@ -60,6 +74,8 @@ private:
 	RCX_Value	fSelector;
 	int			fDefaultLabel;
 	vector<int>	fCases;
+	vector<int>	fLabels;
+	vector<long>	fHeats;
 };
 
 #endif
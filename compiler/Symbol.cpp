@@ -13,30 +13,35 @@
  */
 #include <cstring>
 #include <cstdio>
+#include <new>
 #include "Symbol.h"
 #include "Macro.h"
 #include "Fragment.h"
 #include "Stmt.h"
+#include "CompileContext.h"
+#include "api_symbols.h"
 
 using std::printf;
 
 #define kHashSize 1023
 
 
-SymbolTable * Symbol::sSymbolTable = 0;
-
-Symbol::Symbol(const char *name)
+Symbol::Symbol(const char *key)
 {
-	fKey = new char[strlen(name) + 1];
-	strcpy(fKey, name);
+	fKey = key;
 	fDefinition = 0;
+	fLater = 0;
+	fBinding = 0;
+	fProgramNames.fTask = 0;
+	fProgramNames.fSub = 0;
+	fProgramNames.fFunction = 0;
+	fProgramNames.fResource = 0;
 }
 
 
 Symbol::~Symbol()
 {
 	Undefine();
-	delete [] fKey;
 }
 
 
@@ -44,6 +49,14 @@ void Symbol::Define(Macro *d)
 {
 	delete fDefinition;
 	fDefinition = d;
+	fLater = 0;
+}
+
+
+void Symbol::DefineLater(const Macro *d)
+{
+	Undefine();
+	fLater = d;
 }
 
 
@@ -51,21 +64,28 @@ void Symbol::Undefine()
 {
 	delete fDefinition;
 	fDefinition = 0;
+	fLater = 0;
 }
 
 
-Symbol *Symbol::Get(const char *name)
+void Symbol::CopyLater()
 {
-	if (!sSymbolTable)
-		sSymbolTable = new SymbolTable();
+	fDefinition = new Macro(fLater->GetTokens(), fLater->GetTokenCount(), fLater->GetArgCount());
+	fLater = 0;
+}
 
+
+Symbol *Symbol::Get(const char *name, size_t length)
+{
+	SymbolTable *table = GetSymbolTable();
+	ULong hash = P_HashTable::Hash(name, length);
 	Symbol *s;
 
-	s = sSymbolTable->Find(name);
+	s = table->Find(name, length, hash);
 	if (!s)
 	{
-		s = new Symbol(name);
-		sSymbolTable->Add(s);
+		s = new Symbol(table->Intern(name, length));
+		table->Add(s);
 	}
 
 	return s;
@@ -74,16 +94,58 @@ Symbol *Symbol::Get(const char *name)
 
 SymbolTable *Symbol::GetSymbolTable()
 {
-	if (!sSymbolTable)
-		sSymbolTable = new SymbolTable();
-
-	return sSymbolTable;
+	return CompileContext::Get()->fSymbolTable;
 }
 
 
 SymbolTable::SymbolTable()
 	: PHashTable<Symbol>(kHashSize)
 {
+	// one block for all of the API symbols, whose keys are the
+	// generated names
+	fApiCount = api_symbols_count;
+	fApiSymbols = (Symbol *) ::operator new(fApiCount * sizeof(Symbol));
+
+	for(int i=0; i<fApiCount; i++)
+		new (&fApiSymbols[i]) Symbol(api_symbols_names[i]);
+}
+
+
+Symbol *SymbolTable::Find(const char *key, size_t length, ULong hash)
+{
+	Symbol *s = FindApi(key, length, hash);
+
+	return s ? s : PHashTable<Symbol>::Find(key, length, hash);
+}
+
+
+void SymbolTable::DeleteAll()
+{
+	PHashTable<Symbol>::DeleteAll();
+
+	// API symbols live as long as the table
+	for(int i=0; i<fApiCount; i++)
+		fApiSymbols[i].Undefine();
+}
+
+
+Symbol *SymbolTable::GetSlot(int i)
+{
+	if (i < fApiCount)
+		return &fApiSymbols[i];
+
+	return PHashTable<Symbol>::GetSlot(i - fApiCount);
+}
+
+
+Symbol *SymbolTable::FindApi(const char *key, size_t length, ULong hash)
+{
+	int i = api_symbols_table[api_symbols_slot(hash)];
+
+	if (i < 0 || api_symbols_hashes[i] != hash || !fApiSymbols[i].MatchKey(key, length))
+		return 0;
+
+	return &fApiSymbols[i];
 }
 
 
@@ -93,8 +155,8 @@ void SymbolTable::Dump()
 	Symbol *s;
 	const Macro *d;
 
-	for(i=0; i<GetBucketCount(); i++)
-		for(s=GetBucket(i); s; s= (Symbol *)s->GetNext())
+	for(i=0; i<GetSlotCount(); i++)
+		if ((s=GetSlot(i)) != 0)
 		{
 			printf("%s = ", s->GetKey());
 			d = s->GetDefinition();
@@ -112,4 +174,8 @@ void SymbolTable::Dump()
 
 SymbolTable::~SymbolTable()
 {
+	for(int i=0; i<fApiCount; i++)
+		fApiSymbols[i].~Symbol();
+
+	::operator delete((void *)fApiSymbols);
 }
@@ -20,39 +20,87 @@
 
 class Macro;
 class Fragment;
+class FunctionDef;
+class Resource;
 class Stmt;
 
 class SymbolTable;
+struct ScopeBinding;
+
+// what a symbol names in the program being compiled (see Program)
+struct ProgramNames
+{
+	Fragment*		fTask;
+	Fragment*		fSub;
+	FunctionDef*	fFunction;
+	Resource*		fResource;
+};
 
 class Symbol : public PHashable
 {
 public:
-					Symbol(const char *name);
+					// key must stay valid as long as the symbol, such as
+					// a key interned by the symbol table
+					Symbol(const char *key);
 					~Symbol();
 
-	bool			IsDefined() const	{ return fDefinition ? true : false; }
-	Macro*			GetDefinition()		{ return fDefinition; }
+	bool			IsDefined() const	{ return fDefinition || fLater; }
+	Macro*			GetDefinition()		{ if (fLater) CopyLater(); return fDefinition; }
 	void			Define(Macro *d);
+	// defines the symbol as a copy of d, made the first time the
+	// definition is asked for (d must last until then)
+	void			DefineLater(const Macro *d);
 	void			Undefine();
 
-	static Symbol*	Get(const char *name);
+	// the innermost variable bound to this symbol (see Scope)
+	ScopeBinding*	GetBinding() const	{ return fBinding; }
+	void			SetBinding(ScopeBinding *b) const	{ fBinding = b; }
+
+	ProgramNames&	GetProgramNames() const	{ return fProgramNames; }
+
+	static Symbol*	Get(const char *name)	{ return Get(name, std::strlen(name)); }
+	// name need not be terminated (such as the text of a token)
+	static Symbol*	Get(const char *name, size_t length);
 	static SymbolTable*	GetSymbolTable();
 
 private:
+	void			CopyLater();
+
 	Macro*			fDefinition;
-	static	SymbolTable*	sSymbolTable;
+	const Macro*	fLater;		// to copy into fDefinition
+	// scopes keep track of bindings for const symbols
+	mutable ScopeBinding*	fBinding;
+	mutable ProgramNames	fProgramNames;
 };
 
 
+/*
+ * Identifiers that appear in the API headers are looked up in a
+ * perfect hash generated at build time (api_symbols.h) and their
+ * symbols are created along with the table; everything else goes
+ * into the hash table.  Slots 0 to GetSlotCount()-1 cover both
+ * kinds of symbol.
+ */
 class SymbolTable : public PHashTable<Symbol>
 {
 public:
 			SymbolTable();
 			~SymbolTable();
 
+	Symbol*	Find(const char *key, size_t length, ULong hash);
+
+	void	DeleteAll();
+
+	int		GetSlotCount() const	{ return fApiCount + PHashTable<Symbol>::GetSlotCount(); }
+	Symbol*	GetSlot(int i);
+
 	void	Dump();
 
 private:
+	Symbol*	FindApi(const char *key, size_t length, ULong hash);
+
+	int		fApiCount;
+	Symbol*	fApiSymbols;
 };
 
 #endif
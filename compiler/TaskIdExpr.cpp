@@ -13,6 +13,7 @@
  */
 #include "TaskIdExpr.h"
 #include "Error.h"
+#include "Program.h"
 #include "Stmt.h"
 
 
@@ -50,16 +51,10 @@ bool TaskIdExpr::Evaluate(int &v) const
 
 bool TaskIdExpr::Patcher::operator()(Stmt *s)
 {
-	vector<Expr*> v;
-	s->GetExprs(v);
+	int n = s->GetExprCount();
 
-	int n = v.size();
-	int i;
-
-	for(i=0; i<n; ++i)
-	{
-		::Apply(v[i], *this);
-	}
+	for(int i=0; i<n; ++i)
+		::Apply(s->GetExpr(i), *this);
 
 	return true;
 }
@@ -70,7 +65,12 @@ bool TaskIdExpr::Patcher::operator()(Expr *e)
 	if (TaskIdExpr *te = dynamic_cast<TaskIdExpr*>(e))
 	{
 		te->fTaskId = fId;
-		if (fId < 0)
+		if (gProgram->IsObject())
+		{
+			// the tasks are numbered again when the objects are linked
+			Error(kErr_NotRelocatable, "__taskid").Raise(&te->GetLoc());
+		}
+		else if (fId < 0)
 		{
 			// the error must be raised here rather than in Evaluate()
 			// since Evaluate() is called prior to task ids being assigned
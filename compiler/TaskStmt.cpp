@@ -38,6 +38,13 @@ void TaskStmt::EmitActual(Bytecode &b)
 		return;
 	}
 
+	// only an object can leave the task to another one
+	if (f->IsDeclaration() && !gProgram->IsObject())
+	{
+		Error(kErr_DeclaredOnly, fName->GetKey()).Raise(&fLocation);
+		return;
+	}
+
 	cmd.Set(fOpcode, (UByte)f->GetNumber());
 	b.Add(cmd);
 }
@@ -31,6 +31,7 @@ public:
 
 	void	EmitActual(Bytecode &b);
 	Stmt*	CloneActual(Mapping *b) const;
+	Symbol*	GetName() const	{ return fName; }
 
 private:
 	Symbol*	fName;
@@ -14,11 +14,15 @@
 #include "TernaryExpr.h"
 #include "Bytecode.h"
 #include "RCX_Cmd.h"
+#include "Program.h"
 
 
 Expr* TernaryExpr::Clone(Mapping *b) const
 {
-	return new TernaryExpr(Get(0)->Clone(b), Get(1)->Clone(b), Get(2)->Clone(b));
+	Expr *e[3];
+
+	if (CloneExprs(b, e)) return Share();
+	return new TernaryExpr(e[0], e[1], e[2]);
 }
 
 
@@ -73,8 +77,90 @@ bool TernaryExpr::EmitTo_(Bytecode &b, int dst) const
 }
 
 
+/*
+ * As a condition, each arm branches on its own instead of its value
+ * being worked out and then tested.
+ */
+bool TernaryExpr::EmitBranch_(Bytecode &b, int label, bool condition) const
+{
+	if (gProgram->GetOptimize() < Program::kBasicOptimize)
+		return Expr::EmitBranch_(b, label, condition);
+
+	int test;
+
+	if (Get(0)->Evaluate(test))
+		return Get(test ? 1 : 2)->EmitBranch(b, label, condition);
+
+	int elseLabel = b.NewLabel();
+	int doneLabel = b.NewLabel();
+
+	if (!Get(0)->EmitBranch(b, elseLabel, false)) return false;
+
+	if (!Get(1)->EmitBranch(b, label, condition)) return false;
+	b.AddJump(doneLabel);
+
+	b.SetLabel(elseLabel);
+	if (!Get(2)->EmitBranch(b, label, condition)) return false;
+	b.SetLabel(doneLabel);
+
+	return true;
+}
+
+
+/*
+ * Arm i can be stored in dst before the condition is tested if it needs
+ * no code, and neither the condition nor the other arm reads dst or
+ * could change what arm i reads.
+ */
+bool TernaryExpr::IsEarlyArm(int i, int dst) const
+{
+	if (gProgram->GetOptimize() < Program::kBasicOptimize) return false;
+
+	RCX_Value ea = Get(i)->GetStaticEA();
+	if (ea == kIllegalEA) return false;
+
+	switch(RCX_VALUE_TYPE(ea))
+	{
+		case kRCX_ConstantType:
+			break;
+		case kRCX_VariableType:
+			if (Get(0)->Contains(RCX_VALUE_DATA(ea))) return false;
+			break;
+		default:
+			return false;
+	}
+
+	return !Get(0)->Contains(dst) && !Get(3 - i)->Contains(dst);
+}
+
+
 bool TernaryExpr::EmitConditionTo(Bytecode &b, int dst) const
 {
+	/*
+	 * When one arm needs no code it can be stored first, and the
+	 * other arm then only replaces it if the condition says so:
+	 *
+	 *		dst = arm2
+	 *		test !condition -> done
+	 *		dst = arm1
+	 *	done:
+	 *
+	 * which is one instruction and one jump fewer.
+	 */
+	for(int i=2; i>=1; --i)
+	{
+		if (!IsEarlyArm(i, dst)) continue;
+
+		int doneLabel = b.NewLabel();
+
+		if (!Get(i)->EmitTo(b, dst)) return false;
+		if (!Get(0)->EmitBranch(b, doneLabel, i == 1)) return false;
+		if (!Get(3 - i)->EmitTo(b, dst)) return false;
+		b.SetLabel(doneLabel);
+
+		return true;
+	}
+
 	int elseLabel = b.NewLabel();
 	int doneLabel = b.NewLabel();
 
@@ -23,13 +23,16 @@ public:
 
 	virtual bool		Evaluate(int &value) const;
 	virtual Expr*		Clone(Mapping *b) const;
+	virtual bool		Fold()	{ return FoldExprs(); }
 
 	virtual RCX_Value	EmitAny_(Bytecode &b) const;
 	virtual bool		EmitTo_(Bytecode &b, int dst) const;
+	virtual bool		EmitBranch_(Bytecode &b, int label, bool condition) const;
 
 
 private:
 	virtual bool		EmitConditionTo(Bytecode &b, int dst) const;
+	bool				IsEarlyArm(int i, int dst) const;
 };
 
 
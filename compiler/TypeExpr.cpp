@@ -17,7 +17,10 @@
 
 Expr* TypeExpr::Clone(Mapping *b) const
 {
-	return new TypeExpr(Get(0)->Clone(b));
+	Expr *e[1];
+
+	if (CloneExprs(b, e)) return Share();
+	return new TypeExpr(e[0]);
 }
 
 
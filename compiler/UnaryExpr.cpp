@@ -30,7 +30,7 @@ static RCX_VarCode GetUnaryCode(int op)
 		case SIGN:
 			return kRCX_SgnVar;
                 case '~':
-                        if (t->fType == kRCX_SwanTarget)
+                        if (t->fHasExtendedMathOps)
                            return kRCX_NotVar;
                         else
                            return kRCX_IllegalVar;
@@ -43,7 +43,16 @@ static RCX_VarCode GetUnaryCode(int op)
 
 Expr* UnaryExpr::Clone(Mapping *b) const
 {
-	return new UnaryExpr(fOp, Get(0)->Clone(b));
+	Expr *e[1];
+
+	if (CloneExprs(b, e)) return Share();
+	return new UnaryExpr(fOp, e[0]);
+}
+
+
+bool UnaryExpr::Matches(const Expr *e) const
+{
+	return MatchesExprs(e) && static_cast<const UnaryExpr*>(e)->fOp == fOp;
 }
 
 
@@ -23,6 +23,8 @@ public:
 
 	virtual bool		Evaluate(int &value) const;
 	virtual Expr*		Clone(Mapping *b) const;
+	virtual bool		Fold()	{ return FoldExprs(); }
+	virtual bool		Matches(const Expr *e) const;
 
 	virtual RCX_Value	EmitAny_(Bytecode &b) const;
 	virtual bool		EmitTo_(Bytecode &b, int dst) const;
@@ -17,7 +17,10 @@
 
 Expr* ValueExpr::Clone(Mapping *b) const
 {
-	return new ValueExpr(Get(0)->Clone(b));
+	Expr *e[1];
+
+	if (CloneExprs(b, e)) return Share();
+	return new ValueExpr(e[0]);
 }
 
 
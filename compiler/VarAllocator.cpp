@@ -48,6 +48,15 @@
  * the high end, which means that the only time a call to a sub
  * will conflict with the presently allocated task vars is if
  * local space is exhausted.
+ *
+ * The one exception to globals becoming permanent is within a
+ * group, which is a task along with the subs that only it calls.
+ * Scratch temps (the ones used while evaluating an expression) never
+ * live across a statement, and so never across a call.  A global the
+ * task only used for scratch can be used by one of its subs, and a
+ * global a sub used can serve as scratch in the task.  Each global
+ * is shared by at most one sub and the task's scratch; two subs may
+ * call each other so they are never given the same global.
  */
 
 #include "VarAllocator.h"
@@ -61,19 +70,26 @@ using std::printf;
 
 VarAllocator::VarAllocator(int maxGlobals, int maxTaskVars) :
 	fMode(kGlobalMode),
+	fGroup(kNoGroup),
 	fMaxVars(maxGlobals + maxTaskVars),
-	fLocalStart(maxGlobals)
+	fLocalStart(maxGlobals),
+	fUsed(fMaxVars),
+	fTemp(fMaxVars),
+	fReserved(fMaxVars),
+	fDirty(fMaxVars),
+	fTouched(fMaxVars),
+	fHeld(fMaxVars),
+	fTouchedTemps(fMaxVars),
+	fShared(fMaxVars),
+	fTaskTemps(fMaxVars),
+	fSubVars(fMaxVars),
+	fGroups(maxGlobals, kNoGroup)
 {
-
-	fStates = new VarState[fMaxVars];
-	for(int i=0; i<fMaxVars; ++i)
-		fStates[i] = kFree;
 }
 
 
 VarAllocator::~VarAllocator()
 {
-	delete [] fStates;
 }
 
 
@@ -81,37 +97,38 @@ bool VarAllocator::Reserve(int v)
 {
 	if (!IsLegal(v)) return false;
 
-	if (fStates[v] != kFree) return false;
+	if (IsUsed(v) || fDirty.Test(v)) return false;
 
-	fStates[v] = kReserved;
+	fUsed.Set(v);
+	fReserved.Set(v);
 	return true;
 }
 
 
-int VarAllocator::Allocate(bool temp, bool canUseLocals, int count)
+int VarAllocator::Allocate(bool temp, bool canUseLocals, int count, bool scratch)
 {
 	int v = kIllegalVar;
 
 	switch(fMode)
 	{
 		case kGlobalMode:
-			v = FindUnused(0, fLocalStart, count);
+			v = FindUnused(0, fLocalStart, count, scratch);
 			break;
 		case kTaskMode:
 			if (canUseLocals)
-				v = FindUnused(fMaxVars, fLocalStart, count);
+				v = FindUnused(fMaxVars, fLocalStart, count, scratch);
 			if (v==kIllegalVar)
-				v = FindUnused(0, fLocalStart, count);
+				v = FindUnused(0, fLocalStart, count, scratch);
 			break;
 		case kSingleSubMode:
 			if (canUseLocals)
-				v = FindUnused(fLocalStart, fMaxVars, count);
+				v = FindUnused(fLocalStart, fMaxVars, count, scratch);
 			if (v==kIllegalVar)
-				v = FindUnused(0, fLocalStart, count);
+				v = FindUnused(0, fLocalStart, count, scratch);
 			break;
 		case kMultiSubMode:
 			if (canUseLocals)
-				v = FindUnused(fLocalStart, fMaxVars, count);
+				v = FindUnused(fLocalStart, fMaxVars, count, scratch);
 			break;
 	}
 
@@ -119,7 +136,15 @@ int VarAllocator::Allocate(bool temp, bool canUseLocals, int count)
 	{
 		for(int i=0; i<count; ++i)
 		{
-			fStates[v + i] = temp ? kTemp : kUsed;
+			fUsed.Set(v + i);
+			fDirty.Reset(v + i);
+			fTouched.Set(v + i);
+			if (temp || scratch)
+			{
+				fTemp.Set(v + i);
+				fTouchedTemps.Set(v + i);
+			}
+			if (!scratch) fHeld.Set(v + i);
 #ifdef DEBUG_VARS
 			printf("Allocate var %d\n", v + i);
 #endif
@@ -132,19 +157,48 @@ int VarAllocator::Allocate(bool temp, bool canUseLocals, int count)
 
 void VarAllocator::Release(int v)
 {
-	if (IsLegal(v) && ((fStates[v] == kUsed) || fStates[v]==kTemp))
+	if (IsLegal(v) && IsUsed(v) && !fReserved.Test(v))
 	{
 #ifdef DEBUG_VARS
 	printf("Release var %d\n", v);
 #endif
-		fStates[v] = kDirty;
+		fUsed.Reset(v);
+		fTemp.Reset(v);
+		fDirty.Set(v);
 	}
 }
 
 
 bool VarAllocator::IsTemp(int v) const
 {
-	return IsLegal(v) && fStates[v]==kTemp;
+	return IsLegal(v) && fTemp.Test(v);
+}
+
+
+bool VarAllocator::IsLocal(int v) const
+{
+	if (fMode == kGlobalMode) return false;
+
+	// a sub run by several tasks would share any globals between them,
+	// but each task running it has its own task vars
+	if (fMode == kMultiSubMode && v < fLocalStart) return false;
+
+	return IsLegal(v) && fTouched.Test(v) && fHeld.Test(v) &&
+		IsUsed(v) && !fReserved.Test(v);
+}
+
+
+int VarAllocator::GetFreeCount() const
+{
+	int count = 0;
+
+	// a sub run by several tasks can't have globals
+	int first = (fMode == kMultiSubMode) ? fLocalStart : 0;
+
+	for(int i=first; i<fMaxVars; ++i)
+		if (!IsUsed(i) && !(fMode == kTaskMode && fShared.Test(i))) ++count;
+
+	return count;
 }
 
 
@@ -154,26 +208,50 @@ void VarAllocator::ReleaseTemp(int v)
 }
 
 
-void VarAllocator::Begin(int mode)
+void VarAllocator::Begin(int mode, int group)
 {
 	fMode = mode;
+	fGroup = group;
+	fTouched.Clear();
+	fHeld.Clear();
+	fTouchedTemps.Clear();
+	fShared.Clear();
 
 	// always start with a clean set of locals
 	for(int i=fLocalStart; i<fMaxVars; ++i) {
-		if (fStates[i] != kReserved)
-			fStates[i] = kFree;
+		if (!fReserved.Test(i))
+			MakeFree(i);
+	}
+
+	// make the group's globals that this fragment may share available
+	if (group == kNoGroup) return;
+
+	for(int i=0; i<fLocalStart; ++i) {
+		if (fGroups[i] != group) continue;
+
+		bool taskTemp = fTaskTemps.Test(i);
+		bool subVar = fSubVars.Test(i);
+
+		if ((mode == kTaskMode && subVar && !taskTemp) ||
+			(mode == kSingleSubMode && taskTemp && !subVar))
+		{
+			fShared.Set(i);
+			fUsed.Reset(i);
+		}
 	}
 }
 
 
 int VarAllocator::End()
 {
-	// at each switch, make any dirty globals vars unusable
-	// no vars should be kTemp, but just in case reserve them as well
+	// at each switch, make any globals that were used unusable
+	// outside of the group
 	for(int i=0; i<fLocalStart; ++i)
 	{
-		if ((fStates[i] == kDirty) || (fStates[i] == kTemp))
-			fStates[i] = kUsed;
+		if (fTouched.Test(i))
+			EndGlobal(i);
+		else if (fShared.Test(i))
+			fUsed.Set(i);
 	}
 
 
@@ -181,11 +259,12 @@ int VarAllocator::End()
 	int localMask = 0;
 	for(int i=fLocalStart; i<fMaxVars; ++i)
 	{
-		if (fStates[i] != kFree && fStates[i] != kReserved)
+		if ((IsUsed(i) && !fReserved.Test(i)) || fDirty.Test(i))
 			localMask |= 1 << (i-fLocalStart);
 	}
 
 	fMode = kGlobalMode;
+	fGroup = kNoGroup;
 
 	return localMask;
 }
@@ -195,7 +274,7 @@ bool VarAllocator::CheckLocalMask(int localMask) const
 {
 	for(int i=fLocalStart; i<fMaxVars; ++i) {
 		if (localMask & (1 << (i-fLocalStart))) {
-			if (fStates[i] >= kUsed) return false;
+			if (IsUsed(i)) return false;
 		}
 	}
 
@@ -203,32 +282,129 @@ bool VarAllocator::CheckLocalMask(int localMask) const
 }
 
 
-int VarAllocator::FindUnused(int start, int end, int count)
+void VarAllocator::GetUsage(Usage &usage) const
+{
+	usage.fGlobals = 0;
+	usage.fLocals = 0;
+	usage.fTemps = 0;
+
+	for(int i=0; i<fMaxVars; ++i)
+	{
+		if (!fTouched.Test(i)) continue;
+
+		if (fTouchedTemps.Test(i))
+			++usage.fTemps;
+		else if (i < fLocalStart)
+			++usage.fGlobals;
+		else
+			++usage.fLocals;
+	}
+}
+
+
+void VarAllocator::GetState(vector<ULong> &state) const
+{
+	state.push_back((ULong)fMode);
+	state.push_back((ULong)fGroup);
+	state.push_back((ULong)fMaxVars);
+	state.push_back((ULong)fLocalStart);
+
+	fUsed.Append(state);
+	fTemp.Append(state);
+	fReserved.Append(state);
+	fDirty.Append(state);
+	fTouched.Append(state);
+	fHeld.Append(state);
+	fTouchedTemps.Append(state);
+	fShared.Append(state);
+	fTaskTemps.Append(state);
+	fSubVars.Append(state);
+
+	for(int i=0; i<(int)fGroups.size(); ++i)
+		state.push_back((ULong)fGroups[i]);
+}
+
+
+void VarAllocator::EndGlobal(int v)
+{
+	MakeFree(v);
+	fUsed.Set(v);
+
+	if (fGroup != kNoGroup && fMode == kTaskMode && !fHeld.Test(v))
+	{
+		fGroups[v] = fGroup;
+		fTaskTemps.Set(v);
+	}
+	else if (fGroup != kNoGroup && fMode == kSingleSubMode)
+	{
+		fGroups[v] = fGroup;
+		fSubVars.Set(v);
+	}
+	else
+		fGroups[v] = kNoGroup;
+}
+
+
+int VarAllocator::FindUnused(int start, int end, int count, bool scratch)
 {
 	if (start < end)
 	{
 		// search [start, end) from bottom
 		end -= count;
 		for(int i=start; i<=end; ++i)
-			if (CheckAvailable(i, count)) return i;
+			if (CheckAvailable(i, count, scratch)) return i;
 	}
 	else
 	{
 		// search [end, start) from top
 		for(int i=start-count; i>=end; --i)
-			if (CheckAvailable(i, count)) return i;
+			if (CheckAvailable(i, count, scratch)) return i;
 	}
 
 	return kIllegalVar;
 }
 
 
-bool VarAllocator::CheckAvailable(int first, int count) const
+bool VarAllocator::CheckAvailable(int first, int count, bool scratch) const
 {
-	while(count--)
-	{
-		if (fStates[first++] >= kUsed) return false;
-	}
+	if (fUsed.Any(first, count)) return false;
+
+	// a task may only use a sub's globals for scratch
+	if (!scratch && fMode == kTaskMode && fShared.Any(first, count)) return false;
 
 	return true;
 }
+
+
+void VarAllocator::MakeFree(int v)
+{
+	fUsed.Reset(v);
+	fTemp.Reset(v);
+	fDirty.Reset(v);
+}
+
+
+bool VarAllocator::VarSet::Any(int first, int count) const
+{
+	// check a word at a time
+	int end = first + count;
+	while(first < end) {
+		int bit = first % kWordBits;
+		int n = kWordBits - bit;
+		if (n > end - first) n = end - first;
+
+		ULong mask = (n == kWordBits) ? ~0UL : ((1UL << n) - 1) << bit;
+		if (fWords[first / kWordBits] & mask) return true;
+
+		first += n;
+	}
+
+	return false;
+}
+
+
+void VarAllocator::VarSet::Clear()
+{
+	for(int i=0; i<(int)fWords.size(); ++i)
+		fWords[i] = 0;
+}
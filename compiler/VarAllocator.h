@@ -15,6 +15,14 @@
 #ifndef __VarAllocator_h
 #define __VarAllocator_h
 
+#ifndef __PTypes_h
+#include "PTypes.h"
+#endif
+
+#include <vector>
+
+using std::vector;
+
 class VarAllocator
 {
 public:
@@ -27,42 +35,104 @@ public:
 		kMultiSubMode
 	};
 
+	enum
+	{
+		kNoGroup = -1
+	};
+
 		VarAllocator(int maxGlobals, int maxTaskVars);
 		~VarAllocator();
 
 	bool	Reserve(int v);	// permenant reservation
 
-	int	Allocate(bool temp, bool canUseLocals, int count);
+	int	Allocate(bool temp, bool canUseLocals, int count, bool scratch = false);
 	void	Release(int v);
 
 	bool	IsTemp(int v) const;
+	// allocated by the current fragment, and not shared with other tasks
+	// (a sub called by several tasks only has task vars to itself)
+	bool	IsLocal(int v) const;
+	int	GetFreeCount() const;
 	void	ReleaseTemp(int v);
 
-	void	Begin(int mode);
+	// group is the task that will run the code (see below)
+	void	Begin(int mode, int group = kNoGroup);
 	int	End();
 
 	bool	CheckLocalMask(int localMask) const;
 
+	// the variables allocated since Begin(): globals and locals that
+	// hold values, and the temps and scratch vars of expressions
+	struct Usage
+	{
+		int	fGlobals;
+		int	fLocals;
+		int	fTemps;
+	};
+
+	void	GetUsage(Usage &usage) const;
+
+	// everything that decides what Allocate() returns from here on, as
+	// words (see FragmentCache); a VarAllocator can be copied to save
+	// and restore it
+	void	GetState(vector<ULong> &state) const;
+
 private:
-	enum VarState {
-		// these states are available for variable allocation
-		kFree = 0,
-		kDirty,
-
-		// states from here up are considered "used"
-		kUsed,
-		kTemp,
-		kReserved
+	// one bit per variable
+	class VarSet
+	{
+	public:
+			VarSet(int size) : fWords((size + kWordBits - 1) / kWordBits, 0) {}
+
+		bool	Test(int v) const	{ return (fWords[v / kWordBits] & Bit(v)) != 0; }
+		void	Set(int v)		{ fWords[v / kWordBits] |= Bit(v); }
+		void	Reset(int v)		{ fWords[v / kWordBits] &= ~Bit(v); }
+
+		bool	Any(int first, int count) const;
+		void	Clear();
+		void	Append(vector<ULong> &words) const	{ words.insert(words.end(), fWords.begin(), fWords.end()); }
+
+	private:
+		enum { kWordBits = 32 };
+
+		static ULong	Bit(int v)	{ return 1UL << (v % kWordBits); }
+
+		vector<ULong>	fWords;
 	};
 
+	/*
+	 * A variable is free if it is in none of the sets, and dirty
+	 * if it has been released since Begin().  Both kinds may be
+	 * allocated.  Temp and reserved vars are also in fUsed.
+	 */
 	bool	IsLegal(int v) const { return (v >= 0 && v < fMaxVars); }
-	int	FindUnused(int start, int end, int count);
-	bool	CheckAvailable(int first, int count) const;
+	bool	IsUsed(int v) const { return fUsed.Test(v); }
+	void	MakeFree(int v);
+	void	EndGlobal(int v);
+	int	FindUnused(int start, int end, int count, bool scratch);
+	bool	CheckAvailable(int first, int count, bool scratch) const;
 
 	int		fMode;
+	int		fGroup;
 	int		fMaxVars;
 	int		fLocalStart;
-	VarState*	fStates;
+	VarSet		fUsed;
+	VarSet		fTemp;
+	VarSet		fReserved;
+	VarSet		fDirty;
+
+	// globals allocated since Begin(), and the ones that weren't scratch
+	VarSet		fTouched;
+	VarSet		fHeld;
+	// vars allocated as temps or scratch since Begin()
+	VarSet		fTouchedTemps;
+
+	// globals that may be shared within a group, and how each group
+	// has been using them
+	VarSet		fShared;
+	VarSet		fTaskTemps;
+	VarSet		fSubVars;
+	vector<int>	fGroups;
 };
 
 #endif
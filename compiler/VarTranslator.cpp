@@ -17,24 +17,26 @@
 #include "AssignStmt.h"
 #include "AtomExpr.h"
 #include "IncDecExpr.h"
+#include "PDebug.h"
 
 
-bool VarTranslator::operator()(Stmt *s)
+void VarTranslator::Add(int from, int to)
 {
-	vector<Expr*> v;
-	s->GetExprs(v);
+	int i = from - kVirtualVarBase;
+	PASSERT(i >= 0 && i <= kVirtualVarMask);
 
-	int n = v.size();
-	int i;
+	if (i >= (int)fTable.size())
+		fTable.resize(i+1, kIllegalVar);
+	fTable[i] = to;
+}
 
-	for(i=0; i<n; ++i)
-	{
-		::Apply(v[i], *this);
-	}
 
+bool VarTranslator::operator()(Stmt *s)
+{
+	int n = s->GetExprCount();
 
-	if (Translatable *t = dynamic_cast<Translatable*>(s))
-		t->Translate(fFrom, fTo);
+	for(int i=0; i<n; ++i)
+		::Apply(s->GetExpr(i), *this);
 
 	return true;
 }
@@ -42,11 +44,6 @@ bool VarTranslator::operator()(Stmt *s)
 
 bool VarTranslator::operator()(Expr *e)
 {
-	if (Translatable *t = dynamic_cast<Translatable*>(e))
-		t->Translate(fFrom, fTo);
-
+	e->Translate(*this);
 	return true;
 }
-
-
-
@@ -14,26 +14,44 @@
 #ifndef __VarTranslator_h
 #define __VarTranslator_h
 
+#ifndef __Variable_h
+#include "Variable.h"
+#endif
+
+#include <vector>
+
+using std::vector;
+
 class Stmt;
 class Expr;
 
+/*
+ * An Apply() functor that replaces virtual variables with the ones
+ * they were added as.  All of the variables are replaced in a single
+ * pass over the statements, and looking a variable up is an index into
+ * a table rather than a search.
+ */
 class VarTranslator
 {
 public:
-			VarTranslator(int from, int to) : fFrom(from), fTo(to) {}
+			VarTranslator() {}
+			VarTranslator(int from, int to)	{ Add(from, to); }
+
+	// from must be a virtual variable
+	void	Add(int from, int to);
+
+	// what var was added as, or var itself if it wasn't
+	int		Translate(int var) const
+	{
+		int i = var - kVirtualVarBase;
+		if (i < 0 || i >= (int)fTable.size()) return var;
+		return fTable[i] == kIllegalVar ? var : fTable[i];
+	}
 
 	bool	operator()(Stmt *s);
 	bool	operator()(Expr *e);
 private:
-	int		fFrom;
-	int		fTo;
-};
-
-
-class Translatable
-{
-public:
-	virtual void	Translate(int from, int to) = 0;
+	vector<int>	fTable;	// indexed by virtual variable number
 };
 
 
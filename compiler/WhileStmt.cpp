@@ -12,7 +12,10 @@
  *
  */
 #include "WhileStmt.h"
+#include "JumpStmt.h"
 #include "Bytecode.h"
+#include "LoopHoister.h"
+#include "Program.h"
 
 WhileStmt::WhileStmt(Expr *e, Stmt *s) :
 	ChainStmt(s)
@@ -23,7 +26,7 @@ WhileStmt::WhileStmt(Expr *e, Stmt *s) :
 
 WhileStmt::~WhileStmt()
 {
-	delete fCondition;
+	Expr::Release(fCondition);
 }
 
 
@@ -34,6 +37,13 @@ void WhileStmt::EmitActual(Bytecode &b)
 	int startLabel;
 	int value;
 
+	LoopHoister hoister(b, this);
+	if (!fCondition->Evaluate(value) || value)
+	{
+		hoister.Hoist(fCondition);
+		hoister.Hoist(GetBody());
+	}
+
 	int cLabel = b.PushFlow(Bytecode::kContinueFlow);
 	int bLabel = b.PushFlow(Bytecode::kBreakFlow);
 
@@ -58,6 +68,25 @@ void WhileStmt::EmitActual(Bytecode &b)
 		}
 	}
 
+	// with a profile, a loop that mostly runs its body less than once
+	// a time tests at the top, so skipping it is a single test
+	if (!optimized && gProgram->HasProfile() &&
+		gProgram->GetOptimize() >= Program::kBasicOptimize &&
+		2 * gProgram->GetHeat(GetBody()) < gProgram->GetHeat(fCondition->GetLoc()))
+	{
+		/*	cPos:
+				test !C -> bPos
+				body
+				jump -> cPos
+			bPos:
+		*/
+		b.SetLabel(cLabel);
+		fCondition->EmitBranch(b, bLabel, false);
+		GetBody()->Emit(b);
+		b.AddJump(cLabel);
+		optimized = true;
+	}
+
 	if (!optimized)
 	{
 		/* 		jump -> cPos
@@ -93,3 +122,15 @@ Stmt* WhileStmt::CloneActual(Mapping *b) const
 {
 	return new WhileStmt(fCondition->Clone(b), GetBody()->Clone(b));
 }
+
+
+bool WhileStmt::FallsThrough()
+{
+	int value;
+
+	// while(true) only ends with a break
+	if (fCondition->Evaluate(value) && value)
+		return JumpStmt::ContainsBreak(GetBody());
+
+	return true;
+}
@@ -30,7 +30,9 @@ public:
 
 	void	EmitActual(Bytecode &b);
 	Stmt*	CloneActual(Mapping *b) const;
-	virtual void	GetExprs(vector<Expr*> & v) const	{ v.push_back(fCondition); }
+	bool	FallsThrough();
+	virtual int	GetExprCount() const	{ return 1; }
+	virtual Expr*	GetExpr(int) const	{ return fCondition; }
 
 private:
 	Expr*	fCondition;
@@ -0,0 +1,1399 @@
+#define api_symbols_count 1095
+#define api_symbols_buckets 274
+#define api_symbols_slots 2048
+
+static const char *const api_symbols_names[]={
+"ACQUIRE_LED",
+"ACQUIRE_OUT_A",
+"ACQUIRE_OUT_B",
+"ACQUIRE_OUT_C",
+"ACQUIRE_SOUND",
+"ACQUIRE_USER_1",
+"ACQUIRE_USER_2",
+"ACQUIRE_USER_3",
+"ACQUIRE_USER_4",
+"AGC",
+"ANIMATION",
+"ANIMATION_ALARM",
+"ANIMATION_FLASH",
+"ANIMATION_GREEN_TO_RED",
+"ANIMATION_POINT_FORWARD",
+"ANIMATION_RED_TO_GREEN",
+"ANIMATION_SCAN",
+"ANIMATION_SPARKLE",
+"ANIMATION_THINKING",
+"ASPECT_BACK",
+"ASPECT_BACK_LEFT",
+"ASPECT_BACK_RIGHT",
+"ASPECT_FRONT",
+"ASPECT_FRONT_LEFT",
+"ASPECT_FRONT_RIGHT",
+"Action",
+"ActiveEvents",
+"AddToDatalog",
+"AnimateLED",
+"BATTERY_LOW",
+"BATTERY_MAX",
+"BATTERY_MIN",
+"BasicMove",
+"BatteryLevel",
+"BeaconControl",
+"BitClear",
+"BitSet",
+"CLR_BREAKPOINTS",
+"CLR_DATALOG",
+"CLR_EVENTS",
+"CLR_INPUTS",
+"CLR_TASK_STACK",
+"CLR_TIMERS",
+"CLR_VARIABLES",
+"CMD_FIRE_ELECTRONET",
+"CMD_FIRE_LASER",
+"CMD_FIRE_SPINNER",
+"CMD_FROM_RCX2",
+"CMD_GAME_BLINK",
+"CMD_GAME_COMMAND",
+"CMD_GAME_GETVAR",
+"CMD_GAME_GIVE",
+"CMD_GAME_LOSE",
+"CMD_GAME_START",
+"CMD_GAME_TAKE",
+"CMD_GAME_VALUE",
+"CMD_GAME_WIN",
+"CMD_REACT_TO_GIGAMESH",
+"CMD_REACT_TO_SHADOWSTRIKE",
+"CMD_REACT_TO_SNAPTRAX",
+"CMD_REACT_TO_TECHNOJAW",
+"CMD_SMART_BOMB",
+"CMD_TELL_DIZZY",
+"CMD_TELL_FLASHBLIND",
+"CMD_TELL_FREEZE",
+"CMD_TELL_MAGNET",
+"CMD_TELL_REPULSE",
+"CMD_TELL_REVERSE",
+"CMD_TELL_SLOW",
+"CMD_TELL_TAKECONTROL",
+"CMD_TYPE_FIRE",
+"CMD_TYPE_GAME",
+"CMD_TYPE_MASK",
+"CMD_TYPE_REACT_TO",
+"CMD_TYPE_SPARE",
+"CMD_TYPE_TELL",
+"CMD_TYPE_USER",
+"CMD_TYPE_VLL",
+"COMMAND_CONTROLLER",
+"CONTROLLER_BUTTON1",
+"CONTROLLER_BUTTON2",
+"CONTROLLER_BUTTON3",
+"CONTROLLER_BUTTON4",
+"CONTROLLER_BUTTON5",
+"CalibrateEvent",
+"CalibrateSensor",
+"Call",
+"ClearAll",
+"ClearAllEvents",
+"ClearCounter",
+"ClearEvent",
+"ClearMessage",
+"ClearSensor",
+"ClearSound",
+"ClearTachoCounter",
+"ClearTimer",
+"ClearWorld",
+"ClickCounter",
+"ClickTime",
+"CommErrorsFraming",
+"CommErrorsOverrun",
+"CommErrorsParity",
+"CommErrorsTimeout",
+"Counter",
+"CounterLimit",
+"CreateDatalog",
+"CurrentEvents",
+"CurrentTask",
+"CurrentTaskID",
+"DIRECTION_CENTER",
+"DIRECTION_LEFT",
+"DIRECTION_LEFT_OF_CENTER",
+"DIRECTION_RIGHT",
+"DIRECTION_RIGHT_OF_CENTER",
+"DIRSPEED",
+"DISPLAY_EXCEPTION",
+"DISPLAY_OUT_A",
+"DISPLAY_OUT_B",
+"DISPLAY_OUT_C",
+"DISPLAY_SENSOR_1",
+"DISPLAY_SENSOR_2",
+"DISPLAY_SENSOR_3",
+"DISPLAY_USER",
+"DISPLAY_WATCH",
+"Datalog",
+"DatalogByte",
+"DatalogSize",
+"DatalogType",
+"DatalogValue",
+"DebugTaskMode",
+"DecCounter",
+"DefaultSerialComm",
+"DefaultSerialPacket",
+"DefaultStackSize",
+"DisableOutput",
+"Disp",
+"Display",
+"Drive",
+"EEPROM",
+"EEPROM_BIRTHDATE",
+"EEPROM_BOTDATA",
+"EEPROM_DEFAULTPINGRATE",
+"EEPROM_FIRSTTOKEN",
+"EEPROM_HIGHSCORE",
+"EEPROM_LASTTOKEN",
+"EEPROM_LONGID",
+"EEPROM_LOSSES",
+"EEPROM_MAXBOTS",
+"EEPROM_MAXTOKENS",
+"EEPROM_MISSIONID",
+"EEPROM_MISSIONPOINTS",
+"EEPROM_MISSIONSPLAYED",
+"EEPROM_MOTORCONTROL",
+"EEPROM_PLAYSECONDS",
+"EEPROM_POINTS",
+"EEPROM_ROBOTNAME",
+"EEPROM_RUNS",
+"EEPROM_SPECIES",
+"EEPROM_STATUS",
+"EEPROM_TOTALPLAYTIME",
+"EEPROM_USERLEVEL",
+"EEPROM_WINS",
+"EST_COUNTER_1",
+"EST_COUNTER_2",
+"EST_COUNTER_3",
+"EST_INFRARED_STATUS",
+"EST_LAST_IR_MSG",
+"EST_SENSOR_1",
+"EST_SENSOR_2",
+"EST_SENSOR_3",
+"EST_SENSOR_UNUSED",
+"EST_TIMER_1",
+"EST_TIMER_2",
+"EST_TIMER_3",
+"EST_TIMER_4",
+"EST_USER_EVENT_0",
+"EST_USER_EVENT_1",
+"EST_USER_EVENT_2",
+"EST_USER_EVENT_3",
+"EST_USER_EVENT_4",
+"EST_VIRTUAL_MOTOR",
+"EST_VIRTUAL_SENSOR",
+"EST_WAIT_FOR_MSG",
+"ES_ABOVE_UPPER",
+"ES_BELOW_LOWER",
+"ES_BETWEEN",
+"ES_UNDETERMINED",
+"EVENT_1_PRESSED",
+"EVENT_1_RELEASED",
+"EVENT_2_PRESSED",
+"EVENT_2_RELEASED",
+"EVENT_COUNTER_0",
+"EVENT_COUNTER_1",
+"EVENT_LIGHT_CLICK",
+"EVENT_LIGHT_DOUBLECLICK",
+"EVENT_LIGHT_HIGH",
+"EVENT_LIGHT_LOW",
+"EVENT_LIGHT_NORMAL",
+"EVENT_MASK",
+"EVENT_MESSAGE",
+"EVENT_TIMER_0",
+"EVENT_TIMER_1",
+"EVENT_TIMER_2",
+"EVENT_TYPE_4",
+"EVENT_TYPE_5",
+"EVENT_TYPE_6",
+"EVENT_TYPE_CLICK",
+"EVENT_TYPE_DOUBLECLICK",
+"EVENT_TYPE_EDGE",
+"EVENT_TYPE_ENTRY_CHANGED",
+"EVENT_TYPE_ENTRY_FOUND",
+"EVENT_TYPE_FASTCHANGE",
+"EVENT_TYPE_HIGH",
+"EVENT_TYPE_INFRARED_IDLE",
+"EVENT_TYPE_LOW",
+"EVENT_TYPE_MESSAGE",
+"EVENT_TYPE_MSG_DISCARD",
+"EVENT_TYPE_MSG_RECEIVED",
+"EVENT_TYPE_NORMAL",
+"EVENT_TYPE_PRESSED",
+"EVENT_TYPE_PULSE",
+"EVENT_TYPE_RELEASED",
+"EVENT_TYPE_RESET",
+"EVENT_TYPE_VIRTUAL_MOTOR_CHANGE",
+"EVENT_TYPE_VIRTUAL_MOTOR_POWER",
+"EVENT_TYPE_VIRTUAL_SENSOR_DEF",
+"EVENT_TYPE_VLL_MSG_RECEIVED",
+"EffectSound",
+"EffectTime",
+"EnableOutput",
+"Event",
+"EventCounts",
+"EventFeedback",
+"EventSrc",
+"EventState",
+"EventType",
+"ExpandedRemoteMessages",
+"ExpandedSubroutines",
+"ExternalMotorRunning",
+"FMT_HHMM",
+"FMT_MMSS",
+"FMT_MSSTENTHS",
+"FancyMove",
+"FastTimer",
+"FindWorld",
+"FirmwareVersion",
+"FixedTone",
+"FixedWaitEffect",
+"Float",
+"FloatDuringInactivePWM",
+"Fwd",
+"GOff",
+"GOn",
+"Gate",
+"GateOff",
+"GetWorld",
+"GetWorldAspect",
+"GetWorldDirection",
+"GetWorldLinkID",
+"GetWorldNote",
+"GetWorldRange",
+"GetWorldShortID",
+"Glide",
+"GlobalOutputStatus",
+"GlobalVar",
+"Hysteresis",
+"ID_BOT_MAX",
+"ID_BOT_MIN",
+"ID_CTRL_1",
+"ID_CTRL_2",
+"ID_CTRL_3",
+"ID_CTRL_4",
+"ID_CTRL_5",
+"ID_CTRL_6",
+"ID_NONE",
+"ID_PC",
+"INDEX_BROADCAST",
+"INDEX_INVALID",
+"INDEX_LINKCAST",
+"IN_1",
+"IN_2",
+"IN_3",
+"IN_ANGLE",
+"IN_CFG",
+"IN_EDGE",
+"IN_L",
+"IN_LIGHT",
+"IN_M",
+"IN_PULSE",
+"IN_R",
+"IN_SWITCH",
+"IRM_ACCEPT_ALL",
+"IRM_ACCEPT_USER",
+"IRM_DISCARD",
+"IRMode",
+"IR_HI",
+"IR_LO",
+"IgnoreMessagesCPU",
+"ImmediateBatteryLevel",
+"IncCounter",
+"Indirect",
+"InitRCComm",
+"InitSpybotComm",
+"Input",
+"InputBool",
+"InputMode",
+"InputRaw",
+"InputType",
+"InterCharTimeout",
+"IntrinsicIndGlobal",
+"InvertOutput",
+"LCDRefreshRate",
+"LED",
+"LED_ALL",
+"LED_ALL_GREEN",
+"LED_ALL_RED",
+"LED_ALL_RED_GREEN",
+"LED_GREEN1",
+"LED_GREEN2",
+"LED_GREEN3",
+"LED_MODE_BLINK",
+"LED_MODE_DURATION",
+"LED_MODE_GREEN_SCALE",
+"LED_MODE_GREEN_SCALE_BLINK",
+"LED_MODE_ON",
+"LED_MODE_RED_SCALE",
+"LED_MODE_RED_SCALE_BLINK",
+"LED_MODE_SCALE",
+"LED_MODE_SCALE_BLINK",
+"LED_MODE_SCALE_DURATION",
+"LED_MODE_VLL",
+"LED_MODE_VLL_BLINK",
+"LED_MODE_VLL_DURATION",
+"LED_MODE_YELLOW",
+"LED_MODE_YELLOW_BLINK",
+"LED_MODE_YELLOW_DURATION",
+"LED_RED1",
+"LED_RED2",
+"LED_RED3",
+"LED_YELLOW",
+"LIGHT_OFF",
+"LIGHT_ON",
+"LinkID",
+"LowerLimit",
+"MAX_VOLUME",
+"MOTORCONTROL_LEFTDIR",
+"MOTORCONTROL_NORMALSPEEDMASK",
+"MOTORCONTROL_RIGHTDIR",
+"MOTORCONTROL_SLOWSPEEDMASK",
+"MOVE_BASIC",
+"MOVE_BASIC_AVOID_LEFT",
+"MOVE_BASIC_AVOID_RIGHT",
+"MOVE_BASIC_BACKWARD",
+"MOVE_BASIC_FORWARD",
+"MOVE_BASIC_REST",
+"MOVE_BASIC_SPIN_LEFT",
+"MOVE_BASIC_SPIN_RIGHT",
+"MOVE_BASIC_STOP",
+"MOVE_BASIC_TURN_LEFT",
+"MOVE_BASIC_TURN_RIGHT",
+"MOVE_FANCY",
+"MOVE_FANCY_BUG_FORWARD",
+"MOVE_FANCY_DANCE",
+"MOVE_FANCY_FAKE_LEFT",
+"MOVE_FANCY_LAZY",
+"MOVE_FANCY_RAKE_RIGHT",
+"MOVE_FANCY_SCAN",
+"MOVE_FANCY_SEARCH",
+"MOVE_FANCY_SHAKE",
+"MOVE_FANCY_STEP",
+"MOVE_FANCY_STEP_BACK",
+"MOVE_FANCY_WALK",
+"MOVE_FANCY_WALK_BACK",
+"MOVE_FANCY_ZIGZAG",
+"MOVE_MASK",
+"MOVE_RANDOM",
+"MOVE_RANDOM_BACKWARD",
+"MOVE_RANDOM_FORWARD",
+"MOVE_RANDOM_REST",
+"MOVE_RANDOM_SPIN_LEFT",
+"MOVE_RANDOM_SPIN_RIGHT",
+"MOVE_RANDOM_TURN_LEFT",
+"MOVE_RANDOM_TURN_RIGHT",
+"MOVE_SLOWDOWN",
+"MOVE_SLOWDOWN_BACKWARD",
+"MOVE_SLOWDOWN_FORWARD",
+"MOVE_SLOWDOWN_SPIN_LEFT",
+"MOVE_SLOWDOWN_SPIN_RIGHT",
+"MOVE_SPEEDUP",
+"MOVE_SPEEDUP_BACKWARD",
+"MOVE_SPEEDUP_FORWARD",
+"MOVE_SPEEDUP_SPIN_LEFT",
+"MOVE_SPEEDUP_SPIN_RIGHT",
+"MOVE_TYPE_MASK",
+"MPD_FLOAT",
+"MPD_FWD",
+"MPD_OFF",
+"MPD_REV",
+"MSG_BROADCAST",
+"MSG_COMMAND",
+"MSG_DIRECT",
+"MSG_HI_BYTE",
+"MSG_INDEX",
+"MSG_IR",
+"MSG_LINKCAST",
+"MSG_LO_BYTE",
+"MSG_NONE",
+"MSG_PC",
+"MSTimer",
+"MS_BRAKE",
+"MS_FLOAT",
+"MS_FWD",
+"MS_REV",
+"MTR_A",
+"MTR_B",
+"MTR_BRAKE_POWER_1",
+"MTR_BRAKE_POWER_2",
+"MTR_BRAKE_POWER_3",
+"MTR_BRAKE_POWER_4",
+"MTR_BRAKE_POWER_5",
+"MTR_BRAKE_POWER_6",
+"MTR_BRAKE_POWER_7",
+"MTR_BRAKE_POWER_8",
+"MTR_C",
+"MTR_D",
+"MTR_E",
+"MTR_F",
+"MTR_FLOAT_POWER_1",
+"MTR_FLOAT_POWER_2",
+"MTR_FLOAT_POWER_3",
+"MTR_FLOAT_POWER_4",
+"MTR_FLOAT_POWER_5",
+"MTR_FLOAT_POWER_6",
+"MTR_FLOAT_POWER_7",
+"MTR_FLOAT_POWER_8",
+"MTR_FWD_POWER_1",
+"MTR_FWD_POWER_2",
+"MTR_FWD_POWER_3",
+"MTR_FWD_POWER_4",
+"MTR_FWD_POWER_5",
+"MTR_FWD_POWER_6",
+"MTR_FWD_POWER_7",
+"MTR_FWD_POWER_8",
+"MTR_REV_POWER_1",
+"MTR_REV_POWER_2",
+"MTR_REV_POWER_3",
+"MTR_REV_POWER_4",
+"MTR_REV_POWER_5",
+"MTR_REV_POWER_6",
+"MTR_REV_POWER_7",
+"MTR_REV_POWER_8",
+"MemoryMapAddress",
+"Message",
+"MessageParam",
+"MissedSensorADConversions",
+"MotorBrakePower",
+"MotorPower128",
+"MotorPower8",
+"MotorPowerSigned",
+"MotorTransitionDelay",
+"MuteSound",
+"Negate",
+"NoPowerDownOnAC",
+"OUT_A",
+"OUT_AB",
+"OUT_ABC",
+"OUT_AC",
+"OUT_B",
+"OUT_BC",
+"OUT_C",
+"OUT_D",
+"OUT_E",
+"OUT_F",
+"OUT_FLIP",
+"OUT_FLOAT",
+"OUT_FULL",
+"OUT_FWD",
+"OUT_HALF",
+"OUT_L",
+"OUT_LOW",
+"OUT_OFF",
+"OUT_ON",
+"OUT_R",
+"OUT_REV",
+"OUT_TOGGLE",
+"OUT_X",
+"ObvertOutput",
+"Off",
+"On",
+"OnFor",
+"OnFwd",
+"OnRev",
+"OnWait",
+"OnWaitDifferent",
+"OpcodesPerTimeslice",
+"OutputDir",
+"OutputMode",
+"OutputPower",
+"OutputStatus",
+"PingControl",
+"PingData",
+"PingID",
+"PingInterval",
+"PlayNote",
+"PlaySound",
+"PlaySounds",
+"PlayTone",
+"Pop",
+"PowerDownDelay",
+"Program",
+"Push",
+"QueuedSoundCount",
+"RANGE_ANYWHERE",
+"RANGE_HERE",
+"RANGE_NOWHERE",
+"RANGE_THERE",
+"RCRxChannel",
+"RCTXMODE_CONTINUOUS",
+"RCTXMODE_SINGLE_SHOT",
+"RCTxChannel",
+"RCTxMode",
+"RC_CHANNEL_1",
+"RC_CHANNEL_2",
+"RC_CHANNEL_3",
+"RC_CHANNEL_BROADCAST",
+"RC_CHANNEL_DISABLED",
+"RC_CMD_FLOAT",
+"RC_CMD_FWD",
+"RC_CMD_OFF",
+"RC_CMD_REV",
+"REL_EQ",
+"REL_GT",
+"REL_LT",
+"REL_NE",
+"Random",
+"RandomMove",
+"RepeatAnimation",
+"RepeatEffect",
+"ResetMSTimer",
+"Rev",
+"RotDebouncedGlitches",
+"RotErrorsCount",
+"RxMessage",
+"RxMessageChannel",
+"RxMessageID",
+"RxMessageIndex",
+"RxMessageLock",
+"S1",
+"S2",
+"S3",
+"SCOUT_MODE_POWER",
+"SCOUT_MODE_STANDALONE",
+"SENSOR_1",
+"SENSOR_2",
+"SENSOR_3",
+"SENSOR_CELSIUS",
+"SENSOR_EDGE",
+"SENSOR_FAHRENHEIT",
+"SENSOR_L",
+"SENSOR_LIGHT",
+"SENSOR_M",
+"SENSOR_MODE_BOOL",
+"SENSOR_MODE_CELSIUS",
+"SENSOR_MODE_EDGE",
+"SENSOR_MODE_FAHRENHEIT",
+"SENSOR_MODE_PERCENT",
+"SENSOR_MODE_PULSE",
+"SENSOR_MODE_RAW",
+"SENSOR_MODE_ROTATION",
+"SENSOR_PULSE",
+"SENSOR_R",
+"SENSOR_ROTATION",
+"SENSOR_TOUCH",
+"SENSOR_TYPE_ACTIVE_RAW",
+"SENSOR_TYPE_LIGHT",
+"SENSOR_TYPE_NONE",
+"SENSOR_TYPE_ROTATION",
+"SENSOR_TYPE_TEMPERATURE",
+"SENSOR_TYPE_TOUCH",
+"SERIAL_BAUD",
+"SERIAL_BAUD_2400",
+"SERIAL_BAUD_4800",
+"SERIAL_BAUD_9600",
+"SERIAL_BIPHASE",
+"SERIAL_BIPHASE_OFF",
+"SERIAL_BIPHASE_ON",
+"SERIAL_CHANNEL",
+"SERIAL_CHANNEL_IR",
+"SERIAL_CHANNEL_PC",
+"SERIAL_CHECKSUM",
+"SERIAL_CHECKSUM_NONE",
+"SERIAL_CHECKSUM_SUM",
+"SERIAL_CHECKSUM_ZERO_SUM",
+"SERIAL_COMM_4800",
+"SERIAL_COMM_76KHZ",
+"SERIAL_COMM_9600",
+"SERIAL_COMM_DEFAULT",
+"SERIAL_COMM_DUTY25",
+"SERIAL_COMM_RC",
+"SERIAL_COMM_RCX",
+"SERIAL_COMM_SPYBOT",
+"SERIAL_PACKET_CHECKSUM",
+"SERIAL_PACKET_DEFAULT",
+"SERIAL_PACKET_NEGATED",
+"SERIAL_PACKET_PREAMBLE",
+"SERIAL_PACKET_RC",
+"SERIAL_PACKET_RCX",
+"SERIAL_PACKET_SPYBOT",
+"SERIAL_PREAMBLE_LEN",
+"SERIAL_PREAMBLE_POS",
+"SERIAL_TYPE",
+"SERIAL_TYPE_RC",
+"SERIAL_TYPE_RCX",
+"SERIAL_TYPE_SPYBOT",
+"SERIAL_TYPE_USER",
+"SLS_RECEIVING_MSG",
+"SLS_TRANSMITTING",
+"SLS_UNKNOWN",
+"SLS_WAIT_FOR_MSG",
+"SMODE_ANGLE",
+"SMODE_BOOL",
+"SMODE_CELSIUS",
+"SMODE_EDGE",
+"SMODE_FAHRENHEIT",
+"SMODE_PERCENT",
+"SMODE_PULSE",
+"SMODE_RAW",
+"SMOTOR_FWD",
+"SOUNDEFFECT",
+"SOUND_ACTIVATE_CLOAK",
+"SOUND_ACTIVATE_FLASH_BLIND",
+"SOUND_ACTIVATE_REFLECT",
+"SOUND_ACTIVATE_SHIELDS",
+"SOUND_BIG_EXPLOSION",
+"SOUND_BOMB_ALERT",
+"SOUND_BOOST",
+"SOUND_BURNT",
+"SOUND_CLICK",
+"SOUND_CRASH",
+"SOUND_DANGER_ALERT",
+"SOUND_DEACTIVATE_CLOAK",
+"SOUND_DEACTIVATE_REFLECT",
+"SOUND_DEACTIVATE_SHIELDS",
+"SOUND_DIZZY",
+"SOUND_DOUBLE_BEEP",
+"SOUND_DOWN",
+"SOUND_EXCEPTION",
+"SOUND_EXPLOSION",
+"SOUND_FAST_UP",
+"SOUND_FIGHT",
+"SOUND_FINAL_COUNTDOWN",
+"SOUND_FIRE_ELECTRONET",
+"SOUND_FIRE_LASER",
+"SOUND_FIRE_SPINNER",
+"SOUND_FREEZE",
+"SOUND_GEIGER",
+"SOUND_GENERAL_ALERT",
+"SOUND_GOTO",
+"SOUND_GOT_IT",
+"SOUND_GRINDED",
+"SOUND_HELP",
+"SOUND_HIT_BY_ELECTRONET",
+"SOUND_HIT_BY_LASER",
+"SOUND_HIT_BY_SPINNER",
+"SOUND_HIT_BY_WIND",
+"SOUND_IM_IT",
+"SOUND_LOW_BEEP",
+"SOUND_LOW_ENERGY_ALERT",
+"SOUND_MAGNET",
+"SOUND_NONE",
+"SOUND_OUCH",
+"SOUND_OUT_OF_ENERGY_ALERT",
+"SOUND_PLACE_BOMB",
+"SOUND_POINT_TO",
+"SOUND_PROXIMITY_ALERT",
+"SOUND_QUAD_DAMAGE",
+"SOUND_REFLECT",
+"SOUND_REPULSE",
+"SOUND_REVERSE",
+"SOUND_SCAN",
+"SOUND_SCORE_ALERT",
+"SOUND_SHOCKED",
+"SOUND_SHORT_BLIP",
+"SOUND_SIREN",
+"SOUND_SLOW",
+"SOUND_SMACKED",
+"SOUND_TAG",
+"SOUND_TICK_TOCK",
+"SOUND_TIME_ALERT",
+"SOUND_TRILL_DOWN",
+"SOUND_TRILL_UP",
+"SOUND_TURBO",
+"SOUND_UP",
+"SOUND_WHISPER",
+"SOUND_WHISTLE",
+"SOUND_YELL",
+"SPECIES_GIGAMESH",
+"SPECIES_SHADOWSTRIKE",
+"SPECIES_SNAPTRAX",
+"SPECIES_TECHNOJAW",
+"SPY_ASPECT",
+"SPY_CTRL_BTN_1",
+"SPY_CTRL_BTN_2",
+"SPY_CTRL_BTN_3",
+"SPY_CTRL_BTN_4",
+"SPY_CTRL_BTN_5",
+"SPY_CTRL_RCX_1",
+"SPY_CTRL_RCX_2",
+"SPY_CTRL_RCX_3",
+"SPY_CTRL_RCX_4",
+"SPY_CTRL_RCX_5",
+"SPY_CTRL_RCX_6",
+"SPY_CTRL_RCX_7",
+"SPY_CTRL_RCX_8",
+"SPY_DIRECTION",
+"SPY_INFO",
+"SPY_LINKID",
+"SPY_NOTE",
+"SPY_RANGE",
+"SPY_SHORTID",
+"SPY_TARGETID",
+"STATUS_DOWNLOADING",
+"STATUS_INITIALIZING",
+"STATUS_LOCKED",
+"STYPE_ANGLE",
+"STYPE_LIGHT",
+"STYPE_SWITCH",
+"STYPE_TEMP",
+"SYS_BATTERY_LEVEL",
+"SYS_COMM_ERRORS_FRAMING",
+"SYS_COMM_ERRORS_OVERRUN",
+"SYS_COMM_ERRORS_PARITY",
+"SYS_COMM_ERRORS_TIMEOUT",
+"SYS_CURRENT_TASK",
+"SYS_DATALOG_SIZE",
+"SYS_DEBUG_TASK_MODE",
+"SYS_DEFAULT_TASK_STACK_SIZE",
+"SYS_EXPANDED_RC_MESSAGES",
+"SYS_EXPANDED_SUBROUTINES",
+"SYS_FLOAT_DURING_INACTIVE_PWM",
+"SYS_IGNORE_MESSAGES_CPU",
+"SYS_INTER_CHAR_TIMEOUT",
+"SYS_LCD_REFRESH_RATE",
+"SYS_MEMORY_MAP_ADDRESS",
+"SYS_MOTOR_TRANSITION_DELAY",
+"SYS_NO_POWER_DOWN_ON_AC",
+"SYS_OPCODES_PER_TIMESLICE",
+"SYS_PLAY_SOUNDS",
+"SYS_POWER_DOWN_DELAY",
+"SYS_PREAMBLE_SIZE",
+"SYS_QUEUED_SOUND_COUNT",
+"SYS_ROT_DEBOUNCED_GLITCHES",
+"SYS_ROT_ERRORS_COUNT",
+"SYS_SENSOR_DELAY_CYCLES",
+"SYS_SENSOR_MISSED_CONVERSIONS",
+"SYS_SENSOR_REFRESH_RATE",
+"SYS_SENSOR_REFRESH_STATE",
+"SYS_SENSOR_SCAN_COUNT",
+"SYS_SENSOR_STARTUP_DELAY",
+"SYS_SERIAL_LINK_STATUS",
+"SYS_SOUND_PLAYING",
+"SYS_TASK_ACQUIRE_PRIORITY",
+"SYS_TASK_SCHEDULING_PRIORITY",
+"SYS_TRANSMITTER_RANGE",
+"SYS_UNSOLICITED_MESSAGES",
+"SYS_VOLUME",
+"SYS_WATCH_FORMAT",
+"ScoutRules",
+"SelectDisplay",
+"SelectProgram",
+"SelectSounds",
+"SendAllRangeMessage",
+"SendMessage",
+"SendMessageWithParam",
+"SendRCMessage",
+"SendRCMsg",
+"SendRCXMessage",
+"SendSerial",
+"SendSpybotCtrlMessage",
+"SendSpybotCtrlMsg",
+"SendSpybotCtrlPingMessage",
+"SendSpybotCtrlPingMsg",
+"SendSpybotMessage",
+"SendSpybotMsg",
+"SendSpybotPing",
+"SendSpybotPingMsg",
+"SendVLL",
+"Sensor",
+"SensorDelayCycles",
+"SensorMode",
+"SensorRefreshRate",
+"SensorRefreshState",
+"SensorScanCount",
+"SensorStartupDelay",
+"SensorType",
+"SensorValue",
+"SensorValueBool",
+"SensorValueRaw",
+"SerialBaud",
+"SerialBiPhase",
+"SerialChannel",
+"SerialChecksum",
+"SerialComm",
+"SerialData",
+"SerialLinkStatus",
+"SerialPacket",
+"SerialPreambleLen",
+"SerialPreamblePos",
+"SerialType",
+"Set",
+"SetAnimation",
+"SetClickCounter",
+"SetClickTime",
+"SetCounterLimit",
+"SetDatalog",
+"SetDefaultSerialComm",
+"SetDefaultSerialPacket",
+"SetDefaultStackSize",
+"SetDirection",
+"SetEEPROM",
+"SetEffectSound",
+"SetEffectTime",
+"SetEvent",
+"SetEventCounts",
+"SetEventFeedback",
+"SetEventSrc",
+"SetEventType",
+"SetExpandedRemoteMessages",
+"SetExpandedSubroutines",
+"SetFloatDuringInactivePWM",
+"SetGlobalDirection",
+"SetGlobalOutput",
+"SetHysteresis",
+"SetIndirectVar",
+"SetInterCharTimeout",
+"SetLCDRefreshRate",
+"SetLED",
+"SetLight",
+"SetLinkID",
+"SetLowerLimit",
+"SetMaxPower",
+"SetMessage",
+"SetMessageByteParam",
+"SetMessageVariableParam",
+"SetMessageWordParam",
+"SetMotorBrakePower",
+"SetMotorPower128",
+"SetMotorPower8",
+"SetMotorPowerSigned",
+"SetMotorTransitionDelay",
+"SetNoPowerDownOnAC",
+"SetOpcodesPerTimeslice",
+"SetOutput",
+"SetPingData",
+"SetPingInterval",
+"SetPlaySounds",
+"SetPower",
+"SetPriority",
+"SetRCMessage",
+"SetRCRxChannel",
+"SetRCTxChannel",
+"SetRCTxMode",
+"SetRandomSeed",
+"SetRxMessageLock",
+"SetScoutMode",
+"SetScoutRules",
+"SetSensor",
+"SetSensorClickTime",
+"SetSensorHysteresis",
+"SetSensorLowerLimit",
+"SetSensorMode",
+"SetSensorRefreshRate",
+"SetSensorStartupDelay",
+"SetSensorType",
+"SetSensorUpperLimit",
+"SetSerialBaud",
+"SetSerialBiPhase",
+"SetSerialChannel",
+"SetSerialChecksum",
+"SetSerialComm",
+"SetSerialData",
+"SetSerialPacket",
+"SetSerialPreambleLen",
+"SetSerialPreamblePos",
+"SetSerialType",
+"SetSleepTime",
+"SetSpybotCtrlMessage",
+"SetSpybotCtrlPingMessage",
+"SetSpybotMessage",
+"SetSpybotPing",
+"SetStack",
+"SetSystem",
+"SetSystemPreambleSize",
+"SetTargetID",
+"SetTargetNote",
+"SetTaskAcquirePriority",
+"SetTaskSchedulingPriority",
+"SetTimer",
+"SetTimerLimit",
+"SetTimerState",
+"SetTxPower",
+"SetUpperLimit",
+"SetUserDisplay",
+"SetVolume",
+"SetWatch",
+"SetWatchFormat",
+"SetWorldNote",
+"Sleep",
+"SleepNow",
+"SlowDownMove",
+"SoundActive",
+"SpeedUpMove",
+"Stack",
+"StackAddress",
+"StackSize",
+"StartTask",
+"StopAllTasks",
+"StopTask",
+"Sum2Mem",
+"Sum4Mem",
+"System",
+"SystemPreambleSize",
+"T1",
+"T2",
+"T3",
+"T4",
+"TARGET_NONE",
+"TIMER_RUNNING",
+"TIMER_STOPPED",
+"TX_POWER_HI",
+"TX_POWER_LO",
+"TachoCount",
+"TachoSpeed",
+"Target",
+"TaskAcquirePriority",
+"TaskSchedulingPriority",
+"Timer",
+"TimerLimit",
+"TimerState",
+"Toggle",
+"Tone",
+"TransmitterRange",
+"UART_BOT",
+"UART_CTRL",
+"UART_PING",
+"UART_RC",
+"UnmuteSound",
+"UnsolicitedMessages",
+"UploadDatalog",
+"UpperLimit",
+"VLL",
+"Vibrato",
+"Volume",
+"Wait",
+"WaitEffect",
+"WaitMS",
+"Watch",
+"WatchFormat",
+"World",
+"WorldAspect",
+"WorldDirection",
+"WorldLinkID",
+"WorldNote",
+"WorldRange",
+"WorldShortID",
+"_GFloat",
+"_GFwd",
+"_GOff",
+"_GOn",
+"_GOnFor",
+"_GOnFwd",
+"_GOnRev",
+"_GRev",
+"_GSetDirection",
+"_GSetOutput",
+"_GSetPower",
+"_GToggle",
+"_LSBlink",
+"_LSCal",
+"_LSHyst",
+"_LSLower",
+"_LSUpper",
+"_RTS",
+"_Rules",
+"_SENSOR_CFG",
+"_Scout",
+"_SetFeedback",
+"_Sound",
+"_VLL",
+"_WaitEvents",
+"__ASM_NO_LOCAL",
+"__ASM_NO_TYPE",
+"__ASM_SMALL_VALUE",
+"__ASM_SRC_BASIC",
+"__ASM_SRC_EXT",
+"__CM",
+"__RCX",
+"__SCOUT",
+"__SCOUT_COMPAT",
+"__SPY",
+"__SPY_CTRL_CMD",
+"__SWAN",
+"__SetEvent",
+"__event_src",
+"__nolist",
+"__res",
+"__sensor",
+"__type",
+"_init",
+"asm",
+"b",
+"c",
+"const",
+"count",
+"crit",
+"d",
+"defined",
+"display",
+"do",
+"dst",
+"dur",
+"e",
+"else",
+"evt",
+"f",
+"false",
+"first",
+"fx",
+"group",
+"h",
+"hi",
+"hyst",
+"i",
+"if",
+"int",
+"l",
+"local",
+"low",
+"m",
+"m0",
+"m1",
+"mask",
+"mode",
+"move",
+"n",
+"n0",
+"n1",
+"n2",
+"nAddress",
+"nChannel",
+"nCmd",
+"nCmdFlags",
+"nData",
+"nDisplay",
+"nHiByte",
+"nID",
+"nIndex",
+"nInfo",
+"nLeft",
+"nLinkID",
+"nLoByte",
+"nMem",
+"nMessage",
+"nMode",
+"nMovement",
+"nMsg",
+"nMyID",
+"nRepeat",
+"nRight",
+"nSound",
+"nTime",
+"nValue",
+"noinit",
+"note",
+"o",
+"operand",
+"p",
+"prec",
+"relsrc",
+"result",
+"s",
+"sensor",
+"size",
+"src",
+"t",
+"thresh",
+"time",
+"tm",
+"type",
+"until",
+"v",
+"void",
+"wait",
+"while",
+"x",
+0};
+
+static const unsigned long api_symbols_hashes[]={
+0xba4fe559UL,0x2deb00dcUL,0x30eb0595UL,0x2feb0402UL,0xad49d35bUL,0x20c7f63bUL,0x21c7f7ceUL,0x22c7f961UL,
+0x23c7faf4UL,0x6c7bf9d6UL,0xa8a596bdUL,0x6822cccbUL,0x47d86764UL,0xe29e7ec7UL,0x5bfa65faUL,0xf8e323e7UL,
+0x9989dca3UL,0x800d0120UL,0xf154d696UL,0xedb7ab39UL,0xed8b6d3fUL,0x2cb6e3d0UL,0xa37edb3dUL,0x84af2ae3UL,
+0xc3f9990cUL,0x0a77a91fUL,0xe315847aUL,0xf6e30f79UL,0x96e1ba45UL,0xe3b67573UL,0x79ed938bUL,0x4fd9c9b5UL,
+0xc8f2f88cUL,0xf570f16cUL,0x9fb455b2UL,0x3a1f479dUL,0xb59070e0UL,0xcc9634c7UL,0x9a56cf51UL,0x303d9204UL,
+0x84b111d8UL,0x0352e6e3UL,0x6f230b83UL,0x8939a6a2UL,0xedd66d2aUL,0x5aa72c64UL,0x8b21b35eUL,0x724a75e0UL,
+0xd1d7108fUL,0x4fb76c08UL,0xc4fadc5eUL,0x240e9dc2UL,0xcc64eeb6UL,0x50dfdea9UL,0x0c0f2c08UL,0x8c6b2948UL,
+0x89639d2bUL,0x38db4ad7UL,0x5292cc4cUL,0x15bc13c1UL,0x156f3265UL,0xe7ebc212UL,0x68fa09aaUL,0x70a387ddUL,
+0x3eed7973UL,0x1cea2d3aUL,0x5397a56aUL,0xe1a7e2aeUL,0x41f4440dUL,0x1e98433cUL,0x0eeb9475UL,0x122f64bbUL,
+0x2d665a0dUL,0x16e7700cUL,0x24ab6edcUL,0x4f6cd6feUL,0xdcf2a37eUL,0x75ea98e5UL,0xa0c29f0bUL,0xe4c65529UL,
+0xe1c65070UL,0xe2c65203UL,0xe7c659e2UL,0xe8c65b75UL,0x3f4e1c3eUL,0xd39c58e4UL,0x341dd0c9UL,0x5a9c1299UL,
+0xd98c1cc0UL,0x7228fbc2UL,0x42b6781eUL,0x9808c309UL,0x6a321444UL,0xc757aaa9UL,0xece231c9UL,0x8d185e63UL,
+0x44acdc5eUL,0x73380321UL,0xed7fdb5eUL,0x8b31360cUL,0x0902b6cdUL,0x5483e103UL,0xec747dcdUL,0xfc0f33c3UL,
+0xe9f069feUL,0xd82cb879UL,0x8569623fUL,0x51bce817UL,0x15f3bc1aUL,0x7e5f7f62UL,0x989b6786UL,0x262a36a6UL,
+0xe056ce1bUL,0x76ce765bUL,0x258f391fUL,0x9d6df5b7UL,0xa8feee12UL,0xa7feec7fUL,0xa6feeaecUL,0x7f87376cUL,
+0x82873c25UL,0x81873a92UL,0x07a86251UL,0x6100b79dUL,0x49ecc551UL,0x737a90cbUL,0x52f8d900UL,0xd53d0359UL,
+0x1cc9e57eUL,0x1f5ac22aUL,0xad6d2525UL,0x9bde70a2UL,0x66b083daUL,0x3edc8fafUL,0xf136e1beUL,0xb9ba5215UL,
+0x5a05d9b5UL,0xf1aafc17UL,0x88e6ffc1UL,0x09bf4813UL,0x2f64f94bUL,0x2f62de51UL,0x53df02f5UL,0x77f0d828UL,
+0x64d0f58bUL,0xd9e467b9UL,0x941be231UL,0x9f46d346UL,0x2194c5eeUL,0x2e3dff71UL,0x15373453UL,0xe3ce291aUL,
+0x3aed66d4UL,0xf6347f59UL,0x3f15accdUL,0xa0cb1acdUL,0xb445d0d8UL,0xaefb8f38UL,0x4e42c924UL,0xbc27c097UL,
+0x57a6f625UL,0x0609df9dUL,0x26e14538UL,0x29e149f1UL,0x28e1485eUL,0xfbda3428UL,0x3e6fdec0UL,0x4ba9c68eUL,
+0x4aa9c4fbUL,0x49a9c368UL,0x70837fa9UL,0x7cf8aec9UL,0x79f8aa10UL,0x7af8aba3UL,0x7ff8b382UL,0xde515213UL,
+0xdd515080UL,0xe0515539UL,0xdf5153a6UL,0xe251585fUL,0x498b29a5UL,0xa0ef814aUL,0x34a328efUL,0xf06bc628UL,
+0x77af7c65UL,0x8b2c865aUL,0x6540a9b2UL,0xabec246aUL,0xd41950b7UL,0xfde1f643UL,0x5bb0e5b4UL,0x15eb2fa3UL,
+0x14eb2e10UL,0x4196795bUL,0x8193e584UL,0xcb4f44d1UL,0x5093bbbdUL,0x06e4631eUL,0xc9202df8UL,0xec1e0157UL,
+0x99ac440eUL,0x9aac45a1UL,0x97ac40e8UL,0x8da39553UL,0x8ca393c0UL,0x8fa39879UL,0x7378ac9fUL,0x0ec797f0UL,
+0x22dbc16cUL,0x58c6cdc0UL,0x30c35e38UL,0x85eba5fbUL,0x0d9b02adUL,0x22fd1667UL,0x383fbe11UL,0x100bd314UL,
+0x4788c1ebUL,0x0b3c0238UL,0x498658e2UL,0xe1acee55UL,0x08bcb3eeUL,0x0949615eUL,0x29d10d10UL,0x58d38cc7UL,
+0x8ca78354UL,0xb8ef22cfUL,0x8b3d13b3UL,0xb8638c2bUL,0xfc3c9cf5UL,0x9dd590e7UL,0xd02b533fUL,0xe65d658fUL,
+0x895b8384UL,0x2f284373UL,0x10d2a2b0UL,0x7bf2d067UL,0x1690cadaUL,0xc457a113UL,0x119ea192UL,0x37e14ad7UL,
+0x433e3005UL,0xd381b4e6UL,0x5e2fbabbUL,0x1e575104UL,0x383624a6UL,0xe5aa5be0UL,0xb23dc4d5UL,0x543bb6fdUL,
+0x4c816225UL,0xa10004bbUL,0x156a9ceaUL,0x2c17cc23UL,0xa0f5d8bfUL,0x968d3732UL,0xf71ae90fUL,0xc60abb25UL,
+0xe20d4091UL,0xfb145eaaUL,0x0222deecUL,0xe99f0b7dUL,0x6681c612UL,0x23f226b0UL,0x16f5c292UL,0xd4931751UL,
+0x6d99cefbUL,0xeb1c21caUL,0x81045b53UL,0xd7186a6dUL,0xfcd25cb8UL,0xffd26171UL,0xfed25fdeUL,0x01d26497UL,
+0x00d26304UL,0x03d267bdUL,0x296ecd53UL,0x8d19cfccUL,0xca2027f7UL,0x4f8c292fUL,0x6991f343UL,0x72ce1f46UL,
+0x71ce1db3UL,0x70ce1c20UL,0x148ff5b2UL,0xf5c5da5fUL,0x64ef9f3eUL,0x2fcdb5cdUL,0xa9e5c51dUL,0x2ecdb43aUL,
+0x63afaafcUL,0x11cd8693UL,0x3e250003UL,0x2848df6eUL,0x0ae65be8UL,0x71dbc060UL,0xb0193c89UL,0xb155025cUL,
+0xaf4c04daUL,0x70eb5a27UL,0x4c775f43UL,0x8bbee389UL,0x8a3c0c07UL,0xaf6e6880UL,0x3ce2c628UL,0x9f93e11bUL,
+0xad9f5d7fUL,0x7f7c3564UL,0xe07ebaebUL,0x62f13823UL,0x05e53eccUL,0x8fbf7d6aUL,0xe8a33a68UL,0xeefbc3c5UL,
+0xc34566aaUL,0xfd6968faUL,0xde9a14b6UL,0x9d235a16UL,0x035f462aUL,0xc5875e75UL,0xc28759bcUL,0xc3875b4fUL,
+0xe83b96d9UL,0x8c6c337dUL,0x984e33fdUL,0x682a77dcUL,0xe2a634a0UL,0x0bf0efddUL,0x2ff995bcUL,0x0f7f77e1UL,
+0x735633d8UL,0xfbe5c9e6UL,0xf3c5d819UL,0x7a0f4640UL,0x2542fb0eUL,0xe1161719UL,0xa4e58d40UL,0x4faec80eUL,
+0xb8204155UL,0xb5203c9cUL,0xb6203e2fUL,0x0b96686bUL,0x0fdc0e15UL,0xf3c60e59UL,0x8ea35d4cUL,0xe33b4769UL,
+0x0c893574UL,0xb93c5428UL,0x1616cc06UL,0x1b025581UL,0xa323b730UL,0x180a21b1UL,0x828fdeb5UL,0x5454b56eUL,
+0x75689487UL,0xac586527UL,0xbce4bd48UL,0xb1d0c13eUL,0x26927ab3UL,0x73d38512UL,0x3285338fUL,0x06838ca0UL,
+0x4cc0bba2UL,0x817b55d1UL,0xef31bb72UL,0x91c1e702UL,0x3d9a4185UL,0x89dfcba3UL,0x65d0a17eUL,0xaf377ac7UL,
+0x74f92a53UL,0xabe83f75UL,0x555b8abdUL,0x7a8e0902UL,0x26313f30UL,0xe3ac885fUL,0x0ee7230dUL,0xcd61d32eUL,
+0xcebdfaf6UL,0x5fd8e368UL,0xe4100305UL,0x4bf77f81UL,0xc6ec1d02UL,0x90f66900UL,0xf25eeb55UL,0x29a26128UL,
+0xb08e2714UL,0x94cee5caUL,0xe4d7860fUL,0x3e1b6c20UL,0x3eb65c51UL,0xe60c7f67UL,0x797cff47UL,0xa232285eUL,
+0xa340ae13UL,0xbcb839faUL,0x4aa55fc9UL,0xe48642e6UL,0x3d086e36UL,0xb0b5e686UL,0xfdbc9486UL,0x075189b4UL,
+0x87b17a8eUL,0x48ddd803UL,0x25397c2dUL,0x4f937748UL,0xc159a414UL,0x74c1c6bdUL,0x909fb4b9UL,0x98a9b082UL,
+0xf3de0d4eUL,0x9b76c275UL,0x905218b8UL,0xce808b77UL,0x2b3801f3UL,0x6bbba612UL,0x6abba47fUL,0xcc8faff4UL,
+0xcf8fb4adUL,0xce8fb31aUL,0xc98fab3bUL,0xc88fa9a8UL,0xcb8fae61UL,0xca8facceUL,0xc58fa4efUL,0x69bba2ecUL,
+0x68bba159UL,0x67bb9fc6UL,0x66bb9e33UL,0x5ed21a15UL,0x5bd2155cUL,0x5cd216efUL,0x59d21236UL,0x5ad213c9UL,
+0x57d20f10UL,0x58d210a3UL,0x65d2251aUL,0x6ff1de1eUL,0x6ef1dc8bUL,0x6df1daf8UL,0x74f1e5fdUL,0x73f1e46aUL,
+0x72f1e2d7UL,0x71f1e144UL,0x68f1d319UL,0x2f9fc7feUL,0x2e9fc66bUL,0x2d9fc4d8UL,0x349fcfddUL,0x339fce4aUL,
+0x329fccb7UL,0x319fcb24UL,0x289fbcf9UL,0x8414edf8UL,0xae0ed984UL,0x2cc00645UL,0x7f375fa8UL,0xf0baf2deUL,
+0xc525d69cUL,0x3b7c8c61UL,0x02dc9aefUL,0x9ae4b2b4UL,0x323ab72bUL,0xbe0c317bUL,0xad73aaaeUL,0x5c1f4fb3UL,
+0xf64ad863UL,0xd7d23a60UL,0xf54ad6d0UL,0x5d1f5146UL,0x9d4c8adfUL,0x5e1f52d9UL,0x5f1f546cUL,0x601f55ffUL,
+0x611f5792UL,0x5962b95bUL,0xdd0cca9aUL,0xc0c48a25UL,0xef394041UL,0x25d99fa9UL,0x671f6104UL,0x59d2f932UL,
+0xd170e025UL,0x026d7d89UL,0x6d1f6a76UL,0xf6e49acdUL,0xa1013cccUL,0x731f73e8UL,0xd539fa52UL,0x0dc6b4aaUL,
+0x60e47df0UL,0x5d64baffUL,0x5b783f91UL,0xe73b4a7dUL,0xdf01ee91UL,0xda45508eUL,0x8d5e7850UL,0x1a66f6dbUL,
+0xce9d3987UL,0x57ad530dUL,0xb5165c0eUL,0x5ab7e242UL,0x28bcb759UL,0x70fcf6ecUL,0xfca40804UL,0xadfea183UL,
+0x2ba6c2e2UL,0x48844a43UL,0x11caa07fUL,0xb6386070UL,0xb2b6ef81UL,0xc4253b6bUL,0xf0c9fffdUL,0xd1da6dfaUL,
+0x2b2eb90eUL,0x51eef5a1UL,0xfac6c667UL,0x06c291dfUL,0xaf9d9613UL,0xc02e9359UL,0x68ca9cebUL,0x0be14f59UL,
+0x71770455UL,0x962ff54eUL,0x952ff3bbUL,0x942ff228UL,0x09b360daUL,0x6998239bUL,0x6a5d5fd4UL,0x552b8c8bUL,
+0x7ca897bbUL,0xfade3b9fUL,0xcecc8f17UL,0xbdd0f182UL,0xbfe23dc9UL,0x7ae7e158UL,0x4115d182UL,0x41015fbfUL,
+0x964cb628UL,0x2cb00037UL,0x573266edUL,0x957f0272UL,0x88d5f052UL,0xbb517988UL,0xb2796f56UL,0x43b64611UL,
+0x4700eeabUL,0xfc0af9daUL,0xe68bc6e1UL,0x080206e9UL,0x05020230UL,0x060203c3UL,0x146ad54fUL,0xe266811dUL,
+0x7dd0b2e7UL,0x7ed0b47aUL,0x7fd0b60dUL,0xb24b7d38UL,0xad6a4c31UL,0xb6c51e62UL,0x40d052e0UL,0x8c7f7f70UL,
+0x41d05473UL,0x942ab6f0UL,0x44d700fcUL,0x179ad5c5UL,0x5abb8d1eUL,0x087eca21UL,0x7ff123a1UL,0x12447916UL,
+0x19be8856UL,0x9199facdUL,0x5ed0821aUL,0x6ad8f9eaUL,0x424bcaf3UL,0xbaf0bc0aUL,0x7703a46bUL,0x6a325c57UL,
+0xa49eadc3UL,0xf3c0ffa1UL,0xbb338ce4UL,0xd71a86f2UL,0x291ff379UL,0xc63ae0abUL,0x70ecfa94UL,0xd5982486UL,
+0x356fc5d8UL,0x4ada1cf6UL,0x57bc1a95UL,0xdfa372c5UL,0x168c700bUL,0x9bcda96dUL,0x1c78291cUL,0xcc6c23a9UL,
+0x0c283a8cUL,0xc78d5dabUL,0x2e7a4dd9UL,0x723f7794UL,0xcf8cd740UL,0x4fdd023aUL,0x99dfc194UL,0x073e1424UL,
+0xc0370b9cUL,0x97fa3fdcUL,0x46d84f98UL,0xb834eafbUL,0x75f90473UL,0xe5505b4cUL,0x117f607cUL,0x3b14dd94UL,
+0xe793290aUL,0x7ec5c7dbUL,0xfcf02902UL,0x0759d344UL,0xae675514UL,0x946aedacUL,0x3299dc14UL,0x86442820UL,
+0xf69ecda0UL,0x5f8f220eUL,0xdfeed4e3UL,0x45a5c811UL,0x3d40580eUL,0xc729515eUL,0x0473ab5bUL,0xa2bab564UL,
+0x3538d8b3UL,0xadb19d43UL,0x3367b53cUL,0x2f41d57dUL,0xb3449b1dUL,0xeeeeb7bfUL,0x317e5ac9UL,0x7cffe9beUL,
+0xeeb9dc6dUL,0x0ea06301UL,0xd147eef4UL,0xd33d5078UL,0xad2224e0UL,0x9c3a647bUL,0x1bca910cUL,0xdf66b0c3UL,
+0x93a8a138UL,0xae0bea05UL,0xa3d4108eUL,0xd140046dUL,0x242bca11UL,0x7f456181UL,0x052d5502UL,0x5309127cUL,
+0xb5590981UL,0x71aef625UL,0x14fc7ca7UL,0xa239aab5UL,0x24548405UL,0xceca5c87UL,0x7300bf6eUL,0x36621ab2UL,
+0x39856746UL,0xd2df27e2UL,0xee97472fUL,0x1da32208UL,0xc0927a36UL,0x00129a10UL,0xc3d8784eUL,0x29280578UL,
+0x5b383aedUL,0x5dbc4e4dUL,0xaf255beeUL,0x882c15b7UL,0x1e1fa483UL,0x0a0cf3a7UL,0x86de25b6UL,0x5b93a897UL,
+0x489b8d39UL,0x68a0dc2bUL,0x206afee7UL,0x8367707eUL,0xe74393c6UL,0xd59ce2b5UL,0xb3a50099UL,0x6bc8e41cUL,
+0xbf2b7c40UL,0xcca5edd4UL,0x8798e7d5UL,0x0f60f772UL,0x766936dcUL,0xd2ccbce7UL,0xacfe7667UL,0x84c5e5baUL,
+0x8ccff9a9UL,0x9194fb9bUL,0xb1d75e1aUL,0x1adc08e7UL,0xba46ac74UL,0x93a37de1UL,0x3da160bdUL,0x899feea7UL,
+0x11c4ccf3UL,0x5303a3b0UL,0x1fb0837dUL,0x377cbf41UL,0x67b73d5eUL,0x6bce8b3cUL,0x6ece8ff5UL,0x6dce8e62UL,
+0x68ce8683UL,0x67ce84f0UL,0xd60a6cadUL,0xd30a67f4UL,0xd40a6987UL,0xd10a64ceUL,0xd20a6661UL,0xcf0a61a8UL,
+0xd00a633bUL,0xcd0a5e82UL,0x457b50bbUL,0x7ebdb6b6UL,0xef490cc3UL,0x36a1f042UL,0x2eb1c9d3UL,0xe624e5adUL,
+0x9e595adaUL,0xe950d068UL,0x7461f7a1UL,0x396f37d6UL,0xf178b25eUL,0x25bd9a91UL,0x781e4597UL,0x97342cf1UL,
+0x8ffc3d85UL,0xa598e7f6UL,0xf3a10b3bUL,0x0948c595UL,0xbabb72e3UL,0x5a746d00UL,0x28208b3dUL,0x6a702c6cUL,
+0x7fff8351UL,0xc2d81b61UL,0xf58f80aeUL,0x138af75cUL,0x6f5adcb7UL,0xc39b9900UL,0xbba37595UL,0xc98c7deeUL,
+0x14117f9eUL,0x7fea981eUL,0x7d802f5cUL,0x4b5f40e6UL,0xdda29a35UL,0x0599e681UL,0x283ba44aUL,0xba5ba7c2UL,
+0xf8cfc9aaUL,0x997870f5UL,0x34ba0511UL,0x2ab4fadcUL,0xb9733e43UL,0x619575f3UL,0x4f13b133UL,0x5475a7b7UL,
+0x21378a33UL,0xcef579beUL,0x9216c1d6UL,0x8165fa50UL,0x7e10e09bUL,0x27316575UL,0x5bb17678UL,0xec104fa0UL,
+0x48afbf1dUL,0x4160f2a3UL,0xe1a5fdadUL,0xbe399226UL,0x67ac82ceUL,0x1b2c2cfbUL,0xd66153cbUL,0x8b3463a5UL,
+0xfd41379bUL,0x3ce1a393UL,0xcbd711ecUL,0xb04d436aUL,0x1130b6c8UL,0xc6d12066UL,0x804abf53UL,0x435b988dUL,
+0xb6eef12cUL,0xdb0d9a65UL,0x22d4eafbUL,0xc9c9b09bUL,0x09124755UL,0x351f7ce4UL,0x78d9a29cUL,0x53bc1ce3UL,
+0x17b338c1UL,0x8fe2b55bUL,0x18947fa3UL,0x142fa898UL,0x1c159ac8UL,0xa08c264eUL,0xed2f3cf1UL,0xf24f7e6fUL,
+0xe48bdd70UL,0xcf7094deUL,0x69653cd5UL,0x3287fa69UL,0x1f1fb9d7UL,0x7fe298a5UL,0x3e08dec4UL,0x3ba0c7b1UL,
+0x90cc70b1UL,0x28b19ea3UL,0xa0bcd4dbUL,0x6b224033UL,0xf1c9bbd4UL,0x950f8a64UL,0x407df8fbUL,0x6c94b7d8UL,
+0x4dd86fa0UL,0x0b406835UL,0x78a74bacUL,0x4dc9c61fUL,0x9bf99af5UL,0x52b7797fUL,0x519d96f1UL,0x7677f401UL,
+0x13b1e0deUL,0x631b9c6dUL,0x5d5b8db9UL,0xd86e0eccUL,0x996ad111UL,0x6abfb0a5UL,0xe426abc9UL,0xac345095UL,
+0xc43cdb18UL,0x0230a31aUL,0xd929c23eUL,0xe9ac54a3UL,0x517684c4UL,0xfff7f66dUL,0x57915a4aUL,0x36daee13UL,
+0xee11233cUL,0xc2e8df2aUL,0xca9e4551UL,0x6808ab6fUL,0x9b70e3afUL,0xd66c803cUL,0x6aec808aUL,0x8ca94d2bUL,
+0x2601b801UL,0x12960d4aUL,0x579d7e8cUL,0xf4472ca6UL,0x2eb0dc1eUL,0x821cc47fUL,0x58df04c6UL,0xb9f07a49UL,
+0x98cab614UL,0xb23e84abUL,0xf7330d57UL,0x8fd4a17dUL,0x85e33e6fUL,0x223f72afUL,0xaada3f31UL,0xd72f8f8fUL,
+0x7b27a5ecUL,0xc53e286aUL,0xcbfd9afdUL,0x1d6062f6UL,0x1afabf92UL,0x61a673e1UL,0x1b38b94aUL,0xdb6fa67eUL,
+0xc19ddc45UL,0xacaee235UL,0xd105285aUL,0x7a8eaf7bUL,0x485e4869UL,0x799fbd36UL,0x31cfe584UL,0x503a7b43UL,
+0x332fdeafUL,0x6ff8b4d3UL,0x5da6e7eaUL,0xf4d986bbUL,0xa751fe1fUL,0xed49b17fUL,0x1d132fc8UL,0xfe2d4384UL,
+0xab1adf0fUL,0x6d5fb830UL,0x4e5aeef5UL,0x2790cb0aUL,0xb5232b4fUL,0x88a4b9dbUL,0x55e9f0e2UL,0x155bcf16UL,
+0xbd0ba608UL,0x4ee84fb8UL,0x54f7ac4bUL,0x9cd4b9ddUL,0xaa3cd688UL,0xdc525014UL,0x29771f4eUL,0xf26cec7dUL,
+0xdfff5b42UL,0x763d3741UL,0x898dfbc1UL,0x2fa62ca8UL,0xfdc0ff10UL,0x9323e4d1UL,0x3ea4ef36UL,0xaf1b415cUL,
+0x080cd59fUL,0xfae9bcfdUL,0xa2b0cd16UL,0x5eefef96UL,0x9d46f8f6UL,0x9a319accUL,0x8207457bUL,0xc8ca86f5UL,
+0x8f3184bcUL,0x10ff1239UL,0x87f60476UL,0x86f602e3UL,0x85f60150UL,0x8cf60c55UL,0x5e06cf0bUL,0x1cf2db16UL,
+0x39820784UL,0xc1267c4fUL,0xbf1bebcdUL,0xede5414dUL,0x97d2d8d1UL,0x8b67f168UL,0x4580d5c0UL,0x671d4a96UL,
+0xeb53a5c2UL,0xf0ec5601UL,0x1e7f79e7UL,0x6cf1ba25UL,0xdc9f2da1UL,0xba3fcb21UL,0x1417e22fUL,0x66aaaed7UL,
+0xf51c7576UL,0xae06c145UL,0xd485624aUL,0xa709e098UL,0x9f2d9396UL,0x461b95e2UL,0x1cf9c109UL,0xbf452812UL,
+0x74f576afUL,0x0bd501c0UL,0xb2231471UL,0xfb34522cUL,0xec266ec8UL,0x043adf4bUL,0xdd60ed33UL,0xa3caf69fUL,
+0x1241655cUL,0x333a799aUL,0x65619213UL,0xd0c1fe68UL,0x4a98484eUL,0x03f665bfUL,0x099b1dacUL,0x68516528UL,
+0xac86d2c6UL,0x7cc25b5dUL,0x76d5d9a3UL,0xf8bf8e57UL,0x474a71c4UL,0x901e6bfeUL,0x9326d590UL,0xb8ca74daUL,
+0x4137884fUL,0xa4cb272bUL,0x23b86a49UL,0xcee7f6a3UL,0xc28d8044UL,0x40b76309UL,0xe547e749UL,0x29d462f1UL,
+0x4ee84081UL,0xe8a4def0UL,0x5a9bf00dUL,0x91079e6dUL,0x2c11c460UL,0x88098ea6UL,0x99a720d0UL,0x0ca41da5UL,
+0x0387e4d4UL,0xdb62acbeUL,0x218802ebUL,0x32c64897UL,0x291113a8UL,0x34030483UL,0x4407b79eUL,0x7d0af41bUL,
+0x112fe4ceUL,0x054d13e6UL,0xc20ac8bbUL,0x66407518UL,0xd0704290UL,0x68d6c5b3UL,0x9d8de39dUL,0x7fc1305bUL,
+0xbf3930f4UL,0x1472c0a0UL,0xe70c2de5UL,0xe60c2c52UL,0x664fd1d4UL,0x39b1ddf4UL,0x9654058dUL,0xe10c2473UL,
+0x0f1eb402UL,0x4569f715UL,0x621cd814UL,0xd3237a9cUL,0xd130ef00UL,0xe00c22e0UL,0xbdbf5bf0UL,0x6aa1fd62UL,
+0xe30c2799UL,0x0b069958UL,0x4881d841UL,0x4d22c733UL,0x5fb91e8cUL,0xed0c3757UL,0x683af69aUL,0x81b453fdUL,
+0xec0c35c4UL,0x39386e06UL,0x95e97e5eUL,0xe90c310bUL,0x9c436708UL,0x4f516a81UL,0xe80c2f78UL,0x932e6e58UL,
+0x942e6febUL,0xe7774569UL,0xec6ee012UL,0x184b0014UL,0xeb0c3431UL,0x0535dd93UL,0x0435dc00UL,0x0735e0b9UL,
+0x36a1b46fUL,0xee23b118UL,0x00ca2d7fUL,0xbc3787f6UL,0x67a6d8a1UL,0xec1a40c9UL,0x74ea193cUL,0x35f256c4UL,
+0xa1a45087UL,0xaf1ec969UL,0x2bbdb03cUL,0x3527ef80UL,0xab0e2462UL,0x4df69aaaUL,0x83f01e68UL,0xe9ea17aeUL,
+0x8692cfe4UL,0x43dcf306UL,0xd541173aUL,0x775b589eUL,0xfee99609UL,0xc9021628UL,0xeae01628UL,0xd897109eUL,
+0xab05dd50UL,0x919a0c3dUL,0xea0c329eUL,0x15d49cdeUL,0xf50c43efUL,0xc42ee65fUL,0x92a58802UL,0x0a377624UL,
+0xf60c4582UL,0x83b6367bUL,0x23a0d95cUL,0xd33ce1c9UL,0xf10c3da3UL,0x99dfc797UL,0x5d3c9be4UL,0x44454b4aUL,
+0x5127f14dUL,0xbab5214fUL,0xf30c40c9UL,0x48b5725fUL,0x892e4ca0UL,0x0dc628ceUL,0xfd0c5087UL,0};
+
+static const unsigned short api_symbols_displacements[]={
+3,5,3,1,1,0,3,3,0,1,0,2,0,1,0,2,
+0,7,11,0,0,0,2,6,0,0,2,2,0,0,10,0,
+0,0,0,12,2,1,3,9,6,1,9,0,4,0,3,9,
+5,5,0,0,3,1,0,0,2,2,0,1,1,2,0,3,
+0,1,0,7,1,0,1,3,1,2,0,2,0,3,0,1,
+2,2,19,2,6,3,1,0,2,5,3,1,0,0,0,7,
+8,0,4,0,3,0,2,1,6,5,2,2,1,0,0,10,
+1,1,1,2,1,1,0,1,9,3,0,3,1,4,0,3,
+2,0,0,5,1,5,6,1,4,4,5,4,0,1,0,10,
+0,2,0,0,9,0,0,3,1,0,7,0,0,1,0,0,
+1,0,18,0,2,1,4,5,3,3,0,2,12,0,16,0,
+2,3,0,1,8,7,11,19,1,4,10,2,5,3,1,6,
+9,11,8,7,1,1,12,2,10,2,3,4,0,7,1,3,
+0,1,0,7,0,1,0,9,0,9,2,7,12,2,7,2,
+1,3,0,5,3,1,12,10,0,2,20,1,3,0,17,1,
+0,1,9,15,3,2,0,2,1,1,3,5,12,12,3,1,
+4,7,1,0,14,10,19,1,0,4,8,6,3,0,0,1,
+0,4,0};
+
+static const short api_symbols_table[]={
+656,551,902,104,-1,-1,-1,-1,786,322,-1,-1,-1,952,877,-1,
+937,306,975,700,149,612,-1,333,233,-1,-1,-1,-1,-1,-1,719,
+606,-1,131,901,-1,948,499,-1,643,-1,-1,390,470,500,196,358,
+-1,205,-1,-1,178,-1,-1,-1,1036,-1,-1,-1,-1,-1,12,211,
+-1,988,-1,658,174,51,-1,-1,-1,-1,940,269,-1,811,-1,675,
+378,396,-1,558,110,-1,509,-1,288,815,-1,218,-1,-1,-1,-1,
+501,972,-1,941,262,-1,-1,502,-1,-1,923,-1,42,186,-1,214,
+1019,-1,114,1003,-1,-1,797,872,698,598,-1,368,-1,-1,-1,-1,
+1007,-1,200,-1,424,-1,-1,-1,550,-1,1085,-1,649,260,-1,-1,
+459,23,463,-1,-1,-1,-1,-1,-1,321,457,-1,256,791,172,-1,
+654,1066,111,-1,213,1021,-1,-1,393,88,50,-1,-1,436,-1,-1,
+967,-1,876,-1,546,-1,34,22,1033,-1,421,-1,581,830,-1,-1,
+-1,-1,0,-1,715,813,486,1010,-1,605,-1,-1,-1,-1,-1,-1,
+928,-1,1089,-1,1008,1070,-1,905,523,836,176,609,-1,-1,-1,-1,
+582,-1,487,165,398,935,-1,304,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,275,879,-1,-1,257,1088,-1,385,-1,-1,-1,947,1,-1,
+-1,-1,32,-1,432,-1,729,99,41,-1,-1,579,-1,-1,-1,-1,
+810,96,451,-1,482,519,-1,230,515,465,-1,397,-1,-1,730,-1,
+348,375,-1,-1,-1,744,732,203,1044,466,951,-1,-1,-1,236,-1,
+-1,614,89,163,-1,-1,493,701,-1,480,-1,-1,135,-1,-1,263,
+123,672,881,-1,651,521,-1,-1,724,-1,419,-1,73,-1,310,681,
+437,540,-1,188,129,1086,-1,-1,1009,-1,913,974,1061,-1,-1,-1,
+97,-1,-1,758,133,733,-1,956,-1,-1,450,453,626,-1,647,143,
+-1,631,-1,100,-1,1076,282,477,206,547,-1,483,148,-1,687,669,
+-1,-1,469,-1,-1,440,231,112,295,-1,-1,155,1057,-1,199,1073,
+793,-1,37,751,-1,252,884,916,1067,190,943,-1,488,965,-1,-1,
+1035,-1,386,-1,912,247,-1,946,-1,986,71,-1,-1,-1,94,842,
+259,712,574,-1,1029,372,441,1054,-1,-1,59,8,762,653,835,77,
+-1,1050,489,-1,-1,-1,-1,-1,723,198,-1,406,525,957,45,1092,
+125,804,-1,510,-1,-1,887,423,-1,-1,258,-1,925,857,1094,863,
+-1,402,317,-1,-1,-1,987,-1,871,748,124,62,559,-1,-1,983,
+737,54,660,120,662,-1,-1,370,84,292,309,-1,-1,-1,426,354,
+854,-1,-1,-1,-1,-1,808,-1,496,-1,413,-1,-1,-1,-1,-1,
+318,934,291,911,405,48,-1,-1,6,697,-1,162,342,-1,692,286,
+237,665,708,769,-1,412,1004,542,428,1023,-1,-1,-1,36,-1,9,
+-1,-1,455,-1,-1,592,-1,-1,668,527,516,-1,-1,-1,476,-1,
+-1,319,1083,475,959,-1,-1,628,25,839,-1,593,942,107,511,285,
+567,-1,289,134,1026,-1,755,352,859,-1,752,-1,1087,-1,-1,-1,
+24,384,924,-1,-1,711,-1,-1,635,307,633,-1,777,14,270,624,
+678,-1,392,11,861,855,580,-1,802,481,-1,829,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,311,255,-1,915,920,151,537,534,-1,479,1039,
+-1,243,362,-1,-1,622,127,-1,83,949,-1,1043,-1,168,-1,-1,
+371,-1,820,-1,753,750,-1,-1,538,-1,968,-1,-1,-1,-1,-1,
+-1,-1,513,147,-1,-1,-1,899,999,945,-1,931,215,-1,-1,346,
+522,-1,627,954,-1,976,-1,981,340,-1,-1,683,-1,-1,717,-1,
+240,-1,775,31,460,417,27,-1,-1,990,858,-1,298,449,-1,146,
+158,561,177,-1,137,-1,910,578,422,-1,53,303,1040,139,239,217,
+826,-1,1042,539,351,-1,433,-1,-1,250,776,325,734,-1,-1,691,
+-1,-1,-1,790,785,-1,360,-1,-1,-1,933,-1,-1,-1,79,-1,
+819,-1,699,-1,-1,906,1048,575,767,60,895,554,-1,431,803,866,
+645,-1,867,167,-1,-1,962,709,-1,-1,531,5,-1,-1,-1,-1,
+823,271,-1,308,506,875,596,618,702,-1,-1,-1,-1,-1,-1,-1,
+-1,655,774,-1,-1,152,679,249,-1,305,415,552,281,192,-1,930,
+-1,-1,-1,-1,-1,-1,-1,-1,828,399,-1,-1,553,-1,-1,721,
+-1,-1,-1,-1,-1,328,1031,686,632,888,164,869,-1,-1,1032,-1,
+471,10,64,-1,-1,-1,-1,359,467,-1,684,-1,-1,-1,-1,44,
+-1,-1,-1,693,1060,382,520,-1,-1,117,-1,608,91,-1,630,985,
+-1,507,-1,-1,971,-1,341,-1,141,46,-1,569,122,514,562,-1,
+-1,640,571,-1,849,832,689,794,676,-1,-1,926,4,616,-1,-1,
+-1,927,-1,132,-1,-1,414,659,536,92,779,-1,736,978,-1,-1,
+-1,-1,-1,993,225,13,-1,1058,834,268,349,-1,-1,-1,738,264,
+-1,-1,446,-1,-1,-1,-1,787,544,-1,688,331,840,-1,-1,-1,
+-1,-1,254,374,-1,-1,113,-1,-1,-1,-1,-1,-1,-1,-1,847,
+-1,722,-1,1068,-1,-1,283,-1,587,565,-1,963,556,898,337,-1,
+586,-1,-1,-1,3,145,242,-1,153,1084,1022,-1,-1,-1,106,-1,
+726,664,-1,-1,882,150,856,115,848,-1,1080,-1,314,-1,-1,1081,
+-1,757,407,-1,128,-1,-1,-1,-1,279,-1,1077,-1,-1,102,452,
+754,409,-1,-1,-1,209,-1,-1,365,-1,880,-1,-1,29,788,-1,
+315,-1,65,-1,584,-1,140,-1,-1,-1,792,602,497,918,-1,248,
+-1,557,938,914,212,408,187,1053,-1,1091,992,-1,216,202,549,-1,
+442,-1,-1,-1,93,955,273,400,-1,961,344,-1,977,20,435,-1,
+136,-1,707,-1,921,478,195,-1,892,807,297,-1,-1,827,-1,-1,
+-1,197,773,-1,-1,-1,-1,458,623,-1,-1,357,780,979,-1,-1,
+-1,843,991,563,173,369,-1,-1,-1,-1,472,-1,223,844,-1,572,
+-1,-1,821,55,604,462,356,966,695,766,238,725,555,-1,1006,903,
+1082,-1,-1,896,-1,548,-1,-1,-1,-1,868,-1,908,1016,-1,-1,
+-1,-1,720,67,564,-1,-1,673,761,425,-1,-1,-1,-1,982,696,
+429,741,-1,-1,-1,427,-1,-1,1002,-1,-1,-1,789,833,485,576,
+919,-1,-1,-1,395,-1,-1,-1,-1,-1,642,-1,-1,677,-1,-1,
+1017,706,929,-1,-1,-1,-1,-1,-1,313,-1,1090,-1,-1,-1,454,
+-1,-1,1001,889,727,-1,-1,-1,816,-1,784,1056,157,989,410,63,
+226,30,666,897,-1,1000,-1,-1,1020,-1,456,287,461,388,756,327,
+-1,-1,-1,-1,296,594,-1,492,-1,376,-1,-1,-1,244,995,671,
+-1,703,-1,585,-1,-1,185,-1,194,610,339,1027,-1,1074,615,278,
+543,-1,61,-1,366,-1,-1,-1,-1,-1,332,-1,-1,-1,52,960,
+503,448,179,411,161,-1,994,-1,302,160,-1,180,416,7,969,-1,
+-1,864,101,950,-1,805,-1,234,1046,-1,232,326,-1,-1,-1,-1,
+144,-1,338,-1,909,634,-1,-1,862,-1,886,299,219,490,320,718,
+1024,16,894,-1,290,-1,380,87,629,-1,109,-1,850,-1,272,-1,
+-1,517,824,-1,-1,76,-1,590,878,771,-1,-1,-1,21,381,444,
+713,-1,-1,-1,121,293,-1,-1,-1,1049,-1,-1,-1,685,-1,-1,
+-1,-1,-1,-1,-1,573,-1,-1,-1,-1,-1,364,528,-1,-1,447,
+-1,277,394,1065,-1,-1,-1,1075,-1,-1,-1,891,-1,438,-1,-1,
+246,530,-1,300,-1,-1,997,-1,389,-1,468,-1,739,759,-1,204,
+-1,-1,-1,-1,-1,373,-1,796,-1,229,474,-1,-1,58,182,577,
+-1,2,746,38,445,-1,49,-1,970,26,-1,343,-1,-1,883,-1,
+-1,837,607,57,-1,-1,637,-1,980,1062,-1,-1,526,846,130,1078,
+294,-1,-1,-1,-1,-1,-1,-1,-1,-1,620,-1,-1,841,817,301,
+932,583,207,-1,-1,806,-1,-1,-1,-1,379,-1,-1,-1,860,40,
+1037,-1,907,533,265,-1,800,166,-1,-1,636,-1,-1,-1,-1,922,
+-1,690,682,-1,-1,589,-1,138,-1,47,1059,998,-1,-1,-1,-1,
+890,-1,-1,-1,171,-1,1051,56,-1,-1,1052,-1,-1,-1,-1,367,
+518,-1,-1,625,760,-1,355,-1,646,-1,-1,-1,439,-1,-1,1063,
+873,-1,80,705,853,831,588,-1,-1,638,175,885,783,-1,227,-1,
+280,15,-1,-1,-1,621,-1,-1,-1,1038,-1,156,1015,-1,75,-1,
+98,-1,189,765,170,-1,743,183,-1,184,535,-1,-1,66,274,747,
+78,105,-1,-1,495,85,-1,731,611,852,228,-1,-1,795,1014,391,
+742,-1,-1,383,996,108,494,86,201,-1,-1,-1,-1,936,-1,814,
+644,-1,-1,221,-1,72,-1,-1,-1,1055,-1,-1,-1,812,-1,-1,
+-1,-1,801,-1,-1,251,-1,-1,403,1093,851,159,508,181,-1,74,
+82,-1,-1,568,-1,838,-1,1025,-1,-1,900,-1,69,-1,-1,-1,
+-1,-1,680,-1,-1,330,-1,-1,-1,619,-1,18,505,-1,-1,601,
+617,464,663,-1,-1,116,276,-1,-1,154,81,-1,591,-1,118,336,
+-1,667,-1,-1,570,-1,749,-1,1064,-1,599,1079,-1,-1,-1,764,
+-1,335,600,781,169,-1,-1,641,70,-1,704,661,420,253,-1,-1,
+-1,19,603,-1,-1,126,595,-1,650,377,782,-1,-1,745,-1,-1,
+-1,-1,443,-1,324,670,-1,-1,541,-1,870,-1,347,-1,1045,491,
+710,-1,597,191,-1,1018,639,90,353,266,387,-1,316,-1,241,735,
+714,818,-1,-1,-1,430,17,323,-1,-1,1071,778,-1,904,-1,-1,
+68,-1,809,716,-1,-1,-1,-1,-1,964,763,798,845,874,566,363,
+-1,-1,-1,822,119,1034,245,1012,222,404,418,-1,973,1072,224,1041,
+984,1011,-1,-1,1030,-1,103,652,-1,-1,-1,-1,-1,142,33,267,
+825,345,-1,-1,-1,-1,865,-1,674,770,768,-1,-1,43,235,545,
+261,484,799,210,361,350,-1,-1,1069,95,-1,-1,1028,613,334,-1,
+-1,728,-1,-1,-1,939,740,-1,504,-1,-1,-1,657,498,529,329,
+958,-1,-1,-1,917,312,401,524,694,648,28,434,-1,-1,-1,-1,
+-1,772,1005,-1,-1,-1,-1,39,-1,220,-1,284,1013,473,-1,512,
+-1,944,-1,193,208,953,560,1047,893,532,-1,-1,-1,-1,-1,35,
+0};
+
+static inline int api_symbols_slot(unsigned long hash)
+{
+	unsigned long h = (hash ^ (api_symbols_displacements[hash % api_symbols_buckets] * 0x9e3779b1UL)) & 0xffffffffUL;
+	h = ((h ^ (h >> 16)) * 0x85ebca6bUL) & 0xffffffffUL;
+	h = ((h ^ (h >> 13)) * 0xc2b2ae35UL) & 0xffffffffUL;
+	return (int)((h ^ (h >> 16)) & (api_symbols_slots - 1));
+}
@@ -0,0 +1,2753 @@
+#line 2 "lexer.cpp"
+/* A lexical scanner generated by flex */
+
+/* Scanner skeleton version:
+ * $Header: c:\\winapps\\projects\\nqc/nqc/default/lexer.cpp,v 1.3 2007/06/06 18:21:29 jhansen Exp $
+ */
+
+#define FLEX_SCANNER
+#define YY_FLEX_MAJOR_VERSION 2
+#define YY_FLEX_MINOR_VERSION 5
+
+#include <stdio.h>
+
+#if defined(__MWERKS__) && !__MACH__ && !YY_NEVER_INTERACTIVE
+#include <unix.h>
+#endif
+
+
+/* cfront 1.2 defines "c_plusplus" instead of "__cplusplus" */
+#ifdef c_plusplus
+#ifndef __cplusplus
+#define __cplusplus
+#endif
+#endif
+
+
+#ifdef __cplusplus
+
+#include <stdlib.h>
+#include <unistd.h>
+
+/* Use prototypes in function declarations. */
+#define YY_USE_PROTOS
+
+/* The "const" storage-class-modifier is valid. */
+#define YY_USE_CONST
+
+#else	/* ! __cplusplus */
+
+#if __STDC__
+
+#define YY_USE_PROTOS
+#define YY_USE_CONST
+
+#endif	/* __STDC__ */
+#endif	/* ! __cplusplus */
+
+#ifdef __TURBOC__
+ #pragma warn -rch
+ #pragma warn -use
+#include <io.h>
+#include <stdlib.h>
+#define YY_USE_CONST
+#define YY_USE_PROTOS
+#endif
+
+#ifdef YY_USE_CONST
+#define yyconst const
+#else
+#define yyconst
+#endif
+
+
+#ifdef YY_USE_PROTOS
+#define YY_PROTO(proto) proto
+#else
+#define YY_PROTO(proto) ()
+#endif
+
+/* Returned upon end-of-file. */
+#define YY_NULL 0
+
+/* Promotes a possibly negative, possibly signed char to an unsigned
+ * integer for use as an array index.  If the signed char is negative,
+ * we want to instead treat it as an 8-bit unsigned char, hence the
+ * double cast.
+ */
+#define YY_SC_TO_UI(c) ((unsigned int) (unsigned char) c)
+
+/* Enter a start condition.  This macro really ought to take a parameter,
+ * but we do it the disgusting crufty way forced on us by the ()-less
+ * definition of BEGIN.
+ */
+#define BEGIN yy_start = 1 + 2 *
+
+/* Translate the current start state into a value that can be later handed
+ * to BEGIN to return to the state.  The YYSTATE alias is for lex
+ * compatibility.
+ */
+#define YY_START ((yy_start - 1) / 2)
+#define YYSTATE YY_START
+
+/* Action number for EOF rule of a given start state. */
+#define YY_STATE_EOF(state) (YY_END_OF_BUFFER + state + 1)
+
+/* Special action meaning "start processing a new file". */
+#define YY_NEW_FILE yyrestart( yyin )
+
+#define YY_END_OF_BUFFER_CHAR 0
+
+/* Size of default input buffer. */
+#define YY_BUF_SIZE 16384
+
+typedef struct yy_buffer_state *YY_BUFFER_STATE;
+
+extern int yyleng;
+extern FILE *yyin, *yyout;
+
+#define EOB_ACT_CONTINUE_SCAN 0
+#define EOB_ACT_END_OF_FILE 1
+#define EOB_ACT_LAST_MATCH 2
+
+/* The funky do-while in the following #define is used to turn the definition
+ * int a single C statement (which needs a semi-colon terminator).  This
+ * avoids problems with code like:
+ *
+ * 	if ( condition_holds )
+ *		yyless( 5 );
+ *	else
+ *		do_something_else();
+ *
+ * Prior to using the do-while the compiler would get upset at the
+ * "else" because it interpreted the "if" statement as being all
+ * done when it reached the ';' after the yyless() call.
+ */
+
+/* Return all but the first 'n' matched characters back to the input stream. */
+
+#define yyless(n) \
+	do \
+		{ \
+		/* Undo effects of setting up yytext. */ \
+		*yy_cp = yy_hold_char; \
+		YY_RESTORE_YY_MORE_OFFSET \
+		yy_c_buf_p = yy_cp = yy_bp + n - YY_MORE_ADJ; \
+		YY_DO_BEFORE_ACTION; /* set up yytext again */ \
+		} \
+	while ( 0 )
+
+#define unput(c) yyunput( c, yytext_ptr )
+
+/* The following is because we cannot portably get our hands on size_t
+ * (without autoconf's help, which isn't available because we want
+ * flex-generated scanners to compile on their own).
+ */
+typedef unsigned int yy_size_t;
+
+
+struct yy_buffer_state
+	{
+	FILE *yy_input_file;
+
+	char *yy_ch_buf;		/* input buffer */
+	char *yy_buf_pos;		/* current position in input buffer */
+
+	/* Size of input buffer in bytes, not including room for EOB
+	 * characters.
+	 */
+	yy_size_t yy_buf_size;
+
+	/* Number of characters read into yy_ch_buf, not including EOB
+	 * characters.
+	 */
+	int yy_n_chars;
+
+	/* Whether we "own" the buffer - i.e., we know we created it,
+	 * and can realloc() it to grow it, and should free() it to
+	 * delete it.
+	 */
+	int yy_is_our_buffer;
+
+	/* Whether this is an "interactive" input source; if so, and
+	 * if we're using stdio for input, then we want to use getc()
+	 * instead of fread(), to make sure we stop fetching input after
+	 * each newline.
+	 */
+	int yy_is_interactive;
+
+	/* Whether we're considered to be at the beginning of a line.
+	 * If so, '^' rules will be active on the next match, otherwise
+	 * not.
+	 */
+	int yy_at_bol;
+
+	/* Whether to try to fill the input buffer when we reach the
+	 * end of it.
+	 */
+	int yy_fill_buffer;
+
+	int yy_buffer_status;
+#define YY_BUFFER_NEW 0
+#define YY_BUFFER_NORMAL 1
+	/* When an EOF's been seen but there's still some text to process
+	 * then we mark the buffer as YY_EOF_PENDING, to indicate that we
+	 * shouldn't try reading from the input source any more.  We might
+	 * still have a bunch of tokens to match, though, because of
+	 * possible backing-up.
+	 *
+	 * When we actually see the EOF, we change the status to "new"
+	 * (via yyrestart()), so that the user can continue scanning by
+	 * just pointing yyin at a new input file.
+	 */
+#define YY_BUFFER_EOF_PENDING 2
+	};
+
+static YY_BUFFER_STATE yy_current_buffer = 0;
+
+/* We provide macros for accessing buffer states in case in the
+ * future we want to put the buffer states in a more general
+ * "scanner state".
+ */
+#define YY_CURRENT_BUFFER yy_current_buffer
+
+
+/* yy_hold_char holds the character lost when yytext is formed. */
+static char yy_hold_char;
+
+static int yy_n_chars;		/* number of characters read into yy_ch_buf */
+
+
+int yyleng;
+
+/* Points to current character in buffer. */
+static char *yy_c_buf_p = (char *) 0;
+static int yy_init = 1;		/* whether we need to initialize */
+static int yy_start = 0;	/* start state number */
+
+/* Flag which is used to allow yywrap()'s to do buffer switches
+ * instead of setting up a fresh yyin.  A bit of a hack ...
+ */
+static int yy_did_buffer_switch_on_eof;
+
+void yyrestart YY_PROTO(( FILE *input_file ));
+
+void yy_switch_to_buffer YY_PROTO(( YY_BUFFER_STATE new_buffer ));
+void yy_load_buffer_state YY_PROTO(( void ));
+YY_BUFFER_STATE yy_create_buffer YY_PROTO(( FILE *file, int size ));
+void yy_delete_buffer YY_PROTO(( YY_BUFFER_STATE b ));
+void yy_init_buffer YY_PROTO(( YY_BUFFER_STATE b, FILE *file ));
+void yy_flush_buffer YY_PROTO(( YY_BUFFER_STATE b ));
+#define YY_FLUSH_BUFFER yy_flush_buffer( yy_current_buffer )
+
+YY_BUFFER_STATE yy_scan_buffer YY_PROTO(( char *base, yy_size_t size ));
+YY_BUFFER_STATE yy_scan_string YY_PROTO(( yyconst char *yy_str ));
+YY_BUFFER_STATE yy_scan_bytes YY_PROTO(( yyconst char *bytes, int len ));
+
+static void *yy_flex_alloc YY_PROTO(( yy_size_t ));
+static void *yy_flex_realloc YY_PROTO(( void *, yy_size_t ));
+static void yy_flex_free YY_PROTO(( void * ));
+
+#define yy_new_buffer yy_create_buffer
+
+#define yy_set_interactive(is_interactive) \
+	{ \
+	if ( ! yy_current_buffer ) \
+		yy_current_buffer = yy_create_buffer( yyin, YY_BUF_SIZE ); \
+	yy_current_buffer->yy_is_interactive = is_interactive; \
+	}
+
+#define yy_set_bol(at_bol) \
+	{ \
+	if ( ! yy_current_buffer ) \
+		yy_current_buffer = yy_create_buffer( yyin, YY_BUF_SIZE ); \
+	yy_current_buffer->yy_at_bol = at_bol; \
+	}
+
+#define YY_AT_BOL() (yy_current_buffer->yy_at_bol)
+
+typedef unsigned char YY_CHAR;
+FILE *yyin = (FILE *) 0, *yyout = (FILE *) 0;
+typedef int yy_state_type;
+extern char *yytext;
+#define yytext_ptr yytext
+
+static yy_state_type yy_get_previous_state YY_PROTO(( void ));
+static yy_state_type yy_try_NUL_trans YY_PROTO(( yy_state_type current_state ));
+static int yy_get_next_buffer YY_PROTO(( void ));
+static void yy_fatal_error YY_PROTO(( yyconst char msg[] ));
+
+/* Done after the current pattern has been matched and before the
+ * corresponding action - sets up yytext.
+ */
+#define YY_DO_BEFORE_ACTION \
+	yytext_ptr = yy_bp; \
+	yyleng = (int) (yy_cp - yy_bp); \
+	yy_hold_char = *yy_cp; \
+	*yy_cp = '\0'; \
+	yy_c_buf_p = yy_cp;
+
+#define YY_NUM_RULES 89
+#define YY_END_OF_BUFFER 90
+static yyconst short int yy_accept[278] =
+    {   0,
+        0,    0,   85,   85,    0,    0,   90,   83,   82,    3,
+        3,    2,   83,   83,    6,   83,   83,   83,   83,   83,
+       83,   80,   80,   83,   83,   83,   83,   78,   83,   83,
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   83,   85,   87,   86,   20,
+       19,   19,   20,   20,   20,   20,   20,   20,   82,    6,
+       66,    0,   81,    6,    5,   63,   69,   57,   55,   71,
+        0,   53,   72,   54,   84,    1,   56,   80,    0,   75,
+       67,   65,   68,   76,   77,   78,    4,   64,   78,   78,
+       78,   78,   78,   78,   78,   78,   24,   78,   78,   78,
+
+       78,   21,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   58,   70,   85,   86,   86,   88,    0,
+        0,    0,    0,   11,    0,    0,    0,    0,   60,    1,
+       79,   62,   61,   78,   78,   78,   78,   78,   51,   78,
+       46,   78,   78,   78,   78,   78,   78,   78,   25,   78,
+       37,   78,   78,   78,   78,   78,   78,   48,   78,   78,
+       78,   78,   78,   59,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   78,   78,   78,   78,   78,
+       78,   78,   78,   31,   78,   78,   78,   78,   22,   78,
+       36,   78,   78,   78,   52,   78,   49,   78,   47,   73,
+
+       38,   78,    0,   13,   12,    0,    0,    0,    0,    0,
+        0,    0,    0,   78,   78,   45,   78,   78,   78,   78,
+       27,   35,   39,   78,   78,   74,   78,   78,   78,   50,
+       78,   23,    0,   14,   17,    9,    0,    0,    0,   15,
+        0,   78,   78,   78,   78,   41,   78,   78,   78,   78,
+       26,   29,   30,    8,   10,    0,   16,    0,   78,   78,
+       78,   78,   34,   78,   32,   33,    7,   18,   78,   44,
+       40,   43,   28,   78,   78,   42,    0
+    } ;
+
+static yyconst int yy_ec[256] =
+    {   0,
+        1,    1,    1,    1,    1,    1,    1,    1,    2,    3,
+        1,    1,    4,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    5,    1,    1,    1,    1,
+        1,    2,    6,    7,    8,    1,    9,   10,    1,    1,
+        1,   11,   12,    1,   13,    1,   14,   15,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,    1,    1,   17,
+       18,   19,    1,   20,   21,   21,   21,   21,   21,   21,
+       22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+       22,   22,   22,   22,   22,   22,   22,   23,   22,   22,
+        1,   24,    1,   25,   26,    1,   27,   28,   29,   30,
+
+       31,   32,   33,   34,   35,   22,   36,   37,   38,   39,
+       40,   41,   42,   43,   44,   45,   46,   47,   48,   23,
+       49,   22,    1,   50,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1
+    } ;
+
+static yyconst int yy_meta[51] =
+    {   0,
+        1,    1,    2,    2,    1,    1,    1,    1,    1,    1,
+        3,    1,    1,    1,    4,    4,    1,    1,    1,    1,
+        4,    5,    5,    1,    1,    5,    4,    4,    4,    4,
+        4,    4,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    1
+    } ;
+
+static yyconst short int yy_base[286] =
+    {   0,
+        0,    0,   48,   50,   59,  105,  330,  331,   56,  331,
+      331,  331,  311,  321,   58,  309,   47,  308,   55,   56,
+       61,   55,   40,   59,  307,   62,  304,    0,   79,  305,
+      296,   57,  278,   57,   56,  283,   64,  279,   56,  278,
+      286,   67,   71,  276,  281,   74,    0,  331,   92,  331,
+      331,  331,  283,   79,   78,  270,  273,  284,   91,  117,
+      331,  303,  331,  307,  331,  331,  331,  331,  331,  331,
+      290,  331,  331,  331,  331,    0,  331,  105,    0,  289,
+      331,  331,  331,  288,  331,    0,  331,  331,   98,  261,
+      262,  265,  271,   82,  262,  268,    0,  255,  261,  254,
+
+      251,    0,  250,  255,   87,  260,  104,  264,  256,  246,
+      243,  253,  252,  331,  268,    0,  119,  134,  331,  253,
+      103,  254,  240,  119,  253,  254,  250,  236,  331,    0,
+        0,  331,  331,  231,  237,  245,  244,  107,    0,  228,
+        0,  246,  241,  242,  110,  243,  238,  224,    0,  227,
+        0,  231,  234,  218,  224,  219,  220,    0,  215,  223,
+      227,  227,  219,  331,  220,  222,  222,  217,  211,  219,
+      219,  211,  214,  215,  206,  213,  206,  198,  202,  196,
+      198,  203,  201,    0,  202,  190,  199,  187,    0,  201,
+        0,  186,  203,  186,    0,  183,    0,  198,    0,    0,
+
+        0,  195,  186,  331,  331,  192,  180,  190,  190,  174,
+      181,  186,  182,  177,  180,    0,  170,  177,  181,  168,
+        0,    0,    0,  171,  172,    0,  168,  162,  167,    0,
+      171,    0,  173,  331,  331,  331,  171,  172,  174,  331,
+      161,  154,  154,  157,  161,    0,  164,  148,  148,  149,
+        0,    0,    0,  331,  331,  160,  331,  154,  156,  133,
+      134,  127,    0,  121,    0,    0,  331,  331,  106,    0,
+        0,    0,    0,   96,   94,    0,  331,  158,  163,  168,
+      170,  175,  180,  185,  107
+    } ;
+
+static yyconst short int yy_def[286] =
+    {   0,
+      277,    1,  278,  278,  279,  279,  277,  277,  277,  277,
+      277,  277,  277,  280,  277,  277,  277,  277,  277,  277,
+      277,  277,  277,  277,  277,  277,  277,  281,  277,  277,
+      281,  281,  281,  281,  281,  281,  281,  281,  281,  281,
+      281,  281,  281,  281,  281,  277,  282,  277,  283,  277,
+      277,  277,  277,  277,  277,  277,  277,  277,  277,  277,
+      277,  280,  277,  277,  277,  277,  277,  277,  277,  277,
+      277,  277,  277,  277,  277,  284,  277,  277,  285,  277,
+      277,  277,  277,  277,  277,  281,  277,  277,  281,  281,
+      281,  281,  281,  281,  281,  281,  281,  281,  281,  281,
+
+      281,  281,  281,  281,  281,  281,  281,  281,  281,  281,
+      281,  281,  281,  277,  277,  282,  283,  283,  277,  277,
+      277,  277,  277,  277,  277,  277,  277,  277,  277,  284,
+      285,  277,  277,  281,  281,  281,  281,  281,  281,  281,
+      281,  281,  281,  281,  281,  281,  281,  281,  281,  281,
+      281,  281,  281,  281,  281,  281,  281,  281,  281,  281,
+      281,  281,  281,  277,  277,  277,  277,  277,  277,  277,
+      277,  277,  277,  277,  277,  281,  281,  281,  281,  281,
+      281,  281,  281,  281,  281,  281,  281,  281,  281,  281,
+      281,  281,  281,  281,  281,  281,  281,  281,  281,  281,
+
+      281,  281,  277,  277,  277,  277,  277,  277,  277,  277,
+      277,  277,  277,  281,  281,  281,  281,  281,  281,  281,
+      281,  281,  281,  281,  281,  281,  281,  281,  281,  281,
+      281,  281,  277,  277,  277,  277,  277,  277,  277,  277,
+      277,  281,  281,  281,  281,  281,  281,  281,  281,  281,
+      281,  281,  281,  277,  277,  277,  277,  277,  281,  281,
+      281,  281,  281,  281,  281,  281,  277,  277,  281,  281,
+      281,  281,  281,  281,  281,  281,    0,  277,  277,  277,
+      277,  277,  277,  277,  277
+    } ;
+
+static yyconst short int yy_nxt[382] =
+    {   0,
+        8,    9,   10,   11,   12,   13,   14,   15,   16,   17,
+       18,   19,   20,   21,   22,   23,   24,   25,   26,   27,
+       28,   28,   28,   29,   30,   31,   32,   33,   34,   35,
+       36,   37,   38,   28,   39,   28,   28,   40,   28,   28,
+       28,   28,   41,   42,   43,   28,   44,   45,   28,   46,
+       48,   48,   48,   48,   78,   78,   67,   59,   49,   64,
+       49,   51,   52,   60,   68,   65,   70,   71,   73,   78,
+       78,   75,   72,   74,   76,   80,   81,   79,   77,   83,
+       84,   87,   87,   94,   90,   91,   96,  102,   53,   54,
+       99,  114,   59,   55,  103,   97,   95,  110,   60,   56,
+
+       92,  106,  118,  100,   57,  119,   58,   51,   52,  124,
+      131,  107,  108,  111,  109,  121,  125,  122,   64,   78,
+       78,  123,  276,  115,   65,  143,  144,  153,  134,  277,
+      156,  154,  277,  180,   53,   54,  135,  166,  275,   55,
+      136,  137,  138,  157,  118,   56,  167,  119,  170,  274,
+       57,  273,   58,  186,  187,  181,  272,  171,   47,   47,
+       47,   47,   47,   50,   50,   50,   50,   50,   62,   62,
+       62,   62,   62,   86,   86,  116,  271,  270,  116,  116,
+      117,  269,  117,  117,  117,  130,  268,  130,  130,  130,
+      267,  266,  265,  264,  263,  262,  261,  260,  259,  258,
+
+      257,  256,  255,  254,  253,  252,  251,  250,  249,  248,
+      247,  246,  245,  244,  243,  242,  241,  240,  239,  238,
+      237,  236,  235,  234,  233,  232,  231,  230,  229,  228,
+      227,  226,  225,  224,  223,  222,  221,  220,  219,  218,
+      217,  216,  215,  214,  213,  212,  211,  210,  209,  208,
+      207,  206,  205,  204,  203,  202,  201,  200,  199,  198,
+      197,  196,  195,  194,  193,  192,  191,  190,  189,  188,
+      185,  184,  183,  182,  179,  178,  177,  176,  175,  174,
+      173,  172,  169,  168,  165,  164,  163,  162,  161,  160,
+      159,  158,  155,  152,  151,  150,  149,  148,  147,  146,
+
+      145,  142,  141,  140,  139,  133,  132,  129,   64,   63,
+      128,  127,  126,  120,  113,  112,  105,  104,  101,   98,
+       93,   89,   88,   85,   82,   69,   66,   63,   61,  277,
+        7,  277,  277,  277,  277,  277,  277,  277,  277,  277,
+      277,  277,  277,  277,  277,  277,  277,  277,  277,  277,
+      277,  277,  277,  277,  277,  277,  277,  277,  277,  277,
+      277,  277,  277,  277,  277,  277,  277,  277,  277,  277,
+      277,  277,  277,  277,  277,  277,  277,  277,  277,  277,
+      277
+    } ;
+
+static yyconst short int yy_chk[382] =
+    {   0,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        3,    3,    4,    4,   23,   23,   17,    9,    3,   15,
+        4,    5,    5,    9,   17,   15,   19,   19,   20,   22,
+       22,   21,   19,   20,   21,   24,   24,   22,   21,   26,
+       26,   29,   29,   34,   32,   32,   35,   39,    5,    5,
+       37,   46,   59,    5,   39,   35,   34,   43,   59,    5,
+
+       32,   42,   49,   37,    5,   49,    5,    6,    6,   55,
+      285,   42,   42,   43,   42,   54,   55,   54,   60,   78,
+       78,   54,  275,   46,   60,   94,   94,  105,   89,  117,
+      107,  105,  117,  138,    6,    6,   89,  121,  274,    6,
+       89,   89,   89,  107,  118,    6,  121,  118,  124,  269,
+        6,  264,    6,  145,  145,  138,  262,  124,  278,  278,
+      278,  278,  278,  279,  279,  279,  279,  279,  280,  280,
+      280,  280,  280,  281,  281,  282,  261,  260,  282,  282,
+      283,  259,  283,  283,  283,  284,  258,  284,  284,  284,
+      256,  250,  249,  248,  247,  245,  244,  243,  242,  241,
+
+      239,  238,  237,  233,  231,  229,  228,  227,  225,  224,
+      220,  219,  218,  217,  215,  214,  213,  212,  211,  210,
+      209,  208,  207,  206,  203,  202,  198,  196,  194,  193,
+      192,  190,  188,  187,  186,  185,  183,  182,  181,  180,
+      179,  178,  177,  176,  175,  174,  173,  172,  171,  170,
+      169,  168,  167,  166,  165,  163,  162,  161,  160,  159,
+      157,  156,  155,  154,  153,  152,  150,  148,  147,  146,
+      144,  143,  142,  140,  137,  136,  135,  134,  128,  127,
+      126,  125,  123,  122,  120,  115,  113,  112,  111,  110,
+      109,  108,  106,  104,  103,  101,  100,   99,   98,   96,
+
+       95,   93,   92,   91,   90,   84,   80,   71,   64,   62,
+       58,   57,   56,   53,   45,   44,   41,   40,   38,   36,
+       33,   31,   30,   27,   25,   18,   16,   14,   13,    7,
+      277,  277,  277,  277,  277,  277,  277,  277,  277,  277,
+      277,  277,  277,  277,  277,  277,  277,  277,  277,  277,
+      277,  277,  277,  277,  277,  277,  277,  277,  277,  277,
+      277,  277,  277,  277,  277,  277,  277,  277,  277,  277,
+      277,  277,  277,  277,  277,  277,  277,  277,  277,  277,
+      277
+    } ;
+
+static yy_state_type yy_last_accepting_state;
+static char *yy_last_accepting_cpos;
+
+/* The intent behind this definition is that it'll catch
+ * any uses of REJECT which flex missed.
+ */
+#define REJECT reject_used_but_not_detected
+#define yymore() yymore_used_but_not_detected
+#define YY_MORE_ADJ 0
+#define YY_RESTORE_YY_MORE_OFFSET
+char *yytext;
+#line 1 "lex.l"
+#define INITIAL 0
+#line 2 "lex.l"
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+
+#include <string.h>
+#include <stdio.h>
+#include "Symbol.h"
+#include "RCX_Constants.h"
+#include "JumpStmt.h"
+#include "Buffer.h"
+#include "parser.h"
+#include "Compiler.h"
+#include "Error.h"
+#include "Bytecode.h"
+#include "PrecompiledHeader.h"
+#include <vector>
+
+// whitespace and comments are skipped 16 bytes at a time where there
+// are vector instructions for it
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LEX_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define LEX_NEON
+#include <arm_neon.h>
+#elif defined(__wasm_simd128__)
+#define LEX_WASM_SIMD
+#include <wasm_simd128.h>
+#endif
+
+#define kMaxFileDepth   16
+#define kMaxFileCount   255
+#define kLexBatchSize   256
+
+typedef struct InputFile {
+    struct InputFile *fNext;
+    int fSourceIndex;
+    YY_BUFFER_STATE fBufferState;
+    long fSavedOffset;
+    const char* fDataPtr;
+    int fDataRemain;
+    const PrecompiledHeader* fTokens;   // non-zero for token playback
+    int fTokenIndex;
+} InputFile;
+
+// a scanned token waiting for LexGetToken()
+typedef struct LexToken {
+    int fType;
+    YYSTYPE fValue;
+    LexLocation fLoc;
+    int fDepth;
+} LexToken;
+
+static int sFileDepth  = 0;
+static InputFile *sCurrentInputFile = 0;
+static int sSourceIndex = 0;
+static long sOffset = 0;
+static int sReturnWhitespace = 0;
+static int sInsideDirective = 0;
+static int sResumeTokens = 0;
+static LexLocation sTokenLoc;
+static int sTokenLocValid = 0;
+static int sTokenDepth = 0;
+static int sSkipInactive = 0;
+
+static std::vector<LexToken> sTokens;
+static size_t sTokenPos = 0;
+// the text of every STRING token in the compile, which the tokens
+// refer to by offset so that they can be copied around freely
+static std::vector<char> sStrings;
+
+static int FillBuffer(char *ptr, int max);
+static void FillTokens();
+static void ScanLocation(LexLocation &loc);
+static void PopTokens();
+static void SkipInactive();
+static void SkipSpace();
+static const char *SkipBlocksOf(const char *p, const char *end, char a, char b, char c, char d);
+static const char *SkipBlocksWithout(const char *p, const char *end, char a, char b);
+static int AddString(const char *s);
+
+#define YY_DECL int yylex(YYSTYPE &yylval)
+#define YY_USER_ACTION { sOffset += yyleng; sTokenLocValid = 0; }
+#define YY_INPUT(buf,res,max) (res = FillBuffer(buf, max))
+
+#define Return(tok, val) do { yylval.fInt = val; return tok; } while(0)
+
+// this is a hack so that isatty() and fileno() aren't required for the Win32/macintosh builds
+#if defined(WIN32) || defined(macintosh)
+#define YY_NEVER_INTERACTIVE 1
+#endif
+
+// Unused defs
+#define YY_NO_INPUT 1
+
+
+#define COMMENT 1
+#define PREPROC 2
+
+#line 653 "lexer.cpp"
+
+/* Macros after this point can all be overridden by user definitions in
+ * section 1.
+ */
+
+#ifndef YY_SKIP_YYWRAP
+#ifdef __cplusplus
+extern "C" int yywrap YY_PROTO(( void ));
+#else
+extern int yywrap YY_PROTO(( void ));
+#endif
+#endif
+
+#ifndef YY_NO_UNPUT
+static void yyunput YY_PROTO(( int c, char *buf_ptr ));
+#endif
+
+#ifndef yytext_ptr
+static void yy_flex_strncpy YY_PROTO(( char *, yyconst char *, int ));
+#endif
+
+#ifdef YY_NEED_STRLEN
+static int yy_flex_strlen YY_PROTO(( yyconst char * ));
+#endif
+
+#ifndef YY_NO_INPUT
+#ifdef __cplusplus
+static int yyinput YY_PROTO(( void ));
+#else
+static int input YY_PROTO(( void ));
+#endif
+#endif
+
+#if YY_STACK_USED
+static int yy_start_stack_ptr = 0;
+static int yy_start_stack_depth = 0;
+static int *yy_start_stack = 0;
+#ifndef YY_NO_PUSH_STATE
+static void yy_push_state YY_PROTO(( int new_state ));
+#endif
+#ifndef YY_NO_POP_STATE
+static void yy_pop_state YY_PROTO(( void ));
+#endif
+#ifndef YY_NO_TOP_STATE
+static int yy_top_state YY_PROTO(( void ));
+#endif
+
+#else
+#define YY_NO_PUSH_STATE 1
+#define YY_NO_POP_STATE 1
+#define YY_NO_TOP_STATE 1
+#endif
+
+#ifdef YY_MALLOC_DECL
+YY_MALLOC_DECL
+#else
+#if __STDC__
+#ifndef __cplusplus
+#include <stdlib.h>
+#endif
+#else
+/* Just try to get by without declaring the routines.  This will fail
+ * miserably on non-ANSI systems for which sizeof(size_t) != sizeof(int)
+ * or sizeof(void*) != sizeof(int).
+ */
+#endif
+#endif
+
+/* Amount of stuff to slurp up with each read. */
+#ifndef YY_READ_BUF_SIZE
+#define YY_READ_BUF_SIZE 8192
+#endif
+
+/* Copy whatever the last rule matched to the standard output. */
+
+#ifndef ECHO
+/* This used to be an fputs(), but since the string might contain NUL's,
+ * we now use fwrite().
+ */
+#define ECHO (void) fwrite( yytext, yyleng, 1, yyout )
+#endif
+
+/* Gets input and stuffs it into "buf".  number of characters read, or YY_NULL,
+ * is returned in "result".
+ */
+#ifndef YY_INPUT
+#define YY_INPUT(buf,result,max_size) \
+	if ( yy_current_buffer->yy_is_interactive ) \
+		{ \
+		int c = '*', n; \
+		for ( n = 0; n < max_size && \
+			     (c = getc( yyin )) != EOF && c != '\n'; ++n ) \
+			buf[n] = (char) c; \
+		if ( c == '\n' ) \
+			buf[n++] = (char) c; \
+		if ( c == EOF && ferror( yyin ) ) \
+			YY_FATAL_ERROR( "input in flex scanner failed" ); \
+		result = n; \
+		} \
+	else if ( ((result = fread( buf, 1, max_size, yyin )) == 0) \
+		  && ferror( yyin ) ) \
+		YY_FATAL_ERROR( "input in flex scanner failed" );
+#endif
+
+/* No semi-colon after return; correct usage is to write "yyterminate();" -
+ * we don't want an extra ';' after the "return" because that will cause
+ * some compilers to complain about unreachable statements.
+ */
+#ifndef yyterminate
+#define yyterminate() return YY_NULL
+#endif
+
+/* Number of entries by which start-condition stack grows. */
+#ifndef YY_START_STACK_INCR
+#define YY_START_STACK_INCR 25
+#endif
+
+/* Report a fatal error. */
+#ifndef YY_FATAL_ERROR
+#define YY_FATAL_ERROR(msg) yy_fatal_error( msg )
+#endif
+
+/* Default declaration of generated scanner - a define so the user can
+ * easily add parameters.
+ */
+#ifndef YY_DECL
+#define YY_DECL int yylex YY_PROTO(( void ))
+#endif
+
+/* Code executed at the beginning of each rule, after yytext and yyleng
+ * have been set up.
+ */
+#ifndef YY_USER_ACTION
+#define YY_USER_ACTION
+#endif
+
+/* Code executed at the end of each rule. */
+#ifndef YY_BREAK
+#define YY_BREAK break;
+#endif
+
+#define YY_RULE_SETUP \
+	YY_USER_ACTION
+
+YY_DECL
+	{
+	register yy_state_type yy_current_state;
+	register char *yy_cp, *yy_bp;
+	register int yy_act;
+
+#line 124 "lex.l"
+
+
+
+#line 808 "lexer.cpp"
+
+	if ( yy_init )
+		{
+		yy_init = 0;
+
+#ifdef YY_USER_INIT
+		YY_USER_INIT;
+#endif
+
+		if ( ! yy_start )
+			yy_start = 1;	/* first start state */
+
+		if ( ! yyin )
+			yyin = stdin;
+
+		if ( ! yyout )
+			yyout = stdout;
+
+		if ( ! yy_current_buffer )
+			yy_current_buffer =
+				yy_create_buffer( yyin, YY_BUF_SIZE );
+
+		yy_load_buffer_state();
+		}
+
+	while ( 1 )		/* loops until end-of-file is reached */
+		{
+		yy_cp = yy_c_buf_p;
+
+		/* Support of yytext. */
+		*yy_cp = yy_hold_char;
+
+		/* yy_bp points to the position in yy_ch_buf of the start of
+		 * the current run.
+		 */
+		yy_bp = yy_cp;
+
+		yy_current_state = yy_start;
+yy_match:
+		do
+			{
+			register YY_CHAR yy_c = yy_ec[YY_SC_TO_UI(*yy_cp)];
+			if ( yy_accept[yy_current_state] )
+				{
+				yy_last_accepting_state = yy_current_state;
+				yy_last_accepting_cpos = yy_cp;
+				}
+			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
+				{
+				yy_current_state = (int) yy_def[yy_current_state];
+				if ( yy_current_state >= 278 )
+					yy_c = yy_meta[(unsigned int) yy_c];
+				}
+			yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
+			++yy_cp;
+			}
+		while ( yy_base[yy_current_state] != 331 );
+
+yy_find_action:
+		yy_act = yy_accept[yy_current_state];
+		if ( yy_act == 0 )
+			{ /* have to back up */
+			yy_cp = yy_last_accepting_cpos;
+			yy_current_state = yy_last_accepting_state;
+			yy_act = yy_accept[yy_current_state];
+			}
+
+		YY_DO_BEFORE_ACTION;
+
+
+do_action:	/* This label is used only to access EOF actions. */
+
+
+		switch ( yy_act )
+	{ /* beginning of action switch */
+			case 0: /* must back up */
+			/* undo the effects of YY_DO_BEFORE_ACTION */
+			*yy_cp = yy_hold_char;
+			yy_cp = yy_last_accepting_cpos;
+			yy_current_state = yy_last_accepting_state;
+			goto yy_find_action;
+
+case 1:
+YY_RULE_SETUP
+#line 125 "lex.l"
+;
+	YY_BREAK
+case 2:
+YY_RULE_SETUP
+#line 126 "lex.l"
+; // hack for DOS EOF characters
+	YY_BREAK
+case 3:
+YY_RULE_SETUP
+#line 128 "lex.l"
+{ if (sInsideDirective) { sInsideDirective = 0; return NL; } }
+	YY_BREAK
+case 4:
+YY_RULE_SETUP
+#line 129 "lex.l"
+{ }
+	YY_BREAK
+case 5:
+YY_RULE_SETUP
+#line 131 "lex.l"
+{ return PP_GLOM; }
+	YY_BREAK
+case 6:
+YY_RULE_SETUP
+#line 132 "lex.l"
+{ if (sInsideDirective) return '#'; else { BEGIN(PREPROC); sInsideDirective = 1; } }
+	YY_BREAK
+case 7:
+YY_RULE_SETUP
+#line 133 "lex.l"
+{ BEGIN(INITIAL); return PP_INCLUDE; }
+	YY_BREAK
+case 8:
+YY_RULE_SETUP
+#line 134 "lex.l"
+{ BEGIN(INITIAL); return PP_DEFINE; }
+	YY_BREAK
+case 9:
+YY_RULE_SETUP
+#line 135 "lex.l"
+{ BEGIN(INITIAL); Return(PP_IFDEF, true); }
+	YY_BREAK
+case 10:
+YY_RULE_SETUP
+#line 136 "lex.l"
+{ BEGIN(INITIAL); Return(PP_IFDEF, false); }
+	YY_BREAK
+case 11:
+YY_RULE_SETUP
+#line 137 "lex.l"
+{ BEGIN(INITIAL); return PP_IF; }
+	YY_BREAK
+case 12:
+YY_RULE_SETUP
+#line 138 "lex.l"
+{ BEGIN(INITIAL); return PP_ELSE; }
+	YY_BREAK
+case 13:
+YY_RULE_SETUP
+#line 139 "lex.l"
+{ BEGIN(INITIAL); return PP_ELIF; }
+	YY_BREAK
+case 14:
+YY_RULE_SETUP
+#line 140 "lex.l"
+{ BEGIN(INITIAL); return PP_ENDIF; }
+	YY_BREAK
+case 15:
+YY_RULE_SETUP
+#line 141 "lex.l"
+{ BEGIN(INITIAL); return PP_UNDEF; }
+	YY_BREAK
+case 16:
+YY_RULE_SETUP
+#line 142 "lex.l"
+{ BEGIN(INITIAL); return PP_PRAGMA; }
+	YY_BREAK
+case 17:
+YY_RULE_SETUP
+#line 143 "lex.l"
+{ BEGIN(INITIAL); return PP_ERROR; }
+	YY_BREAK
+case 18:
+YY_RULE_SETUP
+#line 144 "lex.l"
+{ BEGIN(INITIAL); return PP_WARNING; }
+	YY_BREAK
+case 19:
+YY_RULE_SETUP
+#line 145 "lex.l"
+{ BEGIN(INITIAL); yyless(yyleng-1); return PP_UNKNOWN; }
+	YY_BREAK
+case 20:
+YY_RULE_SETUP
+#line 146 "lex.l"
+{ BEGIN(INITIAL); return PP_UNKNOWN; }
+	YY_BREAK
+case 21:
+YY_RULE_SETUP
+#line 148 "lex.l"
+{ return IF; }
+	YY_BREAK
+case 22:
+YY_RULE_SETUP
+#line 149 "lex.l"
+{ return ELSE; }
+	YY_BREAK
+case 23:
+YY_RULE_SETUP
+#line 150 "lex.l"
+{ return WHILE; }
+	YY_BREAK
+case 24:
+YY_RULE_SETUP
+#line 151 "lex.l"
+{ return DO; }
+	YY_BREAK
+case 25:
+YY_RULE_SETUP
+#line 152 "lex.l"
+{ return FOR; }
+	YY_BREAK
+case 26:
+YY_RULE_SETUP
+#line 153 "lex.l"
+{ return REPEAT; }
+	YY_BREAK
+case 27:
+YY_RULE_SETUP
+#line 154 "lex.l"
+{ yylval.fInt = Bytecode::kBreakFlow; return JUMP; }
+	YY_BREAK
+case 28:
+YY_RULE_SETUP
+#line 155 "lex.l"
+{ yylval.fInt = Bytecode::kContinueFlow; return JUMP; }
+	YY_BREAK
+case 29:
+YY_RULE_SETUP
+#line 156 "lex.l"
+{ yylval.fInt = Bytecode::kReturnFlow; return JUMP; }
+	YY_BREAK
+case 30:
+YY_RULE_SETUP
+#line 157 "lex.l"
+{ return SWITCH; }
+	YY_BREAK
+case 31:
+YY_RULE_SETUP
+#line 158 "lex.l"
+{ return CASE; }
+	YY_BREAK
+case 32:
+YY_RULE_SETUP
+#line 159 "lex.l"
+{ return DEFAULT; }
+	YY_BREAK
+case 33:
+YY_RULE_SETUP
+#line 160 "lex.l"
+{ return MONITOR; }
+	YY_BREAK
+case 34:
+YY_RULE_SETUP
+#line 161 "lex.l"
+{ return ACQUIRE; }
+	YY_BREAK
+case 35:
+YY_RULE_SETUP
+#line 162 "lex.l"
+{ return CATCH; }
+	YY_BREAK
+case 36:
+YY_RULE_SETUP
+#line 163 "lex.l"
+{ return GOTO; }
+	YY_BREAK
+case 37:
+YY_RULE_SETUP
+#line 165 "lex.l"
+{ return INT; }
+	YY_BREAK
+case 38:
+YY_RULE_SETUP
+#line 166 "lex.l"
+{ return T_VOID; }
+	YY_BREAK
+case 39:
+YY_RULE_SETUP
+#line 167 "lex.l"
+{ return T_CONST; }
+	YY_BREAK
+case 40:
+YY_RULE_SETUP
+#line 168 "lex.l"
+{ return SENSOR; }
+	YY_BREAK
+case 41:
+YY_RULE_SETUP
+#line 169 "lex.l"
+{ return TYPE; }
+	YY_BREAK
+case 42:
+YY_RULE_SETUP
+#line 170 "lex.l"
+{ return EVENT_SRC; }
+	YY_BREAK
+case 43:
+YY_RULE_SETUP
+#line 171 "lex.l"
+{ return TASKID; }
+	YY_BREAK
+case 44:
+YY_RULE_SETUP
+#line 172 "lex.l"
+{ return NOLIST; }
+	YY_BREAK
+case 45:
+YY_RULE_SETUP
+#line 173 "lex.l"
+{ return RES; }
+	YY_BREAK
+case 46:
+YY_RULE_SETUP
+#line 174 "lex.l"
+{ return ASM; }
+	YY_BREAK
+case 47:
+YY_RULE_SETUP
+#line 175 "lex.l"
+{ return TASK; }
+	YY_BREAK
+case 48:
+YY_RULE_SETUP
+#line 176 "lex.l"
+{ return SUB; }
+	YY_BREAK
+case 49:
+YY_RULE_SETUP
+#line 177 "lex.l"
+{ Return( TASKOP, kRCX_StopTaskOp); }
+	YY_BREAK
+case 50:
+YY_RULE_SETUP
+#line 178 "lex.l"
+{ Return( TASKOP, kRCX_StartTaskOp); }
+	YY_BREAK
+case 51:
+YY_RULE_SETUP
+#line 179 "lex.l"
+{ return ABS; }
+	YY_BREAK
+case 52:
+YY_RULE_SETUP
+#line 180 "lex.l"
+{ return SIGN; }
+	YY_BREAK
+case 53:
+YY_RULE_SETUP
+#line 182 "lex.l"
+{ Return( ASSIGN, kRCX_AddVar); }
+	YY_BREAK
+case 54:
+YY_RULE_SETUP
+#line 183 "lex.l"
+{ Return( ASSIGN, kRCX_SubVar); }
+	YY_BREAK
+case 55:
+YY_RULE_SETUP
+#line 184 "lex.l"
+{ Return( ASSIGN, kRCX_MulVar); }
+	YY_BREAK
+case 56:
+YY_RULE_SETUP
+#line 185 "lex.l"
+{ Return( ASSIGN, kRCX_DivVar); }
+	YY_BREAK
+case 57:
+YY_RULE_SETUP
+#line 186 "lex.l"
+{ Return( ASSIGN, kRCX_AndVar); }
+	YY_BREAK
+case 58:
+YY_RULE_SETUP
+#line 187 "lex.l"
+{ Return( ASSIGN, kRCX_OrVar); }
+	YY_BREAK
+case 59:
+YY_RULE_SETUP
+#line 188 "lex.l"
+{ Return( ASSIGN, kRCX_AbsVar); }
+	YY_BREAK
+case 60:
+YY_RULE_SETUP
+#line 189 "lex.l"
+{ Return( ASSIGN, kRCX_SgnVar); }
+	YY_BREAK
+case 61:
+YY_RULE_SETUP
+#line 191 "lex.l"
+{ Return( ASSIGN2, RIGHT); }
+	YY_BREAK
+case 62:
+YY_RULE_SETUP
+#line 192 "lex.l"
+{ Return( ASSIGN2, LEFT); }
+	YY_BREAK
+case 63:
+YY_RULE_SETUP
+#line 193 "lex.l"
+{ Return( ASSIGN2, '%'); }
+	YY_BREAK
+case 64:
+YY_RULE_SETUP
+#line 194 "lex.l"
+{ Return( ASSIGN2, '^'); }
+	YY_BREAK
+case 65:
+YY_RULE_SETUP
+#line 196 "lex.l"
+{ return REL_EQ; }
+	YY_BREAK
+case 66:
+YY_RULE_SETUP
+#line 197 "lex.l"
+{ return REL_NE; }
+	YY_BREAK
+case 67:
+YY_RULE_SETUP
+#line 198 "lex.l"
+{ return REL_LE; }
+	YY_BREAK
+case 68:
+YY_RULE_SETUP
+#line 199 "lex.l"
+{ return REL_GE; }
+	YY_BREAK
+case 69:
+YY_RULE_SETUP
+#line 201 "lex.l"
+{ return AND; }
+	YY_BREAK
+case 70:
+YY_RULE_SETUP
+#line 202 "lex.l"
+{ return OR; }
+	YY_BREAK
+case 71:
+YY_RULE_SETUP
+#line 204 "lex.l"
+{ Return( INCDEC, 1); }
+	YY_BREAK
+case 72:
+YY_RULE_SETUP
+#line 205 "lex.l"
+{ Return( INCDEC, 0); }
+	YY_BREAK
+case 73:
+YY_RULE_SETUP
+#line 207 "lex.l"
+{ return CTRUE; }
+	YY_BREAK
+case 74:
+YY_RULE_SETUP
+#line 208 "lex.l"
+{ return CFALSE; }
+	YY_BREAK
+case 75:
+YY_RULE_SETUP
+#line 210 "lex.l"
+{ return LEFT; }
+	YY_BREAK
+case 76:
+YY_RULE_SETUP
+#line 211 "lex.l"
+{ return RIGHT; }
+	YY_BREAK
+case 77:
+YY_RULE_SETUP
+#line 213 "lex.l"
+{ return INDIRECT; }
+	YY_BREAK
+case 78:
+YY_RULE_SETUP
+#line 215 "lex.l"
+{ yylval.fSymbol = Symbol::Get(yytext, yyleng); return ID; }
+	YY_BREAK
+case 79:
+YY_RULE_SETUP
+#line 216 "lex.l"
+{ char*ptr; yylval.fInt = strtol(yytext, &ptr, 0); return NUMBER; }
+	YY_BREAK
+case 80:
+YY_RULE_SETUP
+#line 217 "lex.l"
+{ yylval.fInt = (int)atof(yytext); return NUMBER; }
+	YY_BREAK
+case 81:
+YY_RULE_SETUP
+#line 219 "lex.l"
+{ yytext[yyleng-1]=0; yylval.fString = yytext+1; return STRING; }
+	YY_BREAK
+case 82:
+YY_RULE_SETUP
+#line 221 "lex.l"
+{ if (sReturnWhitespace) return WS; }
+	YY_BREAK
+case 83:
+YY_RULE_SETUP
+#line 223 "lex.l"
+{ return yytext[0]; }
+	YY_BREAK
+case 84:
+YY_RULE_SETUP
+#line 225 "lex.l"
+BEGIN(COMMENT);
+	YY_BREAK
+case 85:
+YY_RULE_SETUP
+#line 226 "lex.l"
+/* eat anything that's not a '*' */
+	YY_BREAK
+case 86:
+YY_RULE_SETUP
+#line 227 "lex.l"
+/* eat up '*'s not followed by '/'s */
+	YY_BREAK
+case 87:
+YY_RULE_SETUP
+#line 228 "lex.l"
+/* eat up newlines */
+	YY_BREAK
+case 88:
+YY_RULE_SETUP
+#line 229 "lex.l"
+BEGIN(INITIAL);
+	YY_BREAK
+case 89:
+YY_RULE_SETUP
+#line 232 "lex.l"
+ECHO;
+	YY_BREAK
+#line 1336 "lexer.cpp"
+case YY_STATE_EOF(INITIAL):
+case YY_STATE_EOF(COMMENT):
+case YY_STATE_EOF(PREPROC):
+	yyterminate();
+
+	case YY_END_OF_BUFFER:
+		{
+		/* Amount of text matched not including the EOB char. */
+		int yy_amount_of_matched_text = (int) (yy_cp - yytext_ptr) - 1;
+
+		/* Undo the effects of YY_DO_BEFORE_ACTION. */
+		*yy_cp = yy_hold_char;
+		YY_RESTORE_YY_MORE_OFFSET
+
+		if ( yy_current_buffer->yy_buffer_status == YY_BUFFER_NEW )
+			{
+			/* We're scanning a new file or input source.  It's
+			 * possible that this happened because the user
+			 * just pointed yyin at a new source and called
+			 * yylex().  If so, then we have to assure
+			 * consistency between yy_current_buffer and our
+			 * globals.  Here is the right place to do so, because
+			 * this is the first action (other than possibly a
+			 * back-up) that will match for the new input source.
+			 */
+			yy_n_chars = yy_current_buffer->yy_n_chars;
+			yy_current_buffer->yy_input_file = yyin;
+			yy_current_buffer->yy_buffer_status = YY_BUFFER_NORMAL;
+			}
+
+		/* Note that here we test for yy_c_buf_p "<=" to the position
+		 * of the first EOB in the buffer, since yy_c_buf_p will
+		 * already have been incremented past the NUL character
+		 * (since all states make transitions on EOB to the
+		 * end-of-buffer state).  Contrast this with the test
+		 * in input().
+		 */
+		if ( yy_c_buf_p <= &yy_current_buffer->yy_ch_buf[yy_n_chars] )
+			{ /* This was really a NUL. */
+			yy_state_type yy_next_state;
+
+			yy_c_buf_p = yytext_ptr + yy_amount_of_matched_text;
+
+			yy_current_state = yy_get_previous_state();
+
+			/* Okay, we're now positioned to make the NUL
+			 * transition.  We couldn't have
+			 * yy_get_previous_state() go ahead and do it
+			 * for us because it doesn't know how to deal
+			 * with the possibility of jamming (and we don't
+			 * want to build jamming into it because then it
+			 * will run more slowly).
+			 */
+
+			yy_next_state = yy_try_NUL_trans( yy_current_state );
+
+			yy_bp = yytext_ptr + YY_MORE_ADJ;
+
+			if ( yy_next_state )
+				{
+				/* Consume the NUL. */
+				yy_cp = ++yy_c_buf_p;
+				yy_current_state = yy_next_state;
+				goto yy_match;
+				}
+
+			else
+				{
+				yy_cp = yy_c_buf_p;
+				goto yy_find_action;
+				}
+			}
+
+		else switch ( yy_get_next_buffer() )
+			{
+			case EOB_ACT_END_OF_FILE:
+				{
+				yy_did_buffer_switch_on_eof = 0;
+
+				if ( yywrap() )
+					{
+					/* Note: because we've taken care in
+					 * yy_get_next_buffer() to have set up
+					 * yytext, we can now set up
+					 * yy_c_buf_p so that if some total
+					 * hoser (like flex itself) wants to
+					 * call the scanner after we return the
+					 * YY_NULL, it'll still work - another
+					 * YY_NULL will get returned.
+					 */
+					yy_c_buf_p = yytext_ptr + YY_MORE_ADJ;
+
+					yy_act = YY_STATE_EOF(YY_START);
+					goto do_action;
+					}
+
+				else
+					{
+					if ( ! yy_did_buffer_switch_on_eof )
+						YY_NEW_FILE;
+					}
+				break;
+				}
+
+			case EOB_ACT_CONTINUE_SCAN:
+				yy_c_buf_p =
+					yytext_ptr + yy_amount_of_matched_text;
+
+				yy_current_state = yy_get_previous_state();
+
+				yy_cp = yy_c_buf_p;
+				yy_bp = yytext_ptr + YY_MORE_ADJ;
+				goto yy_match;
+
+			case EOB_ACT_LAST_MATCH:
+				yy_c_buf_p =
+				&yy_current_buffer->yy_ch_buf[yy_n_chars];
+
+				yy_current_state = yy_get_previous_state();
+
+				yy_cp = yy_c_buf_p;
+				yy_bp = yytext_ptr + YY_MORE_ADJ;
+				goto yy_find_action;
+			}
+		break;
+		}
+
+	default:
+		YY_FATAL_ERROR(
+			"fatal flex scanner internal error--no action found" );
+	} /* end of action switch */
+		} /* end of scanning one token */
+	} /* end of yylex */
+
+
+/* yy_get_next_buffer - try to read in a new buffer
+ *
+ * Returns a code representing an action:
+ *	EOB_ACT_LAST_MATCH -
+ *	EOB_ACT_CONTINUE_SCAN - continue scanning from current position
+ *	EOB_ACT_END_OF_FILE - end of file
+ */
+
+static int yy_get_next_buffer()
+	{
+	register char *dest = yy_current_buffer->yy_ch_buf;
+	register char *source = yytext_ptr;
+	register int number_to_move, i;
+	int ret_val;
+
+	if ( yy_c_buf_p > &yy_current_buffer->yy_ch_buf[yy_n_chars + 1] )
+		YY_FATAL_ERROR(
+		"fatal flex scanner internal error--end of buffer missed" );
+
+	if ( yy_current_buffer->yy_fill_buffer == 0 )
+		{ /* Don't try to fill the buffer, so this is an EOF. */
+		if ( yy_c_buf_p - yytext_ptr - YY_MORE_ADJ == 1 )
+			{
+			/* We matched a single character, the EOB, so
+			 * treat this as a final EOF.
+			 */
+			return EOB_ACT_END_OF_FILE;
+			}
+
+		else
+			{
+			/* We matched some text prior to the EOB, first
+			 * process it.
+			 */
+			return EOB_ACT_LAST_MATCH;
+			}
+		}
+
+	/* Try to read more data. */
+
+	/* First move last chars to start of buffer. */
+	number_to_move = (int) (yy_c_buf_p - yytext_ptr) - 1;
+
+	for ( i = 0; i < number_to_move; ++i )
+		*(dest++) = *(source++);
+
+	if ( yy_current_buffer->yy_buffer_status == YY_BUFFER_EOF_PENDING )
+		/* don't do the read, it's not guaranteed to return an EOF,
+		 * just force an EOF
+		 */
+		yy_current_buffer->yy_n_chars = yy_n_chars = 0;
+
+	else
+		{
+		int num_to_read =
+			yy_current_buffer->yy_buf_size - number_to_move - 1;
+
+		while ( num_to_read <= 0 )
+			{ /* Not enough room in the buffer - grow it. */
+#ifdef YY_USES_REJECT
+			YY_FATAL_ERROR(
+"input buffer overflow, can't enlarge buffer because scanner uses REJECT" );
+#else
+
+			/* just a shorter name for the current buffer */
+			YY_BUFFER_STATE b = yy_current_buffer;
+
+			int yy_c_buf_p_offset =
+				(int) (yy_c_buf_p - b->yy_ch_buf);
+
+			if ( b->yy_is_our_buffer )
+				{
+				int new_size = b->yy_buf_size * 2;
+
+				if ( new_size <= 0 )
+					b->yy_buf_size += b->yy_buf_size / 8;
+				else
+					b->yy_buf_size *= 2;
+
+				b->yy_ch_buf = (char *)
+					/* Include room in for 2 EOB chars. */
+					yy_flex_realloc( (void *) b->yy_ch_buf,
+							 b->yy_buf_size + 2 );
+				}
+			else
+				/* Can't grow it, we don't own it. */
+				b->yy_ch_buf = 0;
+
+			if ( ! b->yy_ch_buf )
+				YY_FATAL_ERROR(
+				"fatal error - scanner input buffer overflow" );
+
+			yy_c_buf_p = &b->yy_ch_buf[yy_c_buf_p_offset];
+
+			num_to_read = yy_current_buffer->yy_buf_size -
+						number_to_move - 1;
+#endif
+			}
+
+		if ( num_to_read > YY_READ_BUF_SIZE )
+			num_to_read = YY_READ_BUF_SIZE;
+
+		/* Read in more data. */
+		YY_INPUT( (&yy_current_buffer->yy_ch_buf[number_to_move]),
+			yy_n_chars, num_to_read );
+
+		yy_current_buffer->yy_n_chars = yy_n_chars;
+		}
+
+	if ( yy_n_chars == 0 )
+		{
+		if ( number_to_move == YY_MORE_ADJ )
+			{
+			ret_val = EOB_ACT_END_OF_FILE;
+			yyrestart( yyin );
+			}
+
+		else
+			{
+			ret_val = EOB_ACT_LAST_MATCH;
+			yy_current_buffer->yy_buffer_status =
+				YY_BUFFER_EOF_PENDING;
+			}
+		}
+
+	else
+		ret_val = EOB_ACT_CONTINUE_SCAN;
+
+	yy_n_chars += number_to_move;
+	yy_current_buffer->yy_ch_buf[yy_n_chars] = YY_END_OF_BUFFER_CHAR;
+	yy_current_buffer->yy_ch_buf[yy_n_chars + 1] = YY_END_OF_BUFFER_CHAR;
+
+	yytext_ptr = &yy_current_buffer->yy_ch_buf[0];
+
+	return ret_val;
+	}
+
+
+/* yy_get_previous_state - get the state just before the EOB char was reached */
+
+static yy_state_type yy_get_previous_state()
+	{
+	register yy_state_type yy_current_state;
+	register char *yy_cp;
+
+	yy_current_state = yy_start;
+
+	for ( yy_cp = yytext_ptr + YY_MORE_ADJ; yy_cp < yy_c_buf_p; ++yy_cp )
+		{
+		register YY_CHAR yy_c = (*yy_cp ? yy_ec[YY_SC_TO_UI(*yy_cp)] : 1);
+		if ( yy_accept[yy_current_state] )
+			{
+			yy_last_accepting_state = yy_current_state;
+			yy_last_accepting_cpos = yy_cp;
+			}
+		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
+			{
+			yy_current_state = (int) yy_def[yy_current_state];
+			if ( yy_current_state >= 278 )
+				yy_c = yy_meta[(unsigned int) yy_c];
+			}
+		yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
+		}
+
+	return yy_current_state;
+	}
+
+
+/* yy_try_NUL_trans - try to make a transition on the NUL character
+ *
+ * synopsis
+ *	next_state = yy_try_NUL_trans( current_state );
+ */
+
+#ifdef YY_USE_PROTOS
+static yy_state_type yy_try_NUL_trans( yy_state_type yy_current_state )
+#else
+static yy_state_type yy_try_NUL_trans( yy_current_state )
+yy_state_type yy_current_state;
+#endif
+	{
+	register int yy_is_jam;
+	register char *yy_cp = yy_c_buf_p;
+
+	register YY_CHAR yy_c = 1;
+	if ( yy_accept[yy_current_state] )
+		{
+		yy_last_accepting_state = yy_current_state;
+		yy_last_accepting_cpos = yy_cp;
+		}
+	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
+		{
+		yy_current_state = (int) yy_def[yy_current_state];
+		if ( yy_current_state >= 278 )
+			yy_c = yy_meta[(unsigned int) yy_c];
+		}
+	yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
+	yy_is_jam = (yy_current_state == 277);
+
+	return yy_is_jam ? 0 : yy_current_state;
+	}
+
+
+#ifndef YY_NO_UNPUT
+#ifdef YY_USE_PROTOS
+static void yyunput( int c, register char *yy_bp )
+#else
+static void yyunput( c, yy_bp )
+int c;
+register char *yy_bp;
+#endif
+	{
+	register char *yy_cp = yy_c_buf_p;
+
+	/* undo effects of setting up yytext */
+	*yy_cp = yy_hold_char;
+
+	if ( yy_cp < yy_current_buffer->yy_ch_buf + 2 )
+		{ /* need to shift things up to make room */
+		/* +2 for EOB chars. */
+		register int number_to_move = yy_n_chars + 2;
+		register char *dest = &yy_current_buffer->yy_ch_buf[
+					yy_current_buffer->yy_buf_size + 2];
+		register char *source =
+				&yy_current_buffer->yy_ch_buf[number_to_move];
+
+		while ( source > yy_current_buffer->yy_ch_buf )
+			*--dest = *--source;
+
+		yy_cp += (int) (dest - source);
+		yy_bp += (int) (dest - source);
+		yy_current_buffer->yy_n_chars =
+			yy_n_chars = yy_current_buffer->yy_buf_size;
+
+		if ( yy_cp < yy_current_buffer->yy_ch_buf + 2 )
+			YY_FATAL_ERROR( "flex scanner push-back overflow" );
+		}
+
+	*--yy_cp = (char) c;
+
+
+	yytext_ptr = yy_bp;
+	yy_hold_char = *yy_cp;
+	yy_c_buf_p = yy_cp;
+	}
+#endif	/* ifndef YY_NO_UNPUT */
+
+
+#ifdef __cplusplus
+static int yyinput()
+#else
+static int input()
+#endif
+	{
+	int c;
+
+	*yy_c_buf_p = yy_hold_char;
+
+	if ( *yy_c_buf_p == YY_END_OF_BUFFER_CHAR )
+		{
+		/* yy_c_buf_p now points to the character we want to return.
+		 * If this occurs *before* the EOB characters, then it's a
+		 * valid NUL; if not, then we've hit the end of the buffer.
+		 */
+		if ( yy_c_buf_p < &yy_current_buffer->yy_ch_buf[yy_n_chars] )
+			/* This was really a NUL. */
+			*yy_c_buf_p = '\0';
+
+		else
+			{ /* need more input */
+			int offset = yy_c_buf_p - yytext_ptr;
+			++yy_c_buf_p;
+
+			switch ( yy_get_next_buffer() )
+				{
+				case EOB_ACT_LAST_MATCH:
+					/* This happens because yy_g_n_b()
+					 * sees that we've accumulated a
+					 * token and flags that we need to
+					 * try matching the token before
+					 * proceeding.  But for input(),
+					 * there's no matching to consider.
+					 * So convert the EOB_ACT_LAST_MATCH
+					 * to EOB_ACT_END_OF_FILE.
+					 */
+
+					/* Reset buffer status. */
+					yyrestart( yyin );
+
+					/* fall through */
+
+				case EOB_ACT_END_OF_FILE:
+					{
+					if ( yywrap() )
+						return EOF;
+
+					if ( ! yy_did_buffer_switch_on_eof )
+						YY_NEW_FILE;
+#ifdef __cplusplus
+					return yyinput();
+#else
+					return input();
+#endif
+					}
+
+				case EOB_ACT_CONTINUE_SCAN:
+					yy_c_buf_p = yytext_ptr + offset;
+					break;
+				}
+			}
+		}
+
+	c = *(unsigned char *) yy_c_buf_p;	/* cast for 8-bit char's */
+	*yy_c_buf_p = '\0';	/* preserve yytext */
+	yy_hold_char = *++yy_c_buf_p;
+
+
+	return c;
+	}
+
+
+#ifdef YY_USE_PROTOS
+void yyrestart( FILE *input_file )
+#else
+void yyrestart( input_file )
+FILE *input_file;
+#endif
+	{
+	if ( ! yy_current_buffer )
+		yy_current_buffer = yy_create_buffer( yyin, YY_BUF_SIZE );
+
+	yy_init_buffer( yy_current_buffer, input_file );
+	yy_load_buffer_state();
+	}
+
+
+#ifdef YY_USE_PROTOS
+void yy_switch_to_buffer( YY_BUFFER_STATE new_buffer )
+#else
+void yy_switch_to_buffer( new_buffer )
+YY_BUFFER_STATE new_buffer;
+#endif
+	{
+	if ( yy_current_buffer == new_buffer )
+		return;
+
+	if ( yy_current_buffer )
+		{
+		/* Flush out information for old buffer. */
+		*yy_c_buf_p = yy_hold_char;
+		yy_current_buffer->yy_buf_pos = yy_c_buf_p;
+		yy_current_buffer->yy_n_chars = yy_n_chars;
+		}
+
+	yy_current_buffer = new_buffer;
+	yy_load_buffer_state();
+
+	/* We don't actually know whether we did this switch during
+	 * EOF (yywrap()) processing, but the only time this flag
+	 * is looked at is after yywrap() is called, so it's safe
+	 * to go ahead and always set it.
+	 */
+	yy_did_buffer_switch_on_eof = 1;
+	}
+
+
+#ifdef YY_USE_PROTOS
+void yy_load_buffer_state( void )
+#else
+void yy_load_buffer_state()
+#endif
+	{
+	yy_n_chars = yy_current_buffer->yy_n_chars;
+	yytext_ptr = yy_c_buf_p = yy_current_buffer->yy_buf_pos;
+	yyin = yy_current_buffer->yy_input_file;
+	yy_hold_char = *yy_c_buf_p;
+	}
+
+
+#ifdef YY_USE_PROTOS
+YY_BUFFER_STATE yy_create_buffer( FILE *file, int size )
+#else
+YY_BUFFER_STATE yy_create_buffer( file, size )
+FILE *file;
+int size;
+#endif
+	{
+	YY_BUFFER_STATE b;
+
+	b = (YY_BUFFER_STATE) yy_flex_alloc( sizeof( struct yy_buffer_state ) );
+	if ( ! b )
+		YY_FATAL_ERROR( "out of dynamic memory in yy_create_buffer()" );
+
+	b->yy_buf_size = size;
+
+	/* yy_ch_buf has to be 2 characters longer than the size given because
+	 * we need to put in 2 end-of-buffer characters.
+	 */
+	b->yy_ch_buf = (char *) yy_flex_alloc( b->yy_buf_size + 2 );
+	if ( ! b->yy_ch_buf )
+		YY_FATAL_ERROR( "out of dynamic memory in yy_create_buffer()" );
+
+	b->yy_is_our_buffer = 1;
+
+	yy_init_buffer( b, file );
+
+	return b;
+	}
+
+
+#ifdef YY_USE_PROTOS
+void yy_delete_buffer( YY_BUFFER_STATE b )
+#else
+void yy_delete_buffer( b )
+YY_BUFFER_STATE b;
+#endif
+	{
+	if ( ! b )
+		return;
+
+	if ( b == yy_current_buffer )
+		yy_current_buffer = (YY_BUFFER_STATE) 0;
+
+	if ( b->yy_is_our_buffer )
+		yy_flex_free( (void *) b->yy_ch_buf );
+
+	yy_flex_free( (void *) b );
+	}
+
+
+#ifndef YY_ALWAYS_INTERACTIVE
+#ifndef YY_NEVER_INTERACTIVE
+extern int isatty YY_PROTO(( int ));
+#endif
+#endif
+
+#ifdef YY_USE_PROTOS
+void yy_init_buffer( YY_BUFFER_STATE b, FILE *file )
+#else
+void yy_init_buffer( b, file )
+YY_BUFFER_STATE b;
+FILE *file;
+#endif
+
+
+	{
+	yy_flush_buffer( b );
+
+	b->yy_input_file = file;
+	b->yy_fill_buffer = 1;
+
+#if YY_ALWAYS_INTERACTIVE
+	b->yy_is_interactive = 1;
+#else
+#if YY_NEVER_INTERACTIVE
+	b->yy_is_interactive = 0;
+#else
+	b->yy_is_interactive = file ? (isatty( fileno(file) ) > 0) : 0;
+#endif
+#endif
+	}
+
+
+#ifdef YY_USE_PROTOS
+void yy_flush_buffer( YY_BUFFER_STATE b )
+#else
+void yy_flush_buffer( b )
+YY_BUFFER_STATE b;
+#endif
+
+	{
+	if ( ! b )
+		return;
+
+	b->yy_n_chars = 0;
+
+	/* We always need two end-of-buffer characters.  The first causes
+	 * a transition to the end-of-buffer state.  The second causes
+	 * a jam in that state.
+	 */
+	b->yy_ch_buf[0] = YY_END_OF_BUFFER_CHAR;
+	b->yy_ch_buf[1] = YY_END_OF_BUFFER_CHAR;
+
+	b->yy_buf_pos = &b->yy_ch_buf[0];
+
+	b->yy_at_bol = 1;
+	b->yy_buffer_status = YY_BUFFER_NEW;
+
+	if ( b == yy_current_buffer )
+		yy_load_buffer_state();
+	}
+
+
+#ifndef YY_NO_SCAN_BUFFER
+#ifdef YY_USE_PROTOS
+YY_BUFFER_STATE yy_scan_buffer( char *base, yy_size_t size )
+#else
+YY_BUFFER_STATE yy_scan_buffer( base, size )
+char *base;
+yy_size_t size;
+#endif
+	{
+	YY_BUFFER_STATE b;
+
+	if ( size < 2 ||
+	     base[size-2] != YY_END_OF_BUFFER_CHAR ||
+	     base[size-1] != YY_END_OF_BUFFER_CHAR )
+		/* They forgot to leave room for the EOB's. */
+		return 0;
+
+	b = (YY_BUFFER_STATE) yy_flex_alloc( sizeof( struct yy_buffer_state ) );
+	if ( ! b )
+		YY_FATAL_ERROR( "out of dynamic memory in yy_scan_buffer()" );
+
+	b->yy_buf_size = size - 2;	/* "- 2" to take care of EOB's */
+	b->yy_buf_pos = b->yy_ch_buf = base;
+	b->yy_is_our_buffer = 0;
+	b->yy_input_file = 0;
+	b->yy_n_chars = b->yy_buf_size;
+	b->yy_is_interactive = 0;
+	b->yy_at_bol = 1;
+	b->yy_fill_buffer = 0;
+	b->yy_buffer_status = YY_BUFFER_NEW;
+
+	yy_switch_to_buffer( b );
+
+	return b;
+	}
+#endif
+
+
+#ifndef YY_NO_SCAN_STRING
+#ifdef YY_USE_PROTOS
+YY_BUFFER_STATE yy_scan_string( yyconst char *yy_str )
+#else
+YY_BUFFER_STATE yy_scan_string( yy_str )
+yyconst char *yy_str;
+#endif
+	{
+	int len;
+	for ( len = 0; yy_str[len]; ++len )
+		;
+
+	return yy_scan_bytes( yy_str, len );
+	}
+#endif
+
+
+#ifndef YY_NO_SCAN_BYTES
+#ifdef YY_USE_PROTOS
+YY_BUFFER_STATE yy_scan_bytes( yyconst char *bytes, int len )
+#else
+YY_BUFFER_STATE yy_scan_bytes( bytes, len )
+yyconst char *bytes;
+int len;
+#endif
+	{
+	YY_BUFFER_STATE b;
+	char *buf;
+	yy_size_t n;
+	int i;
+
+	/* Get memory for full buffer, including space for trailing EOB's. */
+	n = len + 2;
+	buf = (char *) yy_flex_alloc( n );
+	if ( ! buf )
+		YY_FATAL_ERROR( "out of dynamic memory in yy_scan_bytes()" );
+
+	for ( i = 0; i < len; ++i )
+		buf[i] = bytes[i];
+
+	buf[len] = buf[len+1] = YY_END_OF_BUFFER_CHAR;
+
+	b = yy_scan_buffer( buf, n );
+	if ( ! b )
+		YY_FATAL_ERROR( "bad buffer in yy_scan_bytes()" );
+
+	/* It's okay to grow etc. this buffer, and we should throw it
+	 * away when we're done.
+	 */
+	b->yy_is_our_buffer = 1;
+
+	return b;
+	}
+#endif
+
+
+#ifndef YY_NO_PUSH_STATE
+#ifdef YY_USE_PROTOS
+static void yy_push_state( int new_state )
+#else
+static void yy_push_state( new_state )
+int new_state;
+#endif
+	{
+	if ( yy_start_stack_ptr >= yy_start_stack_depth )
+		{
+		yy_size_t new_size;
+
+		yy_start_stack_depth += YY_START_STACK_INCR;
+		new_size = yy_start_stack_depth * sizeof( int );
+
+		if ( ! yy_start_stack )
+			yy_start_stack = (int *) yy_flex_alloc( new_size );
+
+		else
+			yy_start_stack = (int *) yy_flex_realloc(
+					(void *) yy_start_stack, new_size );
+
+		if ( ! yy_start_stack )
+			YY_FATAL_ERROR(
+			"out of memory expanding start-condition stack" );
+		}
+
+	yy_start_stack[yy_start_stack_ptr++] = YY_START;
+
+	BEGIN(new_state);
+	}
+#endif
+
+
+#ifndef YY_NO_POP_STATE
+static void yy_pop_state()
+	{
+	if ( --yy_start_stack_ptr < 0 )
+		YY_FATAL_ERROR( "start-condition stack underflow" );
+
+	BEGIN(yy_start_stack[yy_start_stack_ptr]);
+	}
+#endif
+
+
+#ifndef YY_NO_TOP_STATE
+static int yy_top_state()
+	{
+	return yy_start_stack[yy_start_stack_ptr - 1];
+	}
+#endif
+
+#ifndef YY_EXIT_FAILURE
+#define YY_EXIT_FAILURE 2
+#endif
+
+#ifdef YY_USE_PROTOS
+static void yy_fatal_error( yyconst char msg[] )
+#else
+static void yy_fatal_error( msg )
+char msg[];
+#endif
+	{
+	(void) fprintf( stderr, "%s\n", msg );
+	exit( YY_EXIT_FAILURE );
+	}
+
+
+
+/* Redefine yyless() so it works in section 3 code. */
+
+#undef yyless
+#define yyless(n) \
+	do \
+		{ \
+		/* Undo effects of setting up yytext. */ \
+		yytext[yyleng] = yy_hold_char; \
+		yy_c_buf_p = yytext + n; \
+		yy_hold_char = *yy_c_buf_p; \
+		*yy_c_buf_p = '\0'; \
+		yyleng = n; \
+		} \
+	while ( 0 )
+
+
+/* Internal utility routines. */
+
+#ifndef yytext_ptr
+#ifdef YY_USE_PROTOS
+static void yy_flex_strncpy( char *s1, yyconst char *s2, int n )
+#else
+static void yy_flex_strncpy( s1, s2, n )
+char *s1;
+yyconst char *s2;
+int n;
+#endif
+	{
+	register int i;
+	for ( i = 0; i < n; ++i )
+		s1[i] = s2[i];
+	}
+#endif
+
+#ifdef YY_NEED_STRLEN
+#ifdef YY_USE_PROTOS
+static int yy_flex_strlen( yyconst char *s )
+#else
+static int yy_flex_strlen( s )
+yyconst char *s;
+#endif
+	{
+	register int n;
+	for ( n = 0; s[n]; ++n )
+		;
+
+	return n;
+	}
+#endif
+
+
+#ifdef YY_USE_PROTOS
+static void *yy_flex_alloc( yy_size_t size )
+#else
+static void *yy_flex_alloc( size )
+yy_size_t size;
+#endif
+	{
+	return (void *) malloc( size );
+	}
+
+#ifdef YY_USE_PROTOS
+static void *yy_flex_realloc( void *ptr, yy_size_t size )
+#else
+static void *yy_flex_realloc( ptr, size )
+void *ptr;
+yy_size_t size;
+#endif
+	{
+	/* The cast to (char *) in the following accommodates both
+	 * implementations that use char* generic pointers, and those
+	 * that use void* generic pointers.  It works with the latter
+	 * because both ANSI C and C++ allow castless assignment from
+	 * any pointer type to void*, and deal with argument conversions
+	 * as though doing an assignment.
+	 */
+	return (void *) realloc( (char *) ptr, size );
+	}
+
+#ifdef YY_USE_PROTOS
+static void yy_flex_free( void *ptr )
+#else
+static void yy_flex_free( ptr )
+void *ptr;
+#endif
+	{
+	free( ptr );
+	}
+
+#if YY_MAIN
+int main()
+	{
+	yylex();
+	return 0;
+	}
+#endif
+#line 232 "lex.l"
+
+void LexCurrentLocation(LexLocation &loc) {
+    // the last token handed out by LexGetToken(), unless yylex() has
+    // been called directly since then
+    if (sTokenLocValid) {
+        loc = sTokenLoc;
+        return;
+    }
+
+    ScanLocation(loc);
+}
+
+void ScanLocation(LexLocation &loc) {
+    loc.fLength = yyleng;
+    loc.fIndex = sSourceIndex;
+    loc.fOffset = sOffset - yyleng;
+}
+
+int LexGetToken(YYSTYPE &v) {
+    while (1) {
+        if (sTokenPos < sTokens.size()) {
+            const LexToken &t = sTokens[sTokenPos++];
+            if (t.fType == WS && !sReturnWhitespace) continue;
+
+            v = t.fValue;
+            sTokenLoc = t.fLoc;
+            sTokenLocValid = 1;
+            sTokenDepth = t.fDepth;
+            return t.fType;
+        }
+
+        InputFile *f = sCurrentInputFile;
+
+        if (f && f->fTokens) {
+            int t = f->fTokens->GetToken(f->fTokenIndex++, v, sTokenLoc);
+            if (t == 0) {
+                PopTokens();
+                if (!sCurrentInputFile) return 0;
+                continue;
+            }
+            if (t == WS && !sReturnWhitespace) continue;
+            if (t == STRING) v.fInt = AddString(v.fString);
+
+            sTokenLoc.fIndex = sSourceIndex;
+            sTokenLocValid = 1;
+            sTokenDepth = sFileDepth;
+            return t;
+        }
+
+        FillTokens();
+    }
+}
+
+/*
+ * Scan up to kLexBatchSize tokens into sTokens.  A batch always ends
+ * after the NL that closes a directive, so that a file pushed by
+ * #include is scanned before the rest of the including file.  Inside
+ * a directive whitespace is kept, and LexGetToken() drops it unless
+ * the preprocessor has asked for it by the time the token is read.
+ */
+void FillTokens() {
+    int mode = sReturnWhitespace;
+
+    sTokens.clear();
+    sTokenPos = 0;
+    sTokenLocValid = 0;
+
+    SkipInactive();
+
+    while (1) {
+        LexToken t;
+
+        sReturnWhitespace = mode || sInsideDirective;
+        sResumeTokens = 0;
+        SkipSpace();
+        t.fType = yylex(t.fValue);
+
+        // an include within a precompiled header has ended
+        if (t.fType == 0 && sResumeTokens) break;
+
+        ScanLocation(t.fLoc);
+        t.fDepth = sFileDepth;
+
+        // the text is in the flex buffer, which won't outlive the batch
+        if (t.fType == STRING)
+            t.fValue.fInt = AddString(t.fValue.fString);
+
+        sTokens.push_back(t);
+
+        if (t.fType == 0 || t.fType == NL) break;
+        if (!sInsideDirective && sTokens.size() >= kLexBatchSize) break;
+    }
+
+    sReturnWhitespace = mode;
+}
+
+int AddString(const char *s) {
+    int offset = (int)sStrings.size();
+
+    sStrings.insert(sStrings.end(), s, s + strlen(s) + 1);
+    return offset;
+}
+
+const char *LexGetString(int offset) {
+    return &sStrings[offset];
+}
+
+void LexReturnWhitespace(int mode) {
+    sReturnWhitespace = mode;
+}
+
+void LexSkipInactive(int skip) {
+    sSkipInactive = skip;
+}
+
+/*
+ * While the preprocessor is in an inactive block only directives
+ * matter, so rather than scanning tokens just to throw them away,
+ * move past the text in the flex buffer up to the next '#' that isn't
+ * in a comment or string.  Anything that doesn't end within the
+ * buffer is left for the rules to scan.
+ */
+void SkipInactive() {
+    if (!sSkipInactive || sInsideDirective || YY_START != INITIAL) return;
+    if (!sCurrentInputFile || sCurrentInputFile->fTokens) return;
+
+    char *start = yy_c_buf_p;
+    char *end = YY_CURRENT_BUFFER->yy_ch_buf + yy_n_chars;
+    char *p = start;
+
+    // flex keeps a nul after the last token
+    *start = yy_hold_char;
+
+    while (p < end) {
+        char *q;
+
+        if (*p == '#')
+            break;
+        else if (*p == '/') {
+            if (p+1 == end) break;
+
+            if (p[1] == '/') {
+                for(q=p+2; q<end && *q!='\r' && *q!='\n'; ++q)
+                    ;
+                if (q == end) break;
+                p = q;
+                continue;
+            }
+            else if (p[1] == '*') {
+                for(q=p+2; q+1<end && !(q[0]=='*' && q[1]=='/'); ++q)
+                    ;
+                if (q+1 >= end) break;
+                p = q+2;
+                continue;
+            }
+        }
+        else if (*p == '"') {
+            q = (char *)memchr(p+1, '"', end-p-1);
+            if (!q) break;
+            p = q+1;
+            continue;
+        }
+
+        ++p;
+    }
+
+    sOffset += p - start;
+    yy_hold_char = *p;
+    *p = 0;
+    yy_c_buf_p = p;
+}
+
+/*
+ * Whitespace and comments are a large part of many sources, and the
+ * DFA goes through them a byte at a time, so move past those in the
+ * flex buffer before scanning the next token.  Whitespace is a token
+ * inside a directive (and a newline ends one), so there only comments
+ * are skipped.  A comment that doesn't end within the buffer is left
+ * for the rules to scan.
+ */
+void SkipSpace() {
+    if (YY_START != INITIAL) return;
+    if (!sCurrentInputFile || sCurrentInputFile->fTokens) return;
+
+    char *start = yy_c_buf_p;
+    char *end = YY_CURRENT_BUFFER->yy_ch_buf + yy_n_chars;
+    const char *p = start;
+
+    // flex keeps a nul after the last token
+    *start = yy_hold_char;
+
+    while (p < end) {
+        const char *q;
+
+        if (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') {
+            if (sReturnWhitespace) break;
+
+            for(q=SkipBlocksOf(p+1, end, ' ', '\t', '\r', '\n');
+                q<end && (*q==' ' || *q=='\t' || *q=='\r' || *q=='\n'); ++q)
+                ;
+            p = q;
+        }
+        else if (*p == '/' && p+1 < end && p[1] == '/') {
+            for(q=SkipBlocksWithout(p+2, end, '\r', '\n');
+                q<end && *q!='\r' && *q!='\n'; ++q)
+                ;
+            if (q == end) break;
+            p = q;
+        }
+        else if (*p == '/' && p+1 < end && p[1] == '*') {
+            q = p+2;
+            while (1) {
+                for(q=SkipBlocksWithout(q, end, '*', '*'); q<end && *q!='*'; ++q)
+                    ;
+                if (q+1 >= end || q[1] == '/') break;
+                ++q;
+            }
+            if (q+1 >= end) break;
+            p = q+2;
+        }
+        else
+            break;
+    }
+
+    sOffset += p - start;
+    yy_hold_char = *p;
+    yy_c_buf_p = (char *)p;
+    *yy_c_buf_p = 0;
+}
+
+/*
+ * @return the first 16 byte block from p that has a byte other than a,
+ * b, c and d in it (or the last few bytes, which don't make a block)
+ */
+const char *SkipBlocksOf(const char *p, const char *end, char a, char b, char c, char d) {
+#if defined(LEX_SSE2)
+    const __m128i va = _mm_set1_epi8(a), vb = _mm_set1_epi8(b);
+    const __m128i vc = _mm_set1_epi8(c), vd = _mm_set1_epi8(d);
+
+    for (; end - p >= 16; p += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)p);
+        __m128i m = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(v, va), _mm_cmpeq_epi8(v, vb)),
+            _mm_or_si128(_mm_cmpeq_epi8(v, vc), _mm_cmpeq_epi8(v, vd)));
+        if (_mm_movemask_epi8(m) != 0xffff) break;
+    }
+#elif defined(LEX_NEON)
+    const uint8x16_t va = vdupq_n_u8(a), vb = vdupq_n_u8(b);
+    const uint8x16_t vc = vdupq_n_u8(c), vd = vdupq_n_u8(d);
+
+    for (; end - p >= 16; p += 16) {
+        uint8x16_t v = vld1q_u8((const uint8_t *)p);
+        uint8x16_t m = vorrq_u8(vorrq_u8(vceqq_u8(v, va), vceqq_u8(v, vb)),
+            vorrq_u8(vceqq_u8(v, vc), vceqq_u8(v, vd)));
+        uint8x8_t all = vand_u8(vget_low_u8(m), vget_high_u8(m));
+        if (vget_lane_u64(vreinterpret_u64_u8(all), 0) != ~(uint64_t)0) break;
+    }
+#elif defined(LEX_WASM_SIMD)
+    const v128_t va = wasm_i8x16_splat(a), vb = wasm_i8x16_splat(b);
+    const v128_t vc = wasm_i8x16_splat(c), vd = wasm_i8x16_splat(d);
+
+    for (; end - p >= 16; p += 16) {
+        v128_t v = wasm_v128_load(p);
+        v128_t m = wasm_v128_or(
+            wasm_v128_or(wasm_i8x16_eq(v, va), wasm_i8x16_eq(v, vb)),
+            wasm_v128_or(wasm_i8x16_eq(v, vc), wasm_i8x16_eq(v, vd)));
+        if (!wasm_i8x16_all_true(m)) break;
+    }
+#else
+    (void)end; (void)a; (void)b; (void)c; (void)d;
+#endif
+
+    return p;
+}
+
+/*
+ * @return the first 16 byte block from p that has a or b in it (or the
+ * last few bytes, which don't make a block)
+ */
+const char *SkipBlocksWithout(const char *p, const char *end, char a, char b) {
+#if defined(LEX_SSE2)
+    const __m128i va = _mm_set1_epi8(a), vb = _mm_set1_epi8(b);
+
+    for (; end - p >= 16; p += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)p);
+        if (_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, va), _mm_cmpeq_epi8(v, vb))))
+            break;
+    }
+#elif defined(LEX_NEON)
+    const uint8x16_t va = vdupq_n_u8(a), vb = vdupq_n_u8(b);
+
+    for (; end - p >= 16; p += 16) {
+        uint8x16_t v = vld1q_u8((const uint8_t *)p);
+        uint8x16_t m = vorrq_u8(vceqq_u8(v, va), vceqq_u8(v, vb));
+        uint8x8_t any = vorr_u8(vget_low_u8(m), vget_high_u8(m));
+        if (vget_lane_u64(vreinterpret_u64_u8(any), 0)) break;
+    }
+#elif defined(LEX_WASM_SIMD)
+    const v128_t va = wasm_i8x16_splat(a), vb = wasm_i8x16_splat(b);
+
+    for (; end - p >= 16; p += 16) {
+        v128_t v = wasm_v128_load(p);
+        if (wasm_v128_any_true(wasm_v128_or(wasm_i8x16_eq(v, va), wasm_i8x16_eq(v, vb))))
+            break;
+    }
+#else
+    (void)end; (void)a; (void)b;
+#endif
+
+    return p;
+}
+
+int LexGetFileDepth() {
+    return sTokenDepth;
+}
+
+int LexFindAndPushFile(const char *name) {
+    Buffer *b = Compiler::Get()->CreateBuffer(name);
+    if (!b) {
+        Error(kErr_FileOpen, name).RaiseLex();
+        return 0;
+    }
+
+    PrecompiledHeader *h = Compiler::Get()->CreatePrecompiled(name, b);
+    if (h) {
+        Compiler::Get()->AddPrecompiled(h);
+        return LexPushTokens(b, h);
+    }
+
+    return LexPush(b);
+}
+
+int LexPush(Buffer *b) {
+    return LexPushFrom(b, 0);
+}
+
+int LexPushFrom(Buffer *b, long start) {
+    InputFile *inputFile;
+    int index;
+
+    index = Compiler::Get()->AddBuffer(b);
+
+    // make sure max file depth and file count haven't been exceeded
+    if (sFileDepth == kMaxFileDepth || index > kMaxFileCount)
+        return 0;
+
+    // save line number and buffer in previous file
+    if (sCurrentInputFile && !sCurrentInputFile->fTokens) {
+        sCurrentInputFile->fSavedOffset = sOffset;
+        sCurrentInputFile->fBufferState = YY_CURRENT_BUFFER;
+    }
+
+    inputFile = (InputFile *)malloc(sizeof(InputFile));
+    inputFile->fBufferState = yy_create_buffer(0, YY_BUF_SIZE);
+    inputFile->fDataPtr = b->GetData() + start;
+    inputFile->fDataRemain = b->GetLength() - start;
+    inputFile->fSourceIndex = index;
+    inputFile->fTokens = 0;
+    inputFile->fTokenIndex = 0;
+
+    // link into list
+    inputFile->fNext = sCurrentInputFile;
+    sCurrentInputFile = inputFile;
+    sFileDepth++;
+    sTokenDepth = sFileDepth;
+
+    // switch to new buffer
+    sOffset = start;
+    sSourceIndex = index;
+    yy_switch_to_buffer(inputFile->fBufferState);
+
+    return 1;
+}
+
+int LexPushTokens(Buffer *b, const PrecompiledHeader *h) {
+    InputFile *inputFile;
+    int index;
+
+    index = Compiler::Get()->AddBuffer(b);
+
+    if (sFileDepth == kMaxFileDepth || index > kMaxFileCount)
+        return 0;
+
+    // the flex buffer of the previous file stays current, but nothing
+    // is scanned from it until the tokens have been played back
+    if (sCurrentInputFile && !sCurrentInputFile->fTokens) {
+        sCurrentInputFile->fSavedOffset = sOffset;
+        sCurrentInputFile->fBufferState = YY_CURRENT_BUFFER;
+    }
+
+    inputFile = (InputFile *)malloc(sizeof(InputFile));
+    inputFile->fBufferState = 0;
+    inputFile->fDataPtr = 0;
+    inputFile->fDataRemain = 0;
+    inputFile->fSourceIndex = index;
+    inputFile->fTokens = h;
+    inputFile->fTokenIndex = 0;
+
+    inputFile->fNext = sCurrentInputFile;
+    sCurrentInputFile = inputFile;
+    sFileDepth++;
+    sTokenDepth = sFileDepth;
+
+    sSourceIndex = index;
+
+    return 1;
+}
+
+void PopTokens() {
+    InputFile *inputFile = sCurrentInputFile;
+
+    sCurrentInputFile = inputFile->fNext;
+    sFileDepth--;
+    free(inputFile);
+
+    if (!sCurrentInputFile) return;
+
+    sSourceIndex = sCurrentInputFile->fSourceIndex;
+    if (sCurrentInputFile->fTokens) return;
+
+    yy_switch_to_buffer(sCurrentInputFile->fBufferState);
+    sOffset = sCurrentInputFile->fSavedOffset;
+}
+
+int yywrap() {
+    InputFile *inputFile;
+
+    // check for unterminated comments
+    if (YY_START == COMMENT) {
+        Error(kErr_UnterminatedComment).RaiseLex();
+        BEGIN(INITIAL);
+    }
+
+    // if no input files, just return
+    if (sCurrentInputFile == 0) return 1;
+
+    // token playback doesn't own the current flex buffer
+    if (sCurrentInputFile->fTokens) {
+        PopTokens();
+        return sCurrentInputFile ? 0 : 1;
+    }
+
+    // pop an input file off the list
+    inputFile = sCurrentInputFile;
+    sCurrentInputFile = inputFile->fNext;
+    sFileDepth--;
+
+    // cleanup the input file
+    yy_delete_buffer(YY_CURRENT_BUFFER);
+    free(inputFile);
+
+    // if no more files, just return 1
+    if (!sCurrentInputFile) return 1;
+
+    // let LexGetToken() continue with the precompiled tokens
+    if (sCurrentInputFile->fTokens) {
+        sSourceIndex = sCurrentInputFile->fSourceIndex;
+        sResumeTokens = 1;
+        return 1;
+    }
+
+    // switch to next file
+    yy_switch_to_buffer(sCurrentInputFile->fBufferState);
+    sOffset = sCurrentInputFile->fSavedOffset;
+    sSourceIndex = sCurrentInputFile->fSourceIndex;
+
+    // tell yylex() to continue
+    return 0;
+}
+
+void LexReset() {
+    // yywrap() returns 1 early when returning to precompiled tokens
+    while (yywrap() == 0 || sCurrentInputFile)
+        ;
+    sResumeTokens = 0;
+    sSkipInactive = 0;
+
+    sTokens.clear();
+    sStrings.clear();
+    sTokenPos = 0;
+    sTokenLocValid = 0;
+
+    // a compile that stopped part way through a directive mustn't
+    // leave its state for the next one
+    BEGIN(INITIAL);
+    sInsideDirective = 0;
+    sReturnWhitespace = 0;
+    sFileDepth = 0;
+    sTokenDepth = 0;
+    sSourceIndex = 0;
+    sOffset = 0;
+}
+
+int FillBuffer(char *buf, int max_size) {
+    int result;
+    // if no files are pending, return 0 (EOF)
+    if (!sCurrentInputFile) return 0;
+
+    const char *src = sCurrentInputFile->fDataPtr;
+    int n = sCurrentInputFile->fDataRemain;
+    if (n > max_size) {
+        n = max_size;
+
+        // don't split a line continuation between two reads
+        if (n > 2 && src[n-1] == '\r' && src[n-2] == '\\')
+            n -= 2;
+        else if (n > 1 && src[n-1] == '\\')
+            n -= 1;
+    }
+
+    memcpy(buf, src, n);
+
+    // Buffers keep their line endings, and the rules treat CR and LF
+    // alike.  The exception is a continuation before a CR-LF, which is
+    // passed on as backslash, LF, space so that the LF doesn't end the
+    // line.  The length is unchanged, so token offsets still match the
+    // Buffer.
+    for(int i=0; i+2<n; ++i) {
+        if (buf[i] == '\\' && buf[i+1] == '\r' && buf[i+2] == '\n') {
+            buf[i+1] = '\n';
+            buf[i+2] = ' ';
+        }
+    }
+
+    sCurrentInputFile->fDataPtr += n;
+    sCurrentInputFile->fDataRemain -= n;
+
+    result = n;
+    return result;
+}
@@ -54,7 +54,7 @@ class LocationNode;
 	Stmt*		fStmt;
 	BlockStmt*	fBlock;
 	Symbol*		fSymbol;
-	char*		fString;
+	char*		fString;	// only from yylex(), see LexGetString()
 	Expr*		fExpr;
 	FunctionDef*	fFunction;
 	CallStmt*	fCall;
@@ -131,7 +131,7 @@ static LexLocation sSavedLoc;
 
 %token <fSymbol> ID
 %token <fInt> NUMBER ASSIGN ASSIGN2 TASKOP JUMP TASK SUB INCDEC
-%token <fString> STRING
+%token <fInt> STRING
 %token REL_GE REL_LE REL_EQ REL_NE
 
 %token PP_DEFINE PP_INCLUDE NL WS PP_ARG PP_UNKNOWN PP_IFDEF PP_IF PP_ELSE PP_ELIF PP_ENDIF PP_UNDEF
@@ -175,6 +175,8 @@ unit_list : unit_list unit
 unit :	INT var_list ';'		{ gProgram->AddGlobalDecls($2); }
 	|	loc fragment loc		{ $2->SetLocations($1, $3); }
 	|	loc subfragment loc		{ $2->SetLocations($1, $3); }
+	|	loc TASK ID '(' ')' ';'		{ delete $1; gProgram->DeclareFragment(true, $3); }
+	|	loc SUB ID '(' ')' ';'		{ delete $1; gProgram->DeclareFragment(false, $3); }
 	|	loc sub_head '{' stmt_list '}' loc	{ EndSubWithParams($2, $4, $1, $6); }
 	|	loc function_head '{' stmt_list '}' loc { EndFunction($2, $4, $1, $6); }
 	|	resource ';' { gProgram->AddResource($1); }
@@ -138,9 +138,43 @@ Expr *MakeBinaryExpr(Expr *lhs, int op, Expr *rhs)
 		// the normal binary expression case, which is an error
 	}
 
-	// xor handled by a transform (Swan target handles this elsewhere
+	// xor handled by a transform (Swan target handles this elsewhere)
 	if (op == '^')
 	{
+		if (gProgram->GetOptimize() >= Program::kBasicOptimize)
+		{
+			int v;
+
+			// a^-1 is just ~a, which is -1 - a
+			if (rhs->Evaluate(v) && v == -1)
+			{
+				delete rhs;
+				return new BinaryExpr(
+					new AtomExpr(kRCX_ConstantType, -1, lhs->GetLoc()),
+					'-',
+					lhs);
+			}
+			if (lhs->Evaluate(v) && v == -1)
+			{
+				delete lhs;
+				return new BinaryExpr(
+					new AtomExpr(kRCX_ConstantType, -1, rhs->GetLoc()),
+					'-',
+					rhs);
+			}
+
+			// a^b  ->  (a | b) - (a & b), since the bits a and b have in
+			// common are counted twice by the or
+			Expr *lhc = lhs->Clone(0);
+			Expr *rhc = rhs->Clone(0);
+
+			return new BinaryExpr(
+				new BinaryExpr(lhs, '|', rhs),
+				'-',
+				new BinaryExpr(lhc, '&', rhc)
+			);
+		}
+
 		// a^b  ->  (-1 - (a&b)) & (a | b)
 		Expr *lhc = lhs->Clone(0);
 		Expr *rhc = rhs->Clone(0);
@@ -227,7 +261,7 @@ int VarCodeToChar(int op)
 Stmt *MakeAssignStmt(Expr *lhs, int op, Expr *rhs)
 {
     const RCX_Target *t = gProgram->GetTarget();
-    if ((t->fType != kRCX_SwanTarget) && (lhs->GetLValue()==kIllegalVar))
+    if (!t->fHasExtendedMathOps && (lhs->GetLValue()==kIllegalVar))
     {
       switch((RCX_VarCode)op)
       {
@@ -248,7 +282,7 @@ Stmt *MakeAssignStmt(Expr *lhs, int op, Expr *rhs)
 Stmt *MakeAssign2Stmt(Expr *lhs, int op, Expr *rhs)
 {
         const RCX_Target *t = gProgram->GetTarget();
-        if (t->fType == kRCX_SwanTarget)
+        if (t->fHasExtendedMathOps)
         {
           // Swan has opcodes for %=, ^=, <<=, and >>=
           RCX_VarCode code;
@@ -35,6 +35,7 @@ class LocationNode;
 #ifndef __PARSE_TAB_H
 #include "parse.tab.h"
 int	yylex(YYSTYPE &tokenVal);
+int LexGetToken(YYSTYPE &tokenVal);
 #endif
 
 #ifndef _STDIO_H
@@ -48,10 +49,21 @@ int yyparse(void);
 #include "LexLocation.h"
 #endif
 
+class PrecompiledHeader;
+
 void LexCurrentLocation(LexLocation &loc);
 int LexFindAndPushFile(const char *name);
 int LexPush(Buffer *buf);
+// lex buf from offset start on, as if the text before it wasn't there
+int LexPushFrom(Buffer *buf, long start);
+int LexPushTokens(Buffer *buf, const PrecompiledHeader *h);
+// the text of a STRING token; LexGetToken() gives STRING tokens an
+// offset for this rather than a pointer, and the text only moves when
+// more strings are read
+const char *LexGetString(int offset);
 void LexReturnWhitespace(int mode);
+void LexSkipInactive(int skip);
+int LexGetFileDepth();
 void LexReset();
 
 #endif
@@ -0,0 +1,399 @@
+static const  char rcx1_nqh[]={
+47,42,'\n',32,42,32,114,99,120,46,110,113,104,32,45,32,
+118,101,114,115,105,111,110,32,50,46,48,'\n',32,42,32,67,
+111,112,121,114,105,103,104,116,32,40,67,41,32,49,57,57,
+56,44,49,57,57,57,32,68,97,118,101,32,66,97,117,109,
+'\n',32,42,'\n',32,42,32,67,121,98,101,114,77,97,115,116,
+101,114,32,100,101,102,105,110,105,116,105,111,110,115,32,98,
+121,32,76,97,117,114,101,110,116,105,110,111,32,77,97,114,
+116,105,110,115,'\n',32,42,'\n',32,42,32,84,104,105,115,32,
+102,105,108,101,32,105,115,32,112,97,114,116,32,111,102,32,
+110,113,99,44,32,116,104,101,32,78,111,116,32,81,117,105,
+116,101,32,67,32,99,111,109,112,105,108,101,114,32,102,111,
+114,32,116,104,101,32,82,67,88,'\n',32,42,'\n',32,42,32,
+84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,
+32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,
+32,116,111,32,116,104,101,32,116,101,114,109,115,32,111,102,
+32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,
+108,105,99,'\n',32,42,32,76,105,99,101,110,115,101,44,32,
+118,46,32,50,46,48,46,32,73,102,32,97,32,99,111,112,
+121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,
+32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,
+32,119,105,116,104,32,116,104,105,115,'\n',32,42,32,102,105,
+108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,
+105,110,32,111,110,101,32,97,116,32,104,116,116,112,58,47,
+47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,
+47,50,46,48,47,46,'\n',32,42,'\n',32,42,32,84,104,101,
+32,73,110,105,116,105,97,108,32,68,101,118,101,108,111,112,
+101,114,32,111,102,32,116,104,105,115,32,99,111,100,101,32,
+105,115,32,68,97,118,105,100,32,66,97,117,109,46,'\n',32,
+42,32,80,111,114,116,105,111,110,115,32,99,114,101,97,116,
+101,100,32,98,121,32,68,97,118,105,100,32,66,97,117,109,
+32,97,114,101,32,67,111,112,121,114,105,103,104,116,32,40,
+67,41,32,49,57,57,56,32,68,97,118,105,100,32,66,97,
+117,109,46,'\n',32,42,32,65,108,108,32,82,105,103,104,116,
+115,32,82,101,115,101,114,118,101,100,46,'\n',32,42,'\n',32,
+42,32,80,111,114,116,105,111,110,115,32,99,114,101,97,116,
+101,100,32,98,121,32,74,111,104,110,32,72,97,110,115,101,
+110,32,97,114,101,32,67,111,112,121,114,105,103,104,116,32,
+40,67,41,32,50,48,48,53,32,74,111,104,110,32,72,97,
+110,115,101,110,46,'\n',32,42,32,65,108,108,32,82,105,103,
+104,116,115,32,82,101,115,101,114,118,101,100,46,'\n',32,42,
+'\n',32,42,47,'\n','\n',47,42,'\n',32,42,32,32,84,104,105,
+115,32,102,105,108,101,32,100,101,102,105,110,101,115,32,118,
+97,114,105,111,117,115,32,115,121,115,116,101,109,32,99,111,
+110,115,116,97,110,116,115,32,97,110,100,32,109,97,99,114,
+111,115,32,116,111,32,98,101,32,117,115,101,100,'\n',32,42,
+32,32,119,105,116,104,32,116,104,101,32,82,67,88,46,32,
+32,77,111,115,116,32,111,102,32,116,104,101,32,114,101,97,
+108,32,102,117,110,99,116,105,111,110,97,108,105,116,121,32,
+111,102,32,116,104,101,32,82,67,88,32,105,115,'\n',32,42,
+32,32,100,101,102,105,110,101,100,32,104,101,114,101,32,114,
+97,116,104,101,114,32,116,104,97,110,32,119,105,116,104,105,
+110,32,110,113,99,99,32,105,116,115,101,108,102,46,'\n',32,
+42,'\n',32,42,47,'\n','\n','\n',47,47,32,116,104,105,115,32,
+105,115,32,97,32,99,111,112,121,32,111,102,32,116,104,101,
+32,78,81,67,32,49,46,51,32,114,99,120,46,110,113,104,
+32,102,105,108,101,'\n','\n',47,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,'\n',32,42,32,105,110,112,117,116,'\n',32,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,47,'\n','\n',47,47,32,99,111,110,
+115,116,97,110,116,115,32,102,111,114,32,115,101,108,101,99,
+116,105,110,103,32,115,101,110,115,111,114,115,'\n',35,100,101,
+102,105,110,101,32,73,78,95,49,32,32,32,32,73,110,112,
+117,116,40,48,41,'\n',35,100,101,102,105,110,101,32,73,78,
+95,50,32,32,32,32,73,110,112,117,116,40,49,41,'\n',35,
+100,101,102,105,110,101,32,73,78,95,51,32,32,32,32,73,
+110,112,117,116,40,50,41,'\n','\n',35,105,102,100,101,102,32,
+95,95,67,77,'\n',47,47,32,97,108,116,101,114,110,97,116,
+105,118,101,32,110,97,109,101,115,32,102,111,114,32,105,110,
+112,117,116,32,115,101,110,115,111,114,115,'\n',35,100,101,102,
+105,110,101,32,73,78,95,76,32,73,78,95,49,32,47,47,
+32,76,101,102,116,32,115,101,110,115,111,114,'\n',35,100,101,
+102,105,110,101,32,73,78,95,77,32,73,78,95,50,32,47,
+47,32,77,105,100,100,108,101,32,115,101,110,115,111,114,'\n',
+35,100,101,102,105,110,101,32,73,78,95,82,32,73,78,95,
+51,32,47,47,32,82,105,103,104,116,32,115,101,110,115,111,
+114,'\n',35,101,110,100,105,102,'\n','\n',47,47,32,109,111,100,
+101,115,32,102,111,114,32,83,101,110,115,111,114,77,111,100,
+101,40,41,32,97,110,100,32,73,78,95,67,70,71,40,41,
+'\n',35,100,101,102,105,110,101,32,83,77,79,68,69,95,82,
+65,87,32,32,32,32,32,32,32,48,120,48,48,'\n',35,100,
+101,102,105,110,101,32,83,77,79,68,69,95,66,79,79,76,
+32,32,32,32,32,32,48,120,50,48,'\n',35,100,101,102,105,
+110,101,32,83,77,79,68,69,95,69,68,71,69,32,32,32,
+32,32,32,48,120,52,48,'\n',35,100,101,102,105,110,101,32,
+83,77,79,68,69,95,80,85,76,83,69,32,32,32,32,32,
+48,120,54,48,'\n',35,100,101,102,105,110,101,32,83,77,79,
+68,69,95,80,69,82,67,69,78,84,32,32,32,48,120,56,
+48,'\n',35,105,102,100,101,102,32,95,95,82,67,88,'\n',35,
+100,101,102,105,110,101,32,83,77,79,68,69,95,67,69,76,
+83,73,85,83,32,32,32,48,120,97,48,'\n',35,100,101,102,
+105,110,101,32,83,77,79,68,69,95,70,65,72,82,69,78,
+72,69,73,84,32,48,120,99,48,'\n',35,100,101,102,105,110,
+101,32,83,77,79,68,69,95,65,78,71,76,69,32,32,32,
+32,32,48,120,101,48,'\n',35,101,110,100,105,102,'\n','\n',35,
+100,101,102,105,110,101,32,83,101,110,115,111,114,77,111,100,
+101,40,115,101,110,115,111,114,44,32,109,111,100,101,41,32,
+32,32,32,97,115,109,32,123,32,48,120,52,50,44,32,36,
+115,101,110,115,111,114,32,58,32,48,120,48,51,48,48,48,
+50,48,48,44,32,40,109,111,100,101,41,32,125,'\n','\n',35,
+105,102,100,101,102,32,95,95,82,67,88,'\n',47,47,32,116,
+121,112,101,115,32,102,111,114,32,83,101,110,115,111,114,84,
+121,112,101,40,41,32,97,110,100,32,73,78,95,67,70,71,
+40,41,'\n',35,100,101,102,105,110,101,32,83,84,89,80,69,
+95,83,87,73,84,67,72,32,32,32,32,49,'\n',35,100,101,
+102,105,110,101,32,83,84,89,80,69,95,84,69,77,80,32,
+32,32,32,32,32,50,'\n',35,100,101,102,105,110,101,32,83,
+84,89,80,69,95,76,73,71,72,84,32,32,32,32,32,51,
+'\n',35,100,101,102,105,110,101,32,83,84,89,80,69,95,65,
+78,71,76,69,32,32,32,32,32,52,'\n','\n',47,47,32,105,
+110,112,117,116,32,99,111,110,102,105,103,117,114,97,116,105,
+111,110,115,32,45,32,117,115,101,100,32,105,110,32,99,97,
+108,108,115,32,116,111,32,83,101,110,115,111,114,40,41,'\n',
+35,100,101,102,105,110,101,32,73,78,95,67,70,71,40,116,
+121,112,101,44,109,111,100,101,41,32,32,32,40,40,40,116,
+121,112,101,41,60,60,56,41,32,43,32,40,109,111,100,101,
+41,41,'\n',35,100,101,102,105,110,101,32,73,78,95,83,87,
+73,84,67,72,32,32,32,73,78,95,67,70,71,40,83,84,
+89,80,69,95,83,87,73,84,67,72,44,32,83,77,79,68,
+69,95,66,79,79,76,41,'\n',35,100,101,102,105,110,101,32,
+73,78,95,80,85,76,83,69,32,32,32,32,73,78,95,67,
+70,71,40,83,84,89,80,69,95,83,87,73,84,67,72,44,
+32,83,77,79,68,69,95,80,85,76,83,69,41,'\n',35,100,
+101,102,105,110,101,32,73,78,95,69,68,71,69,32,32,32,
+32,32,73,78,95,67,70,71,40,83,84,89,80,69,95,83,
+87,73,84,67,72,44,32,83,77,79,68,69,95,69,68,71,
+69,41,'\n',35,100,101,102,105,110,101,32,73,78,95,76,73,
+71,72,84,32,32,32,32,73,78,95,67,70,71,40,83,84,
+89,80,69,95,76,73,71,72,84,44,32,32,83,77,79,68,
+69,95,80,69,82,67,69,78,84,41,'\n',35,100,101,102,105,
+110,101,32,73,78,95,65,78,71,76,69,32,32,32,32,73,
+78,95,67,70,71,40,83,84,89,80,69,95,65,78,71,76,
+69,44,32,32,83,77,79,68,69,95,65,78,71,76,69,41,
+'\n','\n',47,47,32,115,101,116,32,97,32,115,101,110,115,111,
+114,39,115,32,116,121,112,101,'\n',35,100,101,102,105,110,101,
+32,83,101,110,115,111,114,84,121,112,101,40,115,101,110,115,
+111,114,44,32,116,121,112,101,41,32,32,32,32,97,115,109,
+32,123,32,48,120,51,50,44,32,36,115,101,110,115,111,114,
+32,58,32,48,120,48,51,48,48,48,50,48,48,44,32,40,
+116,121,112,101,41,32,125,'\n','\n',47,47,32,115,101,116,32,
+97,32,115,101,110,115,111,114,39,115,32,116,121,112,101,32,
+97,110,100,32,109,111,100,101,32,117,115,105,110,103,32,97,
+32,99,111,110,102,105,103,32,45,32,101,46,103,46,32,83,
+101,110,115,111,114,40,73,78,95,49,44,32,73,78,95,76,
+73,71,72,84,41,59,'\n',35,100,101,102,105,110,101,32,83,
+101,110,115,111,114,40,115,101,110,115,111,114,44,32,116,109,
+41,32,32,100,111,32,123,32,83,101,110,115,111,114,84,121,
+112,101,40,115,101,110,115,111,114,44,32,116,109,62,62,56,
+41,59,32,92,'\n',32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,83,101,110,115,111,114,
+77,111,100,101,40,115,101,110,115,111,114,44,32,116,109,41,
+59,32,125,32,119,104,105,108,101,32,40,102,97,108,115,101,
+41,'\n','\n',35,101,110,100,105,102,'\n','\n','\n','\n',47,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,'\n',32,42,32,111,117,112,117,
+116,'\n',32,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,47,'\n','\n',
+47,47,32,99,111,110,115,116,97,110,116,115,32,102,111,114,
+32,115,101,108,101,99,116,105,110,103,32,111,117,116,112,117,
+116,115,'\n',35,100,101,102,105,110,101,32,79,85,84,95,65,
+32,32,32,40,49,32,60,60,32,48,41,'\n',35,100,101,102,
+105,110,101,32,79,85,84,95,66,32,32,32,40,49,32,60,
+60,32,49,41,'\n',35,100,101,102,105,110,101,32,79,85,84,
+95,67,32,32,32,40,49,32,60,60,32,50,41,'\n','\n',47,
+47,32,111,117,116,112,117,116,32,109,111,100,101,115,'\n',35,
+100,101,102,105,110,101,32,79,85,84,95,70,76,79,65,84,
+32,32,32,48,'\n',35,100,101,102,105,110,101,32,79,85,84,
+95,79,70,70,32,32,32,32,32,48,120,52,48,'\n',35,100,
+101,102,105,110,101,32,79,85,84,95,79,78,32,32,32,32,
+32,32,48,120,56,48,'\n','\n',47,47,32,111,117,116,112,117,
+116,32,100,105,114,101,99,116,105,111,110,115,'\n',35,100,101,
+102,105,110,101,32,79,85,84,95,82,69,86,32,32,32,32,
+32,48,'\n',35,100,101,102,105,110,101,32,79,85,84,95,70,
+76,73,80,32,32,32,32,48,120,52,48,'\n',35,100,101,102,
+105,110,101,32,79,85,84,95,70,87,68,32,32,32,32,32,
+48,120,56,48,'\n','\n',47,47,32,115,112,101,101,100,115,'\n',
+35,100,101,102,105,110,101,32,79,85,84,95,76,79,87,32,
+32,32,32,32,49,'\n',35,100,101,102,105,110,101,32,79,85,
+84,95,72,65,76,70,32,32,32,32,52,'\n',35,100,101,102,
+105,110,101,32,79,85,84,95,70,85,76,76,32,32,32,32,
+55,'\n','\n',47,47,32,111,117,116,112,117,116,32,102,117,110,
+99,116,105,111,110,115,'\n',35,100,101,102,105,110,101,32,79,
+117,116,112,117,116,77,111,100,101,40,111,44,32,109,41,32,
+32,32,32,97,115,109,32,123,32,48,120,50,49,44,32,40,
+111,41,32,43,32,40,109,41,32,125,'\n',35,100,101,102,105,
+110,101,32,79,117,116,112,117,116,68,105,114,40,111,44,32,
+100,41,32,32,32,32,32,97,115,109,32,123,32,48,120,101,
+49,44,32,40,111,41,32,43,32,40,100,41,32,125,'\n',35,
+100,101,102,105,110,101,32,79,117,116,112,117,116,80,111,119,
+101,114,40,111,44,32,112,41,32,32,32,97,115,109,32,123,
+32,48,120,49,51,44,32,40,111,41,44,32,36,112,32,58,
+32,48,120,49,48,48,48,48,49,53,125,'\n','\n',35,100,101,
+102,105,110,101,32,70,119,100,40,111,44,32,112,41,32,32,
+32,100,111,32,123,32,32,32,32,79,117,116,112,117,116,68,
+105,114,40,111,44,79,85,84,95,70,87,68,41,59,32,92,
+'\n',32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,79,117,116,
+112,117,116,77,111,100,101,40,111,44,79,85,84,95,79,78,
+41,59,32,92,'\n',32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,79,117,116,112,117,116,80,111,119,101,114,40,111,44,112,
+41,59,32,125,32,119,104,105,108,101,40,102,97,108,115,101,
+41,'\n','\n',35,100,101,102,105,110,101,32,82,101,118,40,111,
+44,32,112,41,32,32,32,100,111,32,123,32,32,32,32,79,
+117,116,112,117,116,68,105,114,40,111,44,79,85,84,95,82,
+69,86,41,59,32,92,'\n',32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,79,117,116,112,117,116,77,111,100,101,40,111,44,
+79,85,84,95,79,78,41,59,32,92,'\n',32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,79,117,116,112,117,116,80,111,119,
+101,114,40,111,44,112,41,59,32,125,32,119,104,105,108,101,
+40,102,97,108,115,101,41,'\n','\n',35,100,101,102,105,110,101,
+32,79,102,102,40,111,41,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,79,117,116,112,117,116,77,111,100,101,40,
+111,44,32,79,85,84,95,79,70,70,41,'\n',35,100,101,102,
+105,110,101,32,70,108,111,97,116,40,111,41,32,32,32,32,
+32,32,32,32,32,32,32,32,79,117,116,112,117,116,77,111,
+100,101,40,111,44,32,79,85,84,95,70,76,79,65,84,41,
+'\n',35,100,101,102,105,110,101,32,84,111,103,103,108,101,40,
+111,41,32,32,32,32,32,32,32,32,32,32,32,79,117,116,
+112,117,116,68,105,114,40,40,111,41,44,32,79,85,84,95,
+70,76,73,80,41,'\n','\n','\n',47,47,32,67,121,98,101,114,
+77,97,115,116,101,114,32,115,112,101,99,105,102,105,99,32,
+115,116,117,102,102,'\n',35,105,102,100,101,102,32,95,95,67,
+77,'\n',47,47,32,97,108,116,101,114,110,97,116,101,32,110,
+97,109,101,115,32,102,111,114,32,109,111,116,111,114,115,'\n',
+35,100,101,102,105,110,101,32,79,85,84,95,76,32,79,85,
+84,95,65,32,47,47,32,76,101,102,116,32,109,111,116,111,
+114,'\n',35,100,101,102,105,110,101,32,79,85,84,95,82,32,
+79,85,84,95,66,32,47,47,32,82,105,103,104,116,32,109,
+111,116,111,114,'\n',35,100,101,102,105,110,101,32,79,85,84,
+95,88,32,79,85,84,95,67,32,47,47,32,69,120,116,101,
+114,110,97,108,32,109,111,116,111,114,'\n','\n',35,100,101,102,
+105,110,101,32,68,114,105,118,101,40,109,48,44,32,109,49,
+41,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,97,115,109,32,123,32,48,120,52,49,
+44,32,68,73,82,83,80,69,69,68,40,109,48,41,32,124,
+32,68,73,82,83,80,69,69,68,40,109,49,41,60,60,52,
+32,125,'\n',35,100,101,102,105,110,101,32,79,110,87,97,105,
+116,40,109,44,32,110,44,32,116,41,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,97,115,109,
+32,123,32,48,120,99,50,44,32,40,109,41,60,60,52,32,
+124,32,68,73,82,83,80,69,69,68,40,110,41,44,32,116,
+32,125,'\n',35,100,101,102,105,110,101,32,79,110,87,97,105,
+116,68,105,102,102,101,114,101,110,116,40,109,44,32,110,48,
+44,32,110,49,44,32,110,50,44,32,116,41,32,97,115,109,
+32,123,32,48,120,53,51,44,32,40,109,41,60,60,52,32,
+124,32,68,73,82,83,80,69,69,68,40,110,48,41,44,32,
+68,73,82,83,80,69,69,68,40,110,49,41,60,60,52,32,
+124,32,68,73,82,83,80,69,69,68,40,110,50,41,44,32,
+116,32,125,'\n','\n',47,47,32,65,117,120,46,32,102,117,110,
+99,116,105,111,110,58,32,84,114,97,110,115,102,111,114,109,
+115,32,97,32,110,117,109,98,101,114,32,98,101,116,119,101,
+101,110,32,45,55,32,97,110,100,32,55,32,116,111,32,97,
+32,52,32,98,105,116,32,115,101,113,117,101,110,99,101,58,
+'\n',47,47,32,66,105,116,115,58,32,49,46,46,51,32,45,
+32,83,112,101,101,100,58,32,48,32,116,111,32,55,'\n',47,
+47,32,66,105,116,32,58,32,52,32,32,32,32,45,32,68,
+105,114,101,99,116,105,111,110,58,32,49,32,105,102,32,118,
+62,61,48,44,32,48,32,105,102,32,118,60,48,'\n',35,100,
+101,102,105,110,101,32,68,73,82,83,80,69,69,68,40,118,
+41,32,32,32,32,32,40,40,118,41,38,56,94,56,124,40,
+40,118,41,42,40,40,40,118,41,62,62,51,41,42,50,94,
+49,41,41,38,55,41,'\n','\n','\n',35,101,110,100,105,102,'\n',
+'\n','\n','\n',47,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,'\n',32,
+42,32,100,97,116,97,32,115,111,117,114,99,101,115,'\n',32,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,47,'\n','\n',35,100,101,
+102,105,110,101,32,84,105,109,101,114,40,110,41,32,32,32,
+32,32,32,32,32,64,40,48,120,49,48,48,48,48,32,43,
+32,40,110,41,41,'\n',35,100,101,102,105,110,101,32,82,97,
+110,100,111,109,40,110,41,32,32,32,32,32,32,32,64,40,
+48,120,52,48,48,48,48,32,43,32,40,110,41,41,'\n',35,
+100,101,102,105,110,101,32,73,110,112,117,116,40,110,41,32,
+32,32,32,32,32,32,32,64,40,48,120,57,48,48,48,48,
+32,43,32,40,110,41,41,'\n',35,100,101,102,105,110,101,32,
+73,110,112,117,116,84,121,112,101,40,110,41,32,32,32,32,
+64,40,48,120,97,48,48,48,48,32,43,32,40,110,41,41,
+'\n',35,100,101,102,105,110,101,32,73,110,112,117,116,77,111,
+100,101,40,110,41,32,32,32,32,64,40,48,120,98,48,48,
+48,48,32,43,32,40,110,41,41,'\n','\n',35,105,102,100,101,
+102,32,95,95,82,67,88,'\n',47,47,32,82,67,88,32,115,
+112,101,99,105,102,105,99,32,100,97,116,97,32,115,111,117,
+114,99,101,115,'\n',35,100,101,102,105,110,101,32,80,114,111,
+103,114,97,109,40,41,32,32,32,32,32,32,32,64,40,48,
+120,56,41,'\n',35,100,101,102,105,110,101,32,73,110,112,117,
+116,82,97,119,40,110,41,32,32,32,32,32,64,40,48,120,
+99,48,48,48,48,32,43,32,40,110,41,41,'\n',35,100,101,
+102,105,110,101,32,73,110,112,117,116,66,111,111,108,40,110,
+41,32,32,32,32,64,40,48,120,100,48,48,48,48,32,43,
+32,40,110,41,41,'\n',35,100,101,102,105,110,101,32,87,97,
+116,99,104,40,41,32,32,32,32,32,32,32,32,32,64,40,
+48,120,101,48,48,48,48,41,'\n',35,100,101,102,105,110,101,
+32,77,101,115,115,97,103,101,40,41,32,32,32,32,32,32,
+32,64,40,48,120,102,48,48,48,48,41,'\n',35,101,110,100,
+105,102,'\n','\n',35,105,102,100,101,102,32,95,95,67,77,'\n',
+47,47,32,67,77,32,115,112,101,99,105,102,105,99,32,100,
+97,116,97,32,115,111,117,114,99,101,115,'\n',35,100,101,102,
+105,110,101,32,84,97,99,104,111,67,111,117,110,116,40,110,
+41,32,32,32,32,32,32,32,32,32,32,64,40,48,120,53,
+48,48,48,48,32,43,32,40,110,41,45,49,41,32,47,47,
+32,85,115,101,32,79,85,84,95,120,32,97,115,32,112,97,
+114,97,109,101,116,101,114,'\n',35,100,101,102,105,110,101,32,
+84,97,99,104,111,83,112,101,101,100,40,110,41,32,32,32,
+32,32,32,32,32,32,32,64,40,48,120,54,48,48,48,48,
+32,43,32,40,110,41,45,49,41,32,47,47,32,85,115,101,
+32,79,85,84,95,120,32,97,115,32,112,97,114,97,109,101,
+116,101,114,'\n',35,100,101,102,105,110,101,32,69,120,116,101,
+114,110,97,108,77,111,116,111,114,82,117,110,110,105,110,103,
+40,41,32,64,40,48,120,55,48,48,48,50,41,32,32,32,
+32,32,32,32,32,32,47,47,32,82,101,102,101,114,101,100,
+32,105,110,32,116,104,101,32,83,68,75,32,97,115,32,77,
+111,116,111,114,67,117,114,114,101,110,116,40,50,41,46,32,
+78,111,110,32,122,101,114,111,32,105,102,32,101,120,116,101,
+114,110,97,108,32,109,111,116,111,114,32,114,117,110,110,105,
+110,103,46,'\n',35,100,101,102,105,110,101,32,65,71,67,40,
+41,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,64,40,48,120,49,48,48,48,48,48,41,32,32,
+32,32,32,32,32,32,47,47,32,65,117,116,111,109,97,116,
+105,99,32,71,97,105,110,32,67,111,110,116,114,111,108,'\n',
+35,101,110,100,105,102,'\n','\n','\n',47,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,'\n',32,42,32,109,105,115,99,101,108,108,97,
+110,101,111,117,115,'\n',32,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,47,'\n','\n',47,47,32,119,97,105,116,32,102,111,114,32,
+97,32,99,111,110,100,105,116,105,111,110,32,116,111,32,98,
+101,99,111,109,101,32,116,114,117,101,'\n',35,100,101,102,105,
+110,101,32,119,97,105,116,40,99,41,32,32,32,32,32,119,
+104,105,108,101,40,33,40,99,41,41,'\n','\n',47,47,32,112,
+108,97,121,105,110,103,32,115,111,117,110,100,115,32,97,110,
+100,32,110,111,116,101,115,'\n',35,100,101,102,105,110,101,32,
+80,108,97,121,83,111,117,110,100,40,120,41,32,32,32,32,
+32,32,32,32,97,115,109,32,123,32,48,120,53,49,44,32,
+120,32,125,'\n',35,100,101,102,105,110,101,32,80,108,97,121,
+78,111,116,101,40,102,44,32,100,41,32,32,32,32,32,32,
+97,115,109,32,123,32,48,120,50,51,44,32,40,102,41,44,
+32,40,102,41,62,62,56,44,32,40,100,41,32,125,'\n','\n',
+47,47,32,115,108,101,101,112,32,102,111,114,32,118,32,116,
+105,99,107,115,32,40,49,48,109,115,32,112,101,114,32,116,
+105,99,107,41,'\n',35,100,101,102,105,110,101,32,83,108,101,
+101,112,40,118,41,32,32,32,32,97,115,109,32,123,32,48,
+120,52,51,44,32,36,118,32,58,32,48,120,48,48,49,53,
+125,'\n','\n','\n',35,100,101,102,105,110,101,32,67,108,101,97,
+114,84,105,109,101,114,40,110,41,32,32,32,97,115,109,32,
+123,32,48,120,97,49,44,32,110,32,125,'\n',35,100,101,102,
+105,110,101,32,67,108,101,97,114,83,101,110,115,111,114,40,
+115,101,110,115,111,114,41,32,97,115,109,32,123,32,48,120,
+100,49,44,32,36,115,101,110,115,111,114,32,58,32,48,120,
+48,51,48,48,48,50,48,48,32,125,'\n','\n',35,100,101,102,
+105,110,101,32,83,116,111,112,65,108,108,84,97,115,107,115,
+40,41,32,32,97,115,109,32,123,32,48,120,53,48,32,125,
+'\n','\n',35,105,102,100,101,102,32,95,95,82,67,88,'\n',47,
+47,32,115,101,116,32,116,104,101,32,100,105,115,112,108,97,
+121,32,109,111,100,101,'\n',35,100,101,102,105,110,101,32,68,
+105,115,112,108,97,121,40,118,41,32,32,97,115,109,32,123,
+32,48,120,51,51,44,32,36,118,32,58,32,48,120,48,48,
+48,53,125,'\n','\n',47,47,32,73,82,32,109,101,115,115,97,
+103,101,32,115,117,112,112,111,114,116,'\n',35,100,101,102,105,
+110,101,32,83,101,110,100,77,101,115,115,97,103,101,40,118,
+41,32,32,97,115,109,32,123,32,48,120,98,50,44,32,36,
+118,32,58,32,48,120,49,48,48,48,48,48,53,32,125,'\n',
+35,100,101,102,105,110,101,32,67,108,101,97,114,77,101,115,
+115,97,103,101,40,41,32,32,97,115,109,32,123,32,48,120,
+57,48,32,125,'\n','\n',47,47,32,68,97,116,97,32,108,111,
+103,103,105,110,103,'\n',35,100,101,102,105,110,101,32,83,101,
+116,68,97,116,97,108,111,103,40,115,105,122,101,41,32,32,
+32,32,97,115,109,32,123,32,48,120,53,50,44,32,40,115,
+105,122,101,41,44,32,40,115,105,122,101,41,62,62,56,32,
+125,'\n',35,100,101,102,105,110,101,32,68,97,116,97,108,111,
+103,40,118,41,32,32,32,32,32,32,32,32,32,32,97,115,
+109,32,123,32,48,120,54,50,44,32,36,118,32,58,32,48,
+120,49,48,48,52,50,48,51,125,'\n',35,100,101,102,105,110,
+101,32,85,112,108,111,97,100,68,97,116,97,108,111,103,40,
+115,44,32,110,41,32,97,115,109,32,123,32,48,120,97,52,
+44,32,40,115,41,44,32,40,115,41,62,62,56,44,32,40,
+110,41,44,32,40,110,41,62,62,56,32,125,'\n','\n',47,47,
+32,115,101,116,32,116,104,101,32,115,121,115,116,101,109,32,
+99,108,111,99,107,'\n',35,100,101,102,105,110,101,32,83,101,
+116,87,97,116,99,104,40,104,44,32,109,41,32,32,32,32,
+32,32,97,115,109,32,123,32,48,120,50,50,44,32,40,104,
+41,44,32,40,109,41,32,125,'\n','\n',47,47,32,115,117,112,
+112,111,114,116,32,102,111,114,32,99,111,110,116,114,111,108,
+108,105,110,103,32,116,104,101,32,73,82,77,111,100,101,'\n',
+35,100,101,102,105,110,101,32,73,82,95,76,79,32,48,'\n',
+35,100,101,102,105,110,101,32,73,82,95,72,73,32,49,'\n',
+35,100,101,102,105,110,101,32,73,82,77,111,100,101,40,109,
+41,32,32,32,32,32,32,97,115,109,32,123,32,48,120,51,
+49,44,32,109,32,125,'\n',35,101,110,100,105,102,'\n','\n',35,
+105,102,100,101,102,32,95,95,67,77,'\n',35,100,101,102,105,
+110,101,32,67,108,101,97,114,84,97,99,104,111,67,111,117,
+110,116,101,114,40,109,41,32,97,115,109,32,123,32,48,120,
+49,49,44,32,40,109,41,32,125,'\n',35,101,110,100,105,102,
+'\n','\n',35,112,114,97,103,109,97,32,110,111,105,110,105,116,
+'\n',};
@@ -0,0 +1,4099 @@
+static const  char rcx2_nqh[]={
+47,42,'\n',32,42,32,114,99,120,46,110,113,104,32,45,32,
+118,101,114,115,105,111,110,32,51,46,49,114,53,'\n',32,42,
+32,67,111,112,121,114,105,103,104,116,32,40,67,41,32,49,
+57,57,56,45,50,48,48,53,32,68,97,118,101,32,66,97,
+117,109,44,32,74,111,104,110,32,72,97,110,115,101,110,'\n',
+32,42,'\n',32,42,32,67,121,98,101,114,77,97,115,116,101,
+114,32,100,101,102,105,110,105,116,105,111,110,115,32,98,121,
+32,76,97,117,114,101,110,116,105,110,111,32,77,97,114,116,
+105,110,115,'\n',32,42,32,83,112,121,98,111,116,32,100,101,
+102,105,110,105,116,105,111,110,115,32,98,121,32,74,111,104,
+110,32,72,97,110,115,101,110,'\n',32,42,32,83,119,97,110,
+32,100,101,102,105,110,105,116,105,111,110,115,32,98,121,32,
+74,111,104,110,32,72,97,110,115,101,110,'\n',32,42,'\n',32,
+42,32,84,104,105,115,32,102,105,108,101,32,105,115,32,112,
+97,114,116,32,111,102,32,110,113,99,44,32,116,104,101,32,
+78,111,116,32,81,117,105,116,101,32,67,32,99,111,109,112,
+105,108,101,114,32,102,111,114,32,116,104,101,32,82,67,88,
+'\n',32,42,'\n',32,42,32,84,104,105,115,32,83,111,117,114,
+99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,
+115,117,98,106,101,99,116,32,116,111,32,116,104,101,32,116,
+101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,
+108,108,97,32,80,117,98,108,105,99,'\n',32,42,32,76,105,
+99,101,110,115,101,44,32,118,46,32,50,46,48,46,32,73,
+102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,
+77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,
+114,105,98,117,116,101,100,32,119,105,116,104,32,116,104,105,
+115,'\n',32,42,32,102,105,108,101,44,32,89,111,117,32,99,
+97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,
+32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,
+111,114,103,47,77,80,76,47,50,46,48,47,46,'\n',32,42,
+'\n',32,42,32,84,104,101,32,73,110,105,116,105,97,108,32,
+68,101,118,101,108,111,112,101,114,32,111,102,32,116,104,105,
+115,32,99,111,100,101,32,105,115,32,68,97,118,105,100,32,
+66,97,117,109,46,'\n',32,42,32,80,111,114,116,105,111,110,
+115,32,99,114,101,97,116,101,100,32,98,121,32,68,97,118,
+105,100,32,66,97,117,109,32,97,114,101,32,67,111,112,121,
+114,105,103,104,116,32,40,67,41,32,49,57,57,56,32,68,
+97,118,105,100,32,66,97,117,109,46,'\n',32,42,32,65,108,
+108,32,82,105,103,104,116,115,32,82,101,115,101,114,118,101,
+100,46,'\n',32,42,'\n',32,42,32,80,111,114,116,105,111,110,
+115,32,99,114,101,97,116,101,100,32,98,121,32,74,111,104,
+110,32,72,97,110,115,101,110,32,97,114,101,32,67,111,112,
+121,114,105,103,104,116,32,40,67,41,32,50,48,48,53,32,
+74,111,104,110,32,72,97,110,115,101,110,46,'\n',32,42,32,
+65,108,108,32,82,105,103,104,116,115,32,82,101,115,101,114,
+118,101,100,46,'\n',32,42,'\n',32,42,47,'\n','\n',47,42,'\n',
+32,42,32,32,84,104,105,115,32,102,105,108,101,32,100,101,
+102,105,110,101,115,32,118,97,114,105,111,117,115,32,115,121,
+115,116,101,109,32,99,111,110,115,116,97,110,116,115,32,97,
+110,100,32,109,97,99,114,111,115,32,116,111,32,98,101,32,
+117,115,101,100,'\n',32,42,32,32,119,105,116,104,32,116,104,
+101,32,82,67,88,46,32,32,77,111,115,116,32,111,102,32,
+116,104,101,32,114,101,97,108,32,102,117,110,99,116,105,111,
+110,97,108,105,116,121,32,111,102,32,116,104,101,32,82,67,
+88,32,105,115,'\n',32,42,32,32,100,101,102,105,110,101,100,
+32,104,101,114,101,32,114,97,116,104,101,114,32,116,104,97,
+110,32,119,105,116,104,105,110,32,110,113,99,99,32,105,116,
+115,101,108,102,46,'\n',32,42,'\n',32,42,47,'\n','\n','\n',47,
+47,32,105,110,116,101,114,110,97,108,32,99,111,110,115,116,
+97,110,116,115,32,102,111,114,32,97,115,109,32,115,116,97,
+116,101,109,101,110,116,115,'\n',35,100,101,102,105,110,101,32,
+95,95,65,83,77,95,83,77,65,76,76,95,86,65,76,85,
+69,32,32,32,48,120,48,49,48,48,48,48,48,48,'\n',35,
+100,101,102,105,110,101,32,95,95,65,83,77,95,78,79,95,
+84,89,80,69,32,32,32,32,32,32,32,48,120,48,50,48,
+48,48,48,48,48,'\n',35,100,101,102,105,110,101,32,95,95,
+65,83,77,95,78,79,95,76,79,67,65,76,32,32,32,32,
+32,32,48,120,48,52,48,48,48,48,48,48,'\n','\n','\n',47,
+47,32,99,111,109,109,111,110,108,121,32,117,115,101,100,32,
+114,101,115,116,114,105,99,116,111,114,115,'\n',35,105,102,32,
+95,95,82,67,88,61,61,50,32,124,124,32,100,101,102,105,
+110,101,100,40,95,95,83,80,89,41,32,124,124,32,100,101,
+102,105,110,101,100,40,95,95,83,87,65,78,41,'\n',32,32,
+32,32,47,47,32,110,111,32,114,101,115,116,114,105,99,116,
+105,111,110,'\n',32,32,32,32,35,100,101,102,105,110,101,32,
+95,95,65,83,77,95,83,82,67,95,66,65,83,73,67,32,
+48,'\n',32,32,32,32,35,100,101,102,105,110,101,32,95,95,
+65,83,77,95,83,82,67,95,69,88,84,32,32,32,48,'\n',
+35,101,108,115,101,'\n',32,32,32,32,35,100,101,102,105,110,
+101,32,95,95,65,83,77,95,83,82,67,95,66,65,83,73,
+67,32,48,120,48,48,48,48,48,53,32,32,32,32,47,47,
+32,99,111,110,115,116,97,110,116,32,111,114,32,118,97,114,
+105,97,98,108,101,'\n',32,32,32,32,35,100,101,102,105,110,
+101,32,95,95,65,83,77,95,83,82,67,95,69,88,84,32,
+32,32,48,120,48,48,48,48,49,53,32,32,32,32,47,47,
+32,99,111,110,115,116,97,110,116,44,32,118,97,114,105,97,
+98,108,101,44,32,111,114,32,114,97,110,100,111,109,'\n',35,
+101,110,100,105,102,'\n','\n','\n','\n',47,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,'\n',32,42,32,115,101,110,115,111,114,115,'\n',
+32,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,47,'\n','\n',35,100,
+101,102,105,110,101,32,83,49,32,32,48,'\n',35,100,101,102,
+105,110,101,32,83,50,32,32,49,'\n',35,100,101,102,105,110,
+101,32,83,51,32,32,50,'\n','\n',47,47,32,114,101,97,100,
+105,110,103,32,97,32,115,101,110,115,111,114,39,115,32,118,
+97,108,117,101,32,97,110,100,32,116,121,112,101,'\n',35,100,
+101,102,105,110,101,32,83,101,110,115,111,114,86,97,108,117,
+101,40,110,41,32,32,32,32,32,32,64,40,48,120,57,48,
+48,48,48,32,43,32,40,95,95,115,101,110,115,111,114,40,
+110,41,41,41,'\n','\n','\n',35,105,102,110,100,101,102,32,95,
+95,83,80,89,'\n',32,32,32,32,35,100,101,102,105,110,101,
+32,83,101,110,115,111,114,84,121,112,101,40,110,41,32,32,
+32,64,40,48,120,97,48,48,48,48,32,43,32,40,95,95,
+115,101,110,115,111,114,40,110,41,41,41,'\n',35,101,110,100,
+105,102,'\n','\n','\n',47,47,32,99,111,110,115,116,97,110,116,
+115,32,102,111,114,32,115,101,108,101,99,116,105,110,103,32,
+115,101,110,115,111,114,115,32,45,32,97,108,115,111,32,97,
+32,115,104,111,114,116,104,97,110,100,32,116,111,32,114,101,
+97,100,32,116,104,101,32,115,101,110,115,111,114,39,115,32,
+118,97,108,117,101,'\n',35,100,101,102,105,110,101,32,83,69,
+78,83,79,82,95,49,32,32,32,32,83,101,110,115,111,114,
+86,97,108,117,101,40,83,49,41,'\n',35,100,101,102,105,110,
+101,32,83,69,78,83,79,82,95,50,32,32,32,32,83,101,
+110,115,111,114,86,97,108,117,101,40,83,50,41,'\n',35,100,
+101,102,105,110,101,32,83,69,78,83,79,82,95,51,32,32,
+32,32,83,101,110,115,111,114,86,97,108,117,101,40,83,51,
+41,'\n','\n','\n',95,95,110,111,108,105,115,116,32,118,111,105,
+100,32,67,108,101,97,114,83,101,110,115,111,114,40,95,95,
+115,101,110,115,111,114,32,115,101,110,115,111,114,41,32,123,
+32,97,115,109,32,123,32,48,120,100,49,44,32,36,115,101,
+110,115,111,114,32,58,32,48,120,48,51,48,48,48,50,48,
+48,125,59,32,125,'\n','\n','\n',35,105,102,100,101,102,32,95,
+95,67,77,'\n',32,32,32,32,47,47,32,67,77,32,104,97,
+115,32,97,108,116,101,114,110,97,116,105,118,101,32,110,97,
+109,101,115,32,102,111,114,32,115,101,110,115,111,114,115,'\n',
+32,32,32,32,35,100,101,102,105,110,101,32,83,69,78,83,
+79,82,95,76,32,83,69,78,83,79,82,95,49,32,47,47,
+32,76,101,102,116,32,115,101,110,115,111,114,'\n',32,32,32,
+32,35,100,101,102,105,110,101,32,83,69,78,83,79,82,95,
+77,32,83,69,78,83,79,82,95,50,32,47,47,32,77,105,
+100,100,108,101,32,115,101,110,115,111,114,'\n',32,32,32,32,
+35,100,101,102,105,110,101,32,83,69,78,83,79,82,95,82,
+32,83,69,78,83,79,82,95,51,32,47,47,32,82,105,103,
+104,116,32,115,101,110,115,111,114,'\n',35,101,110,100,105,102,
+'\n','\n','\n',35,105,102,32,100,101,102,105,110,101,100,40,95,
+95,82,67,88,41,32,124,124,32,100,101,102,105,110,101,100,
+40,95,95,67,77,41,32,124,124,32,100,101,102,105,110,101,
+100,40,95,95,83,87,65,78,41,'\n',32,32,32,32,47,47,
+32,82,67,88,32,97,110,100,32,67,77,32,115,117,112,112,
+111,114,116,32,115,101,110,115,111,114,32,109,111,100,101,115,
+'\n',32,32,32,32,35,100,101,102,105,110,101,32,83,69,78,
+83,79,82,95,77,79,68,69,95,82,65,87,32,32,32,32,
+32,32,32,32,32,32,32,32,32,48,120,48,48,'\n',32,32,
+32,32,35,100,101,102,105,110,101,32,83,69,78,83,79,82,
+95,77,79,68,69,95,66,79,79,76,32,32,32,32,32,32,
+32,32,32,32,32,32,48,120,50,48,'\n',32,32,32,32,35,
+100,101,102,105,110,101,32,83,69,78,83,79,82,95,77,79,
+68,69,95,69,68,71,69,32,32,32,32,32,32,32,32,32,
+32,32,32,48,120,52,48,'\n',32,32,32,32,35,100,101,102,
+105,110,101,32,83,69,78,83,79,82,95,77,79,68,69,95,
+80,85,76,83,69,32,32,32,32,32,32,32,32,32,32,32,
+48,120,54,48,'\n',32,32,32,32,35,100,101,102,105,110,101,
+32,83,69,78,83,79,82,95,77,79,68,69,95,80,69,82,
+67,69,78,84,32,32,32,32,32,32,32,32,32,48,120,56,
+48,'\n',32,32,32,32,35,105,102,32,100,101,102,105,110,101,
+100,40,95,95,82,67,88,41,32,124,124,32,100,101,102,105,
+110,101,100,40,95,95,83,87,65,78,41,'\n',32,32,32,32,
+32,32,32,32,47,47,32,82,67,88,32,104,97,115,32,115,
+111,109,101,32,101,120,116,114,97,32,109,111,100,101,115,'\n',
+32,32,32,32,32,32,32,32,35,100,101,102,105,110,101,32,
+83,69,78,83,79,82,95,77,79,68,69,95,67,69,76,83,
+73,85,83,32,32,32,32,32,48,120,97,48,'\n',32,32,32,
+32,32,32,32,32,35,100,101,102,105,110,101,32,83,69,78,
+83,79,82,95,77,79,68,69,95,70,65,72,82,69,78,72,
+69,73,84,32,32,48,120,99,48,'\n',32,32,32,32,32,32,
+32,32,35,100,101,102,105,110,101,32,83,69,78,83,79,82,
+95,77,79,68,69,95,82,79,84,65,84,73,79,78,32,32,
+32,32,48,120,101,48,'\n',32,32,32,32,35,101,110,100,105,
+102,32,47,47,32,95,95,82,67,88,32,111,114,32,95,95,
+83,87,65,78,'\n','\n','\n',32,32,32,32,35,100,101,102,105,
+110,101,32,83,101,110,115,111,114,77,111,100,101,40,110,41,
+32,32,32,32,32,32,32,64,40,48,120,98,48,48,48,48,
+32,43,32,40,95,95,115,101,110,115,111,114,40,110,41,41,
+41,32,32,47,47,32,114,101,97,100,32,116,104,101,32,115,
+101,110,115,111,114,32,109,111,100,101,'\n','\n','\n',32,32,32,
+32,95,95,110,111,108,105,115,116,32,118,111,105,100,32,83,
+101,116,83,101,110,115,111,114,77,111,100,101,40,95,95,115,
+101,110,115,111,114,32,115,101,110,115,111,114,44,32,99,111,
+110,115,116,32,105,110,116,32,109,111,100,101,41,32,123,32,
+97,115,109,32,123,32,48,120,52,50,44,32,36,115,101,110,
+115,111,114,32,58,32,48,120,48,51,48,48,48,50,48,48,
+44,32,109,111,100,101,32,125,59,32,125,'\n',35,101,110,100,
+105,102,32,47,47,32,100,101,102,105,110,101,100,40,95,95,
+82,67,88,41,32,124,124,32,100,101,102,105,110,101,100,40,
+95,95,67,77,41,32,124,124,32,100,101,102,105,110,101,100,
+40,95,95,83,87,65,78,41,'\n','\n','\n',35,105,102,32,100,
+101,102,105,110,101,100,40,95,95,83,80,89,41,'\n',32,32,
+32,32,47,47,32,83,80,89,32,100,111,101,115,110,39,116,
+32,115,104,105,102,116,32,116,104,101,32,109,111,100,101,32,
+111,118,101,114,32,53,32,98,105,116,115,32,105,110,32,83,
+101,110,115,111,114,77,111,100,101,40,41,44,'\n',32,32,32,
+32,47,47,32,115,111,32,99,111,110,115,116,97,110,116,115,
+32,97,114,101,32,100,105,102,102,101,114,101,110,116,32,102,
+114,111,109,32,82,67,88,'\n',32,32,32,32,35,100,101,102,
+105,110,101,32,83,69,78,83,79,82,95,77,79,68,69,95,
+82,65,87,32,32,32,32,32,48,120,48,48,'\n',32,32,32,
+32,35,100,101,102,105,110,101,32,83,69,78,83,79,82,95,
+77,79,68,69,95,66,79,79,76,32,32,32,32,48,120,48,
+49,'\n',32,32,32,32,35,100,101,102,105,110,101,32,83,69,
+78,83,79,82,95,77,79,68,69,95,80,69,82,67,69,78,
+84,32,48,120,48,52,'\n',32,32,32,32,35,100,101,102,105,
+110,101,32,83,101,110,115,111,114,77,111,100,101,40,110,41,
+32,32,32,32,32,32,32,64,40,48,120,98,48,48,48,48,
+32,43,32,40,95,95,115,101,110,115,111,114,40,110,41,41,
+41,32,32,47,47,32,114,101,97,100,32,116,104,101,32,115,
+101,110,115,111,114,32,109,111,100,101,'\n',32,32,32,32,95,
+95,110,111,108,105,115,116,32,118,111,105,100,32,83,101,116,
+83,101,110,115,111,114,77,111,100,101,40,95,95,115,101,110,
+115,111,114,32,115,101,110,115,111,114,44,32,99,111,110,115,
+116,32,105,110,116,32,109,111,100,101,41,32,123,32,97,115,
+109,32,123,32,48,120,52,50,44,32,36,115,101,110,115,111,
+114,32,58,32,48,120,48,51,48,48,48,50,48,48,44,32,
+109,111,100,101,32,60,60,32,53,32,125,59,32,125,'\n',35,
+101,110,100,105,102,'\n','\n','\n',35,105,102,32,100,101,102,105,
+110,101,100,40,95,95,82,67,88,41,32,124,124,32,100,101,
+102,105,110,101,100,40,95,95,83,87,65,78,41,'\n',32,32,
+32,32,47,47,32,82,67,88,32,115,117,112,112,111,114,116,
+115,32,115,101,110,115,111,114,32,116,121,112,101,115,'\n','\n',
+32,32,32,32,47,47,32,116,121,112,101,115,32,102,111,114,
+32,83,101,116,83,101,110,115,111,114,84,121,112,101,40,41,
+'\n',32,32,32,32,35,100,101,102,105,110,101,32,83,69,78,
+83,79,82,95,84,89,80,69,95,78,79,78,69,32,32,32,
+32,32,32,32,32,48,'\n',32,32,32,32,35,100,101,102,105,
+110,101,32,83,69,78,83,79,82,95,84,89,80,69,95,84,
+79,85,67,72,32,32,32,32,32,32,32,49,'\n',32,32,32,
+32,35,100,101,102,105,110,101,32,83,69,78,83,79,82,95,
+84,89,80,69,95,84,69,77,80,69,82,65,84,85,82,69,
+32,50,'\n',32,32,32,32,35,100,101,102,105,110,101,32,83,
+69,78,83,79,82,95,84,89,80,69,95,76,73,71,72,84,
+32,32,32,32,32,32,32,51,'\n',32,32,32,32,35,100,101,
+102,105,110,101,32,83,69,78,83,79,82,95,84,89,80,69,
+95,82,79,84,65,84,73,79,78,32,32,32,32,52,'\n','\n',
+32,32,32,32,35,105,102,32,100,101,102,105,110,101,100,40,
+95,95,83,87,65,78,41,'\n',32,32,32,32,32,32,32,32,
+35,100,101,102,105,110,101,32,83,69,78,83,79,82,95,84,
+89,80,69,95,65,67,84,73,86,69,95,82,65,87,32,53,
+'\n',32,32,32,32,35,101,110,100,105,102,'\n','\n','\n',32,32,
+32,32,47,47,32,116,121,112,101,47,109,111,100,101,32,99,
+111,109,98,105,110,97,116,105,111,110,115,32,102,111,114,32,
+83,101,116,83,101,110,115,111,114,40,41,'\n',32,32,32,32,
+35,100,101,102,105,110,101,32,95,83,69,78,83,79,82,95,
+67,70,71,40,116,121,112,101,44,109,111,100,101,41,32,32,
+40,40,40,116,121,112,101,41,60,60,56,41,32,43,32,40,
+109,111,100,101,41,41,'\n',32,32,32,32,35,100,101,102,105,
+110,101,32,83,69,78,83,79,82,95,84,79,85,67,72,32,
+32,32,32,32,32,32,32,95,83,69,78,83,79,82,95,67,
+70,71,40,83,69,78,83,79,82,95,84,89,80,69,95,84,
+79,85,67,72,44,32,83,69,78,83,79,82,95,77,79,68,
+69,95,66,79,79,76,41,'\n',32,32,32,32,35,100,101,102,
+105,110,101,32,83,69,78,83,79,82,95,76,73,71,72,84,
+32,32,32,32,32,32,32,32,95,83,69,78,83,79,82,95,
+67,70,71,40,83,69,78,83,79,82,95,84,89,80,69,95,
+76,73,71,72,84,44,32,83,69,78,83,79,82,95,77,79,
+68,69,95,80,69,82,67,69,78,84,41,'\n',32,32,32,32,
+35,100,101,102,105,110,101,32,83,69,78,83,79,82,95,82,
+79,84,65,84,73,79,78,32,32,32,32,32,95,83,69,78,
+83,79,82,95,67,70,71,40,83,69,78,83,79,82,95,84,
+89,80,69,95,82,79,84,65,84,73,79,78,44,32,83,69,
+78,83,79,82,95,77,79,68,69,95,82,79,84,65,84,73,
+79,78,41,'\n',32,32,32,32,35,100,101,102,105,110,101,32,
+83,69,78,83,79,82,95,67,69,76,83,73,85,83,32,32,
+32,32,32,32,95,83,69,78,83,79,82,95,67,70,71,40,
+83,69,78,83,79,82,95,84,89,80,69,95,84,69,77,80,
+69,82,65,84,85,82,69,44,32,83,69,78,83,79,82,95,
+77,79,68,69,95,67,69,76,83,73,85,83,41,'\n',32,32,
+32,32,35,100,101,102,105,110,101,32,83,69,78,83,79,82,
+95,70,65,72,82,69,78,72,69,73,84,32,32,32,95,83,
+69,78,83,79,82,95,67,70,71,40,83,69,78,83,79,82,
+95,84,89,80,69,95,84,69,77,80,69,82,65,84,85,82,
+69,44,32,83,69,78,83,79,82,95,77,79,68,69,95,70,
+65,72,82,69,78,72,69,73,84,41,'\n',32,32,32,32,35,
+100,101,102,105,110,101,32,83,69,78,83,79,82,95,80,85,
+76,83,69,32,32,32,32,32,32,32,32,95,83,69,78,83,
+79,82,95,67,70,71,40,83,69,78,83,79,82,95,84,89,
+80,69,95,84,79,85,67,72,44,32,83,69,78,83,79,82,
+95,77,79,68,69,95,80,85,76,83,69,41,'\n',32,32,32,
+32,35,100,101,102,105,110,101,32,83,69,78,83,79,82,95,
+69,68,71,69,32,32,32,32,32,32,32,32,32,95,83,69,
+78,83,79,82,95,67,70,71,40,83,69,78,83,79,82,95,
+84,89,80,69,95,84,79,85,67,72,44,32,83,69,78,83,
+79,82,95,77,79,68,69,95,69,68,71,69,41,'\n','\n','\n',
+32,32,32,32,35,100,101,102,105,110,101,32,83,101,110,115,
+111,114,86,97,108,117,101,66,111,111,108,40,110,41,32,32,
+64,40,48,120,100,48,48,48,48,32,43,32,40,95,95,115,
+101,110,115,111,114,40,110,41,41,41,32,32,47,47,32,114,
+101,97,100,32,116,104,101,32,98,111,111,108,101,97,110,32,
+118,97,108,117,101,32,111,102,32,97,32,115,101,110,115,111,
+114,'\n','\n','\n',32,32,32,32,47,47,32,115,101,116,32,97,
+32,115,101,110,115,111,114,39,115,32,116,121,112,101,'\n',32,
+32,32,32,95,95,110,111,108,105,115,116,32,118,111,105,100,
+32,83,101,116,83,101,110,115,111,114,84,121,112,101,40,95,
+95,115,101,110,115,111,114,32,115,101,110,115,111,114,44,32,
+99,111,110,115,116,32,105,110,116,32,116,121,112,101,41,32,
+32,32,32,32,123,32,97,115,109,32,123,32,48,120,51,50,
+44,32,36,115,101,110,115,111,114,32,58,32,48,120,48,51,
+48,48,48,50,48,48,44,32,40,116,121,112,101,41,32,125,
+59,32,125,'\n','\n','\n',32,32,32,32,47,47,32,115,101,116,
+32,97,32,115,101,110,115,111,114,39,115,32,116,121,112,101,
+32,97,110,100,32,109,111,100,101,32,117,115,105,110,103,32,
+97,32,99,111,110,102,105,103,32,45,32,101,46,103,46,32,
+83,101,116,83,101,110,115,111,114,40,83,69,78,83,79,82,
+95,49,44,32,83,69,78,83,79,82,95,76,73,71,72,84,
+41,59,'\n',32,32,32,32,95,95,110,111,108,105,115,116,32,
+118,111,105,100,32,83,101,116,83,101,110,115,111,114,40,95,
+95,115,101,110,115,111,114,32,115,101,110,115,111,114,44,32,
+99,111,110,115,116,32,105,110,116,32,116,109,41,32,32,123,
+32,83,101,116,83,101,110,115,111,114,84,121,112,101,40,115,
+101,110,115,111,114,44,32,116,109,62,62,56,41,59,32,83,
+101,116,83,101,110,115,111,114,77,111,100,101,40,115,101,110,
+115,111,114,44,32,116,109,41,59,32,125,'\n',35,101,110,100,
+105,102,'\n','\n','\n',35,105,102,100,101,102,32,95,95,83,67,
+79,85,84,'\n',32,32,32,32,47,47,32,83,99,111,117,116,
+32,104,97,115,32,115,111,109,101,32,115,112,101,99,105,97,
+108,32,114,111,117,116,105,110,101,115,32,116,111,32,99,111,
+110,102,105,103,117,114,101,32,116,104,101,32,108,105,103,104,
+116,32,115,101,110,115,111,114,'\n',32,32,32,32,95,95,110,
+111,108,105,115,116,32,118,111,105,100,32,67,97,108,105,98,
+114,97,116,101,83,101,110,115,111,114,40,41,32,32,32,32,
+32,32,32,32,32,123,32,97,115,109,32,123,32,48,120,99,
+48,32,125,59,32,125,'\n',32,32,32,32,95,95,110,111,108,
+105,115,116,32,118,111,105,100,32,83,101,116,83,101,110,115,
+111,114,67,108,105,99,107,84,105,109,101,40,99,111,110,115,
+116,32,105,110,116,32,38,120,41,32,32,123,32,97,115,109,
+32,123,32,48,120,101,51,44,32,36,120,32,58,32,95,95,
+65,83,77,95,83,82,67,95,66,65,83,73,67,32,125,59,
+32,125,'\n',32,32,32,32,95,95,110,111,108,105,115,116,32,
+118,111,105,100,32,83,101,116,83,101,110,115,111,114,72,121,
+115,116,101,114,101,115,105,115,40,99,111,110,115,116,32,105,
+110,116,32,38,120,41,32,123,32,97,115,109,32,123,32,48,
+120,100,51,44,32,36,120,32,58,32,95,95,65,83,77,95,
+83,82,67,95,66,65,83,73,67,32,125,59,32,125,'\n',32,
+32,32,32,95,95,110,111,108,105,115,116,32,118,111,105,100,
+32,83,101,116,83,101,110,115,111,114,76,111,119,101,114,76,
+105,109,105,116,40,99,111,110,115,116,32,105,110,116,32,38,
+120,41,32,123,32,97,115,109,32,123,32,48,120,99,51,44,
+32,36,120,32,58,32,95,95,65,83,77,95,83,82,67,95,
+66,65,83,73,67,32,125,59,32,125,'\n',32,32,32,32,95,
+95,110,111,108,105,115,116,32,118,111,105,100,32,83,101,116,
+83,101,110,115,111,114,85,112,112,101,114,76,105,109,105,116,
+40,99,111,110,115,116,32,105,110,116,32,38,120,41,32,123,
+32,97,115,109,32,123,32,48,120,98,51,44,32,36,120,32,
+58,32,95,95,65,83,77,95,83,82,67,95,66,65,83,73,
+67,32,125,59,32,125,'\n',35,101,110,100,105,102,'\n','\n','\n',
+35,105,102,32,100,101,102,105,110,101,100,40,95,95,82,67,
+88,41,32,124,124,32,100,101,102,105,110,101,100,40,95,95,
+83,67,79,85,84,41,32,124,124,32,100,101,102,105,110,101,
+100,40,95,95,83,80,89,41,32,124,124,32,100,101,102,105,
+110,101,100,40,95,95,83,87,65,78,41,'\n',32,32,32,32,
+47,47,32,82,67,88,32,97,110,100,32,83,99,111,117,116,
+32,115,117,112,112,111,114,116,32,114,101,97,100,105,110,103,
+32,116,104,101,32,114,97,119,32,118,97,108,117,101,'\n',32,
+32,32,32,35,100,101,102,105,110,101,32,83,101,110,115,111,
+114,86,97,108,117,101,82,97,119,40,110,41,32,32,32,64,
+40,48,120,99,48,48,48,48,32,43,32,40,95,95,115,101,
+110,115,111,114,40,110,41,41,41,'\n',35,101,110,100,105,102,
+'\n','\n','\n','\n',47,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,'\n',
+32,42,32,111,117,116,112,117,116,115,'\n',32,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,47,'\n','\n','\n',47,47,32,99,111,110,
+115,116,97,110,116,115,32,102,111,114,32,115,101,108,101,99,
+116,105,110,103,32,111,117,116,112,117,116,115,'\n',35,100,101,
+102,105,110,101,32,79,85,84,95,65,32,32,32,48,120,48,
+49,'\n',35,100,101,102,105,110,101,32,79,85,84,95,66,32,
+32,32,48,120,48,50,'\n',35,100,101,102,105,110,101,32,79,
+85,84,95,67,32,32,32,48,120,48,52,'\n','\n',35,100,101,
+102,105,110,101,32,79,85,84,95,65,66,32,32,48,120,48,
+51,'\n',35,100,101,102,105,110,101,32,79,85,84,95,65,67,
+32,32,48,120,48,53,'\n',35,100,101,102,105,110,101,32,79,
+85,84,95,66,67,32,32,48,120,48,54,'\n',35,100,101,102,
+105,110,101,32,79,85,84,95,65,66,67,32,48,120,48,55,
+'\n','\n',35,105,102,100,101,102,32,95,95,83,87,65,78,'\n',
+32,32,32,32,35,100,101,102,105,110,101,32,79,85,84,95,
+68,32,32,32,48,120,48,56,'\n',32,32,32,32,35,100,101,
+102,105,110,101,32,79,85,84,95,69,32,32,32,48,120,49,
+48,'\n',32,32,32,32,35,100,101,102,105,110,101,32,79,85,
+84,95,70,32,32,32,48,120,50,48,'\n',35,101,110,100,105,
+102,32,47,47,32,95,95,83,87,65,78,'\n','\n','\n',47,47,
+32,111,117,116,112,117,116,32,109,111,100,101,115,'\n',35,100,
+101,102,105,110,101,32,79,85,84,95,70,76,79,65,84,32,
+32,32,48,'\n',35,100,101,102,105,110,101,32,79,85,84,95,
+79,70,70,32,32,32,32,32,48,120,52,48,'\n',35,100,101,
+102,105,110,101,32,79,85,84,95,79,78,32,32,32,32,32,
+32,48,120,56,48,'\n','\n','\n',47,47,32,111,117,116,112,117,
+116,32,100,105,114,101,99,116,105,111,110,115,'\n',35,100,101,
+102,105,110,101,32,79,85,84,95,82,69,86,32,32,32,32,
+32,48,'\n',35,100,101,102,105,110,101,32,79,85,84,95,84,
+79,71,71,76,69,32,32,48,120,52,48,'\n',35,100,101,102,
+105,110,101,32,79,85,84,95,70,87,68,32,32,32,32,32,
+48,120,56,48,'\n','\n','\n',47,47,32,111,117,116,112,117,116,
+32,112,111,119,101,114,32,108,101,118,101,108,115,'\n',35,100,
+101,102,105,110,101,32,79,85,84,95,76,79,87,32,32,32,
+32,32,48,'\n',35,100,101,102,105,110,101,32,79,85,84,95,
+72,65,76,70,32,32,32,32,51,'\n',35,100,101,102,105,110,
+101,32,79,85,84,95,70,85,76,76,32,32,32,32,55,'\n',
+'\n','\n',47,47,32,111,117,116,112,117,116,32,102,117,110,99,
+116,105,111,110,115,'\n',95,95,110,111,108,105,115,116,32,118,
+111,105,100,32,83,101,116,79,117,116,112,117,116,40,99,111,
+110,115,116,32,105,110,116,32,111,44,32,99,111,110,115,116,
+32,105,110,116,32,109,41,32,32,32,32,32,32,32,123,32,
+97,115,109,32,123,32,48,120,50,49,44,32,40,111,41,32,
+43,32,40,109,41,32,125,59,32,125,'\n',95,95,110,111,108,
+105,115,116,32,118,111,105,100,32,83,101,116,68,105,114,101,
+99,116,105,111,110,40,99,111,110,115,116,32,105,110,116,32,
+111,44,32,99,111,110,115,116,32,105,110,116,32,100,41,32,
+32,32,32,123,32,97,115,109,32,123,32,48,120,101,49,44,
+32,40,111,41,32,43,32,40,100,41,32,125,59,32,125,'\n',
+95,95,110,111,108,105,115,116,32,118,111,105,100,32,83,101,
+116,80,111,119,101,114,40,99,111,110,115,116,32,105,110,116,
+32,111,44,32,99,111,110,115,116,32,105,110,116,32,38,112,
+41,32,32,32,32,32,32,32,123,32,97,115,109,32,123,32,
+48,120,49,51,44,32,40,111,41,44,32,36,112,32,58,32,
+95,95,65,83,77,95,83,77,65,76,76,95,86,65,76,85,
+69,32,43,32,95,95,65,83,77,95,83,82,67,95,69,88,
+84,125,59,32,125,'\n','\n','\n',95,95,110,111,108,105,115,116,
+32,118,111,105,100,32,79,110,40,99,111,110,115,116,32,105,
+110,116,32,111,41,32,32,32,32,32,32,32,123,32,83,101,
+116,79,117,116,112,117,116,40,111,44,32,79,85,84,95,79,
+78,41,59,32,125,'\n',95,95,110,111,108,105,115,116,32,118,
+111,105,100,32,79,102,102,40,99,111,110,115,116,32,105,110,
+116,32,111,41,32,32,32,32,32,32,123,32,83,101,116,79,
+117,116,112,117,116,40,111,44,32,79,85,84,95,79,70,70,
+41,59,32,125,'\n',95,95,110,111,108,105,115,116,32,118,111,
+105,100,32,70,108,111,97,116,40,99,111,110,115,116,32,105,
+110,116,32,111,41,32,32,32,32,123,32,83,101,116,79,117,
+116,112,117,116,40,111,44,32,79,85,84,95,70,76,79,65,
+84,41,59,32,125,'\n',95,95,110,111,108,105,115,116,32,118,
+111,105,100,32,84,111,103,103,108,101,40,99,111,110,115,116,
+32,105,110,116,32,111,41,32,32,32,123,32,83,101,116,68,
+105,114,101,99,116,105,111,110,40,111,44,32,79,85,84,95,
+84,79,71,71,76,69,41,59,32,125,'\n',95,95,110,111,108,
+105,115,116,32,118,111,105,100,32,70,119,100,40,99,111,110,
+115,116,32,105,110,116,32,111,41,32,32,32,32,32,32,123,
+32,83,101,116,68,105,114,101,99,116,105,111,110,40,111,44,
+32,79,85,84,95,70,87,68,41,59,32,125,'\n',95,95,110,
+111,108,105,115,116,32,118,111,105,100,32,82,101,118,40,99,
+111,110,115,116,32,105,110,116,32,111,41,32,32,32,32,32,
+32,123,32,83,101,116,68,105,114,101,99,116,105,111,110,40,
+111,44,32,79,85,84,95,82,69,86,41,59,32,125,'\n',95,
+95,110,111,108,105,115,116,32,118,111,105,100,32,79,110,70,
+119,100,40,99,111,110,115,116,32,105,110,116,32,111,41,32,
+32,32,32,123,32,70,119,100,40,111,41,59,32,79,110,40,
+111,41,59,32,125,'\n',95,95,110,111,108,105,115,116,32,118,
+111,105,100,32,79,110,82,101,118,40,99,111,110,115,116,32,
+105,110,116,32,111,41,32,32,32,32,123,32,82,101,118,40,
+111,41,59,32,79,110,40,111,41,59,32,125,'\n',95,95,110,
+111,108,105,115,116,32,118,111,105,100,32,79,110,70,111,114,
+40,99,111,110,115,116,32,105,110,116,32,111,44,32,99,111,
+110,115,116,32,105,110,116,32,38,116,41,32,32,123,32,79,
+110,40,111,41,59,32,87,97,105,116,40,116,41,59,32,79,
+102,102,40,111,41,59,32,125,'\n','\n','\n',35,100,101,102,105,
+110,101,32,79,117,116,112,117,116,83,116,97,116,117,115,40,
+110,41,32,32,32,32,32,64,40,48,120,48,51,48,48,48,
+48,32,43,32,40,110,41,41,32,32,32,47,47,32,114,101,
+97,100,32,116,104,101,32,111,117,116,112,117,116,32,115,116,
+97,116,117,115,'\n','\n','\n',35,105,102,100,101,102,32,95,95,
+67,77,'\n',32,32,32,32,47,47,32,67,121,98,101,114,77,
+97,115,116,101,114,32,115,112,101,99,105,102,105,99,32,115,
+116,117,102,102,'\n',32,32,32,32,47,47,32,97,108,116,101,
+114,110,97,116,101,32,110,97,109,101,115,32,102,111,114,32,
+109,111,116,111,114,115,'\n',32,32,32,32,35,100,101,102,105,
+110,101,32,79,85,84,95,76,32,79,85,84,95,65,32,47,
+47,32,76,101,102,116,32,109,111,116,111,114,'\n',32,32,32,
+32,35,100,101,102,105,110,101,32,79,85,84,95,82,32,79,
+85,84,95,66,32,47,47,32,82,105,103,104,116,32,109,111,
+116,111,114,'\n',32,32,32,32,35,100,101,102,105,110,101,32,
+79,85,84,95,88,32,79,85,84,95,67,32,47,47,32,69,
+120,116,101,114,110,97,108,32,109,111,116,111,114,'\n','\n','\n',
+32,32,32,32,35,100,101,102,105,110,101,32,68,114,105,118,
+101,40,109,48,44,32,109,49,41,32,32,32,32,32,32,32,
+32,32,32,32,97,115,109,32,123,32,48,120,52,49,44,32,
+68,73,82,83,80,69,69,68,40,109,48,41,32,124,32,68,
+73,82,83,80,69,69,68,40,109,49,41,60,60,52,32,125,
+'\n',32,32,32,32,35,100,101,102,105,110,101,32,79,110,87,
+97,105,116,40,109,44,32,110,44,32,116,41,32,32,32,32,
+32,32,32,32,32,97,115,109,32,123,32,48,120,99,50,44,
+32,40,109,41,60,60,52,32,124,32,68,73,82,83,80,69,
+69,68,40,110,41,44,32,116,32,125,'\n',32,32,32,32,35,
+100,101,102,105,110,101,32,79,110,87,97,105,116,68,105,102,
+102,101,114,101,110,116,40,109,44,32,110,48,44,32,110,49,
+44,32,110,50,44,32,116,41,32,97,115,109,32,123,32,48,
+120,53,51,44,32,40,109,41,60,60,52,32,124,32,68,73,
+82,83,80,69,69,68,40,110,48,41,44,32,68,73,82,83,
+80,69,69,68,40,110,49,41,60,60,52,32,124,32,68,73,
+82,83,80,69,69,68,40,110,50,41,44,32,116,32,125,'\n',
+'\n','\n',32,32,32,32,47,47,32,65,117,120,46,32,102,117,
+110,99,116,105,111,110,58,32,84,114,97,110,115,102,111,114,
+109,115,32,97,32,110,117,109,98,101,114,32,98,101,116,119,
+101,101,110,32,45,55,32,97,110,100,32,55,32,116,111,32,
+97,32,52,32,98,105,116,32,115,101,113,117,101,110,99,101,
+58,'\n',32,32,32,32,47,47,32,66,105,116,115,58,32,49,
+46,46,51,32,45,32,83,112,101,101,100,58,32,48,32,116,
+111,32,55,'\n',32,32,32,32,47,47,32,66,105,116,32,58,
+32,52,32,32,32,32,45,32,68,105,114,101,99,116,105,111,
+110,58,32,49,32,105,102,32,118,62,61,48,44,32,48,32,
+105,102,32,118,60,48,'\n',32,32,32,32,35,100,101,102,105,
+110,101,32,68,73,82,83,80,69,69,68,40,118,41,32,32,
+32,32,32,40,40,118,41,38,56,94,56,124,40,40,118,41,
+42,40,40,40,118,41,62,62,51,41,42,50,94,49,41,41,
+38,55,41,'\n','\n','\n',32,32,32,32,47,47,32,114,101,97,
+100,105,110,103,32,116,104,101,32,116,97,99,104,111,44,32,
+101,116,99,46,'\n',32,32,32,32,35,100,101,102,105,110,101,
+32,84,97,99,104,111,67,111,117,110,116,40,110,41,32,32,
+32,32,32,32,32,64,40,48,120,53,48,48,48,48,32,43,
+32,40,110,41,45,49,41,32,32,47,47,32,85,115,101,32,
+79,85,84,95,120,32,97,115,32,112,97,114,97,109,101,116,
+101,114,'\n',32,32,32,32,35,100,101,102,105,110,101,32,84,
+97,99,104,111,83,112,101,101,100,40,110,41,32,32,32,32,
+32,32,32,64,40,48,120,54,48,48,48,48,32,43,32,40,
+110,41,45,49,41,32,32,47,47,32,85,115,101,32,79,85,
+84,95,120,32,97,115,32,112,97,114,97,109,101,116,101,114,
+'\n',32,32,32,32,35,100,101,102,105,110,101,32,69,120,116,
+101,114,110,97,108,77,111,116,111,114,82,117,110,110,105,110,
+103,40,41,32,32,64,40,48,120,55,48,48,48,50,41,32,
+32,32,32,32,32,47,47,32,82,101,102,101,114,114,101,100,
+32,105,110,32,116,104,101,32,83,68,75,32,97,115,32,77,
+111,116,111,114,67,117,114,114,101,110,116,40,50,41,46,'\n',
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,47,47,32,78,111,110,45,122,101,114,111,32,
+105,102,32,101,120,116,101,114,110,97,108,32,109,111,116,111,
+114,32,114,117,110,110,105,110,103,46,'\n','\n','\n',32,32,32,
+32,35,100,101,102,105,110,101,32,67,108,101,97,114,84,97,
+99,104,111,67,111,117,110,116,101,114,40,109,41,32,97,115,
+109,32,123,32,48,120,49,49,44,32,40,109,41,32,125,'\n',
+35,101,110,100,105,102,'\n','\n','\n',35,105,102,32,100,101,102,
+105,110,101,100,40,95,95,83,67,79,85,84,41,32,124,124,
+32,95,95,82,67,88,61,61,50,32,124,124,32,100,101,102,
+105,110,101,100,40,95,95,83,80,89,41,32,124,124,32,100,
+101,102,105,110,101,100,40,95,95,83,87,65,78,41,'\n',32,
+32,32,32,47,47,32,83,99,111,117,116,32,97,110,100,32,
+82,67,88,50,32,104,97,118,101,32,103,108,111,98,97,108,
+32,118,101,114,115,105,111,110,115,32,111,102,32,111,117,116,
+112,117,116,32,99,111,110,116,114,111,108,'\n',32,32,32,32,
+95,95,110,111,108,105,115,116,32,118,111,105,100,32,83,101,
+116,71,108,111,98,97,108,79,117,116,112,117,116,40,99,111,
+110,115,116,32,105,110,116,32,111,44,32,99,111,110,115,116,
+32,105,110,116,32,109,41,32,32,32,32,32,123,32,97,115,
+109,32,123,32,48,120,54,55,44,32,40,111,41,32,43,32,
+40,109,41,32,125,59,32,125,'\n',32,32,32,32,95,95,110,
+111,108,105,115,116,32,118,111,105,100,32,83,101,116,71,108,
+111,98,97,108,68,105,114,101,99,116,105,111,110,40,99,111,
+110,115,116,32,105,110,116,32,111,44,32,99,111,110,115,116,
+32,105,110,116,32,100,41,32,32,123,32,97,115,109,32,123,
+32,48,120,55,55,44,32,40,111,41,32,43,32,40,100,41,
+32,125,59,32,125,'\n',32,32,32,32,95,95,110,111,108,105,
+115,116,32,118,111,105,100,32,83,101,116,77,97,120,80,111,
+119,101,114,40,99,111,110,115,116,32,105,110,116,32,111,44,
+32,99,111,110,115,116,32,105,110,116,32,38,112,41,32,123,
+32,97,115,109,32,123,32,48,120,97,51,44,32,40,111,41,
+44,32,36,112,32,58,32,95,95,65,83,77,95,83,77,65,
+76,76,95,86,65,76,85,69,32,43,32,95,95,65,83,77,
+95,83,82,67,95,69,88,84,125,59,32,125,'\n','\n','\n',32,
+32,32,32,95,95,110,111,108,105,115,116,32,118,111,105,100,
+32,69,110,97,98,108,101,79,117,116,112,117,116,40,99,111,
+110,115,116,32,105,110,116,32,111,41,32,32,32,32,32,123,
+32,83,101,116,71,108,111,98,97,108,79,117,116,112,117,116,
+40,111,44,32,79,85,84,95,79,78,41,59,32,125,'\n',32,
+32,32,32,95,95,110,111,108,105,115,116,32,118,111,105,100,
+32,68,105,115,97,98,108,101,79,117,116,112,117,116,40,99,
+111,110,115,116,32,105,110,116,32,111,41,32,32,32,32,123,
+32,83,101,116,71,108,111,98,97,108,79,117,116,112,117,116,
+40,111,44,32,79,85,84,95,79,70,70,41,59,32,125,'\n',
+32,32,32,32,95,95,110,111,108,105,115,116,32,118,111,105,
+100,32,73,110,118,101,114,116,79,117,116,112,117,116,40,99,
+111,110,115,116,32,105,110,116,32,111,41,32,32,32,32,32,
+123,32,83,101,116,71,108,111,98,97,108,68,105,114,101,99,
+116,105,111,110,40,111,44,32,79,85,84,95,82,69,86,41,
+59,32,125,'\n',32,32,32,32,95,95,110,111,108,105,115,116,
+32,118,111,105,100,32,79,98,118,101,114,116,79,117,116,112,
+117,116,40,99,111,110,115,116,32,105,110,116,32,111,41,32,
+32,32,32,32,123,32,83,101,116,71,108,111,98,97,108,68,
+105,114,101,99,116,105,111,110,40,111,44,32,79,85,84,95,
+70,87,68,41,59,32,125,'\n','\n','\n',32,32,32,32,35,100,
+101,102,105,110,101,32,71,108,111,98,97,108,79,117,116,112,
+117,116,83,116,97,116,117,115,40,110,41,32,32,32,32,32,
+32,32,64,40,48,120,49,49,48,48,48,48,32,43,32,40,
+110,41,41,32,32,32,47,47,32,114,101,97,100,32,116,104,
+101,32,103,108,111,98,97,108,32,115,116,97,116,117,115,'\n',
+35,101,110,100,105,102,'\n','\n','\n',35,105,102,32,100,101,102,
+105,110,101,100,40,95,95,83,67,79,85,84,41,32,124,124,
+32,100,101,102,105,110,101,100,40,95,95,83,80,89,41,'\n',
+32,32,32,32,47,47,32,83,99,111,117,116,32,104,97,115,
+32,97,32,108,105,103,104,116,'\n',32,32,32,32,35,100,101,
+102,105,110,101,32,76,73,71,72,84,95,79,78,32,32,32,
+32,48,120,56,48,'\n',32,32,32,32,35,100,101,102,105,110,
+101,32,76,73,71,72,84,95,79,70,70,32,32,32,48,'\n',
+32,32,32,32,95,95,110,111,108,105,115,116,32,118,111,105,
+100,32,83,101,116,76,105,103,104,116,40,99,111,110,115,116,
+32,105,110,116,32,120,41,32,123,32,97,115,109,32,123,32,
+48,120,56,55,44,32,120,32,125,59,32,125,'\n',35,101,110,
+100,105,102,'\n','\n','\n','\n',47,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,'\n',32,42,32,115,111,117,110,100,'\n',32,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,47,'\n','\n',47,47,32,115,111,117,
+110,100,115,32,45,32,102,111,114,32,80,108,97,121,83,111,
+117,110,100,40,41,'\n',35,100,101,102,105,110,101,32,83,79,
+85,78,68,95,67,76,73,67,75,32,32,32,32,32,32,32,
+32,32,32,32,32,32,48,'\n',35,100,101,102,105,110,101,32,
+83,79,85,78,68,95,68,79,85,66,76,69,95,66,69,69,
+80,32,32,32,32,32,32,32,49,'\n',35,100,101,102,105,110,
+101,32,83,79,85,78,68,95,68,79,87,78,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,50,'\n',35,100,101,102,
+105,110,101,32,83,79,85,78,68,95,85,80,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,51,'\n',35,100,
+101,102,105,110,101,32,83,79,85,78,68,95,76,79,87,95,
+66,69,69,80,32,32,32,32,32,32,32,32,32,32,52,'\n',
+35,100,101,102,105,110,101,32,83,79,85,78,68,95,70,65,
+83,84,95,85,80,32,32,32,32,32,32,32,32,32,32,32,
+53,'\n','\n',35,105,102,32,100,101,102,105,110,101,100,40,95,
+95,83,87,65,78,41,'\n',32,32,32,32,35,100,101,102,105,
+110,101,32,83,79,85,78,68,95,83,72,79,82,84,95,66,
+76,73,80,32,32,32,32,54,'\n',32,32,32,32,35,100,101,
+102,105,110,101,32,83,79,85,78,68,95,69,88,67,69,80,
+84,73,79,78,32,32,32,32,32,55,'\n',35,101,110,100,105,
+102,'\n','\n','\n',47,47,32,112,108,97,121,105,110,103,32,97,
+32,115,121,115,116,101,109,32,115,111,117,110,100,'\n',35,105,
+102,32,100,101,102,105,110,101,100,40,95,95,83,80,89,41,
+'\n',32,32,32,32,47,47,32,83,112,121,32,99,97,110,32,
+112,108,97,121,32,118,97,114,105,97,98,108,101,32,111,114,
+32,99,111,110,115,116,97,110,116,32,115,111,117,110,100,115,
+'\n',32,32,32,32,95,95,110,111,108,105,115,116,32,118,111,
+105,100,32,80,108,97,121,83,111,117,110,100,40,99,111,110,
+115,116,32,105,110,116,32,38,120,41,'\n',32,32,32,32,123,
+'\n',32,32,32,32,32,32,32,32,105,102,32,40,95,95,116,
+121,112,101,40,120,41,61,61,50,41,'\n',32,32,32,32,32,
+32,32,32,32,32,32,32,97,115,109,32,123,32,48,120,53,
+49,44,32,36,120,32,58,32,48,120,51,48,48,48,48,48,
+52,32,125,59,'\n',32,32,32,32,32,32,32,32,101,108,115,
+101,'\n',32,32,32,32,32,32,32,32,32,32,32,32,97,115,
+109,32,123,32,48,120,101,55,44,32,36,120,32,58,32,48,
+120,51,48,48,48,48,48,49,32,125,59,'\n',32,32,32,32,
+125,'\n',35,101,108,115,101,'\n',32,32,32,32,95,95,110,111,
+108,105,115,116,32,118,111,105,100,32,80,108,97,121,83,111,
+117,110,100,40,99,111,110,115,116,32,105,110,116,32,120,41,
+32,32,32,32,32,32,32,32,123,32,97,115,109,32,123,32,
+48,120,53,49,44,32,120,32,125,59,32,125,'\n',35,101,110,
+100,105,102,'\n','\n','\n',47,47,32,112,108,97,121,105,110,103,
+32,97,32,110,111,116,101,'\n',35,105,102,32,100,101,102,105,
+110,101,100,40,95,95,83,67,79,85,84,41,32,124,124,32,
+95,95,82,67,88,61,61,50,32,124,124,32,100,101,102,105,
+110,101,100,40,95,95,83,80,89,41,32,124,124,32,100,101,
+102,105,110,101,100,40,95,95,83,87,65,78,41,'\n',32,32,
+32,32,47,47,32,82,67,88,50,32,97,110,100,32,83,99,
+111,117,116,32,99,97,110,32,112,108,97,121,32,118,97,114,
+105,97,98,108,101,32,111,114,32,99,111,110,115,116,97,110,
+116,32,102,114,101,113,117,101,110,99,121,'\n',32,32,32,32,
+95,95,110,111,108,105,115,116,32,118,111,105,100,32,80,108,
+97,121,84,111,110,101,40,99,111,110,115,116,32,105,110,116,
+32,38,110,111,116,101,44,32,99,111,110,115,116,32,105,110,
+116,32,100,117,114,41,'\n',32,32,32,32,123,'\n',32,32,32,
+32,32,32,32,32,105,102,32,40,95,95,116,121,112,101,40,
+110,111,116,101,41,61,61,50,41,'\n',32,32,32,32,32,32,
+32,32,32,32,32,32,97,115,109,32,123,32,48,120,50,51,
+44,32,36,110,111,116,101,32,58,32,48,120,50,48,48,48,
+48,48,52,44,32,100,117,114,32,125,59,'\n',32,32,32,32,
+32,32,32,32,101,108,115,101,'\n',32,32,32,32,32,32,32,
+32,32,32,32,32,97,115,109,32,123,32,48,120,48,50,44,
+32,36,110,111,116,101,32,58,32,48,120,51,48,48,48,48,
+48,49,44,32,100,117,114,125,59,'\n',32,32,32,32,125,'\n',
+35,101,108,115,101,'\n',32,32,32,32,47,47,32,82,67,88,
+49,32,97,110,100,32,67,77,32,110,101,101,100,32,99,111,
+110,115,116,97,110,116,32,102,114,101,113,117,101,110,99,121,
+'\n',32,32,32,32,95,95,110,111,108,105,115,116,32,118,111,
+105,100,32,80,108,97,121,84,111,110,101,40,99,111,110,115,
+116,32,105,110,116,32,102,44,32,99,111,110,115,116,32,105,
+110,116,32,100,41,32,32,32,32,123,32,97,115,109,32,123,
+32,48,120,50,51,44,32,40,102,41,44,32,40,102,41,62,
+62,56,44,32,40,100,41,32,125,59,32,125,'\n',35,101,110,
+100,105,102,'\n','\n','\n',35,105,102,32,95,95,82,67,88,61,
+61,50,32,124,124,32,100,101,102,105,110,101,100,40,95,95,
+83,80,89,41,32,124,124,32,100,101,102,105,110,101,100,40,
+95,95,83,87,65,78,41,'\n',32,32,32,32,47,47,32,82,
+67,88,50,'\n',32,32,32,32,95,95,110,111,108,105,115,116,
+32,118,111,105,100,32,77,117,116,101,83,111,117,110,100,40,
+41,32,32,32,32,32,32,32,123,32,97,115,109,32,123,32,
+48,120,100,48,32,125,59,32,125,'\n',32,32,32,32,95,95,
+110,111,108,105,115,116,32,118,111,105,100,32,85,110,109,117,
+116,101,83,111,117,110,100,40,41,32,32,32,32,32,123,32,
+97,115,109,32,123,32,48,120,101,48,32,125,59,32,125,'\n',
+32,32,32,32,95,95,110,111,108,105,115,116,32,118,111,105,
+100,32,67,108,101,97,114,83,111,117,110,100,40,41,32,32,
+32,32,32,32,123,32,97,115,109,32,123,32,48,120,56,48,
+32,125,59,32,125,'\n',35,101,108,105,102,32,100,101,102,105,
+110,101,100,40,95,95,83,67,79,85,84,41,'\n',32,32,32,
+32,47,47,32,83,67,79,85,84,'\n',32,32,32,32,95,95,
+110,111,108,105,115,116,32,118,111,105,100,32,77,117,116,101,
+83,111,117,110,100,40,41,32,32,32,32,32,32,32,123,32,
+97,115,109,32,123,32,48,120,53,55,44,32,48,120,56,48,
+32,125,59,32,125,'\n',32,32,32,32,95,95,110,111,108,105,
+115,116,32,118,111,105,100,32,85,110,109,117,116,101,83,111,
+117,110,100,40,41,32,32,32,32,32,123,32,97,115,109,32,
+123,32,48,120,53,55,44,32,48,120,99,48,32,125,59,32,
+125,'\n',32,32,32,32,95,95,110,111,108,105,115,116,32,118,
+111,105,100,32,83,101,108,101,99,116,83,111,117,110,100,115,
+40,99,111,110,115,116,32,105,110,116,32,103,114,111,117,112,
+41,32,123,32,97,115,109,32,123,32,48,120,53,55,44,32,
+103,114,111,117,112,32,125,59,32,125,'\n',35,101,110,100,105,
+102,'\n','\n','\n','\n',47,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+'\n',32,42,32,68,105,115,112,108,97,121,'\n',32,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,47,'\n','\n',35,105,102,32,100,101,
+102,105,110,101,100,40,95,95,82,67,88,41,32,124,124,32,
+100,101,102,105,110,101,100,40,95,95,83,87,65,78,41,'\n',
+32,32,32,32,47,47,32,115,101,116,32,116,104,101,32,100,
+105,115,112,108,97,121,32,109,111,100,101,'\n',32,32,32,32,
+95,95,110,111,108,105,115,116,32,118,111,105,100,32,83,101,
+108,101,99,116,68,105,115,112,108,97,121,40,99,111,110,115,
+116,32,105,110,116,32,38,118,41,32,123,32,97,115,109,32,
+123,32,48,120,51,51,44,32,36,118,32,58,32,95,95,65,
+83,77,95,83,82,67,95,66,65,83,73,67,125,59,32,125,
+'\n','\n',32,32,32,32,47,47,32,100,105,115,112,108,97,121,
+32,109,111,100,101,115,32,45,32,102,111,114,32,83,101,108,
+101,99,116,68,105,115,112,108,97,121,'\n',32,32,32,32,35,
+100,101,102,105,110,101,32,68,73,83,80,76,65,89,95,87,
+65,84,67,72,32,32,32,32,32,32,32,48,'\n',32,32,32,
+32,35,100,101,102,105,110,101,32,68,73,83,80,76,65,89,
+95,83,69,78,83,79,82,95,49,32,32,32,32,49,'\n',32,
+32,32,32,35,100,101,102,105,110,101,32,68,73,83,80,76,
+65,89,95,83,69,78,83,79,82,95,50,32,32,32,32,50,
+'\n',32,32,32,32,35,100,101,102,105,110,101,32,68,73,83,
+80,76,65,89,95,83,69,78,83,79,82,95,51,32,32,32,
+32,51,'\n',32,32,32,32,35,100,101,102,105,110,101,32,68,
+73,83,80,76,65,89,95,79,85,84,95,65,32,32,32,32,
+32,32,32,52,'\n',32,32,32,32,35,100,101,102,105,110,101,
+32,68,73,83,80,76,65,89,95,79,85,84,95,66,32,32,
+32,32,32,32,32,53,'\n',32,32,32,32,35,100,101,102,105,
+110,101,32,68,73,83,80,76,65,89,95,79,85,84,95,67,
+32,32,32,32,32,32,32,54,'\n','\n',32,32,32,32,35,105,
+102,32,95,95,82,67,88,61,61,50,32,124,124,32,100,101,
+102,105,110,101,100,40,95,95,83,87,65,78,41,'\n',32,32,
+32,32,32,32,32,32,35,100,101,102,105,110,101,32,68,73,
+83,80,76,65,89,95,85,83,69,82,32,32,32,32,55,'\n',
+32,32,32,32,32,32,32,32,95,95,110,111,108,105,115,116,
+32,118,111,105,100,32,83,101,116,85,115,101,114,68,105,115,
+112,108,97,121,40,99,111,110,115,116,32,105,110,116,32,38,
+118,44,32,99,111,110,115,116,32,105,110,116,32,112,114,101,
+99,41,32,123,32,97,115,109,32,123,32,48,120,101,53,44,
+32,48,44,32,112,114,101,99,44,32,36,118,32,58,32,95,
+95,65,83,77,95,78,79,95,76,79,67,65,76,32,125,59,
+32,125,'\n',32,32,32,32,35,101,110,100,105,102,'\n','\n',32,
+32,32,32,35,105,102,32,100,101,102,105,110,101,100,40,95,
+95,83,87,65,78,41,'\n',32,32,32,32,32,32,32,32,35,
+100,101,102,105,110,101,32,68,73,83,80,76,65,89,95,69,
+88,67,69,80,84,73,79,78,32,32,32,56,'\n',32,32,32,
+32,35,101,110,100,105,102,'\n',35,101,110,100,105,102,'\n','\n',
+'\n','\n',47,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,'\n',32,42,
+32,99,111,109,109,117,110,105,99,97,116,105,111,110,'\n',32,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,47,'\n','\n',35,105,102,
+32,100,101,102,105,110,101,100,40,95,95,83,80,89,41,32,
+124,124,32,100,101,102,105,110,101,100,40,95,95,83,67,79,
+85,84,41,'\n',32,32,32,32,35,105,102,32,100,101,102,105,
+110,101,100,40,95,95,83,80,89,41,'\n',32,32,32,32,32,
+32,32,32,35,100,101,102,105,110,101,32,86,76,76,40,41,
+32,32,32,64,40,48,120,102,48,48,48,48,41,32,32,47,
+47,32,114,101,97,100,32,116,104,101,32,109,101,115,115,97,
+103,101,32,98,117,102,102,101,114,'\n',32,32,32,32,35,101,
+110,100,105,102,'\n',32,32,32,32,47,47,32,83,99,111,117,
+116,32,97,110,100,32,83,112,121,98,111,116,32,99,97,110,
+32,115,101,110,100,32,86,76,76,32,99,111,109,109,97,110,
+100,115,'\n',32,32,32,32,95,95,110,111,108,105,115,116,32,
+118,111,105,100,32,83,101,110,100,86,76,76,40,99,111,110,
+115,116,32,105,110,116,32,38,120,41,32,123,32,97,115,109,
+32,123,32,48,120,101,50,44,32,36,120,32,58,32,95,95,
+65,83,77,95,83,77,65,76,76,95,86,65,76,85,69,32,
+43,32,95,95,65,83,77,95,83,82,67,95,66,65,83,73,
+67,125,59,32,125,'\n',35,101,110,100,105,102,'\n','\n','\n',35,
+105,102,32,100,101,102,105,110,101,100,40,95,95,82,67,88,
+41,32,124,124,32,100,101,102,105,110,101,100,40,95,95,83,
+67,79,85,84,41,32,124,124,32,100,101,102,105,110,101,100,
+40,95,95,83,87,65,78,41,'\n',32,32,32,32,47,47,32,
+83,99,111,117,116,32,97,110,100,32,82,67,88,32,104,97,
+118,101,32,73,82,32,109,101,115,115,97,103,101,32,99,97,
+112,97,98,105,108,105,116,121,'\n',32,32,32,32,35,100,101,
+102,105,110,101,32,77,101,115,115,97,103,101,40,41,32,32,
+32,64,40,48,120,102,48,48,48,48,41,32,32,47,47,32,
+114,101,97,100,32,116,104,101,32,109,101,115,115,97,103,101,
+32,98,117,102,102,101,114,'\n','\n',32,32,32,32,95,95,110,
+111,108,105,115,116,32,118,111,105,100,32,83,101,110,100,77,
+101,115,115,97,103,101,40,99,111,110,115,116,32,105,110,116,
+32,38,118,41,32,123,32,97,115,109,32,123,32,48,120,98,
+50,44,32,36,118,32,58,32,95,95,65,83,77,95,83,77,
+65,76,76,95,86,65,76,85,69,32,43,32,95,95,65,83,
+77,95,83,82,67,95,66,65,83,73,67,125,59,32,125,'\n',
+32,32,32,32,95,95,110,111,108,105,115,116,32,118,111,105,
+100,32,67,108,101,97,114,77,101,115,115,97,103,101,40,41,
+32,32,32,32,32,32,32,32,32,32,32,32,123,32,97,115,
+109,32,123,32,48,120,57,48,32,125,59,32,125,'\n','\n',32,
+32,32,32,35,105,102,32,95,95,82,67,88,61,61,50,32,
+124,124,32,100,101,102,105,110,101,100,40,95,95,83,87,65,
+78,41,'\n',32,32,32,32,32,32,32,32,95,95,110,111,108,
+105,115,116,32,118,111,105,100,32,83,101,116,77,101,115,115,
+97,103,101,40,99,111,110,115,116,32,105,110,116,32,109,41,
+32,32,32,123,32,97,115,109,32,123,32,48,120,102,55,44,
+32,109,32,125,59,32,125,'\n',32,32,32,32,35,101,110,100,
+105,102,'\n','\n','\n',32,32,32,32,35,105,102,32,100,101,102,
+105,110,101,100,40,95,95,83,87,65,78,41,'\n',32,32,32,
+32,32,32,32,32,35,100,101,102,105,110,101,32,77,101,115,
+115,97,103,101,80,97,114,97,109,40,41,32,32,64,40,48,
+120,102,48,48,48,49,41,32,47,47,32,114,101,97,100,32,
+116,104,101,32,109,115,103,32,112,97,114,97,109,'\n',32,32,
+32,32,32,32,32,32,95,95,110,111,108,105,115,116,32,118,
+111,105,100,32,83,101,110,100,77,101,115,115,97,103,101,87,
+105,116,104,80,97,114,97,109,40,99,111,110,115,116,32,105,
+110,116,32,38,109,44,32,99,111,110,115,116,32,105,110,116,
+32,38,112,41,'\n',32,32,32,32,32,32,32,32,32,32,123,
+32,97,115,109,32,123,32,48,120,99,51,44,32,36,109,32,
+58,32,95,95,65,83,77,95,83,77,65,76,76,95,86,65,
+76,85,69,32,43,32,95,95,65,83,77,95,83,82,67,95,
+69,88,84,44,32,36,112,32,58,32,95,95,65,83,77,95,
+83,82,67,95,69,88,84,125,59,32,125,'\n',32,32,32,32,
+32,32,32,32,95,95,110,111,108,105,115,116,32,118,111,105,
+100,32,83,101,116,77,101,115,115,97,103,101,66,121,116,101,
+80,97,114,97,109,40,99,111,110,115,116,32,105,110,116,32,
+109,44,32,99,111,110,115,116,32,105,110,116,32,112,41,32,
+123,32,97,115,109,32,123,32,48,120,97,50,44,32,109,44,
+32,112,125,59,32,125,'\n',32,32,32,32,32,32,32,32,95,
+95,110,111,108,105,115,116,32,118,111,105,100,32,83,101,116,
+77,101,115,115,97,103,101,87,111,114,100,80,97,114,97,109,
+40,99,111,110,115,116,32,105,110,116,32,109,44,32,99,111,
+110,115,116,32,105,110,116,32,112,41,32,123,32,97,115,109,
+32,123,32,48,120,98,51,44,32,109,44,32,112,44,32,112,
+62,62,56,125,59,32,125,'\n',32,32,32,32,32,32,32,32,
+95,95,110,111,108,105,115,116,32,118,111,105,100,32,83,101,
+116,77,101,115,115,97,103,101,86,97,114,105,97,98,108,101,
+80,97,114,97,109,40,99,111,110,115,116,32,105,110,116,32,
+38,109,44,32,99,111,110,115,116,32,105,110,116,32,38,112,
+41,'\n',32,32,32,32,32,32,32,32,32,32,123,32,97,115,
+109,32,123,32,48,120,99,52,44,32,36,109,32,58,32,95,
+95,65,83,77,95,83,77,65,76,76,95,86,65,76,85,69,
+32,43,32,95,95,65,83,77,95,83,82,67,95,69,88,84,
+44,32,36,112,32,58,32,95,95,65,83,77,95,83,82,67,
+95,69,88,84,125,59,32,125,'\n',32,32,32,32,35,101,110,
+100,105,102,'\n','\n',35,101,110,100,105,102,'\n','\n','\n',35,105,
+102,32,95,95,82,67,88,61,61,50,32,124,124,32,100,101,
+102,105,110,101,100,40,95,95,83,80,89,41,32,124,124,32,
+100,101,102,105,110,101,100,40,95,95,83,87,65,78,41,'\n',
+32,32,35,105,102,32,95,95,82,67,88,61,61,50,32,124,
+124,32,100,101,102,105,110,101,100,40,95,95,83,87,65,78,
+41,'\n',32,32,32,32,47,47,32,115,101,114,105,97,108,32,
+99,111,109,109,117,110,105,99,97,116,105,111,110,32,115,111,
+117,114,99,101,115,'\n',32,32,32,32,35,100,101,102,105,110,
+101,32,83,101,114,105,97,108,80,97,99,107,101,116,40,41,
+32,32,64,40,48,120,50,49,48,48,49,48,41,'\n',32,32,
+32,32,35,100,101,102,105,110,101,32,83,101,114,105,97,108,
+67,111,109,109,40,41,32,32,32,32,64,40,48,120,50,49,
+48,48,49,49,41,'\n',32,32,32,32,95,95,110,111,108,105,
+115,116,32,118,111,105,100,32,83,101,116,83,101,114,105,97,
+108,80,97,99,107,101,116,40,99,111,110,115,116,32,105,110,
+116,32,38,118,41,32,123,32,83,101,116,40,83,101,114,105,
+97,108,80,97,99,107,101,116,40,41,44,32,118,41,59,32,
+125,'\n',32,32,32,32,95,95,110,111,108,105,115,116,32,118,
+111,105,100,32,83,101,116,83,101,114,105,97,108,67,111,109,
+109,40,99,111,110,115,116,32,105,110,116,32,38,118,41,32,
+32,32,123,32,83,101,116,40,83,101,114,105,97,108,67,111,
+109,109,40,41,44,32,118,41,59,32,125,'\n','\n',32,32,32,
+32,47,47,32,118,97,108,117,101,115,32,102,111,114,32,83,
+101,114,80,97,99,107,101,116,'\n',32,32,32,32,35,100,101,
+102,105,110,101,32,83,69,82,73,65,76,95,80,65,67,75,
+69,84,95,68,69,70,65,85,76,84,32,32,32,48,32,32,
+32,47,47,32,114,97,119,32,115,101,114,105,97,108,44,32,
+110,111,32,99,104,101,99,107,115,117,109,44,32,110,111,32,
+112,114,101,97,109,98,108,101,'\n',32,32,32,32,35,100,101,
+102,105,110,101,32,83,69,82,73,65,76,95,80,65,67,75,
+69,84,95,80,82,69,65,77,66,76,69,32,32,49,'\n',32,
+32,32,32,35,100,101,102,105,110,101,32,83,69,82,73,65,
+76,95,80,65,67,75,69,84,95,78,69,71,65,84,69,68,
+32,32,32,50,32,32,32,47,47,32,105,110,99,108,117,100,
+101,115,32,99,104,101,99,107,115,117,109,'\n',32,32,32,32,
+35,100,101,102,105,110,101,32,83,69,82,73,65,76,95,80,
+65,67,75,69,84,95,67,72,69,67,75,83,85,77,32,32,
+52,32,32,32,47,47,32,117,115,101,32,116,104,105,115,32,
+102,111,114,32,99,104,101,99,107,115,117,109,32,119,47,111,
+32,110,101,103,97,116,101,100,'\n','\n',32,32,32,32,35,100,
+101,102,105,110,101,32,83,69,82,73,65,76,95,80,65,67,
+75,69,84,95,82,67,88,32,32,32,32,32,32,32,40,83,
+69,82,73,65,76,95,80,65,67,75,69,84,95,80,82,69,
+65,77,66,76,69,32,43,32,83,69,82,73,65,76,95,80,
+65,67,75,69,84,95,78,69,71,65,84,69,68,41,'\n',32,
+32,32,32,35,100,101,102,105,110,101,32,83,69,82,73,65,
+76,95,80,65,67,75,69,84,95,82,67,32,32,32,32,32,
+32,32,32,48,32,32,32,47,47,32,100,101,102,97,117,108,
+116,'\n',32,32,32,32,35,100,101,102,105,110,101,32,83,69,
+82,73,65,76,95,80,65,67,75,69,84,95,83,80,89,66,
+79,84,32,32,32,32,48,'\n','\n',32,32,32,32,47,47,32,
+118,97,108,117,101,115,32,102,111,114,32,83,101,114,67,111,
+109,109,'\n',32,32,32,32,35,100,101,102,105,110,101,32,83,
+69,82,73,65,76,95,67,79,77,77,95,68,69,70,65,85,
+76,84,32,32,32,32,32,48,'\n',32,32,32,32,35,100,101,
+102,105,110,101,32,83,69,82,73,65,76,95,67,79,77,77,
+95,52,56,48,48,32,32,32,32,32,32,32,32,49,32,32,
+32,47,47,32,100,101,102,97,117,108,116,32,105,115,32,50,
+52,48,48,32,98,97,117,100,'\n',32,32,32,32,35,100,101,
+102,105,110,101,32,83,69,82,73,65,76,95,67,79,77,77,
+95,55,54,75,72,90,32,32,32,32,32,32,32,50,32,32,
+32,47,47,32,100,101,102,97,117,108,116,32,105,115,32,51,
+56,107,72,122,'\n',32,32,32,32,35,100,101,102,105,110,101,
+32,83,69,82,73,65,76,95,67,79,77,77,95,68,85,84,
+89,50,53,32,32,32,32,32,32,52,32,32,32,47,47,32,
+100,101,102,97,117,108,116,32,105,115,32,53,48,37,32,100,
+117,116,121,32,99,121,99,108,101,'\n','\n',32,32,32,32,35,
+100,101,102,105,110,101,32,83,69,82,73,65,76,95,67,79,
+77,77,95,82,67,88,32,32,32,32,32,32,32,32,32,48,
+'\n',32,32,32,32,35,100,101,102,105,110,101,32,83,69,82,
+73,65,76,95,67,79,77,77,95,82,67,32,32,32,32,32,
+32,32,32,32,32,55,32,32,32,47,47,32,52,56,48,48,
+47,55,54,75,72,90,47,50,53,37,'\n',32,32,32,32,35,
+100,101,102,105,110,101,32,83,69,82,73,65,76,95,67,79,
+77,77,95,83,80,89,66,79,84,32,32,32,32,32,32,55,
+32,32,32,47,47,32,119,97,115,32,83,69,82,73,65,76,
+95,67,79,77,77,95,52,56,48,48,32,43,32,83,69,82,
+73,65,76,95,67,79,77,77,95,55,54,75,72,90,'\n','\n',
+32,32,32,32,35,105,102,100,101,102,32,95,95,83,87,65,
+78,'\n',32,32,32,32,32,32,32,32,35,100,101,102,105,110,
+101,32,83,69,82,73,65,76,95,67,79,77,77,95,57,54,
+48,48,32,32,32,32,32,32,32,32,56,'\n',32,32,32,32,
+32,32,32,32,35,100,101,102,105,110,101,32,68,101,102,97,
+117,108,116,83,101,114,105,97,108,80,97,99,107,101,116,40,
+41,32,32,32,64,40,48,120,50,49,48,48,49,50,41,'\n',
+32,32,32,32,32,32,32,32,35,100,101,102,105,110,101,32,
+68,101,102,97,117,108,116,83,101,114,105,97,108,67,111,109,
+109,40,41,32,32,32,32,32,64,40,48,120,50,49,48,48,
+49,51,41,'\n',32,32,32,32,32,32,32,32,95,95,110,111,
+108,105,115,116,32,118,111,105,100,32,83,101,116,68,101,102,
+97,117,108,116,83,101,114,105,97,108,80,97,99,107,101,116,
+40,99,111,110,115,116,32,105,110,116,32,38,118,41,32,32,
+123,32,83,101,116,40,68,101,102,97,117,108,116,83,101,114,
+105,97,108,80,97,99,107,101,116,40,41,44,32,118,41,59,
+32,125,'\n',32,32,32,32,32,32,32,32,95,95,110,111,108,
+105,115,116,32,118,111,105,100,32,83,101,116,68,101,102,97,
+117,108,116,83,101,114,105,97,108,67,111,109,109,40,99,111,
+110,115,116,32,105,110,116,32,38,118,41,32,32,32,32,123,
+32,83,101,116,40,68,101,102,97,117,108,116,83,101,114,105,
+97,108,67,111,109,109,40,41,44,32,118,41,59,32,125,'\n',
+32,32,32,32,35,101,110,100,105,102,'\n','\n',32,32,32,32,
+47,47,32,65,80,73,32,102,111,114,32,105,110,116,101,114,
+97,99,116,105,110,103,32,119,105,116,104,32,83,112,121,98,
+111,116,32,97,110,100,32,111,116,104,101,114,32,82,67,32,
+99,111,109,112,111,110,101,110,116,115,'\n',32,32,32,32,35,
+100,101,102,105,110,101,32,77,83,71,95,66,82,79,65,68,
+67,65,83,84,32,32,32,48,120,56,97,'\n',32,32,32,32,
+35,100,101,102,105,110,101,32,77,83,71,95,76,73,78,75,
+67,65,83,84,32,32,32,32,48,120,56,57,'\n',32,32,32,
+32,35,100,101,102,105,110,101,32,77,83,71,95,68,73,82,
+69,67,84,32,32,32,32,32,32,48,120,56,56,'\n','\n',32,
+32,32,32,47,47,32,98,97,115,101,32,97,100,100,114,101,
+115,115,101,115,32,102,111,114,32,117,97,114,116,32,100,97,
+116,97,'\n',32,32,32,32,35,100,101,102,105,110,101,32,85,
+65,82,84,95,66,79,84,32,32,32,32,48,'\n',32,32,32,
+32,35,100,101,102,105,110,101,32,85,65,82,84,95,67,84,
+82,76,32,32,32,55,'\n',32,32,32,32,35,100,101,102,105,
+110,101,32,85,65,82,84,95,80,73,78,71,32,32,32,57,
+'\n',32,32,32,32,35,100,101,102,105,110,101,32,85,65,82,
+84,95,82,67,32,32,32,32,32,49,49,'\n','\n',32,32,32,
+32,95,95,110,111,108,105,115,116,32,118,111,105,100,32,73,
+110,105,116,83,112,121,98,111,116,67,111,109,109,40,41,'\n',
+32,32,32,32,123,'\n',32,32,32,32,32,32,32,32,83,101,
+116,83,101,114,105,97,108,80,97,99,107,101,116,40,83,69,
+82,73,65,76,95,80,65,67,75,69,84,95,83,80,89,66,
+79,84,41,59,'\n',32,32,32,32,32,32,32,32,83,101,116,
+83,101,114,105,97,108,67,111,109,109,40,83,69,82,73,65,
+76,95,67,79,77,77,95,83,80,89,66,79,84,41,59,'\n',
+32,32,32,32,125,'\n','\n',32,32,32,32,95,95,110,111,108,
+105,115,116,32,118,111,105,100,32,83,101,110,100,83,112,121,
+98,111,116,77,115,103,40,41,32,32,32,123,32,83,101,110,
+100,83,101,114,105,97,108,40,85,65,82,84,95,66,79,84,
+44,32,55,41,59,32,125,'\n','\n',32,32,32,32,95,95,110,
+111,108,105,115,116,32,118,111,105,100,32,83,101,116,83,112,
+121,98,111,116,77,101,115,115,97,103,101,40,99,111,110,115,
+116,32,105,110,116,32,38,110,77,111,100,101,44,32,99,111,
+110,115,116,32,105,110,116,32,38,110,77,121,73,68,44,'\n',
+32,32,32,32,32,32,99,111,110,115,116,32,105,110,116,32,
+38,110,65,100,100,114,101,115,115,44,32,99,111,110,115,116,
+32,105,110,116,32,38,110,67,109,100,44,32,99,111,110,115,
+116,32,105,110,116,32,38,110,72,105,66,121,116,101,44,32,
+99,111,110,115,116,32,105,110,116,32,38,110,76,111,66,121,
+116,101,41,'\n',32,32,32,32,123,'\n',32,32,32,32,32,32,
+32,32,83,101,116,83,101,114,105,97,108,68,97,116,97,40,
+85,65,82,84,95,66,79,84,43,48,44,110,77,111,100,101,
+41,59,'\n',32,32,32,32,32,32,32,32,83,101,116,83,101,
+114,105,97,108,68,97,116,97,40,85,65,82,84,95,66,79,
+84,43,49,44,110,77,121,73,68,41,59,'\n',32,32,32,32,
+32,32,32,32,83,101,116,83,101,114,105,97,108,68,97,116,
+97,40,85,65,82,84,95,66,79,84,43,50,44,110,65,100,
+100,114,101,115,115,41,59,'\n',32,32,32,32,32,32,32,32,
+83,101,116,83,101,114,105,97,108,68,97,116,97,40,85,65,
+82,84,95,66,79,84,43,51,44,110,67,109,100,41,59,'\n',
+32,32,32,32,32,32,32,32,83,101,116,83,101,114,105,97,
+108,68,97,116,97,40,85,65,82,84,95,66,79,84,43,52,
+44,110,72,105,66,121,116,101,41,59,'\n',32,32,32,32,32,
+32,32,32,83,101,116,83,101,114,105,97,108,68,97,116,97,
+40,85,65,82,84,95,66,79,84,43,53,44,110,76,111,66,
+121,116,101,41,59,'\n',32,32,32,32,32,32,32,32,83,101,
+116,83,101,114,105,97,108,68,97,116,97,40,85,65,82,84,
+95,66,79,84,43,54,44,48,45,110,77,111,100,101,45,110,
+77,121,73,68,45,110,65,100,100,114,101,115,115,45,110,67,
+109,100,45,110,72,105,66,121,116,101,45,110,76,111,66,121,
+116,101,41,59,'\n',47,47,32,32,32,32,32,32,83,101,116,
+83,101,114,105,97,108,68,97,116,97,40,85,65,82,84,95,
+66,79,84,43,54,44,48,120,49,48,48,45,40,40,110,77,
+111,100,101,43,110,77,121,73,68,43,110,65,100,100,114,101,
+115,115,43,110,67,109,100,43,110,72,105,66,121,116,101,43,
+110,76,111,66,121,116,101,41,38,48,120,102,102,41,41,59,
+'\n',32,32,32,32,125,'\n','\n',32,32,32,32,95,95,110,111,
+108,105,115,116,32,118,111,105,100,32,83,101,110,100,83,112,
+121,98,111,116,77,101,115,115,97,103,101,40,99,111,110,115,
+116,32,105,110,116,32,38,110,77,111,100,101,44,32,99,111,
+110,115,116,32,105,110,116,32,38,110,77,121,73,68,44,'\n',
+32,32,32,32,32,32,99,111,110,115,116,32,105,110,116,32,
+38,110,65,100,100,114,101,115,115,44,32,99,111,110,115,116,
+32,105,110,116,32,38,110,67,109,100,44,32,99,111,110,115,
+116,32,105,110,116,32,38,110,72,105,66,121,116,101,44,32,
+99,111,110,115,116,32,105,110,116,32,38,110,76,111,66,121,
+116,101,41,'\n',32,32,32,32,123,'\n',32,32,32,32,32,32,
+32,32,73,110,105,116,83,112,121,98,111,116,67,111,109,109,
+40,41,59,'\n',32,32,32,32,32,32,32,32,83,101,116,83,
+112,121,98,111,116,77,101,115,115,97,103,101,40,110,77,111,
+100,101,44,32,110,77,121,73,68,44,32,110,65,100,100,114,
+101,115,115,44,32,110,67,109,100,44,32,110,72,105,66,121,
+116,101,44,32,110,76,111,66,121,116,101,41,59,'\n',32,32,
+32,32,32,32,32,32,83,101,110,100,83,112,121,98,111,116,
+77,115,103,40,41,59,'\n',32,32,32,32,125,'\n','\n',32,32,
+32,32,47,47,32,83,112,121,98,111,116,32,99,111,110,116,
+114,111,108,108,101,114,32,99,111,109,109,97,110,100,115,'\n',
+32,32,32,32,35,100,101,102,105,110,101,32,83,80,89,95,
+67,84,82,76,95,66,84,78,95,49,32,32,48,120,48,49,
+'\n',32,32,32,32,35,100,101,102,105,110,101,32,83,80,89,
+95,67,84,82,76,95,66,84,78,95,50,32,32,48,120,48,
+50,'\n',32,32,32,32,35,100,101,102,105,110,101,32,83,80,
+89,95,67,84,82,76,95,66,84,78,95,51,32,32,48,120,
+48,51,'\n',32,32,32,32,35,100,101,102,105,110,101,32,83,
+80,89,95,67,84,82,76,95,66,84,78,95,52,32,32,48,
+120,48,52,'\n',32,32,32,32,35,100,101,102,105,110,101,32,
+83,80,89,95,67,84,82,76,95,66,84,78,95,53,32,32,
+48,120,48,53,'\n',32,32,32,32,35,100,101,102,105,110,101,
+32,83,80,89,95,67,84,82,76,95,82,67,88,95,49,32,
+32,48,120,48,54,32,32,32,32,47,47,82,67,88,32,116,
+111,32,83,112,121,98,111,116,32,115,112,101,99,105,102,105,
+99,'\n',32,32,32,32,35,100,101,102,105,110,101,32,83,80,
+89,95,67,84,82,76,95,82,67,88,95,50,32,32,48,120,
+48,55,'\n',32,32,32,32,35,100,101,102,105,110,101,32,83,
+80,89,95,67,84,82,76,95,82,67,88,95,51,32,32,48,
+120,48,56,'\n',32,32,32,32,35,100,101,102,105,110,101,32,
+83,80,89,95,67,84,82,76,95,82,67,88,95,52,32,32,
+48,120,48,57,'\n',32,32,32,32,35,100,101,102,105,110,101,
+32,83,80,89,95,67,84,82,76,95,82,67,88,95,53,32,
+32,48,120,48,97,'\n',32,32,32,32,35,100,101,102,105,110,
+101,32,83,80,89,95,67,84,82,76,95,82,67,88,95,54,
+32,32,48,120,48,98,'\n',32,32,32,32,35,100,101,102,105,
+110,101,32,83,80,89,95,67,84,82,76,95,82,67,88,95,
+55,32,32,48,120,48,99,'\n',32,32,32,32,35,100,101,102,
+105,110,101,32,83,80,89,95,67,84,82,76,95,82,67,88,
+95,56,32,32,48,120,48,100,'\n','\n',32,32,32,32,35,100,
+101,102,105,110,101,32,95,95,83,80,89,95,67,84,82,76,
+95,67,77,68,32,32,48,120,57,48,'\n','\n',32,32,32,32,
+95,95,110,111,108,105,115,116,32,118,111,105,100,32,83,101,
+110,100,83,112,121,98,111,116,67,116,114,108,77,115,103,40,
+41,32,32,32,123,32,83,101,110,100,83,101,114,105,97,108,
+40,85,65,82,84,95,67,84,82,76,44,32,50,41,59,32,
+125,'\n','\n',32,32,32,32,95,95,110,111,108,105,115,116,32,
+118,111,105,100,32,83,101,116,83,112,121,98,111,116,67,116,
+114,108,77,101,115,115,97,103,101,40,99,111,110,115,116,32,
+105,110,116,32,38,110,77,121,73,68,44,32,99,111,110,115,
+116,32,105,110,116,32,38,110,77,115,103,41,'\n',32,32,32,
+32,123,'\n',32,32,32,32,32,32,32,32,83,101,116,83,101,
+114,105,97,108,68,97,116,97,40,85,65,82,84,95,67,84,
+82,76,43,48,44,95,95,83,80,89,95,67,84,82,76,95,
+67,77,68,43,110,77,121,73,68,41,59,'\n',32,32,32,32,
+32,32,32,32,83,101,116,83,101,114,105,97,108,68,97,116,
+97,40,85,65,82,84,95,67,84,82,76,43,49,44,40,110,
+77,115,103,32,42,32,49,54,41,32,43,32,40,40,48,32,
+45,32,40,40,95,95,83,80,89,95,67,84,82,76,95,67,
+77,68,43,110,77,121,73,68,41,32,47,32,49,54,41,32,
+45,32,40,95,95,83,80,89,95,67,84,82,76,95,67,77,
+68,43,110,77,121,73,68,41,32,45,32,110,77,115,103,41,
+32,38,32,48,120,48,102,41,41,59,'\n',32,32,32,32,125,
+'\n','\n',32,32,32,32,95,95,110,111,108,105,115,116,32,118,
+111,105,100,32,83,101,110,100,83,112,121,98,111,116,67,116,
+114,108,77,101,115,115,97,103,101,40,99,111,110,115,116,32,
+105,110,116,32,38,110,77,121,73,68,44,32,99,111,110,115,
+116,32,105,110,116,32,38,110,77,115,103,41,'\n',32,32,32,
+32,123,'\n',32,32,32,32,32,32,32,32,73,110,105,116,83,
+112,121,98,111,116,67,111,109,109,40,41,59,'\n',32,32,32,
+32,32,32,32,32,83,101,116,83,112,121,98,111,116,67,116,
+114,108,77,101,115,115,97,103,101,40,110,77,121,73,68,44,
+32,110,77,115,103,41,59,'\n',32,32,32,32,32,32,32,32,
+83,101,110,100,83,112,121,98,111,116,67,116,114,108,77,115,
+103,40,41,59,'\n',32,32,32,32,125,'\n','\n',32,32,32,32,
+95,95,110,111,108,105,115,116,32,118,111,105,100,32,83,101,
+110,100,83,112,121,98,111,116,67,116,114,108,80,105,110,103,
+77,115,103,40,41,32,32,32,123,32,83,101,110,100,83,101,
+114,105,97,108,40,85,65,82,84,95,80,73,78,71,44,32,
+50,41,59,32,125,'\n','\n',32,32,32,32,95,95,110,111,108,
+105,115,116,32,118,111,105,100,32,83,101,116,83,112,121,98,
+111,116,67,116,114,108,80,105,110,103,77,101,115,115,97,103,
+101,40,99,111,110,115,116,32,105,110,116,32,38,110,73,68,
+41,'\n',32,32,32,32,123,'\n',32,32,32,32,32,32,32,32,
+83,101,116,83,101,114,105,97,108,68,97,116,97,40,85,65,
+82,84,95,80,73,78,71,43,48,44,95,95,83,80,89,95,
+67,84,82,76,95,67,77,68,43,110,73,68,41,59,'\n',32,
+32,32,32,32,32,32,32,83,101,116,83,101,114,105,97,108,
+68,97,116,97,40,85,65,82,84,95,80,73,78,71,43,49,
+44,40,48,32,45,32,40,40,95,95,83,80,89,95,67,84,
+82,76,95,67,77,68,43,110,73,68,41,32,47,32,49,54,
+41,32,45,32,40,95,95,83,80,89,95,67,84,82,76,95,
+67,77,68,43,110,73,68,41,41,32,38,32,48,120,48,102,
+41,59,'\n',32,32,32,32,125,'\n','\n',32,32,32,32,95,95,
+110,111,108,105,115,116,32,118,111,105,100,32,83,101,110,100,
+83,112,121,98,111,116,67,116,114,108,80,105,110,103,77,101,
+115,115,97,103,101,40,99,111,110,115,116,32,105,110,116,32,
+38,110,73,68,41,'\n',32,32,32,32,123,'\n',32,32,32,32,
+32,32,32,32,73,110,105,116,83,112,121,98,111,116,67,111,
+109,109,40,41,59,'\n',32,32,32,32,32,32,32,32,83,101,
+116,83,112,121,98,111,116,67,116,114,108,80,105,110,103,77,
+101,115,115,97,103,101,40,110,73,68,41,59,'\n',32,32,32,
+32,32,32,32,32,83,101,110,100,83,112,121,98,111,116,67,
+116,114,108,80,105,110,103,77,115,103,40,41,59,'\n',32,32,
+32,32,125,'\n','\n',32,32,32,32,95,95,110,111,108,105,115,
+116,32,118,111,105,100,32,83,101,110,100,83,112,121,98,111,
+116,80,105,110,103,77,115,103,40,41,32,32,32,123,32,83,
+101,110,100,83,101,114,105,97,108,40,85,65,82,84,95,80,
+73,78,71,44,32,52,41,59,32,125,'\n','\n',32,32,32,32,
+95,95,110,111,108,105,115,116,32,118,111,105,100,32,83,101,
+116,83,112,121,98,111,116,80,105,110,103,40,99,111,110,115,
+116,32,105,110,116,32,38,110,76,105,110,107,73,68,44,32,
+99,111,110,115,116,32,105,110,116,32,38,110,77,121,73,68,
+44,32,99,111,110,115,116,32,105,110,116,32,38,110,73,110,
+102,111,41,'\n',32,32,32,32,123,'\n',32,32,32,32,32,32,
+32,32,83,101,116,83,101,114,105,97,108,68,97,116,97,40,
+85,65,82,84,95,80,73,78,71,43,48,44,48,120,56,48,
+43,40,110,76,105,110,107,73,68,38,48,120,55,41,41,59,
+'\n',32,32,32,32,32,32,32,32,83,101,116,83,101,114,105,
+97,108,68,97,116,97,40,85,65,82,84,95,80,73,78,71,
+43,49,44,110,77,121,73,68,41,59,'\n',32,32,32,32,32,
+32,32,32,83,101,116,83,101,114,105,97,108,68,97,116,97,
+40,85,65,82,84,95,80,73,78,71,43,50,44,110,73,110,
+102,111,41,59,'\n',32,32,32,32,32,32,32,32,83,101,116,
+83,101,114,105,97,108,68,97,116,97,40,85,65,82,84,95,
+80,73,78,71,43,51,44,48,45,40,48,120,56,48,43,40,
+110,76,105,110,107,73,68,38,48,120,55,41,41,45,110,77,
+121,73,68,45,110,73,110,102,111,41,59,'\n',47,47,32,32,
+32,32,32,32,83,101,116,83,101,114,105,97,108,68,97,116,
+97,40,85,65,82,84,95,80,73,78,71,43,51,44,48,120,
+49,48,48,45,40,40,48,120,56,48,43,40,110,76,105,110,
+107,73,68,38,48,120,55,41,43,110,77,121,73,68,43,110,
+73,110,102,111,41,38,48,120,102,102,41,41,59,'\n',32,32,
+32,32,125,'\n','\n',32,32,32,32,95,95,110,111,108,105,115,
+116,32,118,111,105,100,32,83,101,110,100,83,112,121,98,111,
+116,80,105,110,103,40,99,111,110,115,116,32,105,110,116,32,
+38,110,76,105,110,107,73,68,44,32,99,111,110,115,116,32,
+105,110,116,32,38,110,77,121,73,68,44,32,99,111,110,115,
+116,32,105,110,116,32,38,110,73,110,102,111,41,'\n',32,32,
+32,32,123,'\n',32,32,32,32,32,32,32,32,73,110,105,116,
+83,112,121,98,111,116,67,111,109,109,40,41,59,'\n',32,32,
+32,32,32,32,32,32,83,101,116,83,112,121,98,111,116,80,
+105,110,103,40,110,76,105,110,107,73,68,44,32,110,77,121,
+73,68,44,32,110,73,110,102,111,41,59,'\n',32,32,32,32,
+32,32,32,32,83,101,110,100,83,112,121,98,111,116,80,105,
+110,103,77,115,103,40,41,59,'\n',32,32,32,32,125,'\n','\n',
+32,32,32,32,47,47,32,82,67,32,99,104,97,110,110,101,
+108,115,32,97,110,100,32,99,111,109,109,97,110,100,115,'\n',
+32,32,32,32,35,100,101,102,105,110,101,32,82,67,95,67,
+72,65,78,78,69,76,95,49,32,32,32,32,48,120,53,48,
+'\n',32,32,32,32,35,100,101,102,105,110,101,32,82,67,95,
+67,72,65,78,78,69,76,95,50,32,32,32,32,48,120,54,
+48,'\n',32,32,32,32,35,100,101,102,105,110,101,32,82,67,
+95,67,72,65,78,78,69,76,95,51,32,32,32,32,48,120,
+55,48,'\n','\n',32,32,32,32,35,100,101,102,105,110,101,32,
+82,67,95,67,77,68,95,70,76,79,65,84,32,32,32,32,
+48,120,48,48,'\n',32,32,32,32,35,100,101,102,105,110,101,
+32,82,67,95,67,77,68,95,70,87,68,32,32,32,32,32,
+32,48,120,48,55,'\n',32,32,32,32,35,100,101,102,105,110,
+101,32,82,67,95,67,77,68,95,79,70,70,32,32,32,32,
+32,32,48,120,48,56,'\n',32,32,32,32,35,100,101,102,105,
+110,101,32,82,67,95,67,77,68,95,82,69,86,32,32,32,
+32,32,32,48,120,48,102,'\n','\n',32,32,32,32,95,95,110,
+111,108,105,115,116,32,118,111,105,100,32,73,110,105,116,82,
+67,67,111,109,109,40,41,'\n',32,32,32,32,123,'\n',32,32,
+32,32,32,32,32,32,83,101,116,83,101,114,105,97,108,80,
+97,99,107,101,116,40,83,69,82,73,65,76,95,80,65,67,
+75,69,84,95,82,67,41,59,'\n',32,32,32,32,32,32,32,
+32,83,101,116,83,101,114,105,97,108,67,111,109,109,40,83,
+69,82,73,65,76,95,67,79,77,77,95,82,67,41,59,'\n',
+32,32,32,32,125,'\n','\n',32,32,32,32,95,95,110,111,108,
+105,115,116,32,118,111,105,100,32,83,101,110,100,82,67,77,
+115,103,40,41,32,32,32,123,32,83,101,110,100,83,101,114,
+105,97,108,40,85,65,82,84,95,82,67,44,32,50,41,59,
+32,125,'\n','\n',32,32,32,32,95,95,110,111,108,105,115,116,
+32,118,111,105,100,32,83,101,116,82,67,77,101,115,115,97,
+103,101,40,99,111,110,115,116,32,105,110,116,32,38,110,67,
+104,97,110,110,101,108,44,32,99,111,110,115,116,32,105,110,
+116,32,38,110,76,101,102,116,44,32,99,111,110,115,116,32,
+105,110,116,32,38,110,82,105,103,104,116,41,'\n',32,32,32,
+32,123,'\n',32,32,32,32,32,32,32,32,83,101,116,83,101,
+114,105,97,108,68,97,116,97,40,85,65,82,84,95,82,67,
+43,48,44,110,67,104,97,110,110,101,108,32,43,32,110,76,
+101,102,116,41,59,'\n',32,32,32,32,32,32,32,32,83,101,
+116,83,101,114,105,97,108,68,97,116,97,40,85,65,82,84,
+95,82,67,43,49,44,40,110,82,105,103,104,116,32,42,32,
+49,54,41,32,43,32,40,40,48,32,45,32,110,82,105,103,
+104,116,32,45,32,110,76,101,102,116,32,45,32,40,110,67,
+104,97,110,110,101,108,32,47,32,49,54,41,41,32,38,32,
+48,120,48,102,41,41,59,'\n',32,32,32,32,125,'\n','\n',32,
+32,32,32,95,95,110,111,108,105,115,116,32,118,111,105,100,
+32,83,101,110,100,82,67,77,101,115,115,97,103,101,40,99,
+111,110,115,116,32,105,110,116,32,38,110,67,104,97,110,110,
+101,108,44,32,99,111,110,115,116,32,105,110,116,32,38,110,
+76,101,102,116,44,32,99,111,110,115,116,32,105,110,116,32,
+38,110,82,105,103,104,116,41,'\n',32,32,32,32,123,'\n',32,
+32,32,32,32,32,32,32,73,110,105,116,82,67,67,111,109,
+109,40,41,59,'\n',32,32,32,32,32,32,32,32,83,101,116,
+82,67,77,101,115,115,97,103,101,40,110,67,104,97,110,110,
+101,108,44,32,110,76,101,102,116,44,32,110,82,105,103,104,
+116,41,59,'\n',32,32,32,32,32,32,32,32,83,101,110,100,
+82,67,77,115,103,40,41,59,'\n',32,32,32,32,125,'\n','\n',
+'\n',32,32,35,101,110,100,105,102,'\n','\n',32,32,47,47,32,
+76,105,110,107,32,73,68,32,99,111,110,115,116,97,110,116,
+115,32,102,111,114,32,82,67,88,50,47,83,119,97,110,32,
+83,101,110,100,83,112,121,98,111,116,80,105,110,103,32,97,
+110,100,32,83,112,121,98,111,116,32,65,80,73,'\n',32,32,
+35,100,101,102,105,110,101,32,73,68,95,78,79,78,69,32,
+32,32,48,'\n',32,32,35,100,101,102,105,110,101,32,73,68,
+95,67,84,82,76,95,49,32,49,'\n',32,32,35,100,101,102,
+105,110,101,32,73,68,95,67,84,82,76,95,50,32,50,'\n',
+32,32,35,100,101,102,105,110,101,32,73,68,95,67,84,82,
+76,95,51,32,51,'\n',32,32,35,100,101,102,105,110,101,32,
+73,68,95,67,84,82,76,95,52,32,52,'\n',32,32,35,100,
+101,102,105,110,101,32,73,68,95,67,84,82,76,95,53,32,
+53,'\n',32,32,35,100,101,102,105,110,101,32,73,68,95,67,
+84,82,76,95,54,32,54,'\n',32,32,35,100,101,102,105,110,
+101,32,73,68,95,80,67,32,32,32,32,32,55,'\n','\n',32,
+32,47,47,32,109,121,32,114,111,98,111,116,32,73,68,32,
+109,105,110,32,97,110,100,32,109,97,120,32,118,97,108,117,
+101,115,'\n',32,32,35,100,101,102,105,110,101,32,73,68,95,
+66,79,84,95,77,73,78,32,32,32,32,56,'\n',32,32,35,
+100,101,102,105,110,101,32,73,68,95,66,79,84,95,77,65,
+88,32,32,32,32,50,53,53,'\n','\n',32,32,47,47,32,99,
+111,109,109,97,110,100,115,'\n',32,32,35,100,101,102,105,110,
+101,32,67,77,68,95,84,89,80,69,95,77,65,83,75,32,
+32,32,32,32,32,32,32,32,32,32,32,32,48,120,48,48,
+102,48,'\n','\n',32,32,35,100,101,102,105,110,101,32,67,77,
+68,95,84,89,80,69,95,71,65,77,69,32,32,32,32,32,
+32,32,32,32,32,32,32,32,48,120,49,48,'\n',32,32,35,
+100,101,102,105,110,101,32,67,77,68,95,71,65,77,69,95,
+83,84,65,82,84,32,32,32,32,32,32,32,32,32,32,32,
+32,48,120,49,48,'\n',32,32,35,100,101,102,105,110,101,32,
+67,77,68,95,71,65,77,69,95,67,79,77,77,65,78,68,
+32,32,32,32,32,32,32,32,32,32,48,120,49,49,'\n',32,
+32,35,100,101,102,105,110,101,32,67,77,68,95,71,65,77,
+69,95,71,69,84,86,65,82,32,32,32,32,32,32,32,32,
+32,32,32,48,120,49,50,'\n',32,32,35,100,101,102,105,110,
+101,32,67,77,68,95,71,65,77,69,95,86,65,76,85,69,
+32,32,32,32,32,32,32,32,32,32,32,32,48,120,49,51,
+'\n',32,32,35,100,101,102,105,110,101,32,67,77,68,95,71,
+65,77,69,95,87,73,78,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,48,120,49,52,'\n',32,32,35,100,101,102,
+105,110,101,32,67,77,68,95,71,65,77,69,95,76,79,83,
+69,32,32,32,32,32,32,32,32,32,32,32,32,32,48,120,
+49,53,'\n',32,32,35,100,101,102,105,110,101,32,67,77,68,
+95,71,65,77,69,95,66,76,73,78,75,32,32,32,32,32,
+32,32,32,32,32,32,32,48,120,49,54,'\n',32,32,35,100,
+101,102,105,110,101,32,67,77,68,95,71,65,77,69,95,71,
+73,86,69,32,32,32,32,32,32,32,32,32,32,32,32,32,
+48,120,49,55,'\n',32,32,35,100,101,102,105,110,101,32,67,
+77,68,95,71,65,77,69,95,84,65,75,69,32,32,32,32,
+32,32,32,32,32,32,32,32,32,48,120,49,56,'\n','\n',32,
+32,35,100,101,102,105,110,101,32,67,77,68,95,70,82,79,
+77,95,82,67,88,50,32,32,32,32,32,32,32,32,32,32,
+32,32,32,48,120,49,102,'\n','\n',47,47,102,105,114,101,32,
+99,111,109,109,97,110,100,32,112,114,111,116,111,99,111,108,
+58,32,60,110,66,111,116,62,44,32,48,120,50,48,32,43,
+32,60,102,105,114,101,67,111,109,109,97,110,100,62,44,32,
+60,112,97,114,97,109,49,62,44,32,60,112,97,114,97,109,
+50,62,'\n',47,47,32,32,32,32,32,32,112,97,114,97,109,
+49,58,32,116,97,114,103,101,116,32,97,115,112,101,99,116,
+32,40,105,101,32,102,114,111,110,116,44,32,98,97,99,107,
+44,32,102,114,111,110,116,32,108,101,102,116,46,46,46,41,
+'\n',47,47,32,32,32,32,32,32,112,97,114,97,109,50,58,
+32,115,116,114,101,110,103,116,104,'\n',32,32,35,100,101,102,
+105,110,101,32,67,77,68,95,84,89,80,69,95,70,73,82,
+69,32,32,32,32,32,32,32,32,32,32,32,32,32,48,120,
+50,48,'\n',32,32,35,100,101,102,105,110,101,32,67,77,68,
+95,70,73,82,69,95,76,65,83,69,82,32,32,32,32,32,
+32,32,32,32,32,32,32,48,120,50,49,'\n',32,32,35,100,
+101,102,105,110,101,32,67,77,68,95,70,73,82,69,95,83,
+80,73,78,78,69,82,32,32,32,32,32,32,32,32,32,32,
+48,120,50,50,'\n',32,32,35,100,101,102,105,110,101,32,67,
+77,68,95,70,73,82,69,95,69,76,69,67,84,82,79,78,
+69,84,32,32,32,32,32,32,32,48,120,50,51,'\n','\n',47,
+47,114,101,97,99,116,32,116,111,32,115,112,101,99,105,97,
+108,32,97,98,105,108,105,116,121,32,99,111,109,109,97,110,
+100,32,112,114,111,116,111,99,111,108,58,32,60,110,66,111,
+116,62,44,32,48,120,51,48,32,43,32,60,115,112,101,99,
+105,101,115,62,44,32,60,112,97,114,97,109,49,62,44,32,
+60,112,97,114,97,109,50,62,'\n',47,47,32,32,32,32,32,
+32,112,97,114,97,109,49,58,32,114,97,110,103,101,'\n',47,
+47,32,32,32,32,32,32,112,97,114,97,109,50,58,32,115,
+116,114,101,110,103,116,104,47,116,105,109,101,'\n',32,32,35,
+100,101,102,105,110,101,32,67,77,68,95,84,89,80,69,95,
+82,69,65,67,84,95,84,79,32,32,32,32,32,32,32,32,
+32,48,120,51,48,'\n',32,32,35,100,101,102,105,110,101,32,
+67,77,68,95,82,69,65,67,84,95,84,79,95,71,73,71,
+65,77,69,83,72,32,32,32,32,32,48,120,51,49,'\n',32,
+32,35,100,101,102,105,110,101,32,67,77,68,95,82,69,65,
+67,84,95,84,79,95,83,78,65,80,84,82,65,88,32,32,
+32,32,32,48,120,51,50,'\n',32,32,35,100,101,102,105,110,
+101,32,67,77,68,95,82,69,65,67,84,95,84,79,95,83,
+72,65,68,79,87,83,84,82,73,75,69,32,48,120,51,51,
+'\n',32,32,35,100,101,102,105,110,101,32,67,77,68,95,82,
+69,65,67,84,95,84,79,95,84,69,67,72,78,79,74,65,
+87,32,32,32,32,48,120,51,52,'\n','\n',47,47,97,99,116,
+105,118,97,116,101,32,116,111,107,101,110,32,105,110,32,97,
+110,111,116,104,101,114,32,98,111,116,32,116,101,108,108,32,
+112,114,111,116,111,99,111,108,58,32,60,110,66,111,116,62,
+44,32,48,120,52,48,32,43,32,60,115,112,101,99,105,101,
+115,62,44,32,60,112,97,114,97,109,49,62,44,32,60,112,
+97,114,97,109,50,62,'\n',47,47,32,32,32,32,32,32,112,
+97,114,97,109,49,58,32,48,'\n',47,47,32,32,32,32,32,
+32,112,97,114,97,109,50,58,32,116,105,109,101,'\n',32,32,
+35,100,101,102,105,110,101,32,67,77,68,95,84,89,80,69,
+95,84,69,76,76,32,32,32,32,32,32,32,32,32,32,32,
+32,32,48,120,52,48,'\n',32,32,35,100,101,102,105,110,101,
+32,67,77,68,95,84,69,76,76,95,77,65,71,78,69,84,
+32,32,32,32,32,32,32,32,32,32,32,48,120,52,49,'\n',
+32,32,35,100,101,102,105,110,101,32,67,77,68,95,84,69,
+76,76,95,82,69,80,85,76,83,69,32,32,32,32,32,32,
+32,32,32,32,48,120,52,50,'\n',32,32,35,100,101,102,105,
+110,101,32,67,77,68,95,84,69,76,76,95,70,76,65,83,
+72,66,76,73,78,68,32,32,32,32,32,32,32,48,120,52,
+51,'\n',32,32,35,100,101,102,105,110,101,32,67,77,68,95,
+84,69,76,76,95,70,82,69,69,90,69,32,32,32,32,32,
+32,32,32,32,32,32,48,120,52,52,'\n',32,32,35,100,101,
+102,105,110,101,32,67,77,68,95,84,69,76,76,95,83,76,
+79,87,32,32,32,32,32,32,32,32,32,32,32,32,32,48,
+120,52,53,'\n',32,32,35,100,101,102,105,110,101,32,67,77,
+68,95,84,69,76,76,95,82,69,86,69,82,83,69,32,32,
+32,32,32,32,32,32,32,32,48,120,52,54,'\n',32,32,35,
+100,101,102,105,110,101,32,67,77,68,95,84,69,76,76,95,
+68,73,90,90,89,32,32,32,32,32,32,32,32,32,32,32,
+32,48,120,52,55,'\n',32,32,35,100,101,102,105,110,101,32,
+67,77,68,95,84,69,76,76,95,84,65,75,69,67,79,78,
+84,82,79,76,32,32,32,32,32,32,48,120,52,56,'\n','\n',
+32,32,35,100,101,102,105,110,101,32,67,77,68,95,84,89,
+80,69,95,85,83,69,82,32,32,32,32,32,32,32,32,32,
+32,32,32,32,48,120,53,48,'\n',32,32,35,100,101,102,105,
+110,101,32,67,77,68,95,84,89,80,69,95,83,80,65,82,
+69,32,32,32,32,32,32,32,32,32,32,32,32,48,120,54,
+48,'\n',32,32,35,100,101,102,105,110,101,32,67,77,68,95,
+83,77,65,82,84,95,66,79,77,66,32,32,32,32,32,32,
+32,32,32,32,32,32,48,120,54,49,'\n',32,32,35,100,101,
+102,105,110,101,32,67,77,68,95,84,89,80,69,95,86,76,
+76,32,32,32,32,32,32,32,32,32,32,32,32,32,32,48,
+120,55,48,'\n','\n','\n','\n',32,32,35,100,101,102,105,110,101,
+32,83,101,114,105,97,108,68,97,116,97,40,110,41,32,64,
+40,48,120,50,49,48,48,48,48,32,43,32,40,110,41,41,
+32,47,47,32,100,97,116,97,32,102,111,114,32,83,101,110,
+100,83,101,114,'\n',32,32,95,95,110,111,108,105,115,116,32,
+118,111,105,100,32,83,101,116,83,101,114,105,97,108,68,97,
+116,97,40,99,111,110,115,116,32,105,110,116,32,110,44,32,
+99,111,110,115,116,32,105,110,116,32,38,118,41,32,32,32,
+32,32,32,32,32,123,32,83,101,116,40,83,101,114,105,97,
+108,68,97,116,97,40,110,41,44,32,118,41,59,32,125,'\n',
+32,32,95,95,110,111,108,105,115,116,32,118,111,105,100,32,
+83,101,110,100,83,101,114,105,97,108,40,99,111,110,115,116,
+32,105,110,116,32,102,105,114,115,116,44,32,99,111,110,115,
+116,32,105,110,116,32,99,111,117,110,116,41,32,32,32,32,
+123,32,97,115,109,32,123,32,48,120,99,50,44,32,102,105,
+114,115,116,44,32,99,111,117,110,116,32,125,59,32,125,'\n',
+'\n',32,32,35,105,102,32,100,101,102,105,110,101,100,40,95,
+95,83,80,89,41,'\n','\n',32,32,32,32,35,100,101,102,105,
+110,101,32,83,69,82,73,65,76,95,84,89,80,69,32,32,
+32,32,32,32,32,32,32,48,120,49,48,'\n',32,32,32,32,
+35,100,101,102,105,110,101,32,83,69,82,73,65,76,95,84,
+89,80,69,95,83,80,89,66,79,84,32,32,48,'\n',32,32,
+32,32,35,100,101,102,105,110,101,32,83,69,82,73,65,76,
+95,84,89,80,69,95,82,67,88,32,32,32,32,32,49,'\n',
+32,32,32,32,35,100,101,102,105,110,101,32,83,69,82,73,
+65,76,95,84,89,80,69,95,82,67,32,32,32,32,32,32,
+50,'\n',32,32,32,32,35,100,101,102,105,110,101,32,83,69,
+82,73,65,76,95,84,89,80,69,95,85,83,69,82,32,32,
+32,32,51,'\n',32,32,32,32,35,100,101,102,105,110,101,32,
+83,101,114,105,97,108,84,121,112,101,40,41,32,32,32,32,
+32,32,32,32,64,40,48,120,50,49,48,48,49,48,41,'\n',
+32,32,32,32,95,95,110,111,108,105,115,116,32,118,111,105,
+100,32,83,101,116,83,101,114,105,97,108,84,121,112,101,40,
+99,111,110,115,116,32,105,110,116,32,38,116,41,32,123,32,
+83,101,116,40,83,101,114,105,97,108,84,121,112,101,40,41,
+44,32,116,41,59,32,125,'\n','\n',32,32,32,32,35,100,101,
+102,105,110,101,32,83,69,82,73,65,76,95,66,65,85,68,
+32,32,32,32,32,32,32,32,32,48,120,49,49,'\n',32,32,
+32,32,35,100,101,102,105,110,101,32,83,69,82,73,65,76,
+95,66,65,85,68,95,50,52,48,48,32,32,32,32,48,'\n',
+32,32,32,32,35,100,101,102,105,110,101,32,83,69,82,73,
+65,76,95,66,65,85,68,95,52,56,48,48,32,32,32,32,
+49,'\n',32,32,32,32,35,100,101,102,105,110,101,32,83,69,
+82,73,65,76,95,66,65,85,68,95,57,54,48,48,32,32,
+32,32,50,'\n',32,32,32,32,35,100,101,102,105,110,101,32,
+83,101,114,105,97,108,66,97,117,100,40,41,32,32,32,32,
+32,32,32,32,64,40,48,120,50,49,48,48,49,49,41,'\n',
+32,32,32,32,95,95,110,111,108,105,115,116,32,118,111,105,
+100,32,83,101,116,83,101,114,105,97,108,66,97,117,100,40,
+99,111,110,115,116,32,105,110,116,32,38,98,41,32,123,32,
+83,101,116,40,83,101,114,105,97,108,66,97,117,100,40,41,
+44,32,98,41,59,32,125,'\n','\n',32,32,32,32,35,100,101,
+102,105,110,101,32,83,69,82,73,65,76,95,67,72,65,78,
+78,69,76,32,32,32,32,32,32,48,120,49,50,'\n',32,32,
+32,32,35,100,101,102,105,110,101,32,83,69,82,73,65,76,
+95,67,72,65,78,78,69,76,95,73,82,32,32,32,48,'\n',
+32,32,32,32,35,100,101,102,105,110,101,32,83,69,82,73,
+65,76,95,67,72,65,78,78,69,76,95,80,67,32,32,32,
+49,'\n',32,32,32,32,35,100,101,102,105,110,101,32,83,101,
+114,105,97,108,67,104,97,110,110,101,108,40,41,32,32,32,
+32,32,64,40,48,120,50,49,48,48,49,50,41,'\n',32,32,
+32,32,95,95,110,111,108,105,115,116,32,118,111,105,100,32,
+83,101,116,83,101,114,105,97,108,67,104,97,110,110,101,108,
+40,99,111,110,115,116,32,105,110,116,32,38,99,41,32,123,
+32,83,101,116,40,83,101,114,105,97,108,67,104,97,110,110,
+101,108,40,41,44,32,99,41,59,32,125,'\n','\n',32,32,32,
+32,35,100,101,102,105,110,101,32,83,69,82,73,65,76,95,
+80,82,69,65,77,66,76,69,95,80,79,83,32,48,120,49,
+51,'\n',32,32,32,32,35,100,101,102,105,110,101,32,83,101,
+114,105,97,108,80,114,101,97,109,98,108,101,80,111,115,40,
+41,32,64,40,48,120,50,49,48,48,49,51,41,'\n',32,32,
+32,32,95,95,110,111,108,105,115,116,32,118,111,105,100,32,
+83,101,116,83,101,114,105,97,108,80,114,101,97,109,98,108,
+101,80,111,115,40,99,111,110,115,116,32,105,110,116,32,38,
+112,41,32,123,32,83,101,116,40,83,101,114,105,97,108,80,
+114,101,97,109,98,108,101,80,111,115,40,41,44,32,112,41,
+59,32,125,'\n','\n',32,32,32,32,35,100,101,102,105,110,101,
+32,83,69,82,73,65,76,95,80,82,69,65,77,66,76,69,
+95,76,69,78,32,48,120,49,52,'\n',32,32,32,32,35,100,
+101,102,105,110,101,32,83,101,114,105,97,108,80,114,101,97,
+109,98,108,101,76,101,110,40,41,32,64,40,48,120,50,49,
+48,48,49,52,41,'\n',32,32,32,32,95,95,110,111,108,105,
+115,116,32,118,111,105,100,32,83,101,116,83,101,114,105,97,
+108,80,114,101,97,109,98,108,101,76,101,110,40,99,111,110,
+115,116,32,105,110,116,32,38,108,41,32,123,32,83,101,116,
+40,83,101,114,105,97,108,80,114,101,97,109,98,108,101,76,
+101,110,40,41,44,32,108,41,59,32,125,'\n','\n',32,32,32,
+32,35,100,101,102,105,110,101,32,83,69,82,73,65,76,95,
+67,72,69,67,75,83,85,77,32,32,32,32,32,32,32,32,
+32,32,32,32,32,48,120,49,53,'\n',32,32,32,32,35,100,
+101,102,105,110,101,32,83,69,82,73,65,76,95,67,72,69,
+67,75,83,85,77,95,78,79,78,69,32,32,32,32,32,32,
+32,32,48,'\n',32,32,32,32,35,100,101,102,105,110,101,32,
+83,69,82,73,65,76,95,67,72,69,67,75,83,85,77,95,
+83,85,77,32,32,32,32,32,32,32,32,32,48,120,48,52,
+'\n',32,32,32,32,35,100,101,102,105,110,101,32,83,69,82,
+73,65,76,95,67,72,69,67,75,83,85,77,95,90,69,82,
+79,95,83,85,77,32,32,32,32,48,120,48,56,'\n',32,32,
+32,32,35,100,101,102,105,110,101,32,83,101,114,105,97,108,
+67,104,101,99,107,115,117,109,40,41,32,32,32,32,32,32,
+32,32,32,32,32,32,64,40,48,120,50,49,48,48,49,53,
+41,'\n',32,32,32,32,95,95,110,111,108,105,115,116,32,118,
+111,105,100,32,83,101,116,83,101,114,105,97,108,67,104,101,
+99,107,115,117,109,40,99,111,110,115,116,32,105,110,116,32,
+38,110,41,32,123,32,83,101,116,40,83,101,114,105,97,108,
+67,104,101,99,107,115,117,109,40,41,44,32,110,41,59,32,
+125,'\n','\n',32,32,32,32,35,100,101,102,105,110,101,32,83,
+69,82,73,65,76,95,66,73,80,72,65,83,69,32,32,32,
+32,32,32,48,120,49,54,'\n',32,32,32,32,35,100,101,102,
+105,110,101,32,83,69,82,73,65,76,95,66,73,80,72,65,
+83,69,95,79,70,70,32,32,48,'\n',32,32,32,32,35,100,
+101,102,105,110,101,32,83,69,82,73,65,76,95,66,73,80,
+72,65,83,69,95,79,78,32,32,32,48,120,102,102,'\n',32,
+32,32,32,35,100,101,102,105,110,101,32,83,101,114,105,97,
+108,66,105,80,104,97,115,101,40,41,32,32,32,32,32,64,
+40,48,120,50,49,48,48,49,54,41,'\n',32,32,32,32,95,
+95,110,111,108,105,115,116,32,118,111,105,100,32,83,101,116,
+83,101,114,105,97,108,66,105,80,104,97,115,101,40,99,111,
+110,115,116,32,105,110,116,32,38,110,41,32,123,32,83,101,
+116,40,83,101,114,105,97,108,66,105,80,104,97,115,101,40,
+41,44,32,110,41,59,32,125,'\n','\n',32,32,32,32,35,100,
+101,102,105,110,101,32,77,83,71,95,78,79,78,69,32,32,
+32,32,32,32,32,32,48,'\n',32,32,32,32,35,100,101,102,
+105,110,101,32,77,83,71,95,73,82,32,32,32,32,32,32,
+32,32,32,32,49,'\n',32,32,32,32,35,100,101,102,105,110,
+101,32,77,83,71,95,80,67,32,32,32,32,32,32,32,32,
+32,32,50,'\n',32,32,32,32,35,100,101,102,105,110,101,32,
+82,120,77,101,115,115,97,103,101,76,111,99,107,40,41,32,
+64,40,48,120,50,49,48,48,49,55,41,'\n',32,32,32,32,
+95,95,110,111,108,105,115,116,32,118,111,105,100,32,83,101,
+116,82,120,77,101,115,115,97,103,101,76,111,99,107,40,99,
+111,110,115,116,32,105,110,116,32,38,108,41,32,123,32,83,
+101,116,40,82,120,77,101,115,115,97,103,101,76,111,99,107,
+40,41,44,32,108,41,59,32,125,'\n','\n',32,32,32,32,35,
+100,101,102,105,110,101,32,82,120,77,101,115,115,97,103,101,
+73,110,100,101,120,40,41,32,32,32,32,64,40,48,120,50,
+49,48,48,49,56,41,'\n',32,32,32,32,35,100,101,102,105,
+110,101,32,82,120,77,101,115,115,97,103,101,67,104,97,110,
+110,101,108,40,41,32,32,64,40,48,120,50,49,48,48,49,
+57,41,32,47,47,32,114,101,116,117,114,110,115,32,77,83,
+71,95,73,82,32,111,114,32,77,83,71,95,80,67,'\n',32,
+32,32,32,35,100,101,102,105,110,101,32,82,120,77,101,115,
+115,97,103,101,73,68,40,99,41,32,32,32,32,32,32,64,
+40,48,120,50,49,48,48,49,57,32,43,32,40,99,41,41,
+32,47,47,32,99,32,61,61,32,77,83,71,95,73,82,32,
+111,114,32,77,83,71,95,80,67,'\n','\n',32,32,32,32,35,
+100,101,102,105,110,101,32,77,83,71,95,73,78,68,69,88,
+32,32,32,48,'\n',32,32,32,32,35,100,101,102,105,110,101,
+32,77,83,71,95,67,79,77,77,65,78,68,32,49,'\n',32,
+32,32,32,35,100,101,102,105,110,101,32,77,83,71,95,72,
+73,95,66,89,84,69,32,50,'\n',32,32,32,32,35,100,101,
+102,105,110,101,32,77,83,71,95,76,79,95,66,89,84,69,
+32,51,'\n','\n',32,32,32,32,35,100,101,102,105,110,101,32,
+67,79,77,77,65,78,68,95,67,79,78,84,82,79,76,76,
+69,82,32,32,48,120,52,48,'\n','\n',32,32,32,32,35,100,
+101,102,105,110,101,32,73,78,68,69,88,95,76,73,78,75,
+67,65,83,84,32,32,48,120,52,48,'\n',32,32,32,32,35,
+100,101,102,105,110,101,32,73,78,68,69,88,95,66,82,79,
+65,68,67,65,83,84,32,48,120,56,48,'\n',32,32,32,32,
+35,100,101,102,105,110,101,32,73,78,68,69,88,95,73,78,
+86,65,76,73,68,32,32,32,48,120,50,48,'\n','\n',32,32,
+32,32,35,100,101,102,105,110,101,32,82,120,77,101,115,115,
+97,103,101,40,99,44,32,110,41,32,64,40,48,120,50,49,
+48,48,49,56,32,43,32,40,99,42,52,41,32,43,32,40,
+110,41,41,32,47,47,32,99,32,61,61,32,77,83,71,95,
+73,82,32,111,114,32,77,83,71,95,80,67,59,32,52,32,
+98,121,116,101,115,'\n','\n',32,32,35,101,110,100,105,102,'\n',
+'\n',35,101,110,100,105,102,'\n','\n','\n','\n',47,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,'\n',32,42,32,84,105,109,101,114,115,
+'\n',32,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,47,'\n','\n',35,
+100,101,102,105,110,101,32,84,49,32,32,48,'\n',35,100,101,
+102,105,110,101,32,84,50,32,32,49,'\n',35,100,101,102,105,
+110,101,32,84,51,32,32,50,'\n','\n',35,105,102,110,100,101,
+102,32,95,95,83,67,79,85,84,'\n',32,32,32,32,35,100,
+101,102,105,110,101,32,84,52,32,32,51,'\n',35,101,110,100,
+105,102,'\n','\n','\n',35,100,101,102,105,110,101,32,84,105,109,
+101,114,40,110,41,32,32,32,32,64,40,48,120,49,48,48,
+48,48,32,43,32,40,110,41,41,32,32,32,32,47,47,32,
+114,101,97,100,32,97,32,116,105,109,101,114,39,115,32,118,
+97,108,117,101,'\n','\n',95,95,110,111,108,105,115,116,32,118,
+111,105,100,32,67,108,101,97,114,84,105,109,101,114,40,99,
+111,110,115,116,32,105,110,116,32,110,41,32,123,32,97,115,
+109,32,123,32,48,120,97,49,44,32,110,32,125,59,32,125,
+'\n','\n','\n',35,105,102,100,101,102,32,95,95,83,67,79,85,
+84,'\n',32,32,32,32,95,95,110,111,108,105,115,116,32,118,
+111,105,100,32,83,101,116,84,105,109,101,114,76,105,109,105,
+116,40,99,111,110,115,116,32,105,110,116,32,110,44,32,99,
+111,110,115,116,32,105,110,116,32,38,120,41,32,32,123,32,
+97,115,109,32,123,32,48,120,99,52,44,32,110,44,32,36,
+120,32,58,32,95,95,65,83,77,95,83,82,67,95,69,88,
+84,32,125,59,32,125,'\n',35,101,110,100,105,102,'\n','\n','\n',
+35,105,102,32,95,95,82,67,88,61,61,50,32,124,124,32,
+100,101,102,105,110,101,100,40,95,95,83,80,89,41,32,124,
+124,32,100,101,102,105,110,101,100,40,95,95,83,87,65,78,
+41,'\n',32,32,32,32,95,95,110,111,108,105,115,116,32,118,
+111,105,100,32,83,101,116,84,105,109,101,114,40,99,111,110,
+115,116,32,105,110,116,32,110,44,32,99,111,110,115,116,32,
+105,110,116,32,38,118,41,32,32,32,32,123,32,83,101,116,
+40,84,105,109,101,114,40,110,41,44,32,118,41,59,32,125,
+'\n',32,32,32,32,35,100,101,102,105,110,101,32,70,97,115,
+116,84,105,109,101,114,40,110,41,32,32,32,32,64,40,48,
+120,49,97,48,48,48,48,32,43,32,40,110,41,41,'\n',35,
+101,110,100,105,102,'\n','\n','\n','\n',47,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,'\n',32,42,32,67,111,117,110,116,101,114,115,
+'\n',32,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,47,'\n','\n','\n',
+35,105,102,32,100,101,102,105,110,101,100,40,95,95,83,67,
+79,85,84,41,32,124,124,32,95,95,82,67,88,61,61,50,
+32,124,124,32,100,101,102,105,110,101,100,40,95,95,83,80,
+89,41,32,124,124,32,100,101,102,105,110,101,100,40,95,95,
+83,87,65,78,41,'\n',32,32,32,32,47,47,32,83,99,111,
+117,116,44,32,82,67,88,50,44,32,83,112,121,44,32,97,
+110,100,32,83,119,97,110,32,104,97,118,101,32,99,111,117,
+110,116,101,114,32,115,117,112,112,111,114,116,'\n',32,32,32,
+32,35,100,101,102,105,110,101,32,67,111,117,110,116,101,114,
+40,110,41,32,32,64,40,48,120,49,53,48,48,48,48,32,
+43,32,40,110,41,41,32,32,32,47,47,32,114,101,97,100,
+32,97,32,99,111,117,110,116,101,114,'\n','\n','\n',32,32,32,
+32,95,95,110,111,108,105,115,116,32,118,111,105,100,32,73,
+110,99,67,111,117,110,116,101,114,40,99,111,110,115,116,32,
+105,110,116,32,99,41,32,123,32,97,115,109,32,123,32,48,
+120,57,55,44,32,99,32,125,59,32,125,'\n',32,32,32,32,
+95,95,110,111,108,105,115,116,32,118,111,105,100,32,68,101,
+99,67,111,117,110,116,101,114,40,99,111,110,115,116,32,105,
+110,116,32,99,41,32,123,32,97,115,109,32,123,32,48,120,
+65,55,44,32,99,32,125,59,32,125,'\n',32,32,32,32,95,
+95,110,111,108,105,115,116,32,118,111,105,100,32,67,108,101,
+97,114,67,111,117,110,116,101,114,40,99,111,110,115,116,32,
+105,110,116,32,99,41,32,123,32,97,115,109,32,123,32,48,
+120,98,55,44,32,99,125,59,32,125,'\n','\n',32,32,32,32,
+35,105,102,100,101,102,32,95,95,83,67,79,85,84,'\n',32,
+32,32,32,32,32,32,32,95,95,110,111,108,105,115,116,32,
+118,111,105,100,32,83,101,116,67,111,117,110,116,101,114,76,
+105,109,105,116,40,99,111,110,115,116,32,105,110,116,32,99,
+44,32,99,111,110,115,116,32,105,110,116,32,38,108,41,32,
+123,32,97,115,109,32,123,32,48,120,100,52,44,32,99,44,
+32,36,108,32,58,32,95,95,65,83,77,95,83,82,67,95,
+69,88,84,32,125,59,32,125,'\n',32,32,32,32,35,101,110,
+100,105,102,'\n',35,101,110,100,105,102,'\n','\n','\n','\n',47,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,'\n',32,42,32,69,118,101,
+110,116,115,'\n',32,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,47,
+'\n','\n','\n',35,105,102,32,100,101,102,105,110,101,100,40,95,
+95,83,67,79,85,84,41,32,124,124,32,95,95,82,67,88,
+61,61,50,32,124,124,32,100,101,102,105,110,101,100,40,95,
+95,83,80,89,41,32,124,124,32,100,101,102,105,110,101,100,
+40,95,95,83,87,65,78,41,'\n',32,32,32,32,47,47,32,
+83,99,111,117,116,44,32,82,67,88,50,44,32,83,112,121,
+44,32,97,110,100,32,83,119,97,110,32,104,97,118,101,32,
+98,97,115,105,99,32,101,118,101,110,116,32,115,117,112,112,
+111,114,116,'\n',32,32,32,32,35,100,101,102,105,110,101,32,
+65,99,116,105,118,101,69,118,101,110,116,115,40,110,41,32,
+64,40,48,120,49,55,48,48,48,48,32,43,32,40,110,41,
+41,'\n',32,32,32,32,35,100,101,102,105,110,101,32,69,86,
+69,78,84,95,77,65,83,75,40,101,41,32,32,32,40,49,
+32,60,60,32,40,101,41,41,'\n','\n','\n',32,32,32,32,35,
+105,102,32,100,101,102,105,110,101,100,40,95,95,83,67,79,
+85,84,41,'\n',32,32,32,32,32,32,32,32,47,47,32,111,
+110,108,121,32,99,111,110,115,116,97,110,116,32,109,97,115,
+107,115,32,97,108,108,111,119,101,100,'\n',32,32,32,32,32,
+32,32,32,95,95,110,111,108,105,115,116,32,118,111,105,100,
+32,69,118,101,110,116,40,99,111,110,115,116,32,105,110,116,
+32,101,41,32,32,32,32,123,32,97,115,109,32,123,32,48,
+120,48,51,44,32,50,44,32,101,44,32,101,62,62,56,32,
+125,59,32,125,'\n',32,32,32,32,35,101,108,115,101,'\n',32,
+32,32,32,32,32,32,32,95,95,110,111,108,105,115,116,32,
+118,111,105,100,32,69,118,101,110,116,40,99,111,110,115,116,
+32,105,110,116,32,38,101,41,32,32,32,123,32,97,115,109,
+32,123,32,48,120,48,51,44,32,36,101,32,125,59,32,125,
+'\n',32,32,32,32,35,101,110,100,105,102,'\n',35,101,110,100,
+105,102,'\n','\n','\n',35,105,102,32,95,95,82,67,88,61,61,
+50,32,124,124,32,100,101,102,105,110,101,100,40,95,95,83,
+80,89,41,32,124,124,32,100,101,102,105,110,101,100,40,95,
+95,83,87,65,78,41,'\n',32,32,32,32,35,105,102,32,95,
+95,82,67,88,61,61,50,32,124,124,32,100,101,102,105,110,
+101,100,40,95,95,83,87,65,78,41,'\n',32,32,32,32,32,
+32,32,32,35,100,101,102,105,110,101,32,67,117,114,114,101,
+110,116,69,118,101,110,116,115,40,41,32,65,99,116,105,118,
+101,69,118,101,110,116,115,40,49,48,41,'\n',32,32,32,32,
+35,101,108,115,101,'\n',32,32,32,32,32,32,32,32,35,100,
+101,102,105,110,101,32,67,117,114,114,101,110,116,69,118,101,
+110,116,115,40,41,32,65,99,116,105,118,101,69,118,101,110,
+116,115,40,49,54,41,'\n',32,32,32,32,35,101,110,100,105,
+102,'\n','\n','\n',32,32,32,32,35,100,101,102,105,110,101,32,
+69,86,69,78,84,95,84,89,80,69,95,80,82,69,83,83,
+69,68,32,32,48,'\n',32,32,32,32,35,100,101,102,105,110,
+101,32,69,86,69,78,84,95,84,89,80,69,95,82,69,76,
+69,65,83,69,68,32,49,'\n',32,32,32,32,35,100,101,102,
+105,110,101,32,69,86,69,78,84,95,84,89,80,69,95,76,
+79,87,32,32,32,32,32,32,56,'\n',32,32,32,32,35,100,
+101,102,105,110,101,32,69,86,69,78,84,95,84,89,80,69,
+95,78,79,82,77,65,76,32,32,32,57,'\n',32,32,32,32,
+35,100,101,102,105,110,101,32,69,86,69,78,84,95,84,89,
+80,69,95,72,73,71,72,32,32,32,32,32,49,48,'\n',32,
+32,32,32,35,100,101,102,105,110,101,32,69,86,69,78,84,
+95,84,89,80,69,95,67,76,73,67,75,32,32,32,32,49,
+49,'\n','\n',32,32,32,32,35,105,102,100,101,102,32,95,95,
+83,80,89,'\n',32,32,32,32,32,32,32,32,47,47,32,116,
+104,101,115,101,32,97,108,108,32,99,111,114,114,101,115,112,
+111,110,100,32,116,111,32,117,115,105,110,103,32,86,76,76,
+40,41,32,97,115,32,116,104,101,32,115,111,117,114,99,101,
+'\n',32,32,32,32,32,32,32,32,35,100,101,102,105,110,101,
+32,69,86,69,78,84,95,84,89,80,69,95,69,78,84,82,
+89,95,70,79,85,78,68,32,32,32,32,32,32,52,'\n',32,
+32,32,32,32,32,32,32,35,100,101,102,105,110,101,32,69,
+86,69,78,84,95,84,89,80,69,95,77,83,71,95,68,73,
+83,67,65,82,68,32,32,32,32,32,32,54,'\n',32,32,32,
+32,32,32,32,32,35,100,101,102,105,110,101,32,69,86,69,
+78,84,95,84,89,80,69,95,77,83,71,95,82,69,67,69,
+73,86,69,68,32,32,32,32,32,49,51,'\n',32,32,32,32,
+32,32,32,32,35,100,101,102,105,110,101,32,69,86,69,78,
+84,95,84,89,80,69,95,86,76,76,95,77,83,71,95,82,
+69,67,69,73,86,69,68,32,49,52,'\n',32,32,32,32,32,
+32,32,32,35,100,101,102,105,110,101,32,69,86,69,78,84,
+95,84,89,80,69,95,69,78,84,82,89,95,67,72,65,78,
+71,69,68,32,32,32,32,49,53,'\n',32,32,32,32,35,101,
+108,115,101,'\n',32,32,32,32,32,32,32,32,35,100,101,102,
+105,110,101,32,69,86,69,78,84,95,84,89,80,69,95,80,
+85,76,83,69,32,32,32,32,32,32,32,32,50,'\n',32,32,
+32,32,32,32,32,32,35,100,101,102,105,110,101,32,69,86,
+69,78,84,95,84,89,80,69,95,69,68,71,69,32,32,32,
+32,32,32,32,32,32,51,'\n',32,32,32,32,32,32,32,32,
+35,100,101,102,105,110,101,32,69,86,69,78,84,95,84,89,
+80,69,95,70,65,83,84,67,72,65,78,71,69,32,32,32,
+55,'\n',32,32,32,32,32,32,32,32,35,100,101,102,105,110,
+101,32,69,86,69,78,84,95,84,89,80,69,95,68,79,85,
+66,76,69,67,76,73,67,75,32,32,49,50,'\n',32,32,32,
+32,32,32,32,32,35,100,101,102,105,110,101,32,69,86,69,
+78,84,95,84,89,80,69,95,77,69,83,83,65,71,69,32,
+32,32,32,32,32,49,52,'\n',32,32,32,32,35,101,110,100,
+105,102,'\n','\n',32,32,32,32,35,105,102,32,100,101,102,105,
+110,101,100,40,95,95,83,87,65,78,41,'\n',32,32,32,32,
+32,32,32,32,35,100,101,102,105,110,101,32,69,86,69,78,
+84,95,84,89,80,69,95,52,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,52,'\n',32,32,
+32,32,32,32,32,32,35,100,101,102,105,110,101,32,69,86,
+69,78,84,95,84,89,80,69,95,53,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,53,'\n',
+32,32,32,32,32,32,32,32,35,100,101,102,105,110,101,32,
+69,86,69,78,84,95,84,89,80,69,95,54,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+54,'\n',32,32,32,32,32,32,32,32,35,100,101,102,105,110,
+101,32,69,86,69,78,84,95,84,89,80,69,95,86,73,82,
+84,85,65,76,95,77,79,84,79,82,95,67,72,65,78,71,
+69,32,52,'\n',32,32,32,32,32,32,32,32,35,100,101,102,
+105,110,101,32,69,86,69,78,84,95,84,89,80,69,95,86,
+73,82,84,85,65,76,95,77,79,84,79,82,95,80,79,87,
+69,82,32,32,53,'\n',32,32,32,32,32,32,32,32,35,100,
+101,102,105,110,101,32,69,86,69,78,84,95,84,89,80,69,
+95,86,73,82,84,85,65,76,95,83,69,78,83,79,82,95,
+68,69,70,32,32,32,54,'\n',32,32,32,32,32,32,32,32,
+35,100,101,102,105,110,101,32,69,86,69,78,84,95,84,89,
+80,69,95,73,78,70,82,65,82,69,68,95,73,68,76,69,
+32,32,32,32,32,32,32,32,49,51,'\n',32,32,32,32,32,
+32,32,32,35,100,101,102,105,110,101,32,69,86,69,78,84,
+95,84,89,80,69,95,82,69,83,69,84,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,49,54,'\n',32,32,
+32,32,35,101,110,100,105,102,'\n','\n','\n',32,32,32,32,35,
+100,101,102,105,110,101,32,83,101,116,69,118,101,110,116,40,
+101,44,115,44,116,41,32,95,95,83,101,116,69,118,101,110,
+116,40,101,44,95,95,101,118,101,110,116,95,115,114,99,40,
+115,41,44,116,41,'\n',32,32,32,32,95,95,110,111,108,105,
+115,116,32,118,111,105,100,32,95,95,83,101,116,69,118,101,
+110,116,40,99,111,110,115,116,32,105,110,116,32,101,118,116,
+44,32,99,111,110,115,116,32,105,110,116,32,115,114,99,44,
+32,99,111,110,115,116,32,105,110,116,32,116,121,112,101,41,
+'\n',32,32,32,32,32,32,32,32,123,32,97,115,109,32,123,
+32,48,120,57,51,44,32,101,118,116,44,32,115,114,99,44,
+32,116,121,112,101,125,59,32,125,'\n','\n','\n',32,32,32,32,
+95,95,110,111,108,105,115,116,32,118,111,105,100,32,67,108,
+101,97,114,69,118,101,110,116,40,99,111,110,115,116,32,105,
+110,116,32,101,118,116,41,32,123,32,97,115,109,32,123,32,
+48,120,57,51,44,32,101,118,116,44,32,48,44,32,49,54,
+32,125,59,32,125,'\n',32,32,32,32,95,95,110,111,108,105,
+115,116,32,118,111,105,100,32,67,108,101,97,114,65,108,108,
+69,118,101,110,116,115,40,41,32,32,123,32,97,115,109,32,
+123,32,48,120,48,54,32,125,59,32,125,'\n',32,32,32,32,
+95,95,110,111,108,105,115,116,32,118,111,105,100,32,67,97,
+108,105,98,114,97,116,101,69,118,101,110,116,40,99,111,110,
+115,116,32,105,110,116,32,101,118,116,44,32,99,111,110,115,
+116,32,105,110,116,32,108,111,119,44,32,99,111,110,115,116,
+32,105,110,116,32,104,105,44,32,99,111,110,115,116,32,105,
+110,116,32,104,121,115,116,41,'\n',32,32,32,32,32,32,32,
+32,123,32,97,115,109,32,123,32,48,120,48,52,44,32,101,
+118,116,44,32,104,105,44,32,108,111,119,44,32,104,121,115,
+116,32,125,59,32,125,'\n','\n','\n',32,32,32,32,35,100,101,
+102,105,110,101,32,69,118,101,110,116,83,116,97,116,101,40,
+110,41,32,32,32,64,40,48,120,49,57,48,48,48,48,32,
+43,32,40,110,41,41,'\n',32,32,32,32,35,100,101,102,105,
+110,101,32,85,112,112,101,114,76,105,109,105,116,40,110,41,
+32,32,32,64,40,48,120,49,99,48,48,48,48,32,43,32,
+40,110,41,41,'\n',32,32,32,32,35,100,101,102,105,110,101,
+32,76,111,119,101,114,76,105,109,105,116,40,110,41,32,32,
+32,64,40,48,120,49,100,48,48,48,48,32,43,32,40,110,
+41,41,'\n',32,32,32,32,35,100,101,102,105,110,101,32,72,
+121,115,116,101,114,101,115,105,115,40,110,41,32,32,32,64,
+40,48,120,49,101,48,48,48,48,32,43,32,40,110,41,41,
+'\n',32,32,32,32,35,100,101,102,105,110,101,32,67,108,105,
+99,107,84,105,109,101,40,110,41,32,32,32,32,64,40,48,
+120,49,102,48,48,48,48,32,43,32,40,110,41,41,'\n','\n',
+'\n',32,32,32,32,95,95,110,111,108,105,115,116,32,118,111,
+105,100,32,83,101,116,85,112,112,101,114,76,105,109,105,116,
+40,99,111,110,115,116,32,105,110,116,32,101,118,116,44,32,
+99,111,110,115,116,32,105,110,116,32,38,118,41,32,32,32,
+32,123,32,83,101,116,40,85,112,112,101,114,76,105,109,105,
+116,40,101,118,116,41,44,32,118,41,59,32,125,'\n',32,32,
+32,32,95,95,110,111,108,105,115,116,32,118,111,105,100,32,
+83,101,116,76,111,119,101,114,76,105,109,105,116,40,99,111,
+110,115,116,32,105,110,116,32,101,118,116,44,32,99,111,110,
+115,116,32,105,110,116,32,38,118,41,32,32,32,32,123,32,
+83,101,116,40,76,111,119,101,114,76,105,109,105,116,40,101,
+118,116,41,44,32,118,41,59,32,125,'\n',32,32,32,32,95,
+95,110,111,108,105,115,116,32,118,111,105,100,32,83,101,116,
+72,121,115,116,101,114,101,115,105,115,40,99,111,110,115,116,
+32,105,110,116,32,101,118,116,44,32,99,111,110,115,116,32,
+105,110,116,32,38,118,41,32,32,32,32,123,32,83,101,116,
+40,72,121,115,116,101,114,101,115,105,115,40,101,118,116,41,
+44,32,118,41,59,32,125,'\n',32,32,32,32,95,95,110,111,
+108,105,115,116,32,118,111,105,100,32,83,101,116,67,108,105,
+99,107,84,105,109,101,40,99,111,110,115,116,32,105,110,116,
+32,101,118,116,44,32,99,111,110,115,116,32,105,110,116,32,
+38,118,41,32,32,32,32,32,123,32,83,101,116,40,67,108,
+105,99,107,84,105,109,101,40,101,118,116,41,44,32,118,41,
+59,32,125,'\n','\n','\n',32,32,32,32,35,105,102,32,95,95,
+82,67,88,61,61,50,32,124,124,32,100,101,102,105,110,101,
+100,40,95,95,83,87,65,78,41,'\n',32,32,32,32,32,32,
+32,32,35,100,101,102,105,110,101,32,67,108,105,99,107,67,
+111,117,110,116,101,114,40,110,41,32,64,40,48,120,49,98,
+48,48,48,48,32,43,32,40,110,41,41,'\n',32,32,32,32,
+32,32,32,32,95,95,110,111,108,105,115,116,32,118,111,105,
+100,32,83,101,116,67,108,105,99,107,67,111,117,110,116,101,
+114,40,99,111,110,115,116,32,105,110,116,32,101,118,116,44,
+32,99,111,110,115,116,32,105,110,116,32,38,118,41,32,32,
+123,32,83,101,116,40,67,108,105,99,107,67,111,117,110,116,
+101,114,40,101,118,116,41,44,32,118,41,59,32,125,'\n',32,
+32,32,32,35,101,110,100,105,102,'\n',35,101,110,100,105,102,
+'\n','\n','\n',35,105,102,32,95,95,83,67,79,85,84,'\n',32,
+32,32,32,47,47,32,101,118,101,110,116,32,99,111,100,101,
+115,'\n',32,32,32,32,35,100,101,102,105,110,101,32,69,86,
+69,78,84,95,49,95,80,82,69,83,83,69,68,32,32,32,
+32,32,32,32,32,32,40,49,32,60,60,32,48,41,'\n',32,
+32,32,32,35,100,101,102,105,110,101,32,69,86,69,78,84,
+95,49,95,82,69,76,69,65,83,69,68,32,32,32,32,32,
+32,32,32,40,49,32,60,60,32,49,41,'\n',32,32,32,32,
+35,100,101,102,105,110,101,32,69,86,69,78,84,95,50,95,
+80,82,69,83,83,69,68,32,32,32,32,32,32,32,32,32,
+40,49,32,60,60,32,50,41,'\n',32,32,32,32,35,100,101,
+102,105,110,101,32,69,86,69,78,84,95,50,95,82,69,76,
+69,65,83,69,68,32,32,32,32,32,32,32,32,40,49,32,
+60,60,32,51,41,'\n',32,32,32,32,35,100,101,102,105,110,
+101,32,69,86,69,78,84,95,76,73,71,72,84,95,72,73,
+71,72,32,32,32,32,32,32,32,32,40,49,32,60,60,32,
+52,41,'\n',32,32,32,32,35,100,101,102,105,110,101,32,69,
+86,69,78,84,95,76,73,71,72,84,95,78,79,82,77,65,
+76,32,32,32,32,32,32,40,49,32,60,60,32,53,41,'\n',
+32,32,32,32,35,100,101,102,105,110,101,32,69,86,69,78,
+84,95,76,73,71,72,84,95,76,79,87,32,32,32,32,32,
+32,32,32,32,40,49,32,60,60,32,54,41,'\n',32,32,32,
+32,35,100,101,102,105,110,101,32,69,86,69,78,84,95,76,
+73,71,72,84,95,67,76,73,67,75,32,32,32,32,32,32,
+32,40,49,32,60,60,32,55,41,'\n',32,32,32,32,35,100,
+101,102,105,110,101,32,69,86,69,78,84,95,76,73,71,72,
+84,95,68,79,85,66,76,69,67,76,73,67,75,32,40,49,
+32,60,60,32,56,41,'\n',32,32,32,32,35,100,101,102,105,
+110,101,32,69,86,69,78,84,95,67,79,85,78,84,69,82,
+95,48,32,32,32,32,32,32,32,32,32,40,49,32,60,60,
+32,57,41,'\n',32,32,32,32,35,100,101,102,105,110,101,32,
+69,86,69,78,84,95,67,79,85,78,84,69,82,95,49,32,
+32,32,32,32,32,32,32,32,40,49,32,60,60,32,49,48,
+41,'\n',32,32,32,32,35,100,101,102,105,110,101,32,69,86,
+69,78,84,95,84,73,77,69,82,95,48,32,32,32,32,32,
+32,32,32,32,32,32,40,49,32,60,60,32,49,49,41,'\n',
+32,32,32,32,35,100,101,102,105,110,101,32,69,86,69,78,
+84,95,84,73,77,69,82,95,49,32,32,32,32,32,32,32,
+32,32,32,32,40,49,32,60,60,32,49,50,41,'\n',32,32,
+32,32,35,100,101,102,105,110,101,32,69,86,69,78,84,95,
+84,73,77,69,82,95,50,32,32,32,32,32,32,32,32,32,
+32,32,40,49,32,60,60,32,49,51,41,'\n',32,32,32,32,
+35,100,101,102,105,110,101,32,69,86,69,78,84,95,77,69,
+83,83,65,71,69,32,32,32,32,32,32,32,32,32,32,32,
+40,49,32,60,60,32,49,52,41,'\n',35,101,110,100,105,102,
+'\n','\n','\n','\n',47,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,'\n',
+32,42,32,71,101,110,101,114,97,108,'\n',32,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,47,'\n','\n','\n',47,47,32,119,97,105,
+116,32,102,111,114,32,97,32,99,111,110,100,105,116,105,111,
+110,32,116,111,32,98,101,99,111,109,101,32,116,114,117,101,
+'\n',35,100,101,102,105,110,101,32,117,110,116,105,108,40,99,
+41,32,32,32,32,119,104,105,108,101,40,33,40,99,41,41,
+'\n','\n','\n',47,47,32,115,108,101,101,112,32,102,111,114,32,
+118,32,116,105,99,107,115,32,40,49,48,109,115,32,112,101,
+114,32,116,105,99,107,41,'\n',95,95,110,111,108,105,115,116,
+32,118,111,105,100,32,87,97,105,116,40,99,111,110,115,116,
+32,105,110,116,32,38,118,41,32,32,32,32,32,32,32,32,
+123,32,97,115,109,32,123,32,48,120,52,51,44,32,36,118,
+32,58,32,95,95,65,83,77,95,83,82,67,95,69,88,84,
+125,59,32,125,'\n','\n',95,95,110,111,108,105,115,116,32,118,
+111,105,100,32,83,116,111,112,65,108,108,84,97,115,107,115,
+40,41,32,32,32,32,32,32,32,32,32,32,32,32,123,32,
+97,115,109,32,123,32,48,120,53,48,32,125,59,32,125,'\n',
+95,95,110,111,108,105,115,116,32,118,111,105,100,32,83,101,
+116,83,108,101,101,112,84,105,109,101,40,99,111,110,115,116,
+32,105,110,116,32,116,41,32,123,32,97,115,109,32,123,32,
+48,120,98,49,44,32,116,32,125,59,32,125,'\n',95,95,110,
+111,108,105,115,116,32,118,111,105,100,32,83,108,101,101,112,
+78,111,119,40,41,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,123,32,97,115,109,32,123,32,48,120,54,
+48,32,125,59,32,125,'\n','\n','\n',35,105,102,32,100,101,102,
+105,110,101,100,40,95,95,82,67,88,41,32,124,124,32,100,
+101,102,105,110,101,100,40,95,95,83,67,79,85,84,41,32,
+124,124,32,100,101,102,105,110,101,100,40,95,95,83,87,65,
+78,41,'\n',32,32,32,32,47,47,32,83,99,111,117,116,32,
+97,110,100,32,82,67,88,'\n',32,32,32,32,35,100,101,102,
+105,110,101,32,84,88,95,80,79,87,69,82,95,76,79,32,
+48,'\n',32,32,32,32,35,100,101,102,105,110,101,32,84,88,
+95,80,79,87,69,82,95,72,73,32,49,'\n',32,32,32,32,
+95,95,110,111,108,105,115,116,32,118,111,105,100,32,83,101,
+116,84,120,80,111,119,101,114,40,99,111,110,115,116,32,105,
+110,116,32,112,41,32,32,32,123,32,97,115,109,32,123,32,
+48,120,51,49,44,32,112,32,125,59,32,125,'\n',35,101,110,
+100,105,102,'\n','\n','\n',35,105,102,32,100,101,102,105,110,101,
+100,40,95,95,82,67,88,41,32,124,124,32,100,101,102,105,
+110,101,100,40,95,95,83,87,65,78,41,'\n',32,32,32,32,
+47,47,32,82,67,88,32,97,110,100,32,83,119,97,110,32,
+111,110,108,121,46,46,46,'\n','\n',32,32,32,32,47,47,32,
+68,97,116,97,32,108,111,103,103,105,110,103,'\n',32,32,32,
+32,95,95,110,111,108,105,115,116,32,118,111,105,100,32,67,
+114,101,97,116,101,68,97,116,97,108,111,103,40,99,111,110,
+115,116,32,105,110,116,32,115,105,122,101,41,32,123,32,97,
+115,109,32,123,32,48,120,53,50,44,32,40,115,105,122,101,
+41,44,32,40,115,105,122,101,41,62,62,56,32,125,59,32,
+125,'\n',32,32,32,32,95,95,110,111,108,105,115,116,32,118,
+111,105,100,32,65,100,100,84,111,68,97,116,97,108,111,103,
+40,99,111,110,115,116,32,105,110,116,32,38,118,41,32,32,
+32,32,123,32,97,115,109,32,123,32,48,120,54,50,44,32,
+36,118,32,58,32,95,95,65,83,77,95,78,79,95,76,79,
+67,65,76,32,43,32,95,95,65,83,77,95,83,77,65,76,
+76,95,86,65,76,85,69,32,43,32,48,120,48,48,52,50,
+48,51,125,59,32,125,'\n',32,32,32,32,95,95,110,111,108,
+105,115,116,32,118,111,105,100,32,85,112,108,111,97,100,68,
+97,116,97,108,111,103,40,99,111,110,115,116,32,105,110,116,
+32,115,44,32,99,111,110,115,116,32,105,110,116,32,110,41,
+32,123,32,97,115,109,32,123,32,48,120,97,52,44,32,40,
+115,41,44,32,40,115,41,62,62,56,44,32,40,110,41,44,
+32,40,110,41,62,62,56,32,125,59,32,125,'\n','\n','\n',32,
+32,32,32,47,47,32,116,104,101,32,115,121,115,116,101,109,
+32,99,108,111,99,107,'\n',32,32,32,32,35,100,101,102,105,
+110,101,32,87,97,116,99,104,40,41,32,32,32,32,32,64,
+40,48,120,101,48,48,48,48,41,32,32,47,47,32,114,101,
+97,100,32,116,104,101,32,115,121,115,116,101,109,32,99,108,
+111,99,107,'\n',32,32,32,32,95,95,110,111,108,105,115,116,
+32,118,111,105,100,32,83,101,116,87,97,116,99,104,40,99,
+111,110,115,116,32,105,110,116,32,104,44,32,99,111,110,115,
+116,32,105,110,116,32,109,41,32,32,32,32,123,32,97,115,
+109,32,123,32,48,120,50,50,44,32,104,44,32,109,32,125,
+59,32,125,'\n','\n',32,32,35,105,102,32,95,95,82,67,88,
+61,61,50,32,124,124,32,100,101,102,105,110,101,100,40,95,
+95,83,87,65,78,41,'\n',32,32,32,32,47,47,32,114,101,
+113,117,105,114,101,115,32,82,67,88,50,32,102,105,114,109,
+119,97,114,101,32,110,101,119,101,114,32,116,104,97,110,32,
+102,105,114,109,48,51,50,56,46,108,103,111,32,40,111,114,
+32,83,119,97,110,32,102,105,114,109,119,97,114,101,41,'\n',
+32,32,32,32,35,100,101,102,105,110,101,32,68,97,116,97,
+108,111,103,84,121,112,101,40,110,41,32,32,64,64,40,48,
+120,50,54,50,53,41,91,40,110,41,93,'\n',32,32,32,32,
+35,100,101,102,105,110,101,32,68,97,116,97,108,111,103,86,
+97,108,117,101,40,110,41,32,64,64,40,48,120,50,56,50,
+55,41,91,40,110,41,93,'\n',32,32,32,32,35,100,101,102,
+105,110,101,32,68,97,116,97,108,111,103,66,121,116,101,40,
+110,41,32,32,64,64,40,48,120,50,97,50,57,41,91,40,
+110,41,93,'\n',32,32,35,101,110,100,105,102,'\n','\n',35,101,
+110,100,105,102,'\n','\n','\n',35,105,102,32,100,101,102,105,110,
+101,100,40,95,95,83,67,79,85,84,41,'\n',32,32,32,32,
+47,47,32,83,99,111,117,116,32,45,32,115,112,101,99,105,
+97,108,32,102,117,110,99,116,105,111,110,115,'\n',32,32,32,
+32,95,95,110,111,108,105,115,116,32,118,111,105,100,32,83,
+101,116,83,99,111,117,116,82,117,108,101,115,40,99,111,110,
+115,116,32,105,110,116,32,109,44,32,99,111,110,115,116,32,
+105,110,116,32,116,44,32,99,111,110,115,116,32,105,110,116,
+32,108,44,32,99,111,110,115,116,32,105,110,116,32,116,109,
+44,32,99,111,110,115,116,32,105,110,116,32,102,120,41,'\n',
+32,32,32,32,32,32,32,32,123,32,97,115,109,32,123,32,
+48,120,100,53,44,32,109,44,32,116,44,32,108,44,32,116,
+109,44,32,102,120,32,125,59,32,125,'\n','\n','\n',32,32,32,
+32,35,100,101,102,105,110,101,32,83,67,79,85,84,95,77,
+79,68,69,95,83,84,65,78,68,65,76,79,78,69,32,32,
+32,48,'\n',32,32,32,32,35,100,101,102,105,110,101,32,83,
+67,79,85,84,95,77,79,68,69,95,80,79,87,69,82,32,
+32,32,32,32,32,32,32,49,'\n',32,32,32,32,95,95,110,
+111,108,105,115,116,32,118,111,105,100,32,83,101,116,83,99,
+111,117,116,77,111,100,101,40,99,111,110,115,116,32,105,110,
+116,32,115,41,32,32,32,32,32,32,32,32,32,123,32,97,
+115,109,32,123,32,48,120,52,55,44,32,115,125,59,32,125,
+'\n',32,32,32,32,95,95,110,111,108,105,115,116,32,118,111,
+105,100,32,83,101,116,69,118,101,110,116,70,101,101,100,98,
+97,99,107,40,99,111,110,115,116,32,105,110,116,32,38,120,
+41,32,32,32,32,123,32,97,115,109,32,123,32,48,120,56,
+51,44,32,36,120,32,58,32,95,95,65,83,77,95,83,82,
+67,95,66,65,83,73,67,125,59,32,125,'\n',35,101,110,100,
+105,102,'\n','\n','\n',35,105,102,32,100,101,102,105,110,101,100,
+40,95,95,83,67,79,85,84,41,32,124,124,32,95,95,82,
+67,88,61,61,50,32,124,124,32,100,101,102,105,110,101,100,
+40,95,95,83,80,89,41,32,124,124,32,100,101,102,105,110,
+101,100,40,95,95,83,87,65,78,41,'\n',32,32,32,32,95,
+95,110,111,108,105,115,116,32,118,111,105,100,32,83,101,116,
+80,114,105,111,114,105,116,121,40,99,111,110,115,116,32,105,
+110,116,32,112,41,32,32,123,32,97,115,109,32,123,32,48,
+120,100,55,44,32,112,32,125,59,32,125,'\n',35,101,110,100,
+105,102,'\n','\n','\n',35,105,102,32,95,95,82,67,88,61,61,
+50,32,124,124,32,100,101,102,105,110,101,100,40,95,95,83,
+80,89,41,32,124,124,32,100,101,102,105,110,101,100,40,95,
+95,83,87,65,78,41,'\n',32,32,32,32,95,95,110,111,108,
+105,115,116,32,118,111,105,100,32,83,101,116,40,99,111,110,
+115,116,32,105,110,116,32,38,100,115,116,44,32,99,111,110,
+115,116,32,105,110,116,32,38,115,114,99,41,32,32,32,123,
+32,97,115,109,32,123,32,48,120,48,53,44,32,36,100,115,
+116,32,58,32,95,95,65,83,77,95,83,77,65,76,76,95,
+86,65,76,85,69,44,32,36,115,114,99,32,125,59,32,125,
+'\n',35,101,110,100,105,102,'\n','\n','\n',35,105,102,32,95,95,
+82,67,88,61,61,50,32,124,124,32,100,101,102,105,110,101,
+100,40,95,95,83,87,65,78,41,'\n',32,32,32,32,95,95,
+110,111,108,105,115,116,32,118,111,105,100,32,83,101,108,101,
+99,116,80,114,111,103,114,97,109,40,99,111,110,115,116,32,
+105,110,116,32,110,41,32,32,32,32,32,32,32,32,123,32,
+97,115,109,32,123,32,48,120,57,49,44,32,110,32,125,59,
+32,125,'\n',35,101,110,100,105,102,'\n','\n','\n',35,105,102,32,
+100,101,102,105,110,101,100,40,95,95,83,67,79,85,84,41,
+32,124,124,32,95,95,82,67,88,61,61,50,32,124,124,32,
+100,101,102,105,110,101,100,40,95,95,83,80,89,41,32,124,
+124,32,100,101,102,105,110,101,100,40,95,95,83,87,65,78,
+41,'\n',32,32,32,32,47,47,32,99,111,110,115,116,97,110,
+116,115,32,102,111,114,32,97,99,113,117,105,114,101,40,41,
+'\n',32,32,32,32,35,100,101,102,105,110,101,32,65,67,81,
+85,73,82,69,95,79,85,84,95,65,32,32,32,40,49,32,
+60,60,32,48,41,'\n',32,32,32,32,35,100,101,102,105,110,
+101,32,65,67,81,85,73,82,69,95,79,85,84,95,66,32,
+32,32,40,49,32,60,60,32,49,41,'\n',32,32,32,32,35,
+100,101,102,105,110,101,32,65,67,81,85,73,82,69,95,83,
+79,85,78,68,32,32,32,40,49,32,60,60,32,50,41,'\n',
+32,32,32,32,35,100,101,102,105,110,101,32,65,67,81,85,
+73,82,69,95,79,85,84,95,67,32,32,32,40,49,32,60,
+60,32,51,41,'\n',35,101,110,100,105,102,'\n','\n',35,105,102,
+32,100,101,102,105,110,101,100,40,95,95,83,80,89,41,'\n',
+32,32,32,32,35,100,101,102,105,110,101,32,65,67,81,85,
+73,82,69,95,76,69,68,32,32,32,32,32,40,49,32,60,
+60,32,52,41,'\n',35,101,110,100,105,102,'\n','\n',35,105,102,
+32,95,95,82,67,88,61,61,50,32,124,124,32,100,101,102,
+105,110,101,100,40,95,95,83,87,65,78,41,'\n',32,32,32,
+32,47,47,32,109,111,114,101,32,99,111,110,115,116,97,110,
+116,115,32,102,111,114,32,97,99,113,117,105,114,101,40,41,
+32,45,32,82,67,88,50,32,111,110,108,121,'\n',32,32,32,
+32,35,100,101,102,105,110,101,32,65,67,81,85,73,82,69,
+95,85,83,69,82,95,49,32,32,40,49,32,60,60,32,52,
+41,'\n',32,32,32,32,35,100,101,102,105,110,101,32,65,67,
+81,85,73,82,69,95,85,83,69,82,95,50,32,32,40,49,
+32,60,60,32,53,41,'\n',32,32,32,32,35,100,101,102,105,
+110,101,32,65,67,81,85,73,82,69,95,85,83,69,82,95,
+51,32,32,40,49,32,60,60,32,54,41,'\n',32,32,32,32,
+35,100,101,102,105,110,101,32,65,67,81,85,73,82,69,95,
+85,83,69,82,95,52,32,32,40,49,32,60,60,32,55,41,
+'\n',35,101,110,100,105,102,'\n','\n','\n','\n',47,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,'\n',32,42,32,79,116,104,101,114,32,
+100,97,116,97,32,115,111,117,114,99,101,115,'\n',32,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,47,'\n','\n','\n',35,100,101,102,
+105,110,101,32,82,97,110,100,111,109,40,110,41,32,32,32,
+32,32,32,32,64,40,48,120,52,48,48,48,48,32,43,32,
+40,110,41,41,32,32,32,32,47,47,32,97,32,114,97,110,
+100,111,109,32,110,117,109,98,101,114,'\n',35,105,102,32,95,
+95,82,67,88,61,61,50,32,124,124,32,100,101,102,105,110,
+101,100,40,95,95,83,80,89,41,32,124,124,32,100,101,102,
+105,110,101,100,40,95,95,83,87,65,78,41,'\n',32,32,32,
+32,95,95,110,111,108,105,115,116,32,118,111,105,100,32,83,
+101,116,82,97,110,100,111,109,83,101,101,100,40,99,111,110,
+115,116,32,105,110,116,32,38,118,41,32,32,32,123,32,83,
+101,116,40,82,97,110,100,111,109,40,48,41,44,32,118,41,
+59,32,125,'\n',35,101,110,100,105,102,'\n','\n','\n',35,105,102,
+100,101,102,32,95,95,82,67,88,32,124,124,32,100,101,102,
+105,110,101,100,40,95,95,83,87,65,78,41,'\n',32,32,32,
+32,47,47,32,82,67,88,32,115,112,101,99,105,102,105,99,
+32,100,97,116,97,32,115,111,117,114,99,101,115,'\n',32,32,
+32,32,35,100,101,102,105,110,101,32,80,114,111,103,114,97,
+109,40,41,32,32,32,64,40,48,120,56,48,48,48,48,41,
+32,32,47,47,32,99,117,114,114,101,110,116,108,121,32,97,
+99,116,105,118,101,32,112,114,111,103,114,97,109,'\n',35,101,
+110,100,105,102,'\n','\n','\n',35,105,102,100,101,102,32,95,95,
+67,77,'\n',32,32,32,32,47,47,32,67,77,32,115,112,101,
+99,105,102,105,99,32,100,97,116,97,32,115,111,117,114,99,
+101,115,'\n',32,32,32,32,35,100,101,102,105,110,101,32,65,
+71,67,40,41,32,32,32,32,32,32,32,64,40,48,120,49,
+48,48,48,48,48,41,32,47,47,32,65,117,116,111,109,97,
+116,105,99,32,71,97,105,110,32,67,111,110,116,114,111,108,
+'\n',35,101,110,100,105,102,'\n','\n','\n',35,105,102,32,100,101,
+102,105,110,101,100,40,95,95,83,67,79,85,84,41,'\n',32,
+32,32,32,35,100,101,102,105,110,101,32,83,99,111,117,116,
+82,117,108,101,115,40,110,41,32,32,32,64,40,48,120,49,
+50,48,48,48,48,32,43,32,40,110,41,41,'\n',32,32,32,
+32,35,100,101,102,105,110,101,32,84,105,109,101,114,76,105,
+109,105,116,40,110,41,32,32,32,64,40,48,120,49,52,48,
+48,48,48,32,43,32,40,110,41,41,'\n',32,32,32,32,35,
+100,101,102,105,110,101,32,67,111,117,110,116,101,114,76,105,
+109,105,116,40,110,41,32,64,40,48,120,49,54,48,48,48,
+48,32,43,32,40,110,41,41,'\n',32,32,32,32,35,100,101,
+102,105,110,101,32,69,118,101,110,116,70,101,101,100,98,97,
+99,107,40,41,32,64,40,48,120,49,56,48,48,48,48,41,
+'\n',35,101,110,100,105,102,'\n','\n','\n',35,105,102,32,95,95,
+82,67,88,61,61,50,32,124,124,32,100,101,102,105,110,101,
+100,40,95,95,83,80,89,41,32,124,124,32,100,101,102,105,
+110,101,100,40,95,95,83,87,65,78,41,'\n',32,32,32,32,
+35,100,101,102,105,110,101,32,66,97,116,116,101,114,121,76,
+101,118,101,108,40,41,32,32,32,32,32,32,64,40,48,120,
+50,50,48,48,48,48,41,'\n',32,32,32,32,35,100,101,102,
+105,110,101,32,70,105,114,109,119,97,114,101,86,101,114,115,
+105,111,110,40,41,32,32,32,64,40,48,120,50,51,48,48,
+48,48,41,'\n',32,32,32,32,35,100,101,102,105,110,101,32,
+73,110,100,105,114,101,99,116,40,110,41,32,32,32,32,32,
+32,32,32,32,64,40,48,120,50,52,48,48,48,48,32,43,
+32,40,110,41,41,32,47,47,32,105,110,100,105,114,101,99,
+116,32,118,97,114,105,97,98,108,101,32,114,101,103,105,115,
+116,101,114,115,'\n','\n',32,32,32,32,95,95,110,111,108,105,
+115,116,32,118,111,105,100,32,83,101,116,73,110,100,105,114,
+101,99,116,86,97,114,40,99,111,110,115,116,32,105,110,116,
+32,38,118,44,32,99,111,110,115,116,32,105,110,116,32,38,
+110,41,'\n',32,32,32,32,32,32,32,32,123,32,97,115,109,
+32,123,32,48,120,48,53,44,32,48,120,50,52,44,32,36,
+118,32,58,32,48,120,51,48,48,48,48,48,49,44,32,36,
+110,32,125,59,32,125,'\n',35,101,110,100,105,102,'\n','\n','\n',
+'\n',47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,'\n',32,42,32,
+68,101,102,97,117,108,116,32,105,110,105,116,105,97,108,105,
+122,97,116,105,111,110,'\n',32,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,47,'\n','\n',95,95,110,111,108,105,115,116,32,118,111,
+105,100,32,95,105,110,105,116,40,41,'\n',123,'\n',32,32,32,
+32,83,101,116,80,111,119,101,114,40,79,85,84,95,65,32,
+43,32,79,85,84,95,66,32,43,32,79,85,84,95,67,44,
+32,79,85,84,95,70,85,76,76,41,59,'\n',32,32,32,32,
+70,119,100,40,79,85,84,95,65,32,43,32,79,85,84,95,
+66,32,43,32,79,85,84,95,67,41,59,'\n',125,'\n','\n','\n',
+47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,'\n',32,42,32,83,
+99,111,117,116,32,99,111,109,112,97,116,105,98,105,108,105,
+116,121,32,65,80,73,'\n',32,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,47,'\n','\n',35,105,102,100,101,102,32,95,95,83,67,
+79,85,84,95,67,79,77,80,65,84,'\n',32,32,32,32,47,
+42,'\n',32,32,32,32,32,42,32,83,99,111,117,116,32,115,
+117,112,112,111,114,116,32,119,97,115,32,105,110,105,116,105,
+97,108,108,121,32,114,101,108,101,97,115,101,100,32,119,105,
+116,104,32,112,114,101,108,105,109,105,110,97,114,121,32,65,
+80,73,115,32,116,104,97,116,'\n',32,32,32,32,32,42,32,
+119,101,114,101,32,115,116,121,108,101,100,32,97,102,116,101,
+114,32,116,104,101,32,76,65,83,77,32,109,110,101,109,111,
+110,105,99,115,46,32,32,85,110,102,111,114,116,117,110,97,
+116,101,108,121,44,32,116,104,101,115,101,32,109,110,101,109,
+111,110,105,99,115,'\n',32,32,32,32,32,42,32,108,101,100,
+32,116,111,32,115,111,109,101,32,114,97,116,104,101,114,32,
+105,110,99,111,110,115,105,115,116,101,110,116,32,65,80,73,
+115,46,32,32,73,110,32,111,114,100,101,114,32,116,111,32,
+97,108,105,103,110,32,116,104,101,32,83,99,111,117,116,'\n',
+32,32,32,32,32,42,32,65,80,73,32,119,105,116,104,32,
+116,104,101,32,82,67,88,32,50,46,48,32,65,80,73,32,
+97,32,110,117,109,98,101,114,32,111,102,32,99,97,108,108,
+115,32,104,97,118,101,32,98,101,101,110,32,99,104,97,110,
+103,101,100,46,32,32,84,104,101,'\n',32,32,32,32,32,42,
+32,111,102,102,105,99,105,97,108,32,99,97,108,108,115,32,
+97,112,112,101,97,114,32,105,110,32,116,104,101,32,118,97,
+114,105,111,117,115,32,115,101,99,116,105,111,110,115,32,97,
+98,111,118,101,46,32,32,84,104,101,32,115,101,99,116,105,
+111,110,'\n',32,32,32,32,32,42,32,98,101,108,111,119,32,
+105,115,32,97,32,116,101,109,112,111,114,97,114,121,32,104,
+97,99,107,32,116,111,32,101,97,115,101,32,116,104,101,32,
+116,114,97,110,115,105,116,105,111,110,32,98,101,116,119,101,
+101,110,32,116,104,101,32,111,108,100,'\n',32,32,32,32,32,
+42,32,97,110,100,32,110,101,119,32,83,99,111,117,116,32,
+65,80,73,115,46,32,32,65,108,108,32,111,102,32,111,108,
+100,32,99,97,108,108,115,32,116,104,97,116,32,119,101,114,
+101,32,100,114,111,112,112,101,100,32,40,111,114,32,99,104,
+97,110,103,101,100,41,'\n',32,32,32,32,32,42,32,105,110,
+32,116,104,101,32,110,101,119,32,65,80,73,32,97,112,112,
+101,97,114,32,98,101,108,111,119,44,32,98,117,116,32,119,
+105,116,104,32,97,32,112,114,101,99,101,100,105,110,103,32,
+117,110,100,101,114,115,99,111,114,101,46,32,32,70,111,114,
+'\n',32,32,32,32,32,42,32,101,120,97,109,112,108,101,44,
+32,116,104,101,32,111,108,100,32,71,83,101,116,79,117,116,
+112,117,116,40,41,32,99,97,108,108,32,110,111,119,32,97,
+112,112,101,97,114,115,32,97,115,32,95,71,83,101,116,79,
+117,116,112,117,116,40,41,46,'\n',32,32,32,32,32,42,32,
+73,102,32,121,111,117,32,97,114,101,32,105,110,32,97,32,
+104,117,114,114,121,32,116,111,32,103,101,116,32,121,111,117,
+114,32,111,108,100,32,83,99,111,117,116,32,112,114,111,103,
+114,97,109,32,119,111,114,107,105,110,103,44,32,121,111,117,
+'\n',32,32,32,32,32,42,32,99,97,110,32,106,117,115,116,
+32,112,114,101,112,101,110,100,32,117,110,100,101,114,115,99,
+111,114,101,115,32,116,111,32,116,104,101,32,118,97,114,105,
+111,117,115,32,111,98,115,111,108,101,116,101,32,99,97,108,
+108,115,46,32,32,72,111,119,101,118,101,114,44,'\n',32,32,
+32,32,32,42,32,97,32,108,111,110,103,101,114,32,116,101,
+114,109,32,102,105,120,32,105,115,32,116,111,32,117,115,101,
+32,116,104,101,32,110,101,119,32,65,80,73,115,32,97,98,
+111,118,101,46,'\n',32,32,32,32,32,42,47,'\n','\n','\n',32,
+32,32,32,47,47,32,103,108,111,98,97,108,32,111,117,116,
+112,117,116,32,102,117,110,99,116,105,111,110,115,'\n',32,32,
+32,32,118,111,105,100,32,95,71,83,101,116,79,117,116,112,
+117,116,40,99,111,110,115,116,32,105,110,116,32,111,44,32,
+99,111,110,115,116,32,105,110,116,32,109,41,32,32,32,32,
+32,32,123,32,97,115,109,32,123,32,48,120,54,55,44,32,
+40,111,41,32,43,32,40,109,41,32,125,59,32,125,'\n',32,
+32,32,32,118,111,105,100,32,95,71,83,101,116,68,105,114,
+101,99,116,105,111,110,40,99,111,110,115,116,32,105,110,116,
+32,111,44,32,99,111,110,115,116,32,105,110,116,32,100,41,
+32,32,32,123,32,97,115,109,32,123,32,48,120,55,55,44,
+32,40,111,41,32,43,32,40,100,41,32,125,59,32,125,'\n',
+32,32,32,32,118,111,105,100,32,95,71,83,101,116,80,111,
+119,101,114,40,99,111,110,115,116,32,105,110,116,32,111,44,
+32,99,111,110,115,116,32,105,110,116,32,38,112,41,32,32,
+32,32,32,32,123,32,97,115,109,32,123,32,48,120,97,51,
+44,32,40,111,41,44,32,36,112,32,58,32,48,120,49,48,
+48,48,48,49,53,125,59,32,125,'\n',32,32,32,32,118,111,
+105,100,32,95,71,79,110,40,99,111,110,115,116,32,105,110,
+116,32,111,41,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,32,
+95,71,83,101,116,79,117,116,112,117,116,40,111,44,32,79,
+85,84,95,79,78,41,59,32,125,'\n',32,32,32,32,118,111,
+105,100,32,95,71,79,102,102,40,99,111,110,115,116,32,105,
+110,116,32,111,41,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,32,
+95,71,83,101,116,79,117,116,112,117,116,40,111,44,32,79,
+85,84,95,79,70,70,41,59,32,125,'\n',32,32,32,32,118,
+111,105,100,32,95,71,70,108,111,97,116,40,99,111,110,115,
+116,32,105,110,116,32,111,41,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,
+32,95,71,83,101,116,79,117,116,112,117,116,40,111,44,32,
+79,85,84,95,70,76,79,65,84,41,59,32,125,'\n',32,32,
+32,32,118,111,105,100,32,95,71,84,111,103,103,108,101,40,
+99,111,110,115,116,32,105,110,116,32,111,41,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,123,32,95,71,83,101,116,68,105,114,101,99,116,105,
+111,110,40,111,44,32,79,85,84,95,84,79,71,71,76,69,
+41,59,32,125,'\n',32,32,32,32,118,111,105,100,32,95,71,
+70,119,100,40,99,111,110,115,116,32,105,110,116,32,111,41,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,123,32,95,71,83,101,116,
+68,105,114,101,99,116,105,111,110,40,111,44,32,79,85,84,
+95,70,87,68,41,59,32,125,'\n',32,32,32,32,118,111,105,
+100,32,95,71,82,101,118,40,99,111,110,115,116,32,105,110,
+116,32,111,41,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,123,32,95,
+71,83,101,116,68,105,114,101,99,116,105,111,110,40,111,44,
+32,79,85,84,95,82,69,86,41,59,32,125,'\n',32,32,32,
+32,118,111,105,100,32,95,71,79,110,70,119,100,40,99,111,
+110,115,116,32,105,110,116,32,111,41,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,123,32,95,71,70,119,100,40,111,41,59,32,71,79,110,
+40,111,41,59,32,125,'\n',32,32,32,32,118,111,105,100,32,
+95,71,79,110,82,101,118,40,99,111,110,115,116,32,105,110,
+116,32,111,41,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,123,32,95,71,82,
+101,118,40,111,41,59,32,71,79,110,40,111,41,59,32,125,
+'\n',32,32,32,32,118,111,105,100,32,95,71,79,110,70,111,
+114,40,99,111,110,115,116,32,105,110,116,32,111,44,32,99,
+111,110,115,116,32,105,110,116,32,38,116,41,32,32,32,32,
+32,32,32,32,32,123,32,71,79,110,40,111,41,59,32,87,
+97,105,116,40,116,41,59,32,71,79,102,102,40,111,41,59,
+32,125,'\n','\n','\n',32,32,32,32,118,111,105,100,32,95,87,
+97,105,116,69,118,101,110,116,115,40,99,111,110,115,116,32,
+105,110,116,32,38,109,97,115,107,41,32,123,32,97,115,109,
+32,123,32,48,120,98,52,44,32,36,109,97,115,107,32,58,
+32,95,95,65,83,77,95,83,82,67,95,69,88,84,44,32,
+51,44,32,48,120,50,55,44,32,48,120,56,49,32,125,59,
+32,125,32,47,47,32,117,115,101,32,109,111,110,105,116,111,
+114,40,41,'\n','\n','\n',32,32,32,32,47,47,32,108,105,103,
+104,116,32,115,101,110,115,111,114,'\n',32,32,32,32,118,111,
+105,100,32,95,76,83,66,108,105,110,107,40,99,111,110,115,
+116,32,105,110,116,32,38,120,41,32,123,32,97,115,109,32,
+123,32,48,120,101,51,44,32,36,120,32,58,32,48,120,48,
+48,48,53,32,125,59,32,125,32,32,47,47,32,117,115,101,
+32,83,101,116,83,101,110,115,111,114,66,108,105,110,107,'\n',
+32,32,32,32,118,111,105,100,32,95,76,83,67,97,108,40,
+41,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+123,32,97,115,109,32,123,32,48,120,99,48,32,125,59,32,
+125,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+47,47,32,117,115,101,32,67,97,108,105,98,114,97,116,101,
+83,101,110,115,111,114,'\n',32,32,32,32,118,111,105,100,32,
+95,76,83,72,121,115,116,40,99,111,110,115,116,32,105,110,
+116,32,38,120,41,32,32,123,32,97,115,109,32,123,32,48,
+120,100,51,44,32,36,120,32,58,32,48,120,48,48,48,53,
+32,125,59,32,125,32,32,47,47,32,117,115,101,32,83,101,
+116,83,101,110,115,111,114,72,121,115,116,'\n',32,32,32,32,
+118,111,105,100,32,95,76,83,76,111,119,101,114,40,99,111,
+110,115,116,32,105,110,116,32,38,120,41,32,123,32,97,115,
+109,32,123,32,48,120,99,51,44,32,36,120,32,58,32,48,
+120,48,48,48,53,32,125,59,32,125,32,32,47,47,32,117,
+115,101,32,83,101,116,83,101,110,115,111,114,76,111,119,101,
+114,'\n',32,32,32,32,118,111,105,100,32,95,76,83,85,112,
+112,101,114,40,99,111,110,115,116,32,105,110,116,32,38,120,
+41,32,123,32,97,115,109,32,123,32,48,120,98,51,44,32,
+36,120,32,58,32,48,120,48,48,48,53,32,125,59,32,125,
+32,32,47,47,32,117,115,101,32,83,101,116,83,101,110,115,
+111,114,85,112,112,101,114,'\n','\n','\n',32,32,32,32,47,47,
+32,111,116,104,101,114,'\n',32,32,32,32,118,111,105,100,32,
+95,82,117,108,101,115,40,99,111,110,115,116,32,105,110,116,
+32,109,44,32,99,111,110,115,116,32,105,110,116,32,116,44,
+32,99,111,110,115,116,32,105,110,116,32,108,44,32,99,111,
+110,115,116,32,105,110,116,32,116,109,44,32,99,111,110,115,
+116,32,105,110,116,32,102,120,41,'\n',32,32,32,32,32,32,
+32,32,123,32,97,115,109,32,123,32,48,120,100,53,44,32,
+109,44,32,116,44,32,108,44,32,116,109,44,32,102,120,32,
+125,59,32,125,32,47,47,32,115,101,101,32,83,101,116,83,
+99,111,117,116,82,117,108,101,115,'\n',32,32,32,32,118,111,
+105,100,32,95,83,99,111,117,116,40,99,111,110,115,116,32,
+105,110,116,32,115,41,32,32,32,32,32,32,32,32,32,32,
+32,32,123,32,97,115,109,32,123,32,48,120,52,55,44,32,
+115,125,59,32,125,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,47,47,32,83,101,116,83,99,111,117,
+116,77,111,100,101,'\n',32,32,32,32,118,111,105,100,32,95,
+83,101,116,70,101,101,100,98,97,99,107,40,99,111,110,115,
+116,32,105,110,116,32,38,120,41,32,32,32,32,32,123,32,
+97,115,109,32,123,32,48,120,56,51,44,32,36,120,32,58,
+32,48,120,48,48,48,53,125,59,32,125,32,32,32,32,32,
+32,32,47,47,32,83,101,116,69,118,101,110,116,70,101,101,
+100,98,97,99,107,'\n','\n',32,32,32,32,118,111,105,100,32,
+95,83,111,117,110,100,40,99,111,110,115,116,32,105,110,116,
+32,120,41,32,32,32,32,32,32,32,32,32,32,32,32,123,
+32,97,115,109,32,123,32,48,120,53,55,44,32,120,32,125,
+59,32,125,32,32,32,32,47,47,32,117,115,101,32,77,117,
+116,101,83,111,117,110,100,44,32,85,110,109,117,116,101,83,
+111,117,110,100,32,97,110,100,32,83,101,108,101,99,116,83,
+111,117,110,100,115,'\n','\n','\n',32,32,32,32,118,111,105,100,
+32,95,86,76,76,40,99,111,110,115,116,32,105,110,116,32,
+38,120,41,32,32,32,32,32,32,32,32,32,32,32,32,32,
+123,32,97,115,109,32,123,32,48,120,101,50,44,32,36,120,
+32,58,32,48,120,49,48,48,48,48,48,53,125,59,32,125,
+32,32,32,32,47,47,32,117,115,101,32,83,101,110,100,86,
+76,76,'\n',32,32,32,32,118,111,105,100,32,95,82,84,83,
+40,41,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,123,32,97,115,109,
+32,123,32,48,120,102,54,32,125,59,32,125,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,47,
+47,32,100,111,110,39,116,32,101,118,101,114,32,110,101,101,
+100,32,116,104,105,115,'\n','\n','\n',32,32,32,32,47,47,32,
+117,115,101,32,116,104,101,115,101,32,102,111,114,32,99,97,
+108,108,105,110,103,32,115,117,98,114,111,117,116,105,110,101,
+115,46,46,46,102,111,114,32,101,120,97,109,112,108,101,58,
+'\n',32,32,32,32,47,47,'\n',32,32,32,32,47,47,32,108,
+111,99,97,108,40,48,41,32,61,32,49,59,'\n',32,32,32,
+32,47,47,32,67,97,108,108,40,51,41,59,'\n',32,32,32,
+32,47,47,'\n',32,32,32,32,35,100,101,102,105,110,101,32,
+108,111,99,97,108,40,110,41,32,32,32,32,32,32,32,32,
+32,32,32,32,40,64,40,40,110,41,32,43,32,49,48,41,
+41,'\n',32,32,32,32,118,111,105,100,32,67,97,108,108,40,
+99,111,110,115,116,32,105,110,116,32,110,41,32,32,32,32,
+32,32,123,32,97,115,109,32,123,32,48,120,49,55,44,32,
+110,32,125,59,32,125,'\n',35,101,110,100,105,102,32,47,47,
+32,95,95,83,67,79,85,84,95,67,79,77,80,65,84,'\n',
+'\n',35,105,102,32,100,101,102,105,110,101,100,40,95,95,83,
+67,79,85,84,41,'\n','\n',35,101,110,100,105,102,'\n','\n',47,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,'\n',32,42,32,83,112,
+121,98,111,116,45,115,112,101,99,105,102,105,99,32,65,80,
+73,'\n',32,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,47,'\n','\n',
+35,105,102,32,100,101,102,105,110,101,100,40,95,95,83,80,
+89,41,'\n','\n',32,32,47,47,32,76,69,68,39,115,32,109,
+97,121,32,98,101,32,115,101,116,47,99,104,101,99,107,101,
+100,32,109,97,110,117,97,108,108,121,'\n',32,32,35,100,101,
+102,105,110,101,32,76,69,68,40,110,41,32,32,32,32,32,
+32,32,32,32,32,32,32,64,40,48,120,49,54,48,48,48,
+48,32,43,32,40,110,41,41,32,32,32,47,47,32,76,69,
+68,32,99,111,110,116,114,111,108,32,114,101,103,105,115,116,
+101,114,115,'\n',32,32,95,95,110,111,108,105,115,116,32,118,
+111,105,100,32,83,101,116,76,69,68,40,99,111,110,115,116,
+32,105,110,116,32,109,111,100,101,44,32,99,111,110,115,116,
+32,105,110,116,32,38,118,41,32,32,32,32,123,32,83,101,
+116,40,76,69,68,40,109,111,100,101,41,44,32,118,41,59,
+32,125,'\n','\n',32,32,47,47,32,99,111,110,115,116,97,110,
+116,115,32,102,111,114,32,116,104,101,32,109,111,100,101,32,
+97,114,103,117,109,101,110,116,32,105,110,32,83,101,116,76,
+69,68,40,41,'\n',32,32,35,100,101,102,105,110,101,32,76,
+69,68,95,77,79,68,69,95,79,78,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,48,'\n',32,32,35,100,101,
+102,105,110,101,32,76,69,68,95,77,79,68,69,95,66,76,
+73,78,75,32,32,32,32,32,32,32,32,32,32,32,32,49,
+'\n',32,32,35,100,101,102,105,110,101,32,76,69,68,95,77,
+79,68,69,95,68,85,82,65,84,73,79,78,32,32,32,32,
+32,32,32,32,32,50,'\n',32,32,35,100,101,102,105,110,101,
+32,76,69,68,95,77,79,68,69,95,83,67,65,76,69,32,
+32,32,32,32,32,32,32,32,32,32,32,51,'\n',32,32,35,
+100,101,102,105,110,101,32,76,69,68,95,77,79,68,69,95,
+83,67,65,76,69,95,66,76,73,78,75,32,32,32,32,32,
+32,52,'\n',32,32,35,100,101,102,105,110,101,32,76,69,68,
+95,77,79,68,69,95,83,67,65,76,69,95,68,85,82,65,
+84,73,79,78,32,32,32,53,'\n',32,32,35,100,101,102,105,
+110,101,32,76,69,68,95,77,79,68,69,95,82,69,68,95,
+83,67,65,76,69,32,32,32,32,32,32,32,32,54,'\n',32,
+32,35,100,101,102,105,110,101,32,76,69,68,95,77,79,68,
+69,95,82,69,68,95,83,67,65,76,69,95,66,76,73,78,
+75,32,32,55,'\n',32,32,35,100,101,102,105,110,101,32,76,
+69,68,95,77,79,68,69,95,71,82,69,69,78,95,83,67,
+65,76,69,32,32,32,32,32,32,56,'\n',32,32,35,100,101,
+102,105,110,101,32,76,69,68,95,77,79,68,69,95,71,82,
+69,69,78,95,83,67,65,76,69,95,66,76,73,78,75,32,
+32,32,32,57,'\n',32,32,35,100,101,102,105,110,101,32,76,
+69,68,95,77,79,68,69,95,89,69,76,76,79,87,32,32,
+32,32,32,32,32,32,32,32,32,49,48,'\n',32,32,35,100,
+101,102,105,110,101,32,76,69,68,95,77,79,68,69,95,89,
+69,76,76,79,87,95,66,76,73,78,75,32,32,32,32,32,
+49,49,'\n',32,32,35,100,101,102,105,110,101,32,76,69,68,
+95,77,79,68,69,95,89,69,76,76,79,87,95,68,85,82,
+65,84,73,79,78,32,32,49,50,'\n',32,32,35,100,101,102,
+105,110,101,32,76,69,68,95,77,79,68,69,95,86,76,76,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,49,51,
+'\n',32,32,35,100,101,102,105,110,101,32,76,69,68,95,77,
+79,68,69,95,86,76,76,95,66,76,73,78,75,32,32,32,
+32,32,32,32,32,49,52,'\n',32,32,35,100,101,102,105,110,
+101,32,76,69,68,95,77,79,68,69,95,86,76,76,95,68,
+85,82,65,84,73,79,78,32,32,32,32,32,49,53,'\n','\n',
+32,32,47,47,32,82,79,77,32,97,110,105,109,97,116,105,
+111,110,115,32,40,102,111,114,32,116,104,101,32,102,114,111,
+110,116,32,76,69,68,115,41,'\n',32,32,35,100,101,102,105,
+110,101,32,65,78,73,77,65,84,73,79,78,95,83,67,65,
+78,32,32,32,32,32,32,32,32,32,32,32,32,48,'\n',32,
+32,35,100,101,102,105,110,101,32,65,78,73,77,65,84,73,
+79,78,95,83,80,65,82,75,76,69,32,32,32,32,32,32,
+32,32,32,49,'\n',32,32,35,100,101,102,105,110,101,32,65,
+78,73,77,65,84,73,79,78,95,70,76,65,83,72,32,32,
+32,32,32,32,32,32,32,32,32,50,'\n',32,32,35,100,101,
+102,105,110,101,32,65,78,73,77,65,84,73,79,78,95,82,
+69,68,95,84,79,95,71,82,69,69,78,32,32,32,32,51,
+'\n',32,32,35,100,101,102,105,110,101,32,65,78,73,77,65,
+84,73,79,78,95,71,82,69,69,78,95,84,79,95,82,69,
+68,32,32,32,32,52,'\n',32,32,35,100,101,102,105,110,101,
+32,65,78,73,77,65,84,73,79,78,95,80,79,73,78,84,
+95,70,79,82,87,65,82,68,32,32,32,53,'\n',32,32,35,
+100,101,102,105,110,101,32,65,78,73,77,65,84,73,79,78,
+95,65,76,65,82,77,32,32,32,32,32,32,32,32,32,32,
+32,54,'\n',32,32,35,100,101,102,105,110,101,32,65,78,73,
+77,65,84,73,79,78,95,84,72,73,78,75,73,78,71,32,
+32,32,32,32,32,32,32,55,'\n','\n',32,32,47,47,32,109,
+97,99,114,111,32,102,111,114,32,100,101,102,105,110,105,110,
+103,32,97,32,117,115,101,114,32,97,110,105,109,97,116,105,
+111,110,58,'\n',32,32,47,47,32,32,32,32,65,78,73,77,
+65,84,73,79,78,32,109,121,95,97,110,105,109,97,116,105,
+111,110,32,123,32,49,44,32,49,48,44,32,50,44,32,49,
+48,44,32,52,44,32,49,48,44,32,50,44,32,49,48,44,
+32,50,53,53,44,32,50,53,53,32,125,59,'\n',32,32,47,
+47,'\n',32,32,35,100,101,102,105,110,101,32,65,78,73,77,
+65,84,73,79,78,32,95,95,114,101,115,32,51,'\n','\n',32,
+32,47,47,32,102,117,110,99,116,105,111,110,32,116,111,32,
+115,116,97,114,116,32,97,32,103,105,118,101,110,32,97,110,
+105,109,97,116,105,111,110,'\n',32,32,95,95,110,111,108,105,
+115,116,32,118,111,105,100,32,83,101,116,65,110,105,109,97,
+116,105,111,110,40,99,111,110,115,116,32,105,110,116,32,116,
+41,32,32,32,123,32,97,115,109,32,123,32,48,120,99,55,
+44,32,116,32,125,59,32,125,'\n','\n',32,32,35,100,101,102,
+105,110,101,32,65,110,105,109,97,116,101,76,69,68,40,102,
+44,32,116,41,32,102,44,32,116,'\n',32,32,35,100,101,102,
+105,110,101,32,82,101,112,101,97,116,65,110,105,109,97,116,
+105,111,110,40,41,32,48,120,70,70,44,32,48,'\n','\n',32,
+32,35,100,101,102,105,110,101,32,83,79,85,78,68,69,70,
+70,69,67,84,32,95,95,114,101,115,32,50,'\n','\n',32,32,
+35,100,101,102,105,110,101,32,71,97,116,101,40,111,44,32,
+112,41,32,32,32,32,32,32,32,32,48,120,54,50,44,32,
+112,44,32,111,'\n',32,32,35,100,101,102,105,110,101,32,71,
+97,116,101,79,102,102,40,41,32,32,32,32,32,32,32,32,
+32,48,120,55,48,'\n',32,32,35,100,101,102,105,110,101,32,
+71,108,105,100,101,40,115,44,32,112,44,32,116,41,32,32,
+32,32,48,120,52,53,44,32,116,44,32,115,32,38,32,48,
+120,70,70,44,32,115,32,62,62,32,56,44,32,112,32,38,
+32,48,120,70,70,44,32,112,32,62,62,32,56,'\n',32,32,
+35,100,101,102,105,110,101,32,86,105,98,114,97,116,111,40,
+115,44,32,112,44,32,116,41,32,32,48,120,53,53,44,32,
+116,44,32,115,32,38,32,48,120,70,70,44,32,115,32,62,
+62,32,56,44,32,112,32,38,32,48,120,70,70,44,32,112,
+32,62,62,32,56,'\n',32,32,35,100,101,102,105,110,101,32,
+87,97,105,116,69,102,102,101,99,116,40,116,41,32,32,32,
+32,32,48,120,50,49,44,32,116,'\n',32,32,35,100,101,102,
+105,110,101,32,70,105,120,101,100,87,97,105,116,69,102,102,
+101,99,116,40,116,41,32,48,120,56,49,44,32,116,'\n',32,
+32,35,100,101,102,105,110,101,32,84,111,110,101,40,102,44,
+32,116,41,32,32,32,32,32,32,32,32,48,120,51,51,44,
+32,116,44,32,102,32,38,32,48,120,70,70,44,32,102,32,
+62,62,32,56,'\n',32,32,35,100,101,102,105,110,101,32,70,
+105,120,101,100,84,111,110,101,40,102,44,32,116,41,32,32,
+32,48,120,57,51,44,32,116,44,32,102,32,38,32,48,120,
+70,70,44,32,102,32,62,62,32,56,'\n',32,32,35,100,101,
+102,105,110,101,32,82,101,112,101,97,116,69,102,102,101,99,
+116,40,41,32,32,32,32,48,120,49,48,'\n','\n',32,32,35,
+100,101,102,105,110,101,32,69,102,102,101,99,116,83,111,117,
+110,100,40,41,32,64,40,48,120,51,53,48,48,48,48,41,
+32,47,47,32,83,111,117,110,100,32,69,102,102,101,99,116,
+115,32,99,111,110,116,114,111,108,32,114,101,103,105,115,116,
+101,114,115,32,40,48,44,49,41,'\n',32,32,35,100,101,102,
+105,110,101,32,69,102,102,101,99,116,84,105,109,101,40,41,
+32,32,64,40,48,120,51,53,48,48,48,49,41,'\n','\n',32,
+32,95,95,110,111,108,105,115,116,32,118,111,105,100,32,83,
+101,116,69,102,102,101,99,116,83,111,117,110,100,40,99,111,
+110,115,116,32,105,110,116,32,38,115,41,32,123,32,83,101,
+116,40,69,102,102,101,99,116,83,111,117,110,100,40,41,44,
+32,115,41,59,32,125,'\n',32,32,95,95,110,111,108,105,115,
+116,32,118,111,105,100,32,83,101,116,69,102,102,101,99,116,
+84,105,109,101,40,99,111,110,115,116,32,105,110,116,32,38,
+116,41,32,123,32,83,101,116,40,69,102,102,101,99,116,84,
+105,109,101,40,41,44,32,116,41,59,32,125,'\n','\n',32,32,
+35,100,101,102,105,110,101,32,84,65,82,71,69,84,95,78,
+79,78,69,32,32,32,32,32,32,32,50,53,53,'\n','\n',32,
+32,35,100,101,102,105,110,101,32,82,65,78,71,69,95,78,
+79,87,72,69,82,69,32,32,32,32,32,48,'\n',32,32,35,
+100,101,102,105,110,101,32,82,65,78,71,69,95,65,78,89,
+87,72,69,82,69,32,32,32,32,49,'\n',32,32,35,100,101,
+102,105,110,101,32,82,65,78,71,69,95,84,72,69,82,69,
+32,32,32,32,32,32,32,50,'\n',32,32,35,100,101,102,105,
+110,101,32,82,65,78,71,69,95,72,69,82,69,32,32,32,
+32,32,32,32,32,51,'\n','\n',32,32,35,100,101,102,105,110,
+101,32,68,73,82,69,67,84,73,79,78,95,76,69,70,84,
+32,32,32,32,32,32,32,32,32,32,32,32,48,'\n',32,32,
+35,100,101,102,105,110,101,32,68,73,82,69,67,84,73,79,
+78,95,76,69,70,84,95,79,70,95,67,69,78,84,69,82,
+32,32,49,'\n',32,32,35,100,101,102,105,110,101,32,68,73,
+82,69,67,84,73,79,78,95,67,69,78,84,69,82,32,32,
+32,32,32,32,32,32,32,32,50,'\n',32,32,35,100,101,102,
+105,110,101,32,68,73,82,69,67,84,73,79,78,95,82,73,
+71,72,84,95,79,70,95,67,69,78,84,69,82,32,51,'\n',
+32,32,35,100,101,102,105,110,101,32,68,73,82,69,67,84,
+73,79,78,95,82,73,71,72,84,32,32,32,32,32,32,32,
+32,32,32,32,52,'\n','\n',32,32,35,100,101,102,105,110,101,
+32,65,83,80,69,67,84,95,70,82,79,78,84,95,76,69,
+70,84,32,32,32,32,32,48,'\n',32,32,35,100,101,102,105,
+110,101,32,65,83,80,69,67,84,95,70,82,79,78,84,32,
+32,32,32,32,32,32,32,32,32,49,'\n',32,32,35,100,101,
+102,105,110,101,32,65,83,80,69,67,84,95,70,82,79,78,
+84,95,82,73,71,72,84,32,32,32,32,50,'\n',32,32,35,
+100,101,102,105,110,101,32,65,83,80,69,67,84,95,66,65,
+67,75,95,82,73,71,72,84,32,32,32,32,32,51,'\n',32,
+32,35,100,101,102,105,110,101,32,65,83,80,69,67,84,95,
+66,65,67,75,32,32,32,32,32,32,32,32,32,32,32,52,
+'\n',32,32,35,100,101,102,105,110,101,32,65,83,80,69,67,
+84,95,66,65,67,75,95,76,69,70,84,32,32,32,32,32,
+32,53,'\n','\n',32,32,35,100,101,102,105,110,101,32,83,80,
+89,95,84,65,82,71,69,84,73,68,32,32,48,'\n',32,32,
+35,100,101,102,105,110,101,32,83,80,89,95,78,79,84,69,
+32,32,32,32,32,32,49,'\n',32,32,35,100,101,102,105,110,
+101,32,83,80,89,95,76,73,78,75,73,68,32,32,32,32,
+50,'\n',32,32,35,100,101,102,105,110,101,32,83,80,89,95,
+82,65,78,71,69,32,32,32,32,32,51,'\n',32,32,35,100,
+101,102,105,110,101,32,83,80,89,95,68,73,82,69,67,84,
+73,79,78,32,52,'\n',32,32,35,100,101,102,105,110,101,32,
+83,80,89,95,65,83,80,69,67,84,32,32,32,32,53,'\n',
+32,32,35,100,101,102,105,110,101,32,83,80,89,95,73,78,
+70,79,32,32,32,32,32,32,54,'\n',32,32,35,100,101,102,
+105,110,101,32,83,80,89,95,83,72,79,82,84,73,68,32,
+32,32,55,'\n','\n',32,32,35,100,101,102,105,110,101,32,82,
+69,76,95,71,84,32,32,32,32,48,120,48,48,'\n',32,32,
+35,100,101,102,105,110,101,32,82,69,76,95,76,84,32,32,
+32,32,48,120,52,48,'\n',32,32,35,100,101,102,105,110,101,
+32,82,69,76,95,69,81,32,32,32,32,48,120,56,48,'\n',
+32,32,35,100,101,102,105,110,101,32,82,69,76,95,78,69,
+32,32,32,32,48,120,99,48,'\n','\n',32,32,95,95,110,111,
+108,105,115,116,32,118,111,105,100,32,70,105,110,100,87,111,
+114,108,100,40,105,110,116,32,38,118,44,32,99,111,110,115,
+116,32,105,110,116,32,114,101,108,115,114,99,44,32,99,111,
+110,115,116,32,105,110,116,32,99,114,105,116,44,32,99,111,
+110,115,116,32,105,110,116,38,32,116,104,114,101,115,104,41,
+'\n',32,32,32,32,123,32,97,115,109,32,123,32,48,120,100,
+53,44,32,36,118,32,58,32,48,120,51,48,48,48,48,48,
+49,44,32,48,120,50,97,32,43,32,114,101,108,115,114,99,
+44,32,99,114,105,116,32,43,32,95,95,116,121,112,101,40,
+116,104,114,101,115,104,41,44,32,36,116,104,114,101,115,104,
+32,58,32,95,95,65,83,77,95,78,79,95,84,89,80,69,
+32,125,59,32,125,'\n',32,32,95,95,110,111,108,105,115,116,
+32,118,111,105,100,32,67,108,101,97,114,87,111,114,108,100,
+40,41,32,123,32,97,115,109,32,123,32,48,120,51,54,32,
+125,59,32,125,'\n','\n',32,32,35,100,101,102,105,110,101,32,
+84,97,114,103,101,116,40,110,41,32,64,40,48,120,51,50,
+48,48,48,48,32,43,32,110,41,'\n','\n',32,32,95,95,110,
+111,108,105,115,116,32,118,111,105,100,32,83,101,116,84,97,
+114,103,101,116,73,68,40,99,111,110,115,116,32,105,110,116,
+32,38,118,41,32,123,32,83,101,116,40,84,97,114,103,101,
+116,40,83,80,89,95,84,65,82,71,69,84,73,68,41,44,
+32,118,41,59,32,125,'\n',32,32,95,95,110,111,108,105,115,
+116,32,118,111,105,100,32,83,101,116,84,97,114,103,101,116,
+78,111,116,101,40,99,111,110,115,116,32,105,110,116,32,38,
+118,41,32,123,32,83,101,116,40,84,97,114,103,101,116,40,
+83,80,89,95,78,79,84,69,41,44,32,118,41,59,32,125,
+'\n','\n',32,32,35,100,101,102,105,110,101,32,87,111,114,108,
+100,40,105,44,32,110,41,32,32,32,32,32,32,32,64,64,
+40,48,120,51,50,50,97,43,40,105,41,41,91,40,110,41,
+93,'\n',32,32,35,100,101,102,105,110,101,32,87,111,114,108,
+100,83,104,111,114,116,73,68,40,110,41,32,32,32,64,64,
+40,48,120,51,50,50,97,43,83,80,89,95,83,72,79,82,
+84,73,68,41,91,40,110,41,93,'\n',32,32,35,100,101,102,
+105,110,101,32,87,111,114,108,100,76,105,110,107,73,68,40,
+110,41,32,32,32,32,64,64,40,48,120,51,50,50,97,43,
+83,80,89,95,76,73,78,75,73,68,41,91,40,110,41,93,
+'\n',32,32,35,100,101,102,105,110,101,32,87,111,114,108,100,
+82,97,110,103,101,40,110,41,32,32,32,32,32,64,64,40,
+48,120,51,50,50,97,43,83,80,89,95,82,65,78,71,69,
+41,91,40,110,41,93,'\n',32,32,35,100,101,102,105,110,101,
+32,87,111,114,108,100,68,105,114,101,99,116,105,111,110,40,
+110,41,32,64,64,40,48,120,51,50,50,97,43,83,80,89,
+95,68,73,82,69,67,84,73,79,78,41,91,40,110,41,93,
+'\n',32,32,35,100,101,102,105,110,101,32,87,111,114,108,100,
+65,115,112,101,99,116,40,110,41,32,32,32,32,64,64,40,
+48,120,51,50,50,97,43,83,80,89,95,65,83,80,69,67,
+84,41,91,40,110,41,93,'\n',32,32,35,100,101,102,105,110,
+101,32,87,111,114,108,100,78,111,116,101,40,110,41,32,32,
+32,32,32,32,64,64,40,48,120,51,50,50,97,43,83,80,
+89,95,78,79,84,69,41,91,40,110,41,93,'\n','\n',32,32,
+95,95,110,111,108,105,115,116,32,118,111,105,100,32,71,101,
+116,87,111,114,108,100,40,99,111,110,115,116,32,105,110,116,
+32,110,44,32,105,110,116,32,38,116,44,32,105,110,116,32,
+38,118,41,'\n',32,32,123,'\n',32,32,32,32,97,115,109,32,
+123,32,48,120,49,52,44,32,36,118,32,58,32,95,95,65,
+83,77,95,78,79,95,84,89,80,69,32,43,32,95,95,65,
+83,77,95,83,77,65,76,76,95,86,65,76,85,69,44,32,
+48,120,50,97,32,43,32,110,44,'\n',32,32,32,32,32,32,
+32,32,36,116,32,58,32,95,95,65,83,77,95,78,79,95,
+84,89,80,69,32,43,32,95,95,65,83,77,95,83,77,65,
+76,76,95,86,65,76,85,69,44,32,48,120,48,48,32,125,
+59,'\n',32,32,125,'\n',32,32,95,95,110,111,108,105,115,116,
+32,118,111,105,100,32,71,101,116,87,111,114,108,100,83,104,
+111,114,116,73,68,40,105,110,116,32,38,116,44,32,105,110,
+116,32,38,118,41,32,32,32,32,32,123,32,71,101,116,87,
+111,114,108,100,40,83,80,89,95,83,72,79,82,84,73,68,
+44,32,116,44,32,118,41,59,32,125,'\n',32,32,95,95,110,
+111,108,105,115,116,32,118,111,105,100,32,71,101,116,87,111,
+114,108,100,76,105,110,107,73,68,40,105,110,116,32,38,116,
+44,32,105,110,116,32,38,118,41,32,32,32,32,32,32,123,
+32,71,101,116,87,111,114,108,100,40,83,80,89,95,76,73,
+78,75,73,68,44,32,116,44,32,118,41,59,32,125,'\n',32,
+32,95,95,110,111,108,105,115,116,32,118,111,105,100,32,71,
+101,116,87,111,114,108,100,82,97,110,103,101,40,105,110,116,
+32,38,116,44,32,105,110,116,32,38,118,41,32,32,32,32,
+32,32,32,123,32,71,101,116,87,111,114,108,100,40,83,80,
+89,95,82,65,78,71,69,44,32,116,44,32,118,41,59,32,
+125,'\n',32,32,95,95,110,111,108,105,115,116,32,118,111,105,
+100,32,71,101,116,87,111,114,108,100,68,105,114,101,99,116,
+105,111,110,40,105,110,116,32,38,116,44,32,105,110,116,32,
+38,118,41,32,32,32,123,32,71,101,116,87,111,114,108,100,
+40,83,80,89,95,68,73,82,69,67,84,73,79,78,44,32,
+116,44,32,118,41,59,32,125,'\n',32,32,95,95,110,111,108,
+105,115,116,32,118,111,105,100,32,71,101,116,87,111,114,108,
+100,65,115,112,101,99,116,40,105,110,116,32,38,116,44,32,
+105,110,116,32,38,118,41,32,32,32,32,32,32,123,32,71,
+101,116,87,111,114,108,100,40,83,80,89,95,65,83,80,69,
+67,84,44,32,116,44,32,118,41,59,32,125,'\n',32,32,95,
+95,110,111,108,105,115,116,32,118,111,105,100,32,71,101,116,
+87,111,114,108,100,78,111,116,101,40,105,110,116,32,38,116,
+44,32,105,110,116,32,38,118,41,32,32,32,32,32,32,32,
+32,123,32,71,101,116,87,111,114,108,100,40,83,80,89,95,
+78,79,84,69,44,32,116,44,32,118,41,59,32,125,'\n',32,
+32,95,95,110,111,108,105,115,116,32,118,111,105,100,32,83,
+101,116,87,111,114,108,100,78,111,116,101,40,105,110,116,32,
+38,116,44,32,99,111,110,115,116,32,105,110,116,32,38,118,
+41,'\n',32,32,32,32,123,32,97,115,109,32,123,32,48,120,
+48,53,44,32,48,120,50,98,44,32,36,116,32,58,32,95,
+95,65,83,77,95,78,79,95,84,89,80,69,32,43,32,95,
+95,65,83,77,95,83,77,65,76,76,95,86,65,76,85,69,
+44,32,36,118,125,59,32,125,'\n','\n',32,32,35,100,101,102,
+105,110,101,32,83,116,97,99,107,40,110,41,32,32,64,40,
+48,120,49,50,48,48,48,48,32,43,32,40,110,41,41,'\n',
+32,32,95,95,110,111,108,105,115,116,32,118,111,105,100,32,
+80,117,115,104,40,99,111,110,115,116,32,105,110,116,32,38,
+118,41,32,32,32,32,32,32,123,32,97,115,109,32,123,32,
+48,120,101,51,44,32,36,118,32,125,59,32,125,'\n',32,32,
+95,95,110,111,108,105,115,116,32,118,111,105,100,32,80,111,
+112,40,99,111,110,115,116,32,105,110,116,32,110,41,32,32,
+32,32,32,32,32,32,123,32,97,115,109,32,123,32,48,120,
+48,49,44,32,110,32,125,59,32,125,'\n',32,32,95,95,110,
+111,108,105,115,116,32,118,111,105,100,32,83,101,116,83,116,
+97,99,107,40,99,111,110,115,116,32,105,110,116,32,105,44,
+32,99,111,110,115,116,32,105,110,116,32,38,118,41,32,123,
+32,83,101,116,40,83,116,97,99,107,40,105,41,44,32,118,
+41,59,32,125,'\n','\n',32,32,35,100,101,102,105,110,101,32,
+84,73,77,69,82,95,82,85,78,78,73,78,71,32,49,'\n',
+32,32,35,100,101,102,105,110,101,32,84,73,77,69,82,95,
+83,84,79,80,80,69,68,32,48,'\n',32,32,35,100,101,102,
+105,110,101,32,84,105,109,101,114,83,116,97,116,101,40,110,
+41,32,64,40,48,120,49,51,48,48,48,48,32,43,32,40,
+110,41,41,'\n',32,32,95,95,110,111,108,105,115,116,32,118,
+111,105,100,32,83,101,116,84,105,109,101,114,83,116,97,116,
+101,40,99,111,110,115,116,32,105,110,116,32,110,44,32,99,
+111,110,115,116,32,105,110,116,32,38,115,41,32,123,32,83,
+101,116,40,84,105,109,101,114,83,116,97,116,101,40,110,41,
+44,32,115,41,59,32,125,'\n','\n',32,32,35,100,101,102,105,
+110,101,32,67,117,114,114,101,110,116,84,97,115,107,73,68,
+40,41,32,32,32,64,40,48,120,50,48,48,48,48,48,41,
+'\n','\n',32,32,35,100,101,102,105,110,101,32,80,105,110,103,
+67,111,110,116,114,111,108,40,110,41,32,32,32,32,64,40,
+48,120,51,51,48,48,48,48,32,43,32,40,110,41,41,32,
+47,47,32,53,49,'\n',32,32,35,100,101,102,105,110,101,32,
+80,105,110,103,68,97,116,97,40,41,32,32,32,32,32,32,
+32,32,80,105,110,103,67,111,110,116,114,111,108,40,48,41,
+'\n',32,32,95,95,110,111,108,105,115,116,32,118,111,105,100,
+32,83,101,116,80,105,110,103,68,97,116,97,40,99,111,110,
+115,116,32,105,110,116,32,38,100,41,32,123,32,83,101,116,
+40,80,105,110,103,68,97,116,97,40,41,44,32,100,41,59,
+32,125,'\n','\n',32,32,35,100,101,102,105,110,101,32,80,105,
+110,103,73,110,116,101,114,118,97,108,40,41,32,32,32,32,
+80,105,110,103,67,111,110,116,114,111,108,40,49,41,'\n',32,
+32,95,95,110,111,108,105,115,116,32,118,111,105,100,32,83,
+101,116,80,105,110,103,73,110,116,101,114,118,97,108,40,99,
+111,110,115,116,32,105,110,116,32,38,105,41,32,32,32,123,
+32,83,101,116,40,80,105,110,103,73,110,116,101,114,118,97,
+108,40,41,44,32,105,41,59,32,125,'\n','\n',32,32,35,100,
+101,102,105,110,101,32,80,105,110,103,73,68,40,41,32,32,
+80,105,110,103,67,111,110,116,114,111,108,40,50,41,'\n','\n',
+32,32,35,100,101,102,105,110,101,32,66,101,97,99,111,110,
+67,111,110,116,114,111,108,40,110,41,32,32,64,40,48,120,
+51,52,48,48,48,48,32,43,32,40,110,41,41,32,47,47,
+32,53,50,'\n','\n',32,32,35,100,101,102,105,110,101,32,76,
+105,110,107,73,68,40,41,32,32,66,101,97,99,111,110,67,
+111,110,116,114,111,108,40,48,41,'\n',32,32,95,95,110,111,
+108,105,115,116,32,118,111,105,100,32,83,101,116,76,105,110,
+107,73,68,40,99,111,110,115,116,32,105,110,116,32,38,110,
+41,32,123,32,83,101,116,40,76,105,110,107,73,68,40,41,
+44,32,110,41,59,32,125,'\n','\n',32,32,35,100,101,102,105,
+110,101,32,82,67,95,67,72,65,78,78,69,76,95,66,82,
+79,65,68,67,65,83,84,32,32,48,'\n',32,32,35,100,101,
+102,105,110,101,32,82,67,95,67,72,65,78,78,69,76,95,
+49,32,32,32,32,32,32,32,32,32,32,49,'\n',32,32,35,
+100,101,102,105,110,101,32,82,67,95,67,72,65,78,78,69,
+76,95,50,32,32,32,32,32,32,32,32,32,32,50,'\n',32,
+32,35,100,101,102,105,110,101,32,82,67,95,67,72,65,78,
+78,69,76,95,51,32,32,32,32,32,32,32,32,32,32,51,
+'\n',32,32,35,100,101,102,105,110,101,32,82,67,95,67,72,
+65,78,78,69,76,95,68,73,83,65,66,76,69,68,32,32,
+32,52,'\n','\n',32,32,35,100,101,102,105,110,101,32,82,67,
+82,120,67,104,97,110,110,101,108,40,41,32,66,101,97,99,
+111,110,67,111,110,116,114,111,108,40,49,41,'\n',32,32,95,
+95,110,111,108,105,115,116,32,118,111,105,100,32,83,101,116,
+82,67,82,120,67,104,97,110,110,101,108,40,99,111,110,115,
+116,32,105,110,116,32,38,99,41,32,32,32,32,123,32,83,
+101,116,40,82,67,82,120,67,104,97,110,110,101,108,40,41,
+44,32,99,41,59,32,125,'\n','\n',32,32,35,100,101,102,105,
+110,101,32,82,67,84,120,67,104,97,110,110,101,108,40,41,
+32,66,101,97,99,111,110,67,111,110,116,114,111,108,40,50,
+41,'\n',32,32,95,95,110,111,108,105,115,116,32,118,111,105,
+100,32,83,101,116,82,67,84,120,67,104,97,110,110,101,108,
+40,99,111,110,115,116,32,105,110,116,32,38,99,41,32,32,
+32,32,123,32,83,101,116,40,82,67,84,120,67,104,97,110,
+110,101,108,40,41,44,32,99,41,59,32,125,'\n','\n',32,32,
+35,100,101,102,105,110,101,32,82,67,84,88,77,79,68,69,
+95,83,73,78,71,76,69,95,83,72,79,84,32,32,48,'\n',
+32,32,35,100,101,102,105,110,101,32,82,67,84,88,77,79,
+68,69,95,67,79,78,84,73,78,85,79,85,83,32,32,32,
+49,'\n','\n',32,32,35,100,101,102,105,110,101,32,82,67,84,
+120,77,111,100,101,40,41,32,32,32,32,66,101,97,99,111,
+110,67,111,110,116,114,111,108,40,51,41,'\n',32,32,95,95,
+110,111,108,105,115,116,32,118,111,105,100,32,83,101,116,82,
+67,84,120,77,111,100,101,40,99,111,110,115,116,32,105,110,
+116,32,38,109,41,32,32,32,123,32,83,101,116,40,82,67,
+84,120,77,111,100,101,40,41,44,32,109,41,59,32,125,'\n',
+'\n',32,32,35,100,101,102,105,110,101,32,69,69,80,82,79,
+77,40,110,41,32,64,64,40,48,120,49,52,51,54,41,91,
+40,110,41,93,'\n',32,32,95,95,110,111,108,105,115,116,32,
+118,111,105,100,32,83,101,116,69,69,80,82,79,77,40,99,
+111,110,115,116,32,105,110,116,32,38,105,44,32,99,111,110,
+115,116,32,105,110,116,32,38,100,41,32,123,32,83,101,116,
+40,69,69,80,82,79,77,40,105,41,44,32,100,41,59,32,
+125,'\n','\n',32,32,95,95,110,111,108,105,115,116,32,118,111,
+105,100,32,83,116,97,114,116,84,97,115,107,40,99,111,110,
+115,116,32,105,110,116,32,116,41,32,32,123,32,97,115,109,
+32,123,32,48,120,55,49,44,32,116,125,59,32,125,'\n',32,
+32,95,95,110,111,108,105,115,116,32,118,111,105,100,32,83,
+116,111,112,84,97,115,107,40,99,111,110,115,116,32,105,110,
+116,32,116,41,32,32,32,123,32,97,115,109,32,123,32,48,
+120,56,49,44,32,116,125,59,32,125,'\n','\n',47,47,32,69,
+69,80,82,79,77,32,105,110,100,105,99,101,115,'\n',32,32,
+35,100,101,102,105,110,101,32,69,69,80,82,79,77,95,77,
+79,84,79,82,67,79,78,84,82,79,76,32,32,32,32,32,
+32,32,48,120,48,48,'\n',32,32,35,100,101,102,105,110,101,
+32,69,69,80,82,79,77,95,83,80,69,67,73,69,83,32,
+32,32,32,32,32,32,32,32,32,32,32,48,120,48,49,'\n',
+32,32,35,100,101,102,105,110,101,32,69,69,80,82,79,77,
+95,76,79,78,71,73,68,32,32,32,32,32,32,32,32,32,
+32,32,32,32,48,120,48,50,'\n',32,32,35,100,101,102,105,
+110,101,32,69,69,80,82,79,77,95,85,83,69,82,76,69,
+86,69,76,32,32,32,32,32,32,32,32,32,32,48,120,48,
+54,'\n',32,32,35,100,101,102,105,110,101,32,69,69,80,82,
+79,77,95,68,69,70,65,85,76,84,80,73,78,71,82,65,
+84,69,32,32,32,32,48,120,48,55,'\n',32,32,35,100,101,
+102,105,110,101,32,69,69,80,82,79,77,95,82,85,78,83,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,48,
+120,48,56,'\n',32,32,35,100,101,102,105,110,101,32,69,69,
+80,82,79,77,95,87,73,78,83,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,48,120,48,97,'\n',32,32,35,
+100,101,102,105,110,101,32,69,69,80,82,79,77,95,76,79,
+83,83,69,83,32,32,32,32,32,32,32,32,32,32,32,32,
+32,48,120,48,99,'\n',32,32,35,100,101,102,105,110,101,32,
+69,69,80,82,79,77,95,80,79,73,78,84,83,32,32,32,
+32,32,32,32,32,32,32,32,32,32,48,120,48,101,'\n',32,
+32,35,100,101,102,105,110,101,32,69,69,80,82,79,77,95,
+80,76,65,89,83,69,67,79,78,68,83,32,32,32,32,32,
+32,32,32,48,120,49,48,'\n',32,32,35,100,101,102,105,110,
+101,32,69,69,80,82,79,77,95,84,79,84,65,76,80,76,
+65,89,84,73,77,69,32,32,32,32,32,32,48,120,49,50,
+'\n',32,32,35,100,101,102,105,110,101,32,69,69,80,82,79,
+77,95,77,65,88,66,79,84,83,32,32,32,32,32,32,32,
+32,32,32,32,32,48,120,49,54,'\n',32,32,35,100,101,102,
+105,110,101,32,69,69,80,82,79,77,95,77,73,83,83,73,
+79,78,73,68,32,32,32,32,32,32,32,32,32,32,48,120,
+49,55,'\n',32,32,35,100,101,102,105,110,101,32,69,69,80,
+82,79,77,95,77,73,83,83,73,79,78,83,80,76,65,89,
+69,68,32,32,32,32,32,48,120,49,56,'\n',32,32,35,100,
+101,102,105,110,101,32,69,69,80,82,79,77,95,77,73,83,
+83,73,79,78,80,79,73,78,84,83,32,32,32,32,32,32,
+48,120,49,99,'\n',32,32,35,100,101,102,105,110,101,32,69,
+69,80,82,79,77,95,72,73,71,72,83,67,79,82,69,32,
+32,32,32,32,32,32,32,32,32,48,120,49,101,'\n',32,32,
+35,100,101,102,105,110,101,32,69,69,80,82,79,77,95,82,
+79,66,79,84,78,65,77,69,32,32,32,32,32,32,32,32,
+32,32,48,120,50,48,'\n',32,32,35,100,101,102,105,110,101,
+32,69,69,80,82,79,77,95,66,73,82,84,72,68,65,84,
+69,32,32,32,32,32,32,32,32,32,32,48,120,52,48,'\n',
+32,32,35,100,101,102,105,110,101,32,69,69,80,82,79,77,
+95,66,79,84,68,65,84,65,32,32,32,32,32,32,32,32,
+32,32,32,32,48,120,52,54,'\n',32,32,35,100,101,102,105,
+110,101,32,69,69,80,82,79,77,95,83,84,65,84,85,83,
+32,32,32,32,32,32,32,32,32,32,32,32,32,48,120,52,
+55,'\n',32,32,35,100,101,102,105,110,101,32,69,69,80,82,
+79,77,95,70,73,82,83,84,84,79,75,69,78,32,32,32,
+32,32,32,32,32,32,48,120,52,56,'\n',32,32,35,100,101,
+102,105,110,101,32,69,69,80,82,79,77,95,76,65,83,84,
+84,79,75,69,78,32,32,32,32,32,32,32,32,32,32,48,
+120,55,101,'\n',32,32,35,100,101,102,105,110,101,32,69,69,
+80,82,79,77,95,77,65,88,84,79,75,69,78,83,32,32,
+32,32,32,32,32,32,32,32,50,56,'\n',32,32,32,32,47,
+47,115,112,97,114,101,58,32,48,120,56,48,32,45,32,48,
+120,102,102,'\n','\n',47,47,77,111,116,111,114,67,111,110,116,
+114,111,108,32,40,101,101,112,114,111,109,91,101,77,111,116,
+111,114,67,111,110,116,114,111,108,93,41,58,'\n',32,32,35,
+100,101,102,105,110,101,32,77,79,84,79,82,67,79,78,84,
+82,79,76,95,78,79,82,77,65,76,83,80,69,69,68,77,
+65,83,75,32,32,48,120,48,55,'\n',32,32,35,100,101,102,
+105,110,101,32,77,79,84,79,82,67,79,78,84,82,79,76,
+95,83,76,79,87,83,80,69,69,68,77,65,83,75,32,32,
+32,32,48,120,51,56,'\n',32,32,35,100,101,102,105,110,101,
+32,77,79,84,79,82,67,79,78,84,82,79,76,95,76,69,
+70,84,68,73,82,32,32,32,32,32,32,32,32,32,32,48,
+120,52,48,'\n',32,32,35,100,101,102,105,110,101,32,77,79,
+84,79,82,67,79,78,84,82,79,76,95,82,73,71,72,84,
+68,73,82,32,32,32,32,32,32,32,32,32,48,120,56,48,
+'\n','\n',47,47,83,112,101,99,105,101,115,32,40,101,101,112,
+114,111,109,91,101,83,112,101,99,105,101,115,93,32,118,97,
+108,117,101,115,41,'\n',32,32,35,100,101,102,105,110,101,32,
+83,80,69,67,73,69,83,95,71,73,71,65,77,69,83,72,
+32,32,32,32,32,32,49,'\n',32,32,35,100,101,102,105,110,
+101,32,83,80,69,67,73,69,83,95,83,78,65,80,84,82,
+65,88,32,32,32,32,32,32,50,'\n',32,32,35,100,101,102,
+105,110,101,32,83,80,69,67,73,69,83,95,83,72,65,68,
+79,87,83,84,82,73,75,69,32,32,51,'\n',32,32,35,100,
+101,102,105,110,101,32,83,80,69,67,73,69,83,95,84,69,
+67,72,78,79,74,65,87,32,32,32,32,32,52,'\n','\n',47,
+47,83,116,97,116,117,115,32,40,101,101,112,114,111,109,91,
+101,83,116,97,116,117,115,93,32,118,97,108,117,101,115,41,
+'\n',32,32,35,100,101,102,105,110,101,32,83,84,65,84,85,
+83,95,73,78,73,84,73,65,76,73,90,73,78,71,32,32,
+32,48,120,48,49,'\n',32,32,35,100,101,102,105,110,101,32,
+83,84,65,84,85,83,95,68,79,87,78,76,79,65,68,73,
+78,71,32,32,32,32,48,120,48,50,'\n',32,32,35,100,101,
+102,105,110,101,32,83,84,65,84,85,83,95,76,79,67,75,
+69,68,32,32,32,32,32,32,32,32,32,48,120,48,52,'\n',
+32,32,32,32,47,47,98,105,116,115,32,51,45,55,32,115,
+112,97,114,101,'\n','\n',47,47,66,97,116,116,101,114,121,32,
+118,111,108,116,97,103,101,'\n',32,32,35,100,101,102,105,110,
+101,32,66,65,84,84,69,82,89,95,77,65,88,32,52,54,
+48,48,'\n',32,32,35,100,101,102,105,110,101,32,66,65,84,
+84,69,82,89,95,76,79,87,32,51,52,48,48,'\n',32,32,
+35,100,101,102,105,110,101,32,66,65,84,84,69,82,89,95,
+77,73,78,32,50,55,48,48,'\n','\n',47,47,32,67,111,110,
+116,114,111,108,108,101,114,32,98,117,116,116,111,110,115,'\n',
+32,32,35,100,101,102,105,110,101,32,67,79,78,84,82,79,
+76,76,69,82,95,66,85,84,84,79,78,49,32,32,32,32,
+48,120,48,49,48,48,'\n',32,32,35,100,101,102,105,110,101,
+32,67,79,78,84,82,79,76,76,69,82,95,66,85,84,84,
+79,78,50,32,32,32,32,48,120,48,50,48,48,'\n',32,32,
+35,100,101,102,105,110,101,32,67,79,78,84,82,79,76,76,
+69,82,95,66,85,84,84,79,78,51,32,32,32,32,48,120,
+48,48,48,49,'\n',32,32,35,100,101,102,105,110,101,32,67,
+79,78,84,82,79,76,76,69,82,95,66,85,84,84,79,78,
+52,32,32,32,32,48,120,48,49,48,49,'\n',32,32,35,100,
+101,102,105,110,101,32,67,79,78,84,82,79,76,76,69,82,
+95,66,85,84,84,79,78,53,32,32,32,32,48,120,48,50,
+48,49,'\n','\n',32,32,47,47,32,82,79,77,32,115,117,98,
+114,111,117,116,105,110,101,115,'\n',32,32,47,47,32,105,110,
+116,101,114,97,99,116,105,111,110,32,115,117,98,114,111,117,
+116,105,110,101,115,'\n',32,32,95,95,110,111,108,105,115,116,
+32,118,111,105,100,32,83,101,110,100,83,112,121,98,111,116,
+77,101,115,115,97,103,101,40,99,111,110,115,116,32,105,110,
+116,32,38,110,73,110,100,101,120,44,32,99,111,110,115,116,
+32,105,110,116,32,38,110,67,109,100,44,'\n',32,32,32,32,
+99,111,110,115,116,32,105,110,116,32,38,110,72,105,66,121,
+116,101,44,32,99,111,110,115,116,32,105,110,116,32,38,110,
+76,111,66,121,116,101,41,'\n',32,32,123,'\n',32,32,32,32,
+97,115,109,32,123,32,48,120,101,51,44,32,36,110,73,110,
+100,101,120,32,125,59,'\n',32,32,32,32,97,115,109,32,123,
+32,48,120,101,51,44,32,36,110,67,109,100,32,125,59,'\n',
+32,32,32,32,97,115,109,32,123,32,48,120,101,51,44,32,
+36,110,72,105,66,121,116,101,32,125,59,'\n',32,32,32,32,
+97,115,109,32,123,32,48,120,101,51,44,32,36,110,76,111,
+66,121,116,101,32,125,59,'\n',32,32,32,32,97,115,109,32,
+123,32,48,120,49,55,44,32,51,52,32,125,59,'\n',32,32,
+32,32,97,115,109,32,123,32,48,120,48,49,44,32,52,32,
+125,59,'\n',32,32,125,'\n',32,32,95,95,110,111,108,105,115,
+116,32,118,111,105,100,32,83,101,110,100,82,67,88,77,101,
+115,115,97,103,101,40,99,111,110,115,116,32,105,110,116,32,
+38,110,77,101,115,115,97,103,101,41,'\n',32,32,32,32,123,
+32,97,115,109,32,123,32,48,120,101,51,44,32,36,110,77,
+101,115,115,97,103,101,44,32,48,120,49,55,44,32,51,55,
+44,32,48,120,48,49,44,32,49,32,125,59,32,125,'\n',32,
+32,95,95,110,111,108,105,115,116,32,118,111,105,100,32,83,
+101,110,100,65,108,108,82,97,110,103,101,77,101,115,115,97,
+103,101,40,99,111,110,115,116,32,105,110,116,32,38,110,77,
+101,115,115,97,103,101,44,32,99,111,110,115,116,32,105,110,
+116,32,38,110,68,97,116,97,41,'\n',32,32,32,32,123,32,
+97,115,109,32,123,32,48,120,101,51,44,32,36,110,77,101,
+115,115,97,103,101,44,32,48,120,101,51,44,32,36,110,68,
+97,116,97,44,32,48,120,49,55,44,32,51,56,44,32,48,
+120,48,49,44,32,50,32,125,59,32,125,'\n','\n',32,32,47,
+47,32,117,116,105,108,115,32,115,117,98,114,111,117,116,105,
+110,101,115,'\n',32,32,95,95,110,111,108,105,115,116,32,118,
+111,105,100,32,68,105,115,112,40,99,111,110,115,116,32,105,
+110,116,32,38,100,105,115,112,108,97,121,41,'\n',32,32,32,
+32,123,32,97,115,109,32,123,32,48,120,101,51,44,32,36,
+100,105,115,112,108,97,121,44,32,48,120,49,55,44,32,52,
+50,44,32,48,120,48,49,44,32,49,32,125,59,32,125,'\n',
+'\n',32,32,35,100,101,102,105,110,101,32,77,79,86,69,95,
+66,65,83,73,67,32,32,32,32,32,32,32,32,48,120,48,
+49,48,48,'\n',32,32,35,100,101,102,105,110,101,32,77,79,
+86,69,95,82,65,78,68,79,77,32,32,32,32,32,32,32,
+48,120,48,50,48,48,'\n',32,32,35,100,101,102,105,110,101,
+32,77,79,86,69,95,70,65,78,67,89,32,32,32,32,32,
+32,32,32,48,120,48,51,48,48,'\n',32,32,35,100,101,102,
+105,110,101,32,77,79,86,69,95,83,76,79,87,68,79,87,
+78,32,32,32,32,32,48,120,48,52,48,48,'\n',32,32,35,
+100,101,102,105,110,101,32,77,79,86,69,95,83,80,69,69,
+68,85,80,32,32,32,32,32,32,48,120,48,53,48,48,'\n',
+'\n',32,32,35,100,101,102,105,110,101,32,77,79,86,69,95,
+77,65,83,75,32,32,32,32,32,32,32,32,32,48,120,48,
+48,102,102,'\n',32,32,35,100,101,102,105,110,101,32,77,79,
+86,69,95,84,89,80,69,95,77,65,83,75,32,32,32,32,
+48,120,102,102,48,48,'\n','\n',32,32,35,100,101,102,105,110,
+101,32,77,79,86,69,95,66,65,83,73,67,95,70,79,82,
+87,65,82,68,32,32,32,32,32,32,32,32,77,79,86,69,
+95,66,65,83,73,67,32,43,32,49,'\n',32,32,35,100,101,
+102,105,110,101,32,77,79,86,69,95,66,65,83,73,67,95,
+66,65,67,75,87,65,82,68,32,32,32,32,32,32,32,77,
+79,86,69,95,66,65,83,73,67,32,43,32,50,'\n',32,32,
+35,100,101,102,105,110,101,32,77,79,86,69,95,66,65,83,
+73,67,95,83,80,73,78,95,76,69,70,84,32,32,32,32,
+32,32,77,79,86,69,95,66,65,83,73,67,32,43,32,51,
+'\n',32,32,35,100,101,102,105,110,101,32,77,79,86,69,95,
+66,65,83,73,67,95,83,80,73,78,95,82,73,71,72,84,
+32,32,32,32,32,77,79,86,69,95,66,65,83,73,67,32,
+43,32,52,'\n',32,32,35,100,101,102,105,110,101,32,77,79,
+86,69,95,66,65,83,73,67,95,84,85,82,78,95,76,69,
+70,84,32,32,32,32,32,32,77,79,86,69,95,66,65,83,
+73,67,32,43,32,53,'\n',32,32,35,100,101,102,105,110,101,
+32,77,79,86,69,95,66,65,83,73,67,95,84,85,82,78,
+95,82,73,71,72,84,32,32,32,32,32,77,79,86,69,95,
+66,65,83,73,67,32,43,32,54,'\n',32,32,35,100,101,102,
+105,110,101,32,77,79,86,69,95,66,65,83,73,67,95,65,
+86,79,73,68,95,76,69,70,84,32,32,32,32,32,77,79,
+86,69,95,66,65,83,73,67,32,43,32,55,'\n',32,32,35,
+100,101,102,105,110,101,32,77,79,86,69,95,66,65,83,73,
+67,95,65,86,79,73,68,95,82,73,71,72,84,32,32,32,
+32,77,79,86,69,95,66,65,83,73,67,32,43,32,56,'\n',
+32,32,35,100,101,102,105,110,101,32,77,79,86,69,95,66,
+65,83,73,67,95,82,69,83,84,32,32,32,32,32,32,32,
+32,32,32,32,77,79,86,69,95,66,65,83,73,67,32,43,
+32,57,'\n',32,32,35,100,101,102,105,110,101,32,77,79,86,
+69,95,66,65,83,73,67,95,83,84,79,80,32,32,32,32,
+32,32,32,32,32,32,32,77,79,86,69,95,66,65,83,73,
+67,32,43,32,49,48,'\n','\n',32,32,35,100,101,102,105,110,
+101,32,77,79,86,69,95,82,65,78,68,79,77,95,70,79,
+82,87,65,82,68,32,32,32,32,32,32,32,77,79,86,69,
+95,82,65,78,68,79,77,32,43,32,49,'\n',32,32,35,100,
+101,102,105,110,101,32,77,79,86,69,95,82,65,78,68,79,
+77,95,66,65,67,75,87,65,82,68,32,32,32,32,32,32,
+77,79,86,69,95,82,65,78,68,79,77,32,43,32,50,'\n',
+32,32,35,100,101,102,105,110,101,32,77,79,86,69,95,82,
+65,78,68,79,77,95,83,80,73,78,95,76,69,70,84,32,
+32,32,32,32,77,79,86,69,95,82,65,78,68,79,77,32,
+43,32,51,'\n',32,32,35,100,101,102,105,110,101,32,77,79,
+86,69,95,82,65,78,68,79,77,95,83,80,73,78,95,82,
+73,71,72,84,32,32,32,32,77,79,86,69,95,82,65,78,
+68,79,77,32,43,32,52,'\n',32,32,35,100,101,102,105,110,
+101,32,77,79,86,69,95,82,65,78,68,79,77,95,84,85,
+82,78,95,76,69,70,84,32,32,32,32,32,77,79,86,69,
+95,82,65,78,68,79,77,32,43,32,53,'\n',32,32,35,100,
+101,102,105,110,101,32,77,79,86,69,95,82,65,78,68,79,
+77,95,84,85,82,78,95,82,73,71,72,84,32,32,32,32,
+77,79,86,69,95,82,65,78,68,79,77,32,43,32,54,'\n',
+32,32,35,100,101,102,105,110,101,32,77,79,86,69,95,82,
+65,78,68,79,77,95,82,69,83,84,32,32,32,32,32,32,
+32,32,32,32,77,79,86,69,95,82,65,78,68,79,77,32,
+43,32,55,'\n','\n',32,32,35,100,101,102,105,110,101,32,77,
+79,86,69,95,70,65,78,67,89,95,90,73,71,90,65,71,
+32,32,32,32,32,32,32,32,32,77,79,86,69,95,70,65,
+78,67,89,32,43,32,49,'\n',32,32,35,100,101,102,105,110,
+101,32,77,79,86,69,95,70,65,78,67,89,95,83,72,65,
+75,69,32,32,32,32,32,32,32,32,32,32,77,79,86,69,
+95,70,65,78,67,89,32,43,32,50,'\n',32,32,35,100,101,
+102,105,110,101,32,77,79,86,69,95,70,65,78,67,89,95,
+83,67,65,78,32,32,32,32,32,32,32,32,32,32,32,77,
+79,86,69,95,70,65,78,67,89,32,43,32,51,'\n',32,32,
+35,100,101,102,105,110,101,32,77,79,86,69,95,70,65,78,
+67,89,95,83,84,69,80,32,32,32,32,32,32,32,32,32,
+32,32,77,79,86,69,95,70,65,78,67,89,32,43,32,52,
+'\n',32,32,35,100,101,102,105,110,101,32,77,79,86,69,95,
+70,65,78,67,89,95,83,84,69,80,95,66,65,67,75,32,
+32,32,32,32,32,77,79,86,69,95,70,65,78,67,89,32,
+43,32,53,'\n',32,32,35,100,101,102,105,110,101,32,77,79,
+86,69,95,70,65,78,67,89,95,83,69,65,82,67,72,32,
+32,32,32,32,32,32,32,32,77,79,86,69,95,70,65,78,
+67,89,32,43,32,54,'\n',32,32,35,100,101,102,105,110,101,
+32,77,79,86,69,95,70,65,78,67,89,95,70,65,75,69,
+95,76,69,70,84,32,32,32,32,32,32,77,79,86,69,95,
+70,65,78,67,89,32,43,32,55,'\n',32,32,35,100,101,102,
+105,110,101,32,77,79,86,69,95,70,65,78,67,89,95,82,
+65,75,69,95,82,73,71,72,84,32,32,32,32,32,77,79,
+86,69,95,70,65,78,67,89,32,43,32,56,'\n',32,32,35,
+100,101,102,105,110,101,32,77,79,86,69,95,70,65,78,67,
+89,95,66,85,71,95,70,79,82,87,65,82,68,32,32,32,
+32,77,79,86,69,95,70,65,78,67,89,32,43,32,57,'\n',
+32,32,35,100,101,102,105,110,101,32,77,79,86,69,95,70,
+65,78,67,89,95,76,65,90,89,32,32,32,32,32,32,32,
+32,32,32,32,77,79,86,69,95,70,65,78,67,89,32,43,
+32,49,48,'\n',32,32,35,100,101,102,105,110,101,32,77,79,
+86,69,95,70,65,78,67,89,95,87,65,76,75,32,32,32,
+32,32,32,32,32,32,32,32,77,79,86,69,95,70,65,78,
+67,89,32,43,32,49,49,'\n',32,32,35,100,101,102,105,110,
+101,32,77,79,86,69,95,70,65,78,67,89,95,87,65,76,
+75,95,66,65,67,75,32,32,32,32,32,32,77,79,86,69,
+95,70,65,78,67,89,32,43,32,49,50,'\n',32,32,35,100,
+101,102,105,110,101,32,77,79,86,69,95,70,65,78,67,89,
+95,68,65,78,67,69,32,32,32,32,32,32,32,32,32,32,
+77,79,86,69,95,70,65,78,67,89,32,43,32,49,51,'\n',
+'\n',32,32,35,100,101,102,105,110,101,32,77,79,86,69,95,
+83,76,79,87,68,79,87,78,95,70,79,82,87,65,82,68,
+32,32,32,32,32,77,79,86,69,95,83,76,79,87,68,79,
+87,78,32,43,32,49,'\n',32,32,35,100,101,102,105,110,101,
+32,77,79,86,69,95,83,76,79,87,68,79,87,78,95,66,
+65,67,75,87,65,82,68,32,32,32,32,77,79,86,69,95,
+83,76,79,87,68,79,87,78,32,43,32,50,'\n',32,32,35,
+100,101,102,105,110,101,32,77,79,86,69,95,83,76,79,87,
+68,79,87,78,95,83,80,73,78,95,76,69,70,84,32,32,
+32,77,79,86,69,95,83,76,79,87,68,79,87,78,32,43,
+32,51,'\n',32,32,35,100,101,102,105,110,101,32,77,79,86,
+69,95,83,76,79,87,68,79,87,78,95,83,80,73,78,95,
+82,73,71,72,84,32,32,77,79,86,69,95,83,76,79,87,
+68,79,87,78,32,43,32,52,'\n','\n',32,32,35,100,101,102,
+105,110,101,32,77,79,86,69,95,83,80,69,69,68,85,80,
+95,70,79,82,87,65,82,68,32,32,32,32,32,32,77,79,
+86,69,95,83,80,69,69,68,85,80,32,43,32,49,'\n',32,
+32,35,100,101,102,105,110,101,32,77,79,86,69,95,83,80,
+69,69,68,85,80,95,66,65,67,75,87,65,82,68,32,32,
+32,32,32,77,79,86,69,95,83,80,69,69,68,85,80,32,
+43,32,50,'\n',32,32,35,100,101,102,105,110,101,32,77,79,
+86,69,95,83,80,69,69,68,85,80,95,83,80,73,78,95,
+76,69,70,84,32,32,32,32,77,79,86,69,95,83,80,69,
+69,68,85,80,32,43,32,51,'\n',32,32,35,100,101,102,105,
+110,101,32,77,79,86,69,95,83,80,69,69,68,85,80,95,
+83,80,73,78,95,82,73,71,72,84,32,32,32,77,79,86,
+69,95,83,80,69,69,68,85,80,32,43,32,52,'\n','\n',32,
+32,95,95,110,111,108,105,115,116,32,118,111,105,100,32,66,
+97,115,105,99,77,111,118,101,32,40,99,111,110,115,116,32,
+105,110,116,32,38,109,111,118,101,44,32,99,111,110,115,116,
+32,105,110,116,32,38,116,105,109,101,41,'\n',32,32,32,32,
+123,32,97,115,109,32,123,32,48,120,101,51,44,32,36,109,
+111,118,101,44,32,48,120,101,51,44,32,36,116,105,109,101,
+44,32,48,120,49,55,44,32,52,51,44,32,48,120,48,49,
+44,32,50,32,125,59,32,125,'\n','\n',32,32,47,47,32,110,
+83,111,117,110,100,32,105,115,32,48,45,55,57,44,32,45,
+49,32,61,32,110,111,32,115,111,117,110,100,'\n',32,32,47,
+47,32,110,68,105,115,112,108,97,121,32,105,115,32,76,69,
+68,32,97,110,105,109,97,116,105,111,110,32,40,48,45,49,
+53,41,32,116,111,32,112,108,97,121,44,32,45,49,32,61,
+32,110,111,32,97,110,105,109,97,116,105,111,110,'\n',32,32,
+47,47,32,110,77,111,118,101,109,101,110,116,32,105,115,32,
+102,114,111,109,32,116,104,101,32,42,77,111,118,101,32,114,
+111,117,116,105,110,101,115,32,100,101,102,105,110,101,100,32,
+98,101,108,111,119,44,32,45,49,32,61,32,110,111,32,109,
+111,118,101,'\n',32,32,47,47,32,110,82,101,112,101,97,116,
+32,105,115,32,110,117,109,98,101,114,32,111,102,32,116,105,
+109,101,115,32,116,111,32,114,101,112,101,97,116,32,109,111,
+116,105,111,110,'\n',32,32,47,47,32,110,116,105,109,101,32,
+105,115,32,105,110,32,49,48,109,115,32,115,116,101,112,115,
+'\n',32,32,95,95,110,111,108,105,115,116,32,118,111,105,100,
+32,65,99,116,105,111,110,32,40,99,111,110,115,116,32,105,
+110,116,32,38,110,83,111,117,110,100,44,32,99,111,110,115,
+116,32,105,110,116,32,38,110,68,105,115,112,108,97,121,44,
+'\n',32,32,32,32,99,111,110,115,116,32,105,110,116,32,38,
+110,77,111,118,101,109,101,110,116,44,32,99,111,110,115,116,
+32,105,110,116,32,38,110,82,101,112,101,97,116,44,32,99,
+111,110,115,116,32,105,110,116,32,38,110,84,105,109,101,41,
+'\n',32,32,123,'\n',32,32,32,32,97,115,109,32,123,32,48,
+120,101,51,44,32,36,110,83,111,117,110,100,32,125,59,'\n',
+32,32,32,32,97,115,109,32,123,32,48,120,101,51,44,32,
+36,110,68,105,115,112,108,97,121,32,125,59,'\n',32,32,32,
+32,97,115,109,32,123,32,48,120,101,51,44,32,36,110,77,
+111,118,101,109,101,110,116,32,125,59,'\n',32,32,32,32,97,
+115,109,32,123,32,48,120,101,51,44,32,36,110,82,101,112,
+101,97,116,32,125,59,'\n',32,32,32,32,97,115,109,32,123,
+32,48,120,101,51,44,32,36,110,84,105,109,101,32,125,59,
+'\n',32,32,32,32,97,115,109,32,123,32,48,120,49,55,44,
+32,52,52,32,125,59,'\n',32,32,32,32,97,115,109,32,123,
+32,48,120,48,49,44,32,53,32,125,59,'\n',32,32,125,'\n',
+'\n',32,32,95,95,110,111,108,105,115,116,32,118,111,105,100,
+32,82,97,110,100,111,109,77,111,118,101,32,40,99,111,110,
+115,116,32,105,110,116,32,38,109,111,118,101,44,32,99,111,
+110,115,116,32,105,110,116,32,38,116,105,109,101,41,'\n',32,
+32,32,32,123,32,97,115,109,32,123,32,48,120,101,51,44,
+32,36,109,111,118,101,44,32,48,120,101,51,44,32,36,116,
+105,109,101,44,32,48,120,49,55,44,32,52,54,44,32,48,
+120,48,49,44,32,50,32,125,59,32,125,'\n','\n',32,32,95,
+95,110,111,108,105,115,116,32,118,111,105,100,32,70,97,110,
+99,121,77,111,118,101,32,40,99,111,110,115,116,32,105,110,
+116,32,38,109,111,118,101,44,32,99,111,110,115,116,32,105,
+110,116,32,38,116,105,109,101,41,'\n',32,32,32,32,123,32,
+97,115,109,32,123,32,48,120,101,51,44,32,36,109,111,118,
+101,44,32,48,120,101,51,44,32,36,116,105,109,101,44,32,
+48,120,49,55,44,32,52,55,44,32,48,120,48,49,44,32,
+50,32,125,59,32,125,'\n','\n',32,32,95,95,110,111,108,105,
+115,116,32,118,111,105,100,32,83,108,111,119,68,111,119,110,
+77,111,118,101,32,40,99,111,110,115,116,32,105,110,116,32,
+38,109,111,118,101,44,32,99,111,110,115,116,32,105,110,116,
+32,38,116,105,109,101,41,'\n',32,32,32,32,123,32,97,115,
+109,32,123,32,48,120,101,51,44,32,36,109,111,118,101,44,
+32,48,120,101,51,44,32,36,116,105,109,101,44,32,48,120,
+49,55,44,32,52,56,44,32,48,120,48,49,44,32,50,32,
+125,59,32,125,'\n','\n',32,32,95,95,110,111,108,105,115,116,
+32,118,111,105,100,32,83,112,101,101,100,85,112,77,111,118,
+101,32,40,99,111,110,115,116,32,105,110,116,32,38,109,111,
+118,101,44,32,99,111,110,115,116,32,105,110,116,32,38,116,
+105,109,101,41,'\n',32,32,32,32,123,32,97,115,109,32,123,
+32,48,120,101,51,44,32,36,109,111,118,101,44,32,48,120,
+101,51,44,32,36,116,105,109,101,44,32,48,120,49,55,44,
+32,52,57,44,32,48,120,48,49,44,32,50,32,125,59,32,
+125,'\n','\n',32,32,47,47,32,65,100,100,115,32,97,32,118,
+97,108,117,101,32,116,111,32,97,32,50,32,98,121,116,101,
+32,108,111,99,97,116,105,111,110,32,105,110,32,69,69,112,
+114,111,109,'\n',32,32,95,95,110,111,108,105,115,116,32,118,
+111,105,100,32,83,117,109,50,77,101,109,32,40,99,111,110,
+115,116,32,105,110,116,32,38,110,77,101,109,44,32,99,111,
+110,115,116,32,105,110,116,32,38,110,86,97,108,117,101,41,
+'\n',32,32,32,32,123,32,97,115,109,32,123,32,48,120,101,
+51,44,32,36,110,77,101,109,44,32,48,120,101,51,44,32,
+36,110,86,97,108,117,101,44,32,48,120,49,55,44,32,53,
+48,44,32,48,120,48,49,44,32,50,32,125,59,32,125,'\n',
+'\n',32,32,47,47,32,65,100,100,115,32,97,32,118,97,108,
+117,101,32,116,111,32,97,32,52,32,98,121,116,101,32,108,
+111,99,97,116,105,111,110,32,105,110,32,69,69,112,114,111,
+109,'\n',32,32,95,95,110,111,108,105,115,116,32,118,111,105,
+100,32,83,117,109,52,77,101,109,32,40,99,111,110,115,116,
+32,105,110,116,32,38,110,77,101,109,44,32,99,111,110,115,
+116,32,105,110,116,32,38,110,86,97,108,117,101,41,'\n',32,
+32,32,32,123,32,97,115,109,32,123,32,48,120,101,51,44,
+32,36,110,77,101,109,44,32,48,120,101,51,44,32,36,110,
+86,97,108,117,101,44,32,48,120,49,55,44,32,53,49,44,
+32,48,120,48,49,44,32,50,32,125,59,32,125,'\n','\n',32,
+32,35,100,101,102,105,110,101,32,83,79,85,78,68,95,78,
+79,78,69,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,45,49,'\n',32,32,35,100,101,102,105,110,101,32,
+83,79,85,78,68,95,83,72,79,67,75,69,68,32,32,32,
+32,32,32,32,32,32,32,32,32,32,54,'\n',32,32,35,100,
+101,102,105,110,101,32,83,79,85,78,68,95,70,73,82,69,
+95,76,65,83,69,82,32,32,32,32,32,32,32,32,32,32,
+55,'\n',32,32,35,100,101,102,105,110,101,32,83,79,85,78,
+68,95,70,73,82,69,95,69,76,69,67,84,82,79,78,69,
+84,32,32,32,32,32,56,'\n',32,32,35,100,101,102,105,110,
+101,32,83,79,85,78,68,95,70,73,82,69,95,83,80,73,
+78,78,69,82,32,32,32,32,32,32,32,32,57,'\n',32,32,
+35,100,101,102,105,110,101,32,83,79,85,78,68,95,72,73,
+84,95,66,89,95,76,65,83,69,82,32,32,32,32,32,32,
+32,32,49,48,'\n',32,32,35,100,101,102,105,110,101,32,83,
+79,85,78,68,95,72,73,84,95,66,89,95,69,76,69,67,
+84,82,79,78,69,84,32,32,32,49,49,'\n',32,32,35,100,
+101,102,105,110,101,32,83,79,85,78,68,95,72,73,84,95,
+66,89,95,83,80,73,78,78,69,82,32,32,32,32,32,32,
+49,50,'\n',32,32,35,100,101,102,105,110,101,32,83,79,85,
+78,68,95,84,65,71,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,49,51,'\n',32,32,35,100,101,102,
+105,110,101,32,83,79,85,78,68,95,67,82,65,83,72,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,49,52,
+'\n',32,32,35,100,101,102,105,110,101,32,83,79,85,78,68,
+95,70,73,71,72,84,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,49,53,'\n',32,32,35,100,101,102,105,110,
+101,32,83,79,85,78,68,95,71,79,84,95,73,84,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,49,54,'\n',32,
+32,35,100,101,102,105,110,101,32,83,79,85,78,68,95,71,
+69,78,69,82,65,76,95,65,76,69,82,84,32,32,32,32,
+32,32,32,49,55,'\n',32,32,35,100,101,102,105,110,101,32,
+83,79,85,78,68,95,79,85,84,95,79,70,95,69,78,69,
+82,71,89,95,65,76,69,82,84,32,49,56,'\n',32,32,35,
+100,101,102,105,110,101,32,83,79,85,78,68,95,76,79,87,
+95,69,78,69,82,71,89,95,65,76,69,82,84,32,32,32,
+32,49,57,'\n',32,32,35,100,101,102,105,110,101,32,83,79,
+85,78,68,95,83,67,79,82,69,95,65,76,69,82,84,32,
+32,32,32,32,32,32,32,32,50,48,'\n',32,32,35,100,101,
+102,105,110,101,32,83,79,85,78,68,95,84,73,77,69,95,
+65,76,69,82,84,32,32,32,32,32,32,32,32,32,32,50,
+49,'\n',32,32,35,100,101,102,105,110,101,32,83,79,85,78,
+68,95,80,82,79,88,73,77,73,84,89,95,65,76,69,82,
+84,32,32,32,32,32,50,50,'\n',32,32,35,100,101,102,105,
+110,101,32,83,79,85,78,68,95,68,65,78,71,69,82,95,
+65,76,69,82,84,32,32,32,32,32,32,32,32,50,51,'\n',
+32,32,35,100,101,102,105,110,101,32,83,79,85,78,68,95,
+66,79,77,66,95,65,76,69,82,84,32,32,32,32,32,32,
+32,32,32,32,50,52,'\n',32,32,35,100,101,102,105,110,101,
+32,83,79,85,78,68,95,70,73,78,65,76,95,67,79,85,
+78,84,68,79,87,78,32,32,32,32,32,50,53,'\n',32,32,
+35,100,101,102,105,110,101,32,83,79,85,78,68,95,84,73,
+67,75,95,84,79,67,75,32,32,32,32,32,32,32,32,32,
+32,32,50,54,'\n',32,32,35,100,101,102,105,110,101,32,83,
+79,85,78,68,95,71,79,84,79,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,50,55,'\n',32,32,35,100,
+101,102,105,110,101,32,83,79,85,78,68,95,83,67,65,78,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+50,56,'\n',32,32,35,100,101,102,105,110,101,32,83,79,85,
+78,68,95,80,79,73,78,84,95,84,79,32,32,32,32,32,
+32,32,32,32,32,32,32,50,57,'\n',32,32,35,100,101,102,
+105,110,101,32,83,79,85,78,68,95,65,67,84,73,86,65,
+84,69,95,83,72,73,69,76,68,83,32,32,32,32,51,48,
+'\n',32,32,35,100,101,102,105,110,101,32,83,79,85,78,68,
+95,65,67,84,73,86,65,84,69,95,82,69,70,76,69,67,
+84,32,32,32,32,51,49,'\n',32,32,35,100,101,102,105,110,
+101,32,83,79,85,78,68,95,65,67,84,73,86,65,84,69,
+95,67,76,79,65,75,32,32,32,32,32,32,51,50,'\n',32,
+32,35,100,101,102,105,110,101,32,83,79,85,78,68,95,65,
+67,84,73,86,65,84,69,95,70,76,65,83,72,95,66,76,
+73,78,68,32,32,32,32,51,51,'\n',32,32,35,100,101,102,
+105,110,101,32,83,79,85,78,68,95,77,65,71,78,69,84,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,51,52,
+'\n',32,32,35,100,101,102,105,110,101,32,83,79,85,78,68,
+95,81,85,65,68,95,68,65,77,65,71,69,32,32,32,32,
+32,32,32,32,32,51,53,'\n',32,32,35,100,101,102,105,110,
+101,32,83,79,85,78,68,95,82,69,80,85,76,83,69,32,
+32,32,32,32,32,32,32,32,32,32,32,32,51,54,'\n',32,
+32,35,100,101,102,105,110,101,32,83,79,85,78,68,95,84,
+85,82,66,79,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,51,55,'\n',32,32,35,100,101,102,105,110,101,32,
+83,79,85,78,68,95,70,82,69,69,90,69,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,51,56,'\n',32,32,35,
+100,101,102,105,110,101,32,83,79,85,78,68,95,83,76,79,
+87,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,51,57,'\n',32,32,35,100,101,102,105,110,101,32,83,79,
+85,78,68,95,82,69,86,69,82,83,69,32,32,32,32,32,
+32,32,32,32,32,32,32,32,52,48,'\n',32,32,35,100,101,
+102,105,110,101,32,83,79,85,78,68,95,68,73,90,90,89,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,52,
+49,'\n',32,32,35,100,101,102,105,110,101,32,83,79,85,78,
+68,95,66,79,79,83,84,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,52,50,'\n',32,32,35,100,101,102,105,
+110,101,32,83,79,85,78,68,95,68,69,65,67,84,73,86,
+65,84,69,95,83,72,73,69,76,68,83,32,32,52,51,'\n',
+32,32,35,100,101,102,105,110,101,32,83,79,85,78,68,95,
+68,69,65,67,84,73,86,65,84,69,95,82,69,70,76,69,
+67,84,32,32,52,52,'\n',32,32,35,100,101,102,105,110,101,
+32,83,79,85,78,68,95,68,69,65,67,84,73,86,65,84,
+69,95,67,76,79,65,75,32,32,32,32,52,53,'\n',32,32,
+35,100,101,102,105,110,101,32,83,79,85,78,68,95,82,69,
+70,76,69,67,84,32,32,32,32,32,32,32,32,32,32,32,
+32,32,52,54,'\n',32,32,35,100,101,102,105,110,101,32,83,
+79,85,78,68,95,69,88,80,76,79,83,73,79,78,32,32,
+32,32,32,32,32,32,32,32,32,52,55,'\n',32,32,35,100,
+101,102,105,110,101,32,83,79,85,78,68,95,66,73,71,95,
+69,88,80,76,79,83,73,79,78,32,32,32,32,32,32,32,
+52,56,'\n',32,32,35,100,101,102,105,110,101,32,83,79,85,
+78,68,95,80,76,65,67,69,95,66,79,77,66,32,32,32,
+32,32,32,32,32,32,32,52,57,'\n',32,32,35,100,101,102,
+105,110,101,32,83,79,85,78,68,95,72,73,84,95,66,89,
+95,87,73,78,68,32,32,32,32,32,32,32,32,32,53,48,
+'\n',32,32,35,100,101,102,105,110,101,32,83,79,85,78,68,
+95,79,85,67,72,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,53,49,'\n',32,32,35,100,101,102,105,110,
+101,32,83,79,85,78,68,95,71,69,73,71,69,82,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,53,50,'\n',32,
+32,35,100,101,102,105,110,101,32,83,79,85,78,68,95,87,
+72,73,83,84,76,69,32,32,32,32,32,32,32,32,32,32,
+32,32,32,53,51,'\n',32,32,35,100,101,102,105,110,101,32,
+83,79,85,78,68,95,73,77,95,73,84,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,53,52,'\n',32,32,35,
+100,101,102,105,110,101,32,83,79,85,78,68,95,72,69,76,
+80,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,53,53,'\n',32,32,35,100,101,102,105,110,101,32,83,79,
+85,78,68,95,83,73,82,69,78,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,53,54,'\n',32,32,35,100,101,
+102,105,110,101,32,83,79,85,78,68,95,66,85,82,78,84,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,53,
+55,'\n',32,32,35,100,101,102,105,110,101,32,83,79,85,78,
+68,95,71,82,73,78,68,69,68,32,32,32,32,32,32,32,
+32,32,32,32,32,32,53,56,'\n',32,32,35,100,101,102,105,
+110,101,32,83,79,85,78,68,95,83,77,65,67,75,69,68,
+32,32,32,32,32,32,32,32,32,32,32,32,32,53,57,'\n',
+32,32,35,100,101,102,105,110,101,32,83,79,85,78,68,95,
+84,82,73,76,76,95,85,80,32,32,32,32,32,32,32,32,
+32,32,32,32,54,48,'\n',32,32,35,100,101,102,105,110,101,
+32,83,79,85,78,68,95,84,82,73,76,76,95,68,79,87,
+78,32,32,32,32,32,32,32,32,32,32,54,49,'\n',32,32,
+35,100,101,102,105,110,101,32,83,79,85,78,68,95,89,69,
+76,76,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,54,50,'\n',32,32,35,100,101,102,105,110,101,32,83,
+79,85,78,68,95,87,72,73,83,80,69,82,32,32,32,32,
+32,32,32,32,32,32,32,32,32,54,51,'\n','\n',32,32,35,
+100,101,102,105,110,101,32,76,69,68,95,82,69,68,49,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,48,120,48,49,'\n',32,32,35,100,101,102,105,110,101,32,
+76,69,68,95,82,69,68,50,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,48,120,48,50,'\n',32,
+32,35,100,101,102,105,110,101,32,76,69,68,95,82,69,68,
+51,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,48,120,48,52,'\n',32,32,35,100,101,102,105,110,
+101,32,76,69,68,95,71,82,69,69,78,49,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,48,120,48,56,
+'\n',32,32,35,100,101,102,105,110,101,32,76,69,68,95,71,
+82,69,69,78,50,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,48,120,49,48,'\n',32,32,35,100,101,102,
+105,110,101,32,76,69,68,95,71,82,69,69,78,51,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,48,120,
+50,48,'\n',32,32,35,100,101,102,105,110,101,32,76,69,68,
+95,89,69,76,76,79,87,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,48,120,52,48,'\n',32,32,35,100,
+101,102,105,110,101,32,76,69,68,95,65,76,76,95,82,69,
+68,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+76,69,68,95,82,69,68,49,32,43,32,76,69,68,95,82,
+69,68,50,32,43,32,76,69,68,95,82,69,68,51,'\n',32,
+32,35,100,101,102,105,110,101,32,76,69,68,95,65,76,76,
+95,71,82,69,69,78,32,32,32,32,32,32,32,32,32,32,
+32,32,32,76,69,68,95,71,82,69,69,78,49,32,43,32,
+76,69,68,95,71,82,69,69,78,50,32,43,32,76,69,68,
+95,71,82,69,69,78,51,'\n',32,32,35,100,101,102,105,110,
+101,32,76,69,68,95,65,76,76,95,82,69,68,95,71,82,
+69,69,78,32,32,32,32,32,32,32,32,32,76,69,68,95,
+65,76,76,95,82,69,68,32,43,32,76,69,68,95,65,76,
+76,95,71,82,69,69,78,'\n',32,32,35,100,101,102,105,110,
+101,32,76,69,68,95,65,76,76,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,76,69,68,95,
+65,76,76,95,82,69,68,95,71,82,69,69,78,32,43,32,
+76,69,68,95,89,69,76,76,79,87,'\n','\n',35,101,110,100,
+105,102,32,47,47,32,95,95,83,80,89,'\n','\n',47,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,'\n',32,42,32,83,119,97,110,
+45,115,112,101,99,105,102,105,99,32,65,80,73,'\n',32,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,47,'\n','\n',35,105,102,32,
+100,101,102,105,110,101,100,40,95,95,83,87,65,78,41,'\n',
+'\n',47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,'\n',32,42,32,
+77,111,116,111,114,115,'\n',32,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,47,'\n','\n',32,32,47,47,32,77,111,116,111,114,'\n',
+32,32,35,100,101,102,105,110,101,32,77,84,82,95,65,32,
+32,32,32,32,48,'\n',32,32,35,100,101,102,105,110,101,32,
+77,84,82,95,66,32,32,32,32,32,49,'\n',32,32,35,100,
+101,102,105,110,101,32,77,84,82,95,67,32,32,32,32,32,
+50,'\n',32,32,35,100,101,102,105,110,101,32,77,84,82,95,
+68,32,32,32,32,32,51,'\n',32,32,35,100,101,102,105,110,
+101,32,77,84,82,95,69,32,32,32,32,32,52,'\n',32,32,
+35,100,101,102,105,110,101,32,77,84,82,95,70,32,32,32,
+32,32,53,'\n','\n',32,32,47,47,32,77,111,116,111,114,80,
+111,119,101,114,68,105,114,101,99,116,105,111,110,'\n',32,32,
+35,100,101,102,105,110,101,32,77,80,68,95,70,87,68,32,
+32,32,32,32,32,32,32,32,32,32,48,120,56,48,'\n',32,
+32,35,100,101,102,105,110,101,32,77,80,68,95,82,69,86,
+32,32,32,32,32,32,32,32,32,32,32,48,120,52,48,'\n',
+32,32,35,100,101,102,105,110,101,32,77,80,68,95,70,76,
+79,65,84,32,32,32,32,32,32,32,32,32,48,120,67,48,
+'\n',32,32,35,100,101,102,105,110,101,32,77,80,68,95,79,
+70,70,32,32,32,32,32,32,32,32,32,32,32,48,120,48,
+48,'\n','\n',32,32,47,47,32,77,111,116,111,114,83,116,97,
+116,101,'\n',32,32,35,100,101,102,105,110,101,32,77,83,95,
+70,76,79,65,84,32,32,32,32,32,32,32,32,32,32,48,
+120,48,48,'\n',32,32,35,100,101,102,105,110,101,32,77,83,
+95,66,82,65,75,69,32,32,32,32,32,32,32,32,32,32,
+48,120,52,48,'\n',32,32,35,100,101,102,105,110,101,32,77,
+83,95,70,87,68,32,32,32,32,32,32,32,32,32,32,32,
+32,48,120,56,56,'\n',32,32,35,100,101,102,105,110,101,32,
+77,83,95,82,69,86,32,32,32,32,32,32,32,32,32,32,
+32,32,48,120,56,48,'\n','\n',32,32,35,100,101,102,105,110,
+101,32,83,77,79,84,79,82,95,70,87,68,32,32,32,32,
+32,32,32,32,48,120,48,56,'\n','\n',32,32,35,100,101,102,
+105,110,101,32,77,84,82,95,70,87,68,95,80,79,87,69,
+82,95,49,32,32,32,48,120,56,56,'\n',32,32,35,100,101,
+102,105,110,101,32,77,84,82,95,70,87,68,95,80,79,87,
+69,82,95,50,32,32,32,48,120,56,57,'\n',32,32,35,100,
+101,102,105,110,101,32,77,84,82,95,70,87,68,95,80,79,
+87,69,82,95,51,32,32,32,48,120,56,65,'\n',32,32,35,
+100,101,102,105,110,101,32,77,84,82,95,70,87,68,95,80,
+79,87,69,82,95,52,32,32,32,48,120,56,66,'\n',32,32,
+35,100,101,102,105,110,101,32,77,84,82,95,70,87,68,95,
+80,79,87,69,82,95,53,32,32,32,48,120,56,67,'\n',32,
+32,35,100,101,102,105,110,101,32,77,84,82,95,70,87,68,
+95,80,79,87,69,82,95,54,32,32,32,48,120,56,68,'\n',
+32,32,35,100,101,102,105,110,101,32,77,84,82,95,70,87,
+68,95,80,79,87,69,82,95,55,32,32,32,48,120,56,69,
+'\n',32,32,35,100,101,102,105,110,101,32,77,84,82,95,70,
+87,68,95,80,79,87,69,82,95,56,32,32,32,48,120,56,
+70,'\n','\n',32,32,35,100,101,102,105,110,101,32,77,84,82,
+95,82,69,86,95,80,79,87,69,82,95,49,32,32,32,48,
+120,56,48,'\n',32,32,35,100,101,102,105,110,101,32,77,84,
+82,95,82,69,86,95,80,79,87,69,82,95,50,32,32,32,
+48,120,56,49,'\n',32,32,35,100,101,102,105,110,101,32,77,
+84,82,95,82,69,86,95,80,79,87,69,82,95,51,32,32,
+32,48,120,56,50,'\n',32,32,35,100,101,102,105,110,101,32,
+77,84,82,95,82,69,86,95,80,79,87,69,82,95,52,32,
+32,32,48,120,56,51,'\n',32,32,35,100,101,102,105,110,101,
+32,77,84,82,95,82,69,86,95,80,79,87,69,82,95,53,
+32,32,32,48,120,56,52,'\n',32,32,35,100,101,102,105,110,
+101,32,77,84,82,95,82,69,86,95,80,79,87,69,82,95,
+54,32,32,32,48,120,56,53,'\n',32,32,35,100,101,102,105,
+110,101,32,77,84,82,95,82,69,86,95,80,79,87,69,82,
+95,55,32,32,32,48,120,56,54,'\n',32,32,35,100,101,102,
+105,110,101,32,77,84,82,95,82,69,86,95,80,79,87,69,
+82,95,56,32,32,32,48,120,56,55,'\n','\n',32,32,35,100,
+101,102,105,110,101,32,77,84,82,95,70,76,79,65,84,95,
+80,79,87,69,82,95,49,32,48,120,48,48,'\n',32,32,35,
+100,101,102,105,110,101,32,77,84,82,95,70,76,79,65,84,
+95,80,79,87,69,82,95,50,32,48,120,48,49,'\n',32,32,
+35,100,101,102,105,110,101,32,77,84,82,95,70,76,79,65,
+84,95,80,79,87,69,82,95,51,32,48,120,48,50,'\n',32,
+32,35,100,101,102,105,110,101,32,77,84,82,95,70,76,79,
+65,84,95,80,79,87,69,82,95,52,32,48,120,48,51,'\n',
+32,32,35,100,101,102,105,110,101,32,77,84,82,95,70,76,
+79,65,84,95,80,79,87,69,82,95,53,32,48,120,48,52,
+'\n',32,32,35,100,101,102,105,110,101,32,77,84,82,95,70,
+76,79,65,84,95,80,79,87,69,82,95,54,32,48,120,48,
+53,'\n',32,32,35,100,101,102,105,110,101,32,77,84,82,95,
+70,76,79,65,84,95,80,79,87,69,82,95,55,32,48,120,
+48,54,'\n',32,32,35,100,101,102,105,110,101,32,77,84,82,
+95,70,76,79,65,84,95,80,79,87,69,82,95,56,32,48,
+120,48,55,'\n','\n',32,32,35,100,101,102,105,110,101,32,77,
+84,82,95,66,82,65,75,69,95,80,79,87,69,82,95,49,
+32,48,120,52,48,'\n',32,32,35,100,101,102,105,110,101,32,
+77,84,82,95,66,82,65,75,69,95,80,79,87,69,82,95,
+50,32,48,120,52,49,'\n',32,32,35,100,101,102,105,110,101,
+32,77,84,82,95,66,82,65,75,69,95,80,79,87,69,82,
+95,51,32,48,120,52,50,'\n',32,32,35,100,101,102,105,110,
+101,32,77,84,82,95,66,82,65,75,69,95,80,79,87,69,
+82,95,52,32,48,120,52,51,'\n',32,32,35,100,101,102,105,
+110,101,32,77,84,82,95,66,82,65,75,69,95,80,79,87,
+69,82,95,53,32,48,120,52,52,'\n',32,32,35,100,101,102,
+105,110,101,32,77,84,82,95,66,82,65,75,69,95,80,79,
+87,69,82,95,54,32,48,120,52,53,'\n',32,32,35,100,101,
+102,105,110,101,32,77,84,82,95,66,82,65,75,69,95,80,
+79,87,69,82,95,55,32,48,120,52,54,'\n',32,32,35,100,
+101,102,105,110,101,32,77,84,82,95,66,82,65,75,69,95,
+80,79,87,69,82,95,56,32,48,120,52,55,'\n','\n',32,32,
+35,100,101,102,105,110,101,32,77,111,116,111,114,80,111,119,
+101,114,83,105,103,110,101,100,40,110,41,32,32,32,64,40,
+48,120,48,53,48,48,48,48,32,43,32,40,110,41,41,'\n',
+32,32,95,95,110,111,108,105,115,116,32,118,111,105,100,32,
+83,101,116,77,111,116,111,114,80,111,119,101,114,83,105,103,
+110,101,100,40,99,111,110,115,116,32,105,110,116,32,110,44,
+32,99,111,110,115,116,32,105,110,116,32,38,118,41,32,123,
+32,83,101,116,40,77,111,116,111,114,80,111,119,101,114,83,
+105,103,110,101,100,40,110,41,44,32,118,41,59,32,125,'\n',
+'\n',32,32,35,100,101,102,105,110,101,32,77,111,116,111,114,
+66,114,97,107,101,80,111,119,101,114,40,110,41,32,32,32,
+32,64,40,48,120,48,55,48,48,48,48,32,43,32,40,110,
+41,41,'\n',32,32,95,95,110,111,108,105,115,116,32,118,111,
+105,100,32,83,101,116,77,111,116,111,114,66,114,97,107,101,
+80,111,119,101,114,40,99,111,110,115,116,32,105,110,116,32,
+110,44,32,99,111,110,115,116,32,105,110,116,32,38,118,41,
+32,123,32,83,101,116,40,77,111,116,111,114,66,114,97,107,
+101,80,111,119,101,114,40,110,41,44,32,118,41,59,32,125,
+'\n','\n',32,32,35,100,101,102,105,110,101,32,77,111,116,111,
+114,80,111,119,101,114,56,40,110,41,32,32,32,32,64,40,
+48,120,50,48,48,48,48,48,32,43,32,40,110,41,41,'\n',
+32,32,95,95,110,111,108,105,115,116,32,118,111,105,100,32,
+83,101,116,77,111,116,111,114,80,111,119,101,114,56,40,99,
+111,110,115,116,32,105,110,116,32,110,44,32,99,111,110,115,
+116,32,105,110,116,32,38,118,41,32,123,32,83,101,116,40,
+77,111,116,111,114,80,111,119,101,114,56,40,110,41,44,32,
+118,41,59,32,125,'\n','\n',32,32,35,100,101,102,105,110,101,
+32,77,111,116,111,114,80,111,119,101,114,49,50,56,40,110,
+41,32,32,64,40,48,120,49,48,48,48,48,48,32,43,32,
+40,110,41,41,'\n',32,32,95,95,110,111,108,105,115,116,32,
+118,111,105,100,32,83,101,116,77,111,116,111,114,80,111,119,
+101,114,49,50,56,40,99,111,110,115,116,32,105,110,116,32,
+110,44,32,99,111,110,115,116,32,105,110,116,32,38,118,41,
+32,123,32,83,101,116,40,77,111,116,111,114,80,111,119,101,
+114,49,50,56,40,110,41,44,32,118,41,59,32,125,'\n','\n',
+47,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,'\n',32,42,32,69,
+118,101,110,116,32,115,111,117,114,99,101,115,'\n',32,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,47,'\n','\n',32,32,47,47,32,
+69,118,101,110,116,83,101,110,115,111,114,84,121,112,101,'\n',
+32,32,35,100,101,102,105,110,101,32,69,83,84,95,83,69,
+78,83,79,82,95,49,32,32,32,32,32,32,32,32,32,32,
+48,'\n',32,32,35,100,101,102,105,110,101,32,69,83,84,95,
+83,69,78,83,79,82,95,50,32,32,32,32,32,32,32,32,
+32,32,49,'\n',32,32,35,100,101,102,105,110,101,32,69,83,
+84,95,83,69,78,83,79,82,95,51,32,32,32,32,32,32,
+32,32,32,32,50,'\n',32,32,35,100,101,102,105,110,101,32,
+69,83,84,95,84,73,77,69,82,95,49,32,32,32,32,32,
+32,32,32,32,32,32,51,'\n',32,32,35,100,101,102,105,110,
+101,32,69,83,84,95,84,73,77,69,82,95,50,32,32,32,
+32,32,32,32,32,32,32,32,52,'\n',32,32,35,100,101,102,
+105,110,101,32,69,83,84,95,84,73,77,69,82,95,51,32,
+32,32,32,32,32,32,32,32,32,32,53,'\n',32,32,35,100,
+101,102,105,110,101,32,69,83,84,95,84,73,77,69,82,95,
+52,32,32,32,32,32,32,32,32,32,32,32,54,'\n',32,32,
+35,100,101,102,105,110,101,32,69,83,84,95,76,65,83,84,
+95,73,82,95,77,83,71,32,32,32,32,32,32,32,55,'\n',
+32,32,35,100,101,102,105,110,101,32,69,83,84,95,67,79,
+85,78,84,69,82,95,49,32,32,32,32,32,32,32,32,32,
+56,'\n',32,32,35,100,101,102,105,110,101,32,69,83,84,95,
+67,79,85,78,84,69,82,95,50,32,32,32,32,32,32,32,
+32,32,57,'\n',32,32,35,100,101,102,105,110,101,32,69,83,
+84,95,67,79,85,78,84,69,82,95,51,32,32,32,32,32,
+32,32,32,32,49,48,'\n',32,32,35,100,101,102,105,110,101,
+32,69,83,84,95,85,83,69,82,95,69,86,69,78,84,95,
+48,32,32,32,32,32,32,49,49,'\n',32,32,35,100,101,102,
+105,110,101,32,69,83,84,95,85,83,69,82,95,69,86,69,
+78,84,95,49,32,32,32,32,32,32,49,50,'\n',32,32,35,
+100,101,102,105,110,101,32,69,83,84,95,85,83,69,82,95,
+69,86,69,78,84,95,50,32,32,32,32,32,32,49,51,'\n',
+32,32,35,100,101,102,105,110,101,32,69,83,84,95,85,83,
+69,82,95,69,86,69,78,84,95,51,32,32,32,32,32,32,
+49,52,'\n',32,32,35,100,101,102,105,110,101,32,69,83,84,
+95,85,83,69,82,95,69,86,69,78,84,95,52,32,32,32,
+32,32,32,49,53,'\n',32,32,35,100,101,102,105,110,101,32,
+69,83,84,95,86,73,82,84,85,65,76,95,77,79,84,79,
+82,32,32,32,32,32,49,49,'\n',32,32,35,100,101,102,105,
+110,101,32,69,83,84,95,86,73,82,84,85,65,76,95,83,
+69,78,83,79,82,32,32,32,32,49,50,'\n',32,32,35,100,
+101,102,105,110,101,32,69,83,84,95,87,65,73,84,95,70,
+79,82,95,77,83,71,32,32,32,32,32,32,49,51,'\n',32,
+32,35,100,101,102,105,110,101,32,69,83,84,95,73,78,70,
+82,65,82,69,68,95,83,84,65,84,85,83,32,32,32,49,
+52,'\n',32,32,35,100,101,102,105,110,101,32,69,83,84,95,
+83,69,78,83,79,82,95,85,78,85,83,69,68,32,32,32,
+32,32,49,54,'\n','\n',32,32,47,47,32,69,118,101,110,116,
+83,116,97,116,101,115,'\n',32,32,35,100,101,102,105,110,101,
+32,69,83,95,66,69,76,79,87,95,76,79,87,69,82,32,
+32,32,32,32,32,32,32,48,'\n',32,32,35,100,101,102,105,
+110,101,32,69,83,95,66,69,84,87,69,69,78,32,32,32,
+32,32,32,32,32,32,32,32,32,49,'\n',32,32,35,100,101,
+102,105,110,101,32,69,83,95,65,66,79,86,69,95,85,80,
+80,69,82,32,32,32,32,32,32,32,32,50,'\n',32,32,35,
+100,101,102,105,110,101,32,69,83,95,85,78,68,69,84,69,
+82,77,73,78,69,68,32,32,32,32,32,32,32,51,'\n','\n',
+32,32,35,100,101,102,105,110,101,32,69,118,101,110,116,84,
+121,112,101,40,110,41,32,32,32,32,32,32,64,40,48,120,
+49,50,48,48,48,48,32,43,32,40,110,41,41,'\n',32,32,
+95,95,110,111,108,105,115,116,32,118,111,105,100,32,83,101,
+116,69,118,101,110,116,84,121,112,101,40,99,111,110,115,116,
+32,105,110,116,32,110,44,32,99,111,110,115,116,32,105,110,
+116,32,38,118,41,32,123,32,83,101,116,40,69,118,101,110,
+116,84,121,112,101,40,110,41,44,32,118,41,59,32,125,'\n',
+'\n',32,32,35,100,101,102,105,110,101,32,69,118,101,110,116,
+83,114,99,40,110,41,32,32,32,32,32,32,32,64,40,48,
+120,49,51,48,48,48,48,32,43,32,40,110,41,41,'\n',32,
+32,95,95,110,111,108,105,115,116,32,118,111,105,100,32,83,
+101,116,69,118,101,110,116,83,114,99,40,99,111,110,115,116,
+32,105,110,116,32,110,44,32,99,111,110,115,116,32,105,110,
+116,32,38,118,41,32,123,32,83,101,116,40,69,118,101,110,
+116,83,114,99,40,110,41,44,32,118,41,59,32,125,'\n','\n',
+32,32,35,100,101,102,105,110,101,32,69,118,101,110,116,67,
+111,117,110,116,115,40,110,41,32,32,32,32,64,40,48,120,
+49,52,48,48,48,48,32,43,32,40,110,41,41,'\n',32,32,
+95,95,110,111,108,105,115,116,32,118,111,105,100,32,83,101,
+116,69,118,101,110,116,67,111,117,110,116,115,40,99,111,110,
+115,116,32,105,110,116,32,110,44,32,99,111,110,115,116,32,
+105,110,116,32,38,118,41,32,123,32,83,101,116,40,69,118,
+101,110,116,67,111,117,110,116,115,40,110,41,44,32,118,41,
+59,32,125,'\n','\n',47,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+'\n',32,42,32,49,32,77,83,32,84,105,109,101,114,'\n',32,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,47,'\n','\n',32,32,35,
+100,101,102,105,110,101,32,77,83,84,105,109,101,114,40,110,
+41,32,32,32,32,32,32,32,32,64,40,48,120,49,54,48,
+48,48,48,32,43,32,40,110,41,41,'\n',32,32,95,95,110,
+111,108,105,115,116,32,118,111,105,100,32,82,101,115,101,116,
+77,83,84,105,109,101,114,40,99,111,110,115,116,32,105,110,
+116,32,110,41,32,123,32,83,101,116,40,77,83,84,105,109,
+101,114,40,110,41,44,32,48,41,59,32,125,'\n','\n',32,32,
+95,95,110,111,108,105,115,116,32,118,111,105,100,32,87,97,
+105,116,77,83,40,99,111,110,115,116,32,105,110,116,32,38,
+118,41,32,123,32,97,115,109,32,123,32,48,120,52,55,44,
+32,36,118,32,58,32,95,95,65,83,77,95,83,82,67,95,
+69,88,84,125,59,32,125,'\n','\n','\n',47,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,'\n',32,42,32,83,121,115,116,101,109,32,
+115,101,116,116,105,110,103,115,'\n',32,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,47,'\n','\n',32,32,35,100,101,102,105,110,101,
+32,83,121,115,116,101,109,40,110,41,32,32,32,32,32,32,
+32,32,32,64,40,48,120,49,56,48,48,48,48,32,43,32,
+40,110,41,41,'\n',32,32,95,95,110,111,108,105,115,116,32,
+118,111,105,100,32,83,101,116,83,121,115,116,101,109,40,99,
+111,110,115,116,32,105,110,116,32,110,44,32,99,111,110,115,
+116,32,105,110,116,32,38,118,41,32,123,32,83,101,116,40,
+83,121,115,116,101,109,40,110,41,44,32,118,41,59,32,125,
+'\n','\n',32,32,35,100,101,102,105,110,101,32,83,89,83,95,
+66,65,84,84,69,82,89,95,76,69,86,69,76,32,32,32,
+32,32,32,32,32,32,32,32,32,32,48,32,47,47,32,82,
+47,79,'\n',32,32,35,100,101,102,105,110,101,32,73,109,109,
+101,100,105,97,116,101,66,97,116,116,101,114,121,76,101,118,
+101,108,40,41,32,32,32,32,32,32,32,83,121,115,116,101,
+109,40,83,89,83,95,66,65,84,84,69,82,89,95,76,69,
+86,69,76,41,'\n','\n',32,32,35,100,101,102,105,110,101,32,
+83,89,83,95,68,69,66,85,71,95,84,65,83,75,95,77,
+79,68,69,32,32,32,32,32,32,32,32,32,32,32,49,32,
+47,47,32,82,47,79,'\n',32,32,35,100,101,102,105,110,101,
+32,68,101,98,117,103,84,97,115,107,77,111,100,101,40,41,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,83,
+121,115,116,101,109,40,83,89,83,95,68,69,66,85,71,95,
+84,65,83,75,95,77,79,68,69,41,'\n','\n',32,32,35,100,
+101,102,105,110,101,32,83,89,83,95,77,69,77,79,82,89,
+95,77,65,80,95,65,68,68,82,69,83,83,32,32,32,32,
+32,32,32,32,50,32,47,47,32,82,47,79,'\n',32,32,35,
+100,101,102,105,110,101,32,77,101,109,111,114,121,77,97,112,
+65,100,100,114,101,115,115,40,41,32,32,32,32,32,32,32,
+32,32,32,32,32,83,121,115,116,101,109,40,83,89,83,95,
+77,69,77,79,82,89,95,77,65,80,95,65,68,68,82,69,
+83,83,41,'\n','\n',32,32,35,100,101,102,105,110,101,32,83,
+89,83,95,67,85,82,82,69,78,84,95,84,65,83,75,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,51,32,47,
+47,32,82,47,79,'\n',32,32,35,100,101,102,105,110,101,32,
+67,117,114,114,101,110,116,84,97,115,107,40,41,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,83,121,
+115,116,101,109,40,83,89,83,95,67,85,82,82,69,78,84,
+95,84,65,83,75,41,'\n','\n',32,32,35,100,101,102,105,110,
+101,32,83,89,83,95,83,69,82,73,65,76,95,76,73,78,
+75,95,83,84,65,84,85,83,32,32,32,32,32,32,32,32,
+52,32,47,47,32,82,47,79,'\n',32,32,35,100,101,102,105,
+110,101,32,83,101,114,105,97,108,76,105,110,107,83,116,97,
+116,117,115,40,41,32,32,32,32,32,32,32,32,32,32,32,
+32,83,121,115,116,101,109,40,83,89,83,95,83,69,82,73,
+65,76,95,76,73,78,75,95,83,84,65,84,85,83,41,'\n',
+'\n',32,32,32,32,35,100,101,102,105,110,101,32,83,76,83,
+95,87,65,73,84,95,70,79,82,95,77,83,71,32,32,32,
+32,48,'\n',32,32,32,32,35,100,101,102,105,110,101,32,83,
+76,83,95,82,69,67,69,73,86,73,78,71,95,77,83,71,
+32,32,32,49,'\n',32,32,32,32,35,100,101,102,105,110,101,
+32,83,76,83,95,84,82,65,78,83,77,73,84,84,73,78,
+71,32,32,32,32,50,'\n',32,32,32,32,35,100,101,102,105,
+110,101,32,83,76,83,95,85,78,75,78,79,87,78,32,32,
+32,32,32,32,32,32,32,51,'\n','\n',32,32,35,100,101,102,
+105,110,101,32,83,89,83,95,79,80,67,79,68,69,83,95,
+80,69,82,95,84,73,77,69,83,76,73,67,69,32,32,32,
+32,32,53,32,47,47,32,82,47,87,32,40,49,48,48,120,
+32,111,110,108,121,41,'\n',32,32,35,100,101,102,105,110,101,
+32,79,112,99,111,100,101,115,80,101,114,84,105,109,101,115,
+108,105,99,101,40,41,32,32,32,32,32,32,32,32,32,83,
+121,115,116,101,109,40,83,89,83,95,79,80,67,79,68,69,
+83,95,80,69,82,95,84,73,77,69,83,76,73,67,69,41,
+'\n',32,32,95,95,110,111,108,105,115,116,32,118,111,105,100,
+32,83,101,116,79,112,99,111,100,101,115,80,101,114,84,105,
+109,101,115,108,105,99,101,40,99,111,110,115,116,32,105,110,
+116,32,38,118,41,32,123,32,83,101,116,40,79,112,99,111,
+100,101,115,80,101,114,84,105,109,101,115,108,105,99,101,40,
+41,44,32,118,41,59,32,125,'\n','\n',32,32,35,100,101,102,
+105,110,101,32,83,89,83,95,77,79,84,79,82,95,84,82,
+65,78,83,73,84,73,79,78,95,68,69,76,65,89,32,32,
+32,32,54,32,47,47,32,82,47,87,'\n',32,32,35,100,101,
+102,105,110,101,32,77,111,116,111,114,84,114,97,110,115,105,
+116,105,111,110,68,101,108,97,121,40,41,32,32,32,32,32,
+32,32,32,83,121,115,116,101,109,40,83,89,83,95,77,79,
+84,79,82,95,84,82,65,78,83,73,84,73,79,78,95,68,
+69,76,65,89,41,'\n',32,32,95,95,110,111,108,105,115,116,
+32,118,111,105,100,32,83,101,116,77,111,116,111,114,84,114,
+97,110,115,105,116,105,111,110,68,101,108,97,121,40,99,111,
+110,115,116,32,105,110,116,32,38,118,41,32,123,32,83,101,
+116,40,77,111,116,111,114,84,114,97,110,115,105,116,105,111,
+110,68,101,108,97,121,40,41,44,32,118,41,59,32,125,'\n',
+'\n',32,32,35,100,101,102,105,110,101,32,83,89,83,95,83,
+69,78,83,79,82,95,82,69,70,82,69,83,72,95,82,65,
+84,69,32,32,32,32,32,32,32,55,32,47,47,32,82,47,
+87,'\n',32,32,35,100,101,102,105,110,101,32,83,101,110,115,
+111,114,82,101,102,114,101,115,104,82,97,116,101,40,41,32,
+32,32,32,32,32,32,32,32,32,32,83,121,115,116,101,109,
+40,83,89,83,95,83,69,78,83,79,82,95,82,69,70,82,
+69,83,72,95,82,65,84,69,41,'\n',32,32,95,95,110,111,
+108,105,115,116,32,118,111,105,100,32,83,101,116,83,101,110,
+115,111,114,82,101,102,114,101,115,104,82,97,116,101,40,99,
+111,110,115,116,32,105,110,116,32,38,118,41,32,123,32,83,
+101,116,40,83,101,110,115,111,114,82,101,102,114,101,115,104,
+82,97,116,101,40,41,44,32,118,41,59,32,125,'\n','\n',32,
+32,35,100,101,102,105,110,101,32,83,89,83,95,69,88,80,
+65,78,68,69,68,95,82,67,95,77,69,83,83,65,71,69,
+83,32,32,32,32,32,32,56,32,47,47,32,82,47,87,'\n',
+32,32,35,100,101,102,105,110,101,32,69,120,112,97,110,100,
+101,100,82,101,109,111,116,101,77,101,115,115,97,103,101,115,
+40,41,32,32,32,32,32,32,83,121,115,116,101,109,40,83,
+89,83,95,69,88,80,65,78,68,69,68,95,82,67,95,77,
+69,83,83,65,71,69,83,41,'\n',32,32,95,95,110,111,108,
+105,115,116,32,118,111,105,100,32,83,101,116,69,120,112,97,
+110,100,101,100,82,101,109,111,116,101,77,101,115,115,97,103,
+101,115,40,99,111,110,115,116,32,105,110,116,32,38,118,41,
+32,123,32,83,101,116,40,69,120,112,97,110,100,101,100,82,
+101,109,111,116,101,77,101,115,115,97,103,101,115,40,41,44,
+32,118,41,59,32,125,'\n','\n',32,32,35,100,101,102,105,110,
+101,32,83,89,83,95,76,67,68,95,82,69,70,82,69,83,
+72,95,82,65,84,69,32,32,32,32,32,32,32,32,32,32,
+57,32,47,47,32,82,47,87,32,40,49,48,48,109,115,32,
+116,105,99,107,115,41,'\n',32,32,35,100,101,102,105,110,101,
+32,76,67,68,82,101,102,114,101,115,104,82,97,116,101,40,
+41,32,32,32,32,32,32,32,32,32,32,32,32,32,32,83,
+121,115,116,101,109,40,83,89,83,95,76,67,68,95,82,69,
+70,82,69,83,72,95,82,65,84,69,41,'\n',32,32,95,95,
+110,111,108,105,115,116,32,118,111,105,100,32,83,101,116,76,
+67,68,82,101,102,114,101,115,104,82,97,116,101,40,99,111,
+110,115,116,32,105,110,116,32,38,118,41,32,123,32,83,101,
+116,40,76,67,68,82,101,102,114,101,115,104,82,97,116,101,
+40,41,44,32,118,41,59,32,125,'\n','\n',32,32,35,100,101,
+102,105,110,101,32,83,89,83,95,78,79,95,80,79,87,69,
+82,95,68,79,87,78,95,79,78,95,65,67,32,32,32,32,
+32,32,32,49,48,32,47,47,32,82,47,87,32,40,116,114,
+117,101,47,102,97,108,115,101,41,'\n',32,32,35,100,101,102,
+105,110,101,32,78,111,80,111,119,101,114,68,111,119,110,79,
+110,65,67,40,41,32,32,32,32,32,32,32,32,32,32,32,
+32,32,83,121,115,116,101,109,40,83,89,83,95,78,79,95,
+80,79,87,69,82,95,68,79,87,78,95,79,78,95,65,67,
+41,'\n',32,32,95,95,110,111,108,105,115,116,32,118,111,105,
+100,32,83,101,116,78,111,80,111,119,101,114,68,111,119,110,
+79,110,65,67,40,99,111,110,115,116,32,105,110,116,32,38,
+118,41,32,123,32,83,101,116,40,78,111,80,111,119,101,114,
+68,111,119,110,79,110,65,67,40,41,44,32,118,41,59,32,
+125,'\n','\n',32,32,35,100,101,102,105,110,101,32,83,89,83,
+95,68,69,70,65,85,76,84,95,84,65,83,75,95,83,84,
+65,67,75,95,83,73,90,69,32,32,32,49,49,32,47,47,
+32,82,47,87,'\n',32,32,35,100,101,102,105,110,101,32,68,
+101,102,97,117,108,116,83,116,97,99,107,83,105,122,101,40,
+41,32,32,32,32,32,32,32,32,32,32,32,32,83,121,115,
+116,101,109,40,83,89,83,95,68,69,70,65,85,76,84,95,
+84,65,83,75,95,83,84,65,67,75,95,83,73,90,69,41,
+'\n',32,32,95,95,110,111,108,105,115,116,32,118,111,105,100,
+32,83,101,116,68,101,102,97,117,108,116,83,116,97,99,107,
+83,105,122,101,40,99,111,110,115,116,32,105,110,116,32,38,
+118,41,32,123,32,83,101,116,40,68,101,102,97,117,108,116,
+83,116,97,99,107,83,105,122,101,40,41,44,32,118,41,59,
+32,125,'\n','\n',32,32,35,100,101,102,105,110,101,32,83,89,
+83,95,84,65,83,75,95,65,67,81,85,73,82,69,95,80,
+82,73,79,82,73,84,89,32,32,32,32,32,49,50,32,47,
+47,32,82,47,87,'\n',32,32,35,100,101,102,105,110,101,32,
+84,97,115,107,65,99,113,117,105,114,101,80,114,105,111,114,
+105,116,121,40,41,32,32,32,32,32,32,32,32,32,83,121,
+115,116,101,109,40,83,89,83,95,84,65,83,75,95,65,67,
+81,85,73,82,69,95,80,82,73,79,82,73,84,89,41,'\n',
+32,32,95,95,110,111,108,105,115,116,32,118,111,105,100,32,
+83,101,116,84,97,115,107,65,99,113,117,105,114,101,80,114,
+105,111,114,105,116,121,40,99,111,110,115,116,32,105,110,116,
+32,38,118,41,32,123,32,83,101,116,40,84,97,115,107,65,
+99,113,117,105,114,101,80,114,105,111,114,105,116,121,40,41,
+44,32,118,41,59,32,125,'\n','\n',32,32,35,100,101,102,105,
+110,101,32,83,89,83,95,84,82,65,78,83,77,73,84,84,
+69,82,95,82,65,78,71,69,32,32,32,32,32,32,32,32,
+32,49,51,32,47,47,32,82,47,87,32,40,48,47,49,41,
+32,63,63,63,'\n',32,32,35,100,101,102,105,110,101,32,84,
+114,97,110,115,109,105,116,116,101,114,82,97,110,103,101,40,
+41,32,32,32,32,32,32,32,32,32,32,32,32,83,121,115,
+116,101,109,40,83,89,83,95,84,82,65,78,83,77,73,84,
+84,69,82,95,82,65,78,71,69,41,'\n','\n',32,32,35,100,
+101,102,105,110,101,32,83,89,83,95,70,76,79,65,84,95,
+68,85,82,73,78,71,95,73,78,65,67,84,73,86,69,95,
+80,87,77,32,49,52,32,47,47,32,82,47,87,32,40,116,
+114,117,101,47,102,97,108,115,101,41,'\n',32,32,35,100,101,
+102,105,110,101,32,70,108,111,97,116,68,117,114,105,110,103,
+73,110,97,99,116,105,118,101,80,87,77,40,41,32,32,32,
+32,32,32,83,121,115,116,101,109,40,83,89,83,95,70,76,
+79,65,84,95,68,85,82,73,78,71,95,73,78,65,67,84,
+73,86,69,95,80,87,77,41,'\n',32,32,95,95,110,111,108,
+105,115,116,32,118,111,105,100,32,83,101,116,70,108,111,97,
+116,68,117,114,105,110,103,73,110,97,99,116,105,118,101,80,
+87,77,40,99,111,110,115,116,32,105,110,116,32,38,118,41,
+32,123,32,83,101,116,40,70,108,111,97,116,68,117,114,105,
+110,103,73,110,97,99,116,105,118,101,80,87,77,40,41,44,
+32,118,41,59,32,125,'\n','\n',32,32,35,100,101,102,105,110,
+101,32,83,89,83,95,82,79,84,95,69,82,82,79,82,83,
+95,67,79,85,78,84,32,32,32,32,32,32,32,32,32,32,
+49,53,32,47,47,32,82,47,87,'\n',32,32,35,100,101,102,
+105,110,101,32,82,111,116,69,114,114,111,114,115,67,111,117,
+110,116,40,41,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,83,121,115,116,101,109,40,83,89,83,95,82,79,84,
+95,69,82,82,79,82,83,95,67,79,85,78,84,41,'\n','\n',
+32,32,35,100,101,102,105,110,101,32,83,89,83,95,82,79,
+84,95,68,69,66,79,85,78,67,69,68,95,71,76,73,84,
+67,72,69,83,32,32,32,32,49,54,32,47,47,32,82,47,
+87,32,100,101,98,117,103,'\n',32,32,35,100,101,102,105,110,
+101,32,82,111,116,68,101,98,111,117,110,99,101,100,71,108,
+105,116,99,104,101,115,40,41,32,32,32,32,32,32,32,32,
+83,121,115,116,101,109,40,83,89,83,95,82,79,84,95,68,
+69,66,79,85,78,67,69,68,95,71,76,73,84,67,72,69,
+83,41,'\n','\n',32,32,35,100,101,102,105,110,101,32,83,89,
+83,95,80,82,69,65,77,66,76,69,95,83,73,90,69,32,
+32,32,32,32,32,32,32,32,32,32,32,32,49,55,32,47,
+47,32,82,47,87,32,40,48,46,46,51,41,'\n',32,32,35,
+100,101,102,105,110,101,32,83,121,115,116,101,109,80,114,101,
+97,109,98,108,101,83,105,122,101,40,41,32,32,32,32,32,
+32,32,32,32,32,83,121,115,116,101,109,40,83,89,83,95,
+80,82,69,65,77,66,76,69,95,83,73,90,69,41,'\n',32,
+32,95,95,110,111,108,105,115,116,32,118,111,105,100,32,83,
+101,116,83,121,115,116,101,109,80,114,101,97,109,98,108,101,
+83,105,122,101,40,99,111,110,115,116,32,105,110,116,32,38,
+118,41,32,123,32,83,101,116,40,83,121,115,116,101,109,80,
+114,101,97,109,98,108,101,83,105,122,101,40,41,44,32,118,
+41,59,32,125,'\n','\n',32,32,35,100,101,102,105,110,101,32,
+83,89,83,95,85,78,83,79,76,73,67,73,84,69,68,95,
+77,69,83,83,65,71,69,83,32,32,32,32,32,32,49,56,
+32,47,47,32,82,47,87,32,40,116,114,117,101,47,102,97,
+108,115,101,41,'\n',32,32,35,100,101,102,105,110,101,32,85,
+110,115,111,108,105,99,105,116,101,100,77,101,115,115,97,103,
+101,115,40,41,32,32,32,32,32,32,32,32,32,83,121,115,
+116,101,109,40,83,89,83,95,85,78,83,79,76,73,67,73,
+84,69,68,95,77,69,83,83,65,71,69,83,41,'\n','\n',32,
+32,35,100,101,102,105,110,101,32,83,89,83,95,69,88,80,
+65,78,68,69,68,95,83,85,66,82,79,85,84,73,78,69,
+83,32,32,32,32,32,32,49,57,32,47,47,32,82,47,87,
+32,40,116,114,117,101,47,102,97,108,115,101,41,'\n',32,32,
+35,100,101,102,105,110,101,32,69,120,112,97,110,100,101,100,
+83,117,98,114,111,117,116,105,110,101,115,40,41,32,32,32,
+32,32,32,32,32,32,83,121,115,116,101,109,40,83,89,83,
+95,69,88,80,65,78,68,69,68,95,83,85,66,82,79,85,
+84,73,78,69,83,41,'\n',32,32,95,95,110,111,108,105,115,
+116,32,118,111,105,100,32,83,101,116,69,120,112,97,110,100,
+101,100,83,117,98,114,111,117,116,105,110,101,115,40,99,111,
+110,115,116,32,105,110,116,32,38,118,41,32,123,32,83,101,
+116,40,69,120,112,97,110,100,101,100,83,117,98,114,111,117,
+116,105,110,101,115,40,41,44,32,118,41,59,32,125,'\n','\n',
+32,32,35,100,101,102,105,110,101,32,83,89,83,95,80,79,
+87,69,82,95,68,79,87,78,95,68,69,76,65,89,32,32,
+32,32,32,32,32,32,32,32,50,48,32,47,47,32,82,47,
+87,'\n',32,32,35,100,101,102,105,110,101,32,80,111,119,101,
+114,68,111,119,110,68,101,108,97,121,40,41,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,83,121,115,116,101,109,
+40,83,89,83,95,80,79,87,69,82,95,68,79,87,78,95,
+68,69,76,65,89,41,'\n','\n',32,32,35,100,101,102,105,110,
+101,32,83,89,83,95,87,65,84,67,72,95,70,79,82,77,
+65,84,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+50,49,32,47,47,32,82,47,87,'\n',32,32,35,100,101,102,
+105,110,101,32,87,97,116,99,104,70,111,114,109,97,116,40,
+41,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,83,121,115,116,101,109,40,83,89,83,95,87,65,84,
+67,72,95,70,79,82,77,65,84,41,'\n',32,32,95,95,110,
+111,108,105,115,116,32,118,111,105,100,32,83,101,116,87,97,
+116,99,104,70,111,114,109,97,116,40,99,111,110,115,116,32,
+105,110,116,32,38,118,41,32,123,32,83,101,116,40,87,97,
+116,99,104,70,111,114,109,97,116,40,41,44,32,118,41,59,
+32,125,'\n',32,32,35,100,101,102,105,110,101,32,70,77,84,
+95,72,72,77,77,32,32,32,32,32,32,48,'\n',32,32,35,
+100,101,102,105,110,101,32,70,77,84,95,77,77,83,83,32,
+32,32,32,32,32,49,'\n',32,32,35,100,101,102,105,110,101,
+32,70,77,84,95,77,83,83,84,69,78,84,72,83,32,50,
+'\n','\n',32,32,35,100,101,102,105,110,101,32,83,89,83,95,
+83,69,78,83,79,82,95,77,73,83,83,69,68,95,67,79,
+78,86,69,82,83,73,79,78,83,32,50,50,32,47,47,32,
+82,47,87,32,100,101,98,117,103,'\n',32,32,35,100,101,102,
+105,110,101,32,77,105,115,115,101,100,83,101,110,115,111,114,
+65,68,67,111,110,118,101,114,115,105,111,110,115,40,41,32,
+32,32,83,121,115,116,101,109,40,83,89,83,95,83,69,78,
+83,79,82,95,77,73,83,83,69,68,95,67,79,78,86,69,
+82,83,73,79,78,83,41,'\n','\n',32,32,35,100,101,102,105,
+110,101,32,83,89,83,95,73,71,78,79,82,69,95,77,69,
+83,83,65,71,69,83,95,67,80,85,32,32,32,32,32,32,
+32,50,51,'\n',32,32,35,100,101,102,105,110,101,32,73,103,
+110,111,114,101,77,101,115,115,97,103,101,115,67,80,85,40,
+41,32,32,32,32,32,32,32,32,32,32,32,83,121,115,116,
+101,109,40,83,89,83,95,73,71,78,79,82,69,95,77,69,
+83,83,65,71,69,83,95,67,80,85,41,'\n','\n',32,32,35,
+100,101,102,105,110,101,32,83,89,83,95,67,79,77,77,95,
+69,82,82,79,82,83,95,84,73,77,69,79,85,84,32,32,
+32,32,32,32,32,50,52,'\n',32,32,35,100,101,102,105,110,
+101,32,67,111,109,109,69,114,114,111,114,115,84,105,109,101,
+111,117,116,40,41,32,32,32,32,32,32,32,32,32,32,32,
+83,121,115,116,101,109,40,83,89,83,95,67,79,77,77,95,
+69,82,82,79,82,83,95,84,73,77,69,79,85,84,41,'\n',
+'\n',32,32,35,100,101,102,105,110,101,32,83,89,83,95,67,
+79,77,77,95,69,82,82,79,82,83,95,80,65,82,73,84,
+89,32,32,32,32,32,32,32,32,50,53,'\n',32,32,35,100,
+101,102,105,110,101,32,67,111,109,109,69,114,114,111,114,115,
+80,97,114,105,116,121,40,41,32,32,32,32,32,32,32,32,
+32,32,32,32,83,121,115,116,101,109,40,83,89,83,95,67,
+79,77,77,95,69,82,82,79,82,83,95,80,65,82,73,84,
+89,41,'\n','\n',32,32,35,100,101,102,105,110,101,32,83,89,
+83,95,67,79,77,77,95,69,82,82,79,82,83,95,70,82,
+65,77,73,78,71,32,32,32,32,32,32,32,50,54,'\n',32,
+32,35,100,101,102,105,110,101,32,67,111,109,109,69,114,114,
+111,114,115,70,114,97,109,105,110,103,40,41,32,32,32,32,
+32,32,32,32,32,32,32,83,121,115,116,101,109,40,83,89,
+83,95,67,79,77,77,95,69,82,82,79,82,83,95,70,82,
+65,77,73,78,71,41,'\n','\n',32,32,35,100,101,102,105,110,
+101,32,83,89,83,95,67,79,77,77,95,69,82,82,79,82,
+83,95,79,86,69,82,82,85,78,32,32,32,32,32,32,32,
+50,55,'\n',32,32,35,100,101,102,105,110,101,32,67,111,109,
+109,69,114,114,111,114,115,79,118,101,114,114,117,110,40,41,
+32,32,32,32,32,32,32,32,32,32,32,83,121,115,116,101,
+109,40,83,89,83,95,67,79,77,77,95,69,82,82,79,82,
+83,95,79,86,69,82,82,85,78,41,'\n','\n',32,32,35,100,
+101,102,105,110,101,32,83,89,83,95,73,78,84,69,82,95,
+67,72,65,82,95,84,73,77,69,79,85,84,32,32,32,32,
+32,32,32,32,50,56,32,47,47,32,82,47,87,'\n',32,32,
+35,100,101,102,105,110,101,32,73,110,116,101,114,67,104,97,
+114,84,105,109,101,111,117,116,40,41,32,32,32,32,32,32,
+32,32,32,32,32,32,83,121,115,116,101,109,40,83,89,83,
+95,73,78,84,69,82,95,67,72,65,82,95,84,73,77,69,
+79,85,84,41,'\n',32,32,95,95,110,111,108,105,115,116,32,
+118,111,105,100,32,83,101,116,73,110,116,101,114,67,104,97,
+114,84,105,109,101,111,117,116,40,99,111,110,115,116,32,105,
+110,116,32,38,118,41,32,123,32,83,101,116,40,73,110,116,
+101,114,67,104,97,114,84,105,109,101,111,117,116,40,41,44,
+32,118,41,59,32,125,'\n','\n',32,32,35,100,101,102,105,110,
+101,32,83,89,83,95,84,65,83,75,95,83,67,72,69,68,
+85,76,73,78,71,95,80,82,73,79,82,73,84,89,32,32,
+50,57,32,47,47,32,82,47,87,'\n',32,32,35,100,101,102,
+105,110,101,32,84,97,115,107,83,99,104,101,100,117,108,105,
+110,103,80,114,105,111,114,105,116,121,40,41,32,32,32,32,
+32,32,83,121,115,116,101,109,40,83,89,83,95,84,65,83,
+75,95,83,67,72,69,68,85,76,73,78,71,95,80,82,73,
+79,82,73,84,89,41,'\n',32,32,95,95,110,111,108,105,115,
+116,32,118,111,105,100,32,83,101,116,84,97,115,107,83,99,
+104,101,100,117,108,105,110,103,80,114,105,111,114,105,116,121,
+40,99,111,110,115,116,32,105,110,116,32,38,118,41,32,123,
+32,83,101,116,40,84,97,115,107,83,99,104,101,100,117,108,
+105,110,103,80,114,105,111,114,105,116,121,40,41,44,32,118,
+41,59,32,125,'\n','\n',32,32,35,100,101,102,105,110,101,32,
+83,89,83,95,86,79,76,85,77,69,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,51,48,
+32,47,47,32,82,47,87,'\n',32,32,35,100,101,102,105,110,
+101,32,86,111,108,117,109,101,40,41,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+83,121,115,116,101,109,40,83,89,83,95,86,79,76,85,77,
+69,41,'\n',32,32,95,95,110,111,108,105,115,116,32,118,111,
+105,100,32,83,101,116,86,111,108,117,109,101,40,99,111,110,
+115,116,32,105,110,116,32,38,118,41,32,123,32,83,101,116,
+40,86,111,108,117,109,101,40,41,44,32,118,41,59,32,125,
+'\n',32,32,35,100,101,102,105,110,101,32,77,65,88,95,86,
+79,76,85,77,69,32,32,32,32,49,54,'\n','\n',32,32,35,
+100,101,102,105,110,101,32,83,89,83,95,83,79,85,78,68,
+95,80,76,65,89,73,78,71,32,32,32,32,32,32,32,32,
+32,32,32,32,32,51,49,32,47,47,32,82,47,79,32,40,
+116,114,117,101,47,102,97,108,115,101,41,'\n',32,32,35,100,
+101,102,105,110,101,32,83,111,117,110,100,65,99,116,105,118,
+101,40,41,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,83,121,115,116,101,109,40,83,89,83,95,83,
+79,85,78,68,95,80,76,65,89,73,78,71,41,'\n','\n',32,
+32,35,100,101,102,105,110,101,32,83,89,83,95,80,76,65,
+89,95,83,79,85,78,68,83,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,51,50,32,47,47,32,82,47,87,
+32,40,116,114,117,101,47,102,97,108,115,101,41,'\n',32,32,
+35,100,101,102,105,110,101,32,80,108,97,121,83,111,117,110,
+100,115,40,41,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,83,121,115,116,101,109,40,83,89,83,
+95,80,76,65,89,95,83,79,85,78,68,83,41,'\n',32,32,
+95,95,110,111,108,105,115,116,32,118,111,105,100,32,83,101,
+116,80,108,97,121,83,111,117,110,100,115,40,99,111,110,115,
+116,32,105,110,116,32,38,118,41,32,123,32,83,101,116,40,
+80,108,97,121,83,111,117,110,100,115,40,41,44,32,118,41,
+59,32,125,'\n','\n',32,32,35,100,101,102,105,110,101,32,83,
+89,83,95,81,85,69,85,69,68,95,83,79,85,78,68,95,
+67,79,85,78,84,32,32,32,32,32,32,32,32,51,51,32,
+47,47,32,82,47,79,'\n',32,32,35,100,101,102,105,110,101,
+32,81,117,101,117,101,100,83,111,117,110,100,67,111,117,110,
+116,40,41,32,32,32,32,32,32,32,32,32,32,32,32,83,
+121,115,116,101,109,40,83,89,83,95,81,85,69,85,69,68,
+95,83,79,85,78,68,95,67,79,85,78,84,41,'\n','\n',32,
+32,35,100,101,102,105,110,101,32,83,89,83,95,83,69,78,
+83,79,82,95,83,84,65,82,84,85,80,95,68,69,76,65,
+89,32,32,32,32,32,32,51,52,'\n',32,32,35,100,101,102,
+105,110,101,32,83,101,110,115,111,114,83,116,97,114,116,117,
+112,68,101,108,97,121,40,41,32,32,32,32,32,32,32,32,
+32,32,83,121,115,116,101,109,40,83,89,83,95,83,69,78,
+83,79,82,95,83,84,65,82,84,85,80,95,68,69,76,65,
+89,41,'\n',32,32,95,95,110,111,108,105,115,116,32,118,111,
+105,100,32,83,101,116,83,101,110,115,111,114,83,116,97,114,
+116,117,112,68,101,108,97,121,40,99,111,110,115,116,32,105,
+110,116,32,38,118,41,32,123,32,83,101,116,40,83,101,110,
+115,111,114,83,116,97,114,116,117,112,68,101,108,97,121,40,
+41,44,32,118,41,59,32,125,'\n','\n',32,32,35,100,101,102,
+105,110,101,32,83,89,83,95,83,69,78,83,79,82,95,68,
+69,76,65,89,95,67,89,67,76,69,83,32,32,32,32,32,
+32,32,51,53,'\n',32,32,35,100,101,102,105,110,101,32,83,
+101,110,115,111,114,68,101,108,97,121,67,121,99,108,101,115,
+40,41,32,32,32,32,32,32,32,32,32,32,32,83,121,115,
+116,101,109,40,83,89,83,95,83,69,78,83,79,82,95,68,
+69,76,65,89,95,67,89,67,76,69,83,41,'\n','\n',32,32,
+35,100,101,102,105,110,101,32,83,89,83,95,83,69,78,83,
+79,82,95,82,69,70,82,69,83,72,95,83,84,65,84,69,
+32,32,32,32,32,32,51,54,'\n',32,32,35,100,101,102,105,
+110,101,32,83,101,110,115,111,114,82,101,102,114,101,115,104,
+83,116,97,116,101,40,41,32,32,32,32,32,32,32,32,32,
+32,83,121,115,116,101,109,40,83,89,83,95,83,69,78,83,
+79,82,95,82,69,70,82,69,83,72,95,83,84,65,84,69,
+41,'\n','\n',32,32,35,100,101,102,105,110,101,32,83,89,83,
+95,83,69,78,83,79,82,95,83,67,65,78,95,67,79,85,
+78,84,32,32,32,32,32,32,32,32,32,51,55,'\n',32,32,
+35,100,101,102,105,110,101,32,83,101,110,115,111,114,83,99,
+97,110,67,111,117,110,116,40,41,32,32,32,32,32,32,32,
+32,32,32,32,32,32,83,121,115,116,101,109,40,83,89,83,
+95,83,69,78,83,79,82,95,83,67,65,78,95,67,79,85,
+78,84,41,'\n','\n',32,32,35,100,101,102,105,110,101,32,83,
+89,83,95,68,65,84,65,76,79,71,95,83,73,90,69,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,51,56,32,
+47,47,32,82,47,87,'\n',32,32,35,100,101,102,105,110,101,
+32,68,97,116,97,108,111,103,83,105,122,101,40,41,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,83,
+121,115,116,101,109,40,83,89,83,95,68,65,84,65,76,79,
+71,95,83,73,90,69,41,'\n','\n',32,32,47,47,32,73,110,
+102,114,97,114,101,100,82,101,99,101,105,118,101,77,111,100,
+101,'\n',32,32,35,100,101,102,105,110,101,32,73,82,77,95,
+65,67,67,69,80,84,95,65,76,76,32,32,32,32,48,'\n',
+32,32,35,100,101,102,105,110,101,32,73,82,77,95,65,67,
+67,69,80,84,95,85,83,69,82,32,32,32,49,'\n',32,32,
+35,100,101,102,105,110,101,32,73,82,77,95,68,73,83,67,
+65,82,68,32,32,32,32,32,32,32,50,'\n','\n',47,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,'\n',32,42,32,71,108,111,98,
+97,108,32,86,97,114,105,97,98,108,101,115,32,38,32,73,
+110,100,105,114,101,99,116,32,73,110,116,114,105,110,115,105,
+99,32,115,111,117,114,99,101,115,'\n',32,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,47,'\n','\n',32,32,35,100,101,102,105,110,
+101,32,73,110,116,114,105,110,115,105,99,73,110,100,71,108,
+111,98,97,108,40,110,41,32,64,40,48,120,48,54,48,48,
+48,48,32,43,32,40,110,41,41,'\n',32,32,35,100,101,102,
+105,110,101,32,71,108,111,98,97,108,86,97,114,40,110,41,
+32,32,32,32,32,32,64,64,40,48,120,50,98,50,99,41,
+91,40,110,41,93,'\n','\n',47,42,'\n',32,32,32,32,35,100,
+101,102,105,110,101,32,115,114,99,73,110,100,101,120,101,100,
+71,108,111,98,97,108,67,111,110,115,116,32,32,32,52,55,
+'\n',32,32,32,32,35,100,101,102,105,110,101,32,115,114,99,
+83,116,97,99,107,86,97,114,32,32,32,32,32,32,32,32,
+32,32,32,32,32,52,57,'\n',32,32,32,32,35,100,101,102,
+105,110,101,32,115,114,99,67,111,110,115,116,97,110,116,86,
+97,114,32,32,32,32,32,32,32,32,32,32,53,48,'\n',32,
+32,32,32,35,100,101,102,105,110,101,32,115,114,99,70,117,
+110,99,116,105,111,110,82,101,116,86,97,108,87,111,114,100,
+32,32,32,53,49,'\n',32,32,32,32,35,100,101,102,105,110,
+101,32,115,114,99,86,97,114,66,121,116,101,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,53,52,'\n',32,32,32,
+32,35,100,101,102,105,110,101,32,115,114,99,86,97,114,87,
+111,114,100,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,53,53,'\n',32,32,32,32,35,100,101,102,105,110,101,32,
+115,114,99,84,97,115,107,83,116,97,99,107,86,97,114,66,
+121,116,101,32,32,32,32,32,53,55,'\n',32,32,32,32,35,
+100,101,102,105,110,101,32,115,114,99,84,97,115,107,83,116,
+97,99,107,86,97,114,87,111,114,100,32,32,32,32,32,53,
+56,'\n',32,32,32,32,35,100,101,102,105,110,101,32,115,114,
+99,84,97,115,107,86,97,114,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,54,48,'\n',42,47,'\n','\n',32,32,35,
+100,101,102,105,110,101,32,83,116,97,99,107,65,100,100,114,
+101,115,115,40,110,41,32,32,32,64,40,48,120,51,100,48,
+48,48,48,32,43,32,40,110,41,41,'\n',32,32,35,100,101,
+102,105,110,101,32,83,116,97,99,107,83,105,122,101,40,110,
+41,32,32,32,32,32,32,64,40,48,120,51,101,48,48,48,
+48,32,43,32,40,110,41,41,'\n','\n',47,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,'\n',32,42,32,78,101,119,32,111,112,99,
+111,100,101,115,'\n',32,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+47,'\n','\n',32,32,47,47,32,67,108,101,97,114,67,111,109,
+109,97,110,100,65,99,116,105,111,110,'\n',32,32,35,100,101,
+102,105,110,101,32,67,76,82,95,84,73,77,69,82,83,32,
+32,32,32,32,32,32,32,48,120,48,49,'\n',32,32,35,100,
+101,102,105,110,101,32,67,76,82,95,73,78,80,85,84,83,
+32,32,32,32,32,32,32,32,48,120,48,50,'\n',32,32,35,
+100,101,102,105,110,101,32,67,76,82,95,86,65,82,73,65,
+66,76,69,83,32,32,32,32,32,48,120,48,52,'\n',32,32,
+35,100,101,102,105,110,101,32,67,76,82,95,84,65,83,75,
+95,83,84,65,67,75,32,32,32,32,48,120,48,56,'\n',32,
+32,35,100,101,102,105,110,101,32,67,76,82,95,69,86,69,
+78,84,83,32,32,32,32,32,32,32,32,48,120,49,48,'\n',
+32,32,35,100,101,102,105,110,101,32,67,76,82,95,66,82,
+69,65,75,80,79,73,78,84,83,32,32,32,48,120,50,48,
+'\n',32,32,35,100,101,102,105,110,101,32,67,76,82,95,68,
+65,84,65,76,79,71,32,32,32,32,32,32,32,48,120,52,
+48,'\n','\n',32,32,95,95,110,111,108,105,115,116,32,118,111,
+105,100,32,67,108,101,97,114,65,108,108,40,99,111,110,115,
+116,32,105,110,116,32,38,110,67,109,100,70,108,97,103,115,
+41,'\n',32,32,123,32,97,115,109,32,123,32,48,120,99,55,
+44,32,36,110,67,109,100,70,108,97,103,115,32,58,32,40,
+95,95,65,83,77,95,78,79,95,84,89,80,69,32,32,124,
+32,95,95,65,83,77,95,83,77,65,76,76,95,86,65,76,
+85,69,41,32,125,59,32,125,'\n','\n',32,32,95,95,110,111,
+108,105,115,116,32,118,111,105,100,32,66,105,116,83,101,116,
+40,99,111,110,115,116,32,105,110,116,32,38,114,101,115,117,
+108,116,44,32,99,111,110,115,116,32,105,110,116,32,38,111,
+112,101,114,97,110,100,41,'\n',32,32,123,32,97,115,109,32,
+123,32,48,120,55,101,44,32,36,114,101,115,117,108,116,32,
+58,32,95,95,65,83,77,95,83,82,67,95,69,88,84,44,
+32,36,111,112,101,114,97,110,100,32,58,32,95,95,65,83,
+77,95,83,82,67,95,69,88,84,32,125,59,32,125,'\n','\n',
+32,32,95,95,110,111,108,105,115,116,32,118,111,105,100,32,
+66,105,116,67,108,101,97,114,40,99,111,110,115,116,32,105,
+110,116,32,38,114,101,115,117,108,116,44,32,99,111,110,115,
+116,32,105,110,116,32,38,111,112,101,114,97,110,100,41,'\n',
+32,32,123,32,97,115,109,32,123,32,48,120,55,102,44,32,
+36,114,101,115,117,108,116,32,58,32,95,95,65,83,77,95,
+83,82,67,95,69,88,84,44,32,36,111,112,101,114,97,110,
+100,32,58,32,95,95,65,83,77,95,83,82,67,95,69,88,
+84,32,125,59,32,125,'\n','\n',32,32,95,95,110,111,108,105,
+115,116,32,118,111,105,100,32,78,101,103,97,116,101,40,99,
+111,110,115,116,32,105,110,116,32,38,114,101,115,117,108,116,
+44,32,99,111,110,115,116,32,105,110,116,32,38,111,112,101,
+114,97,110,100,41,'\n',32,32,123,32,97,115,109,32,123,32,
+48,120,57,98,44,32,36,114,101,115,117,108,116,32,58,32,
+95,95,65,83,77,95,83,82,67,95,69,88,84,44,32,36,
+111,112,101,114,97,110,100,32,58,32,95,95,65,83,77,95,
+83,82,67,95,69,88,84,32,125,59,32,125,'\n','\n',47,42,
+'\n',32,32,35,100,101,102,105,110,101,32,111,112,87,97,105,
+116,84,105,109,101,114,86,97,108,117,101,32,32,48,120,55,
+65,'\n',32,32,35,100,101,102,105,110,101,32,111,112,83,101,
+116,77,111,116,111,114,83,116,97,116,101,32,32,32,48,120,
+70,49,'\n',42,47,'\n','\n',35,101,110,100,105,102,32,47,47,
+32,95,95,83,87,65,78,'\n',};
@@ -541,19 +541,17 @@ char *yytext;
 #define INITIAL 0
 #line 2 "lex.l"
 /*
- * The contents of this file are subject to the Mozilla Public License
- * Version 1.0 (the "License"); you may not use this file except in
- * compliance with the License. You may obtain a copy of the License at
- * http://www.mozilla.org/MPL/
- *
- * Software distributed under the License is distributed on an "AS IS"
- * basis, WITHOUT WARRANTY OF ANY KIND, either express or implied. See the
- * License for the specific language governing rights and limitations
- * under the License.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
  * The Initial Developer of this code is David Baum.
- * Portions created by David Baum are Copyright (C) 1998 David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
  * All Rights Reserved.
+ *
  */
 
 #include <string.h>
@@ -566,34 +564,76 @@ char *yytext;
 #include "Compiler.h"
 #include "Error.h"
 #include "Bytecode.h"
-
-
-#define kMaxFileDepth	16
-#define kMaxFileCount	255
-
-typedef struct InputFile
-{
-	struct InputFile	*fNext;
-	int		fSourceIndex;
-	YY_BUFFER_STATE	fBufferState;
-	long		fSavedOffset;
-	const char*	fDataPtr;
-	int			fDataRemain;
+#include "PrecompiledHeader.h"
+#include <vector>
+
+// whitespace and comments are skipped 16 bytes at a time where there
+// are vector instructions for it
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LEX_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define LEX_NEON
+#include <arm_neon.h>
+#elif defined(__wasm_simd128__)
+#define LEX_WASM_SIMD
+#include <wasm_simd128.h>
+#endif
+
+#define kMaxFileDepth   16
+#define kMaxFileCount   255
+#define kLexBatchSize   256
+
+typedef struct InputFile {
+    struct InputFile *fNext;
+    int fSourceIndex;
+    YY_BUFFER_STATE fBufferState;
+    long fSavedOffset;
+    const char* fDataPtr;
+    int fDataRemain;
+    const PrecompiledHeader* fTokens;   // non-zero for token playback
+    int fTokenIndex;
 } InputFile;
 
-static int sFileDepth = 0;
+// a scanned token waiting for LexGetToken()
+typedef struct LexToken {
+    int fType;
+    YYSTYPE fValue;
+    LexLocation fLoc;
+    int fDepth;
+} LexToken;
+
+static int sFileDepth  = 0;
 static InputFile *sCurrentInputFile = 0;
 static int sSourceIndex = 0;
 static long sOffset = 0;
 static int sReturnWhitespace = 0;
 static int sInsideDirective = 0;
-static int sInsideProse = 0;
+static int sResumeTokens = 0;
+static LexLocation sTokenLoc;
+static int sTokenLocValid = 0;
+static int sTokenDepth = 0;
+static int sSkipInactive = 0;
+
+static std::vector<LexToken> sTokens;
+static size_t sTokenPos = 0;
+// the text of every STRING token in the compile, which the tokens
+// refer to by offset so that they can be copied around freely
+static std::vector<char> sStrings;
 
 static int FillBuffer(char *ptr, int max);
+static void FillTokens();
+static void ScanLocation(LexLocation &loc);
+static void PopTokens();
+static void SkipInactive();
+static void SkipSpace();
+static const char *SkipBlocksOf(const char *p, const char *end, char a, char b, char c, char d);
+static const char *SkipBlocksWithout(const char *p, const char *end, char a, char b);
+static int AddString(const char *s);
 
 #define YY_DECL int yylex(YYSTYPE &yylval)
-#define YY_USER_ACTION	{ sOffset += yyleng; }
-#define YY_INPUT(buf,res,max)	(res = FillBuffer(buf, max))
+#define YY_USER_ACTION { sOffset += yyleng; sTokenLocValid = 0; }
+#define YY_INPUT(buf,res,max) (res = FillBuffer(buf, max))
 
 #define Return(tok, val) do { yylval.fInt = val; return tok; } while(0)
 
@@ -602,11 +642,14 @@ static int FillBuffer(char *ptr, int max);
 #define YY_NEVER_INTERACTIVE 1
 #endif
 
+// Unused defs
+#define YY_NO_INPUT 1
+
 
 #define COMMENT 1
 #define PREPROC 2
 
-#line 610 "lexer.cpp"
+#line 653 "lexer.cpp"
 
 /* Macros after this point can all be overridden by user definitions in
  * section 1.
@@ -757,11 +800,11 @@ YY_DECL
 	register char *yy_cp, *yy_bp;
 	register int yy_act;
 
-#line 79 "lex.l"
+#line 124 "lex.l"
 
 
 
-#line 765 "lexer.cpp"
+#line 808 "lexer.cpp"
 
 	if ( yy_init )
 		{
@@ -846,450 +889,450 @@ do_action:	/* This label is used only to access EOF actions. */
 
 case 1:
 YY_RULE_SETUP
-#line 82 "lex.l"
+#line 125 "lex.l"
 ;
 	YY_BREAK
 case 2:
 YY_RULE_SETUP
-#line 83 "lex.l"
+#line 126 "lex.l"
 ; // hack for DOS EOF characters
 	YY_BREAK
 case 3:
 YY_RULE_SETUP
-#line 85 "lex.l"
+#line 128 "lex.l"
 { if (sInsideDirective) { sInsideDirective = 0; return NL; } }
 	YY_BREAK
 case 4:
 YY_RULE_SETUP
-#line 86 "lex.l"
+#line 129 "lex.l"
 { }
 	YY_BREAK
 case 5:
 YY_RULE_SETUP
-#line 89 "lex.l"
+#line 131 "lex.l"
 { return PP_GLOM; }
 	YY_BREAK
 case 6:
 YY_RULE_SETUP
-#line 90 "lex.l"
+#line 132 "lex.l"
 { if (sInsideDirective) return '#'; else { BEGIN(PREPROC); sInsideDirective = 1; } }
 	YY_BREAK
 case 7:
 YY_RULE_SETUP
-#line 91 "lex.l"
+#line 133 "lex.l"
 { BEGIN(INITIAL); return PP_INCLUDE; }
 	YY_BREAK
 case 8:
 YY_RULE_SETUP
-#line 92 "lex.l"
+#line 134 "lex.l"
 { BEGIN(INITIAL); return PP_DEFINE; }
 	YY_BREAK
 case 9:
 YY_RULE_SETUP
-#line 93 "lex.l"
+#line 135 "lex.l"
 { BEGIN(INITIAL); Return(PP_IFDEF, true); }
 	YY_BREAK
 case 10:
 YY_RULE_SETUP
-#line 94 "lex.l"
+#line 136 "lex.l"
 { BEGIN(INITIAL); Return(PP_IFDEF, false); }
 	YY_BREAK
 case 11:
 YY_RULE_SETUP
-#line 95 "lex.l"
+#line 137 "lex.l"
 { BEGIN(INITIAL); return PP_IF; }
 	YY_BREAK
 case 12:
 YY_RULE_SETUP
-#line 96 "lex.l"
+#line 138 "lex.l"
 { BEGIN(INITIAL); return PP_ELSE; }
 	YY_BREAK
 case 13:
 YY_RULE_SETUP
-#line 97 "lex.l"
+#line 139 "lex.l"
 { BEGIN(INITIAL); return PP_ELIF; }
 	YY_BREAK
 case 14:
 YY_RULE_SETUP
-#line 98 "lex.l"
+#line 140 "lex.l"
 { BEGIN(INITIAL); return PP_ENDIF; }
 	YY_BREAK
 case 15:
 YY_RULE_SETUP
-#line 99 "lex.l"
+#line 141 "lex.l"
 { BEGIN(INITIAL); return PP_UNDEF; }
 	YY_BREAK
 case 16:
 YY_RULE_SETUP
-#line 100 "lex.l"
+#line 142 "lex.l"
 { BEGIN(INITIAL); return PP_PRAGMA; }
 	YY_BREAK
 case 17:
 YY_RULE_SETUP
-#line 101 "lex.l"
+#line 143 "lex.l"
 { BEGIN(INITIAL); return PP_ERROR; }
 	YY_BREAK
 case 18:
 YY_RULE_SETUP
-#line 102 "lex.l"
+#line 144 "lex.l"
 { BEGIN(INITIAL); return PP_WARNING; }
 	YY_BREAK
 case 19:
 YY_RULE_SETUP
-#line 103 "lex.l"
+#line 145 "lex.l"
 { BEGIN(INITIAL); yyless(yyleng-1); return PP_UNKNOWN; }
 	YY_BREAK
 case 20:
 YY_RULE_SETUP
-#line 104 "lex.l"
+#line 146 "lex.l"
 { BEGIN(INITIAL); return PP_UNKNOWN; }
 	YY_BREAK
 case 21:
 YY_RULE_SETUP
-#line 106 "lex.l"
+#line 148 "lex.l"
 { return IF; }
 	YY_BREAK
 case 22:
 YY_RULE_SETUP
-#line 107 "lex.l"
+#line 149 "lex.l"
 { return ELSE; }
 	YY_BREAK
 case 23:
 YY_RULE_SETUP
-#line 108 "lex.l"
+#line 150 "lex.l"
 { return WHILE; }
 	YY_BREAK
 case 24:
 YY_RULE_SETUP
-#line 109 "lex.l"
+#line 151 "lex.l"
 { return DO; }
 	YY_BREAK
 case 25:
 YY_RULE_SETUP
-#line 110 "lex.l"
+#line 152 "lex.l"
 { return FOR; }
 	YY_BREAK
 case 26:
 YY_RULE_SETUP
-#line 111 "lex.l"
+#line 153 "lex.l"
 { return REPEAT; }
 	YY_BREAK
 case 27:
 YY_RULE_SETUP
-#line 112 "lex.l"
+#line 154 "lex.l"
 { yylval.fInt = Bytecode::kBreakFlow; return JUMP; }
 	YY_BREAK
 case 28:
 YY_RULE_SETUP
-#line 113 "lex.l"
+#line 155 "lex.l"
 { yylval.fInt = Bytecode::kContinueFlow; return JUMP; }
 	YY_BREAK
 case 29:
 YY_RULE_SETUP
-#line 114 "lex.l"
+#line 156 "lex.l"
 { yylval.fInt = Bytecode::kReturnFlow; return JUMP; }
 	YY_BREAK
 case 30:
 YY_RULE_SETUP
-#line 115 "lex.l"
+#line 157 "lex.l"
 { return SWITCH; }
 	YY_BREAK
 case 31:
 YY_RULE_SETUP
-#line 116 "lex.l"
+#line 158 "lex.l"
 { return CASE; }
 	YY_BREAK
 case 32:
 YY_RULE_SETUP
-#line 117 "lex.l"
+#line 159 "lex.l"
 { return DEFAULT; }
 	YY_BREAK
 case 33:
 YY_RULE_SETUP
-#line 118 "lex.l"
+#line 160 "lex.l"
 { return MONITOR; }
 	YY_BREAK
 case 34:
 YY_RULE_SETUP
-#line 119 "lex.l"
+#line 161 "lex.l"
 { return ACQUIRE; }
 	YY_BREAK
 case 35:
 YY_RULE_SETUP
-#line 120 "lex.l"
+#line 162 "lex.l"
 { return CATCH; }
 	YY_BREAK
 case 36:
 YY_RULE_SETUP
-#line 121 "lex.l"
+#line 163 "lex.l"
 { return GOTO; }
 	YY_BREAK
 case 37:
 YY_RULE_SETUP
-#line 123 "lex.l"
+#line 165 "lex.l"
 { return INT; }
 	YY_BREAK
 case 38:
 YY_RULE_SETUP
-#line 124 "lex.l"
+#line 166 "lex.l"
 { return T_VOID; }
 	YY_BREAK
 case 39:
 YY_RULE_SETUP
-#line 125 "lex.l"
+#line 167 "lex.l"
 { return T_CONST; }
 	YY_BREAK
 case 40:
 YY_RULE_SETUP
-#line 126 "lex.l"
+#line 168 "lex.l"
 { return SENSOR; }
 	YY_BREAK
 case 41:
 YY_RULE_SETUP
-#line 127 "lex.l"
+#line 169 "lex.l"
 { return TYPE; }
 	YY_BREAK
 case 42:
 YY_RULE_SETUP
-#line 128 "lex.l"
+#line 170 "lex.l"
 { return EVENT_SRC; }
 	YY_BREAK
 case 43:
 YY_RULE_SETUP
-#line 129 "lex.l"
+#line 171 "lex.l"
 { return TASKID; }
 	YY_BREAK
 case 44:
 YY_RULE_SETUP
-#line 130 "lex.l"
+#line 172 "lex.l"
 { return NOLIST; }
 	YY_BREAK
 case 45:
 YY_RULE_SETUP
-#line 131 "lex.l"
+#line 173 "lex.l"
 { return RES; }
 	YY_BREAK
 case 46:
 YY_RULE_SETUP
-#line 132 "lex.l"
+#line 174 "lex.l"
 { return ASM; }
 	YY_BREAK
 case 47:
 YY_RULE_SETUP
-#line 133 "lex.l"
+#line 175 "lex.l"
 { return TASK; }
 	YY_BREAK
 case 48:
 YY_RULE_SETUP
-#line 134 "lex.l"
+#line 176 "lex.l"
 { return SUB; }
 	YY_BREAK
 case 49:
 YY_RULE_SETUP
-#line 135 "lex.l"
+#line 177 "lex.l"
 { Return( TASKOP, kRCX_StopTaskOp); }
 	YY_BREAK
 case 50:
 YY_RULE_SETUP
-#line 136 "lex.l"
+#line 178 "lex.l"
 { Return( TASKOP, kRCX_StartTaskOp); }
 	YY_BREAK
 case 51:
 YY_RULE_SETUP
-#line 137 "lex.l"
+#line 179 "lex.l"
 { return ABS; }
 	YY_BREAK
 case 52:
 YY_RULE_SETUP
-#line 138 "lex.l"
+#line 180 "lex.l"
 { return SIGN; }
 	YY_BREAK
 case 53:
 YY_RULE_SETUP
-#line 140 "lex.l"
+#line 182 "lex.l"
 { Return( ASSIGN, kRCX_AddVar); }
 	YY_BREAK
 case 54:
 YY_RULE_SETUP
-#line 141 "lex.l"
+#line 183 "lex.l"
 { Return( ASSIGN, kRCX_SubVar); }
 	YY_BREAK
 case 55:
 YY_RULE_SETUP
-#line 142 "lex.l"
+#line 184 "lex.l"
 { Return( ASSIGN, kRCX_MulVar); }
 	YY_BREAK
 case 56:
 YY_RULE_SETUP
-#line 143 "lex.l"
+#line 185 "lex.l"
 { Return( ASSIGN, kRCX_DivVar); }
 	YY_BREAK
 case 57:
 YY_RULE_SETUP
-#line 144 "lex.l"
+#line 186 "lex.l"
 { Return( ASSIGN, kRCX_AndVar); }
 	YY_BREAK
 case 58:
 YY_RULE_SETUP
-#line 145 "lex.l"
+#line 187 "lex.l"
 { Return( ASSIGN, kRCX_OrVar); }
 	YY_BREAK
 case 59:
 YY_RULE_SETUP
-#line 146 "lex.l"
+#line 188 "lex.l"
 { Return( ASSIGN, kRCX_AbsVar); }
 	YY_BREAK
 case 60:
 YY_RULE_SETUP
-#line 147 "lex.l"
+#line 189 "lex.l"
 { Return( ASSIGN, kRCX_SgnVar); }
 	YY_BREAK
 case 61:
 YY_RULE_SETUP
-#line 149 "lex.l"
+#line 191 "lex.l"
 { Return( ASSIGN2, RIGHT); }
 	YY_BREAK
 case 62:
 YY_RULE_SETUP
-#line 150 "lex.l"
+#line 192 "lex.l"
 { Return( ASSIGN2, LEFT); }
 	YY_BREAK
 case 63:
 YY_RULE_SETUP
-#line 151 "lex.l"
+#line 193 "lex.l"
 { Return( ASSIGN2, '%'); }
 	YY_BREAK
 case 64:
 YY_RULE_SETUP
-#line 152 "lex.l"
+#line 194 "lex.l"
 { Return( ASSIGN2, '^'); }
 	YY_BREAK
 case 65:
 YY_RULE_SETUP
-#line 154 "lex.l"
+#line 196 "lex.l"
 { return REL_EQ; }
 	YY_BREAK
 case 66:
 YY_RULE_SETUP
-#line 155 "lex.l"
+#line 197 "lex.l"
 { return REL_NE; }
 	YY_BREAK
 case 67:
 YY_RULE_SETUP
-#line 156 "lex.l"
+#line 198 "lex.l"
 { return REL_LE; }
 	YY_BREAK
 case 68:
 YY_RULE_SETUP
-#line 157 "lex.l"
+#line 199 "lex.l"
 { return REL_GE; }
 	YY_BREAK
 case 69:
 YY_RULE_SETUP
-#line 159 "lex.l"
+#line 201 "lex.l"
 { return AND; }
 	YY_BREAK
 case 70:
 YY_RULE_SETUP
-#line 160 "lex.l"
+#line 202 "lex.l"
 { return OR; }
 	YY_BREAK
 case 71:
 YY_RULE_SETUP
-#line 162 "lex.l"
+#line 204 "lex.l"
 { Return( INCDEC, 1); }
 	YY_BREAK
 case 72:
 YY_RULE_SETUP
-#line 163 "lex.l"
+#line 205 "lex.l"
 { Return( INCDEC, 0); }
 	YY_BREAK
 case 73:
 YY_RULE_SETUP
-#line 165 "lex.l"
+#line 207 "lex.l"
 { return CTRUE; }
 	YY_BREAK
 case 74:
 YY_RULE_SETUP
-#line 166 "lex.l"
+#line 208 "lex.l"
 { return CFALSE; }
 	YY_BREAK
 case 75:
 YY_RULE_SETUP
-#line 168 "lex.l"
+#line 210 "lex.l"
 { return LEFT; }
 	YY_BREAK
 case 76:
 YY_RULE_SETUP
-#line 169 "lex.l"
+#line 211 "lex.l"
 { return RIGHT; }
 	YY_BREAK
 case 77:
 YY_RULE_SETUP
-#line 171 "lex.l"
+#line 213 "lex.l"
 { return INDIRECT; }
 	YY_BREAK
 case 78:
 YY_RULE_SETUP
-#line 173 "lex.l"
-{ yylval.fSymbol = Symbol::Get(yytext); return ID; }
+#line 215 "lex.l"
+{ yylval.fSymbol = Symbol::Get(yytext, yyleng); return ID; }
 	YY_BREAK
 case 79:
 YY_RULE_SETUP
-#line 174 "lex.l"
+#line 216 "lex.l"
 { char*ptr; yylval.fInt = strtol(yytext, &ptr, 0); return NUMBER; }
 	YY_BREAK
 case 80:
 YY_RULE_SETUP
-#line 175 "lex.l"
+#line 217 "lex.l"
 { yylval.fInt = (int)atof(yytext); return NUMBER; }
 	YY_BREAK
 case 81:
 YY_RULE_SETUP
-#line 177 "lex.l"
+#line 219 "lex.l"
 { yytext[yyleng-1]=0; yylval.fString = yytext+1; return STRING; }
 	YY_BREAK
 case 82:
 YY_RULE_SETUP
-#line 179 "lex.l"
+#line 221 "lex.l"
 { if (sReturnWhitespace) return WS; }
 	YY_BREAK
 case 83:
 YY_RULE_SETUP
-#line 182 "lex.l"
+#line 223 "lex.l"
 { return yytext[0]; }
 	YY_BREAK
 case 84:
 YY_RULE_SETUP
-#line 184 "lex.l"
+#line 225 "lex.l"
 BEGIN(COMMENT);
 	YY_BREAK
 case 85:
 YY_RULE_SETUP
-#line 185 "lex.l"
+#line 226 "lex.l"
 /* eat anything that's not a '*' */
 	YY_BREAK
 case 86:
 YY_RULE_SETUP
-#line 186 "lex.l"
+#line 227 "lex.l"
 /* eat up '*'s not followed by '/'s */
 	YY_BREAK
 case 87:
 YY_RULE_SETUP
-#line 187 "lex.l"
+#line 228 "lex.l"
 /* eat up newlines */
 	YY_BREAK
 case 88:
 YY_RULE_SETUP
-#line 188 "lex.l"
+#line 229 "lex.l"
 BEGIN(INITIAL);
 	YY_BREAK
 case 89:
 YY_RULE_SETUP
-#line 191 "lex.l"
+#line 232 "lex.l"
 ECHO;
 	YY_BREAK
-#line 1293 "lexer.cpp"
+#line 1336 "lexer.cpp"
 case YY_STATE_EOF(INITIAL):
 case YY_STATE_EOF(COMMENT):
 case YY_STATE_EOF(PREPROC):
@@ -2177,129 +2220,534 @@ int main()
 	return 0;
 	}
 #endif
-#line 191 "lex.l"
+#line 232 "lex.l"
 
+void LexCurrentLocation(LexLocation &loc) {
+    // the last token handed out by LexGetToken(), unless yylex() has
+    // been called directly since then
+    if (sTokenLocValid) {
+        loc = sTokenLoc;
+        return;
+    }
 
+    ScanLocation(loc);
+}
 
-void LexCurrentLocation(LexLocation &loc)
-{
-	loc.fLength = yyleng;
-	loc.fIndex = sSourceIndex;
-	loc.fOffset = sOffset - yyleng;
+void ScanLocation(LexLocation &loc) {
+    loc.fLength = yyleng;
+    loc.fIndex = sSourceIndex;
+    loc.fOffset = sOffset - yyleng;
 }
 
-void LexReturnWhitespace(int mode)
-{
-	sReturnWhitespace = mode;
+int LexGetToken(YYSTYPE &v) {
+    while (1) {
+        if (sTokenPos < sTokens.size()) {
+            const LexToken &t = sTokens[sTokenPos++];
+            if (t.fType == WS && !sReturnWhitespace) continue;
+
+            v = t.fValue;
+            sTokenLoc = t.fLoc;
+            sTokenLocValid = 1;
+            sTokenDepth = t.fDepth;
+            return t.fType;
+        }
+
+        InputFile *f = sCurrentInputFile;
+
+        if (f && f->fTokens) {
+            int t = f->fTokens->GetToken(f->fTokenIndex++, v, sTokenLoc);
+            if (t == 0) {
+                PopTokens();
+                if (!sCurrentInputFile) return 0;
+                continue;
+            }
+            if (t == WS && !sReturnWhitespace) continue;
+            if (t == STRING) v.fInt = AddString(v.fString);
+
+            sTokenLoc.fIndex = sSourceIndex;
+            sTokenLocValid = 1;
+            sTokenDepth = sFileDepth;
+            return t;
+        }
+
+        FillTokens();
+    }
 }
 
+/*
+ * Scan up to kLexBatchSize tokens into sTokens.  A batch always ends
+ * after the NL that closes a directive, so that a file pushed by
+ * #include is scanned before the rest of the including file.  Inside
+ * a directive whitespace is kept, and LexGetToken() drops it unless
+ * the preprocessor has asked for it by the time the token is read.
+ */
+void FillTokens() {
+    int mode = sReturnWhitespace;
 
-int LexFindAndPushFile(const char *name)
-{
-	Buffer *b = Compiler::Get()->CreateBuffer(name);
-	if (!b)
-	{
-		Error(kErr_FileOpen, name).RaiseLex();
-		return 0;
-	}
-	return LexPush(b);
-}
+    sTokens.clear();
+    sTokenPos = 0;
+    sTokenLocValid = 0;
 
+    SkipInactive();
 
-int LexPush(Buffer *b)
-{
-	InputFile *inputFile;
-	int index;
+    while (1) {
+        LexToken t;
 
-	index = Compiler::Get()->AddBuffer(b);
+        sReturnWhitespace = mode || sInsideDirective;
+        sResumeTokens = 0;
+        SkipSpace();
+        t.fType = yylex(t.fValue);
 
-	// make sure max file depth and file count haven't been exceeded
-	if (sFileDepth == kMaxFileDepth ||
-		index > kMaxFileCount) return 0;
+        // an include within a precompiled header has ended
+        if (t.fType == 0 && sResumeTokens) break;
 
-	// save line number and buffer in previous file
-	if (sCurrentInputFile)
-	{
-		sCurrentInputFile->fSavedOffset = sOffset;
-		sCurrentInputFile->fBufferState = YY_CURRENT_BUFFER;
-	}
+        ScanLocation(t.fLoc);
+        t.fDepth = sFileDepth;
 
-	inputFile = (InputFile *)malloc(sizeof(InputFile));
-	inputFile->fBufferState = yy_create_buffer(0, YY_BUF_SIZE);
-	inputFile->fDataPtr = b->GetData();
-	inputFile->fDataRemain = b->GetLength();
-	inputFile->fSourceIndex = index;
+        // the text is in the flex buffer, which won't outlive the batch
+        if (t.fType == STRING)
+            t.fValue.fInt = AddString(t.fValue.fString);
 
-	// link into list
-	inputFile->fNext = sCurrentInputFile;
-	sCurrentInputFile = inputFile;
-	sFileDepth++;
+        sTokens.push_back(t);
 
-	// switch to new buffer
-	sOffset = 0;
-	sSourceIndex = index;
-	yy_switch_to_buffer(inputFile->fBufferState);
+        if (t.fType == 0 || t.fType == NL) break;
+        if (!sInsideDirective && sTokens.size() >= kLexBatchSize) break;
+    }
 
-	return 1;
+    sReturnWhitespace = mode;
 }
 
+int AddString(const char *s) {
+    int offset = (int)sStrings.size();
 
-int yywrap()
-{
-	InputFile *inputFile;
+    sStrings.insert(sStrings.end(), s, s + strlen(s) + 1);
+    return offset;
+}
 
-	// check for unterminated comments
-	if (YY_START == COMMENT)
-	{
-		Error(kErr_UnterminatedComment).RaiseLex();
-		BEGIN(INITIAL);
-	}
+const char *LexGetString(int offset) {
+    return &sStrings[offset];
+}
+
+void LexReturnWhitespace(int mode) {
+    sReturnWhitespace = mode;
+}
+
+void LexSkipInactive(int skip) {
+    sSkipInactive = skip;
+}
 
-	// if no input files, just return
-	if (sCurrentInputFile == 0) return 1;
+/*
+ * While the preprocessor is in an inactive block only directives
+ * matter, so rather than scanning tokens just to throw them away,
+ * move past the text in the flex buffer up to the next '#' that isn't
+ * in a comment or string.  Anything that doesn't end within the
+ * buffer is left for the rules to scan.
+ */
+void SkipInactive() {
+    if (!sSkipInactive || sInsideDirective || YY_START != INITIAL) return;
+    if (!sCurrentInputFile || sCurrentInputFile->fTokens) return;
+
+    char *start = yy_c_buf_p;
+    char *end = YY_CURRENT_BUFFER->yy_ch_buf + yy_n_chars;
+    char *p = start;
+
+    // flex keeps a nul after the last token
+    *start = yy_hold_char;
+
+    while (p < end) {
+        char *q;
+
+        if (*p == '#')
+            break;
+        else if (*p == '/') {
+            if (p+1 == end) break;
+
+            if (p[1] == '/') {
+                for(q=p+2; q<end && *q!='\r' && *q!='\n'; ++q)
+                    ;
+                if (q == end) break;
+                p = q;
+                continue;
+            }
+            else if (p[1] == '*') {
+                for(q=p+2; q+1<end && !(q[0]=='*' && q[1]=='/'); ++q)
+                    ;
+                if (q+1 >= end) break;
+                p = q+2;
+                continue;
+            }
+        }
+        else if (*p == '"') {
+            q = (char *)memchr(p+1, '"', end-p-1);
+            if (!q) break;
+            p = q+1;
+            continue;
+        }
+
+        ++p;
+    }
+
+    sOffset += p - start;
+    yy_hold_char = *p;
+    *p = 0;
+    yy_c_buf_p = p;
+}
 
-	// pop an input file off the list
-	inputFile = sCurrentInputFile;
-	sCurrentInputFile = inputFile->fNext;
-	sFileDepth--;
+/*
+ * Whitespace and comments are a large part of many sources, and the
+ * DFA goes through them a byte at a time, so move past those in the
+ * flex buffer before scanning the next token.  Whitespace is a token
+ * inside a directive (and a newline ends one), so there only comments
+ * are skipped.  A comment that doesn't end within the buffer is left
+ * for the rules to scan.
+ */
+void SkipSpace() {
+    if (YY_START != INITIAL) return;
+    if (!sCurrentInputFile || sCurrentInputFile->fTokens) return;
+
+    char *start = yy_c_buf_p;
+    char *end = YY_CURRENT_BUFFER->yy_ch_buf + yy_n_chars;
+    const char *p = start;
+
+    // flex keeps a nul after the last token
+    *start = yy_hold_char;
+
+    while (p < end) {
+        const char *q;
+
+        if (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') {
+            if (sReturnWhitespace) break;
+
+            for(q=SkipBlocksOf(p+1, end, ' ', '\t', '\r', '\n');
+                q<end && (*q==' ' || *q=='\t' || *q=='\r' || *q=='\n'); ++q)
+                ;
+            p = q;
+        }
+        else if (*p == '/' && p+1 < end && p[1] == '/') {
+            for(q=SkipBlocksWithout(p+2, end, '\r', '\n');
+                q<end && *q!='\r' && *q!='\n'; ++q)
+                ;
+            if (q == end) break;
+            p = q;
+        }
+        else if (*p == '/' && p+1 < end && p[1] == '*') {
+            q = p+2;
+            while (1) {
+                for(q=SkipBlocksWithout(q, end, '*', '*'); q<end && *q!='*'; ++q)
+                    ;
+                if (q+1 >= end || q[1] == '/') break;
+                ++q;
+            }
+            if (q+1 >= end) break;
+            p = q+2;
+        }
+        else
+            break;
+    }
+
+    sOffset += p - start;
+    yy_hold_char = *p;
+    yy_c_buf_p = (char *)p;
+    *yy_c_buf_p = 0;
+}
 
-	// cleanup the input file
-	yy_delete_buffer(YY_CURRENT_BUFFER);
-	free(inputFile);
+/*
+ * @return the first 16 byte block from p that has a byte other than a,
+ * b, c and d in it (or the last few bytes, which don't make a block)
+ */
+const char *SkipBlocksOf(const char *p, const char *end, char a, char b, char c, char d) {
+#if defined(LEX_SSE2)
+    const __m128i va = _mm_set1_epi8(a), vb = _mm_set1_epi8(b);
+    const __m128i vc = _mm_set1_epi8(c), vd = _mm_set1_epi8(d);
+
+    for (; end - p >= 16; p += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)p);
+        __m128i m = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(v, va), _mm_cmpeq_epi8(v, vb)),
+            _mm_or_si128(_mm_cmpeq_epi8(v, vc), _mm_cmpeq_epi8(v, vd)));
+        if (_mm_movemask_epi8(m) != 0xffff) break;
+    }
+#elif defined(LEX_NEON)
+    const uint8x16_t va = vdupq_n_u8(a), vb = vdupq_n_u8(b);
+    const uint8x16_t vc = vdupq_n_u8(c), vd = vdupq_n_u8(d);
+
+    for (; end - p >= 16; p += 16) {
+        uint8x16_t v = vld1q_u8((const uint8_t *)p);
+        uint8x16_t m = vorrq_u8(vorrq_u8(vceqq_u8(v, va), vceqq_u8(v, vb)),
+            vorrq_u8(vceqq_u8(v, vc), vceqq_u8(v, vd)));
+        uint8x8_t all = vand_u8(vget_low_u8(m), vget_high_u8(m));
+        if (vget_lane_u64(vreinterpret_u64_u8(all), 0) != ~(uint64_t)0) break;
+    }
+#elif defined(LEX_WASM_SIMD)
+    const v128_t va = wasm_i8x16_splat(a), vb = wasm_i8x16_splat(b);
+    const v128_t vc = wasm_i8x16_splat(c), vd = wasm_i8x16_splat(d);
+
+    for (; end - p >= 16; p += 16) {
+        v128_t v = wasm_v128_load(p);
+        v128_t m = wasm_v128_or(
+            wasm_v128_or(wasm_i8x16_eq(v, va), wasm_i8x16_eq(v, vb)),
+            wasm_v128_or(wasm_i8x16_eq(v, vc), wasm_i8x16_eq(v, vd)));
+        if (!wasm_i8x16_all_true(m)) break;
+    }
+#else
+    (void)end; (void)a; (void)b; (void)c; (void)d;
+#endif
 
-	// if no more files, just return 1
-	if (!sCurrentInputFile) return 1;
+    return p;
+}
+
+/*
+ * @return the first 16 byte block from p that has a or b in it (or the
+ * last few bytes, which don't make a block)
+ */
+const char *SkipBlocksWithout(const char *p, const char *end, char a, char b) {
+#if defined(LEX_SSE2)
+    const __m128i va = _mm_set1_epi8(a), vb = _mm_set1_epi8(b);
+
+    for (; end - p >= 16; p += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)p);
+        if (_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, va), _mm_cmpeq_epi8(v, vb))))
+            break;
+    }
+#elif defined(LEX_NEON)
+    const uint8x16_t va = vdupq_n_u8(a), vb = vdupq_n_u8(b);
+
+    for (; end - p >= 16; p += 16) {
+        uint8x16_t v = vld1q_u8((const uint8_t *)p);
+        uint8x16_t m = vorrq_u8(vceqq_u8(v, va), vceqq_u8(v, vb));
+        uint8x8_t any = vorr_u8(vget_low_u8(m), vget_high_u8(m));
+        if (vget_lane_u64(vreinterpret_u64_u8(any), 0)) break;
+    }
+#elif defined(LEX_WASM_SIMD)
+    const v128_t va = wasm_i8x16_splat(a), vb = wasm_i8x16_splat(b);
+
+    for (; end - p >= 16; p += 16) {
+        v128_t v = wasm_v128_load(p);
+        if (wasm_v128_any_true(wasm_v128_or(wasm_i8x16_eq(v, va), wasm_i8x16_eq(v, vb))))
+            break;
+    }
+#else
+    (void)end; (void)a; (void)b;
+#endif
 
-	// switch to next file
-	yy_switch_to_buffer(sCurrentInputFile->fBufferState);
-	sOffset = sCurrentInputFile->fSavedOffset;
-	sSourceIndex = sCurrentInputFile->fSourceIndex;
+    return p;
+}
 
-	// tell yylex() to continue
-	return 0;
+int LexGetFileDepth() {
+    return sTokenDepth;
 }
 
+int LexFindAndPushFile(const char *name) {
+    Buffer *b = Compiler::Get()->CreateBuffer(name);
+    if (!b) {
+        Error(kErr_FileOpen, name).RaiseLex();
+        return 0;
+    }
 
-void LexReset()
-{
-	while(yywrap() == 0)
-		;
+    PrecompiledHeader *h = Compiler::Get()->CreatePrecompiled(name, b);
+    if (h) {
+        Compiler::Get()->AddPrecompiled(h);
+        return LexPushTokens(b, h);
+    }
+
+    return LexPush(b);
 }
 
-int FillBuffer(char *buf, int max_size)
-{
-	int result;
-	// if no files are pending, return 0 (EOF)
-	if (!sCurrentInputFile) return 0;
+int LexPush(Buffer *b) {
+    return LexPushFrom(b, 0);
+}
+
+int LexPushFrom(Buffer *b, long start) {
+    InputFile *inputFile;
+    int index;
+
+    index = Compiler::Get()->AddBuffer(b);
+
+    // make sure max file depth and file count haven't been exceeded
+    if (sFileDepth == kMaxFileDepth || index > kMaxFileCount)
+        return 0;
+
+    // save line number and buffer in previous file
+    if (sCurrentInputFile && !sCurrentInputFile->fTokens) {
+        sCurrentInputFile->fSavedOffset = sOffset;
+        sCurrentInputFile->fBufferState = YY_CURRENT_BUFFER;
+    }
+
+    inputFile = (InputFile *)malloc(sizeof(InputFile));
+    inputFile->fBufferState = yy_create_buffer(0, YY_BUF_SIZE);
+    inputFile->fDataPtr = b->GetData() + start;
+    inputFile->fDataRemain = b->GetLength() - start;
+    inputFile->fSourceIndex = index;
+    inputFile->fTokens = 0;
+    inputFile->fTokenIndex = 0;
+
+    // link into list
+    inputFile->fNext = sCurrentInputFile;
+    sCurrentInputFile = inputFile;
+    sFileDepth++;
+    sTokenDepth = sFileDepth;
+
+    // switch to new buffer
+    sOffset = start;
+    sSourceIndex = index;
+    yy_switch_to_buffer(inputFile->fBufferState);
+
+    return 1;
+}
+
+int LexPushTokens(Buffer *b, const PrecompiledHeader *h) {
+    InputFile *inputFile;
+    int index;
+
+    index = Compiler::Get()->AddBuffer(b);
+
+    if (sFileDepth == kMaxFileDepth || index > kMaxFileCount)
+        return 0;
+
+    // the flex buffer of the previous file stays current, but nothing
+    // is scanned from it until the tokens have been played back
+    if (sCurrentInputFile && !sCurrentInputFile->fTokens) {
+        sCurrentInputFile->fSavedOffset = sOffset;
+        sCurrentInputFile->fBufferState = YY_CURRENT_BUFFER;
+    }
+
+    inputFile = (InputFile *)malloc(sizeof(InputFile));
+    inputFile->fBufferState = 0;
+    inputFile->fDataPtr = 0;
+    inputFile->fDataRemain = 0;
+    inputFile->fSourceIndex = index;
+    inputFile->fTokens = h;
+    inputFile->fTokenIndex = 0;
+
+    inputFile->fNext = sCurrentInputFile;
+    sCurrentInputFile = inputFile;
+    sFileDepth++;
+    sTokenDepth = sFileDepth;
+
+    sSourceIndex = index;
 
-	int n = sCurrentInputFile->fDataRemain;
-	if (n > max_size)
-		n = max_size;
+    return 1;
+}
+
+void PopTokens() {
+    InputFile *inputFile = sCurrentInputFile;
+
+    sCurrentInputFile = inputFile->fNext;
+    sFileDepth--;
+    free(inputFile);
+
+    if (!sCurrentInputFile) return;
+
+    sSourceIndex = sCurrentInputFile->fSourceIndex;
+    if (sCurrentInputFile->fTokens) return;
 
-	memcpy(buf, sCurrentInputFile->fDataPtr, n);
-	sCurrentInputFile->fDataPtr += n;
-	sCurrentInputFile->fDataRemain -= n;
+    yy_switch_to_buffer(sCurrentInputFile->fBufferState);
+    sOffset = sCurrentInputFile->fSavedOffset;
+}
+
+int yywrap() {
+    InputFile *inputFile;
+
+    // check for unterminated comments
+    if (YY_START == COMMENT) {
+        Error(kErr_UnterminatedComment).RaiseLex();
+        BEGIN(INITIAL);
+    }
+
+    // if no input files, just return
+    if (sCurrentInputFile == 0) return 1;
+
+    // token playback doesn't own the current flex buffer
+    if (sCurrentInputFile->fTokens) {
+        PopTokens();
+        return sCurrentInputFile ? 0 : 1;
+    }
+
+    // pop an input file off the list
+    inputFile = sCurrentInputFile;
+    sCurrentInputFile = inputFile->fNext;
+    sFileDepth--;
+
+    // cleanup the input file
+    yy_delete_buffer(YY_CURRENT_BUFFER);
+    free(inputFile);
+
+    // if no more files, just return 1
+    if (!sCurrentInputFile) return 1;
+
+    // let LexGetToken() continue with the precompiled tokens
+    if (sCurrentInputFile->fTokens) {
+        sSourceIndex = sCurrentInputFile->fSourceIndex;
+        sResumeTokens = 1;
+        return 1;
+    }
+
+    // switch to next file
+    yy_switch_to_buffer(sCurrentInputFile->fBufferState);
+    sOffset = sCurrentInputFile->fSavedOffset;
+    sSourceIndex = sCurrentInputFile->fSourceIndex;
+
+    // tell yylex() to continue
+    return 0;
+}
+
+void LexReset() {
+    // yywrap() returns 1 early when returning to precompiled tokens
+    while (yywrap() == 0 || sCurrentInputFile)
+        ;
+    sResumeTokens = 0;
+    sSkipInactive = 0;
+
+    sTokens.clear();
+    sStrings.clear();
+    sTokenPos = 0;
+    sTokenLocValid = 0;
+
+    // a compile that stopped part way through a directive mustn't
+    // leave its state for the next one
+    BEGIN(INITIAL);
+    sInsideDirective = 0;
+    sReturnWhitespace = 0;
+    sFileDepth = 0;
+    sTokenDepth = 0;
+    sSourceIndex = 0;
+    sOffset = 0;
+}
 
-	result = n;
-	return result;
+int FillBuffer(char *buf, int max_size) {
+    int result;
+    // if no files are pending, return 0 (EOF)
+    if (!sCurrentInputFile) return 0;
+
+    const char *src = sCurrentInputFile->fDataPtr;
+    int n = sCurrentInputFile->fDataRemain;
+    if (n > max_size) {
+        n = max_size;
+
+        // don't split a line continuation between two reads
+        if (n > 2 && src[n-1] == '\r' && src[n-2] == '\\')
+            n -= 2;
+        else if (n > 1 && src[n-1] == '\\')
+            n -= 1;
+    }
+
+    memcpy(buf, src, n);
+
+    // Buffers keep their line endings, and the rules treat CR and LF
+    // alike.  The exception is a continuation before a CR-LF, which is
+    // passed on as backslash, LF, space so that the LF doesn't end the
+    // line.  The length is unchanged, so token offsets still match the
+    // Buffer.
+    for(int i=0; i+2<n; ++i) {
+        if (buf[i] == '\\' && buf[i+1] == '\r' && buf[i+2] == '\n') {
+            buf[i+1] = '\n';
+            buf[i+2] = ' ';
+        }
+    }
+
+    sCurrentInputFile->fDataPtr += n;
+    sCurrentInputFile->fDataRemain -= n;
+
+    result = n;
+    return result;
 }
@@ -1,75 +1,72 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
-/*  A Bison parser, made from parse.y with Bison version GNU Bison version 1.24
-  */
-
-#define YYBISON 1  /* Identify Bison output.  */
-
-#define	OR	258
-#define	AND	259
-#define	REL_EQ	260
-#define	REL_NE	261
-#define	REL_LE	262
-#define	REL_GE	263
-#define	LEFT	264
-#define	RIGHT	265
-#define	UMINUS	266
-#define	INDIRECT	267
-#define	INCDEC	268
-#define	ABS	269
-#define	SIGN	270
-#define	TYPE	271
-#define	EVENT_SRC	272
-#define	LOWER_THAN_ELSE	273
-#define	ELSE	274
-#define	LOWER_THAN_EXPR_SHIFT	275
-#define	ID	276
-#define	NUMBER	277
-#define	ASSIGN	278
-#define	ASSIGN2	279
-#define	TASKOP	280
-#define	JUMP	281
-#define	TASK	282
-#define	SUB	283
-#define	STRING	284
-#define	PP_DEFINE	285
-#define	PP_INCLUDE	286
-#define	NL	287
-#define	WS	288
-#define	PP_ARG	289
-#define	PP_UNKNOWN	290
-#define	PP_IFDEF	291
-#define	PP_IF	292
-#define	PP_ELSE	293
-#define	PP_ELIF	294
-#define	PP_ENDIF	295
-#define	PP_UNDEF	296
-#define	PP_PRAGMA	297
-#define	PP_GLOM	298
-#define	PP_ERROR	299
-#define	PP_WARNING	300
-#define	IF	301
-#define	WHILE	302
-#define	DO	303
-#define	FOR	304
-#define	REPEAT	305
-#define	SWITCH	306
-#define	CASE	307
-#define	DEFAULT	308
-#define	MONITOR	309
-#define	CATCH	310
-#define	ACQUIRE	311
-#define	GOTO	312
-#define	ASM	313
-#define	INT	314
-#define	T_VOID	315
-#define	T_CONST	316
-#define	SENSOR	317
-#define	TASKID	318
-#define	NOLIST	319
-#define	RES	320
-#define	CTRUE	321
-#define	CFALSE	322
+/* Bison implementation for Yacc-like parsers in C
 
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
 #line 1 "parse.y"
 
 /*
@@ -86,8 +83,12 @@
  * The Initial Developer of this code is David Baum.
  * Portions created by David Baum are Copyright (C) 1998 David Baum.
  * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
  */
-#line 19 "parse.y"
+#line 23 "parse.y"
 
 // prevent redefinition of YYSTYPE in parser.h
 #define __PARSE_TAB_H
@@ -113,8 +114,195 @@ class Clause;
 class LocationNode;
 
 
-#line 45 "parse.y"
-typedef union {
+#line 118 "y.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+/* Use api.header.include to #include this header
+   instead of duplicating it here.  */
+#ifndef YY_YY_Y_TAB_H_INCLUDED
+# define YY_YY_Y_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    OR = 258,                      /* OR  */
+    AND = 259,                     /* AND  */
+    LEFT = 260,                    /* LEFT  */
+    RIGHT = 261,                   /* RIGHT  */
+    UMINUS = 262,                  /* UMINUS  */
+    INDIRECT = 263,                /* INDIRECT  */
+    ABS = 264,                     /* ABS  */
+    SIGN = 265,                    /* SIGN  */
+    TYPE = 266,                    /* TYPE  */
+    EVENT_SRC = 267,               /* EVENT_SRC  */
+    LOWER_THAN_ELSE = 268,         /* LOWER_THAN_ELSE  */
+    ELSE = 269,                    /* ELSE  */
+    LOWER_THAN_EXPR_SHIFT = 270,   /* LOWER_THAN_EXPR_SHIFT  */
+    ID = 271,                      /* ID  */
+    NUMBER = 272,                  /* NUMBER  */
+    ASSIGN = 273,                  /* ASSIGN  */
+    ASSIGN2 = 274,                 /* ASSIGN2  */
+    TASKOP = 275,                  /* TASKOP  */
+    JUMP = 276,                    /* JUMP  */
+    TASK = 277,                    /* TASK  */
+    SUB = 278,                     /* SUB  */
+    INCDEC = 279,                  /* INCDEC  */
+    STRING = 280,                  /* STRING  */
+    REL_GE = 281,                  /* REL_GE  */
+    REL_LE = 282,                  /* REL_LE  */
+    REL_EQ = 283,                  /* REL_EQ  */
+    REL_NE = 284,                  /* REL_NE  */
+    PP_DEFINE = 285,               /* PP_DEFINE  */
+    PP_INCLUDE = 286,              /* PP_INCLUDE  */
+    NL = 287,                      /* NL  */
+    WS = 288,                      /* WS  */
+    PP_ARG = 289,                  /* PP_ARG  */
+    PP_UNKNOWN = 290,              /* PP_UNKNOWN  */
+    PP_IFDEF = 291,                /* PP_IFDEF  */
+    PP_IF = 292,                   /* PP_IF  */
+    PP_ELSE = 293,                 /* PP_ELSE  */
+    PP_ELIF = 294,                 /* PP_ELIF  */
+    PP_ENDIF = 295,                /* PP_ENDIF  */
+    PP_UNDEF = 296,                /* PP_UNDEF  */
+    PP_PRAGMA = 297,               /* PP_PRAGMA  */
+    PP_GLOM = 298,                 /* PP_GLOM  */
+    PP_ERROR = 299,                /* PP_ERROR  */
+    PP_WARNING = 300,              /* PP_WARNING  */
+    IF = 301,                      /* IF  */
+    WHILE = 302,                   /* WHILE  */
+    DO = 303,                      /* DO  */
+    FOR = 304,                     /* FOR  */
+    REPEAT = 305,                  /* REPEAT  */
+    SWITCH = 306,                  /* SWITCH  */
+    CASE = 307,                    /* CASE  */
+    DEFAULT = 308,                 /* DEFAULT  */
+    MONITOR = 309,                 /* MONITOR  */
+    CATCH = 310,                   /* CATCH  */
+    ACQUIRE = 311,                 /* ACQUIRE  */
+    GOTO = 312,                    /* GOTO  */
+    ASM = 313,                     /* ASM  */
+    INT = 314,                     /* INT  */
+    T_VOID = 315,                  /* T_VOID  */
+    T_CONST = 316,                 /* T_CONST  */
+    SENSOR = 317,                  /* SENSOR  */
+    TASKID = 318,                  /* TASKID  */
+    NOLIST = 319,                  /* NOLIST  */
+    RES = 320,                     /* RES  */
+    CTRUE = 321,                   /* CTRUE  */
+    CFALSE = 322                   /* CFALSE  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
+#define OR 258
+#define AND 259
+#define LEFT 260
+#define RIGHT 261
+#define UMINUS 262
+#define INDIRECT 263
+#define ABS 264
+#define SIGN 265
+#define TYPE 266
+#define EVENT_SRC 267
+#define LOWER_THAN_ELSE 268
+#define ELSE 269
+#define LOWER_THAN_EXPR_SHIFT 270
+#define ID 271
+#define NUMBER 272
+#define ASSIGN 273
+#define ASSIGN2 274
+#define TASKOP 275
+#define JUMP 276
+#define TASK 277
+#define SUB 278
+#define INCDEC 279
+#define STRING 280
+#define REL_GE 281
+#define REL_LE 282
+#define REL_EQ 283
+#define REL_NE 284
+#define PP_DEFINE 285
+#define PP_INCLUDE 286
+#define NL 287
+#define WS 288
+#define PP_ARG 289
+#define PP_UNKNOWN 290
+#define PP_IFDEF 291
+#define PP_IF 292
+#define PP_ELSE 293
+#define PP_ELIF 294
+#define PP_ENDIF 295
+#define PP_UNDEF 296
+#define PP_PRAGMA 297
+#define PP_GLOM 298
+#define PP_ERROR 299
+#define PP_WARNING 300
+#define IF 301
+#define WHILE 302
+#define DO 303
+#define FOR 304
+#define REPEAT 305
+#define SWITCH 306
+#define CASE 307
+#define DEFAULT 308
+#define MONITOR 309
+#define CATCH 310
+#define ACQUIRE 311
+#define GOTO 312
+#define ASM 313
+#define INT 314
+#define T_VOID 315
+#define T_CONST 316
+#define SENSOR 317
+#define TASKID 318
+#define NOLIST 319
+#define RES 320
+#define CTRUE 321
+#define CFALSE 322
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 49 "parse.y"
+
 	int			fInt;
 	bool		fBool;
 	Resource*	fResource;
@@ -122,7 +310,7 @@ typedef union {
 	Stmt*		fStmt;
 	BlockStmt*	fBlock;
 	Symbol*		fSymbol;
-	char*		fString;
+	char*		fString;	// only from yylex(), see LexGetString()
 	Expr*		fExpr;
 	FunctionDef*	fFunction;
 	CallStmt*	fCall;
@@ -131,8 +319,166 @@ typedef union {
 	CaseStmt*	fCaseStmt;
 	DeclareStmt*	fDeclareStmt;
 	LocationNode*	fLocation;
-} YYSTYPE;
-#line 65 "parse.y"
+
+#line 324 "y.tab.c"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+extern YYSTYPE yylval;
+
+
+int yyparse (void);
+
+
+#endif /* !YY_YY_Y_TAB_H_INCLUDED  */
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_3_ = 3,                         /* ':'  */
+  YYSYMBOL_4_ = 4,                         /* '?'  */
+  YYSYMBOL_OR = 5,                         /* OR  */
+  YYSYMBOL_AND = 6,                        /* AND  */
+  YYSYMBOL_7_ = 7,                         /* '|'  */
+  YYSYMBOL_8_ = 8,                         /* '^'  */
+  YYSYMBOL_9_ = 9,                         /* '&'  */
+  YYSYMBOL_10_ = 10,                       /* '<'  */
+  YYSYMBOL_11_ = 11,                       /* '>'  */
+  YYSYMBOL_LEFT = 12,                      /* LEFT  */
+  YYSYMBOL_RIGHT = 13,                     /* RIGHT  */
+  YYSYMBOL_14_ = 14,                       /* '-'  */
+  YYSYMBOL_15_ = 15,                       /* '+'  */
+  YYSYMBOL_16_ = 16,                       /* '*'  */
+  YYSYMBOL_17_ = 17,                       /* '/'  */
+  YYSYMBOL_18_ = 18,                       /* '%'  */
+  YYSYMBOL_UMINUS = 19,                    /* UMINUS  */
+  YYSYMBOL_20_ = 20,                       /* '~'  */
+  YYSYMBOL_INDIRECT = 21,                  /* INDIRECT  */
+  YYSYMBOL_22_ = 22,                       /* '!'  */
+  YYSYMBOL_ABS = 23,                       /* ABS  */
+  YYSYMBOL_SIGN = 24,                      /* SIGN  */
+  YYSYMBOL_TYPE = 25,                      /* TYPE  */
+  YYSYMBOL_EVENT_SRC = 26,                 /* EVENT_SRC  */
+  YYSYMBOL_LOWER_THAN_ELSE = 27,           /* LOWER_THAN_ELSE  */
+  YYSYMBOL_ELSE = 28,                      /* ELSE  */
+  YYSYMBOL_LOWER_THAN_EXPR_SHIFT = 29,     /* LOWER_THAN_EXPR_SHIFT  */
+  YYSYMBOL_30_ = 30,                       /* ')'  */
+  YYSYMBOL_ID = 31,                        /* ID  */
+  YYSYMBOL_NUMBER = 32,                    /* NUMBER  */
+  YYSYMBOL_ASSIGN = 33,                    /* ASSIGN  */
+  YYSYMBOL_ASSIGN2 = 34,                   /* ASSIGN2  */
+  YYSYMBOL_TASKOP = 35,                    /* TASKOP  */
+  YYSYMBOL_JUMP = 36,                      /* JUMP  */
+  YYSYMBOL_TASK = 37,                      /* TASK  */
+  YYSYMBOL_SUB = 38,                       /* SUB  */
+  YYSYMBOL_INCDEC = 39,                    /* INCDEC  */
+  YYSYMBOL_STRING = 40,                    /* STRING  */
+  YYSYMBOL_REL_GE = 41,                    /* REL_GE  */
+  YYSYMBOL_REL_LE = 42,                    /* REL_LE  */
+  YYSYMBOL_REL_EQ = 43,                    /* REL_EQ  */
+  YYSYMBOL_REL_NE = 44,                    /* REL_NE  */
+  YYSYMBOL_PP_DEFINE = 45,                 /* PP_DEFINE  */
+  YYSYMBOL_PP_INCLUDE = 46,                /* PP_INCLUDE  */
+  YYSYMBOL_NL = 47,                        /* NL  */
+  YYSYMBOL_WS = 48,                        /* WS  */
+  YYSYMBOL_PP_ARG = 49,                    /* PP_ARG  */
+  YYSYMBOL_PP_UNKNOWN = 50,                /* PP_UNKNOWN  */
+  YYSYMBOL_PP_IFDEF = 51,                  /* PP_IFDEF  */
+  YYSYMBOL_PP_IF = 52,                     /* PP_IF  */
+  YYSYMBOL_PP_ELSE = 53,                   /* PP_ELSE  */
+  YYSYMBOL_PP_ELIF = 54,                   /* PP_ELIF  */
+  YYSYMBOL_PP_ENDIF = 55,                  /* PP_ENDIF  */
+  YYSYMBOL_PP_UNDEF = 56,                  /* PP_UNDEF  */
+  YYSYMBOL_PP_PRAGMA = 57,                 /* PP_PRAGMA  */
+  YYSYMBOL_PP_GLOM = 58,                   /* PP_GLOM  */
+  YYSYMBOL_PP_ERROR = 59,                  /* PP_ERROR  */
+  YYSYMBOL_PP_WARNING = 60,                /* PP_WARNING  */
+  YYSYMBOL_IF = 61,                        /* IF  */
+  YYSYMBOL_WHILE = 62,                     /* WHILE  */
+  YYSYMBOL_DO = 63,                        /* DO  */
+  YYSYMBOL_FOR = 64,                       /* FOR  */
+  YYSYMBOL_REPEAT = 65,                    /* REPEAT  */
+  YYSYMBOL_SWITCH = 66,                    /* SWITCH  */
+  YYSYMBOL_CASE = 67,                      /* CASE  */
+  YYSYMBOL_DEFAULT = 68,                   /* DEFAULT  */
+  YYSYMBOL_MONITOR = 69,                   /* MONITOR  */
+  YYSYMBOL_CATCH = 70,                     /* CATCH  */
+  YYSYMBOL_ACQUIRE = 71,                   /* ACQUIRE  */
+  YYSYMBOL_GOTO = 72,                      /* GOTO  */
+  YYSYMBOL_ASM = 73,                       /* ASM  */
+  YYSYMBOL_INT = 74,                       /* INT  */
+  YYSYMBOL_T_VOID = 75,                    /* T_VOID  */
+  YYSYMBOL_T_CONST = 76,                   /* T_CONST  */
+  YYSYMBOL_SENSOR = 77,                    /* SENSOR  */
+  YYSYMBOL_TASKID = 78,                    /* TASKID  */
+  YYSYMBOL_NOLIST = 79,                    /* NOLIST  */
+  YYSYMBOL_RES = 80,                       /* RES  */
+  YYSYMBOL_CTRUE = 81,                     /* CTRUE  */
+  YYSYMBOL_CFALSE = 82,                    /* CFALSE  */
+  YYSYMBOL_83_ = 83,                       /* ';'  */
+  YYSYMBOL_84_ = 84,                       /* '('  */
+  YYSYMBOL_85_ = 85,                       /* '{'  */
+  YYSYMBOL_86_ = 86,                       /* '}'  */
+  YYSYMBOL_87_ = 87,                       /* ','  */
+  YYSYMBOL_88_ = 88,                       /* '='  */
+  YYSYMBOL_89_ = 89,                       /* '['  */
+  YYSYMBOL_90_ = 90,                       /* ']'  */
+  YYSYMBOL_91_ = 91,                       /* '@'  */
+  YYSYMBOL_92_ = 92,                       /* '$'  */
+  YYSYMBOL_YYACCEPT = 93,                  /* $accept  */
+  YYSYMBOL_S = 94,                         /* S  */
+  YYSYMBOL_unit_list = 95,                 /* unit_list  */
+  YYSYMBOL_unit = 96,                      /* unit  */
+  YYSYMBOL_function_head = 97,             /* function_head  */
+  YYSYMBOL_sub_head = 98,                  /* sub_head  */
+  YYSYMBOL_nolist_opt = 99,                /* nolist_opt  */
+  YYSYMBOL_fragment = 100,                 /* fragment  */
+  YYSYMBOL_subfragment = 101,              /* subfragment  */
+  YYSYMBOL_sarg_list = 102,                /* sarg_list  */
+  YYSYMBOL_args = 103,                     /* args  */
+  YYSYMBOL_arg_list = 104,                 /* arg_list  */
+  YYSYMBOL_arg_type = 105,                 /* arg_type  */
+  YYSYMBOL_var_list = 106,                 /* var_list  */
+  YYSYMBOL_var_item = 107,                 /* var_item  */
+  YYSYMBOL_var_decl = 108,                 /* var_decl  */
+  YYSYMBOL_block = 109,                    /* block  */
+  YYSYMBOL_110_1 = 110,                    /* $@1  */
+  YYSYMBOL_stmt_list = 111,                /* stmt_list  */
+  YYSYMBOL_stmt = 112,                     /* stmt  */
+  YYSYMBOL_control_stmt = 113,             /* control_stmt  */
+  YYSYMBOL_misc_stmt = 114,                /* misc_stmt  */
+  YYSYMBOL_expr_stmt = 115,                /* expr_stmt  */
+  YYSYMBOL_opt_expr_stmt = 116,            /* opt_expr_stmt  */
+  YYSYMBOL_opt_expr = 117,                 /* opt_expr  */
+  YYSYMBOL_opt_handler = 118,              /* opt_handler  */
+  YYSYMBOL_handler_list = 119,             /* handler_list  */
+  YYSYMBOL_evt_handler = 120,              /* evt_handler  */
+  YYSYMBOL_handler = 121,                  /* handler  */
+  YYSYMBOL_case = 122,                     /* case  */
+  YYSYMBOL_params = 123,                   /* params  */
+  YYSYMBOL_param_list = 124,               /* param_list  */
+  YYSYMBOL_expr = 125,                     /* expr  */
+  YYSYMBOL_saveloc = 126,                  /* saveloc  */
+  YYSYMBOL_loc = 127,                      /* loc  */
+  YYSYMBOL_asm_list = 128,                 /* asm_list  */
+  YYSYMBOL_asm_item = 129,                 /* asm_item  */
+  YYSYMBOL_resource = 130,                 /* resource  */
+  YYSYMBOL_res_data = 131,                 /* res_data  */
+  YYSYMBOL_res_byte = 132                  /* res_byte  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+/* Second part of user prologue.  */
+#line 69 "parse.y"
 
 #include <stdlib.h>
 #include "IfStmt.h"
@@ -173,1827 +519,2493 @@ typedef union {
 
 static LexLocation sSavedLoc;
 
-#line 155 "parse.y"
+#line 159 "parse.y"
 
 static void yyerror(const char *msg);
 
 
-#ifndef YYLTYPE
-typedef
-  struct yyltype
-    {
-      int timestamp;
-      int first_line;
-      int first_column;
-      int last_line;
-      int last_column;
-      char *text;
-   }
-  yyltype;
-
-#define YYLTYPE yyltype
+#line 528 "y.tab.c"
+
+
+#ifdef short
+# undef short
 #endif
 
-#include <stdio.h>
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
 
-#ifndef __cplusplus
-#ifndef __STDC__
-#define const
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
 #endif
 
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
 
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
 
-#define	YYFINAL		326
-#define	YYFLAG		-32768
-#define	YYNTBASE	93
-
-#define YYTRANSLATE(x) ((unsigned)(x) <= 322 ? yytranslate[x] : 131)
-
-static const char yytranslate[] = {     0,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,    26,     2,     2,    92,    22,     9,     2,    86,
-    35,    20,    19,    87,    18,     2,    21,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     3,    83,    12,
-    88,    13,     4,    91,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-    89,     2,    90,     8,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,    84,     7,    85,    24,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     1,     2,     5,     6,    10,
-    11,    14,    15,    16,    17,    23,    25,    27,    28,    29,
-    30,    31,    32,    33,    34,    36,    37,    38,    39,    40,
-    41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
-    51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
-    61,    62,    63,    64,    65,    66,    67,    68,    69,    70,
-    71,    72,    73,    74,    75,    76,    77,    78,    79,    80,
-    81,    82
-};
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
 
-#if YYDEBUG != 0
-static const short yyprhs[] = {     0,
-     0,     2,     5,     6,    10,    14,    18,    25,    28,    35,
-    37,    38,    44,    53,    59,    64,    67,    69,    71,    72,
-    77,    80,    82,    85,    88,    92,    94,    97,   101,   105,
-   107,   109,   113,   116,   122,   126,   127,   132,   135,   136,
-   138,   140,   143,   148,   151,   153,   156,   163,   172,   179,
-   186,   193,   202,   211,   220,   231,   236,   242,   246,   251,
-   258,   262,   265,   267,   271,   275,   279,   281,   282,   284,
-   285,   287,   288,   291,   292,   295,   302,   305,   310,   314,
-   316,   317,   321,   323,   326,   330,   334,   338,   342,   346,
-   350,   354,   358,   362,   366,   370,   374,   378,   382,   386,
-   390,   393,   396,   399,   403,   407,   410,   413,   418,   423,
-   427,   430,   436,   439,   442,   445,   450,   455,   460,   463,
-   471,   477,   481,   488,   492,   493,   494,   498,   500,   501,
-   503,   506,   511,   518,   522,   524,   525
-};
 
-static const short yyrhs[] = {    94,
-     0,    94,    95,     0,     0,    74,   104,    83,     0,   125,
-    98,   125,     0,   125,    99,   125,     0,   125,    96,    84,
-   109,    85,   125,     0,   128,    83,     0,    97,    75,    36,
-    86,   101,    35,     0,    79,     0,     0,    42,    36,    86,
-    35,   107,     0,    43,    36,    86,   100,    35,    84,   109,
-    85,     0,    43,    36,    86,    35,   107,     0,   100,    87,
-   103,    36,     0,   103,    36,     0,   102,     0,    75,     0,
-     0,   102,    87,   103,    36,     0,   103,    36,     0,    74,
-     0,    76,    74,     0,    74,     9,     0,    76,    74,     9,
-     0,    77,     0,    74,    20,     0,    76,    74,    20,     0,
-   104,    87,   105,     0,   105,     0,   106,     0,   106,    88,
-   123,     0,    36,   125,     0,    36,   125,    89,   123,    90,
-     0,    20,    36,   125,     0,     0,    84,   108,   109,    85,
-     0,   109,   110,     0,     0,    83,     0,   107,     0,   120,
-   110,     0,   125,    36,     3,   110,     0,     1,    83,     0,
-   111,     0,   112,   125,     0,    62,    86,   123,    35,   125,
-   110,     0,    63,   125,   110,    62,    86,   123,    35,    83,
-     0,    65,    86,   123,    35,   125,   110,     0,    66,    86,
-   123,    35,   125,   110,     0,    61,    86,   123,    35,   125,
-   110,     0,    61,    86,   123,    35,   125,   110,    33,   110,
-     0,    69,   125,    86,   123,    35,   125,   107,   117,     0,
-    71,   125,    86,   123,    35,   125,   107,   116,     0,    64,
-    86,   114,    83,   115,    83,   114,    35,   125,   110,     0,
-    72,    36,   124,    83,     0,    73,    84,   126,    85,    83,
-     0,   124,    41,    83,     0,    40,   124,    36,    83,     0,
-   125,    36,    86,   121,    35,    83,     0,    74,   104,    83,
-     0,   113,    83,     0,   123,     0,   123,    38,   123,     0,
-   123,    39,   123,     0,   123,    88,   123,     0,   113,     0,
-     0,   123,     0,     0,   119,     0,     0,   117,   118,     0,
-     0,    70,   107,     0,    70,   125,    86,   123,    35,   107,
-     0,    70,   107,     0,   124,    67,   123,     3,     0,   124,
-    68,     3,     0,   122,     0,     0,   122,    87,   123,     0,
-   123,     0,    37,   124,     0,   123,    19,   123,     0,   123,
-    18,   123,     0,   123,    20,   123,     0,   123,    21,   123,
-     0,   123,     9,   123,     0,   123,     7,   123,     0,   123,
-    22,   123,     0,   123,    16,   123,     0,   123,    17,   123,
-     0,   123,     8,   123,     0,   123,    10,   123,     0,   123,
-    14,   123,     0,   123,    15,   123,     0,   123,    11,   123,
-     0,   123,    12,   123,     0,   123,    13,   123,     0,    81,
-   124,     0,    82,   124,     0,    26,   123,     0,   123,     6,
-   123,     0,   123,     5,   123,     0,    18,   123,     0,    24,
-   123,     0,    28,    86,   123,    35,     0,    29,    86,   123,
-    35,     0,    86,   123,    35,     0,   125,    36,     0,   125,
-    36,    89,   123,    90,     0,    91,   123,     0,   123,    27,
-     0,    27,   123,     0,    77,    86,   123,    35,     0,    30,
-    86,   123,    35,     0,    31,    86,   123,    35,     0,   125,
-    78,     0,    25,    86,   123,    35,    89,   123,    90,     0,
-   123,     4,   123,     3,   123,     0,   125,     9,    36,     0,
-   125,     9,    36,    89,   123,    90,     0,   125,    20,    36,
-     0,     0,     0,   126,    87,   127,     0,   127,     0,     0,
-   123,     0,    92,   123,     0,    92,   123,     3,   123,     0,
-    80,   123,    36,    84,   129,    85,     0,   129,    87,   130,
-     0,   130,     0,     0,   123,     0
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
 };
 
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
 #endif
 
-#if YYDEBUG != 0
-static const short yyrline[] = { 0,
-   163,   167,   168,   171,   172,   173,   174,   175,   179,   182,
-   183,   186,   193,   194,   197,   198,   201,   202,   203,   206,
-   207,   210,   211,   212,   213,   214,   215,   216,   220,   221,
-   224,   225,   228,   229,   230,   233,   233,   236,   237,   241,
-   242,   243,   244,   245,   246,   247,   252,   253,   254,   255,
-   256,   257,   258,   259,   260,   261,   265,   266,   267,   268,
-   269,   270,   274,   275,   276,   277,   281,   282,   285,   286,
-   290,   291,   295,   296,   299,   300,   304,   307,   308,   311,
-   312,   315,   316,   319,   320,   321,   322,   323,   324,   325,
-   326,   327,   328,   329,   330,   331,   332,   333,   334,   335,
-   336,   337,   338,   339,   340,   342,   343,   345,   346,   348,
-   349,   350,   351,   353,   354,   356,   357,   358,   359,   360,
-   361,   362,   363,   364,   367,   370,   373,   374,   375,   379,
-   380,   381,   385,   388,   389,   390,   393
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  3
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   2008
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  93
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  40
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  141
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  330
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   322
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    22,     2,     2,    92,    18,     9,     2,
+      84,    30,    16,    15,    87,    14,     2,    17,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     3,    83,
+      10,    88,    11,     4,    91,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,    89,     2,    90,     8,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    85,     7,    86,    20,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     5,     6,
+      12,    13,    19,    21,    23,    24,    25,    26,    27,    28,
+      29,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
+      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
+      70,    71,    72,    73,    74,    75,    76,    77,    78,    79,
+      80,    81,    82
 };
 
-static const char * const yytname[] = {   "$","error","$undefined.","':'","'?'",
-"OR","AND","'|'","'^'","'&'","REL_EQ","REL_NE","'<'","'>'","REL_LE","REL_GE",
-"LEFT","RIGHT","'-'","'+'","'*'","'/'","'%'","UMINUS","'~'","INDIRECT","'!'",
-"INCDEC","ABS","SIGN","TYPE","EVENT_SRC","LOWER_THAN_ELSE","ELSE","LOWER_THAN_EXPR_SHIFT",
-"')'","ID","NUMBER","ASSIGN","ASSIGN2","TASKOP","JUMP","TASK","SUB","STRING",
-"PP_DEFINE","PP_INCLUDE","NL","WS","PP_ARG","PP_UNKNOWN","PP_IFDEF","PP_IF",
-"PP_ELSE","PP_ELIF","PP_ENDIF","PP_UNDEF","PP_PRAGMA","PP_GLOM","PP_ERROR","PP_WARNING",
-"IF","WHILE","DO","FOR","REPEAT","SWITCH","CASE","DEFAULT","MONITOR","CATCH",
-"ACQUIRE","GOTO","ASM","INT","T_VOID","T_CONST","SENSOR","TASKID","NOLIST","RES",
-"CTRUE","CFALSE","';'","'{'","'}'","'('","','","'='","'['","']'","'@'","'$'",
-"S","unit_list","unit","function_head","nolist_opt","fragment","subfragment",
-"sarg_list","args","arg_list","arg_type","var_list","var_item","var_decl","block",
-"@1","stmt_list","stmt","control_stmt","misc_stmt","expr_stmt","opt_expr_stmt",
-"opt_expr","opt_handler","handler_list","evt_handler","handler","case","params",
-"param_list","expr","saveloc","loc","asm_list","asm_item","resource","res_data",
-"res_byte",""
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   167,   167,   171,   172,   175,   176,   177,   178,   179,
+     180,   181,   182,   186,   189,   192,   193,   196,   203,   206,
+     207,   210,   211,   212,   215,   216,   219,   220,   221,   222,
+     223,   224,   225,   229,   230,   233,   234,   237,   238,   239,
+     242,   242,   245,   246,   250,   251,   252,   253,   254,   255,
+     256,   261,   262,   263,   264,   265,   266,   267,   268,   269,
+     270,   274,   275,   276,   277,   278,   279,   283,   284,   285,
+     286,   290,   291,   294,   295,   299,   300,   304,   305,   308,
+     309,   313,   316,   317,   320,   321,   324,   325,   328,   329,
+     330,   331,   332,   333,   334,   335,   336,   337,   338,   339,
+     340,   341,   342,   343,   344,   345,   346,   347,   348,   349,
+     351,   352,   354,   355,   357,   358,   359,   360,   362,   363,
+     365,   366,   367,   368,   369,   370,   371,   372,   373,   376,
+     379,   382,   383,   384,   388,   389,   390,   394,   397,   398,
+     399,   402
 };
 #endif
 
-static const short yyr1[] = {     0,
-    93,    94,    94,    95,    95,    95,    95,    95,    96,    97,
-    97,    98,    99,    99,   100,   100,   101,   101,   101,   102,
-   102,   103,   103,   103,   103,   103,   103,   103,   104,   104,
-   105,   105,   106,   106,   106,   108,   107,   109,   109,   110,
-   110,   110,   110,   110,   110,   110,   111,   111,   111,   111,
-   111,   111,   111,   111,   111,   111,   112,   112,   112,   112,
-   112,   112,   113,   113,   113,   113,   114,   114,   115,   115,
-   116,   116,   117,   117,   118,   118,   119,   120,   120,   121,
-   121,   122,   122,   123,   123,   123,   123,   123,   123,   123,
-   123,   123,   123,   123,   123,   123,   123,   123,   123,   123,
-   123,   123,   123,   123,   123,   123,   123,   123,   123,   123,
-   123,   123,   123,   123,   123,   123,   123,   123,   123,   123,
-   123,   123,   123,   123,   124,   125,   126,   126,   126,   127,
-   127,   127,   128,   129,   129,   129,   130
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "':'", "'?'", "OR",
+  "AND", "'|'", "'^'", "'&'", "'<'", "'>'", "LEFT", "RIGHT", "'-'", "'+'",
+  "'*'", "'/'", "'%'", "UMINUS", "'~'", "INDIRECT", "'!'", "ABS", "SIGN",
+  "TYPE", "EVENT_SRC", "LOWER_THAN_ELSE", "ELSE", "LOWER_THAN_EXPR_SHIFT",
+  "')'", "ID", "NUMBER", "ASSIGN", "ASSIGN2", "TASKOP", "JUMP", "TASK",
+  "SUB", "INCDEC", "STRING", "REL_GE", "REL_LE", "REL_EQ", "REL_NE",
+  "PP_DEFINE", "PP_INCLUDE", "NL", "WS", "PP_ARG", "PP_UNKNOWN",
+  "PP_IFDEF", "PP_IF", "PP_ELSE", "PP_ELIF", "PP_ENDIF", "PP_UNDEF",
+  "PP_PRAGMA", "PP_GLOM", "PP_ERROR", "PP_WARNING", "IF", "WHILE", "DO",
+  "FOR", "REPEAT", "SWITCH", "CASE", "DEFAULT", "MONITOR", "CATCH",
+  "ACQUIRE", "GOTO", "ASM", "INT", "T_VOID", "T_CONST", "SENSOR", "TASKID",
+  "NOLIST", "RES", "CTRUE", "CFALSE", "';'", "'('", "'{'", "'}'", "','",
+  "'='", "'['", "']'", "'@'", "'$'", "$accept", "S", "unit_list", "unit",
+  "function_head", "sub_head", "nolist_opt", "fragment", "subfragment",
+  "sarg_list", "args", "arg_list", "arg_type", "var_list", "var_item",
+  "var_decl", "block", "$@1", "stmt_list", "stmt", "control_stmt",
+  "misc_stmt", "expr_stmt", "opt_expr_stmt", "opt_expr", "opt_handler",
+  "handler_list", "evt_handler", "handler", "case", "params", "param_list",
+  "expr", "saveloc", "loc", "asm_list", "asm_item", "resource", "res_data",
+  "res_byte", YY_NULLPTR
 };
 
-static const short yyr2[] = {     0,
-     1,     2,     0,     3,     3,     3,     6,     2,     6,     1,
-     0,     5,     8,     5,     4,     2,     1,     1,     0,     4,
-     2,     1,     2,     2,     3,     1,     2,     3,     3,     1,
-     1,     3,     2,     5,     3,     0,     4,     2,     0,     1,
-     1,     2,     4,     2,     1,     2,     6,     8,     6,     6,
-     6,     8,     8,     8,    10,     4,     5,     3,     4,     6,
-     3,     2,     1,     3,     3,     3,     1,     0,     1,     0,
-     1,     0,     2,     0,     2,     6,     2,     4,     3,     1,
-     0,     3,     1,     2,     3,     3,     3,     3,     3,     3,
-     3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-     2,     2,     2,     3,     3,     2,     2,     4,     4,     3,
-     2,     5,     2,     2,     2,     4,     4,     4,     2,     7,
-     5,     3,     6,     3,     0,     0,     3,     1,     0,     1,
-     2,     4,     6,     3,     1,     0,     1
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-193)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-141)
+
+#define yytable_value_is_error(Yyn) \
+  ((Yyn) == YYTABLE_NINF)
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+    -193,    15,    16,  -193,     3,  1043,  -193,    -2,   -59,     9,
+    -193,   -62,  -193,   -37,  1043,  1043,   -30,  1043,   -14,    10,
+      14,    28,  -193,  1043,    30,  -193,  -193,  1043,  1043,  1205,
+      21,    50,    51,  -193,    34,    36,    49,  -193,  -193,  -193,
+    -193,    45,  -193,     3,  1043,    96,    96,  1043,    96,  1043,
+    1043,  1043,  1043,  -193,    96,  1043,  -193,  -193,  1246,    96,
+    1043,  1043,  1043,  1043,  1043,  1043,  1043,  1043,  1043,  1043,
+    1043,  1043,  1043,  1043,  1043,    73,  -193,  1043,  1043,  1043,
+    1043,   128,   135,    71,  -193,    83,    92,  -193,  -193,   138,
+    -193,  -193,  -193,  1043,  -193,  1861,  1287,  1328,  1369,  1410,
+    1451,  1492,  -193,  1132,  1915,  1927,  1964,   129,   139,   214,
+     214,    87,    87,   147,   147,    96,    96,    96,   837,   214,
+     214,   207,   207,    95,  -193,  1043,   158,     2,   386,   464,
+     105,   286,   101,  -193,  -193,  -193,  -193,  -193,  1043,  1861,
+      -1,  -193,  1043,   301,   -42,     6,    11,   117,  -193,   -16,
+     163,   112,  -193,   114,   115,  -193,   116,   118,   119,  -193,
+    -193,   173,   120,     3,  -193,  -193,  -193,  -193,  -193,  -193,
+    -193,   123,   620,   766,   -19,    22,  -193,    54,  -193,  1043,
+    1876,  -193,  1043,   708,  -193,  -193,  -193,  -193,  -193,  -193,
+    -193,    17,  -193,    32,  -193,  -193,   176,  1043,  1043,   620,
+     911,  1043,  1043,   127,   131,  -193,   797,    -3,  -193,  -193,
+    -193,  -193,  -193,  1043,  1043,  1043,   133,  1043,   230,     8,
+    -193,  -193,   206,   151,   208,   723,  -193,  -193,  -193,  -193,
+     210,   159,  1533,  1574,   181,  -193,   164,  1615,  1656,  1043,
+    1043,   169,  1043,  1861,    31,  -193,  -193,   542,  1861,  1861,
+    1861,  -193,  1148,  -193,   620,   931,  -193,    32,  -193,  -193,
+    -193,  -193,  -193,  -193,   170,   951,  -193,  -193,  1697,  1738,
+    -193,  1190,   175,   817,  -193,  -193,  -193,   226,   172,  1861,
+     231,   620,   620,  1043,   180,  1861,   620,   620,  -193,  -193,
+    1043,  -193,  -193,   182,  1043,  -193,   236,  -193,  1779,  1023,
+    -193,  -193,   184,   184,  1861,  -193,  1861,   620,   183,   237,
+    -193,   200,  -193,  -193,  -193,   201,   184,  -193,  -193,   620,
+     184,  -193,  -193,  -193,  -193,   188,  1043,  1820,   184,  -193
 };
 
-static const short yydefact[] = {     3,
-   126,     0,   126,     2,    11,     0,     0,   126,     0,    30,
-    31,   126,   126,     0,   126,   126,     0,     0,     0,     0,
-   125,     0,   125,   125,   126,   126,     0,     0,     0,     0,
-    10,     0,     0,   126,   126,     8,   126,    33,     4,     0,
-   126,   106,   107,   126,   103,   115,   126,   126,   126,   126,
-    84,   126,   101,   102,     0,   113,   126,   126,   126,   126,
-   126,   126,   126,   126,   126,   126,   126,   126,   126,   126,
-   126,   126,   126,   126,   126,   114,     0,     0,     0,   111,
-   119,     0,     0,    39,     0,     5,     6,    35,   126,    29,
-    32,     0,     0,     0,     0,     0,     0,   110,     0,   105,
-   104,    90,    94,    89,    95,    98,    99,   100,    96,    97,
-    92,    93,    86,    85,    87,    88,    91,   126,   122,   124,
-   126,     0,     0,     0,     0,     0,     0,   108,   109,   117,
-   118,   116,   126,   137,     0,   135,   126,     0,     0,     0,
-    22,     0,    26,     0,     0,     0,   125,     0,     0,   126,
-     0,     0,     0,   126,   126,     0,     0,     0,    40,    36,
-   126,    41,    38,    45,   126,     0,     0,    63,     0,     0,
-    19,    34,   126,   121,   133,   126,     0,   112,    12,    14,
-    24,    27,    23,     0,     0,    16,    44,     0,   126,   126,
-     0,   126,   126,   126,     0,     0,   125,   126,     0,    39,
-     7,    46,    62,    42,   126,   126,   126,     0,   126,     0,
-   111,    18,     0,    17,     0,     0,   134,   123,    25,    28,
-    39,     0,     0,     0,     0,     0,    67,     0,     0,     0,
-   126,   126,     0,   126,   130,     0,   128,    61,     0,    64,
-    65,    66,    58,     0,    79,     0,   126,     9,     0,    21,
-   120,     0,    15,    59,   126,   126,     0,   126,   126,   126,
-     0,     0,    56,   131,     0,   126,    37,    78,    43,     0,
-    80,    83,     0,    13,     0,     0,   126,     0,    69,     0,
-     0,   126,   126,   126,    57,   127,     0,   126,    20,    51,
-    47,     0,   126,    49,    50,     0,     0,   132,    60,    82,
-     0,     0,     0,    74,    72,    52,    48,   126,    53,     0,
-    54,    71,     0,   126,    73,    77,    55,    75,     0,   126,
-     0,     0,    76,     0,     0,     0
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_uint8 yydefact[] =
+{
+       4,     0,   130,     1,     0,   130,     3,    16,     0,     0,
+     130,     0,    34,    35,   130,   130,     0,   130,     0,     0,
+       0,     0,   129,   130,     0,   129,   129,   130,   130,     0,
+       0,     0,     0,    15,     0,     0,     0,   130,   130,    12,
+     130,    37,     5,     0,   130,   110,   111,   130,   107,   130,
+     130,   130,   130,    88,   119,   130,   105,   106,     0,   117,
+     130,   130,   130,   130,   130,   130,   130,   130,   130,   130,
+     130,   130,   130,   130,   130,     0,   118,   130,   130,   130,
+     130,     0,     0,   115,   123,     0,     0,    43,    43,     0,
+       6,     7,    39,   130,    33,    36,     0,     0,     0,     0,
+       0,     0,   114,     0,   109,   108,    94,    98,    93,   103,
+     104,    96,    97,    90,    89,    91,    92,    95,   130,   101,
+     100,    99,   102,   126,   128,   130,     0,     0,     0,     0,
+       0,     0,     0,   112,   113,   121,   122,   120,   130,   141,
+       0,   139,   130,     0,     0,     0,    26,     0,    30,     0,
+       0,     0,   129,     0,     0,   130,     0,     0,     0,   130,
+     130,     0,     0,     0,    44,    40,   130,    45,    42,    49,
+     130,     0,     0,    67,     0,     0,   130,    23,    38,   130,
+     125,   137,   130,     0,   116,     8,    17,     9,    18,    28,
+      31,    27,    14,     0,    20,    48,     0,   130,   130,     0,
+     130,   130,   130,     0,     0,   129,   130,     0,    43,    11,
+      50,    66,    46,   130,   130,   130,     0,   130,     0,   115,
+      10,    22,     0,    21,     0,     0,   138,   127,    29,    32,
+       0,     0,     0,     0,     0,    71,     0,     0,     0,   130,
+     130,     0,   130,   134,     0,   132,    65,     0,    68,    69,
+      70,    62,     0,    83,     0,   130,    13,     0,    25,   124,
+      19,    63,   130,   130,     0,   130,   130,   130,     0,     0,
+      60,   135,     0,   130,    41,    82,    47,     0,    84,    87,
+       0,     0,     0,   130,     0,    73,     0,     0,   130,   130,
+     130,    61,   131,     0,   130,    24,    55,    51,     0,   130,
+      53,    54,     0,     0,   136,    64,    86,     0,     0,     0,
+      78,    76,    56,    52,   130,    57,     0,    58,    75,     0,
+     130,    77,    81,    59,    79,     0,   130,     0,     0,    80
 };
 
-static const short yydefgoto[] = {   324,
-     1,     4,    32,    33,    34,    35,   144,   213,   214,   145,
-     9,    10,    11,   162,   200,   124,   163,   164,   165,   166,
-   228,   278,   311,   309,   315,   312,   167,   270,   271,   168,
-   169,    28,   236,   237,     6,   135,   136
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -193,  -193,  -193,  -193,  -193,  -193,  -193,  -193,  -193,  -193,
+    -193,  -193,  -164,   110,   232,  -193,  -141,  -193,   -81,  -171,
+    -193,  -193,  -192,   -25,  -193,  -193,  -193,  -193,  -193,  -193,
+    -193,  -193,    -5,   -20,    85,  -193,     4,  -193,  -193,    94
 };
 
-static const short yypact[] = {-32768,
-     8,    12,   910,-32768,   -28,   -66,    -2,-32768,   -63,-32768,
-   -55,   910,   910,   -36,   910,   910,   -11,     6,    10,    30,
--32768,    31,-32768,-32768,   910,   910,   998,     7,    48,    89,
--32768,    23,    47,-32768,-32768,-32768,-32768,    44,-32768,    12,
-   910,   126,   126,   910,   126,   126,   910,   910,   910,   910,
--32768,   910,-32768,-32768,  1031,   126,   910,   910,   910,   910,
-   910,   910,   910,   910,   910,   910,   910,   910,   910,   910,
-   910,   910,   910,   910,   910,-32768,    70,   119,   121,    72,
--32768,    74,    76,-32768,   127,-32768,-32768,-32768,   910,-32768,
-  1586,  1063,  1095,  1127,  1159,  1191,  1223,-32768,  1512,   129,
-   205,  1630,   466,   543,   619,   619,    82,    82,    82,    82,
-    92,    92,     9,     9,   126,   126,   126,   770,    80,-32768,
-   910,   136,     0,   355,    88,   282,    93,-32768,-32768,-32768,
--32768,-32768,   910,  1586,    -4,-32768,   910,   677,    96,    96,
-    19,   107,-32768,   -14,   147,   102,-32768,   103,   106,-32768,
-   108,   110,   111,-32768,-32768,   152,   109,    12,-32768,-32768,
--32768,-32768,-32768,-32768,-32768,   115,   589,   765,    11,    17,
-    91,-32768,   910,  1610,-32768,   910,   701,-32768,-32768,-32768,
--32768,-32768,    71,   116,   101,-32768,-32768,   163,   910,   910,
-   589,   800,   910,   910,   122,   123,-32768,   242,    41,-32768,
--32768,-32768,-32768,-32768,   910,   910,   910,   118,   910,   202,
-     4,-32768,   172,   124,   194,   725,-32768,-32768,-32768,-32768,
--32768,   197,   151,  1255,  1287,   173,-32768,   154,  1319,  1351,
-   910,   910,   155,   910,  1586,    21,-32768,-32768,   433,  1586,
-  1586,  1586,-32768,  1537,-32768,   589,   841,-32768,   101,-32768,
--32768,   511,-32768,-32768,-32768,-32768,   153,   869,-32768,-32768,
-  1383,  1415,-32768,  1562,   159,   731,-32768,-32768,-32768,   208,
-   158,  1586,   210,-32768,   589,   589,   910,   165,  1586,   589,
-   589,-32768,-32768,   910,-32768,-32768,   166,   910,-32768,   217,
--32768,  1447,   884,-32768,-32768,    96,    96,  1586,-32768,  1586,
-   589,   169,   219,-32768,   186,-32768,-32768,-32768,   187,    96,
--32768,-32768,   589,    96,-32768,-32768,-32768,-32768,   175,   910,
-  1479,    96,-32768,   258,   259,-32768
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,     1,     2,     6,    34,    35,    36,    37,    38,   149,
+     222,   223,   150,    11,    12,    13,   167,   208,   128,   168,
+     169,   170,   171,   236,   284,   317,   315,   321,   318,   172,
+     277,   278,   173,   174,    30,   244,   245,     8,   140,   141
 };
 
-static const short yypgoto[] = {-32768,
--32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,  -160,
-   104,   224,-32768,  -138,-32768,  -181,  -149,-32768,-32768,  -188,
-   -17,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,    -3,
-   -18,    86,-32768,    -1,-32768,-32768,    99
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      29,   212,    53,   186,   188,    56,    57,   129,   235,    45,
+      46,   254,    48,   224,   192,     3,    -2,   216,    54,     9,
+     189,    42,    58,    59,    39,    43,   228,   190,   234,   230,
+      81,    81,   145,   229,    10,    31,    32,    82,    82,    95,
+      40,   185,    96,   165,    97,    98,    99,   100,   217,   218,
+     101,    44,    83,   219,    47,   103,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,   117,
+      49,   193,   119,   120,   121,   122,   146,    33,   147,   148,
+     246,    85,    86,   276,    43,   181,   182,     7,   131,   187,
+       4,   165,   255,   280,    50,    41,     5,   125,    51,    84,
+      84,    70,    71,    72,    73,    74,   146,   235,   147,   148,
+     296,   297,    52,   139,    55,   300,   301,   272,   273,    87,
+     143,    88,    90,    91,    89,    92,    76,   247,   146,   221,
+     147,   148,   196,   180,    93,    76,   312,   183,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,   323,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,   118,   123,
+     125,   310,   311,    72,    73,    74,   124,   126,    76,   130,
+      77,    78,    79,    80,   225,   322,   127,   139,    76,   324,
+      77,    78,    79,    80,   142,   241,    76,   329,   144,   177,
+     179,   191,   232,   233,   194,   195,   237,   238,   197,   198,
+     200,   243,   201,   202,   205,   206,   211,   231,   248,   249,
+     250,   239,   252,   175,   175,   240,   251,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    68,    69,    70,    71,
+      72,    73,    74,   253,   268,   269,   256,   271,   257,   258,
+     199,   260,   261,   264,   203,   204,    76,   265,    77,    78,
+     279,   209,   270,    76,   283,   210,   293,   175,   291,   294,
+     285,   220,   295,   299,   307,   305,   313,   314,   243,   165,
+     316,   320,   326,   207,   309,    94,   226,   292,   298,     0,
+       0,     0,     0,     0,   175,   304,     0,     0,     0,   306,
+      60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
+      70,    71,    72,    73,    74,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+       0,   327,     0,     0,     0,    76,     0,    77,    78,    79,
+      80,     0,   175,     0,     0,     0,     0,     0,     0,   175,
+      76,     0,    77,    78,    79,    80,     0,   281,   282,     0,
+       0,   286,   287,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   175,   175,     0,     0,
+       0,   175,   175,   302,   303,     0,   178,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   151,     0,     0,
+       0,   184,   175,     0,     0,  -130,     0,     0,     0,   319,
+      14,     0,  -130,     0,   175,   325,    15,    16,    17,    18,
+      19,    20,    21,     0,     0,     0,     0,  -130,    22,     0,
+       0,   152,  -129,     0,     0,    23,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   153,   154,   155,
+     156,   157,   158,  -129,  -129,   159,     0,   160,   161,   162,
+     163,     0,     0,    24,  -130,   151,     0,    25,    26,   164,
+      27,   165,   166,  -130,     0,     0,     0,    28,    14,     0,
+    -130,     0,     0,     0,    15,    16,    17,    18,    19,    20,
+      21,     0,     0,     0,     0,  -130,    22,     0,     0,   152,
+    -129,     0,     0,    23,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   153,   154,   155,   156,   157,
+     158,  -129,  -129,   159,     0,   160,   161,   162,   163,     0,
+       0,    24,  -130,   151,     0,    25,    26,   164,    27,   165,
+     176,  -130,     0,     0,     0,    28,    14,     0,  -130,     0,
+       0,     0,    15,    16,    17,    18,    19,    20,    21,     0,
+       0,     0,     0,  -130,    22,     0,     0,   152,  -129,     0,
+       0,    23,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   153,   154,   155,   156,   157,   158,  -129,
+    -129,   159,     0,   160,   161,   162,   163,     0,     0,    24,
+    -130,   151,     0,    25,    26,   164,    27,   165,   274,  -130,
+       0,     0,     0,    28,    14,     0,  -130,     0,     0,     0,
+      15,    16,    17,    18,    19,    20,    21,     0,     0,     0,
+       0,  -130,    22,     0,     0,   152,  -129,     0,     0,    23,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   153,   154,   155,   156,   157,   158,  -129,  -129,   159,
+       0,   160,   161,   162,   163,     0,     0,    24,  -130,     0,
+       0,    25,    26,   164,    27,   165,     0,     0,     0,     0,
+       0,    28,    60,    61,    62,    63,    64,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    60,    61,    62,
+      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,     0,     0,     0,     0,     0,    76,     0,    77,
+      78,    79,    80,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    76,     0,    77,    78,    79,    80,     0,     0,
+      60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
+      70,    71,    72,    73,    74,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   227,   213,
+     214,     0,     0,     0,     0,    76,     0,    77,    78,    79,
+      80,    14,     0,   259,     0,     0,     0,    15,    16,    17,
+      18,    19,    20,    21,     0,     0,     0,     0,     0,    22,
+       0,    14,     0,     0,     0,     0,    23,    15,    16,    17,
+      18,    19,    20,    21,     0,     0,     0,     0,     0,    22,
+       0,    14,     0,     0,   215,     0,    23,    15,    16,    17,
+      18,    19,    20,    21,     0,     0,     0,     0,     0,    22,
+       0,     0,     0,     0,    24,     0,    23,     0,    25,    26,
+       0,    27,     0,  -133,  -133,     0,     0,     0,    28,   242,
+       0,     0,     0,     0,    24,     0,     0,     0,    25,    26,
+       0,    27,     0,     0,     0,     0,     0,     0,    28,   242,
+       0,     0,     0,     0,    24,     0,     0,     0,    25,    26,
+       0,    27,     0,  -140,  -140,    14,     0,     0,    28,     0,
+       0,    15,    16,    17,    18,    19,    20,    21,     0,     0,
+       0,     0,     0,    22,     0,    14,     0,     0,     0,     0,
+      23,    15,    16,    17,    18,    19,    20,    21,     0,     0,
+       0,   -85,     0,    22,     0,    14,     0,     0,     0,     0,
+      23,    15,    16,    17,    18,    19,    20,    21,     0,     0,
+       0,     0,     0,    22,     0,     0,     0,     0,    24,     0,
+      23,     0,    25,    26,   -72,    27,     0,     0,     0,     0,
+       0,     0,    28,     0,     0,     0,     0,     0,    24,     0,
+       0,     0,    25,    26,     0,    27,     0,     0,     0,     0,
+       0,     0,    28,     0,     0,     0,     0,     0,    24,     0,
+       0,     0,    25,    26,   -74,    27,     0,    14,     0,     0,
+       0,     0,    28,    15,    16,    17,    18,    19,    20,    21,
+       0,     0,     0,   -72,     0,    22,     0,    14,     0,     0,
+       0,     0,    23,    15,    16,    17,    18,    19,    20,    21,
+       0,     0,     0,     0,     0,    22,     0,     0,     0,     0,
+       0,     0,    23,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      24,     0,     0,     0,    25,    26,     0,    27,     0,     0,
+       0,     0,     0,     0,    28,     0,     0,     0,     0,     0,
+      24,     0,     0,     0,    25,    26,     0,    27,     0,     0,
+       0,     0,     0,     0,    28,   138,    60,    61,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,   275,    60,    61,    62,    63,    64,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,     0,     0,     0,
+       0,    76,     0,    77,    78,    79,    80,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    76,     0,    77,
+      78,    79,    80,   290,    60,    61,    62,    63,    64,    65,
+      66,    67,    68,    69,    70,    71,    72,    73,    74,    60,
+      61,    62,    63,    64,    65,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,     0,     0,     0,     0,     0,    76,
+       0,    77,    78,    79,    80,     0,    75,     0,     0,     0,
+       0,     0,     0,     0,    76,     0,    77,    78,    79,    80,
+      60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
+      70,    71,    72,    73,    74,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   102,     0,     0,     0,
+       0,     0,     0,     0,     0,    76,     0,    77,    78,    79,
+      80,    60,    61,    62,    63,    64,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   132,     0,     0,
+       0,     0,     0,     0,     0,     0,    76,     0,    77,    78,
+      79,    80,    60,    61,    62,    63,    64,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   133,     0,
+       0,     0,     0,     0,     0,     0,     0,    76,     0,    77,
+      78,    79,    80,    60,    61,    62,    63,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   134,
+       0,     0,     0,     0,     0,     0,     0,     0,    76,     0,
+      77,    78,    79,    80,    60,    61,    62,    63,    64,    65,
+      66,    67,    68,    69,    70,    71,    72,    73,    74,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     135,     0,     0,     0,     0,     0,     0,     0,     0,    76,
+       0,    77,    78,    79,    80,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   136,     0,     0,     0,     0,     0,     0,     0,     0,
+      76,     0,    77,    78,    79,    80,    60,    61,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   137,     0,     0,     0,     0,     0,     0,     0,
+       0,    76,     0,    77,    78,    79,    80,    60,    61,    62,
+      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   262,     0,     0,     0,     0,     0,     0,
+       0,     0,    76,     0,    77,    78,    79,    80,    60,    61,
+      62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   263,     0,     0,     0,     0,     0,
+       0,     0,     0,    76,     0,    77,    78,    79,    80,    60,
+      61,    62,    63,    64,    65,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   266,     0,     0,     0,     0,
+       0,     0,     0,     0,    76,     0,    77,    78,    79,    80,
+      60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
+      70,    71,    72,    73,    74,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   267,     0,     0,     0,
+       0,     0,     0,     0,     0,    76,     0,    77,    78,    79,
+      80,    60,    61,    62,    63,    64,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   288,     0,     0,
+       0,     0,     0,     0,     0,     0,    76,     0,    77,    78,
+      79,    80,    60,    61,    62,    63,    64,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   289,     0,
+       0,     0,     0,     0,     0,     0,     0,    76,     0,    77,
+      78,    79,    80,    60,    61,    62,    63,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   308,
+       0,     0,     0,     0,     0,     0,     0,     0,    76,     0,
+      77,    78,    79,    80,    60,    61,    62,    63,    64,    65,
+      66,    67,    68,    69,    70,    71,    72,    73,    74,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     328,     0,     0,     0,     0,     0,     0,     0,     0,    76,
+       0,    77,    78,    79,    80,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+    -141,    61,    62,    63,    64,    65,    66,    67,    68,    69,
+      70,    71,    72,    73,    74,     0,     0,     0,     0,     0,
+      76,     0,    77,    78,    79,    80,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    76,     0,    77,    78,    79,
+      80,    62,    63,    64,    65,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,    63,    64,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,     0,     0,     0,     0,
+       0,     0,     0,     0,    76,     0,    77,    78,    79,    80,
+       0,     0,     0,     0,     0,     0,    76,     0,    77,    78,
+      79,    80,    64,    65,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    76,     0,    77,    78,    79,    80
 };
 
+static const yytype_int16 yycheck[] =
+{
+       5,   172,    22,   144,   145,    25,    26,    88,   200,    14,
+      15,     3,    17,   177,    30,     0,     0,    36,    23,    16,
+       9,    83,    27,    28,    83,    87,     9,    16,   199,   193,
+       9,     9,    30,    16,    31,    37,    38,    16,    16,    44,
+      31,    83,    47,    85,    49,    50,    51,    52,    67,    68,
+      55,    88,    31,    31,    84,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      84,    87,    77,    78,    79,    80,    74,    79,    76,    77,
+      83,    31,    31,   254,    87,    86,    87,     2,    93,    83,
+      74,    85,    84,   257,    84,    10,    80,    89,    84,    78,
+      78,    14,    15,    16,    17,    18,    74,   299,    76,    77,
+     281,   282,    84,   118,    84,   286,   287,    86,    87,    85,
+     125,    85,    37,    38,    75,    40,    39,   208,    74,    75,
+      76,    77,   152,   138,    89,    39,   307,   142,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    18,   319,    10,
+      11,    12,    13,    14,    15,    16,    17,    18,    85,    31,
+      89,   302,   303,    16,    17,    18,    31,    84,    39,    31,
+      41,    42,    43,    44,   179,   316,    84,   182,    39,   320,
+      41,    42,    43,    44,    89,   205,    39,   328,    30,    84,
+      89,    74,   197,   198,    31,    83,   201,   202,    84,    84,
+      84,   206,    84,    84,    31,    85,    83,    31,   213,   214,
+     215,    84,   217,   128,   129,    84,    83,    10,    11,    12,
+      13,    14,    15,    16,    17,    18,    12,    13,    14,    15,
+      16,    17,    18,     3,   239,   240,    30,   242,    87,    31,
+     155,    31,    83,    62,   159,   160,    39,    83,    41,    42,
+     255,   166,    83,    39,    84,   170,    30,   172,    83,    87,
+     265,   176,    31,    83,    28,    83,    83,    30,   273,    85,
+      70,    70,    84,   163,   299,    43,   182,   273,   283,    -1,
+      -1,    -1,    -1,    -1,   199,   290,    -1,    -1,    -1,   294,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    18,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
+      -1,   326,    -1,    -1,    -1,    39,    -1,    41,    42,    43,
+      44,    -1,   247,    -1,    -1,    -1,    -1,    -1,    -1,   254,
+      39,    -1,    41,    42,    43,    44,    -1,   262,   263,    -1,
+      -1,   266,   267,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   281,   282,    -1,    -1,
+      -1,   286,   287,   288,   289,    -1,    90,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,     1,    -1,    -1,
+      -1,    90,   307,    -1,    -1,     9,    -1,    -1,    -1,   314,
+      14,    -1,    16,    -1,   319,   320,    20,    21,    22,    23,
+      24,    25,    26,    -1,    -1,    -1,    -1,    31,    32,    -1,
+      -1,    35,    36,    -1,    -1,    39,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    61,    62,    63,
+      64,    65,    66,    67,    68,    69,    -1,    71,    72,    73,
+      74,    -1,    -1,    77,    78,     1,    -1,    81,    82,    83,
+      84,    85,    86,     9,    -1,    -1,    -1,    91,    14,    -1,
+      16,    -1,    -1,    -1,    20,    21,    22,    23,    24,    25,
+      26,    -1,    -1,    -1,    -1,    31,    32,    -1,    -1,    35,
+      36,    -1,    -1,    39,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    61,    62,    63,    64,    65,
+      66,    67,    68,    69,    -1,    71,    72,    73,    74,    -1,
+      -1,    77,    78,     1,    -1,    81,    82,    83,    84,    85,
+      86,     9,    -1,    -1,    -1,    91,    14,    -1,    16,    -1,
+      -1,    -1,    20,    21,    22,    23,    24,    25,    26,    -1,
+      -1,    -1,    -1,    31,    32,    -1,    -1,    35,    36,    -1,
+      -1,    39,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    61,    62,    63,    64,    65,    66,    67,
+      68,    69,    -1,    71,    72,    73,    74,    -1,    -1,    77,
+      78,     1,    -1,    81,    82,    83,    84,    85,    86,     9,
+      -1,    -1,    -1,    91,    14,    -1,    16,    -1,    -1,    -1,
+      20,    21,    22,    23,    24,    25,    26,    -1,    -1,    -1,
+      -1,    31,    32,    -1,    -1,    35,    36,    -1,    -1,    39,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    61,    62,    63,    64,    65,    66,    67,    68,    69,
+      -1,    71,    72,    73,    74,    -1,    -1,    77,    78,    -1,
+      -1,    81,    82,    83,    84,    85,    -1,    -1,    -1,    -1,
+      -1,    91,     4,     5,     6,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    18,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    18,    -1,    -1,    -1,    -1,    -1,    39,    -1,    41,
+      42,    43,    44,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    39,    -1,    41,    42,    43,    44,    -1,    -1,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    18,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    90,    33,
+      34,    -1,    -1,    -1,    -1,    39,    -1,    41,    42,    43,
+      44,    14,    -1,    90,    -1,    -1,    -1,    20,    21,    22,
+      23,    24,    25,    26,    -1,    -1,    -1,    -1,    -1,    32,
+      -1,    14,    -1,    -1,    -1,    -1,    39,    20,    21,    22,
+      23,    24,    25,    26,    -1,    -1,    -1,    -1,    -1,    32,
+      -1,    14,    -1,    -1,    88,    -1,    39,    20,    21,    22,
+      23,    24,    25,    26,    -1,    -1,    -1,    -1,    -1,    32,
+      -1,    -1,    -1,    -1,    77,    -1,    39,    -1,    81,    82,
+      -1,    84,    -1,    86,    87,    -1,    -1,    -1,    91,    92,
+      -1,    -1,    -1,    -1,    77,    -1,    -1,    -1,    81,    82,
+      -1,    84,    -1,    -1,    -1,    -1,    -1,    -1,    91,    92,
+      -1,    -1,    -1,    -1,    77,    -1,    -1,    -1,    81,    82,
+      -1,    84,    -1,    86,    87,    14,    -1,    -1,    91,    -1,
+      -1,    20,    21,    22,    23,    24,    25,    26,    -1,    -1,
+      -1,    -1,    -1,    32,    -1,    14,    -1,    -1,    -1,    -1,
+      39,    20,    21,    22,    23,    24,    25,    26,    -1,    -1,
+      -1,    30,    -1,    32,    -1,    14,    -1,    -1,    -1,    -1,
+      39,    20,    21,    22,    23,    24,    25,    26,    -1,    -1,
+      -1,    -1,    -1,    32,    -1,    -1,    -1,    -1,    77,    -1,
+      39,    -1,    81,    82,    83,    84,    -1,    -1,    -1,    -1,
+      -1,    -1,    91,    -1,    -1,    -1,    -1,    -1,    77,    -1,
+      -1,    -1,    81,    82,    -1,    84,    -1,    -1,    -1,    -1,
+      -1,    -1,    91,    -1,    -1,    -1,    -1,    -1,    77,    -1,
+      -1,    -1,    81,    82,    83,    84,    -1,    14,    -1,    -1,
+      -1,    -1,    91,    20,    21,    22,    23,    24,    25,    26,
+      -1,    -1,    -1,    30,    -1,    32,    -1,    14,    -1,    -1,
+      -1,    -1,    39,    20,    21,    22,    23,    24,    25,    26,
+      -1,    -1,    -1,    -1,    -1,    32,    -1,    -1,    -1,    -1,
+      -1,    -1,    39,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      77,    -1,    -1,    -1,    81,    82,    -1,    84,    -1,    -1,
+      -1,    -1,    -1,    -1,    91,    -1,    -1,    -1,    -1,    -1,
+      77,    -1,    -1,    -1,    81,    82,    -1,    84,    -1,    -1,
+      -1,    -1,    -1,    -1,    91,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,     3,     4,     5,     6,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    18,    -1,    -1,    -1,
+      -1,    39,    -1,    41,    42,    43,    44,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    39,    -1,    41,
+      42,    43,    44,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    18,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    -1,    -1,    -1,    -1,    -1,    39,
+      -1,    41,    42,    43,    44,    -1,    31,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    39,    -1,    41,    42,    43,    44,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    18,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    30,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    39,    -1,    41,    42,    43,
+      44,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    18,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    30,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    39,    -1,    41,    42,
+      43,    44,     4,     5,     6,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    18,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    30,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    39,    -1,    41,
+      42,    43,    44,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    18,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    30,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    39,    -1,
+      41,    42,    43,    44,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    18,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      30,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    39,
+      -1,    41,    42,    43,    44,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    30,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      39,    -1,    41,    42,    43,    44,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    30,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    39,    -1,    41,    42,    43,    44,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    18,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    30,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    39,    -1,    41,    42,    43,    44,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    30,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    39,    -1,    41,    42,    43,    44,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    30,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    39,    -1,    41,    42,    43,    44,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    18,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    30,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    39,    -1,    41,    42,    43,
+      44,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    18,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    30,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    39,    -1,    41,    42,
+      43,    44,     4,     5,     6,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    18,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    30,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    39,    -1,    41,
+      42,    43,    44,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    18,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    30,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    39,    -1,
+      41,    42,    43,    44,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    18,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      30,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    39,
+      -1,    41,    42,    43,    44,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    18,    -1,    -1,    -1,    -1,    -1,
+      39,    -1,    41,    42,    43,    44,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    39,    -1,    41,    42,    43,
+      44,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    18,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    39,    -1,    41,    42,    43,    44,
+      -1,    -1,    -1,    -1,    -1,    -1,    39,    -1,    41,    42,
+      43,    44,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    39,    -1,    41,    42,    43,    44
+};
 
-#define	YYLAST		1657
-
-
-static const short yytable[] = {    27,
-   179,   180,    51,   227,    53,    54,   246,    -1,    42,    43,
-   215,    45,    46,    29,    30,    78,    36,   204,   239,    39,
-   184,    55,    56,    40,   222,    78,    79,   181,    73,    74,
-    75,     7,    41,    37,   140,    76,    79,    91,   182,   252,
-    92,   226,    80,    93,    94,    95,    96,     8,    97,    44,
-    31,   208,   211,    99,   100,   101,   102,   103,   104,   105,
-   106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
-   116,   117,   185,   141,    47,   142,   143,   209,   210,   219,
-   175,     2,   176,    82,    81,   126,     5,     3,   273,   247,
-   220,    48,   121,    38,    81,    49,   269,    69,    70,    71,
-    72,    73,    74,    75,   227,   265,    84,   266,    76,    71,
-    72,    73,    74,    75,   134,    50,    52,   138,    76,    86,
-    87,    85,    88,   238,    83,   290,   291,    40,   188,   174,
-   294,   295,    89,   177,    59,    60,    61,    62,    63,    64,
-    65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-    75,   306,    76,   118,   119,    76,   120,   304,   305,   122,
-   121,   123,   125,   317,   141,   212,   142,   143,   137,   216,
-   139,   316,   134,   171,   141,   318,   142,   143,   233,   160,
-   183,   173,   186,   323,   187,   224,   225,   197,   189,   229,
-   230,   190,   198,   192,   235,   193,   194,   203,   223,   221,
-   243,   240,   241,   242,   245,   244,   248,   231,   232,   170,
-   249,    60,    61,    62,    63,    64,    65,    66,    67,    68,
-    69,    70,    71,    72,    73,    74,    75,   261,   262,   250,
-   264,    76,   253,   254,   257,   191,   258,   263,   277,   195,
-   196,   285,   287,   272,   288,   289,   201,   293,   299,   301,
-   202,   307,   170,   308,   279,   310,   314,   325,   326,    12,
-   320,   199,   235,    90,   286,    13,    14,    15,    16,    17,
-    18,    19,    20,   292,   217,   303,   170,     0,    21,     0,
-   298,     0,     0,     0,   300,    57,    58,    59,    60,    61,
-    62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
-    72,    73,    74,    75,     0,     0,     0,     0,    76,     0,
-     0,     0,     0,     0,     0,     0,   321,     0,    22,     0,
-     0,     0,    23,    24,   170,     0,  -129,    25,  -129,     0,
-     0,   170,    26,   234,     0,     0,     0,   170,     0,     0,
-   275,   276,     0,     0,   280,   281,     0,     0,     0,     0,
-     0,     0,     0,     0,     0,   146,     0,     0,     0,     0,
-   170,   170,     0,  -126,     0,   170,   170,   296,   297,     0,
-     0,   172,    12,     0,  -126,     0,     0,     0,    13,    14,
-    15,    16,    17,    18,    19,    20,   170,     0,     0,     0,
-  -126,    21,     0,   313,   147,  -125,     0,     0,   170,   319,
-     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     0,     0,     0,     0,     0,   148,   149,   150,   151,   152,
-   153,  -125,  -125,   154,     0,   155,   156,   157,   158,     0,
-     0,    22,  -126,   146,     0,    23,    24,   159,   160,   161,
-    25,  -126,     0,     0,     0,    26,     0,     0,     0,     0,
-    12,     0,  -126,     0,     0,     0,    13,    14,    15,    16,
-    17,    18,    19,    20,     0,     0,     0,     0,  -126,    21,
-     0,     0,   147,  -125,    62,    63,    64,    65,    66,    67,
-    68,    69,    70,    71,    72,    73,    74,    75,     0,     0,
-     0,     0,    76,   148,   149,   150,   151,   152,   153,  -125,
-  -125,   154,     0,   155,   156,   157,   158,     0,     0,    22,
-  -126,   146,     0,    23,    24,   159,   160,   267,    25,  -126,
-     0,     0,     0,    26,     0,     0,     0,     0,    12,     0,
-  -126,     0,     0,     0,    13,    14,    15,    16,    17,    18,
-    19,    20,     0,     0,     0,     0,  -126,    21,     0,     0,
-   147,  -125,    63,    64,    65,    66,    67,    68,    69,    70,
-    71,    72,    73,    74,    75,     0,     0,     0,     0,    76,
-     0,   148,   149,   150,   151,   152,   153,  -125,  -125,   154,
-     0,   155,   156,   157,   158,     0,     0,    22,  -126,   146,
-     0,    23,    24,   159,   160,   274,    25,  -126,     0,     0,
-     0,    26,     0,     0,     0,     0,    12,     0,  -126,     0,
-     0,     0,    13,    14,    15,    16,    17,    18,    19,    20,
-     0,     0,     0,     0,  -126,    21,     0,     0,   147,  -125,
-    65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-    75,     0,     0,     0,     0,    76,     0,     0,     0,   148,
-   149,   150,   151,   152,   153,  -125,  -125,   154,     0,   155,
-   156,   157,   158,     0,     0,    22,  -126,     0,     0,    23,
-    24,   159,   160,     0,    25,     0,     0,     0,     0,    26,
-    57,    58,    59,    60,    61,    62,    63,    64,    65,    66,
-    67,    68,    69,    70,    71,    72,    73,    74,    75,     0,
-     0,     0,     0,    76,    57,    58,    59,    60,    61,    62,
-    63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
-    73,    74,    75,     0,     0,     0,     0,    76,    57,    58,
-    59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
-    69,    70,    71,    72,    73,    74,    75,     0,    12,     0,
-     0,    76,     0,     0,    13,    14,    15,    16,    17,    18,
-    19,    20,     0,     0,     0,     0,   178,    21,    57,    58,
-    59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
-    69,    70,    71,    72,    73,    74,    75,    12,     0,     0,
-   218,    76,     0,    13,    14,    15,    16,    17,    18,    19,
-    20,     0,   205,   206,     0,     0,    21,    22,     0,     0,
-     0,    23,    24,     0,   251,     0,    25,    12,     0,     0,
-     0,    26,   234,    13,    14,    15,    16,    17,    18,    19,
-    20,     0,     0,     0,     0,     0,    21,     0,     0,     0,
-     0,     0,     0,     0,     0,     0,    22,     0,     0,     0,
-    23,    24,   207,     0,  -136,    25,  -136,     0,    12,     0,
-    26,     0,     0,     0,    13,    14,    15,    16,    17,    18,
-    19,    20,     0,     0,     0,   -81,    22,    21,     0,     0,
-    23,    24,   -68,     0,     0,    25,    12,     0,     0,     0,
-    26,     0,    13,    14,    15,    16,    17,    18,    19,    20,
-     0,    12,     0,     0,     0,    21,     0,    13,    14,    15,
-    16,    17,    18,    19,    20,     0,     0,    22,   -68,     0,
-    21,    23,    24,     0,     0,     0,    25,    12,     0,     0,
-     0,    26,     0,    13,    14,    15,    16,    17,    18,    19,
-    20,     0,     0,     0,     0,    22,    21,     0,     0,    23,
-    24,   -70,     0,     0,    25,     0,     0,     0,     0,    26,
-    22,     0,     0,     0,    23,    24,     0,     0,     0,    25,
-     0,     0,     0,     0,    26,     0,     0,     0,     0,     0,
-     0,     0,     0,     0,     0,     0,    22,     0,     0,     0,
-    23,    24,     0,     0,     0,    25,     0,     0,     0,     0,
-    26,    57,    58,    59,    60,    61,    62,    63,    64,    65,
-    66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
-     0,     0,     0,     0,    76,     0,     0,     0,     0,     0,
-     0,     0,     0,    77,    57,    58,    59,    60,    61,    62,
-    63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
-    73,    74,    75,     0,     0,     0,     0,    76,     0,     0,
-     0,     0,     0,     0,     0,    98,    57,    58,    59,    60,
-    61,    62,    63,    64,    65,    66,    67,    68,    69,    70,
-    71,    72,    73,    74,    75,     0,     0,     0,     0,    76,
-     0,     0,     0,     0,     0,     0,     0,   127,    57,    58,
-    59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
-    69,    70,    71,    72,    73,    74,    75,     0,     0,     0,
-     0,    76,     0,     0,     0,     0,     0,     0,     0,   128,
-    57,    58,    59,    60,    61,    62,    63,    64,    65,    66,
-    67,    68,    69,    70,    71,    72,    73,    74,    75,     0,
-     0,     0,     0,    76,     0,     0,     0,     0,     0,     0,
-     0,   129,    57,    58,    59,    60,    61,    62,    63,    64,
-    65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-    75,     0,     0,     0,     0,    76,     0,     0,     0,     0,
-     0,     0,     0,   130,    57,    58,    59,    60,    61,    62,
-    63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
-    73,    74,    75,     0,     0,     0,     0,    76,     0,     0,
-     0,     0,     0,     0,     0,   131,    57,    58,    59,    60,
-    61,    62,    63,    64,    65,    66,    67,    68,    69,    70,
-    71,    72,    73,    74,    75,     0,     0,     0,     0,    76,
-     0,     0,     0,     0,     0,     0,     0,   132,    57,    58,
-    59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
-    69,    70,    71,    72,    73,    74,    75,     0,     0,     0,
-     0,    76,     0,     0,     0,     0,     0,     0,     0,   255,
-    57,    58,    59,    60,    61,    62,    63,    64,    65,    66,
-    67,    68,    69,    70,    71,    72,    73,    74,    75,     0,
-     0,     0,     0,    76,     0,     0,     0,     0,     0,     0,
-     0,   256,    57,    58,    59,    60,    61,    62,    63,    64,
-    65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-    75,     0,     0,     0,     0,    76,     0,     0,     0,     0,
-     0,     0,     0,   259,    57,    58,    59,    60,    61,    62,
-    63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
-    73,    74,    75,     0,     0,     0,     0,    76,     0,     0,
-     0,     0,     0,     0,     0,   260,    57,    58,    59,    60,
-    61,    62,    63,    64,    65,    66,    67,    68,    69,    70,
-    71,    72,    73,    74,    75,     0,     0,     0,     0,    76,
-     0,     0,     0,     0,     0,     0,     0,   282,    57,    58,
-    59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
-    69,    70,    71,    72,    73,    74,    75,     0,     0,     0,
-     0,    76,     0,     0,     0,     0,     0,     0,     0,   283,
-    57,    58,    59,    60,    61,    62,    63,    64,    65,    66,
-    67,    68,    69,    70,    71,    72,    73,    74,    75,     0,
-     0,     0,     0,    76,     0,     0,     0,     0,     0,     0,
-     0,   302,    57,    58,    59,    60,    61,    62,    63,    64,
-    65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-    75,     0,     0,     0,     0,    76,     0,     0,     0,     0,
-     0,     0,     0,   322,   133,    57,    58,    59,    60,    61,
-    62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
-    72,    73,    74,    75,     0,     0,     0,     0,    76,   268,
-    57,    58,    59,    60,    61,    62,    63,    64,    65,    66,
-    67,    68,    69,    70,    71,    72,    73,    74,    75,     0,
-     0,     0,     0,    76,   284,    57,    58,    59,    60,    61,
-    62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
-    72,    73,    74,    75,     0,     0,     0,     0,    76,    57,
-    58,    59,    60,    61,    62,    63,    64,    65,    66,    67,
-    68,    69,    70,    71,    72,    73,    74,    75,     0,     0,
-     0,     0,    76,-32768,    58,    59,    60,    61,    62,    63,
-    64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
-    74,    75,     0,     0,     0,     0,    76,    61,    62,    63,
-    64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
-    74,    75,     0,     0,     0,     0,    76
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_uint8 yystos[] =
+{
+       0,    94,    95,     0,    74,    80,    96,   127,   130,    16,
+      31,   106,   107,   108,    14,    20,    21,    22,    23,    24,
+      25,    26,    32,    39,    77,    81,    82,    84,    91,   125,
+     127,    37,    38,    79,    97,    98,    99,   100,   101,    83,
+      31,   127,    83,    87,    88,   125,   125,    84,   125,    84,
+      84,    84,    84,   126,   125,    84,   126,   126,   125,   125,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    18,    31,    39,    41,    42,    43,
+      44,     9,    16,    31,    78,    31,    31,    85,    85,    75,
+     127,   127,   127,    89,   107,   125,   125,   125,   125,   125,
+     125,   125,    30,   125,   125,   125,   125,   125,   125,   125,
+     125,   125,   125,   125,   125,   125,   125,   125,    85,   125,
+     125,   125,   125,    31,    31,    89,    84,    84,   111,   111,
+      31,   125,    30,    30,    30,    30,    30,    30,     3,   125,
+     131,   132,    89,   125,    30,    30,    74,    76,    77,   102,
+     105,     1,    35,    61,    62,    63,    64,    65,    66,    69,
+      71,    72,    73,    74,    83,    85,    86,   109,   112,   113,
+     114,   115,   122,   125,   126,   127,    86,    84,    90,    89,
+     125,    86,    87,   125,    90,    83,   109,    83,   109,     9,
+      16,    74,    30,    87,    31,    83,   126,    84,    84,   127,
+      84,    84,    84,   127,   127,    31,    85,   106,   110,   127,
+     127,    83,   112,    33,    34,    88,    36,    67,    68,    31,
+     127,    75,   103,   104,   105,   125,   132,    90,     9,    16,
+     105,    31,   125,   125,   112,   115,   116,   125,   125,    84,
+      84,   126,    92,   125,   128,   129,    83,   111,   125,   125,
+     125,    83,   125,     3,     3,    84,    30,    87,    31,    90,
+      31,    83,    30,    30,    62,    83,    30,    30,   125,   125,
+      83,   125,    86,    87,    86,     3,   112,   123,   124,   125,
+     105,   127,   127,    84,   117,   125,   127,   127,    30,    30,
+       3,    83,   129,    30,    87,    31,   112,   112,   125,    83,
+     112,   112,   127,   127,   125,    83,   125,    28,    30,   116,
+     109,   109,   112,    83,    30,   119,    70,   118,   121,   127,
+      70,   120,   109,   112,   109,   127,    84,   125,    30,   109
 };
 
-static const short yycheck[] = {     3,
-   139,   140,    21,   192,    23,    24,     3,     0,    12,    13,
-   171,    15,    16,    42,    43,     9,    83,   167,   200,    83,
-    35,    25,    26,    87,   185,     9,    20,     9,    20,    21,
-    22,    20,    88,    36,    35,    27,    20,    41,    20,   221,
-    44,   191,    36,    47,    48,    49,    50,    36,    52,    86,
-    79,    41,    36,    57,    58,    59,    60,    61,    62,    63,
-    64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
-    74,    75,    87,    74,    86,    76,    77,    67,    68,     9,
-    85,    74,    87,    36,    78,    89,     1,    80,   249,    86,
-    20,    86,    89,     8,    78,    86,   246,    16,    17,    18,
-    19,    20,    21,    22,   293,    85,    84,    87,    27,    18,
-    19,    20,    21,    22,   118,    86,    86,   121,    27,    34,
-    35,    75,    37,    83,    36,   275,   276,    87,   147,   133,
-   280,   281,    89,   137,     6,     7,     8,     9,    10,    11,
-    12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-    22,   301,    27,    84,    36,    27,    36,   296,   297,    86,
-    89,    86,    36,   313,    74,    75,    76,    77,    89,   173,
-    35,   310,   176,    86,    74,   314,    76,    77,   197,    84,
-    74,    89,    36,   322,    83,   189,   190,    36,    86,   193,
-   194,    86,    84,    86,   198,    86,    86,    83,    36,    84,
-    83,   205,   206,   207,     3,   209,    35,    86,    86,   124,
-    87,     7,     8,     9,    10,    11,    12,    13,    14,    15,
-    16,    17,    18,    19,    20,    21,    22,   231,   232,    36,
-   234,    27,    36,    83,    62,   150,    83,    83,    86,   154,
-   155,    83,    35,   247,    87,    36,   161,    83,    83,    33,
-   165,    83,   167,    35,   258,    70,    70,     0,     0,    18,
-    86,   158,   266,    40,   266,    24,    25,    26,    27,    28,
-    29,    30,    31,   277,   176,   293,   191,    -1,    37,    -1,
-   284,    -1,    -1,    -1,   288,     4,     5,     6,     7,     8,
-     9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
-    19,    20,    21,    22,    -1,    -1,    -1,    -1,    27,    -1,
-    -1,    -1,    -1,    -1,    -1,    -1,   320,    -1,    77,    -1,
-    -1,    -1,    81,    82,   239,    -1,    85,    86,    87,    -1,
-    -1,   246,    91,    92,    -1,    -1,    -1,   252,    -1,    -1,
-   255,   256,    -1,    -1,   259,   260,    -1,    -1,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,     1,    -1,    -1,    -1,    -1,
-   275,   276,    -1,     9,    -1,   280,   281,   282,   283,    -1,
-    -1,    90,    18,    -1,    20,    -1,    -1,    -1,    24,    25,
-    26,    27,    28,    29,    30,    31,   301,    -1,    -1,    -1,
-    36,    37,    -1,   308,    40,    41,    -1,    -1,   313,   314,
-    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    61,    62,    63,    64,    65,
-    66,    67,    68,    69,    -1,    71,    72,    73,    74,    -1,
-    -1,    77,    78,     1,    -1,    81,    82,    83,    84,    85,
-    86,     9,    -1,    -1,    -1,    91,    -1,    -1,    -1,    -1,
-    18,    -1,    20,    -1,    -1,    -1,    24,    25,    26,    27,
-    28,    29,    30,    31,    -1,    -1,    -1,    -1,    36,    37,
-    -1,    -1,    40,    41,     9,    10,    11,    12,    13,    14,
-    15,    16,    17,    18,    19,    20,    21,    22,    -1,    -1,
-    -1,    -1,    27,    61,    62,    63,    64,    65,    66,    67,
-    68,    69,    -1,    71,    72,    73,    74,    -1,    -1,    77,
-    78,     1,    -1,    81,    82,    83,    84,    85,    86,     9,
-    -1,    -1,    -1,    91,    -1,    -1,    -1,    -1,    18,    -1,
-    20,    -1,    -1,    -1,    24,    25,    26,    27,    28,    29,
-    30,    31,    -1,    -1,    -1,    -1,    36,    37,    -1,    -1,
-    40,    41,    10,    11,    12,    13,    14,    15,    16,    17,
-    18,    19,    20,    21,    22,    -1,    -1,    -1,    -1,    27,
-    -1,    61,    62,    63,    64,    65,    66,    67,    68,    69,
-    -1,    71,    72,    73,    74,    -1,    -1,    77,    78,     1,
-    -1,    81,    82,    83,    84,    85,    86,     9,    -1,    -1,
-    -1,    91,    -1,    -1,    -1,    -1,    18,    -1,    20,    -1,
-    -1,    -1,    24,    25,    26,    27,    28,    29,    30,    31,
-    -1,    -1,    -1,    -1,    36,    37,    -1,    -1,    40,    41,
-    12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-    22,    -1,    -1,    -1,    -1,    27,    -1,    -1,    -1,    61,
-    62,    63,    64,    65,    66,    67,    68,    69,    -1,    71,
-    72,    73,    74,    -1,    -1,    77,    78,    -1,    -1,    81,
-    82,    83,    84,    -1,    86,    -1,    -1,    -1,    -1,    91,
-     4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
-    14,    15,    16,    17,    18,    19,    20,    21,    22,    -1,
-    -1,    -1,    -1,    27,     4,     5,     6,     7,     8,     9,
-    10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-    20,    21,    22,    -1,    -1,    -1,    -1,    27,     4,     5,
-     6,     7,     8,     9,    10,    11,    12,    13,    14,    15,
-    16,    17,    18,    19,    20,    21,    22,    -1,    18,    -1,
-    -1,    27,    -1,    -1,    24,    25,    26,    27,    28,    29,
-    30,    31,    -1,    -1,    -1,    -1,    90,    37,     4,     5,
-     6,     7,     8,     9,    10,    11,    12,    13,    14,    15,
-    16,    17,    18,    19,    20,    21,    22,    18,    -1,    -1,
-    90,    27,    -1,    24,    25,    26,    27,    28,    29,    30,
-    31,    -1,    38,    39,    -1,    -1,    37,    77,    -1,    -1,
-    -1,    81,    82,    -1,    90,    -1,    86,    18,    -1,    -1,
-    -1,    91,    92,    24,    25,    26,    27,    28,    29,    30,
-    31,    -1,    -1,    -1,    -1,    -1,    37,    -1,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    -1,    77,    -1,    -1,    -1,
-    81,    82,    88,    -1,    85,    86,    87,    -1,    18,    -1,
-    91,    -1,    -1,    -1,    24,    25,    26,    27,    28,    29,
-    30,    31,    -1,    -1,    -1,    35,    77,    37,    -1,    -1,
-    81,    82,    83,    -1,    -1,    86,    18,    -1,    -1,    -1,
-    91,    -1,    24,    25,    26,    27,    28,    29,    30,    31,
-    -1,    18,    -1,    -1,    -1,    37,    -1,    24,    25,    26,
-    27,    28,    29,    30,    31,    -1,    -1,    77,    35,    -1,
-    37,    81,    82,    -1,    -1,    -1,    86,    18,    -1,    -1,
-    -1,    91,    -1,    24,    25,    26,    27,    28,    29,    30,
-    31,    -1,    -1,    -1,    -1,    77,    37,    -1,    -1,    81,
-    82,    83,    -1,    -1,    86,    -1,    -1,    -1,    -1,    91,
-    77,    -1,    -1,    -1,    81,    82,    -1,    -1,    -1,    86,
-    -1,    -1,    -1,    -1,    91,    -1,    -1,    -1,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    -1,    77,    -1,    -1,    -1,
-    81,    82,    -1,    -1,    -1,    86,    -1,    -1,    -1,    -1,
-    91,     4,     5,     6,     7,     8,     9,    10,    11,    12,
-    13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
-    -1,    -1,    -1,    -1,    27,    -1,    -1,    -1,    -1,    -1,
-    -1,    -1,    -1,    36,     4,     5,     6,     7,     8,     9,
-    10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-    20,    21,    22,    -1,    -1,    -1,    -1,    27,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    35,     4,     5,     6,     7,
-     8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
-    18,    19,    20,    21,    22,    -1,    -1,    -1,    -1,    27,
-    -1,    -1,    -1,    -1,    -1,    -1,    -1,    35,     4,     5,
-     6,     7,     8,     9,    10,    11,    12,    13,    14,    15,
-    16,    17,    18,    19,    20,    21,    22,    -1,    -1,    -1,
-    -1,    27,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    35,
-     4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
-    14,    15,    16,    17,    18,    19,    20,    21,    22,    -1,
-    -1,    -1,    -1,    27,    -1,    -1,    -1,    -1,    -1,    -1,
-    -1,    35,     4,     5,     6,     7,     8,     9,    10,    11,
-    12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-    22,    -1,    -1,    -1,    -1,    27,    -1,    -1,    -1,    -1,
-    -1,    -1,    -1,    35,     4,     5,     6,     7,     8,     9,
-    10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-    20,    21,    22,    -1,    -1,    -1,    -1,    27,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    35,     4,     5,     6,     7,
-     8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
-    18,    19,    20,    21,    22,    -1,    -1,    -1,    -1,    27,
-    -1,    -1,    -1,    -1,    -1,    -1,    -1,    35,     4,     5,
-     6,     7,     8,     9,    10,    11,    12,    13,    14,    15,
-    16,    17,    18,    19,    20,    21,    22,    -1,    -1,    -1,
-    -1,    27,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    35,
-     4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
-    14,    15,    16,    17,    18,    19,    20,    21,    22,    -1,
-    -1,    -1,    -1,    27,    -1,    -1,    -1,    -1,    -1,    -1,
-    -1,    35,     4,     5,     6,     7,     8,     9,    10,    11,
-    12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-    22,    -1,    -1,    -1,    -1,    27,    -1,    -1,    -1,    -1,
-    -1,    -1,    -1,    35,     4,     5,     6,     7,     8,     9,
-    10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-    20,    21,    22,    -1,    -1,    -1,    -1,    27,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    35,     4,     5,     6,     7,
-     8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
-    18,    19,    20,    21,    22,    -1,    -1,    -1,    -1,    27,
-    -1,    -1,    -1,    -1,    -1,    -1,    -1,    35,     4,     5,
-     6,     7,     8,     9,    10,    11,    12,    13,    14,    15,
-    16,    17,    18,    19,    20,    21,    22,    -1,    -1,    -1,
-    -1,    27,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    35,
-     4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
-    14,    15,    16,    17,    18,    19,    20,    21,    22,    -1,
-    -1,    -1,    -1,    27,    -1,    -1,    -1,    -1,    -1,    -1,
-    -1,    35,     4,     5,     6,     7,     8,     9,    10,    11,
-    12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-    22,    -1,    -1,    -1,    -1,    27,    -1,    -1,    -1,    -1,
-    -1,    -1,    -1,    35,     3,     4,     5,     6,     7,     8,
-     9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
-    19,    20,    21,    22,    -1,    -1,    -1,    -1,    27,     3,
-     4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
-    14,    15,    16,    17,    18,    19,    20,    21,    22,    -1,
-    -1,    -1,    -1,    27,     3,     4,     5,     6,     7,     8,
-     9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
-    19,    20,    21,    22,    -1,    -1,    -1,    -1,    27,     4,
-     5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
-    15,    16,    17,    18,    19,    20,    21,    22,    -1,    -1,
-    -1,    -1,    27,     4,     5,     6,     7,     8,     9,    10,
-    11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
-    21,    22,    -1,    -1,    -1,    -1,    27,     8,     9,    10,
-    11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
-    21,    22,    -1,    -1,    -1,    -1,    27
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_uint8 yyr1[] =
+{
+       0,    93,    94,    95,    95,    96,    96,    96,    96,    96,
+      96,    96,    96,    97,    98,    99,    99,   100,   101,   102,
+     102,   103,   103,   103,   104,   104,   105,   105,   105,   105,
+     105,   105,   105,   106,   106,   107,   107,   108,   108,   108,
+     110,   109,   111,   111,   112,   112,   112,   112,   112,   112,
+     112,   113,   113,   113,   113,   113,   113,   113,   113,   113,
+     113,   114,   114,   114,   114,   114,   114,   115,   115,   115,
+     115,   116,   116,   117,   117,   118,   118,   119,   119,   120,
+     120,   121,   122,   122,   123,   123,   124,   124,   125,   125,
+     125,   125,   125,   125,   125,   125,   125,   125,   125,   125,
+     125,   125,   125,   125,   125,   125,   125,   125,   125,   125,
+     125,   125,   125,   125,   125,   125,   125,   125,   125,   125,
+     125,   125,   125,   125,   125,   125,   125,   125,   125,   126,
+     127,   128,   128,   128,   129,   129,   129,   130,   131,   131,
+     131,   132
 };
-/* -*-C-*-  Note some compilers choke on comments on `#line' lines.  */
-#line 3 "bison.simple"
 
-/* Skeleton output parser for bison,
-   Copyright (C) 1984, 1989, 1990 Free Software Foundation, Inc.
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     2,     0,     3,     3,     3,     6,     6,
+       6,     6,     2,     6,     5,     1,     0,     5,     5,     4,
+       2,     1,     1,     0,     4,     2,     1,     2,     2,     3,
+       1,     2,     3,     3,     1,     1,     3,     2,     5,     3,
+       0,     4,     2,     0,     1,     1,     2,     4,     2,     1,
+       2,     6,     8,     6,     6,     6,     8,     8,     8,    10,
+       4,     5,     3,     4,     6,     3,     2,     1,     3,     3,
+       3,     1,     0,     1,     0,     1,     0,     2,     0,     2,
+       6,     2,     4,     3,     1,     0,     3,     1,     2,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     2,     2,     2,     3,     3,
+       2,     2,     4,     4,     3,     2,     5,     2,     2,     2,
+       4,     4,     4,     2,     7,     5,     3,     6,     3,     0,
+       0,     3,     1,     0,     1,     2,     4,     6,     3,     1,
+       0,     1
+};
 
-   This program is free software; you can redistribute it and/or modify
-   it under the terms of the GNU General Public License as published by
-   the Free Software Foundation; either version 2, or (at your option)
-   any later version.
 
-   This program is distributed in the hope that it will be useful,
-   but WITHOUT ANY WARRANTY; without even the implied warranty of
-   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-   GNU General Public License for more details.
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
 
-   You should have received a copy of the GNU General Public License
-   along with this program; if not, write to the Free Software
-   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.  */
-
-/* As a special exception, when this file is copied by Bison into a
-   Bison output file, you may use that output file without restriction.
-   This special exception was added by the Free Software Foundation
-   in version 1.24 of Bison.  */
-
-#ifndef alloca
-#include <malloc.h>
-#endif /* alloca not defined.  */
-
-/* This is the parser code that is written into each bison parser
-  when the %semantic_parser declaration is not specified in the grammar.
-  It was written by Richard Stallman by simplifying the hairy parser
-  used when %semantic_parser is specified.  */
-
-/* Note: there must be only one dollar sign in this file.
-   It is replaced by the list of actions, each action
-   as one case of the switch.  */
-
-#define yyerrok		(yyerrstatus = 0)
-#define yyclearin	(yychar = YYEMPTY)
-#define YYEMPTY		-2
-#define YYEOF		0
-#define YYACCEPT	return(0)
-#define YYABORT 	return(1)
-#define YYERROR		goto yyerrlab1
-/* Like YYERROR except do call yyerror.
-   This remains here temporarily to ease the
-   transition to the new meaning of YYERROR, for GCC.
-   Once GCC version 2 has supplanted version 1, this can go.  */
-#define YYFAIL		goto yyerrlab
 #define YYRECOVERING()  (!!yyerrstatus)
-#define YYBACKUP(token, value) \
-do								\
-  if (yychar == YYEMPTY && yylen == 1)				\
-    { yychar = (token), yylval = (value);			\
-      yychar1 = YYTRANSLATE (yychar);				\
-      YYPOPSTACK;						\
-      goto yybackup;						\
-    }								\
-  else								\
-    { yyerror ("syntax error: cannot back up"); YYERROR; }	\
-while (0)
-
-#define YYTERROR	1
-#define YYERRCODE	256
-
-#ifndef YYPURE
-#define YYLEX		yylex()
-#endif
 
-#ifdef YYPURE
-#ifdef YYLSP_NEEDED
-#ifdef YYLEX_PARAM
-#define YYLEX		yylex(&yylval, &yylloc, YYLEX_PARAM)
-#else
-#define YYLEX		yylex(&yylval, &yylloc)
-#endif
-#else /* not YYLSP_NEEDED */
-#ifdef YYLEX_PARAM
-#define YYLEX		yylex(&yylval, YYLEX_PARAM)
-#else
-#define YYLEX		yylex(&yylval)
-#endif
-#endif /* not YYLSP_NEEDED */
-#endif
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
 
-/* If nonreentrant, generate the variables here */
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
 
-#ifndef YYPURE
 
-int	yychar;			/*  the lookahead symbol		*/
-YYSTYPE	yylval;			/*  the semantic value of the		*/
-				/*  lookahead symbol			*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
-#ifdef YYLSP_NEEDED
-YYLTYPE yylloc;			/*  location data for the lookahead	*/
-				/*  symbol				*/
-#endif
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
 
-int yynerrs;			/*  number of parse errors so far       */
-#endif  /* not YYPURE */
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
 
-#if YYDEBUG != 0
-int yydebug;			/*  nonzero means print parse trace	*/
-/* Since this is uninitialized, it does not stop multiple parsers
-   from coexisting.  */
-#endif
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
 
-/*  YYINITDEPTH indicates the initial size of the parser's stacks	*/
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
 
-#ifndef	YYINITDEPTH
-#define YYINITDEPTH 200
-#endif
 
-/*  YYMAXDEPTH is the maximum size the stacks can grow to
-    (effective only if the built-in stack extension method is used).  */
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
 
-#if YYMAXDEPTH == 0
-#undef YYMAXDEPTH
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
 #endif
 
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
 #ifndef YYMAXDEPTH
-#define YYMAXDEPTH 10000
+# define YYMAXDEPTH 10000
 #endif
 
-/* Prevent warning if -Wstrict-prototypes.  */
-#ifdef __GNUC__
-int yyparse (void);
-#endif
-
-#if __GNUC__ > 1		/* GNU C and GNU C++ define this.  */
-#define __yy_memcpy(FROM,TO,COUNT)	__builtin_memcpy(TO,FROM,COUNT)
-#else				/* not GNU C or C++ */
-#ifndef __cplusplus
-
-/* This is the most reliable way to avoid incompatibilities
-   in available built-in functions on various systems.  */
-static void
-__yy_memcpy (from, to, count)
-     char *from;
-     char *to;
-     int count;
-{
-  register char *f = from;
-  register char *t = to;
-  register int i = count;
 
-  while (i-- > 0)
-    *t++ = *f++;
-}
 
-#else /* __cplusplus */
 
-/* This is the most reliable way to avoid incompatibilities
-   in available built-in functions on various systems.  */
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
 static void
-__yy_memcpy (char *from, char *to, int count)
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
 {
-  register char *f = from;
-  register char *t = to;
-  register int i = count;
-
-  while (i-- > 0)
-    *t++ = *f++;
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
-#endif
-#endif
-
-#line 192 "bison.simple"
 
-/* The user can define YYPARSE_PARAM as the name of an argument to be passed
-   into yyparse.  The argument should have type void *.
-   It should actually point to an object.
-   Grammar actions can access the variable by casting it
-   to the proper pointer type.  */
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
 
-#ifdef YYPARSE_PARAM
-#define YYPARSE_PARAM_DECL void *YYPARSE_PARAM;
-#else
-#define YYPARSE_PARAM
-#define YYPARSE_PARAM_DECL
-#endif
+
+
+/*----------.
+| yyparse.  |
+`----------*/
 
 int
-yyparse(YYPARSE_PARAM)
-     YYPARSE_PARAM_DECL
+yyparse (void)
 {
-  register int yystate;
-  register int yyn;
-  register short *yyssp;
-  register YYSTYPE *yyvsp;
-  int yyerrstatus;	/*  number of tokens to shift before error messages enabled */
-  int yychar1 = 0;		/*  lookahead token as an internal (translated) token number */
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
 
-  short	yyssa[YYINITDEPTH];	/*  the state stack			*/
-  YYSTYPE yyvsa[YYINITDEPTH];	/*  the semantic value stack		*/
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
 
-  short *yyss = yyssa;		/*  refer to the stacks thru separate pointers */
-  YYSTYPE *yyvs = yyvsa;	/*  to allow yyoverflow to reallocate them elsewhere */
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-#ifdef YYLSP_NEEDED
-  YYLTYPE yylsa[YYINITDEPTH];	/*  the location stack			*/
-  YYLTYPE *yyls = yylsa;
-  YYLTYPE *yylsp;
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-#define YYPOPSTACK   (yyvsp--, yyssp--, yylsp--)
-#else
-#define YYPOPSTACK   (yyvsp--, yyssp--)
-#endif
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
-  int yystacksize = YYINITDEPTH;
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
 
-#ifdef YYPURE
-  int yychar;
-  YYSTYPE yylval;
-  int yynerrs;
-#ifdef YYLSP_NEEDED
-  YYLTYPE yylloc;
-#endif
-#endif
 
-  YYSTYPE yyval;		/*  the variable used to return		*/
-				/*  semantic values from the action	*/
-				/*  routines				*/
 
-  int yylen;
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
-#if YYDEBUG != 0
-  if (yydebug)
-    fprintf(stderr, "Starting parse\n");
-#endif
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
-  yychar = YYEMPTY;		/* Cause a token to be read.  */
+  YYDPRINTF ((stderr, "Starting parse\n"));
 
-  /* Initialize stack pointers.
-     Waste one element of value and location stack
-     so that they stay on the same level as the state stack.
-     The wasted elements are never initialized.  */
+  yychar = YYEMPTY; /* Cause a token to be read.  */
 
-  yyssp = yyss - 1;
-  yyvsp = yyvs;
-#ifdef YYLSP_NEEDED
-  yylsp = yyls;
-#endif
+  goto yysetstate;
 
-/* Push a new state, which is found in  yystate  .  */
-/* In all cases, when you get here, the value and location stacks
-   have just been pushed. so pushing a state here evens the stacks.  */
-yynewstate:
 
-  *++yyssp = yystate;
-
-  if (yyssp >= yyss + yystacksize - 1)
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
-      /* Give user a chance to reallocate the stack */
-      /* Use copies of these so that the &'s don't force the real ones into memory. */
-      YYSTYPE *yyvs1 = yyvs;
-      short *yyss1 = yyss;
-#ifdef YYLSP_NEEDED
-      YYLTYPE *yyls1 = yyls;
-#endif
-
       /* Get the current used size of the three stacks, in elements.  */
-      int size = yyssp - yyss + 1;
-
-#ifdef yyoverflow
-      /* Each stack pointer address is followed by the size of
-	 the data in use in that stack, in bytes.  */
-#ifdef YYLSP_NEEDED
-      /* This used to be a conditional around just the two extra args,
-	 but that might be undefined if yyoverflow is a macro.  */
-      yyoverflow("parser stack overflow",
-		 &yyss1, size * sizeof (*yyssp),
-		 &yyvs1, size * sizeof (*yyvsp),
-		 &yyls1, size * sizeof (*yylsp),
-		 &yystacksize);
-#else
-      yyoverflow("parser stack overflow",
-		 &yyss1, size * sizeof (*yyssp),
-		 &yyvs1, size * sizeof (*yyvsp),
-		 &yystacksize);
-#endif
-
-      yyss = yyss1; yyvs = yyvs1;
-#ifdef YYLSP_NEEDED
-      yyls = yyls1;
-#endif
-#else /* no yyoverflow */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
-      if (yystacksize >= YYMAXDEPTH)
-	{
-	  yyerror("parser stack overflow");
-	  return 2;
-	}
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
       yystacksize *= 2;
-      if (yystacksize > YYMAXDEPTH)
-	yystacksize = YYMAXDEPTH;
-      yyss = (short *) alloca (yystacksize * sizeof (*yyssp));
-      __yy_memcpy ((char *)yyss1, (char *)yyss, size * sizeof (*yyssp));
-      yyvs = (YYSTYPE *) alloca (yystacksize * sizeof (*yyvsp));
-      __yy_memcpy ((char *)yyvs1, (char *)yyvs, size * sizeof (*yyvsp));
-#ifdef YYLSP_NEEDED
-      yyls = (YYLTYPE *) alloca (yystacksize * sizeof (*yylsp));
-      __yy_memcpy ((char *)yyls1, (char *)yyls, size * sizeof (*yylsp));
-#endif
-#endif /* no yyoverflow */
-
-      yyssp = yyss + size - 1;
-      yyvsp = yyvs + size - 1;
-#ifdef YYLSP_NEEDED
-      yylsp = yyls + size - 1;
-#endif
-
-#if YYDEBUG != 0
-      if (yydebug)
-	fprintf(stderr, "Stack size increased to %d\n", yystacksize);
-#endif
-
-      if (yyssp >= yyss + yystacksize - 1)
-	YYABORT;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-#if YYDEBUG != 0
-  if (yydebug)
-    fprintf(stderr, "Entering state %d\n", yystate);
-#endif
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
 
   goto yybackup;
- yybackup:
 
-/* Do appropriate processing given the current state.  */
-/* Read a lookahead token if we need one and don't already have one.  */
-/* yyresume: */
 
-  /* First try to decide what to do without reference to lookahead token.  */
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
 
+  /* First try to decide what to do without reference to lookahead token.  */
   yyn = yypact[yystate];
-  if (yyn == YYFLAG)
+  if (yypact_value_is_default (yyn))
     goto yydefault;
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* yychar is either YYEMPTY or YYEOF
-     or a valid token in external form.  */
-
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-#if YYDEBUG != 0
-      if (yydebug)
-	fprintf(stderr, "Reading a token: ");
-#endif
-      yychar = YYLEX;
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
     }
 
-  /* Convert token to internal form (in yychar1) for indexing tables with */
-
-  if (yychar <= 0)		/* This means end of input. */
+  if (yychar <= YYEOF)
     {
-      yychar1 = 0;
-      yychar = YYEOF;		/* Don't call YYLEX any more */
-
-#if YYDEBUG != 0
-      if (yydebug)
-	fprintf(stderr, "Now at end of input.\n");
-#endif
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
     }
   else
     {
-      yychar1 = YYTRANSLATE(yychar);
-
-#if YYDEBUG != 0
-      if (yydebug)
-	{
-	  fprintf (stderr, "Next token is %d (%s", yychar, yytname[yychar1]);
-	  /* Give the individual parser a way to print the precise meaning
-	     of a token, for further debugging info.  */
-#ifdef YYPRINT
-	  YYPRINT (stderr, yychar, yylval);
-#endif
-	  fprintf (stderr, ")\n");
-	}
-#endif
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
     }
 
-  yyn += yychar1;
-  if (yyn < 0 || yyn > YYLAST || yycheck[yyn] != yychar1)
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
     goto yydefault;
-
   yyn = yytable[yyn];
-
-  /* yyn is what to do for this token type in this state.
-     Negative => reduce, -yyn is rule number.
-     Positive => shift, yyn is new state.
-       New state is final state => don't bother to shift,
-       just return success.
-     0, or most negative number => error.  */
-
-  if (yyn < 0)
+  if (yyn <= 0)
     {
-      if (yyn == YYFLAG)
-	goto yyerrlab;
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
       yyn = -yyn;
       goto yyreduce;
     }
-  else if (yyn == 0)
-    goto yyerrlab;
 
-  if (yyn == YYFINAL)
-    YYACCEPT;
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
 
   /* Shift the lookahead token.  */
-
-#if YYDEBUG != 0
-  if (yydebug)
-    fprintf(stderr, "Shifting token %d (%s), ", yychar, yytname[yychar1]);
-#endif
-
-  /* Discard the token being shifted unless it is eof.  */
-  if (yychar != YYEOF)
-    yychar = YYEMPTY;
-
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
-#ifdef YYLSP_NEEDED
-  *++yylsp = yylloc;
-#endif
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
-  /* count tokens shifted since error; after three, turn off error status.  */
-  if (yyerrstatus) yyerrstatus--;
-
-  yystate = yyn;
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
-/* Do the default action for the current state.  */
-yydefault:
 
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
   yyn = yydefact[yystate];
   if (yyn == 0)
     goto yyerrlab;
+  goto yyreduce;
+
 
-/* Do a reduction.  yyn is the number of a rule to reduce with.  */
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
 yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
   yylen = yyr2[yyn];
-  if (yylen > 0)
-    yyval = yyvsp[1-yylen]; /* implement default value of the action */
 
-#if YYDEBUG != 0
-  if (yydebug)
-    {
-      int i;
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
 
-      fprintf (stderr, "Reducing via rule %d (line %d), ",
-	       yyn, yyrline[yyn]);
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
 
-      /* Print the symbols being reduced, and their result.  */
-      for (i = yyprhs[yyn]; yyrhs[i] > 0; i++)
-	fprintf (stderr, "%s ", yytname[yyrhs[i]]);
-      fprintf (stderr, " -> %s\n", yytname[yyr1[yyn]]);
-    }
-#endif
 
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 2: /* S: unit_list  */
+#line 167 "parse.y"
+                { (yyval.fInt) = 0; }
+#line 2038 "y.tab.c"
+    break;
 
-  switch (yyn) {
-
-case 1:
-#line 163 "parse.y"
-{ yyval.fInt = 0; ;
-    break;}
-case 4:
-#line 171 "parse.y"
-{ gProgram->AddGlobalDecls(yyvsp[-1].fBlock); ;
-    break;}
-case 5:
-#line 172 "parse.y"
-{ yyvsp[-1].fFragment->SetLocations(yyvsp[-2].fLocation, yyvsp[0].fLocation); ;
-    break;}
-case 6:
-#line 173 "parse.y"
-{ yyvsp[-1].fFragment->SetLocations(yyvsp[-2].fLocation, yyvsp[0].fLocation); ;
-    break;}
-case 7:
-#line 174 "parse.y"
-{ EndFunction(yyvsp[-4].fFunction, yyvsp[-2].fBlock, yyvsp[-5].fLocation, yyvsp[0].fLocation); ;
-    break;}
-case 8:
+  case 5: /* unit: INT var_list ';'  */
 #line 175 "parse.y"
-{ gProgram->AddResource(yyvsp[-1].fResource); ;
-    break;}
-case 9:
+                                        { gProgram->AddGlobalDecls((yyvsp[-1].fBlock)); }
+#line 2044 "y.tab.c"
+    break;
+
+  case 6: /* unit: loc fragment loc  */
+#line 176 "parse.y"
+                                                { (yyvsp[-1].fFragment)->SetLocations((yyvsp[-2].fLocation), (yyvsp[0].fLocation)); }
+#line 2050 "y.tab.c"
+    break;
+
+  case 7: /* unit: loc subfragment loc  */
+#line 177 "parse.y"
+                                                { (yyvsp[-1].fFragment)->SetLocations((yyvsp[-2].fLocation), (yyvsp[0].fLocation)); }
+#line 2056 "y.tab.c"
+    break;
+
+  case 8: /* unit: loc TASK ID '(' ')' ';'  */
+#line 178 "parse.y"
+                                                { delete (yyvsp[-5].fLocation); gProgram->DeclareFragment(true, (yyvsp[-3].fSymbol)); }
+#line 2062 "y.tab.c"
+    break;
+
+  case 9: /* unit: loc SUB ID '(' ')' ';'  */
 #line 179 "parse.y"
-{ yyval.fFunction = BeginFunction(yyvsp[-1].fFunction, yyvsp[-3].fSymbol, yyvsp[-5].fBool); ;
-    break;}
-case 10:
+                                                { delete (yyvsp[-5].fLocation); gProgram->DeclareFragment(false, (yyvsp[-3].fSymbol)); }
+#line 2068 "y.tab.c"
+    break;
+
+  case 10: /* unit: loc sub_head '{' stmt_list '}' loc  */
+#line 180 "parse.y"
+                                                        { EndSubWithParams((yyvsp[-4].fFragment), (yyvsp[-2].fBlock), (yyvsp[-5].fLocation), (yyvsp[0].fLocation)); }
+#line 2074 "y.tab.c"
+    break;
+
+  case 11: /* unit: loc function_head '{' stmt_list '}' loc  */
+#line 181 "parse.y"
+                                                        { EndFunction((yyvsp[-4].fFunction), (yyvsp[-2].fBlock), (yyvsp[-5].fLocation), (yyvsp[0].fLocation)); }
+#line 2080 "y.tab.c"
+    break;
+
+  case 12: /* unit: resource ';'  */
 #line 182 "parse.y"
-{ yyval.fBool = 0; ;
-    break;}
-case 11:
-#line 183 "parse.y"
-{ yyval.fBool = 1; ;
-    break;}
-case 12:
+                             { gProgram->AddResource((yyvsp[-1].fResource)); }
+#line 2086 "y.tab.c"
+    break;
+
+  case 13: /* function_head: nolist_opt T_VOID ID '(' args ')'  */
 #line 186 "parse.y"
-{ yyval.fFragment = new Fragment(true, yyvsp[-3].fSymbol, yyvsp[0].fStmt); ;
-    break;}
-case 13:
+                                                  { (yyval.fFunction) = BeginFunction((yyvsp[-1].fFunction), (yyvsp[-3].fSymbol), (yyvsp[-5].fBool)); }
+#line 2092 "y.tab.c"
+    break;
+
+  case 14: /* sub_head: SUB ID '(' sarg_list ')'  */
+#line 189 "parse.y"
+                                    { (yyval.fFragment) = BeginSubWithParams((yyvsp[-1].fFragment), (yyvsp[-3].fSymbol)); }
+#line 2098 "y.tab.c"
+    break;
+
+  case 15: /* nolist_opt: NOLIST  */
+#line 192 "parse.y"
+                        { (yyval.fBool) = 0; }
+#line 2104 "y.tab.c"
+    break;
+
+  case 16: /* nolist_opt: %empty  */
 #line 193 "parse.y"
-{ yyval.fFragment = CreateSubroutine(yyvsp[-4].fFragment, yyvsp[-6].fSymbol, yyvsp[-1].fBlock); ;
-    break;}
-case 14:
-#line 194 "parse.y"
-{ yyval.fFragment = new Fragment(false, yyvsp[-3].fSymbol, yyvsp[0].fStmt); ;
-    break;}
-case 15:
-#line 197 "parse.y"
-{ yyval.fFragment = yyvsp[-3].fFragment; 	DefineSubArg(yyval.fFragment, yyvsp[0].fSymbol, yyvsp[-1].fInt); ;
-    break;}
-case 16:
-#line 198 "parse.y"
-{ yyval.fFragment = new Fragment(false); DefineSubArg(yyval.fFragment,yyvsp[0].fSymbol,yyvsp[-1].fInt); ;
-    break;}
-case 18:
-#line 202 "parse.y"
-{ yyval.fFunction = new FunctionDef(); ;
-    break;}
-case 19:
+                { (yyval.fBool) = 1; }
+#line 2110 "y.tab.c"
+    break;
+
+  case 17: /* fragment: TASK ID '(' ')' block  */
+#line 196 "parse.y"
+                                        { (yyval.fFragment) = new Fragment(true, (yyvsp[-3].fSymbol), (yyvsp[0].fStmt)); }
+#line 2116 "y.tab.c"
+    break;
+
+  case 18: /* subfragment: SUB ID '(' ')' block  */
 #line 203 "parse.y"
-{ yyval.fFunction = new FunctionDef(); ;
-    break;}
-case 20:
+                                                { (yyval.fFragment) = new Fragment(false, (yyvsp[-3].fSymbol), (yyvsp[0].fStmt)); }
+#line 2122 "y.tab.c"
+    break;
+
+  case 19: /* sarg_list: sarg_list ',' arg_type ID  */
 #line 206 "parse.y"
-{ yyval.fFunction = yyvsp[-3].fFunction; 	DefineArg(yyval.fFunction, yyvsp[0].fSymbol, yyvsp[-1].fInt); ;
-    break;}
-case 21:
+                                        { (yyval.fFragment) = (yyvsp[-3].fFragment); 	DefineSubArg((yyval.fFragment), (yyvsp[0].fSymbol), (yyvsp[-1].fInt)); }
+#line 2128 "y.tab.c"
+    break;
+
+  case 20: /* sarg_list: arg_type ID  */
 #line 207 "parse.y"
-{ yyval.fFunction = new FunctionDef(); DefineArg(yyval.fFunction,yyvsp[0].fSymbol,yyvsp[-1].fInt); ;
-    break;}
-case 22:
-#line 210 "parse.y"
-{ yyval.fInt = FunctionDef::kIntegerArg; ;
-    break;}
-case 23:
+                                                        { (yyval.fFragment) = new Fragment(false); DefineSubArg((yyval.fFragment),(yyvsp[0].fSymbol),(yyvsp[-1].fInt)); }
+#line 2134 "y.tab.c"
+    break;
+
+  case 22: /* args: T_VOID  */
 #line 211 "parse.y"
-{ yyval.fInt = FunctionDef::kConstantArg; ;
-    break;}
-case 24:
+                        { (yyval.fFunction) = new FunctionDef(); }
+#line 2140 "y.tab.c"
+    break;
+
+  case 23: /* args: %empty  */
 #line 212 "parse.y"
-{ yyval.fInt = FunctionDef::kReferenceArg; ;
-    break;}
-case 25:
-#line 213 "parse.y"
-{ yyval.fInt = FunctionDef::kConstRefArg; ;
-    break;}
-case 26:
-#line 214 "parse.y"
-{ yyval.fInt = FunctionDef::kSensorArg; ;
-    break;}
-case 27:
+                                { (yyval.fFunction) = new FunctionDef(); }
+#line 2146 "y.tab.c"
+    break;
+
+  case 24: /* arg_list: arg_list ',' arg_type ID  */
 #line 215 "parse.y"
-{ yyval.fInt = FunctionDef::kPointerArg; ;
-    break;}
-case 28:
+                                        { (yyval.fFunction) = (yyvsp[-3].fFunction); 	DefineArg((yyval.fFunction), (yyvsp[0].fSymbol), (yyvsp[-1].fInt)); }
+#line 2152 "y.tab.c"
+    break;
+
+  case 25: /* arg_list: arg_type ID  */
 #line 216 "parse.y"
-{ yyval.fInt = FunctionDef::kConstPtrArg; ;
-    break;}
-case 29:
+                                                        { (yyval.fFunction) = new FunctionDef(); DefineArg((yyval.fFunction),(yyvsp[0].fSymbol),(yyvsp[-1].fInt)); }
+#line 2158 "y.tab.c"
+    break;
+
+  case 26: /* arg_type: INT  */
+#line 219 "parse.y"
+                        { (yyval.fInt) = FunctionDef::kIntegerArg; }
+#line 2164 "y.tab.c"
+    break;
+
+  case 27: /* arg_type: T_CONST INT  */
 #line 220 "parse.y"
-{ yyvsp[-2].fBlock->Add(yyvsp[0].fStmt); yyval.fBlock = yyvsp[-2].fBlock; ;
-    break;}
-case 30:
+                        { (yyval.fInt) = FunctionDef::kConstantArg; }
+#line 2170 "y.tab.c"
+    break;
+
+  case 28: /* arg_type: INT '&'  */
 #line 221 "parse.y"
-{ yyval.fBlock = new BlockStmt(); yyval.fBlock->Add(yyvsp[0].fStmt); ;
-    break;}
-case 31:
+                                { (yyval.fInt) = FunctionDef::kReferenceArg; }
+#line 2176 "y.tab.c"
+    break;
+
+  case 29: /* arg_type: T_CONST INT '&'  */
+#line 222 "parse.y"
+                                { (yyval.fInt) = FunctionDef::kConstRefArg; }
+#line 2182 "y.tab.c"
+    break;
+
+  case 30: /* arg_type: SENSOR  */
+#line 223 "parse.y"
+                                { (yyval.fInt) = FunctionDef::kSensorArg; }
+#line 2188 "y.tab.c"
+    break;
+
+  case 31: /* arg_type: INT '*'  */
 #line 224 "parse.y"
-{ yyval.fStmt = yyvsp[0].fDeclareStmt; ;
-    break;}
-case 32:
+                                { (yyval.fInt) = FunctionDef::kPointerArg; }
+#line 2194 "y.tab.c"
+    break;
+
+  case 32: /* arg_type: T_CONST INT '*'  */
 #line 225 "parse.y"
-{ yyval.fStmt = yyvsp[-2].fDeclareStmt; yyvsp[-2].fDeclareStmt->SetInitialValue(yyvsp[0].fExpr); ;
-    break;}
-case 33:
-#line 228 "parse.y"
-{ yyval.fDeclareStmt = MakeDeclareStmt(yyvsp[-1].fSymbol, yyvsp[0].fLocation, 0, false, false); ;
-    break;}
-case 34:
+                                { (yyval.fInt) = FunctionDef::kConstPtrArg; }
+#line 2200 "y.tab.c"
+    break;
+
+  case 33: /* var_list: var_list ',' var_item  */
 #line 229 "parse.y"
-{ yyval.fDeclareStmt = MakeDeclareStmt(yyvsp[-4].fSymbol, yyvsp[-3].fLocation, yyvsp[-1].fExpr, false, false); ;
-    break;}
-case 35:
+                                        { (yyvsp[-2].fBlock)->Add((yyvsp[0].fStmt)); (yyval.fBlock) = (yyvsp[-2].fBlock); }
+#line 2206 "y.tab.c"
+    break;
+
+  case 34: /* var_list: var_item  */
 #line 230 "parse.y"
-{ yyval.fDeclareStmt = MakeDeclareStmt(yyvsp[-1].fSymbol, yyvsp[0].fLocation, 0, true, false); ;
-    break;}
-case 36:
-#line 233 "parse.y"
-{ BeginScope(); ;
-    break;}
-case 37:
+                                                                { (yyval.fBlock) = new BlockStmt(); (yyval.fBlock)->Add((yyvsp[0].fStmt)); }
+#line 2212 "y.tab.c"
+    break;
+
+  case 35: /* var_item: var_decl  */
 #line 233 "parse.y"
-{ yyval.fStmt = EndScope(yyvsp[-1].fBlock); ;
-    break;}
-case 38:
-#line 236 "parse.y"
-{ yyvsp[-1].fBlock->Add(yyvsp[0].fStmt); yyval.fBlock = yyvsp[-1].fBlock; ;
-    break;}
-case 39:
+                                { (yyval.fStmt) = (yyvsp[0].fDeclareStmt); }
+#line 2218 "y.tab.c"
+    break;
+
+  case 36: /* var_item: var_decl '=' expr  */
+#line 234 "parse.y"
+                                { (yyval.fStmt) = (yyvsp[-2].fDeclareStmt); (yyvsp[-2].fDeclareStmt)->SetInitialValue((yyvsp[0].fExpr)); }
+#line 2224 "y.tab.c"
+    break;
+
+  case 37: /* var_decl: ID loc  */
 #line 237 "parse.y"
-{ yyval.fBlock = new BlockStmt(); ;
-    break;}
-case 40:
-#line 241 "parse.y"
-{ yyval.fStmt = new BlockStmt(); ;
-    break;}
-case 42:
-#line 243 "parse.y"
-{ yyval.fStmt = yyvsp[-1].fCaseStmt; yyvsp[-1].fCaseStmt->SetStmt(yyvsp[0].fStmt); ;
-    break;}
-case 43:
-#line 244 "parse.y"
-{ yyval.fStmt = new LabelStmt(yyvsp[-2].fSymbol, yyvsp[-3].fLocation->GetLoc(), yyvsp[0].fStmt); delete yyvsp[-3].fLocation; ;
-    break;}
-case 44:
+                  { (yyval.fDeclareStmt) = MakeDeclareStmt((yyvsp[-1].fSymbol), (yyvsp[0].fLocation), 0, false, false); }
+#line 2230 "y.tab.c"
+    break;
+
+  case 38: /* var_decl: ID loc '[' expr ']'  */
+#line 238 "parse.y"
+                             { (yyval.fDeclareStmt) = MakeDeclareStmt((yyvsp[-4].fSymbol), (yyvsp[-3].fLocation), (yyvsp[-1].fExpr), false, false); }
+#line 2236 "y.tab.c"
+    break;
+
+  case 39: /* var_decl: '*' ID loc  */
+#line 239 "parse.y"
+                      { (yyval.fDeclareStmt) = MakeDeclareStmt((yyvsp[-1].fSymbol), (yyvsp[0].fLocation), 0, true, false); }
+#line 2242 "y.tab.c"
+    break;
+
+  case 40: /* $@1: %empty  */
+#line 242 "parse.y"
+            { BeginScope(); }
+#line 2248 "y.tab.c"
+    break;
+
+  case 41: /* block: '{' $@1 stmt_list '}'  */
+#line 242 "parse.y"
+                                                        { (yyval.fStmt) = EndScope((yyvsp[-1].fBlock)); }
+#line 2254 "y.tab.c"
+    break;
+
+  case 42: /* stmt_list: stmt_list stmt  */
 #line 245 "parse.y"
-{  yyerrok; yyval.fStmt = new BlockStmt(); ;
-    break;}
-case 46:
-#line 247 "parse.y"
-{ yyvsp[-1].fStmt->SetLocation(yyvsp[0].fLocation); ;
-    break;}
-case 47:
+                                { (yyvsp[-1].fBlock)->Add((yyvsp[0].fStmt)); (yyval.fBlock) = (yyvsp[-1].fBlock); }
+#line 2260 "y.tab.c"
+    break;
+
+  case 43: /* stmt_list: %empty  */
+#line 246 "parse.y"
+                                                                { (yyval.fBlock) = new BlockStmt(); }
+#line 2266 "y.tab.c"
+    break;
+
+  case 44: /* stmt: ';'  */
+#line 250 "parse.y"
+                                                { (yyval.fStmt) = new BlockStmt(); }
+#line 2272 "y.tab.c"
+    break;
+
+  case 46: /* stmt: case stmt  */
 #line 252 "parse.y"
-{ yyval.fStmt = new WhileStmt(yyvsp[-3].fExpr, yyvsp[0].fStmt); yyval.fStmt->SetLocation(yyvsp[-1].fLocation); ;
-    break;}
-case 48:
+                                        { (yyval.fStmt) = (yyvsp[-1].fCaseStmt); (yyvsp[-1].fCaseStmt)->SetStmt((yyvsp[0].fStmt)); }
+#line 2278 "y.tab.c"
+    break;
+
+  case 47: /* stmt: loc ID ':' stmt  */
 #line 253 "parse.y"
-{ yyval.fStmt = new DoStmt(yyvsp[-2].fExpr, yyvsp[-5].fStmt); yyval.fStmt->SetLocation(yyvsp[-6].fLocation); ;
-    break;}
-case 49:
+                                { (yyval.fStmt) = new LabelStmt((yyvsp[-2].fSymbol), (yyvsp[-3].fLocation)->GetLoc(), (yyvsp[0].fStmt)); delete (yyvsp[-3].fLocation); }
+#line 2284 "y.tab.c"
+    break;
+
+  case 48: /* stmt: error ';'  */
 #line 254 "parse.y"
-{ yyval.fStmt = new RepeatStmt(yyvsp[-3].fExpr, yyvsp[0].fStmt); yyval.fStmt->SetLocation(yyvsp[-1].fLocation); ;
-    break;}
-case 50:
-#line 255 "parse.y"
-{ yyval.fStmt = new SwitchStmt(yyvsp[-3].fExpr, yyvsp[0].fStmt); yyval.fStmt->SetLocation(yyvsp[-1].fLocation); ;
-    break;}
-case 51:
+                                        {  yyerrok; (yyval.fStmt) = new BlockStmt(); }
+#line 2290 "y.tab.c"
+    break;
+
+  case 50: /* stmt: misc_stmt loc  */
 #line 256 "parse.y"
-{ yyval.fStmt = new IfStmt(yyvsp[-3].fExpr, yyvsp[0].fStmt); yyval.fStmt->SetLocation(yyvsp[-1].fLocation); ;
-    break;}
-case 52:
-#line 257 "parse.y"
-{ yyval.fStmt = new IfStmt(yyvsp[-5].fExpr, yyvsp[-2].fStmt, yyvsp[0].fStmt); yyval.fStmt->SetLocation(yyvsp[-3].fLocation); ;
-    break;}
-case 53:
-#line 258 "parse.y"
-{ yyval.fStmt = new MonitorStmt(yyvsp[-4].fExpr, yyvsp[-1].fStmt, yyvsp[0].fBlock, yyvsp[-6].fLocation->GetLoc()); delete yyvsp[-6].fLocation; yyval.fStmt->SetLocation(yyvsp[-2].fLocation); ;
-    break;}
-case 54:
-#line 259 "parse.y"
-{ yyval.fStmt = MakeAcquireStmt(yyvsp[-4].fExpr, yyvsp[-1].fStmt, yyvsp[0].fStmt, yyvsp[-6].fLocation); yyval.fStmt->SetLocation(yyvsp[-2].fLocation); ;
-    break;}
-case 55:
-#line 260 "parse.y"
-{ yyval.fStmt = new ForStmt(yyvsp[-7].fStmt, yyvsp[-5].fExpr, yyvsp[-3].fStmt, yyvsp[0].fStmt); yyval.fStmt->SetLocation(yyvsp[-1].fLocation); ;
-    break;}
-case 56:
+                                { (yyvsp[-1].fStmt)->SetLocation((yyvsp[0].fLocation)); }
+#line 2296 "y.tab.c"
+    break;
+
+  case 51: /* control_stmt: WHILE '(' expr ')' loc stmt  */
 #line 261 "parse.y"
-{ yyval.fStmt = new GotoStmt(yyvsp[-2].fSymbol, sSavedLoc); ;
-    break;}
-case 57:
+                                                                                { (yyval.fStmt) = new WhileStmt((yyvsp[-3].fExpr), (yyvsp[0].fStmt)); (yyval.fStmt)->SetLocation((yyvsp[-1].fLocation)); }
+#line 2302 "y.tab.c"
+    break;
+
+  case 52: /* control_stmt: DO loc stmt WHILE '(' expr ')' ';'  */
+#line 262 "parse.y"
+                                                                { (yyval.fStmt) = new DoStmt((yyvsp[-2].fExpr), (yyvsp[-5].fStmt)); (yyval.fStmt)->SetLocation((yyvsp[-6].fLocation)); }
+#line 2308 "y.tab.c"
+    break;
+
+  case 53: /* control_stmt: REPEAT '(' expr ')' loc stmt  */
+#line 263 "parse.y"
+                                                                        { (yyval.fStmt) = new RepeatStmt((yyvsp[-3].fExpr), (yyvsp[0].fStmt)); (yyval.fStmt)->SetLocation((yyvsp[-1].fLocation)); }
+#line 2314 "y.tab.c"
+    break;
+
+  case 54: /* control_stmt: SWITCH '(' expr ')' loc stmt  */
+#line 264 "parse.y"
+                                                                        { (yyval.fStmt) = new SwitchStmt((yyvsp[-3].fExpr), (yyvsp[0].fStmt)); (yyval.fStmt)->SetLocation((yyvsp[-1].fLocation)); }
+#line 2320 "y.tab.c"
+    break;
+
+  case 55: /* control_stmt: IF '(' expr ')' loc stmt  */
 #line 265 "parse.y"
-{ yyval.fStmt = yyvsp[-2].fAsmStmt; ;
-    break;}
-case 58:
+                                                                        { (yyval.fStmt) = new IfStmt((yyvsp[-3].fExpr), (yyvsp[0].fStmt)); (yyval.fStmt)->SetLocation((yyvsp[-1].fLocation)); }
+#line 2326 "y.tab.c"
+    break;
+
+  case 56: /* control_stmt: IF '(' expr ')' loc stmt ELSE stmt  */
 #line 266 "parse.y"
-{ yyval.fStmt = new JumpStmt(yyvsp[-1].fInt, sSavedLoc); ;
-    break;}
-case 59:
+                                                                { (yyval.fStmt) = new IfStmt((yyvsp[-5].fExpr), (yyvsp[-2].fStmt), (yyvsp[0].fStmt)); (yyval.fStmt)->SetLocation((yyvsp[-3].fLocation)); }
+#line 2332 "y.tab.c"
+    break;
+
+  case 57: /* control_stmt: MONITOR loc '(' expr ')' loc block handler_list  */
 #line 267 "parse.y"
-{ yyval.fStmt = new TaskStmt((UByte)yyvsp[-3].fInt, yyvsp[-1].fSymbol, sSavedLoc); ;
-    break;}
-case 60:
+                                                                { (yyval.fStmt) = new MonitorStmt((yyvsp[-4].fExpr), (yyvsp[-1].fStmt), (yyvsp[0].fBlock), (yyvsp[-6].fLocation)->GetLoc()); delete (yyvsp[-6].fLocation); (yyval.fStmt)->SetLocation((yyvsp[-2].fLocation)); }
+#line 2338 "y.tab.c"
+    break;
+
+  case 58: /* control_stmt: ACQUIRE loc '(' expr ')' loc block opt_handler  */
 #line 268 "parse.y"
-{ yyval.fStmt = yyvsp[-2].fCall; yyvsp[-2].fCall->SetName(yyvsp[-4].fSymbol); yyvsp[-2].fCall->SetLocation(yyvsp[-5].fLocation->GetLoc()); delete yyvsp[-5].fLocation; ;
-    break;}
-case 61:
+                                                                { (yyval.fStmt) = MakeAcquireStmt((yyvsp[-4].fExpr), (yyvsp[-1].fStmt), (yyvsp[0].fStmt), (yyvsp[-6].fLocation)); (yyval.fStmt)->SetLocation((yyvsp[-2].fLocation)); }
+#line 2344 "y.tab.c"
+    break;
+
+  case 59: /* control_stmt: FOR '(' opt_expr_stmt ';' opt_expr ';' opt_expr_stmt ')' loc stmt  */
 #line 269 "parse.y"
-{ yyval.fStmt = yyvsp[-1].fBlock; ;
-    break;}
-case 63:
+                                                                                        { (yyval.fStmt) = new ForStmt((yyvsp[-7].fStmt), (yyvsp[-5].fExpr), (yyvsp[-3].fStmt), (yyvsp[0].fStmt)); (yyval.fStmt)->SetLocation((yyvsp[-1].fLocation)); }
+#line 2350 "y.tab.c"
+    break;
+
+  case 60: /* control_stmt: GOTO ID saveloc ';'  */
+#line 270 "parse.y"
+                                    { (yyval.fStmt) = new GotoStmt((yyvsp[-2].fSymbol), sSavedLoc); }
+#line 2356 "y.tab.c"
+    break;
+
+  case 61: /* misc_stmt: ASM '{' asm_list '}' ';'  */
 #line 274 "parse.y"
-{ yyval.fStmt = new ExprStmt(yyvsp[0].fExpr); ;
-    break;}
-case 64:
+                                                { (yyval.fStmt) = (yyvsp[-2].fAsmStmt); }
+#line 2362 "y.tab.c"
+    break;
+
+  case 62: /* misc_stmt: saveloc JUMP ';'  */
 #line 275 "parse.y"
-{ CheckLValue(yyvsp[-2].fExpr); yyval.fStmt = MakeAssignStmt(yyvsp[-2].fExpr, yyvsp[-1].fInt, yyvsp[0].fExpr); ;
-    break;}
-case 65:
+                                                        { (yyval.fStmt) = new JumpStmt((yyvsp[-1].fInt), sSavedLoc); }
+#line 2368 "y.tab.c"
+    break;
+
+  case 63: /* misc_stmt: TASKOP saveloc ID ';'  */
 #line 276 "parse.y"
-{ CheckLValue(yyvsp[-2].fExpr); yyval.fStmt = MakeAssign2Stmt(yyvsp[-2].fExpr, yyvsp[-1].fInt, yyvsp[0].fExpr); ;
-    break;}
-case 66:
+                                                { (yyval.fStmt) = new TaskStmt((UByte)(yyvsp[-3].fInt), (yyvsp[-1].fSymbol), sSavedLoc); }
+#line 2374 "y.tab.c"
+    break;
+
+  case 64: /* misc_stmt: loc ID '(' params ')' ';'  */
 #line 277 "parse.y"
-{ CheckLValue(yyvsp[-2].fExpr); yyval.fStmt = new AssignStmt(yyvsp[-2].fExpr, yyvsp[0].fExpr); ;
-    break;}
-case 68:
-#line 282 "parse.y"
-{ yyval.fStmt = 0; ;
-    break;}
-case 70:
+                                                { (yyval.fStmt) = (yyvsp[-2].fCall); (yyvsp[-2].fCall)->SetName((yyvsp[-4].fSymbol)); (yyvsp[-2].fCall)->SetLocation((yyvsp[-5].fLocation)->GetLoc()); delete (yyvsp[-5].fLocation); }
+#line 2380 "y.tab.c"
+    break;
+
+  case 65: /* misc_stmt: INT var_list ';'  */
+#line 278 "parse.y"
+                                                        { (yyval.fStmt) = (yyvsp[-1].fBlock); }
+#line 2386 "y.tab.c"
+    break;
+
+  case 67: /* expr_stmt: expr  */
+#line 283 "parse.y"
+                                                        { (yyval.fStmt) = new ExprStmt((yyvsp[0].fExpr)); }
+#line 2392 "y.tab.c"
+    break;
+
+  case 68: /* expr_stmt: expr ASSIGN expr  */
+#line 284 "parse.y"
+                                                { CheckLValue((yyvsp[-2].fExpr)); (yyval.fStmt) = MakeAssignStmt((yyvsp[-2].fExpr), (yyvsp[-1].fInt), (yyvsp[0].fExpr)); }
+#line 2398 "y.tab.c"
+    break;
+
+  case 69: /* expr_stmt: expr ASSIGN2 expr  */
+#line 285 "parse.y"
+                                                { CheckLValue((yyvsp[-2].fExpr)); (yyval.fStmt) = MakeAssign2Stmt((yyvsp[-2].fExpr), (yyvsp[-1].fInt), (yyvsp[0].fExpr)); }
+#line 2404 "y.tab.c"
+    break;
+
+  case 70: /* expr_stmt: expr '=' expr  */
 #line 286 "parse.y"
-{ yyval.fExpr = 0; ;
-    break;}
-case 72:
+                                                { CheckLValue((yyvsp[-2].fExpr)); (yyval.fStmt) = new AssignStmt((yyvsp[-2].fExpr), (yyvsp[0].fExpr)); }
+#line 2410 "y.tab.c"
+    break;
+
+  case 72: /* opt_expr_stmt: %empty  */
 #line 291 "parse.y"
-{ yyval.fStmt = 0; ;
-    break;}
-case 73:
+                                        { (yyval.fStmt) = 0; }
+#line 2416 "y.tab.c"
+    break;
+
+  case 74: /* opt_expr: %empty  */
 #line 295 "parse.y"
-{ yyvsp[-1].fBlock->Add(yyvsp[0].fStmt); yyval.fBlock = yyvsp[-1].fBlock; ;
-    break;}
-case 74:
-#line 296 "parse.y"
-{ yyval.fBlock =  new BlockStmt(); ;
-    break;}
-case 75:
-#line 299 "parse.y"
-{ yyval.fStmt = yyvsp[0].fStmt; ;
-    break;}
-case 76:
+                { (yyval.fExpr) = 0; }
+#line 2422 "y.tab.c"
+    break;
+
+  case 76: /* opt_handler: %empty  */
 #line 300 "parse.y"
-{ yyval.fStmt = MakeCatchStmt(yyvsp[-2].fExpr, yyvsp[0].fStmt, yyvsp[-4].fLocation); ;
-    break;}
-case 77:
+                { (yyval.fStmt) = 0; }
+#line 2428 "y.tab.c"
+    break;
+
+  case 77: /* handler_list: handler_list evt_handler  */
 #line 304 "parse.y"
-{ yyval.fStmt = yyvsp[0].fStmt; ;
-    break;}
-case 78:
-#line 307 "parse.y"
-{ yyval.fCaseStmt = MakeCaseStmt(yyvsp[-1].fExpr, sSavedLoc); ;
-    break;}
-case 79:
+                                                { (yyvsp[-1].fBlock)->Add((yyvsp[0].fStmt)); (yyval.fBlock) = (yyvsp[-1].fBlock); }
+#line 2434 "y.tab.c"
+    break;
+
+  case 78: /* handler_list: %empty  */
+#line 305 "parse.y"
+                                                                                        { (yyval.fBlock) =  new BlockStmt(); }
+#line 2440 "y.tab.c"
+    break;
+
+  case 79: /* evt_handler: CATCH block  */
 #line 308 "parse.y"
-{ yyval.fCaseStmt = new CaseStmt(CaseStmt::kDefaultValue, sSavedLoc); ;
-    break;}
-case 81:
-#line 312 "parse.y"
-{ yyval.fCall = new CallStmt(); ;
-    break;}
-case 82:
-#line 315 "parse.y"
-{ yyval.fCall = yyvsp[-2].fCall; yyval.fCall->AddParam(yyvsp[0].fExpr); ;
-    break;}
-case 83:
+                                        { (yyval.fStmt) = (yyvsp[0].fStmt); }
+#line 2446 "y.tab.c"
+    break;
+
+  case 80: /* evt_handler: CATCH loc '(' expr ')' block  */
+#line 309 "parse.y"
+                                        { (yyval.fStmt) = MakeCatchStmt((yyvsp[-2].fExpr), (yyvsp[0].fStmt), (yyvsp[-4].fLocation)); }
+#line 2452 "y.tab.c"
+    break;
+
+  case 81: /* handler: CATCH block  */
+#line 313 "parse.y"
+                        { (yyval.fStmt) = (yyvsp[0].fStmt); }
+#line 2458 "y.tab.c"
+    break;
+
+  case 82: /* case: saveloc CASE expr ':'  */
 #line 316 "parse.y"
-{ yyval.fCall = new CallStmt(); yyval.fCall->AddParam(yyvsp[0].fExpr); ;
-    break;}
-case 84:
-#line 319 "parse.y"
-{ yyval.fExpr = new AtomExpr(kRCX_ConstantType, yyvsp[-1].fInt, sSavedLoc); ;
-    break;}
-case 85:
-#line 320 "parse.y"
-{ yyval.fExpr = MakeBinaryExpr(yyvsp[-2].fExpr, '+', yyvsp[0].fExpr); ;
-    break;}
-case 86:
+                                { (yyval.fCaseStmt) = MakeCaseStmt((yyvsp[-1].fExpr), sSavedLoc); }
+#line 2464 "y.tab.c"
+    break;
+
+  case 83: /* case: saveloc DEFAULT ':'  */
+#line 317 "parse.y"
+                                        { (yyval.fCaseStmt) = new CaseStmt(CaseStmt::kDefaultValue, sSavedLoc); }
+#line 2470 "y.tab.c"
+    break;
+
+  case 85: /* params: %empty  */
 #line 321 "parse.y"
-{ yyval.fExpr = MakeBinaryExpr(yyvsp[-2].fExpr, '-', yyvsp[0].fExpr); ;
-    break;}
-case 87:
-#line 322 "parse.y"
-{ yyval.fExpr = MakeBinaryExpr(yyvsp[-2].fExpr, '*', yyvsp[0].fExpr); ;
-    break;}
-case 88:
-#line 323 "parse.y"
-{ yyval.fExpr = MakeBinaryExpr(yyvsp[-2].fExpr, '/', yyvsp[0].fExpr); ;
-    break;}
-case 89:
+                                        { (yyval.fCall) = new CallStmt(); }
+#line 2476 "y.tab.c"
+    break;
+
+  case 86: /* param_list: param_list ',' expr  */
 #line 324 "parse.y"
-{ yyval.fExpr = MakeBinaryExpr(yyvsp[-2].fExpr, '&', yyvsp[0].fExpr); ;
-    break;}
-case 90:
+                                        { (yyval.fCall) = (yyvsp[-2].fCall); (yyval.fCall)->AddParam((yyvsp[0].fExpr)); }
+#line 2482 "y.tab.c"
+    break;
+
+  case 87: /* param_list: expr  */
 #line 325 "parse.y"
-{ yyval.fExpr = MakeBinaryExpr(yyvsp[-2].fExpr, '|', yyvsp[0].fExpr); ;
-    break;}
-case 91:
-#line 326 "parse.y"
-{ yyval.fExpr = MakeBinaryExpr(yyvsp[-2].fExpr, '%', yyvsp[0].fExpr); ;
-    break;}
-case 92:
-#line 327 "parse.y"
-{ yyval.fExpr = MakeBinaryExpr(yyvsp[-2].fExpr, LEFT, yyvsp[0].fExpr); ;
-    break;}
-case 93:
+                                                                { (yyval.fCall) = new CallStmt(); (yyval.fCall)->AddParam((yyvsp[0].fExpr)); }
+#line 2488 "y.tab.c"
+    break;
+
+  case 88: /* expr: NUMBER saveloc  */
 #line 328 "parse.y"
-{ yyval.fExpr = MakeBinaryExpr(yyvsp[-2].fExpr, RIGHT, yyvsp[0].fExpr); ;
-    break;}
-case 94:
+                                { (yyval.fExpr) = new AtomExpr(kRCX_ConstantType, (yyvsp[-1].fInt), sSavedLoc); }
+#line 2494 "y.tab.c"
+    break;
+
+  case 89: /* expr: expr '+' expr  */
 #line 329 "parse.y"
-{ yyval.fExpr = MakeBinaryExpr(yyvsp[-2].fExpr, '^', yyvsp[0].fExpr); ;
-    break;}
-case 95:
+                                { (yyval.fExpr) = MakeBinaryExpr((yyvsp[-2].fExpr), '+', (yyvsp[0].fExpr)); }
+#line 2500 "y.tab.c"
+    break;
+
+  case 90: /* expr: expr '-' expr  */
 #line 330 "parse.y"
-{ yyval.fExpr = new RelExpr(yyvsp[-2].fExpr, RelExpr::kEqualTo, yyvsp[0].fExpr); ;
-    break;}
-case 96:
+                                { (yyval.fExpr) = MakeBinaryExpr((yyvsp[-2].fExpr), '-', (yyvsp[0].fExpr)); }
+#line 2506 "y.tab.c"
+    break;
+
+  case 91: /* expr: expr '*' expr  */
 #line 331 "parse.y"
-{ yyval.fExpr = new RelExpr(yyvsp[-2].fExpr, RelExpr::kLessOrEqual, yyvsp[0].fExpr); ;
-    break;}
-case 97:
+                                { (yyval.fExpr) = MakeBinaryExpr((yyvsp[-2].fExpr), '*', (yyvsp[0].fExpr)); }
+#line 2512 "y.tab.c"
+    break;
+
+  case 92: /* expr: expr '/' expr  */
 #line 332 "parse.y"
-{ yyval.fExpr = new RelExpr(yyvsp[-2].fExpr, RelExpr::kGreaterOrEqual, yyvsp[0].fExpr); ;
-    break;}
-case 98:
+                                { (yyval.fExpr) = MakeBinaryExpr((yyvsp[-2].fExpr), '/', (yyvsp[0].fExpr)); }
+#line 2518 "y.tab.c"
+    break;
+
+  case 93: /* expr: expr '&' expr  */
 #line 333 "parse.y"
-{ yyval.fExpr = new RelExpr(yyvsp[-2].fExpr, RelExpr::kNotEqualTo, yyvsp[0].fExpr); ;
-    break;}
-case 99:
+                                { (yyval.fExpr) = MakeBinaryExpr((yyvsp[-2].fExpr), '&', (yyvsp[0].fExpr)); }
+#line 2524 "y.tab.c"
+    break;
+
+  case 94: /* expr: expr '|' expr  */
 #line 334 "parse.y"
-{ yyval.fExpr = new RelExpr(yyvsp[-2].fExpr, RelExpr::kLessThan, yyvsp[0].fExpr); ;
-    break;}
-case 100:
+                                { (yyval.fExpr) = MakeBinaryExpr((yyvsp[-2].fExpr), '|', (yyvsp[0].fExpr)); }
+#line 2530 "y.tab.c"
+    break;
+
+  case 95: /* expr: expr '%' expr  */
 #line 335 "parse.y"
-{ yyval.fExpr = new RelExpr(yyvsp[-2].fExpr, RelExpr::kGreaterThan, yyvsp[0].fExpr); ;
-    break;}
-case 101:
+                                { (yyval.fExpr) = MakeBinaryExpr((yyvsp[-2].fExpr), '%', (yyvsp[0].fExpr)); }
+#line 2536 "y.tab.c"
+    break;
+
+  case 96: /* expr: expr LEFT expr  */
 #line 336 "parse.y"
-{ yyval.fExpr = new AtomExpr(kRCX_ConstantType, 1, sSavedLoc); ;
-    break;}
-case 102:
+                                { (yyval.fExpr) = MakeBinaryExpr((yyvsp[-2].fExpr), LEFT, (yyvsp[0].fExpr)); }
+#line 2542 "y.tab.c"
+    break;
+
+  case 97: /* expr: expr RIGHT expr  */
 #line 337 "parse.y"
-{ yyval.fExpr = new AtomExpr(kRCX_ConstantType, 0, sSavedLoc); ;
-    break;}
-case 103:
+                                { (yyval.fExpr) = MakeBinaryExpr((yyvsp[-2].fExpr), RIGHT, (yyvsp[0].fExpr)); }
+#line 2548 "y.tab.c"
+    break;
+
+  case 98: /* expr: expr '^' expr  */
 #line 338 "parse.y"
-{ yyval.fExpr = new NegateExpr(yyvsp[0].fExpr); ;
-    break;}
-case 104:
+                                { (yyval.fExpr) = MakeBinaryExpr((yyvsp[-2].fExpr), '^', (yyvsp[0].fExpr)); }
+#line 2554 "y.tab.c"
+    break;
+
+  case 99: /* expr: expr REL_EQ expr  */
 #line 339 "parse.y"
-{ yyval.fExpr = new LogicalExpr(yyvsp[-2].fExpr, LogicalExpr::kLogicalAnd, yyvsp[0].fExpr); ;
-    break;}
-case 105:
+                                        { (yyval.fExpr) = new RelExpr((yyvsp[-2].fExpr), RelExpr::kEqualTo, (yyvsp[0].fExpr)); }
+#line 2560 "y.tab.c"
+    break;
+
+  case 100: /* expr: expr REL_LE expr  */
 #line 340 "parse.y"
-{ yyval.fExpr = new LogicalExpr(yyvsp[-2].fExpr, LogicalExpr::kLogicalOr, yyvsp[0].fExpr); ;
-    break;}
-case 106:
+                                        { (yyval.fExpr) = new RelExpr((yyvsp[-2].fExpr), RelExpr::kLessOrEqual, (yyvsp[0].fExpr)); }
+#line 2566 "y.tab.c"
+    break;
+
+  case 101: /* expr: expr REL_GE expr  */
+#line 341 "parse.y"
+                                        { (yyval.fExpr) = new RelExpr((yyvsp[-2].fExpr), RelExpr::kGreaterOrEqual, (yyvsp[0].fExpr)); }
+#line 2572 "y.tab.c"
+    break;
+
+  case 102: /* expr: expr REL_NE expr  */
 #line 342 "parse.y"
-{ yyval.fExpr = MakeBinaryExpr(new AtomExpr(kRCX_ConstantType, 0, yyvsp[0].fExpr->GetLoc()), '-', yyvsp[0].fExpr); ;
-    break;}
-case 107:
+                                        { (yyval.fExpr) = new RelExpr((yyvsp[-2].fExpr), RelExpr::kNotEqualTo, (yyvsp[0].fExpr)); }
+#line 2578 "y.tab.c"
+    break;
+
+  case 103: /* expr: expr '<' expr  */
 #line 343 "parse.y"
-{ yyval.fExpr = MakeUnaryExpr('~', yyvsp[0].fExpr); ;
-    break;}
-case 108:
+                                { (yyval.fExpr) = new RelExpr((yyvsp[-2].fExpr), RelExpr::kLessThan, (yyvsp[0].fExpr)); }
+#line 2584 "y.tab.c"
+    break;
+
+  case 104: /* expr: expr '>' expr  */
+#line 344 "parse.y"
+                                { (yyval.fExpr) = new RelExpr((yyvsp[-2].fExpr), RelExpr::kGreaterThan, (yyvsp[0].fExpr)); }
+#line 2590 "y.tab.c"
+    break;
+
+  case 105: /* expr: CTRUE saveloc  */
 #line 345 "parse.y"
-{ yyval.fExpr = MakeUnaryExpr(ABS, yyvsp[-1].fExpr); ;
-    break;}
-case 109:
+                                                { (yyval.fExpr) = new AtomExpr(kRCX_ConstantType, 1, sSavedLoc); }
+#line 2596 "y.tab.c"
+    break;
+
+  case 106: /* expr: CFALSE saveloc  */
 #line 346 "parse.y"
-{ yyval.fExpr = MakeUnaryExpr(SIGN, yyvsp[-1].fExpr); ;
-    break;}
-case 110:
+                                                { (yyval.fExpr) = new AtomExpr(kRCX_ConstantType, 0, sSavedLoc); }
+#line 2602 "y.tab.c"
+    break;
+
+  case 107: /* expr: '!' expr  */
+#line 347 "parse.y"
+                                        { (yyval.fExpr) = new NegateExpr((yyvsp[0].fExpr)); }
+#line 2608 "y.tab.c"
+    break;
+
+  case 108: /* expr: expr AND expr  */
 #line 348 "parse.y"
-{ yyval.fExpr = yyvsp[-1].fExpr; ;
-    break;}
-case 111:
+                                { (yyval.fExpr) = new LogicalExpr((yyvsp[-2].fExpr), LogicalExpr::kLogicalAnd, (yyvsp[0].fExpr)); }
+#line 2614 "y.tab.c"
+    break;
+
+  case 109: /* expr: expr OR expr  */
 #line 349 "parse.y"
-{ yyval.fExpr = MakeVarExpr(yyvsp[0].fSymbol, yyvsp[-1].fLocation); ;
-    break;}
-case 112:
-#line 350 "parse.y"
-{ yyval.fExpr = MakeArrayExpr(yyvsp[-3].fSymbol, yyvsp[-4].fLocation, yyvsp[-1].fExpr); ;
-    break;}
-case 113:
+                                { (yyval.fExpr) = new LogicalExpr((yyvsp[-2].fExpr), LogicalExpr::kLogicalOr, (yyvsp[0].fExpr)); }
+#line 2620 "y.tab.c"
+    break;
+
+  case 110: /* expr: '-' expr  */
 #line 351 "parse.y"
-{ yyval.fExpr = MakeValueExpr(yyvsp[0].fExpr); ;
-    break;}
-case 114:
-#line 353 "parse.y"
-{ yyval.fExpr = MakeIncDecExpr(yyvsp[-1].fExpr, yyvsp[0].fInt, false, yyvsp[-1].fExpr->GetLoc()); ;
-    break;}
-case 115:
+                                                { (yyval.fExpr) = MakeBinaryExpr(new AtomExpr(kRCX_ConstantType, 0, (yyvsp[0].fExpr)->GetLoc()), '-', (yyvsp[0].fExpr)); }
+#line 2626 "y.tab.c"
+    break;
+
+  case 111: /* expr: '~' expr  */
+#line 352 "parse.y"
+                                        { (yyval.fExpr) = MakeUnaryExpr('~', (yyvsp[0].fExpr)); }
+#line 2632 "y.tab.c"
+    break;
+
+  case 112: /* expr: ABS '(' expr ')'  */
 #line 354 "parse.y"
-{ yyval.fExpr = MakeIncDecExpr(yyvsp[0].fExpr, yyvsp[-1].fInt, true, yyvsp[0].fExpr->GetLoc()); ;
-    break;}
-case 116:
-#line 356 "parse.y"
-{ yyval.fExpr = new SensorExpr(yyvsp[-1].fExpr); ;
-    break;}
-case 117:
+                                        { (yyval.fExpr) = MakeUnaryExpr(ABS, (yyvsp[-1].fExpr)); }
+#line 2638 "y.tab.c"
+    break;
+
+  case 113: /* expr: SIGN '(' expr ')'  */
+#line 355 "parse.y"
+                                        { (yyval.fExpr) = MakeUnaryExpr(SIGN, (yyvsp[-1].fExpr)); }
+#line 2644 "y.tab.c"
+    break;
+
+  case 114: /* expr: '(' expr ')'  */
 #line 357 "parse.y"
-{ yyval.fExpr = new TypeExpr(yyvsp[-1].fExpr); ;
-    break;}
-case 118:
+                                        { (yyval.fExpr) = (yyvsp[-1].fExpr); }
+#line 2650 "y.tab.c"
+    break;
+
+  case 115: /* expr: loc ID  */
 #line 358 "parse.y"
-{ yyval.fExpr = new EventSrcExpr(yyvsp[-1].fExpr, gProgram->GetTarget()->fType); ;
-    break;}
-case 119:
+                                                { (yyval.fExpr) = MakeVarExpr((yyvsp[0].fSymbol), (yyvsp[-1].fLocation)); }
+#line 2656 "y.tab.c"
+    break;
+
+  case 116: /* expr: loc ID '[' expr ']'  */
 #line 359 "parse.y"
-{ yyval.fExpr = MakeTaskIdExpr(yyvsp[-1].fLocation); ;
-    break;}
-case 120:
+                                { (yyval.fExpr) = MakeArrayExpr((yyvsp[-3].fSymbol), (yyvsp[-4].fLocation), (yyvsp[-1].fExpr)); }
+#line 2662 "y.tab.c"
+    break;
+
+  case 117: /* expr: '@' expr  */
 #line 360 "parse.y"
-{ yyval.fExpr = MakeIndirectExpr(yyvsp[-4].fExpr, yyvsp[-1].fExpr); ;
-    break;}
-case 121:
-#line 361 "parse.y"
-{ yyval.fExpr = new TernaryExpr(yyvsp[-4].fExpr, yyvsp[-2].fExpr, yyvsp[0].fExpr); ;
-    break;}
-case 122:
+                                                { (yyval.fExpr) = MakeValueExpr((yyvsp[0].fExpr)); }
+#line 2668 "y.tab.c"
+    break;
+
+  case 118: /* expr: expr INCDEC  */
 #line 362 "parse.y"
-{ yyval.fExpr = MakeAddrOfExpr(yyvsp[0].fSymbol, yyvsp[-2].fLocation, (Expr *)0); ;
-    break;}
-case 123:
+                                                { (yyval.fExpr) = MakeIncDecExpr((yyvsp[-1].fExpr), (yyvsp[0].fInt), false, (yyvsp[-1].fExpr)->GetLoc()); }
+#line 2674 "y.tab.c"
+    break;
+
+  case 119: /* expr: INCDEC expr  */
 #line 363 "parse.y"
-{ yyval.fExpr = MakeAddrOfExpr(yyvsp[-3].fSymbol, yyvsp[-5].fLocation, yyvsp[-1].fExpr); ;
-    break;}
-case 124:
-#line 364 "parse.y"
-{ yyval.fExpr = MakeDerefExpr(yyvsp[0].fSymbol, yyvsp[-2].fLocation); ;
-    break;}
-case 125:
+                                        { (yyval.fExpr) = MakeIncDecExpr((yyvsp[0].fExpr), (yyvsp[-1].fInt), true, (yyvsp[0].fExpr)->GetLoc()); }
+#line 2680 "y.tab.c"
+    break;
+
+  case 120: /* expr: SENSOR '(' expr ')'  */
+#line 365 "parse.y"
+                                        { (yyval.fExpr) = new SensorExpr((yyvsp[-1].fExpr)); }
+#line 2686 "y.tab.c"
+    break;
+
+  case 121: /* expr: TYPE '(' expr ')'  */
+#line 366 "parse.y"
+                                                { (yyval.fExpr) = new TypeExpr((yyvsp[-1].fExpr)); }
+#line 2692 "y.tab.c"
+    break;
+
+  case 122: /* expr: EVENT_SRC '(' expr ')'  */
 #line 367 "parse.y"
-{ LexCurrentLocation(sSavedLoc); ;
-    break;}
-case 126:
+                                        { (yyval.fExpr) = new EventSrcExpr((yyvsp[-1].fExpr), gProgram->GetTarget()->fType); }
+#line 2698 "y.tab.c"
+    break;
+
+  case 123: /* expr: loc TASKID  */
+#line 368 "parse.y"
+                                                { (yyval.fExpr) = MakeTaskIdExpr((yyvsp[-1].fLocation)); }
+#line 2704 "y.tab.c"
+    break;
+
+  case 124: /* expr: INDIRECT '(' expr ')' '[' expr ']'  */
+#line 369 "parse.y"
+                                                        { (yyval.fExpr) = MakeIndirectExpr((yyvsp[-4].fExpr), (yyvsp[-1].fExpr)); }
+#line 2710 "y.tab.c"
+    break;
+
+  case 125: /* expr: expr '?' expr ':' expr  */
 #line 370 "parse.y"
-{ yyval.fLocation = new LocationNode(); ;
-    break;}
-case 127:
+                                        { (yyval.fExpr) = new TernaryExpr((yyvsp[-4].fExpr), (yyvsp[-2].fExpr), (yyvsp[0].fExpr)); }
+#line 2716 "y.tab.c"
+    break;
+
+  case 126: /* expr: loc '&' ID  */
+#line 371 "parse.y"
+                                                  { (yyval.fExpr) = MakeAddrOfExpr((yyvsp[0].fSymbol), (yyvsp[-2].fLocation), (Expr *)0); }
+#line 2722 "y.tab.c"
+    break;
+
+  case 127: /* expr: loc '&' ID '[' expr ']'  */
+#line 372 "parse.y"
+                                                  { (yyval.fExpr) = MakeAddrOfExpr((yyvsp[-3].fSymbol), (yyvsp[-5].fLocation), (yyvsp[-1].fExpr)); }
+#line 2728 "y.tab.c"
+    break;
+
+  case 128: /* expr: loc '*' ID  */
 #line 373 "parse.y"
-{ yyval.fAsmStmt = yyvsp[-2].fAsmStmt; yyvsp[-2].fAsmStmt->Add(yyvsp[0].fField); ;
-    break;}
-case 128:
-#line 374 "parse.y"
-{ yyval.fAsmStmt = new AsmStmt(); yyval.fAsmStmt->Add(yyvsp[0].fField); ;
-    break;}
-case 129:
-#line 375 "parse.y"
-{ yyval.fAsmStmt = new AsmStmt(); ;
-    break;}
-case 130:
+                                                  { (yyval.fExpr) = MakeDerefExpr((yyvsp[0].fSymbol), (yyvsp[-2].fLocation)); }
+#line 2734 "y.tab.c"
+    break;
+
+  case 129: /* saveloc: %empty  */
+#line 376 "parse.y"
+                                                { LexCurrentLocation(sSavedLoc); }
+#line 2740 "y.tab.c"
+    break;
+
+  case 130: /* loc: %empty  */
 #line 379 "parse.y"
-{ yyval.fField = MakeConstField(yyvsp[0].fExpr); ;
-    break;}
-case 131:
-#line 380 "parse.y"
-{ yyval.fField = new EAField(yyvsp[0].fExpr); ;
-    break;}
-case 132:
-#line 381 "parse.y"
-{ yyval.fField = new EAField(yyvsp[-2].fExpr, GetConstantValue(yyvsp[0].fExpr)); ;
-    break;}
-case 133:
-#line 385 "parse.y"
-{ yyval.fResource=yyvsp[-1].fResource; yyvsp[-1].fResource->SetInfo((RCX_ChunkType)GetConstantValue(yyvsp[-4].fExpr), yyvsp[-3].fSymbol); ;
-    break;}
-case 134:
+                                        { (yyval.fLocation) = new LocationNode(); }
+#line 2746 "y.tab.c"
+    break;
+
+  case 131: /* asm_list: asm_list ',' asm_item  */
+#line 382 "parse.y"
+                                        { (yyval.fAsmStmt) = (yyvsp[-2].fAsmStmt); (yyvsp[-2].fAsmStmt)->Add((yyvsp[0].fField)); }
+#line 2752 "y.tab.c"
+    break;
+
+  case 132: /* asm_list: asm_item  */
+#line 383 "parse.y"
+                        { (yyval.fAsmStmt) = new AsmStmt(); (yyval.fAsmStmt)->Add((yyvsp[0].fField)); }
+#line 2758 "y.tab.c"
+    break;
+
+  case 133: /* asm_list: %empty  */
+#line 384 "parse.y"
+                                { (yyval.fAsmStmt) = new AsmStmt(); }
+#line 2764 "y.tab.c"
+    break;
+
+  case 134: /* asm_item: expr  */
 #line 388 "parse.y"
-{ yyval.fResource = yyvsp[-2].fResource; yyvsp[-2].fResource->Add(yyvsp[0].fInt); ;
-    break;}
-case 135:
+                        { (yyval.fField) = MakeConstField((yyvsp[0].fExpr)); }
+#line 2770 "y.tab.c"
+    break;
+
+  case 135: /* asm_item: '$' expr  */
 #line 389 "parse.y"
-{ yyval.fResource = new Resource(); yyval.fResource->Add(yyvsp[0].fInt); ;
-    break;}
-case 136:
+                        { (yyval.fField) = new EAField((yyvsp[0].fExpr)); }
+#line 2776 "y.tab.c"
+    break;
+
+  case 136: /* asm_item: '$' expr ':' expr  */
 #line 390 "parse.y"
-{ yyval.fResource = new Resource(); ;
-    break;}
-case 137:
-#line 393 "parse.y"
-{ yyval.fInt = GetConstantValue(yyvsp[0].fExpr); ;
-    break;}
-}
-   /* the action file gets copied in in place of this dollarsign */
-#line 487 "bison.simple"
-
-  yyvsp -= yylen;
-  yyssp -= yylen;
-#ifdef YYLSP_NEEDED
-  yylsp -= yylen;
-#endif
+                                { (yyval.fField) = new EAField((yyvsp[-2].fExpr), GetConstantValue((yyvsp[0].fExpr))); }
+#line 2782 "y.tab.c"
+    break;
 
-#if YYDEBUG != 0
-  if (yydebug)
-    {
-      short *ssp1 = yyss - 1;
-      fprintf (stderr, "state stack now");
-      while (ssp1 != yyssp)
-	fprintf (stderr, " %d", *++ssp1);
-      fprintf (stderr, "\n");
-    }
-#endif
+  case 137: /* resource: RES expr ID '{' res_data '}'  */
+#line 394 "parse.y"
+                                        { (yyval.fResource)=(yyvsp[-1].fResource); (yyvsp[-1].fResource)->SetInfo((RCX_ChunkType)GetConstantValue((yyvsp[-4].fExpr)), (yyvsp[-3].fSymbol)); }
+#line 2788 "y.tab.c"
+    break;
 
-  *++yyvsp = yyval;
+  case 138: /* res_data: res_data ',' res_byte  */
+#line 397 "parse.y"
+                                        { (yyval.fResource) = (yyvsp[-2].fResource); (yyvsp[-2].fResource)->Add((yyvsp[0].fInt)); }
+#line 2794 "y.tab.c"
+    break;
 
-#ifdef YYLSP_NEEDED
-  yylsp++;
-  if (yylen == 0)
-    {
-      yylsp->first_line = yylloc.first_line;
-      yylsp->first_column = yylloc.first_column;
-      yylsp->last_line = (yylsp-1)->last_line;
-      yylsp->last_column = (yylsp-1)->last_column;
-      yylsp->text = 0;
-    }
-  else
-    {
-      yylsp->last_line = (yylsp+yylen-1)->last_line;
-      yylsp->last_column = (yylsp+yylen-1)->last_column;
-    }
-#endif
+  case 139: /* res_data: res_byte  */
+#line 398 "parse.y"
+                                { (yyval.fResource) = new Resource(); (yyval.fResource)->Add((yyvsp[0].fInt)); }
+#line 2800 "y.tab.c"
+    break;
 
-  /* Now "shift" the result of the reduction.
-     Determine what state that goes to,
-     based on the state we popped back to
-     and the rule number reduced by.  */
+  case 140: /* res_data: %empty  */
+#line 399 "parse.y"
+                                        { (yyval.fResource) = new Resource(); }
+#line 2806 "y.tab.c"
+    break;
 
-  yyn = yyr1[yyn];
+  case 141: /* res_byte: expr  */
+#line 402 "parse.y"
+                        { (yyval.fInt) = GetConstantValue((yyvsp[0].fExpr)); }
+#line 2812 "y.tab.c"
+    break;
 
-  yystate = yypgoto[yyn - YYNTBASE] + *yyssp;
-  if (yystate >= 0 && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTBASE];
+
+#line 2816 "y.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
-yyerrlab:   /* here on detecting error */
 
-  if (! yyerrstatus)
-    /* If not already recovering from an error, report this error.  */
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
     {
       ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
 
-#ifdef YYERROR_VERBOSE
-      yyn = yypact[yystate];
-
-      if (yyn > YYFLAG && yyn < YYLAST)
-	{
-	  int size = 0;
-	  char *msg;
-	  int x, count;
-
-	  count = 0;
-	  /* Start X at -yyn if nec to avoid negative indexes in yycheck.  */
-	  for (x = (yyn < 0 ? -yyn : 0);
-	       x < (sizeof(yytname) / sizeof(char *)); x++)
-	    if (yycheck[x + yyn] == x)
-	      size += strlen(yytname[x]) + 15, count++;
-	  msg = (char *) malloc(size + 15);
-	  if (msg != 0)
-	    {
-	      strcpy(msg, "parse error");
-
-	      if (count < 5)
-		{
-		  count = 0;
-		  for (x = (yyn < 0 ? -yyn : 0);
-		       x < (sizeof(yytname) / sizeof(char *)); x++)
-		    if (yycheck[x + yyn] == x)
-		      {
-			strcat(msg, count == 0 ? ", expecting `" : " or `");
-			strcat(msg, yytname[x]);
-			strcat(msg, "'");
-			count++;
-		      }
-		}
-	      yyerror(msg);
-	      free(msg);
-	    }
-	  else
-	    yyerror ("parse error; also virtual memory exceeded");
-	}
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
       else
-#endif /* YYERROR_VERBOSE */
-	yyerror("parse error");
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
     }
 
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
   goto yyerrlab1;
-yyerrlab1:   /* here on error raised explicitly by an action */
 
-  if (yyerrstatus == 3)
-    {
-      /* if just tried and failed to reuse lookahead token after an error, discard it.  */
 
-      /* return failure if at end of input */
-      if (yychar == YYEOF)
-	YYABORT;
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
 
-#if YYDEBUG != 0
-      if (yydebug)
-	fprintf(stderr, "Discarding token %d (%s).\n", yychar, yytname[yychar1]);
-#endif
 
-      yychar = YYEMPTY;
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
     }
 
-  /* Else will try to reuse lookahead token
-     after shifting the error token.  */
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
-  yyerrstatus = 3;		/* Each real token shifted decrements this */
 
-  goto yyerrhandle;
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
-yyerrdefault:  /* current state does not do anything special for the error token. */
+  yystate = yyn;
+  goto yynewstate;
 
-#if 0
-  /* This is wrong; only states that explicitly want error tokens
-     should shift them.  */
-  yyn = yydefact[yystate];  /* If its default is to accept any token, ok.  Otherwise pop it.*/
-  if (yyn) goto yydefault;
-#endif
 
-yyerrpop:   /* pop the current state because it cannot handle the error token */
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
 
-  if (yyssp == yyss) YYABORT;
-  yyvsp--;
-  yystate = *--yyssp;
-#ifdef YYLSP_NEEDED
-  yylsp--;
-#endif
 
-#if YYDEBUG != 0
-  if (yydebug)
-    {
-      short *ssp1 = yyss - 1;
-      fprintf (stderr, "Error: state stack now");
-      while (ssp1 != yyssp)
-	fprintf (stderr, " %d", *++ssp1);
-      fprintf (stderr, "\n");
-    }
-#endif
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
 
-yyerrhandle:
 
-  yyn = yypact[yystate];
-  if (yyn == YYFLAG)
-    goto yyerrdefault;
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
 
-  yyn += YYTERROR;
-  if (yyn < 0 || yyn > YYLAST || yycheck[yyn] != YYTERROR)
-    goto yyerrdefault;
 
-  yyn = yytable[yyn];
-  if (yyn < 0)
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
     {
-      if (yyn == YYFLAG)
-	goto yyerrpop;
-      yyn = -yyn;
-      goto yyreduce;
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
     }
-  else if (yyn == 0)
-    goto yyerrpop;
-
-  if (yyn == YYFINAL)
-    YYACCEPT;
-
-#if YYDEBUG != 0
-  if (yydebug)
-    fprintf(stderr, "Shifting error token, ");
-#endif
-
-  *++yyvsp = yylval;
-#ifdef YYLSP_NEEDED
-  *++yylsp = yylloc;
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
 #endif
 
-  yystate = yyn;
-  goto yynewstate;
+  return yyresult;
 }
-#line 397 "parse.y"
+
+#line 406 "parse.y"
 
 
 
@@ -1,12 +1,14 @@
-/* A Bison parser, made by GNU Bison 1.875.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
-/* Skeleton parser for Yacc-like parsing with Bison,
-   Copyright (C) 1984, 1989, 1990, 2000, 2001, 2002 Free Software Foundation, Inc.
+/* Bison interface for Yacc-like parsers in C
 
-   This program is free software; you can redistribute it and/or modify
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
-   the Free Software Foundation; either version 2, or (at your option)
-   any later version.
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
 
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
@@ -14,115 +16,144 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program; if not, write to the Free Software
-   Foundation, Inc., 59 Temple Place - Suite 330,
-   Boston, MA 02111-1307, USA.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
 
-/* As a special exception, when this file is copied by Bison into a
-   Bison output file, you may use that output file without restriction.
-   This special exception was added by the Free Software Foundation
-   in version 1.24 of Bison.  */
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
 
-/* Tokens.  */
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_Y_TAB_H_INCLUDED
+# define YY_YY_Y_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     OR = 258,
-     AND = 259,
-     REL_NE = 260,
-     REL_EQ = 261,
-     REL_GE = 262,
-     REL_LE = 263,
-     RIGHT = 264,
-     LEFT = 265,
-     INDIRECT = 266,
-     UMINUS = 267,
-     INCDEC = 268,
-     EVENT_SRC = 269,
-     TYPE = 270,
-     SIGN = 271,
-     ABS = 272,
-     LOWER_THAN_ELSE = 273,
-     ELSE = 274,
-     LOWER_THAN_EXPR_SHIFT = 275,
-     ID = 276,
-     NUMBER = 277,
-     ASSIGN = 278,
-     ASSIGN2 = 279,
-     TASKOP = 280,
-     JUMP = 281,
-     TASK = 282,
-     SUB = 283,
-     STRING = 284,
-     PP_DEFINE = 285,
-     PP_INCLUDE = 286,
-     NL = 287,
-     WS = 288,
-     PP_ARG = 289,
-     PP_UNKNOWN = 290,
-     PP_IFDEF = 291,
-     PP_IF = 292,
-     PP_ELSE = 293,
-     PP_ELIF = 294,
-     PP_ENDIF = 295,
-     PP_UNDEF = 296,
-     PP_PRAGMA = 297,
-     PP_GLOM = 298,
-     PP_ERROR = 299,
-     PP_WARNING = 300,
-     IF = 301,
-     WHILE = 302,
-     DO = 303,
-     FOR = 304,
-     REPEAT = 305,
-     SWITCH = 306,
-     CASE = 307,
-     DEFAULT = 308,
-     MONITOR = 309,
-     CATCH = 310,
-     ACQUIRE = 311,
-     GOTO = 312,
-     ASM = 313,
-     INT = 314,
-     T_VOID = 315,
-     T_CONST = 316,
-     SENSOR = 317,
-     TASKID = 318,
-     NOLIST = 319,
-     RES = 320,
-     CTRUE = 321,
-     CFALSE = 322
-   };
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    OR = 258,                      /* OR  */
+    AND = 259,                     /* AND  */
+    LEFT = 260,                    /* LEFT  */
+    RIGHT = 261,                   /* RIGHT  */
+    UMINUS = 262,                  /* UMINUS  */
+    INDIRECT = 263,                /* INDIRECT  */
+    ABS = 264,                     /* ABS  */
+    SIGN = 265,                    /* SIGN  */
+    TYPE = 266,                    /* TYPE  */
+    EVENT_SRC = 267,               /* EVENT_SRC  */
+    LOWER_THAN_ELSE = 268,         /* LOWER_THAN_ELSE  */
+    ELSE = 269,                    /* ELSE  */
+    LOWER_THAN_EXPR_SHIFT = 270,   /* LOWER_THAN_EXPR_SHIFT  */
+    ID = 271,                      /* ID  */
+    NUMBER = 272,                  /* NUMBER  */
+    ASSIGN = 273,                  /* ASSIGN  */
+    ASSIGN2 = 274,                 /* ASSIGN2  */
+    TASKOP = 275,                  /* TASKOP  */
+    JUMP = 276,                    /* JUMP  */
+    TASK = 277,                    /* TASK  */
+    SUB = 278,                     /* SUB  */
+    INCDEC = 279,                  /* INCDEC  */
+    STRING = 280,                  /* STRING  */
+    REL_GE = 281,                  /* REL_GE  */
+    REL_LE = 282,                  /* REL_LE  */
+    REL_EQ = 283,                  /* REL_EQ  */
+    REL_NE = 284,                  /* REL_NE  */
+    PP_DEFINE = 285,               /* PP_DEFINE  */
+    PP_INCLUDE = 286,              /* PP_INCLUDE  */
+    NL = 287,                      /* NL  */
+    WS = 288,                      /* WS  */
+    PP_ARG = 289,                  /* PP_ARG  */
+    PP_UNKNOWN = 290,              /* PP_UNKNOWN  */
+    PP_IFDEF = 291,                /* PP_IFDEF  */
+    PP_IF = 292,                   /* PP_IF  */
+    PP_ELSE = 293,                 /* PP_ELSE  */
+    PP_ELIF = 294,                 /* PP_ELIF  */
+    PP_ENDIF = 295,                /* PP_ENDIF  */
+    PP_UNDEF = 296,                /* PP_UNDEF  */
+    PP_PRAGMA = 297,               /* PP_PRAGMA  */
+    PP_GLOM = 298,                 /* PP_GLOM  */
+    PP_ERROR = 299,                /* PP_ERROR  */
+    PP_WARNING = 300,              /* PP_WARNING  */
+    IF = 301,                      /* IF  */
+    WHILE = 302,                   /* WHILE  */
+    DO = 303,                      /* DO  */
+    FOR = 304,                     /* FOR  */
+    REPEAT = 305,                  /* REPEAT  */
+    SWITCH = 306,                  /* SWITCH  */
+    CASE = 307,                    /* CASE  */
+    DEFAULT = 308,                 /* DEFAULT  */
+    MONITOR = 309,                 /* MONITOR  */
+    CATCH = 310,                   /* CATCH  */
+    ACQUIRE = 311,                 /* ACQUIRE  */
+    GOTO = 312,                    /* GOTO  */
+    ASM = 313,                     /* ASM  */
+    INT = 314,                     /* INT  */
+    T_VOID = 315,                  /* T_VOID  */
+    T_CONST = 316,                 /* T_CONST  */
+    SENSOR = 317,                  /* SENSOR  */
+    TASKID = 318,                  /* TASKID  */
+    NOLIST = 319,                  /* NOLIST  */
+    RES = 320,                     /* RES  */
+    CTRUE = 321,                   /* CTRUE  */
+    CFALSE = 322                   /* CFALSE  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
 #define OR 258
 #define AND 259
-#define REL_NE 260
-#define REL_EQ 261
-#define REL_GE 262
-#define REL_LE 263
-#define RIGHT 264
-#define LEFT 265
-#define INDIRECT 266
-#define UMINUS 267
-#define INCDEC 268
-#define EVENT_SRC 269
-#define TYPE 270
-#define SIGN 271
-#define ABS 272
-#define LOWER_THAN_ELSE 273
-#define ELSE 274
-#define LOWER_THAN_EXPR_SHIFT 275
-#define ID 276
-#define NUMBER 277
-#define ASSIGN 278
-#define ASSIGN2 279
-#define TASKOP 280
-#define JUMP 281
-#define TASK 282
-#define SUB 283
-#define STRING 284
+#define LEFT 260
+#define RIGHT 261
+#define UMINUS 262
+#define INDIRECT 263
+#define ABS 264
+#define SIGN 265
+#define TYPE 266
+#define EVENT_SRC 267
+#define LOWER_THAN_ELSE 268
+#define ELSE 269
+#define LOWER_THAN_EXPR_SHIFT 270
+#define ID 271
+#define NUMBER 272
+#define ASSIGN 273
+#define ASSIGN2 274
+#define TASKOP 275
+#define JUMP 276
+#define TASK 277
+#define SUB 278
+#define INCDEC 279
+#define STRING 280
+#define REL_GE 281
+#define REL_LE 282
+#define REL_EQ 283
+#define REL_NE 284
 #define PP_DEFINE 285
 #define PP_INCLUDE 286
 #define NL 287
@@ -162,12 +193,12 @@
 #define CTRUE 321
 #define CFALSE 322
 
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 49 "parse.y"
 
-
-
-#if ! defined (YYSTYPE) && ! defined (YYSTYPE_IS_DECLARED)
-#line 41 "parse.y"
-typedef union YYSTYPE {
 	int			fInt;
 	bool		fBool;
 	Resource*	fResource;
@@ -175,7 +206,7 @@ typedef union YYSTYPE {
 	Stmt*		fStmt;
 	BlockStmt*	fBlock;
 	Symbol*		fSymbol;
-	char*		fString;
+	char*		fString;	// only from yylex(), see LexGetString()
 	Expr*		fExpr;
 	FunctionDef*	fFunction;
 	CallStmt*	fCall;
@@ -184,15 +215,20 @@ typedef union YYSTYPE {
 	CaseStmt*	fCaseStmt;
 	DeclareStmt*	fDeclareStmt;
 	LocationNode*	fLocation;
-} YYSTYPE;
-/* Line 1248 of yacc.c.  */
-#line 189 "y.tab.h"
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
-# define YYSTYPE_IS_DECLARED 1
+
+#line 220 "y.tab.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
 #endif
 
+
 extern YYSTYPE yylval;
 
 
+int yyparse (void);
+
 
+#endif /* !YY_YY_Y_TAB_H_INCLUDED  */
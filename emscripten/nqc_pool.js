@@ -0,0 +1,83 @@
+// A pool of compilers in Web Workers (see nqc_worker.js).
+//
+//   const pool = new NqcPool();
+//   const result = await pool.compile(source, 'RCX2', options);
+//
+// compile() resolves to { errors, image, listing, messages }, with the
+// image as a Uint8Array.  Compiles are spread over the workers, so
+// several can run at once (compileAll() compiles one source for a list
+// of targets); a worker that is busy queues what it is given.  A
+// compile for a target that a worker already has loaded goes to that
+// worker, since its API header is then already parsed.
+
+class NqcPool {
+  constructor(size, script) {
+    size = size || Math.min(navigator.hardwareConcurrency || 2, 4);
+    script = script || 'nqc_worker.js';
+
+    this.workers = [];
+    this.pending = new Map();   // id -> { resolve, reject }
+    this.nextId = 1;
+
+    for(let i = 0; i < size; i++) {
+      const worker = new Worker(script);
+      worker.busy = 0;          // compiles sent and not yet answered
+      worker.target = null;     // the target it compiled for last
+      worker.onmessage = (event) => this.finish(worker, event.data);
+      this.workers.push(worker);
+    }
+  }
+
+  compile(source, target, options) {
+    const worker = this.choose(target);
+    const id = this.nextId++;
+
+    worker.busy++;
+    worker.target = target;
+
+    return new Promise((resolve, reject) => {
+      this.pending.set(id, { resolve: resolve, reject: reject });
+      worker.postMessage({ id: id, source: source, target: target, options: options });
+    });
+  }
+
+  // one source for each of the targets, in the same order
+  compileAll(source, targets, options) {
+    return Promise.all(targets.map(target => this.compile(source, target, options)));
+  }
+
+  // an idle worker with the target loaded, else any idle worker,
+  // else the one with the shortest queue
+  choose(target) {
+    let best = null;
+    for(const worker of this.workers) {
+      if(worker.busy === 0 && worker.target === target) {
+        return worker;
+      }
+      if(best === null || worker.busy < best.busy) {
+        best = worker;
+      }
+    }
+    return best;
+  }
+
+  finish(worker, result) {
+    worker.busy--;
+
+    const job = this.pending.get(result.id);
+    if(!job) return;
+    this.pending.delete(result.id);
+
+    if(result.failure) {
+      job.reject(new Error(result.failure));
+    }
+    else {
+      job.resolve({
+        errors: result.errors,
+        image: new Uint8Array(result.image),
+        listing: result.listing,
+        messages: result.messages
+      });
+    }
+  }
+}
@@ -0,0 +1,70 @@
+// A compiler in a Web Worker, so a long compile doesn't freeze the page.
+//
+// Each message is a compile:
+//
+//   { id, source, target, options }
+//
+// and is answered with
+//
+//   { id, errors, image, listing, messages }
+//
+// where errors is nqc_compile()'s result, messages is the error and
+// warning text, and image is an ArrayBuffer with the .rcx image (empty
+// if the compile failed), transferred rather than copied.  The module
+// stays loaded between messages, so the API header is parsed once per
+// target, as on the page.  See nqc_pool.js for the page's side.
+
+importScripts('nqc.js');
+
+// options for nqc_compile(), as in nqc.cpp
+const kWebCompat = 1 << 2;
+
+const ready = createWebNqc({
+  'print': function(text) { console.log(text); },
+  'printErr': function(text) { console.warn(text); }
+});
+
+// the 1.x API header isn't built in, so fetch it the first time
+// compat mode is used
+let compatApiLoaded = false;
+async function loadCompatApi(nqc) {
+  if(!compatApiLoaded) {
+    const response = await fetch('rcx1.nqh');
+    nqc.FS.writeFile('rcx1.nqh', new Uint8Array(await response.arrayBuffer()));
+    compatApiLoaded = true;
+  }
+}
+
+// messages are handled one at a time, in the order they came
+let queue = Promise.resolve();
+
+self.onmessage = function(event) {
+  const job = event.data;
+  queue = queue.then(() => compile(job));
+};
+
+async function compile(job) {
+  const nqc = await ready;
+  try {
+    if(job.options & kWebCompat) {
+      await loadCompatApi(nqc);
+    }
+
+    const errors = nqc.ccall('nqc_compile', 'number', ['string', 'string', 'number'],
+      [job.source, job.target, job.options]);
+
+    const start = nqc._nqc_image();
+    const image = nqc.HEAPU8.slice(start, start + nqc._nqc_image_size()).buffer;
+
+    self.postMessage({
+      id: job.id,
+      errors: errors,
+      image: image,
+      listing: nqc.UTF8ToString(nqc._nqc_listing()),
+      messages: nqc.UTF8ToString(nqc._nqc_errors())
+    }, [image]);
+  }
+  catch(e) {
+    self.postMessage({ id: job.id, failure: String(e) });
+  }
+}
@@ -0,0 +1,125 @@
+// The serial port that PSerial_web.cpp talks to, over WebSerial.
+//
+// Browsers only hand out a port in answer to a click, so the page has
+// to call Module.nqcSerial.connect() from a click handler before the
+// first download.  Changing the speed or parity means reopening the
+// port, which WebSerial does quickly enough for the switch to and from
+// fast mode.
+
+Module['nqcSerial'] = (function() {
+  let port = null;
+  let settings = null;   // what the port was last opened with
+  let received = [];     // bytes that have arrived but not been read
+  let waiter = null;     // resolves a read() waiting for more bytes
+  let reader = null;
+  let pumping = null;    // the loop moving bytes from the port to received
+
+  function wake() {
+    if (waiter) {
+      const w = waiter;
+      waiter = null;
+      w();
+    }
+  }
+
+  async function pump() {
+    while (port && port.readable && reader === null) {
+      reader = port.readable.getReader();
+      try {
+        for (;;) {
+          const { value, done } = await reader.read();
+          if (done) break;
+          for (const b of value) received.push(b);
+          wake();
+        }
+      } catch (e) {
+        // a parity or framing error; the port is still usable
+      } finally {
+        reader.releaseLock();
+        reader = null;
+      }
+      if (!settings) break;
+    }
+  }
+
+  async function stop() {
+    const s = settings;
+    settings = null;
+    if (reader) await reader.cancel();
+    if (pumping) await pumping;
+    pumping = null;
+    if (s) await port.close();
+  }
+
+  return {
+    connect: async function() {
+      if (!navigator.serial) return false;
+      port = await navigator.serial.requestPort();
+      return true;
+    },
+
+    open: async function(name) {
+      if (!port && navigator.serial) {
+        const ports = await navigator.serial.getPorts();
+        if (ports.length) port = ports[0];
+      }
+      return port !== null;
+    },
+
+    setSpeed: async function(speed, parity) {
+      if (settings && settings.baudRate === speed && settings.parity === parity) return true;
+      await stop();
+      try {
+        const s = { baudRate: speed, parity: parity, dataBits: 8, stopBits: 1 };
+        await port.open(s);
+        settings = s;
+      } catch (e) {
+        return false;
+      }
+      received = [];
+      pumping = pump();
+      return true;
+    },
+
+    setSignals: async function(dtr, rts) {
+      try {
+        await port.setSignals({ dataTerminalReady: dtr, requestToSend: rts });
+      } catch (e) {
+        return false;
+      }
+      return true;
+    },
+
+    write: async function(bytes) {
+      const writer = port.writable.getWriter();
+      try {
+        await writer.write(bytes);
+      } finally {
+        writer.releaseLock();
+      }
+    },
+
+    read: async function(count, timeout) {
+      const expire = performance.now() + timeout;
+      for (;;) {
+        const remain = expire - performance.now();
+        if (received.length >= count || (timeout < 0 && received.length) ||
+            (timeout >= 0 && remain <= 0)) break;
+
+        await new Promise(resolve => {
+          waiter = resolve;
+          if (timeout >= 0) setTimeout(wake, remain);
+        });
+      }
+      return new Uint8Array(received.splice(0, count));
+    },
+
+    flush: function() {
+      received = [];
+    },
+
+    close: async function() {
+      await stop();
+    }
+  };
+})();
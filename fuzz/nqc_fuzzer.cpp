@@ -0,0 +1,60 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+
+/*
+ * libFuzzer harness for the compiler (see "make fuzz").  The first byte
+ * of each input picks the target and the API mode, and the rest is the
+ * program.  Every input is compiled in the same process, which relies
+ * on Compiler::CompileText() leaving nothing behind.
+ */
+#include <cstddef>
+#include <cstdint>
+
+#include "Compiler.h"
+#include "Error.h"
+#include "RCX_Image.h"
+#include "RCX_Target.h"
+
+// RCX_Link's, which the compiler never uses
+bool gQuiet = true;
+
+class FuzzCompiler : public Compiler, public ErrorHandler
+{
+public:
+    // there are no files to #include
+    Buffer *CreateBuffer(const char * /* name */) { return 0; }
+    void AddError(const Error & /* e */, const LexLocation * /* loc */) {}
+};
+
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    static FuzzCompiler *compiler = 0;
+
+    if (!compiler) {
+        compiler = new FuzzCompiler();
+        // parse the API header once for each target and mode
+        compiler->SetSnapshotsEnabled(true);
+    }
+
+    if (size == 0) return 0;
+
+    RCX_TargetType target = (RCX_TargetType)((data[0] & 0x7f) % (kRCX_SwanTarget + 1));
+    int flags = (data[0] & 0x80) ? Compiler::kCompat_Flag : 0;
+
+    delete compiler->CompileText((const char *)data + 1, (int)size - 1,
+        getTarget(target), flags);
+
+    return 0;
+}
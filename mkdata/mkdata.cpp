@@ -1,13 +1,27 @@
 #include <cstdio>
 #include <cstring>
+#include <cctype>
+#include <set>
+#include <string>
+#include <vector>
 #include "SRecord.h"
+#include "PHashTable.h"
 
 using std::fopen;
 using std::strcmp;
+using std::set;
+using std::string;
+using std::vector;
 
 //static char *sTestArgs[]={"mkdata", "rcx.nqh", "rcx_data.h", "rcxData" };
 static const char *sTestArgs[] = {"mkdata", "-s", "fastdl.srec", "RCX_nub.h", "rcxNub" };
 
+static int WriteSymbols(const char *destFile, const char *name, int count, char **sources);
+static bool ReadIdentifiers(const char *sourceFile, set<string> &ids);
+static bool FindDisplacements(const vector<ULong> &hashes, int bucketCount,
+	int slotCount, vector<int> &displacements, vector<int> &slots);
+static int Slot(ULong hash, int displacement, int slotCount);
+
 
 int main(int argc, char **argv)
 {
@@ -24,6 +38,9 @@ int main(int argc, char **argv)
 		argc = sizeof(sTestArgs) / sizeof(char *);
 	}
 
+	if (argc > 4 && (strcmp(argv[1],"-k")==0))
+		return WriteSymbols(argv[2], argv[3], argc-4, argv+4);
+
 	if (argc == 5 && (strcmp(argv[1],"-s")==0))
 	{
 		for(int i=1; i<4; i++)
@@ -35,6 +52,7 @@ int main(int argc, char **argv)
 	if (argc != 4)
 	{
 		fprintf(stderr, "Usage: mkdata [-s] sourceFile destFile arrayName\n");
+		fprintf(stderr, "       mkdata -k destFile arrayName sourceFile...\n");
 		return -1;
 	}
 
@@ -102,3 +120,229 @@ int main(int argc, char **argv)
 
 	return 0;
 }
+
+
+/*
+ * Write a perfect hash of the identifiers in the source files.  The
+ * output has the identifiers with their hashes (from P_HashTable::Hash),
+ * a displacement for each bucket of hashes, and a slot table mapping
+ * each slot to an identifier (or -1).  An identifier's slot is found
+ * with <name>_slot(), which the output also defines, so a lookup takes
+ * one probe.
+ */
+int WriteSymbols(const char *destFile, const char *name, int count, char **sources)
+{
+	set<string> ids;
+
+	for(int i=0; i<count; i++)
+	{
+		if (!ReadIdentifiers(sources[i], ids))
+		{
+			fprintf(stderr, "Error: could not open %s\n", sources[i]);
+			return -1;
+		}
+	}
+
+	vector<string> names(ids.begin(), ids.end());
+	vector<ULong> hashes;
+	for(size_t i=0; i<names.size(); i++)
+		hashes.push_back(P_HashTable::Hash(names[i].c_str()));
+
+	// about four keys per bucket and a slot table at most 80% full
+	int bucketCount = (int)(names.size() + 3) / 4;
+	if (bucketCount == 0) bucketCount = 1;
+
+	int slotCount = 1;
+	while(slotCount * 4 < (int)names.size() * 5)
+		slotCount *= 2;
+
+	vector<int> displacements;
+	vector<int> slots;
+	if (!FindDisplacements(hashes, bucketCount, slotCount, displacements, slots))
+	{
+		fprintf(stderr, "Error: could not build a perfect hash\n");
+		return -1;
+	}
+
+	FILE *dst = fopen(destFile, "w");
+	if (!dst)
+	{
+		fprintf(stderr, "Error: could not create %s\n", destFile);
+		return -1;
+	}
+
+	fprintf(dst, "#define %s_count %d\n", name, (int)names.size());
+	fprintf(dst, "#define %s_buckets %d\n", name, bucketCount);
+	fprintf(dst, "#define %s_slots %d\n\n", name, slotCount);
+
+	fprintf(dst, "static const char *const %s_names[]={\n", name);
+	for(size_t i=0; i<names.size(); i++)
+		fprintf(dst, "\"%s\",\n", names[i].c_str());
+	fprintf(dst, "0};\n\n");
+
+	fprintf(dst, "static const unsigned long %s_hashes[]={\n", name);
+	for(size_t i=0; i<hashes.size(); i++)
+		fprintf(dst, "0x%08lxUL,%s", hashes[i], (i % 8 == 7) ? "\n" : "");
+	fprintf(dst, "0};\n\n");
+
+	fprintf(dst, "static const unsigned short %s_displacements[]={\n", name);
+	for(size_t i=0; i<displacements.size(); i++)
+		fprintf(dst, "%d,%s", displacements[i], (i % 16 == 15) ? "\n" : "");
+	fprintf(dst, "0};\n\n");
+
+	fprintf(dst, "static const short %s_table[]={\n", name);
+	for(size_t i=0; i<slots.size(); i++)
+		fprintf(dst, "%d,%s", slots[i], (i % 16 == 15) ? "\n" : "");
+	fprintf(dst, "0};\n\n");
+
+	// must match Slot() below
+	fprintf(dst, "static inline int %s_slot(unsigned long hash)\n{\n", name);
+	fprintf(dst, "\tunsigned long h = (hash ^ (%s_displacements[hash %% %s_buckets] * 0x9e3779b1UL)) & 0xffffffffUL;\n", name, name);
+	fprintf(dst, "\th = ((h ^ (h >> 16)) * 0x85ebca6bUL) & 0xffffffffUL;\n");
+	fprintf(dst, "\th = ((h ^ (h >> 13)) * 0xc2b2ae35UL) & 0xffffffffUL;\n");
+	fprintf(dst, "\treturn (int)((h ^ (h >> 16)) & (%s_slots - 1));\n}\n", name);
+
+	fclose(dst);
+	return 0;
+}
+
+
+int Slot(ULong hash, int displacement, int slotCount)
+{
+	ULong h = (hash ^ (displacement * 0x9e3779b1UL)) & 0xffffffffUL;
+
+	h = ((h ^ (h >> 16)) * 0x85ebca6bUL) & 0xffffffffUL;
+	h = ((h ^ (h >> 13)) * 0xc2b2ae35UL) & 0xffffffffUL;
+	return (int)((h ^ (h >> 16)) & (slotCount - 1));
+}
+
+
+bool FindDisplacements(const vector<ULong> &hashes, int bucketCount,
+	int slotCount, vector<int> &displacements, vector<int> &slots)
+{
+	vector< vector<int> > buckets(bucketCount);
+	for(size_t i=0; i<hashes.size(); i++)
+		buckets[hashes[i] % bucketCount].push_back((int)i);
+
+	// place the largest buckets first while there is the most room
+	vector<int> order;
+	for(int size=(int)hashes.size(); size > 0; size--)
+		for(int b=0; b<bucketCount; b++)
+			if ((int)buckets[b].size() == size) order.push_back(b);
+
+	displacements.assign(bucketCount, 0);
+	slots.assign(slotCount, -1);
+
+	for(size_t i=0; i<order.size(); i++)
+	{
+		const vector<int> &keys = buckets[order[i]];
+		int d;
+
+		for(d=0; d<65536; d++)
+		{
+			vector<int> used;
+			size_t k;
+
+			for(k=0; k<keys.size(); k++)
+			{
+				int slot = Slot(hashes[keys[k]], d, slotCount);
+				if (slots[slot] != -1) break;
+
+				size_t j;
+				for(j=0; j<used.size() && used[j] != slot; j++)
+					;
+				if (j < used.size()) break;
+
+				used.push_back(slot);
+			}
+
+			if (k == keys.size())
+			{
+				for(k=0; k<keys.size(); k++)
+					slots[used[k]] = keys[k];
+				break;
+			}
+		}
+
+		if (d == 65536) return false;
+		displacements[order[i]] = d;
+	}
+
+	return true;
+}
+
+
+bool ReadIdentifiers(const char *sourceFile, set<string> &ids)
+{
+	FILE *src = fopen(sourceFile, "r");
+	if (!src) return false;
+
+	int c = fgetc(src);
+	bool directive = false;
+
+	while(c != EOF)
+	{
+		if (isalpha(c) || c=='_')
+		{
+			string id;
+			while(c != EOF && (isalnum(c) || c=='_'))
+			{
+				id += (char)c;
+				c = fgetc(src);
+			}
+
+			// the word after '#' is a directive, not an identifier
+			if (!directive) ids.insert(id);
+			directive = false;
+			continue;
+		}
+
+		if (directive && (c==' ' || c=='\t'))
+		{
+			c = fgetc(src);
+			continue;
+		}
+
+		directive = false;
+
+		if (isdigit(c))
+		{
+			// skip numbers such as 0x1f
+			while(c != EOF && (isalnum(c) || c=='_'))
+				c = fgetc(src);
+			continue;
+		}
+
+		if (c=='"' || c=='\'')
+		{
+			int quote = c;
+			while((c = fgetc(src)) != EOF && c != quote && c != '\n')
+				if (c=='\\') c = fgetc(src);
+		}
+		else if (c=='/')
+		{
+			c = fgetc(src);
+			if (c=='/')
+			{
+				while(c != EOF && c != '\n')
+					c = fgetc(src);
+				continue;
+			}
+			else if (c=='*')
+			{
+				int prev = 0;
+				while((c = fgetc(src)) != EOF && !(prev=='*' && c=='/'))
+					prev = c;
+			}
+			else
+				continue;
+		}
+		else if (c=='#')
+			directive = true;
+
+		if (c != EOF) c = fgetc(src);
+	}
+
+	fclose(src);
+	return true;
+}
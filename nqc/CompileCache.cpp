@@ -0,0 +1,239 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include <cstdio>
+#include <cstring>
+
+#include "CompileCache.h"
+#include "Buffer.h"
+#include "Compiler.h"
+#include "DirList.h"
+#include "RCX_Image.h"
+#include "RCX_Firmware.h"
+
+using std::fopen;
+using std::sprintf;
+using std::strlen;
+
+#define kManifestExtension  ".nqm"
+#define kImageExtension     ".rcx"
+#define kFirmwareExtension  ".nqf"
+#define kFirmwareKeyPrefix  "firmware\n"
+#define kManifestHeader     "nqc-cache 1\n"
+#define kMaxManifestLine    (DirList::kMaxPathname + CompileCache::kKeyLength + 2)
+
+// two 32 bit FNV-1a style hashes with different multipliers, which is
+// plenty to tell sources apart and doesn't need a 64 bit type
+struct Hash {
+    Hash() : fLow(2166136261UL), fHigh(2166136261UL) {}
+
+    void Add(const char *data, size_t length);
+    void Print(char *text) const { sprintf(text, "%08lx%08lx", fHigh, fLow); }
+
+    ULong fLow;
+    ULong fHigh;
+};
+
+
+CompileCache::CompileCache(const char *dir)
+{
+    fDir = new char[strlen(dir) + 1];
+    strcpy(fDir, dir);
+}
+
+
+CompileCache::~CompileCache()
+{
+    delete [] fDir;
+}
+
+
+void CompileCache::MakeKey(const Buffer *source, const char *options,
+    char key[kKeyLength+1])
+{
+    Hash h;
+
+    // include the nul so options can't run into the source
+    h.Add(options, strlen(options) + 1);
+    h.Add(source->GetData(), source->GetLength());
+    h.Print(key);
+}
+
+
+RCX_Image *CompileCache::Find(const char *key, Compiler *compiler) const
+{
+    char *path = MakePath(key, kManifestExtension);
+    FILE *fp = fopen(path, "r");
+    delete [] path;
+
+    if (!fp) return 0;
+
+    char line[kMaxManifestLine];
+    bool ok = fgets(line, sizeof(line), fp) && strcmp(line, kManifestHeader)==0;
+
+    // every included file must still have the same contents
+    while(ok && fgets(line, sizeof(line), fp)) {
+        size_t n = strlen(line);
+        if (n && line[n-1]=='\n') line[--n] = 0;
+
+        if (n < kKeyLength + 2 || line[kKeyLength] != ' ') {
+            ok = false;
+            break;
+        }
+
+        Buffer *b = compiler->CreateBuffer(line + kKeyLength + 1);
+        if (!b) {
+            ok = false;
+            break;
+        }
+
+        char hash[kKeyLength+1];
+        HashBuffer(b, hash);
+        delete b;
+
+        if (strncmp(hash, line, kKeyLength) != 0)
+            ok = false;
+    }
+
+    fclose(fp);
+    if (!ok) return 0;
+
+    RCX_Image *image = new RCX_Image();
+    path = MakePath(key, kImageExtension);
+    RCX_Result result = image->Read(path);
+    delete [] path;
+
+    if (RCX_ERROR(result)) {
+        delete image;
+        return 0;
+    }
+
+    return image;
+}
+
+
+bool CompileCache::Store(const char *key, RCX_Image *image,
+    const vector<const Buffer *> &includes) const
+{
+    // write under temporary names and then rename so that a reader
+    // never sees a partial entry
+    char *imagePath = MakePath(key, kImageExtension);
+    char *manifestPath = MakePath(key, kManifestExtension);
+    char *tempPath = new char[strlen(manifestPath) + 32];
+    bool ok = false;
+
+    sprintf(tempPath, "%s.%p.tmp", imagePath, (void *)image);
+    if (image->Write(tempPath) && rename(tempPath, imagePath)==0) {
+        sprintf(tempPath, "%s.%p.tmp", manifestPath, (void *)image);
+
+        FILE *fp = fopen(tempPath, "w");
+        if (fp) {
+            fputs(kManifestHeader, fp);
+            for(size_t i=0; i<includes.size(); ++i) {
+                char hash[kKeyLength+1];
+                HashBuffer(includes[i], hash);
+                fprintf(fp, "%s %s\n", hash, includes[i]->GetName());
+            }
+
+            ok = (ferror(fp) == 0);
+            if (fclose(fp) != 0) ok = false;
+            if (ok) ok = (rename(tempPath, manifestPath) == 0);
+        }
+    }
+
+    if (!ok) remove(tempPath);
+
+    delete [] tempPath;
+    delete [] manifestPath;
+    delete [] imagePath;
+    return ok;
+}
+
+
+void CompileCache::MakeFirmwareKey(const Buffer *file, char key[kKeyLength+1])
+{
+    Hash h;
+
+    // keep firmware keys apart from compile keys
+    h.Add(kFirmwareKeyPrefix, strlen(kFirmwareKeyPrefix));
+    h.Add(file->GetData(), file->GetLength());
+    h.Print(key);
+}
+
+
+RCX_Firmware *CompileCache::FindFirmware(const char *key) const
+{
+    RCX_Firmware *firmware = new RCX_Firmware();
+    char *path = MakePath(key, kFirmwareExtension);
+    RCX_Result result = firmware->Read(path);
+    delete [] path;
+
+    if (RCX_ERROR(result)) {
+        delete firmware;
+        return 0;
+    }
+
+    return firmware;
+}
+
+
+bool CompileCache::StoreFirmware(const char *key, const RCX_Firmware &firmware) const
+{
+    char *path = MakePath(key, kFirmwareExtension);
+    char *tempPath = new char[strlen(path) + 32];
+
+    sprintf(tempPath, "%s.%p.tmp", path, (const void *)&firmware);
+    bool ok = firmware.Write(tempPath) && rename(tempPath, path)==0;
+    if (!ok) remove(tempPath);
+
+    delete [] tempPath;
+    delete [] path;
+    return ok;
+}
+
+
+char *CompileCache::MakePath(const char *key, const char *ext) const
+{
+    size_t dirLength = strlen(fDir);
+    char *path = new char[dirLength + strlen(key) + strlen(ext) + 2];
+
+    strcpy(path, fDir);
+    if (dirLength && fDir[dirLength-1] != DIR_DELIMITER)
+        path[dirLength++] = DIR_DELIMITER;
+    strcpy(path + dirLength, key);
+    strcat(path, ext);
+
+    return path;
+}
+
+
+void CompileCache::HashBuffer(const Buffer *b, char hash[kKeyLength+1])
+{
+    Hash h;
+
+    h.Add(b->GetData(), b->GetLength());
+    h.Print(hash);
+}
+
+
+void Hash::Add(const char *data, size_t length)
+{
+    const UByte *ptr = (const UByte *)data;
+    const UByte *end = ptr + length;
+
+    while(ptr < end) {
+        fLow = ((fLow ^ *ptr) * 16777619UL) & 0xffffffffUL;
+        fHigh = ((fHigh ^ *ptr) * 0x5bd1e995UL) & 0xffffffffUL;
+        ++ptr;
+    }
+}
@@ -0,0 +1,79 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __CompileCache_h
+#define __CompileCache_h
+
+#ifndef __PTypes_h
+#include "PTypes.h"
+#endif
+
+#include <vector>
+
+using std::vector;
+
+class Buffer;
+class Compiler;
+class RCX_Image;
+class RCX_Firmware;
+
+/**
+ * An on-disk cache of compiled images.  Each entry is keyed by a hash
+ * of the main source and the compile options (target, flags, -D and
+ * -U options, compiler version).  Next to the image, a manifest lists
+ * every file the source included along with a hash of its contents,
+ * so an entry is only used if none of those files have changed.
+ *
+ * For key "k" the cache directory holds k.rcx and k.nqm.
+ *
+ * Firmware files are kept too, keyed by a hash of the S-record file,
+ * as k.nqf holding the parsed image and its download plans.
+ */
+class CompileCache
+{
+public:
+    enum {
+        kKeyLength = 16     // hex digits, not counting the nul
+    };
+
+    CompileCache(const char *dir);
+    ~CompileCache();
+
+    /// Compute the key for compiling source with the given options
+    static void MakeKey(const Buffer *source, const char *options,
+        char key[kKeyLength+1]);
+
+    /// Return the cached image for key (or 0), checking the included
+    /// files by creating them again through the compiler
+    RCX_Image *Find(const char *key, Compiler *compiler) const;
+
+    /// Save an image along with the files it included
+    bool Store(const char *key, RCX_Image *image,
+        const vector<const Buffer *> &includes) const;
+
+    /// Compute the key for a firmware file
+    static void MakeFirmwareKey(const Buffer *file, char key[kKeyLength+1]);
+
+    /// Return the prepared firmware for key (or 0)
+    RCX_Firmware *FindFirmware(const char *key) const;
+
+    bool StoreFirmware(const char *key, const RCX_Firmware &firmware) const;
+
+private:
+    char *MakePath(const char *key, const char *ext) const;
+    static void HashBuffer(const Buffer *b, char hash[kKeyLength+1]);
+
+    char *fDir;
+};
+
+#endif
@@ -12,7 +12,6 @@
  *
  */
 #include <cstring>
-#include "StrlUtil.h"
 
 #if defined(__MWERKS__) && (!__MACH__)
 #include <stat.h>
@@ -21,7 +20,15 @@
 #endif
 #include "DirList.h"
 
+// directories can be kept open and searched with fstatat()
+#if !defined(WIN32) && !(defined(__MWERKS__) && (!__MACH__))
+#define DIR_FDS
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 using std::strcat;
+using std::strchr;
 using std::strlen;
 using std::size_t;
 
@@ -30,11 +37,19 @@ using std::strcpy;
 #endif
 
 DirList::~DirList()
+{
+    Clear();
+}
+
+
+void DirList::Clear()
 {
     Entry *e;
 
     while((e=fEntries.RemoveHead()) != 0)
         delete e;
+
+    fSignature.clear();
 }
 
 
@@ -45,29 +60,72 @@ void DirList::Add(const char *path)
 
     Entry *e = new Entry(path);
     fEntries.InsertTail(e);
+
+    fSignature += e->GetPath();
+    fSignature += '\n';
+}
+
+
+void DirList::Add(const DirList &dirs)
+{
+    for(Entry *e=dirs.fEntries.GetHead(); e; e=e->GetNext())
+        Add(e->GetPath());
 }
 
 
-bool DirList::Find(const char *filename, char *pathname)
+bool DirList::Find(const char *filename, string &pathname)
+{
+    // results found for other directories don't apply
+    if (fSignature != fCacheSignature) {
+        fLookups.clear();
+        fDirTimes.clear();
+        fCacheSignature = fSignature;
+    }
+
+    map<string, Lookup>::const_iterator i = fLookups.find(filename);
+    if (i != fLookups.end()) {
+        if (i->second.fFound)
+            pathname = i->second.fPath;
+        return i->second.fFound;
+    }
+
+    Lookup &lookup = fLookups[filename];
+    lookup.fFound = Search(filename, pathname);
+    if (lookup.fFound)
+        lookup.fPath = pathname;
+
+    return lookup.fFound;
+}
+
+
+void DirList::Revalidate()
 {
     struct stat stat_buf;
 
-    size_t len = sizeof(pathname);
-    if (StrlUtil::strlcpy(pathname, filename, len) >= len) {
-        return false;
+    for(map<string, time_t>::const_iterator i = fDirTimes.begin(); i != fDirTimes.end(); ++i) {
+        time_t t = (stat(i->first.c_str(), &stat_buf) == 0) ? stat_buf.st_mtime : (time_t)-1;
+
+        if (t != i->second) {
+            fLookups.clear();
+            fDirTimes.clear();
+            return;
+        }
     }
+}
+
 
-    if (stat(pathname, &stat_buf) == 0) {
+bool DirList::Search(const char *filename, string &pathname)
+{
+    pathname = filename;
+    if (Probe(0, filename, pathname)) {
         return true;
     }
 
     for(Entry *e = fEntries.GetHead(); e; e=e->GetNext()) {
-        if (StrlUtil::strlcpy(pathname, e->GetPath(), len) < len) {
-            if (StrlUtil::strlcat(pathname, filename, len) < len) {
-                if (stat(pathname, &stat_buf) == 0) {
-                    return true;
-                }
-            }
+        pathname = e->GetPath();
+        pathname += filename;
+        if (Probe(e, filename, pathname)) {
+            return true;
         }
     }
 
@@ -75,6 +133,43 @@ bool DirList::Find(const char *filename, char *pathname)
 }
 
 
+/*
+ * Check for pathname, which is filename in e's directory (or just
+ * filename if there's no e).
+ */
+bool DirList::Probe(const Entry *e, const char *filename, const string &pathname)
+{
+    struct stat stat_buf;
+
+    // remember the directory so that Revalidate() can tell when
+    // files have been added to it or removed from it
+    size_t n = pathname.rfind(DIR_DELIMITER);
+    string dir = (n == string::npos) ? string(".") : pathname.substr(0, n+1);
+
+#ifdef DIR_FDS
+    bool open = e && e->GetFd() >= 0;
+
+    if (fDirTimes.find(dir) == fDirTimes.end()) {
+        // the entry's own directory is already open
+        int result = (open && !strchr(filename, DIR_DELIMITER)) ?
+            fstat(e->GetFd(), &stat_buf) : stat(dir.c_str(), &stat_buf);
+        fDirTimes[dir] = (result == 0) ? stat_buf.st_mtime : (time_t)-1;
+    }
+
+    if (open)
+        return fstatat(e->GetFd(), filename, &stat_buf, 0) == 0;
+#else
+    if (fDirTimes.find(dir) == fDirTimes.end())
+        fDirTimes[dir] = (stat(dir.c_str(), &stat_buf) == 0) ? stat_buf.st_mtime : (time_t)-1;
+
+    (void)e;
+    (void)filename;
+#endif
+
+    return stat(pathname.c_str(), &stat_buf) == 0;
+}
+
+
 DirList::Entry::Entry(const char *path)
 {
     size_t length = strlen(path);
@@ -87,10 +182,20 @@ DirList::Entry::Entry(const char *path)
         fPath[length] = DIR_DELIMITER;
         fPath[length+1] = 0;
     }
+
+#ifdef DIR_FDS
+    fFd = open(fPath, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+#else
+    fFd = -1;
+#endif
 }
 
 
 DirList::Entry::~Entry()
 {
+#ifdef DIR_FDS
+    if (fFd >= 0)
+        close(fFd);
+#endif
     delete [] fPath;
 }
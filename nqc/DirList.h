@@ -18,6 +18,26 @@
 #include "PListS.h"
 #endif
 
+#include <ctime>
+#include <map>
+#include <string>
+
+using std::map;
+using std::string;
+using std::time_t;
+
+/**
+ * A list of directories to search for files.  The results of Find()
+ * are cached, including names that weren't found.  The cache is kept
+ * when the list is cleared and the same directories are added again
+ * (as server mode does for each request), and Revalidate() drops it
+ * if any directory that was searched has been modified since.
+ *
+ * Where the platform allows, each directory is opened when it is added
+ * and files are looked for relative to it, so a probe doesn't walk the
+ * directory's path again.  Each compiler has its own list, so lists
+ * don't need to be shared between threads.
+ */
 class DirList
 {
 public:
@@ -29,9 +49,21 @@ public:
     ~DirList();
 
     void Add(const char *dirspec);
-    bool Find(const char *filename, char *pathname);
+    void Add(const DirList &dirs);
+    void Clear();
+    /// the path of filename, as is or in one of the directories
+    bool Find(const char *filename, string &pathname);
+
+    /// Forget the cached results if a directory they depend on has
+    /// changed; call this before each compile
+    void Revalidate();
 
 private:
+    class Entry;
+
+    bool Probe(const Entry *e, const char *filename, const string &pathname);
+    bool Search(const char *filename, string &pathname);
+
     class Entry : public PLinkS<Entry>
     {
     public:
@@ -39,12 +71,25 @@ private:
         ~Entry();
 
         const char* GetPath() const { return fPath; }
+        int GetFd() const { return fFd; }
 
     private:
         char* fPath;
+        int fFd;    // the open directory, or -1
     };
 
     PListS<Entry> fEntries;
+
+    struct Lookup
+    {
+        bool fFound;
+        string fPath;
+    };
+
+    string fSignature;                  // the directories, in order
+    string fCacheSignature;             // the directories for fLookups
+    map<string, Lookup> fLookups;
+    map<string, time_t> fDirTimes;      // searched directories (-1 if missing)
 };
 
 
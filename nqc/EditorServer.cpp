@@ -0,0 +1,620 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sys/stat.h>
+
+#include "EditorServer.h"
+#include "Buffer.h"
+#include "Compiler.h"
+#include "CompileContext.h"
+#include "CompileStats.h"
+#include "Error.h"
+#include "Fragment.h"
+#include "FunctionDef.h"
+#include "LexLocation.h"
+#include "Symbol.h"
+#include "RCX_Image.h"
+
+using std::fprintf;
+using std::strcmp;
+using std::strlen;
+using std::strncmp;
+
+#define kMaxCommandLine 4096
+#define kDone "#done"
+
+// the most diagnostics kept for a document
+#define kMaxDiagnostics 100
+
+
+/*
+ * The compiler for the server's compile context.  Open documents are
+ * read from the server rather than the disk, and diagnostics go to the
+ * document being compiled.
+ */
+class EditorCompiler : public Compiler, public ErrorHandler
+{
+public:
+    EditorCompiler(EditorServer *server) : fServer(server), fDocument(0) {}
+
+    void SetDocument(EditorServer::Document *d) { fDocument = d; }
+
+    Buffer *CreateBuffer(const char *name);
+    bool GetIncludePath(const char *name, string &path);
+
+    void AddError(const Error &e, const LexLocation *loc);
+    void Flush();
+
+private:
+    // a diagnostic waiting for Flush() to find its line
+    struct Pending
+    {
+        bool fWarning;
+        int fCode;
+        string fMessage;
+        LexLocation fLoc;
+    };
+
+    EditorServer *fServer;
+    EditorServer::Document *fDocument;
+    vector<Pending> fPending;
+};
+
+
+static void PrintJSONString(FILE *fp, const char *s);
+
+
+EditorServer::EditorServer(const DirList &dirs, const RCX_Target *target, int flags) :
+    fTarget(target),
+    fFlags(flags)
+{
+    fDirs.Add(dirs);
+}
+
+
+void EditorServer::Serve(FILE *in, FILE *out)
+{
+    CompileContext context;
+    CompileContext::Scope scope(&context);
+    EditorCompiler compiler(this);
+    char line[kMaxCommandLine];
+
+    // the API header only needs to be parsed once, and unchanged
+    // tasks and subs encoded once
+    compiler.SetSnapshotsEnabled(true);
+    compiler.SetFragmentCacheEnabled(true);
+
+    while(fgets(line, sizeof(line), in)) {
+        // strip the line terminator
+        size_t n = strlen(line);
+        while(n && (line[n-1]=='\n' || line[n-1]=='\r'))
+            line[--n] = 0;
+
+        if (n == 0) continue;
+        if (strcmp(line, "quit")==0) break;
+
+        bool ok = Execute(line, in, out, compiler);
+        fprintf(out, "%s %d\n", kDone, ok ? 0 : 1);
+        fflush(out);
+    }
+
+    compiler.SetFragmentCacheEnabled(false);
+    compiler.SetSnapshotsEnabled(false);
+}
+
+
+bool EditorServer::Execute(const char *line, FILE *in, FILE *out, EditorCompiler &compiler)
+{
+    const char *arg = strchr(line, ' ');
+    size_t length = arg ? (size_t)(arg - line) : strlen(line);
+    string name;
+
+    if (arg) ++arg;
+
+    if (length==4 && strncmp(line, "open", 4)==0 && arg) {
+        char *end;
+        long size = strtol(arg, &end, 10);
+        if (end == arg || *end != ' ' || size < 0) return false;
+        name = end + 1;
+
+        Document &d = fDocuments[name];
+        d.fText.resize(size);
+        if (size && fread(&d.fText[0], 1, size, in) != (size_t)size) {
+            fDocuments.erase(name);
+            return false;
+        }
+
+        Invalidate(name);
+        return true;
+    }
+
+    if (length==5 && strncmp(line, "close", 5)==0 && arg) {
+        name = arg;
+        if (!Find(name)) return false;
+
+        // anything that included it reads it from the disk again
+        Invalidate(name);
+        fDocuments.erase(name);
+        return true;
+    }
+
+    if (length==5 && strncmp(line, "check", 5)==0 && arg) {
+        name = arg;
+        Document *d = Find(name);
+        if (!d) return false;
+
+        bool reused = IsCurrent(*d);
+        if (!reused)
+            Check(name, *d, compiler);
+
+        int errors = 0;
+        int warnings = 0;
+        for(size_t i=0; i<d->fDiagnostics.size(); ++i) {
+            const Diagnostic &diag = d->fDiagnostics[i];
+
+            if (diag.fWarning)
+                ++warnings;
+            else
+                ++errors;
+
+            fprintf(out, "{\"severity\":\"%s\",\"code\":%d,\"message\":",
+                diag.fWarning ? "warning" : "error", diag.fCode);
+            PrintJSONString(out, diag.fMessage.c_str());
+            if (!diag.fFile.empty()) {
+                fprintf(out, ",\"file\":");
+                PrintJSONString(out, diag.fFile.c_str());
+                fprintf(out, ",\"line\":%d,\"column\":%d,\"length\":%d",
+                    diag.fLine, diag.fColumn, diag.fLength);
+            }
+            fprintf(out, "}\n");
+        }
+
+        fprintf(out, "{\"file\":");
+        PrintJSONString(out, name.c_str());
+        fprintf(out, ",\"errors\":%d,\"warnings\":%d,\"reused\":%s,\"compile_ms\":%.3f,"
+            "\"reparsed\":%d,\"declarations\":%d}\n",
+            errors, warnings, reused ? "true" : "false", d->fCompileMs,
+            d->fReparsed, (int)d->fDeclarations.size());
+        return true;
+    }
+
+    if (length==6 && strncmp(line, "symbol", 6)==0 && arg) {
+        const char *space = strchr(arg, ' ');
+        if (!space) return false;
+
+        string id(arg, space - arg);
+        name = space + 1;
+        Document *d = Find(name);
+        if (!d) return false;
+
+        if (!IsCurrent(*d))
+            Check(name, *d, compiler);
+
+        for(size_t i=0; i<d->fDefinitions.size(); ++i) {
+            const Definition &def = d->fDefinitions[i];
+            if (def.fName != id) continue;
+
+            fprintf(out, "{\"name\":");
+            PrintJSONString(out, def.fName.c_str());
+            fprintf(out, ",\"kind\":\"%s\"", def.fKind);
+            if (!def.fFile.empty()) {
+                fprintf(out, ",\"file\":");
+                PrintJSONString(out, def.fFile.c_str());
+                fprintf(out, ",\"line\":%d", def.fLine);
+            }
+            fprintf(out, "}\n");
+        }
+        return true;
+    }
+
+    if (length==5 && strncmp(line, "sizes", 5)==0 && arg) {
+        name = arg;
+        Document *d = Find(name);
+        if (!d) return false;
+
+        if (!IsCurrent(*d))
+            Check(name, *d, compiler);
+
+        for(size_t i=0; i<d->fSizes.size(); ++i) {
+            const Size &s = d->fSizes[i];
+
+            fprintf(out, "{\"name\":");
+            PrintJSONString(out, s.fName.c_str());
+            fprintf(out, ",\"type\":\"%s\",\"bytes\":%d}\n", s.fType, s.fBytes);
+        }
+        return true;
+    }
+
+    fprintf(out, "{\"error\":");
+    PrintJSONString(out, line);
+    fprintf(out, "}\n");
+    return false;
+}
+
+
+EditorServer::Document* EditorServer::Find(const string &name)
+{
+    map<string, Document>::iterator i = fDocuments.find(name);
+    return (i == fDocuments.end()) ? 0 : &i->second;
+}
+
+
+/*
+ * A document has changed (or been opened or closed), so it and every
+ * document that included it need compiling again.  The includes of a
+ * compile are all recorded, so those of included files are too.
+ */
+void EditorServer::Invalidate(const string &name)
+{
+    map<string, Document>::iterator i;
+
+    for(i = fDocuments.begin(); i != fDocuments.end(); ++i) {
+        Document &d = i->second;
+        size_t j;
+
+        if (i->first == name) {
+            d.fCurrent = false;
+            continue;
+        }
+
+        for(j=0; j<d.fOpenIncludes.size(); ++j)
+            if (d.fOpenIncludes[j] == name) d.fCurrent = d.fOnlyTextChanged = false;
+
+        // a file that was read from the disk may now be open
+        for(j=0; j<d.fFiles.size(); ++j)
+            if (d.fFiles[j].fPath == name) d.fCurrent = d.fOnlyTextChanged = false;
+    }
+}
+
+
+bool EditorServer::IsCurrent(const Document &d) const
+{
+    return d.fCurrent && FilesUnchanged(d);
+}
+
+
+bool EditorServer::FilesUnchanged(const Document &d) const
+{
+    for(size_t i=0; i<d.fFiles.size(); ++i)
+        if (GetModified(d.fFiles[i].fPath) != d.fFiles[i].fModified)
+            return false;
+
+    return true;
+}
+
+
+// the text of a document without the bodies of its declarations
+static string GetOutline(const string &text, const vector<Buffer::Declaration> &decls)
+{
+    string outline;
+    int offset = 0;
+
+    for(size_t i=0; i<decls.size(); ++i) {
+        outline.append(text, offset, decls[i].fBodyStart + 1 - offset);
+        offset = decls[i].fEnd - 1;
+    }
+    outline.append(text, offset, string::npos);
+
+    return outline;
+}
+
+
+static bool SameBody(const string &text1, const Buffer::Declaration &d1,
+    const string &text2, const Buffer::Declaration &d2)
+{
+    return text1.compare(d1.fBodyStart, d1.fEnd - d1.fBodyStart,
+        text2, d2.fBodyStart, d2.fEnd - d2.fBodyStart) == 0;
+}
+
+
+/*
+ * Replace the bodies of the unchanged tasks and subs in text (which
+ * has the declarations decls) with spaces, keeping the line ends so
+ * that everything else stays on the same line and column.  A task or
+ * sub is changed if its body is, or it uses the name of one that is,
+ * or of a function that is.  The names of the blanked ones go in
+ * blanked.  Returns false if the whole text has to be compiled: the
+ * last compile had errors, or the text outside of the bodies (globals,
+ * directives, headers) has changed.
+ */
+bool EditorServer::BlankUnchanged(const Document &d, const vector<Buffer::Declaration> &decls,
+    string &text, set<string> &blanked) const
+{
+    if (!d.fOnlyTextChanged || !d.fCompiled || !FilesUnchanged(d)) return false;
+
+    const vector<Buffer::Declaration> &old = d.fDeclarations;
+    if (old.size() != decls.size() ||
+        GetOutline(d.fCheckedText, old) != GetOutline(text, decls)) return false;
+
+    set<string> changed;
+    vector<bool> affected(decls.size());
+    size_t i;
+
+    for(i=0; i<decls.size(); ++i) {
+        if (!SameBody(d.fCheckedText, old[i], text, decls[i])) {
+            affected[i] = true;
+            changed.insert(decls[i].fName);
+        }
+    }
+
+    // then whatever uses them, until nothing more is found
+    bool found = true;
+    while(found) {
+        found = false;
+        for(i=0; i<decls.size(); ++i) {
+            if (affected[i]) continue;
+
+            const set<string> &uses = decls[i].fUses;
+            for(set<string>::const_iterator n=changed.begin(); n!=changed.end(); ++n) {
+                if (uses.count(*n)) {
+                    affected[i] = found = true;
+                    changed.insert(decls[i].fName);
+                    break;
+                }
+            }
+        }
+    }
+
+    for(i=0; i<decls.size(); ++i) {
+        const Buffer::Declaration &decl = decls[i];
+        if (affected[i] || decl.fKind == Buffer::Declaration::kFunction) continue;
+
+        for(int j=decl.fBodyStart+1; j<decl.fEnd-1; ++j)
+            if (text[j] != '\n' && text[j] != '\r') text[j] = ' ';
+
+        blanked.insert(decl.fName);
+    }
+
+    return true;
+}
+
+
+void EditorServer::Check(const string &name, Document &d, EditorCompiler &compiler)
+{
+    vector<Buffer::Declaration> decls;
+    string text = d.fText;
+    set<string> blanked;
+
+    Buffer scan;
+    scan.Create(name.c_str(), text.data(), (int)text.size());
+    if (!scan.FindDeclarations(decls))
+        decls.clear();
+    else
+        BlankUnchanged(d, decls, text, blanked);
+
+    // the sizes of the blanked tasks and subs don't change
+    vector<Size> sizes;
+    sizes.swap(d.fSizes);
+
+    d.fDiagnostics.clear();
+    d.fDefinitions.clear();
+    d.fOpenIncludes.clear();
+    d.fFiles.clear();
+    d.fCheckedText = d.fText;
+    d.fDeclarations.swap(decls);
+    d.fReparsed = (int)(d.fDeclarations.size() - blanked.size());
+
+    // include files may have been added or removed since the last
+    // compile
+    fDirs.Revalidate();
+
+    compiler.SetDocument(&d);
+
+    Buffer *b = new Buffer();
+    b->Create(name.c_str(), text.data(), (int)text.size());
+
+    double start = CompileStats::Now();
+    RCX_Image *image = compiler.Compile(b, fTarget, fFlags);
+    d.fCompileMs = (CompileStats::Now() - start) * 1000;
+
+    // the program is still there until the compiler is reset
+    FindDefinitions(d, compiler);
+
+    d.fCompiled = (image != 0);
+    if (image) {
+        // a blanked sub that only blanked code calls is left out
+        for(size_t i=0; i<sizes.size(); ++i)
+            if (blanked.count(sizes[i].fName)) d.fSizes.push_back(sizes[i]);
+
+        for(int i=0; i<image->GetChunkCount(); ++i) {
+            const RCX_Image::Chunk &c = image->GetChunk(i);
+            Size s;
+
+            if (c.GetType() == kRCX_TaskChunk)
+                s.fType = "task";
+            else if (c.GetType() == kRCX_SubChunk)
+                s.fType = "sub";
+            else
+                continue;
+
+            s.fName = c.GetName();
+            if (blanked.count(s.fName)) continue;
+
+            s.fBytes = c.GetLength();
+            d.fSizes.push_back(s);
+        }
+        delete image;
+    }
+
+    // don't hold on to the buffers between commands
+    compiler.Compiler::Reset();
+    compiler.SetDocument(0);
+    d.fCurrent = true;
+    d.fOnlyTextChanged = true;
+}
+
+
+/*
+ * Note the tasks, subs, inline functions and global variables that the
+ * compile left in the symbol table, including those of the API header.
+ */
+void EditorServer::FindDefinitions(Document &d, EditorCompiler &compiler)
+{
+    SymbolTable *table = Symbol::GetSymbolTable();
+
+    for(int i=0; i<table->GetSlotCount(); ++i) {
+        const Symbol *s = table->GetSlot(i);
+        if (!s) continue;
+
+        const ProgramNames &names = s->GetProgramNames();
+        Definition def;
+        const LexLocation *loc = 0;
+
+        if (names.fTask) {
+            def.fKind = "task";
+            loc = &names.fTask->GetStartLoc();
+        }
+        else if (names.fSub) {
+            def.fKind = "sub";
+            loc = &names.fSub->GetStartLoc();
+        }
+        else if (names.fFunction) {
+            def.fKind = "function";
+            loc = &names.fFunction->GetStartLoc();
+        }
+        else if (s->GetBinding())
+            def.fKind = "variable";
+        else
+            continue;
+
+        def.fName = s->GetKey();
+        def.fLine = 0;
+        if (loc && loc->fIndex != kIllegalSrcIndex && loc->fIndex < compiler.GetCount()) {
+            def.fFile = compiler.GetName(loc->fIndex);
+            def.fLine = compiler.GetLine(loc->fIndex, loc->fOffset);
+        }
+
+        d.fDefinitions.push_back(def);
+    }
+}
+
+
+time_t EditorServer::GetModified(const string &path)
+{
+    struct stat s;
+    return (stat(path.c_str(), &s) == 0) ? s.st_mtime : 0;
+}
+
+
+Buffer *EditorCompiler::CreateBuffer(const char *name)
+{
+    EditorServer::Document *d = fServer->Find(name);
+    Buffer *buf = new Buffer();
+
+    if (d) {
+        buf->Create(name, d->fText.data(), (int)d->fText.size());
+        if (fDocument)
+            fDocument->fOpenIncludes.push_back(name);
+        return buf;
+    }
+
+    string pathname;
+    if (fServer->fDirs.Find(name, pathname) && buf->Create(name, pathname.c_str())) {
+        if (fDocument) {
+            EditorServer::Dependency dep;
+            dep.fPath = pathname;
+            dep.fModified = EditorServer::GetModified(dep.fPath);
+            fDocument->fFiles.push_back(dep);
+        }
+        return buf;
+    }
+
+    delete buf;
+    return 0;
+}
+
+
+bool EditorCompiler::GetIncludePath(const char *name, string &path)
+{
+    string pathname;
+
+    if (fServer->Find(name))
+        path = name;
+    else if (fServer->fDirs.Find(name, pathname))
+        path = pathname;
+    else
+        return false;
+
+    return true;
+}
+
+
+void EditorCompiler::AddError(const Error &e, const LexLocation *loc)
+{
+    if (fPending.size() >= kMaxDiagnostics) return;
+
+    // the message is made now, since the data may not outlive the error
+    char msg[Error::kMaxErrorMsg];
+    Pending p;
+
+    e.SPrint(msg);
+    p.fWarning = e.IsWarning();
+    p.fCode = e.GetCode();
+    p.fMessage = msg;
+    if (loc)
+        p.fLoc = *loc;
+    else
+        p.fLoc.fIndex = kIllegalSrcIndex;
+
+    fPending.push_back(p);
+}
+
+
+void EditorCompiler::Flush()
+{
+    for(size_t i=0; fDocument && i<fPending.size(); ++i) {
+        const Pending &p = fPending[i];
+        EditorServer::Diagnostic d;
+
+        d.fWarning = p.fWarning;
+        d.fCode = p.fCode;
+        d.fMessage = p.fMessage;
+        d.fLine = 0;
+        d.fColumn = 0;
+        d.fLength = 0;
+
+        if (p.fLoc.fIndex != kIllegalSrcIndex) {
+            Buffer *b = GetBuffer(p.fLoc.fIndex);
+            int lineStart = p.fLoc.fOffset;
+
+            d.fFile = b->GetName();
+            d.fLine = b->FindLine(lineStart);
+            d.fColumn = (int)(p.fLoc.fOffset - lineStart) + 1;
+            d.fLength = p.fLoc.fLength;
+        }
+
+        fDocument->fDiagnostics.push_back(d);
+    }
+
+    fPending.clear();
+}
+
+
+void PrintJSONString(FILE *fp, const char *s)
+{
+    fputc('"', fp);
+    for(; *s; ++s) {
+        unsigned char c = (unsigned char)*s;
+
+        if (c == '"' || c == '\\')
+            fprintf(fp, "\\%c", c);
+        else if (c < 0x20)
+            fprintf(fp, "\\u%04x", c);
+        else
+            fputc(c, fp);
+    }
+    fputc('"', fp);
+}
@@ -0,0 +1,156 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __EditorServer_h
+#define __EditorServer_h
+
+#ifndef __DirList_h
+#include "DirList.h"
+#endif
+
+#ifndef __Buffer_h
+#include "Buffer.h"
+#endif
+
+#include <cstdio>
+#include <ctime>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+using std::FILE;
+using std::map;
+using std::set;
+using std::string;
+using std::time_t;
+using std::vector;
+
+class RCX_Target;
+class EditorCompiler;
+
+/**
+ * A server for editors.  The editor hands over the text of the files
+ * it has open, and asks for the diagnostics, definitions and code
+ * sizes of any of them.  Each document is compiled when it is first
+ * asked about, and again only once it, an open document it includes
+ * or an included file on disk has changed; everything else is answered
+ * from what the last compile found.  The server has its own compile
+ * context and compiler, which keeps the API header parsed between
+ * compiles.
+ *
+ * When only a document's own text has changed since a clean compile,
+ * the bodies of its tasks and subs that are the same as before, and
+ * that don't use a task, sub or function whose text changed, are left
+ * out of the next compile (see BlankUnchanged()), and their sizes are
+ * kept.  A change anywhere else, such as to a global, a directive or
+ * a header, compiles the whole document.
+ *
+ * Commands are read one per line, and each reply is a JSON object per
+ * line followed by "#done <status>" (0, or 1 for a bad command):
+ *
+ *   open <length> <name>   the next <length> bytes are the text of
+ *                          document <name> (open again to change it)
+ *   close <name>           forget a document
+ *   check <name>           {"severity":...} for each error or warning,
+ *                          then {"file":...,"errors":n,"warnings":n,...,
+ *                          "reparsed":n,"declarations":n}
+ *   symbol <id> <name>     {"name":<id>,"kind":...} for each definition
+ *                          of <id> the compile of <name> saw
+ *   sizes <name>           {"name":...,"type":...,"bytes":n} for each
+ *                          task and sub
+ *   quit                   stop (as does the end of the input)
+ */
+class EditorServer
+{
+public:
+    EditorServer(const DirList &dirs, const RCX_Target *target, int flags);
+
+    /// answer the commands from in on out, until "quit" or EOF
+    void Serve(FILE *in, FILE *out);
+
+private:
+    friend class EditorCompiler;
+
+    struct Diagnostic
+    {
+        bool fWarning;
+        int fCode;
+        string fMessage;
+        string fFile;       // empty if there is no location
+        int fLine;
+        int fColumn;
+        int fLength;
+    };
+
+    struct Definition
+    {
+        string fName;
+        const char *fKind;  // "task", "sub", "function" or "variable"
+        string fFile;       // empty if the location isn't known
+        int fLine;
+    };
+
+    struct Size
+    {
+        string fName;
+        const char *fType;
+        int fBytes;
+    };
+
+    // a file on disk that a compile read
+    struct Dependency
+    {
+        string fPath;
+        time_t fModified;
+    };
+
+    struct Document
+    {
+        Document() : fCurrent(false), fCompiled(false), fOnlyTextChanged(false),
+            fCompileMs(0), fReparsed(0) {}
+
+        string fText;
+        bool fCurrent;      // the results below are up to date
+        bool fCompiled;     // there's an image
+        bool fOnlyTextChanged;  // nothing else has changed since the compile
+        double fCompileMs;
+        int fReparsed;      // declarations whose bodies it parsed
+        string fCheckedText;    // the text it compiled
+        vector<Buffer::Declaration> fDeclarations;  // of fCheckedText
+        vector<Diagnostic> fDiagnostics;
+        vector<Definition> fDefinitions;
+        vector<Size> fSizes;
+        vector<string> fOpenIncludes;       // open documents it included
+        vector<Dependency> fFiles;
+    };
+
+    bool Execute(const char *line, FILE *in, FILE *out, EditorCompiler &compiler);
+    Document* Find(const string &name);
+    void Invalidate(const string &name);
+    bool IsCurrent(const Document &d) const;
+    bool FilesUnchanged(const Document &d) const;
+    bool BlankUnchanged(const Document &d, const vector<Buffer::Declaration> &decls,
+        string &text, set<string> &blanked) const;
+    void Check(const string &name, Document &d, EditorCompiler &compiler);
+    void FindDefinitions(Document &d, EditorCompiler &compiler);
+
+    static time_t GetModified(const string &path);
+
+    DirList fDirs;
+    const RCX_Target *fTarget;
+    int fFlags;
+    map<string, Document> fDocuments;
+};
+
+#endif
@@ -0,0 +1,212 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include "FileWatcher.h"
+
+#include <cstring>
+#include <cerrno>
+#include <set>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#include <signal.h>
+#include <poll.h>
+#endif
+
+#ifdef __linux__
+#define USE_INOTIFY
+#include <sys/inotify.h>
+#endif
+
+using std::set;
+
+// how often files are checked without inotify, and how long a
+// changed file must stay the same before it is compiled
+#define kPollInterval   250
+#define kSettleTime     100
+
+#ifndef WIN32
+static volatile sig_atomic_t sStop = 0;
+
+static void Stop(int /* sig */)
+{
+    sStop = 1;
+}
+#endif
+
+
+FileWatcher::FileWatcher() : fNotify(-1)
+{
+}
+
+
+FileWatcher::~FileWatcher()
+{
+#ifdef USE_INOTIFY
+    if (fNotify >= 0)
+        close(fNotify);
+#endif
+}
+
+
+void FileWatcher::Watch(const vector<string> &files)
+{
+    fFiles.resize(files.size());
+    for(size_t i=0; i<files.size(); ++i) {
+        fFiles[i].fPath = files[i];
+        Check(fFiles[i]);
+    }
+
+#ifdef USE_INOTIFY
+    if (fNotify >= 0)
+        close(fNotify);
+
+    // watching the directories sees a file that is replaced by a
+    // rename, which would lose a watch on the file itself
+    fNotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fNotify < 0) return;
+
+    set<string> dirs;
+    for(size_t i=0; i<files.size(); ++i) {
+        size_t slash = files[i].rfind('/');
+        string dir = (slash == string::npos) ? "." :
+            (slash == 0) ? "/" : files[i].substr(0, slash);
+
+        if (dirs.insert(dir).second)
+            inotify_add_watch(fNotify, dir.c_str(), IN_CLOSE_WRITE |
+                IN_MOVED_TO | IN_CREATE | IN_DELETE | IN_MODIFY);
+    }
+#endif
+}
+
+
+bool FileWatcher::Wait()
+{
+    bool ok = true;
+
+#ifndef WIN32
+    // not restarting poll() lets a signal end the wait
+    struct sigaction action, oldInt, oldTerm;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = Stop;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT, &action, &oldInt);
+    sigaction(SIGTERM, &action, &oldTerm);
+    sStop = 0;
+#endif
+
+    while(!Changed()) {
+        if (!Sleep(fNotify >= 0 ? -1 : kPollInterval)) {
+            ok = false;
+            break;
+        }
+    }
+
+    // until the files stay the same for a moment
+    while(ok && Changed()) {
+        if (!Sleep(kSettleTime))
+            ok = false;
+    }
+
+#ifndef WIN32
+    sigaction(SIGINT, &oldInt, 0);
+    sigaction(SIGTERM, &oldTerm, 0);
+#endif
+
+    return ok;
+}
+
+
+/**
+ * @return true if a file differs from the last check, which it then
+ * becomes
+ */
+bool FileWatcher::Changed()
+{
+    bool changed = false;
+
+    for(size_t i=0; i<fFiles.size(); ++i) {
+        File f = fFiles[i];
+        Check(fFiles[i]);
+
+        if (f.fTime != fFiles[i].fTime || f.fNanos != fFiles[i].fNanos ||
+            f.fSize != fFiles[i].fSize)
+            changed = true;
+    }
+
+    return changed;
+}
+
+
+void FileWatcher::Check(File &f)
+{
+    struct stat s;
+
+    if (stat(f.fPath.c_str(), &s) == 0) {
+        f.fTime = (long)s.st_mtime;
+#if defined(__linux__)
+        f.fNanos = (long)s.st_mtim.tv_nsec;
+#elif defined(__APPLE__)
+        f.fNanos = (long)s.st_mtimespec.tv_nsec;
+#else
+        f.fNanos = 0;
+#endif
+        f.fSize = (long)s.st_size;
+    }
+    else {
+        f.fTime = -1;
+        f.fNanos = 0;
+        f.fSize = -1;
+    }
+}
+
+
+/**
+ * Sleep for ms (or until inotify says something happened, if ms is -1).
+ *
+ * @return false if a signal asked to stop
+ */
+bool FileWatcher::Sleep(int ms)
+{
+#ifdef WIN32
+    ::Sleep(ms < 0 ? kPollInterval : ms);
+    return true;
+#else
+    if (sStop) return false;
+
+    struct pollfd pfd;
+    pfd.fd = fNotify;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+
+    // with no descriptor poll() just waits
+    int ready = poll(&pfd, fNotify >= 0 ? 1 : 0, ms);
+
+#ifdef USE_INOTIFY
+    // what happened doesn't matter, Changed() looks at the files
+    if (ready > 0) {
+        char events[4096];
+        while(read(fNotify, events, sizeof(events)) > 0)
+            ;
+    }
+#else
+    (void)ready;
+#endif
+
+    return !sStop;
+#endif
+}
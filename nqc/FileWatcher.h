@@ -0,0 +1,62 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __FileWatcher_h
+#define __FileWatcher_h
+
+#include <vector>
+#include <string>
+
+using std::vector;
+using std::string;
+
+/**
+ * Waits for one of a set of files to change.  A file has changed when
+ * its modification time or size differs from when it was watched, or
+ * it has appeared or gone away.
+ *
+ * On Linux inotify wakes the watcher as soon as anything happens in
+ * the files' directories (so a file that an editor replaces is still
+ * seen); elsewhere the files are checked a few times a second.
+ */
+class FileWatcher
+{
+public:
+            FileWatcher();
+            ~FileWatcher();
+
+    /// watch these files, in place of any watched before
+    void    Watch(const vector<string> &files);
+
+    /// Wait until a file changes and stays unchanged for a moment
+    /// (editors often write a file in several steps).  Returns false
+    /// if SIGINT or SIGTERM came first.
+    bool    Wait();
+
+private:
+    struct File {
+        string  fPath;
+        long    fTime;      // -1 if the file isn't there
+        long    fNanos;     // of fTime, where the system has them
+        long    fSize;
+    };
+
+    static void Check(File &f);
+    bool    Changed();
+    bool    Sleep(int ms);
+
+    vector<File>    fFiles;
+    int             fNotify;    // inotify descriptor, -1 if none
+};
+
+#endif
@@ -0,0 +1,386 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include "LinkDaemon.h"
+#include "CmdLine.h"
+#include "TowerServer.h"
+
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <vector>
+#include <string>
+
+#if !defined(WIN32) && !defined(__wasm__)
+#define DAEMON_SUPPORTED
+#include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif
+
+using std::vector;
+using std::string;
+
+#ifdef DAEMON_SUPPORTED
+
+/*
+ * A request is a 4 byte length, sent along with the client's stdin,
+ * stdout and stderr, followed by that many bytes: the working
+ * directory and then each argument, each ending in a nul.  The reply
+ * is the 4 byte exit code.
+ */
+#define kStdFds 3
+#define kMaxRequest 65536
+
+// how much of an HTTP request for the metrics is read, and how long
+// its sender gets to send it
+#define kMaxHttpRequest 8192
+#define kHttpWait 1000
+
+static volatile sig_atomic_t sStop = 0;
+
+static void Stop(int /* sig */)
+{
+    sStop = 1;
+}
+
+
+static bool MakeAddress(const char *path, sockaddr_un &addr)
+{
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        errno = ENAMETOOLONG;
+        return false;
+    }
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    return true;
+}
+
+
+static bool WriteAll(int fd, const void *data, size_t length)
+{
+    const char *ptr = (const char *)data;
+    while (length) {
+        ssize_t n = write(fd, ptr, length);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        ptr += n;
+        length -= n;
+    }
+    return true;
+}
+
+
+static bool ReadAll(int fd, void *data, size_t length)
+{
+    char *ptr = (char *)data;
+    while (length) {
+        ssize_t n = read(fd, ptr, length);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        ptr += n;
+        length -= n;
+    }
+    return true;
+}
+
+
+/*
+ * Read a request's length and the fds sent along with it.  Returns
+ * false if the request isn't complete; fds are only filled in when
+ * all of them arrived.
+ */
+static bool ReceiveHeader(int fd, unsigned &length, int fds[kStdFds])
+{
+    char control[CMSG_SPACE(sizeof(int) * kStdFds)];
+    iovec iov;
+    msghdr msg;
+
+    iov.iov_base = &length;
+    iov.iov_len = sizeof(length);
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    ssize_t n;
+    do {
+        n = recvmsg(fd, &msg, 0);
+    } while (n < 0 && errno == EINTR);
+    if (n != (ssize_t)sizeof(length)) return false;
+
+    cmsghdr *c = CMSG_FIRSTHDR(&msg);
+    if (!c || c->cmsg_level != SOL_SOCKET || c->cmsg_type != SCM_RIGHTS ||
+        c->cmsg_len != CMSG_LEN(sizeof(int) * kStdFds)) {
+        return false;
+    }
+
+    memcpy(fds, CMSG_DATA(c), sizeof(int) * kStdFds);
+    return true;
+}
+
+
+/*
+ * Run one request with the client's fds standing in for our own
+ * stdin/stdout/stderr and the client's working directory as ours.
+ */
+static int RunRequest(int conn, LinkDaemon::Handler handler)
+{
+    unsigned length;
+    int fds[kStdFds];
+    int i;
+
+    for (i=0; i<kStdFds; ++i) fds[i] = -1;
+    if (!ReceiveHeader(conn, length, fds)) {
+        for (i=0; i<kStdFds; ++i)
+            if (fds[i] >= 0) close(fds[i]);
+        return -1;
+    }
+
+    vector<char> data(length + 1);
+    bool ok = length && length <= kMaxRequest && ReadAll(conn, &data[0], length);
+    data[length] = 0;
+
+    int result = -1;
+    if (ok && chdir(&data[0]) == 0) {
+        CmdLine args;
+        for (const char *ptr = &data[0] + strlen(&data[0]) + 1;
+            ptr < &data[length]; ptr += strlen(ptr) + 1) {
+            args.Add(ptr);
+        }
+
+        int saved[kStdFds];
+        fflush(stdout);
+        fflush(stderr);
+        for (i=0; i<kStdFds; ++i) {
+            saved[i] = dup(i);
+            dup2(fds[i], i);
+        }
+
+        result = handler(args);
+        result = RCX_ERROR(result) ? result : 0;
+
+        fflush(stdout);
+        fflush(stderr);
+        clearerr(stdin);
+        clearerr(stdout);
+        clearerr(stderr);
+        for (i=0; i<kStdFds; ++i) {
+            dup2(saved[i], i);
+            close(saved[i]);
+        }
+    }
+
+    for (i=0; i<kStdFds; ++i)
+        close(fds[i]);
+    return result;
+}
+
+
+/*
+ * Answer an HTTP request on the metrics port.  Whatever it asks for,
+ * the answer is the metrics, but the request is read (up to the blank
+ * line that ends its headers) before answering so that the client
+ * doesn't see its connection reset.
+ */
+static void Report(int listener, LinkDaemon::Reporter reporter)
+{
+    int conn = accept(listener, 0, 0);
+    if (conn < 0) return;
+    fcntl(conn, F_SETFD, FD_CLOEXEC);
+
+    string request;
+    char buf[1024];
+    while (request.size() < kMaxHttpRequest &&
+        request.find("\r\n\r\n") == string::npos &&
+        request.find("\n\n") == string::npos) {
+        pollfd p = { conn, POLLIN, 0 };
+        if (poll(&p, 1, kHttpWait) <= 0) break;
+
+        ssize_t n = read(conn, buf, sizeof(buf));
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        request.append(buf, n);
+    }
+
+    string body;
+    reporter(body);
+
+    char header[160];
+    snprintf(header, sizeof(header), "HTTP/1.0 200 OK\r\n"
+        "Content-Type: text/plain; version=0.0.4\r\n"
+        "Content-Length: %lu\r\n"
+        "Connection: close\r\n\r\n", (unsigned long)body.size());
+
+    if (WriteAll(conn, header, strlen(header)))
+        WriteAll(conn, body.data(), body.size());
+    close(conn);
+}
+
+
+bool LinkDaemon::Serve(const char *path, Handler handler, int metricsPort, Reporter reporter)
+{
+    sockaddr_un addr;
+    if (!MakeAddress(path, addr)) return false;
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) return false;
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+
+    // a socket left over from a daemon that's gone is in the way
+    unlink(path);
+    if (bind(fd, (sockaddr *)&addr, sizeof(addr)) < 0 || listen(fd, 8) < 0) {
+        int e = errno;
+        close(fd);
+        errno = e;
+        return false;
+    }
+
+    int metrics = -1;
+    if (metricsPort > 0 && reporter) {
+        metrics = TowerServer::Listen(metricsPort);
+        if (metrics < 0) {
+            int e = errno;
+            close(fd);
+            unlink(path);
+            errno = e;
+            return false;
+        }
+        fcntl(metrics, F_SETFD, FD_CLOEXEC);
+    }
+
+    // not restarting accept() lets a signal end the loop
+    struct sigaction action, oldInt, oldTerm, oldPipe;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = Stop;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT, &action, &oldInt);
+    sigaction(SIGTERM, &action, &oldTerm);
+    // a client that goes away mustn't take the daemon with it
+    action.sa_handler = SIG_IGN;
+    sigaction(SIGPIPE, &action, &oldPipe);
+
+    sStop = 0;
+    while (!sStop) {
+        pollfd fds[2] = { { fd, POLLIN, 0 }, { metrics, POLLIN, 0 } };
+        if (poll(fds, metrics >= 0 ? 2 : 1, -1) <= 0) continue;
+
+        if (metrics >= 0 && (fds[1].revents & POLLIN))
+            Report(metrics, reporter);
+        if (!(fds[0].revents & POLLIN)) continue;
+
+        int conn = accept(fd, 0, 0);
+        if (conn < 0) continue;
+        fcntl(conn, F_SETFD, FD_CLOEXEC);
+
+        int result = RunRequest(conn, handler);
+        WriteAll(conn, &result, sizeof(result));
+        close(conn);
+    }
+
+    sigaction(SIGINT, &oldInt, 0);
+    sigaction(SIGTERM, &oldTerm, 0);
+    sigaction(SIGPIPE, &oldPipe, 0);
+    if (metrics >= 0) close(metrics);
+    close(fd);
+    unlink(path);
+    return true;
+}
+
+
+bool LinkDaemon::Forward(const char *path, CmdLine &args, int &exitCode)
+{
+    sockaddr_un addr;
+    if (!MakeAddress(path, addr)) return false;
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) return false;
+
+    if (connect(fd, (sockaddr *)&addr, sizeof(addr)) < 0) {
+        close(fd);
+        return false;
+    }
+
+    vector<char> cwd(4096);
+    while (!getcwd(&cwd[0], cwd.size())) {
+        if (errno != ERANGE) {
+            close(fd);
+            return false;
+        }
+        cwd.resize(cwd.size() * 2);
+    }
+
+    string data(&cwd[0]);
+    data += '\0';
+    while (args.Remain()) {
+        data += args.Next();
+        data += '\0';
+    }
+    unsigned length = (unsigned)data.size();
+
+    int fds[kStdFds] = { 0, 1, 2 };
+    char control[CMSG_SPACE(sizeof(fds))];
+    iovec iov;
+    msghdr msg;
+
+    iov.iov_base = &length;
+    iov.iov_len = sizeof(length);
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    cmsghdr *c = CMSG_FIRSTHDR(&msg);
+    c->cmsg_level = SOL_SOCKET;
+    c->cmsg_type = SCM_RIGHTS;
+    c->cmsg_len = CMSG_LEN(sizeof(fds));
+    memcpy(CMSG_DATA(c), fds, sizeof(fds));
+
+    fflush(stdout);
+    fflush(stderr);
+
+    int code;
+    bool ok = sendmsg(fd, &msg, 0) == (ssize_t)sizeof(length) &&
+        WriteAll(fd, data.data(), length) &&
+        ReadAll(fd, &code, sizeof(code));
+    close(fd);
+
+    // having connected, the command may well have run already, so it
+    // can't be run again here
+    exitCode = ok ? code : -1;
+    return true;
+}
+
+#else
+
+bool LinkDaemon::Serve(const char * /* path */, Handler /* handler */,
+    int /* metricsPort */, Reporter /* reporter */)
+{
+    errno = ENOSYS;
+    return false;
+}
+
+
+bool LinkDaemon::Forward(const char * /* path */, CmdLine & /* args */, int & /* exitCode */)
+{
+    return false;
+}
+
+#endif
@@ -0,0 +1,55 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __LinkDaemon_h
+#define __LinkDaemon_h
+
+#ifndef __RCX_Result_h
+#include "RCX_Result.h"
+#endif
+
+#include <string>
+
+class CmdLine;
+
+/**
+ * A daemon that keeps the link to the tower open (and the brick synced)
+ * between nqc commands.  It listens on a Unix socket; each nqc that
+ * finds the daemon hands over its arguments, working directory and
+ * stdin/stdout/stderr, and the daemon runs the command as if it were
+ * that process, one command at a time.
+ *
+ * Not supported on Windows or WebAssembly, where Serve() fails and
+ * Forward() always returns false.
+ */
+class LinkDaemon
+{
+public:
+    typedef RCX_Result (*Handler)(CmdLine &args);
+    /// writes the metrics page
+    typedef void (*Reporter)(std::string &text);
+
+    /// Run requests on the socket at path until SIGINT or SIGTERM.
+    /// With a metrics port, any HTTP request to that TCP port is
+    /// answered (between commands) with the text reporter writes.
+    /// Returns false (with errno set) if a socket can't be set up.
+    static bool Serve(const char *path, Handler handler,
+                int metricsPort = 0, Reporter reporter = 0);
+
+    /// Have the daemon at path run args.  Returns false if there is no
+    /// daemon listening there, otherwise exitCode gets the command's
+    /// exit code.
+    static bool Forward(const char *path, CmdLine &args, int &exitCode);
+};
+
+#endif
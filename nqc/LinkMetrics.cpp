@@ -0,0 +1,197 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include "LinkMetrics.h"
+
+#include <cstdio>
+
+using std::snprintf;
+
+// the tower metrics, in the order of sTowerMetrics
+enum {
+    kPacketsMetric = 0,
+    kFailedMetric,
+    kRetriesMetric,
+    kTimeoutMetric,
+    kDownloadBytesMetric,
+    kDownloadTimeMetric,
+    kBatteryMetric,
+    kBatteryTimeMetric,
+    kTowerMetricCount
+};
+
+// a metric's name, type and help; its samples are one per tower
+struct Metric {
+    const char *fName;
+    const char *fType;
+    const char *fHelp;
+};
+
+static const Metric sTowerMetrics[] = {
+    { "nqc_link_packets_total", "counter", "Packets sent to the brick." },
+    { "nqc_link_failed_packets_total", "counter", "Packets that never got a reply." },
+    { "nqc_link_retries_total", "counter", "Transmissions beyond the first of packets that got a reply." },
+    { "nqc_link_rx_timeout_milliseconds", "gauge", "Reply timeout the transport has arrived at." },
+    { "nqc_link_download_bytes_total", "counter", "Bytes downloaded to the brick." },
+    { "nqc_link_download_seconds_total", "counter", "Time spent sending those bytes." },
+    { "nqc_brick_battery_millivolts", "gauge", "Battery level the brick last reported." },
+    { "nqc_brick_battery_timestamp_seconds", "gauge", "When the battery level was read." }
+};
+
+
+/*
+ * Prometheus label values are quoted, with backslash, quote and
+ * newline escaped.
+ */
+static void AppendLabel(string &text, const char *name, const string &value)
+{
+    text += name;
+    text += "=\"";
+    for(size_t i=0; i<value.size(); ++i) {
+        char c = value[i];
+        if (c == '\\' || c == '"') {
+            text += '\\';
+            text += c;
+        }
+        else if (c == '\n')
+            text += "\\n";
+        else
+            text += c;
+    }
+    text += '"';
+}
+
+
+static void AppendHeader(string &text, const char *name, const char *type, const char *help)
+{
+    text += "# HELP ";
+    text += name;
+    text += ' ';
+    text += help;
+    text += "\n# TYPE ";
+    text += name;
+    text += ' ';
+    text += type;
+    text += '\n';
+}
+
+
+LinkMetrics::LinkMetrics() : fRequests(0), fFailedRequests(0)
+{
+}
+
+
+LinkMetrics::~LinkMetrics()
+{
+    for(map<string, Tower*>::iterator i=fTowers.begin(); i!=fTowers.end(); ++i)
+        delete i->second;
+}
+
+
+LinkMetrics::Tower &LinkMetrics::GetTower(const string &port)
+{
+    Tower *&t = fTowers[port];
+
+    if (!t) {
+        t = new Tower;
+        t->fTimeout = 0;
+        t->fBattery = 0;
+        t->fBatteryTime = 0;
+    }
+
+    return *t;
+}
+
+
+RCX_LinkStats *LinkMetrics::GetStats(const string &port)
+{
+    return &GetTower(port).fStats;
+}
+
+
+void LinkMetrics::SetTarget(const string &port, const char *target)
+{
+    GetTower(port).fTarget = target;
+}
+
+
+void LinkMetrics::SetTimeout(const string &port, int ms)
+{
+    if (ms > 0) GetTower(port).fTimeout = ms;
+}
+
+
+void LinkMetrics::SetBattery(const string &port, int mv)
+{
+    Tower &t = GetTower(port);
+
+    t.fBattery = mv;
+    t.fBatteryTime = std::time(0);
+}
+
+
+void LinkMetrics::Print(string &text) const
+{
+    char value[64];
+
+    AppendHeader(text, "nqc_daemon_requests_total", "counter", "Commands the daemon has run.");
+    snprintf(value, sizeof(value), "nqc_daemon_requests_total %ld\n", fRequests + fFailedRequests);
+    text += value;
+    AppendHeader(text, "nqc_daemon_failed_requests_total", "counter", "Commands that failed.");
+    snprintf(value, sizeof(value), "nqc_daemon_failed_requests_total %ld\n", fFailedRequests);
+    text += value;
+
+    for(int m=0; m<kTowerMetricCount; ++m) {
+        const Metric &metric = sTowerMetrics[m];
+        bool header = false;
+
+        for(map<string, Tower*>::const_iterator i=fTowers.begin(); i!=fTowers.end(); ++i) {
+            const Tower &t = *i->second;
+            const RCX_LinkStats &s = t.fStats;
+
+            switch(m) {
+                case kPacketsMetric: snprintf(value, sizeof(value), "%ld", s.GetPackets()); break;
+                case kFailedMetric: snprintf(value, sizeof(value), "%ld", s.GetFailed()); break;
+                case kRetriesMetric: snprintf(value, sizeof(value), "%ld", s.GetRetries()); break;
+                case kTimeoutMetric:
+                    if (!t.fTimeout) continue;
+                    snprintf(value, sizeof(value), "%d", t.fTimeout);
+                    break;
+                case kDownloadBytesMetric: snprintf(value, sizeof(value), "%ld", s.GetDownloadBytes()); break;
+                case kDownloadTimeMetric: snprintf(value, sizeof(value), "%.3f", s.GetDownloadTime() / 1000); break;
+                case kBatteryMetric:
+                    if (!t.fBatteryTime) continue;
+                    snprintf(value, sizeof(value), "%d", t.fBattery);
+                    break;
+                case kBatteryTimeMetric:
+                    if (!t.fBatteryTime) continue;
+                    snprintf(value, sizeof(value), "%ld", (long)t.fBatteryTime);
+                    break;
+            }
+
+            if (!header) {
+                AppendHeader(text, metric.fName, metric.fType, metric.fHelp);
+                header = true;
+            }
+
+            text += metric.fName;
+            text += '{';
+            AppendLabel(text, "port", i->first);
+            text += ',';
+            AppendLabel(text, "target", t.fTarget);
+            text += "} ";
+            text += value;
+            text += '\n';
+        }
+    }
+}
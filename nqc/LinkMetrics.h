@@ -0,0 +1,71 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __LinkMetrics_h
+#define __LinkMetrics_h
+
+#include <ctime>
+#include <map>
+#include <string>
+
+#ifndef __RCX_LinkStats_h
+#include "RCX_LinkStats.h"
+#endif
+
+using std::map;
+using std::string;
+using std::time_t;
+
+/**
+ * What a daemon has seen of each tower it has had the link open on,
+ * written as Prometheus text for its metrics port.  Each tower (by
+ * port name) has its own link stats, which the link is given while it
+ * is open on that port; the packet, retry and download counts come
+ * from those, so rates are left to whoever scrapes them.  The reply
+ * timeout is the one the tower's transport had when last looked at,
+ * and the battery level the last one a command read, as asking the
+ * brick on every scrape would load the link being watched.
+ */
+class LinkMetrics
+{
+public:
+            LinkMetrics();
+            ~LinkMetrics();
+
+    /// the stats a link open on port adds to
+    RCX_LinkStats*  GetStats(const string &port);
+
+    void    SetTarget(const string &port, const char *target);
+    void    SetTimeout(const string &port, int ms);
+    void    SetBattery(const string &port, int mv);
+    void    AddRequest(bool ok)     { ++(ok ? fRequests : fFailedRequests); }
+
+    void    Print(string &text) const;
+
+private:
+    struct Tower {
+        RCX_LinkStats   fStats;
+        string          fTarget;
+        int             fTimeout;       // 0 if not known
+        int             fBattery;       // mV, 0 if never read
+        time_t          fBatteryTime;
+    };
+
+    Tower&  GetTower(const string &port);
+
+    map<string, Tower*> fTowers;
+    long    fRequests;
+    long    fFailedRequests;
+};
+
+#endif
@@ -20,18 +20,6 @@ using std::strncmp;
 using std::memcpy;
 using std::isspace;
 
-#define kMaxLine 256
-
-typedef struct {
-  int length;
-  int offset;
-} segment_t;
-
-typedef struct {
-  unsigned short entry;
-  segment_t *segments;
-} image_t;
-
 #ifdef SREC_STRICT
 #define SREC_DATA_SIZE 32
 #else
@@ -160,116 +148,167 @@ int srec_decode(srec_t *srec, char *_line)
     return SREC_OK;
 }
 
-int srec_load(
-    FILE *file,
-    UByte *image,
-    int maxlen,
-    image_t *image_def,
-    int numimage_def
-){
-    char buf[256];
-    srec_t srec;
-    int segStartAddr = 0;
-    int prevAddr = -SEGMENT_BREAK;
-    int prevCount = SEGMENT_BREAK;
-    int segIndex = -1;
-    int strip = 0;
-    int imageIndex = -SEGMENT_BREAK;
-    int i;
-    int length = 0;
+SRecord::SRecord() :
+    fLength(0),
+    fStart(0),
+    fData(0),
+    fMaxLength(0),
+    fLineLength(0),
+    fOK(false)
+{
+}
 
-    /* Clear image to zero */
-    memset(image, 0, maxlen);
-
-    /* Read image file */
-    while (fgets(buf, sizeof(buf), file)) {
-        int error, i;
-        /* Skip blank lines */
-        for (i = 0; buf[i]; i++)
-            if (!isspace(buf[i]))
-                break;
-        if (!buf[i])
-            continue;
-        /* Decode line */
-        if ((error = srec_decode(&srec, buf)) < 0) {
-          return error;
-        }
-        /* Detect Firm0309.lgo header, set strip=1 if found */
-        if (srec.type == 0) {
-            if (srec.count == 16)
-                if (!strncmp((const char*)srec.data, "?LIB_VERSION_L00", 16))
-                    strip = 1;
+
+bool SRecord::Read(FILE *fp, int maxLength)
+{
+    char block[BUFFERSIZE];
+    size_t n;
+
+    Begin(maxLength);
+    while ((n = fread(block, 1, sizeof(block), fp)) > 0) {
+        if (!Feed(block, (int)n)) return false;
+    }
+
+    return End();
+}
+
+
+void SRecord::Begin(int maxLength)
+{
+    // the image can't be bigger than the RCX's firmware area
+    if (maxLength > IMAGE_MAXLEN)
+        maxLength = IMAGE_MAXLEN;
+
+    delete [] fData;
+    fData = new UByte[maxLength > 0 ? maxLength : 1];
+    memset(fData, 0, maxLength);
+
+    fMaxLength = maxLength;
+    fLength = 0;
+    fStart = 0;
+
+    fLineLength = 0;
+    fOK = true;
+
+    fSegStartAddr = 0;
+    fPrevAddr = -SEGMENT_BREAK;
+    fPrevCount = SEGMENT_BREAK;
+    fSegIndex = -1;
+    fImageIndex = -SEGMENT_BREAK;
+    fStrip = false;
+}
+
+
+bool SRecord::Feed(const char *data, int length)
+{
+    for (int i=0; i<length && fOK; ++i) {
+        char c = data[i];
+
+        if (c == '\n' || c == '\r') {
+            fLine[fLineLength] = 0;
+            fOK = ProcessLine();
+            fLineLength = 0;
         }
-        /* Process s-record data */
-        else if (srec.type == 1) {
-                /* Start of a new segment? */
-                if (srec.addr - prevAddr >= SEGMENT_BREAK) {
-                    segIndex++;
-                    if (segIndex >= numimage_def) {
-                      return 0;
-                    }
-                    image_def->segments[segIndex].length = 0;
-                    segStartAddr = srec.addr;
-                    prevAddr = srec.addr - prevCount;
-                    image_def->segments[segIndex].offset = imageIndex + prevCount;
-                }
-
-            if (srec.addr < IMAGE_START ||
-                srec.addr + srec.count > (unsigned long) IMAGE_START + maxlen) {
-                  return 0;
-            }
-
-                // Data is not necessarily contiguous so can't just accumulate srec.counts.
-            image_def->segments[segIndex].length = srec.addr - segStartAddr + srec.count;
-
-            imageIndex += srec.addr - prevAddr;
-            memcpy(&image[imageIndex], &srec.data, srec.count);
-            prevAddr = srec.addr;
-            prevCount = srec.count;
+        else if (fLineLength < kMaxLine-1) {
+            fLine[fLineLength++] = c;
         }
-        /* Process image entry point */
-        else if (srec.type == 9) {
-            if (srec.addr < IMAGE_START ||
-                srec.addr > (unsigned long) IMAGE_START + maxlen) {
-                  return 0;
-            }
-                image_def->entry = srec.addr;
+        else {
+            fOK = false;
         }
     }
 
-    if (strip) {
-                int pos;
-                for (pos = IMAGE_MAXLEN - 1; pos >= 0 && image[pos] == 0; pos--)
-                {} // do nothing
-                image_def->segments[segIndex].length = pos+1;
+    return fOK;
+}
+
+
+bool SRecord::End()
+{
+    // the last line needn't have a newline
+    if (fOK && fLineLength) {
+        fLine[fLineLength] = 0;
+        fOK = ProcessLine();
+        fLineLength = 0;
     }
 
-    for (i = 0; i <= segIndex; i++) {
-        length += image_def->segments[segIndex].length;
+    if (!fOK || fSegIndex < 0) return false;
+
+    if (fStrip) {
+        int pos;
+        for (pos = fMaxLength - 1; pos >= 0 && fData[pos] == 0; pos--)
+        {} // do nothing
+        fSegLength[fSegIndex] = pos+1;
     }
 
-    if (length == 0) {
-      return 0;
+    int length = 0;
+    for (int i = 0; i <= fSegIndex; i++) {
+        length += fSegLength[i];
     }
 
-    return segIndex+1;
+    if (length == 0) return false;
+
+    fLength = fSegOffset[fSegIndex] + fSegLength[fSegIndex];
+    return true;
 }
 
-bool SRecord::Read(FILE *fp, int maxLength)
+
+bool SRecord::ProcessLine()
 {
-    delete [] fData;
-    fData = new UByte[maxLength];
-
-        segment_t segments[2];
-        image_t image_def = { 0, &segments[0] };
-        int num_image_def = srec_load(fp, fData, IMAGE_MAXLEN, &image_def, 2);
-        if (num_image_def > 0) {
-           fStart = image_def.entry;
-           fLength = image_def.segments[num_image_def-1].offset +
-                     image_def.segments[num_image_def-1].length;
-           return true;
-        }
+    srec_t srec;
+    int i;
+
+    /* Skip blank lines */
+    for (i = 0; fLine[i]; i++)
+        if (!isspace((unsigned char)fLine[i]))
+            break;
+    if (!fLine[i])
+        return true;
+
+    /* Decode line, which checks its checksum */
+    if (srec_decode(&srec, fLine) < 0)
         return false;
+
+    /* Detect Firm0309.lgo header, set strip if found */
+    if (srec.type == 0) {
+        if (srec.count == 16)
+            if (!strncmp((const char*)srec.data, "?LIB_VERSION_L00", 16))
+                fStrip = true;
+    }
+    /* Process s-record data */
+    else if (srec.type == 1) {
+        /* Start of a new segment? */
+        if (srec.addr - fPrevAddr >= SEGMENT_BREAK) {
+            if (++fSegIndex >= kMaxSegments)
+                return false;
+            fSegLength[fSegIndex] = 0;
+            fSegStartAddr = srec.addr;
+            fPrevAddr = srec.addr - fPrevCount;
+            fSegOffset[fSegIndex] = fImageIndex + fPrevCount;
+        }
+
+        if (srec.addr < IMAGE_START ||
+            srec.addr + srec.count > (unsigned long) IMAGE_START + fMaxLength)
+            return false;
+
+        // Data is not necessarily contiguous so can't just accumulate srec.counts.
+        fSegLength[fSegIndex] = srec.addr - fSegStartAddr + srec.count;
+
+        fImageIndex += srec.addr - fPrevAddr;
+        if (fImageIndex < 0 || fImageIndex + srec.count > fMaxLength)
+            return false;
+
+        memcpy(&fData[fImageIndex], &srec.data, srec.count);
+        fPrevAddr = srec.addr;
+        fPrevCount = srec.count;
+    }
+    /* Process image entry point */
+    else if (srec.type == 9) {
+        if (srec.addr < IMAGE_START ||
+            srec.addr > (unsigned long) IMAGE_START + fMaxLength)
+            return false;
+        fStart = srec.addr;
+    }
+
+    return true;
 }
 
 
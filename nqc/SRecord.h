@@ -25,7 +25,7 @@ using std::FILE;
 class SRecord
 {
 public:
-    SRecord() : fLength(0), fStart(0), fData(0) {}
+    SRecord();
     ~SRecord() { delete [] fData; }
 
     int GetLength() const { return fLength; }
@@ -34,12 +34,44 @@ public:
 
     bool Read(FILE *fp, int maxLength);
 
+    /*
+     * The file can also be parsed a piece at a time, as it arrives:
+     * Begin(), then Feed() any number of blocks (lines may be split
+     * between them), then End().  Each record is decoded and its
+     * checksum checked as soon as its line is complete, and Feed()
+     * returns false as soon as there is an error.
+     */
+    void Begin(int maxLength);
+    bool Feed(const char *data, int length);
+    bool End();
+
     static int ReadHexByte(const char *ptr);
 
 private:
+    enum {
+        kMaxLine = 256,
+        kMaxSegments = 2
+    };
+
+    bool ProcessLine();
+
     int fLength;
     int fStart;
     UByte* fData;
+    int fMaxLength;
+
+    // parse state
+    char fLine[kMaxLine];
+    int fLineLength;
+    bool fOK;
+    int fSegStartAddr;
+    int fPrevAddr;
+    int fPrevCount;
+    int fSegIndex;
+    int fImageIndex;
+    bool fStrip;
+    int fSegOffset[kMaxSegments];
+    int fSegLength[kMaxSegments];
 };
 
 #endif
@@ -0,0 +1,536 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include "TowerServer.h"
+
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <vector>
+#include <string>
+
+#include "RCX_Pipe.h"
+#include "RCX_SerialPipe.h"
+#include "RCX_SimPipe.h"
+#include "RCX_Link.h"
+#include "RCX_Constants.h"
+
+#if !defined(WIN32) && !defined(__wasm__)
+#define TOWER_SERVER_SUPPORTED
+#include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <poll.h>
+#include <time.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#endif
+
+using std::vector;
+using std::string;
+
+#ifdef TOWER_SERVER_SUPPORTED
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+// how long a turn lasts once the client and the brick both go quiet
+#define kTurnHold 300
+// how long the brick may stay quiet in the middle of a reply
+#define kReplyGap 30
+// how long to wait for a reply to a message that may not get one
+#define kReplyWait 150
+// how long to wait for the tower each time around the loop during a turn
+#define kTowerWait 5
+// how often to check for a stop when there's nothing going on
+#define kIdlePoll 1000
+
+#define kBufferSize 512
+
+/*
+ * How urgent a message is, most urgent first: stopping the brick, then
+ * the messages of interactive use, then the ones of downloads, which
+ * may wait.
+ */
+enum Priority
+{
+    kStopPriority = 0,
+    kInteractivePriority,
+    kBulkPriority
+};
+
+
+struct Client
+{
+    int             fSocket;
+    int             fTower;
+    vector<UByte>   fPending;   // received but not yet sent to the tower
+    unsigned long   fTicket;    // place in line for the tower
+};
+
+
+struct Tower
+{
+    string          fName;
+    RCX_Pipe*       fPipe;
+    int             fListen;
+    Client*         fOwner;
+    long            fLast;      // last time anything went through
+    long            fWritten;   // when the owner's last message went out
+    bool            fReplied;   // the brick has answered since then
+    bool            fBorrowed;  // the owner went ahead of a download
+    vector<UByte>   fEcho;      // sent bytes that a serial tower will echo
+};
+
+
+static volatile sig_atomic_t sStop = 0;
+
+static void Stop(int /* sig */)
+{
+    sStop = 1;
+}
+
+
+static long Now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+
+/*
+ * Make the pipe the way RCX_Link::Open() would for the port name.
+ */
+static RCX_Pipe *NewPipe(const char *portName, const char *&devName)
+{
+    if ((devName = CheckPrefix(portName, "usb")) != 0)
+        return RCX_NewUSBTowerPipe();
+
+    if ((devName = CheckPrefix(portName, "sim")) != 0)
+        return new RCX_SimPipe();
+
+    if ((devName = CheckPrefix(portName, "tcp")) != 0)
+        return RCX_NewTcpPipe();
+
+    devName = CheckPrefix(portName, "serial");
+    if (!devName) devName = portName;
+    return new RCX_SerialPipe();
+}
+
+
+/*
+ * Listen on the port for both IPv6 and IPv4 where the system allows,
+ * otherwise IPv4 alone.
+ */
+int TowerServer::Listen(int port)
+{
+    int one = 1;
+    int fd = socket(AF_INET6, SOCK_STREAM, 0);
+
+    if (fd >= 0) {
+        int zero = 0;
+        sockaddr_in6 addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin6_family = AF_INET6;
+        addr.sin6_addr = in6addr_any;
+        addr.sin6_port = htons((unsigned short)port);
+
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        setsockopt(fd, IPPROTO_IPV6, IPV6_V6ONLY, &zero, sizeof(zero));
+        if (bind(fd, (sockaddr *)&addr, sizeof(addr)) == 0 && listen(fd, 16) == 0)
+            return fd;
+        close(fd);
+    }
+
+    fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) return -1;
+
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons((unsigned short)port);
+
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    if (bind(fd, (sockaddr *)&addr, sizeof(addr)) < 0 || listen(fd, 16) < 0) {
+        close(fd);
+        return -2;
+    }
+    return fd;
+}
+
+
+static bool SendAll(int fd, const UByte *data, size_t length)
+{
+    while (length) {
+        ssize_t n = send(fd, data, length, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        data += n;
+        length -= n;
+    }
+    return true;
+}
+
+
+/*
+ * The priority of the message that data starts with.  The bit that
+ * tells repeated messages apart is left out of the opcode.
+ */
+static Priority GetPriority(const vector<UByte> &data)
+{
+    size_t i = 0;
+    if (data.size() >= 3 && data[0] == 0x55 && data[1] == 0xff && data[2] == 0x00)
+        i = 3;
+    if (i >= data.size()) return kInteractivePriority;
+
+    switch (data[i] & 0xf7) {
+        case kRCX_StopAllOp:
+        case kRCX_StopTaskOp:
+        case kRCX_OutputModeOp:
+        case rcxPowerOff:
+            return kStopPriority;
+        case kRCX_BeginTaskOp:
+        case kRCX_BeginSubOp:
+        case kRCX_DownloadOp:
+        case kRCX_BeginFirmwareOp:
+        case kRCX_UnlockOp:
+        case kRCX_DeleteFirmware:
+        case kRCX_DeleteTasksOp:
+        case kRCX_DeleteSubsOp:
+        case kRCX_DeleteTaskOp:
+        case kRCX_DeleteSubOp:
+        case kRCX_UploadDatalogOp:
+            return kBulkPriority;
+        default:
+            return kInteractivePriority;
+    }
+}
+
+
+/*
+ * The most urgent client waiting for the tower with something more
+ * urgent than limit, the one that has waited longest if there are
+ * several, or 0 if there's none.
+ */
+static Client *FindWaiting(const Tower &tower, int index, vector<Client*> &clients,
+    int limit)
+{
+    Client *next = 0;
+    int best = limit;
+
+    for (size_t i=0; i<clients.size(); ++i) {
+        Client *c = clients[i];
+        if (c == tower.fOwner || c->fTower != index || c->fSocket < 0 || c->fPending.empty()) continue;
+
+        int priority = GetPriority(c->fPending);
+        if (priority < best || (priority == best && next && c->fTicket < next->fTicket)) {
+            next = c;
+            best = priority;
+        }
+    }
+
+    return next;
+}
+
+
+static void GiveTurn(Tower &tower, Client *next, bool borrowed)
+{
+    // whatever the tower heard in between belongs to nobody
+    tower.fPipe->FlushRead(0);
+    tower.fEcho.clear();
+    tower.fOwner = next;
+    tower.fLast = Now();
+    tower.fWritten = tower.fLast;
+    tower.fReplied = true;
+    tower.fBorrowed = borrowed;
+}
+
+
+/*
+ * Give the tower to the most urgent client, if any.
+ */
+static void NextTurn(Tower &tower, int index, vector<Client*> &clients)
+{
+    Client *next = FindWaiting(tower, index, clients, kBulkPriority + 1);
+    if (next) GiveTurn(tower, next, false);
+}
+
+
+/*
+ * Between the messages of a download (when the brick has answered one
+ * and the next is waiting) a more urgent client goes first, for one
+ * turn that ends as soon as it has its answer.  Messages that aren't
+ * answered leave no gap, so a fast firmware download is never split.
+ */
+static void Interleave(Tower &tower, int index, vector<Client*> &clients)
+{
+    Client *owner = tower.fOwner;
+    if (owner->fPending.empty() || !tower.fReplied) return;
+
+    Client *next = FindWaiting(tower, index, clients, GetPriority(owner->fPending));
+    if (next) GiveTurn(tower, next, true);
+}
+
+
+/*
+ * True once the owner has nothing more to send and its last message
+ * has been answered (or can't be any more).
+ */
+static bool Answered(const Tower &tower)
+{
+    long now = Now();
+
+    if (!tower.fOwner->fPending.empty()) return false;
+    if (tower.fReplied) return now - tower.fLast > kReplyGap;
+    return now - tower.fWritten > kReplyWait;
+}
+
+
+/*
+ * Move one round of data between the tower and the client whose turn
+ * it is.  Returns false if the client went away.
+ */
+static bool Service(Tower &tower)
+{
+    Client *owner = tower.fOwner;
+    UByte buf[kBufferSize];
+
+    if (!owner->fPending.empty()) {
+        tower.fPipe->Write(&owner->fPending[0], (long)owner->fPending.size());
+        tower.fPipe->FlushWrite();
+        if (tower.fPipe->GetCapabilities() & RCX_Pipe::kTxEchoFlag) {
+            tower.fEcho.insert(tower.fEcho.end(), owner->fPending.begin(), owner->fPending.end());
+        }
+        owner->fPending.clear();
+        tower.fLast = Now();
+        tower.fWritten = tower.fLast;
+        tower.fReplied = false;
+    }
+
+    long n = tower.fPipe->Read(buf, kBufferSize, kTowerWait);
+    if (n <= 0) return true;
+    tower.fLast = Now();
+
+    // the client thinks it's talking to a tower that doesn't echo, so
+    // take out the echo of what it sent; once something else turns up
+    // the echo was lost and the rest is the reply
+    long skip = 0;
+    while (skip < n && !tower.fEcho.empty() && tower.fEcho[0] == buf[skip]) {
+        tower.fEcho.erase(tower.fEcho.begin());
+        ++skip;
+    }
+    if (skip < n) {
+        tower.fEcho.clear();
+        tower.fReplied = true;
+    }
+
+    return SendAll(owner->fSocket, buf + skip, n - skip);
+}
+
+
+static void Drop(Client *c, vector<Tower> &towers)
+{
+    if (towers[c->fTower].fOwner == c) towers[c->fTower].fOwner = 0;
+    close(c->fSocket);
+    c->fSocket = -1;
+}
+
+
+static void Accept(Tower &tower, int index, vector<Client*> &clients)
+{
+    int fd = accept(tower.fListen, 0, 0);
+    if (fd < 0) return;
+
+    int one = 1;
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+    Client *c = new Client;
+    c->fSocket = fd;
+    c->fTower = index;
+    c->fTicket = 0;
+    clients.push_back(c);
+}
+
+
+static RCX_Result Run(vector<Tower> &towers)
+{
+    vector<Client*> clients;
+    vector<pollfd> fds;
+    unsigned long ticket = 0;
+    size_t i;
+
+    while (!sStop) {
+        bool busy = false;
+
+        fds.resize(0);
+        for (i=0; i<towers.size(); ++i) {
+            pollfd p = { towers[i].fListen, POLLIN, 0 };
+            fds.push_back(p);
+            if (towers[i].fOwner) busy = true;
+        }
+        for (i=0; i<clients.size(); ++i) {
+            pollfd p = { clients[i]->fSocket, POLLIN, 0 };
+            fds.push_back(p);
+        }
+
+        // during a turn the wait is for the tower instead
+        if (poll(&fds[0], fds.size(), busy ? 0 : kIdlePoll) < 0 && errno != EINTR)
+            break;
+
+        for (i=0; i<towers.size(); ++i) {
+            if (fds[i].revents & POLLIN)
+                Accept(towers[i], (int)i, clients);
+        }
+
+        for (i=0; i<clients.size() && towers.size() + i < fds.size(); ++i) {
+            Client *c = clients[i];
+            if (!(fds[towers.size() + i].revents & (POLLIN | POLLHUP | POLLERR))) continue;
+
+            UByte buf[kBufferSize];
+            ssize_t n = recv(c->fSocket, buf, sizeof(buf), 0);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) {
+                Drop(c, towers);
+                continue;
+            }
+
+            if (c->fPending.empty()) c->fTicket = ++ticket;
+            c->fPending.insert(c->fPending.end(), buf, buf + n);
+        }
+
+        for (i=0; i<towers.size(); ++i) {
+            Tower &t = towers[i];
+
+            if (!t.fOwner) NextTurn(t, (int)i, clients);
+            if (!t.fOwner) continue;
+
+            Interleave(t, (int)i, clients);
+
+            if (!Service(t)) {
+                Drop(t.fOwner, towers);
+            }
+            else if (Now() - t.fLast > kTurnHold || (t.fBorrowed && Answered(t))) {
+                t.fOwner = 0;
+            }
+        }
+
+        // forget the clients that went away
+        size_t kept = 0;
+        for (i=0; i<clients.size(); ++i) {
+            if (clients[i]->fSocket < 0)
+                delete clients[i];
+            else
+                clients[kept++] = clients[i];
+        }
+        clients.resize(kept);
+    }
+
+    for (i=0; i<clients.size(); ++i) {
+        close(clients[i]->fSocket);
+        delete clients[i];
+    }
+    return kRCX_OK;
+}
+
+
+RCX_Result TowerServer::Serve(int port, const vector<string> &towers)
+{
+    vector<Tower> list(towers.size());
+    RCX_Result result = kRCX_OK;
+
+    for (size_t i=0; i<towers.size(); ++i) {
+        Tower &t = list[i];
+        t.fName = towers[i];
+        t.fPipe = 0;
+        t.fListen = -1;
+        t.fOwner = 0;
+        t.fLast = 0;
+        t.fWritten = 0;
+        t.fReplied = true;
+        t.fBorrowed = false;
+    }
+
+    for (size_t i=0; i<list.size() && !RCX_ERROR(result); ++i) {
+        Tower &t = list[i];
+        const char *devName;
+
+        t.fPipe = NewPipe(t.fName.c_str(), devName);
+        if (!t.fPipe) {
+            result = kRCX_USBUnsupportedError;
+            break;
+        }
+
+        result = t.fPipe->Open(devName, RCX_Pipe::kNormalIrMode);
+        if (RCX_ERROR(result)) {
+            delete t.fPipe;
+            t.fPipe = 0;
+            break;
+        }
+
+        t.fListen = TowerServer::Listen(port + (int)i);
+        if (t.fListen < 0) {
+            result = (t.fListen == -1) ? kRCX_OpenSocketError : kRCX_BindPortError;
+            break;
+        }
+        fcntl(t.fListen, F_SETFD, FD_CLOEXEC);
+    }
+
+    if (!RCX_ERROR(result)) {
+        // not restarting poll() lets a signal end the loop
+        struct sigaction action, oldInt, oldTerm, oldPipe;
+        memset(&action, 0, sizeof(action));
+        action.sa_handler = Stop;
+        sigemptyset(&action.sa_mask);
+        sigaction(SIGINT, &action, &oldInt);
+        sigaction(SIGTERM, &action, &oldTerm);
+        action.sa_handler = SIG_IGN;
+        sigaction(SIGPIPE, &action, &oldPipe);
+
+        sStop = 0;
+        result = Run(list);
+
+        sigaction(SIGINT, &oldInt, 0);
+        sigaction(SIGTERM, &oldTerm, 0);
+        sigaction(SIGPIPE, &oldPipe, 0);
+    }
+
+    for (size_t i=0; i<list.size(); ++i) {
+        if (list[i].fListen >= 0) close(list[i].fListen);
+        if (list[i].fPipe) {
+            list[i].fPipe->Close();
+            delete list[i].fPipe;
+        }
+    }
+
+    return result;
+}
+
+#else
+
+RCX_Result TowerServer::Serve(int /* port */, const vector<string> & /* towers */)
+{
+    return kRCX_TcpUnsupportedError;
+}
+
+
+int TowerServer::Listen(int /* port */)
+{
+    return -1;
+}
+
+#endif
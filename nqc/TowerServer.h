@@ -0,0 +1,55 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __TowerServer_h
+#define __TowerServer_h
+
+#ifndef __RCX_Result_h
+#include "RCX_Result.h"
+#endif
+
+#include <vector>
+#include <string>
+
+/**
+ * Shares local towers with nqc's on other machines.  Each tower is
+ * served on its own TCP port and speaks the raw byte stream that the
+ * tcp: port expects, so "nqc -Stcp:host:port" works against it.
+ *
+ * Any number of clients may connect to a tower.  The tower is given to
+ * one client at a time, and it keeps it until neither it nor the tower
+ * has sent anything for a moment, so that the brick's replies go back
+ * to the client that asked.  The others wait their turn: the ones
+ * stopping the brick first, then the ones with interactive messages
+ * (reading values, remote commands, ...), then downloads, each in the
+ * order they asked.  A download doesn't hold up the others: whenever
+ * the brick has answered one of its messages, a client with something
+ * more urgent gets a turn for one exchange before the next one goes.
+ *
+ * Not supported on Windows or WebAssembly, where Serve() fails with
+ * kRCX_TcpUnsupportedError.
+ */
+class TowerServer
+{
+public:
+    /// Serve the towers (named as for -S) on ports port, port+1, ...
+    /// until SIGINT or SIGTERM.
+    static RCX_Result Serve(int port, const std::vector<std::string> &towers);
+
+    /// Listen on a TCP port, for IPv6 and IPv4 where the system allows.
+    /// Returns the socket, or -1 if there's no socket to be had and -2
+    /// if the port can't be bound.
+    static int Listen(int port);
+};
+
+#endif
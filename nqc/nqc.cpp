@@ -21,22 +21,49 @@
 #include <cstdlib>
 #include <ctime>
 #include <cerrno>
+#include <sys/stat.h>
+#include <vector>
+#include <map>
 
 #include "Program.h"
 #include "RCX_Image.h"
+#include "RCX_Asm.h"
+#include "RCX_Bundle.h"
+#include "RCX_Object.h"
+#include "RCX_Emulator.h"
+#include "RCX_EmulatorFleet.h"
+#include "RCX_Profile.h"
+#include "RCX_Firmware.h"
 #include "RCX_Link.h"
+#include "RCX_DownloadHistory.h"
+#include "RCX_TimeoutHistory.h"
+#include "RCX_BrickProfiles.h"
 #include "Symbol.h"
 #include "PreProc.h"
 #include "parser.h"
 #include "Macro.h"
 #include "RCX_Cmd.h"
 #include "RCX_Log.h"
+#include "RCX_LogStore.h"
+#include "RCX_Poller.h"
+#include "RCX_Channel.h"
+#include "RCX_LinkStats.h"
+#include "RCX_Trace.h"
+#include "LinkDaemon.h"
+#include "LinkMetrics.h"
+#include "FileWatcher.h"
+#include "TowerServer.h"
 #include "SRecord.h"
 #include "AutoFree.h"
 #include "DirList.h"
 #include "Buffer.h"
 #include "Error.h"
 #include "Compiler.h"
+#include "PrecompiledHeader.h"
+#include "CompileContext.h"
+#include "CompileCache.h"
+#include "EditorServer.h"
+#include "CompileStats.h"
 #include "CmdLine.h"
 #include "version.h"
 #include "PDebug.h"
@@ -46,13 +73,26 @@ using std::printf;
 using std::time_t;
 using std::localtime;
 using std::tm;
+using std::vector;
+using std::string;
+using std::map;
+
+#ifndef NO_THREADS
+#include <thread>
+#include <mutex>
+#endif
+
+#ifdef __wasm__
+#include <emscripten.h>
+#endif
 
 
 // use this to check for memory leaks in the compiler
 //#define CHECK_LEAKS
 
 // use these to debug the LEXER
-//#define TEST_LEXER    1   // test lexer only
+//#define TEST_LEXER    1   // test lexer only (batched, as the pre-processor reads it)
+//#define TEST_LEXER    3   // test lexer only (one yylex() call per token)
 //#define TEST_LEXER    2   // test lexer and pre-processor
 
 
@@ -76,48 +116,150 @@ FILE *gErrorStream = stderr;
 class AutoLink : public RCX_Link
 {
 public:
-    AutoLink() : fSerialPort(0), fOpen(false) {}
+    AutoLink() : fOpen(false), fProgressShown(0), fProgressLine(false) {}
     ~AutoLink() { Close(); }
 
     RCX_Result Open();
     void Close();
     RCX_Result Send(const RCX_Cmd *cmd, bool retry=true);
+    RCX_Result Send(const RCX_Cmd *const *cmds, int count, RCX_Result *results,
+        std::vector<UByte> *replies = 0, bool retry=true);
 
-    void SetSerialPort(const char *sp) { fSerialPort = sp; }
+    void SetSerialPort(const char *sp) { fSerialPort = sp ? sp : ""; }
+    const char *GetSerialPort() const { return fSerialPort.empty() ? 0 : fSerialPort.c_str(); }
+    bool IsOpen() const { return fOpen; }
 
     bool DownloadProgress(int soFar, int total, int chunkSize);
+    // finish the progress line, if one has been started
+    void EndProgress();
 
 private:
-    const char* fSerialPort;
+    // the progress line is rewritten at most this often (ms)
+    enum { kProgressInterval = 250 };
+
+    std::string fSerialPort;
     bool fOpen;
+    double fProgressShown;  // GetProgressTime() when the line was last written
+    bool fProgressLine;     // a line has been started and not ended
+    // what the link was opened with, a later request may want another
+    std::string fOpenPort;
+    RCX_TargetType fOpenTarget;
+};
+
+// the progress of a whole -fleet download, the average of its bricks'
+struct FleetProgress {
+    FleetProgress(int bricks) : fPercent(bricks, 0), fShown(0) {}
+
+    void Update(int brick, int percent);
+
+    vector<int> fPercent;   // of each brick
+    int fShown;             // percentage last reported
+#ifndef NO_THREADS
+    std::mutex fMutex;
+#endif
+};
+
+// one brick of a -fleet download; the progress of all of them is
+// reported together, a line at a time
+class FleetLink : public AutoLink
+{
+public:
+    FleetLink() : fName(0), fProgress(0), fIndex(0) {}
+
+    bool DownloadProgress(int soFar, int total, int chunkSize);
+
+    const char* fName;
+    FleetProgress* fProgress;   // 0 if it isn't reported
+    int fIndex;                 // in fProgress
 };
 #endif
 
+// the tokens of each source file of a compile for several targets
+// (by path), lexed once and played back for every target; a file
+// that didn't lex cleanly has none
+typedef map<string, vector<UByte> > TokenCache;
 
 class MyCompiler : public Compiler, public ErrorHandler
 {
 public:
-    MyCompiler() {}
+    MyCompiler() : fErrorStream(0), fTokens(0) {}
+
+    // the compiler for the current CompileContext
+    static MyCompiler* Get() { return static_cast<MyCompiler*>(Compiler::Get()); }
 
     Buffer *CreateBuffer(const char *name);
+    bool GetIncludePath(const char *name, string &path);
+    bool GetFileId(const char *name, string &id);
+    PrecompiledHeader *CreatePrecompiled(const char *name, const Buffer *source);
+
+    // tokens to play back instead of lexing the files again (0 = none)
+    void SetTokens(const TokenCache *tokens) { fTokens = tokens; }
+    PrecompiledHeader *OpenTokens(const string &path, const Buffer *source) const;
 
     void AddError(const Error &e, const LexLocation *loc);
+    void Flush();
+    void DiscardDiagnostics() { fDiagnostics.clear(); }
     void AddDir(const char *dirspec) { fDirs.Add(dirspec); }
+    void AddDirs(const DirList &dirs) { fDirs.Add(dirs); }
+    void ClearDirs() { fDirs.Clear(); }
+    void RevalidateDirs() { fDirs.Revalidate(); }
+    const DirList& GetDirs() const { return fDirs; }
+
+    // the files opened by #include since the last ClearIncludes(),
+    // and where each was found
+    const vector<const Buffer *>& GetIncludes() const { return fIncludes; }
+    const vector<string>& GetIncludePaths() const { return fIncludePaths; }
+    void ClearIncludes() { fIncludes.clear(); fIncludePaths.clear(); fFileIds.clear(); }
+
+    // diagnostics go to gErrorStream unless redirected
+    FILE* GetErrorStream() const { return fErrorStream ? fErrorStream : gErrorStream; }
+    void SetErrorStream(FILE *fp) { fErrorStream = fp; }
 
 private:
+    // a diagnostic, kept until Flush() writes them all at once
+    struct Diagnostic {
+        enum Kind { kError, kWarning, kTooMany };
+
+        Kind fKind;
+        int fCode;
+        string fMessage;
+        LexLocation fLoc;   // fIndex is kIllegalSrcIndex if there's none
+    };
+
+    void FormatText(const Diagnostic &d, string &out) const;
+    void FormatJSON(const Diagnostic &d, string &out) const;
+
     DirList fDirs;
+    FILE* fErrorStream;
+    const TokenCache *fTokens;
+    vector<const Buffer *> fIncludes;
+    vector<string> fIncludePaths;
+    map<string, string> fFileIds;   // GetFileId() of each name ("" = none)
+    vector<Diagnostic> fDiagnostics;
 } gMyCompiler;
 
 
 #define kMaxFirmware 65536
+#define kPollGiveUp 10
+#define kDatalogResumes 3
 #define kOldIncludePathEnv "NQCC_INCLUDE"
 #define kNewIncludePathEnv "NQC_INCLUDE"
 #define kOptionsEnv "NQC_OPTIONS"
+#define kDaemonEnv "NQC_DAEMON"
+#define kServerDone "#done"
+#define kServerQuit "quit"
+#define kMaxServerLine 4096
 #define kLowBattery 6600
 #define kLow45Battery 3300
 
 #define kRCXFileExtension ".rcx"
 #define kNQCFileExtension ".nqc"
+#define kLASMFileExtension ".lasm"
+#define kBundleFileExtension ".rcxb"
+#define kObjectFileExtension ".rco"
+#define kNQHFileExtension ".nqh"
+#define kNQPFileExtension ".nqp"
+#define kDepFileExtension ".d"
 
 
 // error codes in addition to RCX_Result codes
@@ -130,9 +272,51 @@ enum {
     kHelpCode = kFirstActionCode,
     kApiCode,
     kCompileStdinCode,
+    kPrecompileCode,
+    kFrontEndBenchCode,
+    kCacheCode,
+    kStatsCode,
+    kStatsJSONCode,
+    kMemoryLimitCode,
+    kSizeReportCode,
+    kListJSONCode,
+    kErrorsJSONCode,
+    kDepFileCode,
+    kDepFileNameCode,
+    kEmulateCode,
+    kProfileCode,
+    kSaveProfileCode,
+    kBricksCode,
+    kCheckOptCode,
+    kOptCode,
+    kUseProfileCode,
+    kBundleCode,
+    kBundleFirmwareCode,
+    kObjectCode,
+    kLinkCode,
 #ifndef __wasm__
+    kServerCode,
+    kDaemonCode,
+    kMetricsCode,
+    kTowerServerCode,
+    kEditorCode,
+    kDeltaCode,
+    kAdaptiveCode,
+    kFleetCode,
+    kBroadcastCode,
+    kMainFirstCode,
+    kVerifyCode,
+    kRepairCode,
+    kWatchFilesCode,
+    kLinkStatsCode,
+    kLinkTraceCode,
+    kTimeoutsCode,
+    kTimeoutPolicyCode,
+    kBrickProfilesCode,
     kDatalogCode,
     kDatalogFullCode,
+    kDatalogStoreCode,
+    kDatalogReadCode,
     kClearMemoryCode,
     kFirmwareCode,
     kFirmware4xCode,
@@ -148,6 +332,9 @@ enum {
     kRawCode,
     kRaw1Code,
     kRemoteCode,
+    kPollCode,
+    kPollBinCode,
+    kStreamCode,
 #endif
 };
 
@@ -157,9 +344,51 @@ static const char *sActionNames[] = {
     "help",
     "api",
     "",
+    "pch",
+    "frontend_bench",
+    "cache",
+    "stats",
+    "stats_json",
+    "memory_limit",
+    "size_report",
+    "list_json",
+    "errors_json",
+    "MD",
+    "MF",
+    "emulate",
+    "profile",
+    "save_profile",
+    "bricks",
+    "check_opt",
+    "opt",
+    "use_profile",
+    "bundle",
+    "bundle_firmware",
+    "object",
+    "link",
 #ifndef __wasm__
+    "server",
+    "daemon",
+    "metrics",
+    "towerserver",
+    "editor",
+    "delta",
+    "adaptive",
+    "fleet",
+    "broadcast",
+    "main_first",
+    "verify",
+    "repair",
+    "watch_files",
+    "link_stats",
+    "link_trace",
+    "timeouts",
+    "timeout_policy",
+    "brick_profiles",
     "datalog",
     "datalog_full",
+    "datalog_store",
+    "datalog_read",
     "clear",
     "firmware",
     "firmfast",
@@ -175,6 +404,9 @@ static const char *sActionNames[] = {
     "raw",
     "raw1",
     "remote",
+    "poll",
+    "pollbin",
+    "stream",
 #endif
 };
 
@@ -197,26 +429,127 @@ struct Request {
     bool fDownload;
     bool fBinary;
     bool fGenLASM;
+    bool fListJSON;     // listing as JSON (with source locations)
+    bool fDebugInfo;    // save source information in .rcx output
+    bool fObject;       // compile to an object file, for -link
+    const RCX_Target *fTarget;  // 0 = the -T target
+    int fEmulate;       // ms to run the program on the host (0 = don't)
+    bool fProfile;      // report where the emulated time went
+    const char *fSaveProfile;   // where to write the emulated line counts
+    int fBricks;        // bricks to emulate at once, passing messages (0 = 1)
+    int fCheckOpt;      // ms to emulate when checking the optimizer (0 = don't)
+    bool fDepFile;      // write the files the output depends on
+    const char *fDepFileName;   // where (0 = next to the output)
     int fFlags;
+    FILE *fListStream;  // listing destination if no fListFile (0 = stdout)
+    const vector<const char *> *fMacroArgs; // -D and -U options so far
+};
+
+// how to report compile stats
+enum StatsMode {
+    kNoStats = 0,
+    kTextStats,
+    kJSONStats
+};
+
+// one source file of a parallel (-j) compile, for one target
+struct BatchFile {
+    const char *fSourceFile;
+    RCX_TargetType fTargetType;
+    char *fOutputFile;  // 0 = the usual name
+    FILE *fErrors;      // diagnostics, reported once all files are done
+    FILE *fOutput;      // listing (if requested)
+    RCX_Result fResult;
+};
+
+struct Batch {
+    vector<BatchFile> fFiles;
+    vector<const char *> fMacroArgs;    // -D and -U options in order
+    Request fRequest;
+    const TokenCache *fTokens;  // 0 if the files weren't lexed ahead
+    size_t fNext;
+#ifndef NO_THREADS
+    std::mutex fMutex;
+#endif
+
+    BatchFile *Next();
+};
+
+#ifndef __wasm__
+// what one brick of a -fleet download (or datalog upload) gets
+struct FleetJob {
+    FleetLink fLink;
+    const RCX_Image *fImage;
+    const RCX_Bundle *fBundle;
+    RCX_Firmware *fFirmware;    // shared by all the bricks
+    bool fFast;
+    RCX_Log *fLog;              // the datalog is uploaded to this instead
+    RCX_Result fResult;
 };
+#endif
 
 static int GetActionCode(const char *arg);
+static bool IsLongOption(int code);
 static RCX_Result ProcessCommandLine(int argc, char **argv);
+static RCX_Result ProcessArgs(CmdLine &args);
+static void AddDefaultDirs();
 static void PrintError(RCX_Result error, const char *filename = 0);
 static void PrintUsage();
 static void DefineMacro(const char *text);
 static RCX_Result ProcessFile(const char *sourceFile,
     const Request &req);
+static RCX_Result ProcessBatch(const vector<const char *> &files,
+    const vector<const char *> &macroArgs, const Request &req, int jobs,
+    const vector<RCX_TargetType> &targets);
+static void RunBatch(Batch *batch);
+static void LexSources(const vector<const char *> &files, TokenCache &tokens);
+static void CopyStream(FILE *src, FILE *dst);
 static char *CreateFilename(const char *source, const char *oldExt,
     const char *newExt);
 static const char *LeafName(const char *filename);
 static int CheckExtension(const char *s1, const char *ext);
-static RCX_Image *Compile(const char *sourceFile,  int flags);
+static RCX_Image *Compile(const char *sourceFile, const RCX_Target *target, int flags);
+static const RCX_Target *RequestTarget(const Request &req);
+static void PrintErrorCount();
+static RCX_Image *LoadProgram(const char *file, const Request &req);
+static RCX_Image *Assemble(const char *file, const Request &req);
+static RCX_Result MakeBundle(const char *bundleFile, const char *firmware,
+    const vector<const char *> &files, const Request &req);
+static RCX_Result ProcessBundle(const char *bundleFile, const Request &req);
+static RCX_Result UseBundle(const RCX_Bundle &bundle, const Request &req);
+static RCX_Result MakeObject(const char *sourceFile, const Request &req);
+static RCX_Object *LoadObject(const char *file, const Request &req);
+static RCX_Result CheckOptimizer(const char *sourceFile, const Request &req);
+static bool CheckEmulated(RCX_TargetType type);
+static RCX_Image *CompileForCheck(const char *sourceFile, const Request &req, int flags);
+static bool FindEventLine(const RCX_Image &image, const RCX_Emulator::Event &e,
+    int &srcIndex, long &line, bool callSite);
+static void SplitTrace(const RCX_Emulator &emulator, const RCX_Image &image,
+    map<int, vector<RCX_Emulator::Event> > &tasks);
+static string DescribeEvent(const RCX_Image &image, const RCX_Emulator::Event *e);
+static bool SameEvent(const RCX_Image &image1, const RCX_Emulator::Event &e1,
+    const RCX_Image &image2, const RCX_Emulator::Event &e2, bool partial);
+static RCX_Result LinkObjects(const char *outputFile,
+    const vector<const char *> &files, const Request &req);
+static void LoadSources(const RCX_Image *image);
+static bool WriteImage(const RCX_Image *image, const char *outputFile);
+static bool WriteDepFile(const char *sourceFile, const char *outputFile,
+    const char *depFile);
+static void PrintDepName(FILE *fp, const char *name);
+static RCX_Image *FindCached(const char *sourceFile, const Request &req,
+    char *key);
+static void SetCacheDir(const char *dir);
+static RCX_Result UseProfile(const char *file);
+static void SetStatsMode(StatsMode mode);
+static void PrintStats(const char *sourceFile);
+static RCX_Result Precompile(const char *outputFile, const char *sourceFile);
+static RCX_Result BenchFrontEnd(const char *stage, const char *sourceFile, int flags);
 static bool GenerateListing(RCX_Image *image, const char *filename,
-    bool includeSource, bool generateLASM);
+    bool includeSource, bool generateLASM, bool json, FILE *stream = 0);
 static RCX_Result SetErrorFile(const char *filename);
 static RCX_Result RedirectOutput(const char *filename);
 static RCX_Result SetTarget(const char *name);
+static RCX_Result SetTargets(const char *names, vector<RCX_TargetType> &targets);
 #ifdef TEST_LEXER
 static void PrintToken(int t, TokenVal v);
 #endif
@@ -225,15 +558,42 @@ static bool SameString(const char *s1, const char *s2);
 static void PrintVersion();
 
 #ifndef __wasm__
+static RCX_Result RunServer();
+static RCX_Result WatchFile(const char *sourceFile, const Request &req);
+static RCX_Result RunRequest(CmdLine &args);
+static void SaveRequestState();
+static void RestoreRequestState();
+static RCX_Result RunDaemon(const char *path);
+static bool ForwardToDaemon(int argc, char **argv, int &exitCode);
+static void ReportMetrics(string &text);
 static RCX_Result Download(RCX_Image *image);
+static RCX_Result Download(const RCX_Bundle &bundle);
 static RCX_Result UploadDatalog(bool verbose);
+static RCX_Result FetchDatalog(RCX_Link *link, RCX_Log &log);
+static RCX_Result OutputDatalog(const char *port, const RCX_Log &log, bool verbose);
+static RCX_Result ReadDatalogStore(const char *file);
+static RCX_Firmware *LoadFirmware(const char *filename, char *key);
 static RCX_Result DownloadFirmware(const char *filename, bool fast);
+static RCX_Result FleetDownload(const RCX_Image *image, const RCX_Bundle *bundle,
+    RCX_Firmware *firmware, bool fast);
+static RCX_Result FleetDatalog(bool verbose);
+static FleetJob *NewFleetJob(const string &port);
+static void RunFleetJobs(const vector<FleetJob *> &jobs);
+static void RunFleetJob(FleetJob *job);
 static RCX_Result GetVersion();
 static RCX_Result GetBatteryLevel();
 static RCX_Result SetWatch(const char *timeSpec);
 static RCX_Result SendRawCommand(const char *text, bool retry);
 static RCX_Result ClearMemory();
+static RCX_Result SendMessage(int message);
 static RCX_Result SendRemote(const char *event, int repeat);
+static RCX_Result PollValues(const char *sources, int rounds, bool binary);
+static RCX_Result StreamValues(FILE *fp);
+static void UseLinkStats();
+static void UseProfileTarget();
+static void PrintLinkStats();
+static void UseLinkTrace();
+static void PrintLinkTrace(FILE *fp, RCX_Result result);
 
 AutoLink gLink;
 #endif
@@ -243,15 +603,71 @@ RCX_TargetType gTargetType = kRCX_RCX2Target;
 bool gVerbose = false;
 int gTimeout = 0;
 bool gQuiet = false;
+bool gServerMode = false;
+bool gDaemonMode = false;
+#ifndef __wasm__
+// the daemon's metrics port (0 for none) and what it reports there
+int gMetricsPort = 0;
+LinkMetrics *gMetrics = 0;
+// what each server or daemon request starts from: the settings given
+// before -server or -daemon (see SaveRequestState())
+struct {
+    RCX_TargetType fTargetType;
+    FILE *fErrorStream;
+    int fTimeout;
+    bool fVerifyDownload;
+    bool fRepairDownload;
+    vector<string> fFleet;
+    const char *fDatalogStore;
+    RCX_DownloadHistory *fDownloadHistory;
+    RCX_TimeoutHistory *fTimeoutHistory;
+    RCX_BrickProfiles *fBrickProfiles;
+    RCX_LinkStats *fLinkStats;
+    RCX_Trace *fLinkTrace;
+    // chunk sizes, wait time, header, broadcast and timeout policy
+    RCX_Link fLink;
+} gRequestState;
+#endif
+CompileCache *gCompileCache = 0;
+// line counts that compiles lay out their branches for (-use_profile)
+RCX_Profile *gProfile = 0;
+// firmware prepared during this run, by key
+map<string, RCX_Firmware*> gFirmware;
+#ifndef __wasm__
+RCX_DownloadHistory *gDownloadHistory = 0;
+RCX_TimeoutHistory *gTimeoutHistory = 0;
+RCX_BrickProfiles *gBrickProfiles = 0;
+// -T was given, so the target doesn't come from a brick profile
+bool gTargetGiven = false;
+// the ports of a -fleet, downloads go to all of them
+vector<string> gFleet;
+// where uploaded datalogs are added instead of being printed (0 = print)
+const char *gDatalogStore = 0;
+// check for the program before downloading it
+bool gVerifyDownload = false;
+// read the program back and only send the tasks and subs that differ
+bool gRepairDownload = false;
+// packet timings, printed when the link is closed
+RCX_LinkStats *gLinkStats = 0;
+// what the link did, printed if it fails
+RCX_Trace *gLinkTrace = 0;
+#endif
+StatsMode gStatsMode = kNoStats;
+// diagnostics as JSON lines rather than text
+bool gErrorsJSON = false;
 
 
 int main(int argc, char **argv)
 {
     RCX_Result result;
 
+#ifndef __wasm__
+    int exitCode;
+    if (ForwardToDaemon(argc, argv, exitCode)) return exitCode;
+#endif
+
     // add any default include paths
-    gMyCompiler.AddDir(getenv(kOldIncludePathEnv));
-    gMyCompiler.AddDir(getenv(kNewIncludePathEnv));
+    AddDefaultDirs();
 
     // TODO: make this return a struct instead so we can pass back the
     // result code and a context specific extra error condition.
@@ -260,6 +676,8 @@ int main(int argc, char **argv)
 
 #ifndef __wasm__
     gLink.Close();
+    PrintLinkStats();
+    PrintLinkTrace(stderr, result);
 #endif
 
     if (gErrorStream != stderr && gErrorStream != stdout) {
@@ -275,14 +693,16 @@ int main(int argc, char **argv)
 }
 
 
+void AddDefaultDirs()
+{
+    gMyCompiler.AddDir(getenv(kOldIncludePathEnv));
+    gMyCompiler.AddDir(getenv(kNewIncludePathEnv));
+}
+
+
 RCX_Result ProcessCommandLine(int argc, char ** argv)
 {
-    bool optionsOK = true;
-    bool fileProcessed = false;
-    Request req = { 0 };    // rest will be zero'ed
     CmdLine args;
-    RCX_Result result = kRCX_OK;
-    RCX_Cmd cmd;
 
     // first add environment options
     args.Parse(getenv(kOptionsEnv));
@@ -300,6 +720,28 @@ RCX_Result ProcessCommandLine(int argc, char ** argv)
     }
 #endif
 
+    return ProcessArgs(args);
+}
+
+
+RCX_Result ProcessArgs(CmdLine &args)
+{
+    bool optionsOK = true;
+    bool fileProcessed = false;
+    Request req = { 0 };    // rest will be zero'ed
+    RCX_Result result = kRCX_OK;
+    RCX_Cmd cmd;
+    int jobs = 0;
+    const char *bundleFile = 0;
+    const char *bundleFirmware = 0;
+    const char *linkFile = 0;
+    vector<const char *> files;
+    vector<const char *> macroArgs;
+    vector<RCX_TargetType> targets;     // if more than one for -T
+    bool watch = false;
+
+    req.fMacroArgs = &macroArgs;
+
     // Process the args.
     while(args.Remain() && !RCX_ERROR(result)) {
         const char* a=args.Next();
@@ -316,10 +758,11 @@ RCX_Result ProcessCommandLine(int argc, char ** argv)
             // also find.
             int code = GetActionCode(a+1);
 
-            if (code) {
+            // a few long names are options rather than actions
+            if (code && !IsLongOption(code)) {
                 optionsOK = false;
             }
-            else {
+            else if (!code) {
                 if (!optionsOK) return kUsageError;
                 code = a[1];
             }
@@ -335,12 +778,131 @@ RCX_Result ProcessCommandLine(int argc, char ** argv)
 
                 // compilation options
                 case kCompileStdinCode:
+                    // stdin carries the requests in server mode
+                    if (gServerMode) return kUsageError;
                     result = ProcessFile(nil, req);
                     fileProcessed = true;
                     break;
+                case kPrecompileCode:
+                    if (args.Remain() < 2) return kUsageError;
+                    {
+                        const char *outputFile = args.Next();
+                        result = Precompile(outputFile, args.Next());
+                    }
+                    break;
+                case kFrontEndBenchCode:
+                    if (args.Remain() < 2) return kUsageError;
+                    {
+                        const char *stage = args.Next();
+                        result = BenchFrontEnd(stage, args.Next(), req.fFlags);
+                    }
+                    break;
+                case kCacheCode:
+                    if (!args.Remain()) return kUsageError;
+                    SetCacheDir(args.Next());
+                    break;
+                case kBundleCode:
+                    if (!args.Remain()) return kUsageError;
+                    bundleFile = args.Next();
+                    break;
+                case kBundleFirmwareCode:
+                    if (!args.Remain()) return kUsageError;
+                    bundleFirmware = args.Next();
+                    break;
+                case kObjectCode:
+                    req.fObject = true;
+                    break;
+                case kLinkCode:
+                    if (!args.Remain()) return kUsageError;
+                    linkFile = args.Next();
+                    break;
+                case kStatsCode:
+                    SetStatsMode(kTextStats);
+                    break;
+                case kStatsJSONCode:
+                    SetStatsMode(kJSONStats);
+                    break;
+                case kMemoryLimitCode:
+                    if (!args.Remain()) return kUsageError;
+                    CompileStats::SetMemoryLimit(args.NextInt() * 1024L);
+                    if (CompileStats::GetMemoryLimit() <= 0) return kUsageError;
+                    break;
+                case kSizeReportCode:
+                    req.fFlags |= Compiler::kSizeReport_Flag;
+                    break;
+                case kListJSONCode:
+                    req.fListJSON = true;
+                    break;
+                case kErrorsJSONCode:
+                    gErrorsJSON = true;
+                    break;
+                case kDepFileCode:
+                    req.fDepFile = true;
+                    break;
+                case kDepFileNameCode:
+                    if (!args.Remain()) return kUsageError;
+                    req.fDepFile = true;
+                    req.fDepFileName = args.Next();
+                    break;
+                case kEmulateCode:
+                    if (!args.Remain()) return kUsageError;
+                    req.fEmulate = args.NextInt();
+                    if (req.fEmulate <= 0) return kUsageError;
+                    break;
+                case kProfileCode:
+                    if (!args.Remain()) return kUsageError;
+                    req.fEmulate = args.NextInt();
+                    if (req.fEmulate <= 0) return kUsageError;
+                    req.fProfile = true;
+                    break;
+                case kSaveProfileCode:
+                    if (!args.Remain()) return kUsageError;
+                    req.fSaveProfile = args.Next();
+                    break;
+                case kBricksCode:
+                    if (!args.Remain()) return kUsageError;
+                    req.fBricks = args.NextInt();
+                    if (req.fBricks <= 0) return kUsageError;
+                    break;
+                case kCheckOptCode:
+                    if (!args.Remain()) return kUsageError;
+                    req.fCheckOpt = args.NextInt();
+                    if (req.fCheckOpt <= 0) return kUsageError;
+                    break;
+                case kOptCode:
+                    if (!args.Remain()) return kUsageError;
+                    {
+                        // -O<outfile> already names the output file, so
+                        // the level is a separate option
+                        const char *level = args.Next();
+                        int flag;
+
+                        if (strcmp(level, "0")==0)
+                            flag = 0;
+                        else if (strcmp(level, "1")==0)
+                            flag = Compiler::kOptimize1_Flag;
+                        else if (strcmp(level, "2")==0)
+                            flag = Compiler::kOptimize2_Flag;
+                        else if (strcmp(level, "s")==0)
+                            flag = Compiler::kOptimizeSize_Flag;
+                        else
+                            return kUsageError;
+
+                        req.fFlags &= ~(Compiler::kOptimize1_Flag | Compiler::kOptimize2_Flag |
+                            Compiler::kOptimizeSize_Flag);
+                        req.fFlags |= flag;
+                    }
+                    break;
+                case kUseProfileCode:
+                    if (!args.Remain()) return kUsageError;
+                    result = UseProfile(args.Next());
+                    break;
                 case 'T':
-                    if  (*(a+2)=='\0') return kUsageError;
-                    result = SetTarget(a+2);
+                    if (*(a+2)=='\0' && !args.Remain()) return kUsageError;
+                    result = SetTargets(*(a+2) ? a+2 : args.Next(), targets);
+#ifndef __wasm__
+                    gTargetGiven = true;
+#endif
                     break;
                 case 'n':
                     req.fFlags |= Compiler::kNoSysFile_Flag;
@@ -348,10 +910,17 @@ RCX_Result ProcessCommandLine(int argc, char ** argv)
                 case 'D':
                     if  (*(a+2)=='\0') return kUsageError;
                     DefineMacro(a+2);
+                    macroArgs.push_back(a);
                     break;
                 case 'U':
                     if  (*(a+2)=='\0') return kUsageError;
                     Compiler::Get()->Undefine(a+2);
+                    macroArgs.push_back(a);
+                    break;
+                case 'j':
+                    if (*(a+2)=='\0' && !args.Remain()) return kUsageError;
+                    jobs = *(a+2) ? atoi(a+2) : args.NextInt();
+                    if (jobs < 1) return kUsageError;
                     break;
                 case 'E':
                     result = SetErrorFile(a+2);
@@ -373,11 +942,17 @@ RCX_Result ProcessCommandLine(int argc, char ** argv)
                 case 's':
                     req.fSourceListing = true;
                     break;
+                case 'g':
+                    req.fDebugInfo = true;
+                    break;
                 case 'c':
                     req.fGenLASM = true;
                     break;
                 case 'v':
                     gVerbose = true;
+#ifndef __wasm__
+                    UseLinkStats();
+#endif
                     break;
                 case 'q':
                     gQuiet = true;
@@ -394,6 +969,124 @@ RCX_Result ProcessCommandLine(int argc, char ** argv)
                     req.fBinary = true;
                     break;
 
+                case kServerCode:
+                    if (gServerMode || gDaemonMode) return kUsageError;
+                    result = RunServer();
+                    break;
+                case kDaemonCode:
+                    if (gServerMode || gDaemonMode || !args.Remain())
+                        return kUsageError;
+                    result = RunDaemon(args.Next());
+                    break;
+                case kMetricsCode:
+                    // it's for the -daemon that follows
+                    if (gServerMode || gDaemonMode || !args.Remain())
+                        return kUsageError;
+                    gMetricsPort = args.NextInt();
+                    if (gMetricsPort <= 0) return kUsageError;
+                    break;
+                case kTowerServerCode:
+                    if (gServerMode || gDaemonMode || args.Remain() < 2)
+                        return kUsageError;
+                    {
+                        // the rest of the line is the towers
+                        int port = args.NextInt();
+                        vector<string> towers;
+                        if (port <= 0) return kUsageError;
+                        while (args.Remain()) towers.push_back(args.Next());
+                        result = TowerServer::Serve(port, towers);
+                    }
+                    break;
+                case kEditorCode:
+                    if (gServerMode || gDaemonMode) return kUsageError;
+                    {
+                        // stdin carries the commands
+                        EditorServer server(MyCompiler::Get()->GetDirs(), getTarget(gTargetType),
+                            req.fFlags | Compiler::kNoSourceTags_Flag);
+                        server.Serve(stdin, stdout);
+                    }
+                    break;
+                case kDeltaCode:
+                    if (!args.Remain()) return kUsageError;
+                    // the one given before -server stays for later requests
+                    if (gDownloadHistory != gRequestState.fDownloadHistory) delete gDownloadHistory;
+                    gDownloadHistory = new RCX_DownloadHistory(args.Next());
+                    gLink.SetDownloadHistory(gDownloadHistory);
+                    break;
+                case kAdaptiveCode:
+                    gLink.SetAdaptiveChunkSize(true);
+                    break;
+                case kFleetCode:
+                    if (!args.Remain()) return kUsageError;
+                    {
+                        const char *ports = args.Next();
+                        gFleet.clear();
+                        while(*ports) {
+                            size_t n = strcspn(ports, " \t");
+                            if (n) gFleet.push_back(string(ports, n));
+                            ports += n;
+                            if (*ports) ports++;
+                        }
+                    }
+                    break;
+
+                case kBroadcastCode:
+                    if (!args.Remain()) return kUsageError;
+                    gLink.SetBroadcast(args.NextInt());
+                    break;
+                case kMainFirstCode:
+                    req.fFlags |= Compiler::kMainFirst_Flag;
+                    gLink.SetStartMain(true);
+                    break;
+                case kVerifyCode:
+                    gVerifyDownload = true;
+                    break;
+                case kRepairCode:
+                    gRepairDownload = true;
+                    break;
+                case kWatchFilesCode:
+                    // a server's requests don't get to block it
+                    if (gServerMode || gDaemonMode) return kUsageError;
+                    watch = true;
+                    break;
+                case kLinkStatsCode:
+                    UseLinkStats();
+                    break;
+                case kLinkTraceCode:
+                    UseLinkTrace();
+                    break;
+                case kDatalogStoreCode:
+                    if (!args.Remain()) return kUsageError;
+                    gDatalogStore = args.Next();
+                    break;
+                case kTimeoutsCode:
+                    if (!args.Remain()) return kUsageError;
+                    if (gTimeoutHistory != gRequestState.fTimeoutHistory) delete gTimeoutHistory;
+                    gTimeoutHistory = new RCX_TimeoutHistory(args.Next());
+                    gLink.SetTimeoutHistory(gTimeoutHistory);
+                    break;
+                case kBrickProfilesCode:
+                    if (!args.Remain()) return kUsageError;
+                    if (gBrickProfiles != gRequestState.fBrickProfiles) delete gBrickProfiles;
+                    gBrickProfiles = new RCX_BrickProfiles(args.Next());
+                    gLink.SetBrickProfiles(gBrickProfiles);
+                    UseProfileTarget();
+                    break;
+                case kTimeoutPolicyCode:
+                    if (!args.Remain()) return kUsageError;
+                    {
+                        const char *policy = args.Next();
+                        if (strcmp(policy, "aimd") == 0)
+                            gLink.SetTimeoutPolicy(RCX_Transport::kAdaptiveTimeout);
+                        else if (strcmp(policy, "ewma") == 0)
+                            gLink.SetTimeoutPolicy(RCX_Transport::kAverageTimeout);
+                        else if (strcmp(policy, "fixed") == 0)
+                            gLink.SetTimeoutPolicy(RCX_Transport::kFixedTimeout);
+                        else
+                            return kUsageError;
+                    }
+                    break;
+
                 // communication options
                 case 'd':
                     req.fDownload = true;
@@ -412,6 +1105,7 @@ RCX_Result ProcessCommandLine(int argc, char ** argv)
                 case 'S':
                     if  (*(a+2)=='\0') return kUsageError;
                     gLink.SetSerialPort(a+2);
+                    UseProfileTarget();
                     break;
                 case 't':     // This timeout option is not currently listed in the help output
                     if (!args.Remain()) return kUsageError;
@@ -425,6 +1119,10 @@ RCX_Result ProcessCommandLine(int argc, char ** argv)
                 case kDatalogFullCode:
                     result = UploadDatalog(true);
                     break;
+                case kDatalogReadCode:
+                    if (!args.Remain()) return kUsageError;
+                    result = ReadDatalogStore(args.Next());
+                    break;
                 case kClearMemoryCode:
                     result = ClearMemory();
                     break;
@@ -463,13 +1161,11 @@ RCX_Result ProcessCommandLine(int argc, char ** argv)
                     break;
                 case kProgramCode:
                     if (!args.Remain()) return kUsageError;
-                    result = gLink.Send(cmd.Set(kRCX_SelectProgramOp,
-                        (UByte)(args.NextInt()-1)));
+                    result = gLink.SelectProgram(args.NextInt()-1);
                     break;
                 case kMessageCode:
                     if (!args.Remain()) return kUsageError;
-                    result = gLink.Send(cmd.Set(kRCX_Message,
-                        (UByte)(args.NextInt())), false);
+                    result = SendMessage(args.NextInt());
                     break;
                 case kRawCode:
                 case kRaw1Code: // one-time send, no retry
@@ -484,13 +1180,35 @@ RCX_Result ProcessCommandLine(int argc, char ** argv)
                         result = SendRemote(event, repeat);
                     }
                     break;
+                case kPollCode:
+                case kPollBinCode:
+                    if (args.Remain() < 2) return kUsageError;
+                    {
+                        const char *sources = args.Next();
+                        int rounds = args.NextInt();
+                        result = PollValues(sources, rounds, code == kPollBinCode);
+                    }
+                    break;
+                case kStreamCode:
+                    result = StreamValues(stdin);
+                    break;
 #endif
                 default:
                     return kUsageError;
             }
         }
+        else if (jobs || bundleFile || linkFile || targets.size() > 1) {
+            // files are compiled together once all args are read
+            files.push_back(a);
+            optionsOK = false;
+        }
         else if (!fileProcessed) {
             // Not an option, so must be a file.
+#ifndef __wasm__
+            if (watch)
+                result = WatchFile(a, req);
+            else
+#endif
             result = ProcessFile(a, req);
 
 #ifdef CHECK_LEAKS
@@ -513,6 +1231,24 @@ RCX_Result ProcessCommandLine(int argc, char ** argv)
         return kUsageError;
     }
 
+    if ((linkFile || bundleFile) && targets.size() > 1)
+        return kUsageError;
+
+    if (linkFile) {
+        if (jobs || bundleFile || bundleFirmware || req.fObject || files.empty()) return kUsageError;
+        if (!RCX_ERROR(result))
+            result = LinkObjects(linkFile, files, req);
+    }
+    else if (bundleFile) {
+        if (jobs || (files.empty() && !bundleFirmware)) return kUsageError;
+        if (!RCX_ERROR(result))
+            result = MakeBundle(bundleFile, bundleFirmware, files, req);
+    }
+    else if (bundleFirmware)
+        return kUsageError;
+    else if (!files.empty() && !RCX_ERROR(result))
+        result = ProcessBatch(files, macroArgs, req, jobs, targets);
+
     return result;
 }
 
@@ -543,66 +1279,225 @@ RCX_Result SetTarget(const char *name)
     return kUsageError;
 }
 
+
+/**
+ * Set the targets for -T, which may name several separated by commas.
+ * The first becomes the target for everything else.
+ *
+ * @param names the target names
+ * @param targets set to the targets if there's more than one,
+ *  otherwise cleared
+ * @return kRCX_OK, or kUsageError if a name isn't a target
+ */
+RCX_Result SetTargets(const char *names, vector<RCX_TargetType> &targets)
+{
+    vector<RCX_TargetType> found;
+
+    while(1) {
+        size_t n = strcspn(names, ",");
+        string name(names, n);
+
+        if (RCX_ERROR(SetTarget(name.c_str()))) return kUsageError;
+        found.push_back(gTargetType);
+
+        if (!names[n]) break;
+        names += n+1;
+    }
+
+    gTargetType = found[0];
+    targets.clear();
+    if (found.size() > 1)
+        targets = found;
+
+    return kRCX_OK;
+}
+
+
+/**
+ * @return the target that req compiles for
+ */
+const RCX_Target *RequestTarget(const Request &req)
+{
+    return req.fTarget ? req.fTarget : getTarget(gTargetType);
+}
+
 RCX_Result ProcessFile(const char *sourceFile, const Request &req)
 {
     RCX_Image *image;
     RCX_Result result = kRCX_OK;
     bool ok = true;
     bool compiled = false;
+    bool assembled = false;
+    bool loadedSources = false;
 
-    if (sourceFile && (req.fBinary || CheckExtension(sourceFile, kRCXFileExtension))) {
-        // load RCX image file
+    if (sourceFile && !req.fBinary && CheckExtension(sourceFile, kBundleFileExtension))
+        return ProcessBundle(sourceFile, req);
+
+    if (req.fObject)
+        return MakeObject(sourceFile, req);
+
+    if ((req.fEmulate || req.fCheckOpt) && !CheckEmulated(RequestTarget(req)->fType))
+        return kQuietError;
+
+    if (req.fCheckOpt)
+        return CheckOptimizer(sourceFile, req);
+
+    if (req.fSaveProfile && !req.fEmulate)
+        return kUsageError;
+
+    // a profile is of one brick
+    if (req.fBricks > 1 && (req.fProfile || req.fSaveProfile))
+        return kUsageError;
+
+    bool binary = req.fBinary || (sourceFile && CheckExtension(sourceFile, kRCXFileExtension));
+
+    if (binary) {
+        // load RCX image file (-b - reads it from stdin)
         image = new RCX_Image();
-        result = image->Read(sourceFile);
+        result = sourceFile ? image->Read(sourceFile) : image->Read(stdin);
         if (RCX_ERROR(result)) {
-            PrintError(result, sourceFile);
+            PrintError(result, sourceFile ? sourceFile : "<stdin>");
+            delete image;
+            return kQuietError;
+        }
+
+        if (req.fEmulate && !CheckEmulated(image->GetTargetType())) {
             delete image;
             return kQuietError;
         }
+
+        // an image saved with -g names its source files
+        if (req.fListing && (req.fSourceListing || req.fListJSON) && image->HasSourceInfo()) {
+            LoadSources(image);
+            loadedSources = true;
+        }
+    } else if (sourceFile && CheckExtension(sourceFile, kLASMFileExtension)) {
+        // hand written LASM skips the compiler altogether
+        image = Assemble(sourceFile, req);
+        if (!image) return kQuietError;
+        assembled = true;
     } else {
-        // compile file
-        compiled = true;
-        image = Compile(sourceFile, req.fFlags);
+        // include files may have been added or removed since the
+        // last compile
+        MyCompiler::Get()->RevalidateDirs();
+
+        // compile file (unless the cache has an up to date image)
+        char key[CompileCache::kKeyLength+1];
+        image = FindCached(sourceFile, req, key);
 
         if (!image) {
-            int errors = ErrorHandler::Get()->GetErrorCount();
+            compiled = true;
+            MyCompiler::Get()->ClearIncludes();
+
+            // source tags are only kept for a source listing, a profile
+            // or an image saved with -g
+            bool tags = (req.fListing && (req.fSourceListing || req.fListJSON)) ||
+                req.fDebugInfo || req.fProfile || req.fSaveProfile;
+            image = Compile(sourceFile, RequestTarget(req),
+                req.fFlags | (tags ? 0 : Compiler::kNoSourceTags_Flag));
+
+            if (!image) {
+                PrintErrorCount();
+                return kQuietError;
+            }
 
-            if (errors)
-                fprintf(gErrorStream, "# %d error%s during compilation\n", errors, errors==1 ? "" : "s");
-            return kQuietError;
+            // only clean compiles are cached, so that a cached image
+            // never hides a warning
+            if (*key && ErrorHandler::Get()->GetWarningCount() == 0)
+                gCompileCache->Store(key, image, MyCompiler::Get()->GetIncludes());
+        }
+
+        if (req.fDebugInfo)
+            image->SetSourceInfo(Compiler::Get());
+
+        if (req.fFlags & Compiler::kOptimizeSize_Flag) {
+            FILE *fp = MyCompiler::Get()->GetErrorStream();
+            fprintf(fp, "# Sizes for %s\n", sourceFile ? sourceFile : "<stdin>");
+            image->PrintSizes(fp);
+        }
+
+        if (compiled && (req.fFlags & Compiler::kSizeReport_Flag)) {
+            FILE *fp = MyCompiler::Get()->GetErrorStream();
+            fprintf(fp, "# Size report for %s\n", sourceFile ? sourceFile : "<stdin>");
+            MyCompiler::Get()->PrintSizeReport(fp);
         }
+    }
 
+    if (!binary) {
         const char *outputFile = req.fOutputFile;
         char *newFilename = 0;
 
-        if (!req.fDownload && !req.fListing && !req.fOutputFile && sourceFile) {
+        if (!req.fDownload && !req.fListing && !req.fEmulate && !req.fOutputFile && sourceFile) {
             outputFile =
             newFilename = 
                 CreateFilename(LeafName(sourceFile),
-                    kNQCFileExtension, kRCXFileExtension);
+                    assembled ? kLASMFileExtension : kNQCFileExtension, kRCXFileExtension);
         }
 
         if (outputFile) {
             errno = 0;
-            if (!image->Write(outputFile)) {
-                fprintf(gErrorStream, "Error: could not create output file \"%s\" (%d)\n", outputFile, errno);
+            if (!WriteImage(image, outputFile)) {
+                fprintf(MyCompiler::Get()->GetErrorStream(), "Error: could not create output file \"%s\" (%d)\n", outputFile, errno);
                 ok = false;
             }
         }
 
+        if (req.fDepFile && sourceFile && !assembled &&
+            !WriteDepFile(sourceFile, outputFile, req.fDepFileName))
+            ok = false;
+
         if (newFilename)
             delete [] newFilename;
     }
 
     // generate the listing
     if (req.fListing) {
-        if (!GenerateListing(image, req.fListFile, compiled && req.fSourceListing, req.fGenLASM))
+        if (!GenerateListing(image, req.fListFile, (compiled || loadedSources) && (req.fSourceListing || req.fListJSON),
+                req.fGenLASM, req.fListJSON, req.fListStream))
+            ok = false;
+    }
+
+    if (req.fEmulate && req.fBricks > 1) {
+        RCX_EmulatorFleet fleet;
+
+        fleet.Add(*image, req.fBricks);
+        fleet.Start();
+        fleet.Run(req.fEmulate);
+        fleet.PrintState(stdout, image);
+        for(int i=0; i<fleet.GetBrickCount(); ++i)
+            if (!fleet.GetBrick(i).GetErrors().empty())
+                ok = false;
+    }
+    else if (req.fEmulate) {
+        RCX_Emulator emulator;
+
+        // the profile's lines come from the image's source information
+        bool profiling = req.fProfile || req.fSaveProfile;
+        if (profiling && compiled && !image->HasSourceInfo())
+            image->SetSourceInfo(Compiler::Get());
+
+        emulator.SetProfiling(profiling);
+        emulator.Load(*image);
+        emulator.Start();
+        emulator.Run(req.fEmulate);
+        emulator.PrintState(stdout, image);
+        if (req.fProfile)
+            emulator.PrintProfile(stdout, *image);
+        if (req.fSaveProfile) {
+            RCX_Profile profile;
+            emulator.GetProfile(*image, profile);
+            if (!profile.Write(req.fSaveProfile)) {
+                fprintf(MyCompiler::Get()->GetErrorStream(), "Error: could not create profile \"%s\"\n", req.fSaveProfile);
+                ok = false;
+            }
+        }
+        if (!emulator.GetErrors().empty())
             ok = false;
     }
 
     // reset the compiler after generating the listing so that the Compiler's
     // buffers will be available for inserting source code into the listing
-    if (compiled)
+    if (compiled || loadedSources)
         Compiler::Get()->Reset();
 
 
@@ -626,318 +1521,2555 @@ RCX_Result ProcessFile(const char *sourceFile, const Request &req)
 }
 
 
-bool GenerateListing(RCX_Image *image, const char *fileName, bool includeSource, bool generateLASM)
+void PrintErrorCount()
 {
-    FILE *fp;
+    int errors = ErrorHandler::Get()->GetErrorCount();
 
-    if (fileName) {
-        fp = fopen(fileName, "w");
-        if (!fp) {
-            fprintf(STDERR, "Error: could not open file \"%s\" (%d)\n", fileName, errno);
-            return false;
+    if (errors)
+        fprintf(MyCompiler::Get()->GetErrorStream(), "# %d error%s during compilation\n", errors, errors==1 ? "" : "s");
+}
+
+
+/**
+ * Read or compile one program of a bundle.
+ *
+ * @param file an image or source file
+ * @param req the compilation options
+ * @return the program's image, or 0 if there was an error (which has
+ *  already been reported)
+ */
+RCX_Image *LoadProgram(const char *file, const Request &req)
+{
+    RCX_Image *image;
+
+    if (req.fBinary || CheckExtension(file, kRCXFileExtension)) {
+        image = new RCX_Image();
+        RCX_Result result = image->Read(file);
+        if (RCX_ERROR(result)) {
+            PrintError(result, file);
+            delete image;
+            return 0;
         }
-    } else {
-        fp = stdout;
+        return image;
     }
 
-    RCX_StdioPrinter dst(fp);
-    image->Print(&dst, includeSource ? Compiler::Get() : 0, generateLASM);
+    if (CheckExtension(file, kLASMFileExtension))
+        return Assemble(file, req);
 
-    if (fp != stdout)
-        fclose(fp);
+    MyCompiler::Get()->RevalidateDirs();
+    MyCompiler::Get()->ClearIncludes();
+    image = Compile(file, RequestTarget(req), req.fFlags);
+    if (!image)
+        PrintErrorCount();
 
-    return true;
+    Compiler::Get()->Reset();
+    return image;
 }
 
-RCX_Image *Compile(const char *sourceFile, int flags)
-{
-    Buffer *mainBuf;
 
-    if (sourceFile) {
-        FILE *fp  = fopen(sourceFile, "rb");
-        if (!fp) {
-            fprintf(gErrorStream, "Error: could not open file \"%s\" (%d)\n",
-                sourceFile, errno);
-            return nil;
+/**
+ * Assemble a LASM file (such as an edited -c listing) for the request's
+ * target, without the compiler.
+ *
+ * @param file the LASM file
+ * @param req the compilation options
+ * @return the image, or 0 if there was an error (which has already
+ *  been reported)
+ */
+RCX_Image *Assemble(const char *file, const Request &req)
+{
+    FILE *fp = fopen(file, "rb");
+    if (!fp) {
+        PrintError(kRCX_FileError, file);
+        return 0;
+    }
+
+    string text;
+    char buf[4096];
+    size_t n;
+    while((n = fread(buf, 1, sizeof(buf), fp)) != 0)
+        text.append(buf, n);
+    fclose(fp);
+
+    RCX_Asm assembler(RequestTarget(req)->fType);
+    RCX_Image *image = new RCX_Image();
+
+    if (!assembler.Assemble(text.data(), (int)text.size(), *image)) {
+        FILE *errors = MyCompiler::Get()->GetErrorStream();
+        fprintf(errors, "# Error: %s\n", assembler.GetError());
+        fprintf(errors, "File \"%s\" ; line %d\n", file, assembler.GetErrorLine());
+        fprintf(errors, "#----------------------------------------------------------\n");
+        delete image;
+        return 0;
+    }
+
+    return image;
+}
+
+
+/**
+ * Put the programs for several slots into one bundle file.  The files
+ * go into slots 1, 2, ... in the order given.
+ *
+ * @param bundleFile the bundle to write
+ * @param firmware firmware to download before the programs, or 0
+ * @param files the image or source file of each program
+ * @param req the compilation and download options
+ */
+RCX_Result MakeBundle(const char *bundleFile, const char *firmware,
+    const vector<const char *> &files, const Request &req)
+{
+    RCX_Bundle bundle;
+
+    if (files.size() > RCX_Bundle::kMaxPrograms) return kUsageError;
+
+    bundle.SetFirmware(firmware);
+
+    for(size_t i=0; i<files.size(); ++i) {
+        RCX_Image *image = LoadProgram(files[i], req);
+        if (!image) return kQuietError;
+
+        bundle.AddProgram(i+1, image);
+    }
+
+    errno = 0;
+    if (!bundle.Write(bundleFile)) {
+        fprintf(MyCompiler::Get()->GetErrorStream(), "Error: could not create output file \"%s\" (%d)\n", bundleFile, errno);
+        return kQuietError;
+    }
+
+    return UseBundle(bundle, req);
+}
+
+
+RCX_Result ProcessBundle(const char *bundleFile, const Request &req)
+{
+    RCX_Bundle bundle;
+
+    RCX_Result result = bundle.Read(bundleFile);
+    if (RCX_ERROR(result)) {
+        PrintError(result, bundleFile);
+        return kQuietError;
+    }
+
+    return UseBundle(bundle, req);
+}
+
+
+/**
+ * Compile a source file into an object file, to be linked with others
+ * by -link.  The object is written to the output file, or next to the
+ * source with a .rco extension, unless only a listing was asked for.
+ *
+ * @param sourceFile the file to compile, or 0 for stdin
+ * @param req the compilation options
+ */
+RCX_Result MakeObject(const char *sourceFile, const Request &req)
+{
+    if (req.fBinary || req.fDownload || req.fEmulate) return kUsageError;
+
+    MyCompiler::Get()->RevalidateDirs();
+    MyCompiler::Get()->ClearIncludes();
+
+    bool tags = req.fListing && (req.fSourceListing || req.fListJSON);
+    RCX_Object *object = static_cast<RCX_Object *>(Compile(sourceFile, RequestTarget(req),
+        req.fFlags | Compiler::kObject_Flag | (tags ? 0 : Compiler::kNoSourceTags_Flag)));
+
+    if (!object) {
+        PrintErrorCount();
+        return kQuietError;
+    }
+
+    bool ok = true;
+    const char *outputFile = req.fOutputFile;
+    char *newFilename = 0;
+
+    if (!req.fListing && !req.fOutputFile && sourceFile) {
+        outputFile =
+        newFilename =
+            CreateFilename(LeafName(sourceFile),
+                kNQCFileExtension, kObjectFileExtension);
+    }
+
+    if (outputFile) {
+        errno = 0;
+        if (!object->Write(outputFile)) {
+            fprintf(MyCompiler::Get()->GetErrorStream(), "Error: could not create output file \"%s\" (%d)\n", outputFile, errno);
+            ok = false;
+        }
+    }
+
+    if (req.fDepFile && sourceFile && !WriteDepFile(sourceFile, outputFile, req.fDepFileName))
+        ok = false;
+
+    if (newFilename)
+        delete [] newFilename;
+
+    if (req.fListing && !GenerateListing(object, req.fListFile, tags,
+            req.fGenLASM, req.fListJSON, req.fListStream))
+        ok = false;
+
+    Compiler::Get()->Reset();
+    delete object;
+
+    return ok ? kRCX_OK : kQuietError;
+}
+
+
+/**
+ * Report a target whose programs can't be emulated.
+ *
+ * @return false if the emulator can't run programs for type
+ */
+bool CheckEmulated(RCX_TargetType type)
+{
+    if (RCX_Emulator::CanRun(type)) return true;
+
+    fprintf(MyCompiler::Get()->GetErrorStream(),
+        "Error: -emulate and -check_opt can't run %s programs\n", getTarget(type)->fName);
+    return false;
+}
+
+
+/**
+ * Compile a source file for -check_opt, keeping where each instruction
+ * came from.
+ *
+ * @return the image, or 0 if there was an error (which has already
+ *  been reported)
+ */
+RCX_Image *CompileForCheck(const char *sourceFile, const Request &req, int flags)
+{
+    MyCompiler::Get()->RevalidateDirs();
+    MyCompiler::Get()->ClearIncludes();
+
+    RCX_Image *image = Compile(sourceFile, RequestTarget(req), flags);
+    if (!image) {
+        PrintErrorCount();
+        return 0;
+    }
+
+    image->SetSourceInfo(Compiler::Get());
+    Compiler::Get()->Reset();
+    return image;
+}
+
+
+/**
+ * Find the source line an emulated event happened on (with callSite,
+ * the line of the task or sub's statement it was part of).
+ *
+ * @return false if the image doesn't know
+ */
+bool FindEventLine(const RCX_Image &image, const RCX_Emulator::Event &e,
+    int &srcIndex, long &line, bool callSite)
+{
+    RCX_ChunkType type = (e.fSub >= 0) ? kRCX_SubChunk : kRCX_TaskChunk;
+    int number = (e.fSub >= 0) ? e.fSub : e.fTask;
+
+    for(int i=0; i<image.GetChunkCount(); ++i) {
+        const RCX_Image::Chunk &c = image.GetChunk(i);
+
+        if (c.GetType() == type && c.GetNumber() == number)
+            return c.FindLine(e.fPC, srcIndex, line, callSite);
+    }
+
+    return false;
+}
+
+
+/**
+ * Split an emulator's trace by task, keeping only what changes a named
+ * variable or an output.  The variables without names are the
+ * compiler's temporaries, which the optimizer is free to change, and
+ * setting something to the value it already has (as x *= 1 does at
+ * -opt 0) can be left out.  Consecutive settings of the same variable
+ * or output on the same line become the last of them, since a
+ * statement at -opt 0 may build its result in the variable it assigns.
+ */
+void SplitTrace(const RCX_Emulator &emulator, const RCX_Image &image,
+    map<int, vector<RCX_Emulator::Event> > &tasks)
+{
+    const vector<RCX_Emulator::Event> &trace = emulator.GetTrace();
+
+    // the value of each variable and output, and what each task's last
+    // event changed it from
+    map<pair<int, int>, short> values;
+    map<int, short> before;
+
+    for(size_t i=0; i<trace.size(); ++i) {
+        const RCX_Emulator::Event &e = trace[i];
+        vector<RCX_Emulator::Event> &events = tasks[e.fTask];
+
+        if (e.fKind == RCX_Emulator::kVarEvent && !image.GetVariableName(e.fIndex))
+            continue;
+
+        if (e.fKind != RCX_Emulator::kVarEvent && e.fKind != RCX_Emulator::kOutputEvent) {
+            events.push_back(e);
+            continue;
+        }
+
+        // the variables start at 0, the outputs at a status only their
+        // first setting shows
+        pair<int, int> key(e.fKind, e.fIndex);
+        bool known = e.fKind == RCX_Emulator::kVarEvent || values.count(key);
+        short was = values[key];
+        values[key] = e.fValue;
+
+        if (!events.empty()) {
+            const RCX_Emulator::Event &last = events.back();
+            int src1, src2;
+            long line1, line2;
+
+            bool same = last.fKind == e.fKind && last.fIndex == e.fIndex &&
+                ((FindEventLine(image, last, src1, line1, false) &&
+                  FindEventLine(image, e, src2, line2, false)) ?
+                    (src1 == src2 && line1 == line2) : last.fPC == e.fPC);
+
+            if (same) {
+                // a statement that leaves it as it was changes nothing
+                if (before.count(e.fTask) && before[e.fTask] == e.fValue) {
+                    events.pop_back();
+                    before.erase(e.fTask);
+                }
+                else
+                    events.back().fValue = e.fValue;
+                continue;
+            }
+        }
+
+        if (known && was == e.fValue) continue;
+
+        events.push_back(e);
+        if (known)
+            before[e.fTask] = was;
+        else
+            before.erase(e.fTask);
+    }
+}
+
+
+/**
+ * Describe an event of a -check_opt trace.
+ */
+string DescribeEvent(const RCX_Image &image, const RCX_Emulator::Event *e)
+{
+    char text[128];
+
+    if (!e) return "does nothing more";
+
+    switch(e->fKind) {
+        case RCX_Emulator::kOutputEvent:
+            snprintf(text, sizeof(text), "sets output %c to status %02x",
+                'A' + e->fIndex, e->fValue & 0xff);
+            break;
+        case RCX_Emulator::kSoundEvent:
+            snprintf(text, sizeof(text), "plays sound %d (opcode %02x)",
+                e->fValue, e->fIndex);
+            break;
+        case RCX_Emulator::kMessageEvent:
+            snprintf(text, sizeof(text), "sends message %d", e->fValue);
+            break;
+        case RCX_Emulator::kDatalogEvent:
+            snprintf(text, sizeof(text), "logs %d", e->fValue);
+            break;
+        default:
+            snprintf(text, sizeof(text), "sets %s to %d",
+                image.GetVariableName(e->fIndex), e->fValue);
+            break;
+    }
+
+    return text;
+}
+
+
+/**
+ * @return true if two events of -check_opt traces are the same (or only
+ * differ in a value that a run cut short hadn't finished with)
+ */
+bool SameEvent(const RCX_Image &image1, const RCX_Emulator::Event &e1,
+    const RCX_Image &image2, const RCX_Emulator::Event &e2, bool partial)
+{
+    if (e1.fKind != e2.fKind) return false;
+
+    if (e1.fKind == RCX_Emulator::kVarEvent) {
+        if (strcmp(image1.GetVariableName(e1.fIndex), image2.GetVariableName(e2.fIndex)))
+            return false;
+    }
+    else if (e1.fIndex != e2.fIndex)
+        return false;
+
+    return partial || e1.fValue == e2.fValue;
+}
+
+
+/**
+ * Compile a source file at -opt 0 and as requested, run both in the
+ * emulator for req.fCheckOpt ms, and report the first place where one
+ * of the tasks does something different.  Tasks are compared one by
+ * one, so the optimized program being faster only matters to programs
+ * whose tasks race each other or that read the timers.
+ */
+RCX_Result CheckOptimizer(const char *sourceFile, const Request &req)
+{
+    if (!sourceFile || req.fBinary || CheckExtension(sourceFile, kRCXFileExtension) ||
+        req.fDownload || req.fEmulate)
+        return kUsageError;
+
+    int flags = req.fFlags & ~(Compiler::kOptimize1_Flag | Compiler::kOptimize2_Flag |
+        Compiler::kOptimizeSize_Flag | Compiler::kNoSourceTags_Flag);
+
+    RCX_Image *images[2];
+    images[0] = CompileForCheck(sourceFile, req, flags);
+    if (!images[0]) return kQuietError;
+    images[1] = CompileForCheck(sourceFile, req, req.fFlags & ~Compiler::kNoSourceTags_Flag);
+    if (!images[1]) {
+        delete images[0];
+        return kQuietError;
+    }
+
+    RCX_Emulator emulators[2];
+    map<int, vector<RCX_Emulator::Event> > tasks[2];
+    bool stopped[2];
+
+    for(int i=0; i<2; ++i) {
+        emulators[i].SetTracing(true);
+        emulators[i].Load(*images[i]);
+        emulators[i].Start();
+        stopped[i] = emulators[i].Run(req.fCheckOpt);
+        SplitTrace(emulators[i], *images[i], tasks[i]);
+    }
+
+    FILE *fp = MyCompiler::Get()->GetErrorStream();
+    bool ok = true;
+
+    // both have every task that did something in either
+    map<int, vector<RCX_Emulator::Event> >::const_iterator t;
+    for(t = tasks[0].begin(); t != tasks[0].end(); ++t)
+        tasks[1][t->first];
+    for(t = tasks[1].begin(); t != tasks[1].end(); ++t)
+        tasks[0][t->first];
+
+    // the first difference in each task
+    for(t = tasks[1].begin(); t != tasks[1].end() && ok; ++t) {
+        int n = t->first;
+        const vector<RCX_Emulator::Event> &e0 = tasks[0][n];
+        const vector<RCX_Emulator::Event> &e1 = t->second;
+        size_t count = std::max(e0.size(), e1.size());
+
+        for(size_t i=0; i<count; ++i) {
+            const RCX_Emulator::Event *a = (i < e0.size()) ? &e0[i] : 0;
+            const RCX_Emulator::Event *b = (i < e1.size()) ? &e1[i] : 0;
+
+            // a run cut short may not have got as far, or finished
+            // setting what it set last
+            if ((!a && !stopped[0]) || (!b && !stopped[1])) break;
+            if (a && b && SameEvent(*images[0], *a, *images[1], *b,
+                    (i+1 == e0.size() && !stopped[0]) ||
+                    (i+1 == e1.size() && !stopped[1])))
+                continue;
+
+            const RCX_Image &image = b ? *images[1] : *images[0];
+            int srcIndex;
+            long line;
+
+            fprintf(fp, "# Error: optimized task %d %s, but at -opt 0 it %s\n", n,
+                DescribeEvent(*images[1], b).c_str(),
+                DescribeEvent(*images[0], a).c_str());
+            if (FindEventLine(image, b ? *b : *a, srcIndex, line, true))
+                fprintf(fp, "File \"%s\" ; line %ld\n", image.GetSourceName(srcIndex), line);
+            ok = false;
+            break;
+        }
+    }
+
+    // a run that failed wasn't checked to the end, even if both failed
+    // the same way
+    for(int i=0; i<2 && ok; ++i) {
+        const vector<string> &errors = emulators[i].GetErrors();
+        if (errors.empty()) continue;
+
+        fprintf(fp, "# Error: %s program failed in the emulator: %s\n",
+            i ? "optimized" : "-opt 0", errors[0].c_str());
+        ok = false;
+    }
+
+    if (ok && !gQuiet)
+        fprintf(stdout, "%s: optimized program matches -opt 0 (%ld and %ld instructions)\n",
+            sourceFile, emulators[1].GetInstructionCount(), emulators[0].GetInstructionCount());
+
+    delete images[0];
+    delete images[1];
+
+    return ok ? kRCX_OK : kQuietError;
+}
+
+
+/**
+ * Read an object file, or compile a source file into an object.
+ *
+ * @param file an object or source file
+ * @param req the compilation options
+ * @return the object, or 0 if there was an error (which has already
+ *  been reported)
+ */
+RCX_Object *LoadObject(const char *file, const Request &req)
+{
+    RCX_Object *object;
+
+    if (CheckExtension(file, kObjectFileExtension)) {
+        object = new RCX_Object();
+        RCX_Result result = object->Read(file);
+        if (RCX_ERROR(result)) {
+            PrintError(result, file);
+            delete object;
+            return 0;
+        }
+        return object;
+    }
+
+    MyCompiler::Get()->RevalidateDirs();
+    MyCompiler::Get()->ClearIncludes();
+    object = static_cast<RCX_Object *>(Compile(file, RequestTarget(req),
+        req.fFlags | Compiler::kObject_Flag | Compiler::kNoSourceTags_Flag));
+    if (!object)
+        PrintErrorCount();
+
+    Compiler::Get()->Reset();
+    return object;
+}
+
+
+/**
+ * Link objects into one program, write it, and list and/or download
+ * it as requested.
+ *
+ * @param outputFile the program to write
+ * @param files the object or source file of each object
+ * @param req the compilation and download options
+ */
+RCX_Result LinkObjects(const char *outputFile, const vector<const char *> &files,
+    const Request &req)
+{
+    vector<const RCX_Object *> objects;
+    RCX_Result result = kRCX_OK;
+
+    for(size_t i=0; i<files.size() && result == kRCX_OK; ++i) {
+        RCX_Object *object = LoadObject(files[i], req);
+        if (object)
+            objects.push_back(object);
+        else
+            result = kQuietError;
+    }
+
+    RCX_Image *image = 0;
+    if (result == kRCX_OK) {
+        string error;
+        image = RCX_Object::Link(objects, error);
+        if (!image) {
+            fprintf(MyCompiler::Get()->GetErrorStream(), "Error: %s\n", error.c_str());
+            result = kQuietError;
+        }
+    }
+
+    for(size_t i=0; i<objects.size(); ++i)
+        delete objects[i];
+
+    if (!image) return result;
+
+    errno = 0;
+    if (!WriteImage(image, outputFile)) {
+        fprintf(MyCompiler::Get()->GetErrorStream(), "Error: could not create output file \"%s\" (%d)\n", outputFile, errno);
+        result = kQuietError;
+    }
+    else if (req.fListing && !GenerateListing(image, req.fListFile, false,
+            req.fGenLASM, req.fListJSON, req.fListStream))
+        result = kQuietError;
+#ifndef __wasm__
+    else if (req.fDownload)
+        result = Download(image);
+#endif
+
+    delete image;
+    return result;
+}
+
+
+/**
+ * List and/or download the programs of a bundle, as requested.
+ */
+RCX_Result UseBundle(const RCX_Bundle &bundle, const Request &req)
+{
+    RCX_Result result = kRCX_OK;
+
+    if (req.fListing) {
+        FILE *fp;
+
+        if (req.fListFile) {
+            fp = fopen(req.fListFile, "w");
+            if (!fp) {
+                fprintf(STDERR, "Error: could not open file \"%s\" (%d)\n", req.fListFile, errno);
+                return kQuietError;
+            }
+        } else {
+            fp = req.fListStream ? req.fListStream : stdout;
+        }
+
+        RCX_BufferPrinter dst(fp);
+        if (req.fListJSON) {
+            // one line per program, in slot order
+            for(int i=0; i<bundle.GetProgramCount(); ++i)
+                bundle.GetImage(i).PrintJSON(&dst);
+        }
+        else {
+            if (bundle.GetFirmware()) {
+                dst.Print(req.fGenLASM ? ";" : "***");
+                dst.Print(" Firmware = ");
+                dst.Print(bundle.GetFirmware());
+                dst.Print("\n");
+            }
+
+            for(int i=0; i<bundle.GetProgramCount(); ++i) {
+                if (i || bundle.GetFirmware())
+                    dst.Print("\n");
+                dst.Print(req.fGenLASM ? ";" : "***");
+                dst.Print(" Program ");
+                dst.PrintDec(bundle.GetSlot(i));
+                dst.Print("\n");
+                bundle.GetImage(i).Print(&dst, 0, req.fGenLASM);
+            }
+        }
+
+        dst.Flush();
+        if (req.fListFile)
+            fclose(fp);
+    }
+
+#ifndef __wasm__
+    if (req.fDownload)
+        result = Download(bundle);
+#endif
+
+    return result;
+}
+
+
+/**
+ * Compile several source files at once, each on one of the worker
+ * threads.  Every file gets its own .rcx (or listing) just as if it
+ * had been given to a separate nqc, and the diagnostics for each file
+ * are reported together, in the order the files were given.
+ *
+ * With several targets each file is compiled for every one of them,
+ * and foo.nqc is written to foo.<target>.rcx.  The files (and what
+ * they include) are lexed just once, and the tokens are played back
+ * for each target.
+ *
+ * @param files the source files
+ * @param macroArgs the -D and -U options to apply to every file
+ * @param req the compilation options
+ * @param jobs the maximum number of threads to use (0 = one for
+ *  each compile)
+ * @param targets the targets to compile for if more than one
+ * @return kRCX_OK if every file compiled, otherwise an error code
+ */
+RCX_Result ProcessBatch(const vector<const char *> &files,
+    const vector<const char *> &macroArgs, const Request &req, int jobs,
+    const vector<RCX_TargetType> &targets)
+{
+    // these all name a single file or device
+    if (req.fOutputFile || req.fListFile) return kUsageError;
+#ifndef __wasm__
+    if (req.fDownload) return kUsageError;
+#endif
+
+    // the objects would all have the same name
+    if (!targets.empty() && req.fObject) return kUsageError;
+
+    Batch batch;
+    batch.fMacroArgs = macroArgs;
+    batch.fRequest = req;
+    batch.fTokens = 0;
+    batch.fNext = 0;
+
+    RCX_Result result = kRCX_OK;
+    TokenCache tokens;
+
+    if (!targets.empty()) {
+        LexSources(files, tokens);
+        batch.fTokens = &tokens;
+    }
+
+    for(size_t i=0; i<files.size(); ++i) {
+        size_t n = targets.empty() ? 1 : targets.size();
+
+        for(size_t j=0; j<n; ++j) {
+            BatchFile f;
+            f.fSourceFile = files[i];
+            f.fTargetType = targets.empty() ? gTargetType : targets[j];
+            f.fOutputFile = 0;
+
+            // just what ProcessFile() would write
+            if (!targets.empty() && !req.fListing && !req.fEmulate) {
+                string ext(".");
+                for(const char *c = sTargetNames[f.fTargetType]; *c; ++c)
+                    ext += (char)tolower(*c);
+                ext += kRCXFileExtension;
+                f.fOutputFile = CreateFilename(LeafName(files[i]),
+                    kNQCFileExtension, ext.c_str());
+            }
+
+            batch.fFiles.push_back(f);
+        }
+    }
+
+    if (!jobs)
+        jobs = (int)batch.fFiles.size();
+
+    for(size_t i=0; i<batch.fFiles.size(); ++i) {
+        BatchFile &f = batch.fFiles[i];
+        f.fErrors = tmpfile();
+        f.fOutput = req.fListing ? tmpfile() : 0;
+        f.fResult = kRCX_OK;
+
+        if (!f.fErrors || (req.fListing && !f.fOutput)) {
+            fprintf(STDERR, "Error: could not create temporary file (%d)\n", errno);
+            result = kQuietError;
+        }
+    }
+
+    if (!RCX_ERROR(result)) {
+        if ((size_t)jobs > batch.fFiles.size())
+            jobs = (int)batch.fFiles.size();
+
+#ifndef NO_THREADS
+        // the calling thread is one of the workers
+        vector<std::thread *> threads;
+        for(int i=1; i<jobs; ++i)
+            threads.push_back(new std::thread(RunBatch, &batch));
+
+        RunBatch(&batch);
+
+        for(size_t i=0; i<threads.size(); ++i) {
+            threads[i]->join();
+            delete threads[i];
+        }
+#else
+        RunBatch(&batch);
+#endif
+    }
+
+    for(size_t i=0; i<batch.fFiles.size(); ++i) {
+        BatchFile &f = batch.fFiles[i];
+
+        // the same file's diagnostics may come once for each target
+        if (!targets.empty() && f.fErrors && ftell(f.fErrors) > 0)
+            fprintf(gErrorStream, "# %s for %s:\n", f.fSourceFile,
+                sTargetNames[f.fTargetType]);
+
+        CopyStream(f.fErrors, gErrorStream);
+        CopyStream(f.fOutput, stdout);
+        PrintError(f.fResult, f.fSourceFile);
+
+        if (RCX_ERROR(f.fResult))
+            result = kQuietError;
+
+        delete [] f.fOutputFile;
+    }
+
+    return result;
+}
+
+
+/**
+ * Worker for ProcessBatch(): compile files from the batch until none
+ * are left.  Each worker has its own CompileContext and compiler.
+ *
+ * @param batch the files to compile
+ */
+void RunBatch(Batch *batch)
+{
+    CompileContext context;
+    CompileContext::Scope scope(&context);
+    MyCompiler compiler;
+    BatchFile *f;
+
+    compiler.AddDirs(gMyCompiler.GetDirs());
+    compiler.SetTokens(batch->fTokens);
+
+    // the API header only needs to be parsed once per worker
+    compiler.SetSnapshotsEnabled(true);
+
+    while((f = batch->Next()) != 0) {
+        compiler.Compiler::Reset();
+        compiler.SetErrorStream(f->fErrors);
+
+        for(size_t i=0; i<batch->fMacroArgs.size(); ++i) {
+            const char *a = batch->fMacroArgs[i];
+            if (a[1]=='D')
+                DefineMacro(a+2);
+            else
+                compiler.Undefine(a+2);
+        }
+
+        Request req = batch->fRequest;
+        req.fListStream = f->fOutput;
+        req.fTarget = getTarget(f->fTargetType);
+        if (f->fOutputFile)
+            req.fOutputFile = f->fOutputFile;
+        f->fResult = ProcessFile(f->fSourceFile, req);
+    }
+
+    compiler.SetSnapshotsEnabled(false);
+}
+
+
+/**
+ * Lex the source files of a compile for several targets, along with
+ * every file they might include (whichever way their #ifs go), so that
+ * the compile for each target can play the tokens back.  A file that
+ * doesn't lex cleanly is left to be lexed by each compile, which then
+ * reports its problems as usual.
+ *
+ * @param files the source files
+ * @param tokens filled in with the tokens of each file
+ */
+void LexSources(const vector<const char *> &files, TokenCache &tokens)
+{
+    MyCompiler *compiler = MyCompiler::Get();
+    vector<string> pending(files.rbegin(), files.rend());
+
+    compiler->RevalidateDirs();
+
+    while(!pending.empty()) {
+        string path = pending.back();
+        pending.pop_back();
+
+        if (tokens.find(path) != tokens.end()) continue;
+        vector<UByte> &data = tokens[path];
+
+        // the buffer is owned by the compiler once it has been lexed
+        Buffer *b = new Buffer();
+        if (!b->Create(path.c_str(), path.c_str())) {
+            delete b;
+            continue;
+        }
+
+        ErrorHandler::Get()->Reset();
+        PrecompiledHeader::Lex(b, data);
+
+        PrecompiledHeader h;
+        if (ErrorHandler::Get()->GetErrorCount() || ErrorHandler::Get()->GetWarningCount() ||
+            !h.Open(&data[0], data.size(), b->GetLength())) {
+            compiler->DiscardDiagnostics();
+            data.clear();
+            continue;
+        }
+
+        TokenVal v;
+        LexLocation loc;
+
+        for(int i=0; i<h.GetTokenCount(); ++i) {
+            if (h.GetToken(i, v, loc) != PP_INCLUDE) continue;
+
+            int t;
+            while((t = h.GetToken(++i, v, loc)) == WS)
+                ;
+
+            string included;
+            if (t == STRING && compiler->GetIncludePath(v.fString, included))
+                pending.push_back(included);
+        }
+    }
+
+    compiler->Compiler::Reset();
+}
+
+
+BatchFile *Batch::Next()
+{
+#ifndef NO_THREADS
+    std::lock_guard<std::mutex> lock(fMutex);
+#endif
+
+    return (fNext < fFiles.size()) ? &fFiles[fNext++] : 0;
+}
+
+
+void CopyStream(FILE *src, FILE *dst)
+{
+    char buf[1024];
+    size_t n;
+
+    if (!src) return;
+
+    rewind(src);
+    while((n = fread(buf, 1, sizeof(buf), src)) != 0)
+        fwrite(buf, 1, n, dst);
+
+    fclose(src);
+    fflush(dst);
+}
+
+
+bool GenerateListing(RCX_Image *image, const char *fileName, bool includeSource, bool generateLASM, bool json, FILE *stream)
+{
+    FILE *fp;
+
+    if (fileName) {
+        fp = fopen(fileName, "w");
+        if (!fp) {
+            fprintf(STDERR, "Error: could not open file \"%s\" (%d)\n", fileName, errno);
+            return false;
+        }
+    } else {
+        fp = stream ? stream : stdout;
+    }
+
+    RCX_BufferPrinter dst(fp);
+    if (json)
+        image->PrintJSON(&dst, includeSource ? Compiler::Get() : 0);
+    else
+        image->Print(&dst, includeSource ? Compiler::Get() : 0, generateLASM);
+    dst.Flush();
+
+    if (fileName)
+        fclose(fp);
+
+    return true;
+}
+
+RCX_Image *Compile(const char *sourceFile, const RCX_Target *target, int flags)
+{
+    Buffer *mainBuf;
+
+    if (sourceFile) {
+        mainBuf = new Buffer();
+        errno = 0;
+        if (!mainBuf->Create(sourceFile, sourceFile)) {
+            fprintf(MyCompiler::Get()->GetErrorStream(), "Error: could not open file \"%s\" (%d)\n",
+                sourceFile, errno);
+            delete mainBuf;
+            return nil;
+        }
+    }
+    else {
+        mainBuf = new Buffer();
+        mainBuf->Create("<stdin>", stdin);
+    }
+
+#ifdef TEST_LEXER
+    LexPush(mainBuf);
+
+    int t;
+    TokenVal v;
+    LexLocation loc;
+
+#if TEST_LEXER == 2
+    while((t=gPreProc->Get(v)) != 0) {
+#elif TEST_LEXER == 3
+    while((t=yylex(v)) != 0) {
+#else
+    while((t=LexGetToken(v)) != 0) {
+#endif
+        LexCurrentLocation(loc);
+        printf("%3d (%2d) : ", loc.fOffset, loc.fLength);
+        PrintToken(t, v);
+    }
+
+    LexCurrentLocation(loc);
+    printf("%3d (%2d) : EOF\n", loc.fOffset, loc.fLength);
+
+    return 0;
+#else
+    PrecompiledHeader *tokens = sourceFile ? MyCompiler::Get()->OpenTokens(sourceFile, mainBuf) : 0;
+    Compiler::Get()->SetProfile(gProfile);
+    RCX_Image *image = Compiler::Get()->Compile(mainBuf, target, flags, tokens);
+    PrintStats(sourceFile);
+
+    return image;
+#endif
+}
+
+/**
+ * Give the compiler a buffer for each source file named by an image, so
+ * that a listing of the image can include the source.  A file that can't
+ * be found gets an empty buffer, leaving its source out of the listing.
+ *
+ * @param image an image read from a file
+ */
+void LoadSources(const RCX_Image *image)
+{
+    for(int i=0; i<image->GetSourceCount(); ++i) {
+        const char *name = image->GetSourceName(i);
+        Buffer *b = name ? MyCompiler::Get()->CreateBuffer(name) : 0;
+
+        if (!b) {
+            b = new Buffer();
+            b->Create(name ? name : "", "", 0);
+        }
+
+        Compiler::Get()->AddBuffer(b);
+    }
+}
+
+
+/**
+ * Write an image to a file, or to stdout if the name is "-" (so that
+ * it can be piped to the next command without a file in between).
+ */
+bool WriteImage(const RCX_Image *image, const char *outputFile)
+{
+    if (strcmp(outputFile, "-") == 0) {
+        image->Write(stdout);
+        return fflush(stdout) == 0;
+    }
+
+    return image->Write(outputFile);
+}
+
+
+/**
+ * Write a make rule saying that the output depends on the source file
+ * and every file it included, along with an empty rule for each included
+ * file so that make doesn't fail when one is removed.
+ *
+ * @param sourceFile the file that was compiled
+ * @param outputFile the image written, or 0 if none was (the rule is
+ *  then for the image that would have been)
+ * @param depFile where to write the rule, or 0 for the output's name
+ *  with .d in place of .rcx
+ * @return false if the file could not be written
+ */
+bool WriteDepFile(const char *sourceFile, const char *outputFile, const char *depFile)
+{
+    char *target = outputFile ? 0 :
+        CreateFilename(LeafName(sourceFile), kNQCFileExtension, kRCXFileExtension);
+    char *depName = depFile ? 0 :
+        CreateFilename(outputFile ? outputFile : target, kRCXFileExtension, kDepFileExtension);
+    const vector<string> &paths = MyCompiler::Get()->GetIncludePaths();
+    bool ok = true;
+
+    errno = 0;
+    FILE *fp = fopen(depFile ? depFile : depName, "w");
+    if (fp) {
+        PrintDepName(fp, outputFile ? outputFile : target);
+        fputc(':', fp);
+        fputc(' ', fp);
+        PrintDepName(fp, sourceFile);
+        for(size_t i=0; i<paths.size(); ++i) {
+            fputs(" \\\n  ", fp);
+            PrintDepName(fp, paths[i].c_str());
+        }
+        fputc('\n', fp);
+
+        for(size_t i=0; i<paths.size(); ++i) {
+            fputc('\n', fp);
+            PrintDepName(fp, paths[i].c_str());
+            fputs(":\n", fp);
+        }
+
+        ok = (fclose(fp) == 0);
+    }
+    else {
+        fprintf(MyCompiler::Get()->GetErrorStream(), "Error: could not create dependency file \"%s\" (%d)\n",
+            depFile ? depFile : depName, errno);
+        ok = false;
+    }
+
+    delete [] target;
+    delete [] depName;
+    return ok;
+}
+
+
+/*
+ * Print a file name for a make rule, escaping the characters make
+ * would take to mean something else.
+ */
+void PrintDepName(FILE *fp, const char *name)
+{
+    for(; *name; ++name) {
+        if (*name == ' ' || *name == '#')
+            fputc('\\', fp);
+        else if (*name == '$')
+            fputc('$', fp);
+        fputc(*name, fp);
+    }
+}
+
+
+/**
+ * Look for an up to date image of a source file in the compile cache.
+ *
+ * @param sourceFile the file about to be compiled
+ * @param req the compilation options
+ * @param key receives the cache key, or an empty string if the cache
+ *  isn't used for this compile
+ * @return the cached image, or 0 if the file must be compiled
+ */
+RCX_Image *FindCached(const char *sourceFile, const Request &req, char *key)
+{
+    *key = 0;
+
+    // source listings, source info and size reports need the compiler
+    if (!gCompileCache || !sourceFile || req.fSourceListing || req.fListJSON || req.fDebugInfo || req.fProfile ||
+        req.fSaveProfile || req.fDepFile || gProfile || (req.fFlags & Compiler::kSizeReport_Flag)) return 0;
+
+    Buffer source;
+    if (!source.Create(sourceFile, sourceFile)) return 0;
+
+    // everything that changes the image, apart from the included files
+    char flags[16];
+    sprintf(flags, "%d", req.fFlags);
+
+    string options(VERSION_STRING);
+    options += '\n';
+    options += RequestTarget(req)->fName;
+    options += '\n';
+    options += flags;
+    for(size_t i=0; req.fMacroArgs && i<req.fMacroArgs->size(); ++i) {
+        options += '\n';
+        options += (*req.fMacroArgs)[i];
+    }
+
+    CompileCache::MakeKey(&source, options.c_str(), key);
+    return gCompileCache->Find(key, Compiler::Get());
+}
+
+
+void SetCacheDir(const char *dir)
+{
+    delete gCompileCache;
+    gCompileCache = dir ? new CompileCache(dir) : 0;
+}
+
+
+RCX_Result UseProfile(const char *file)
+{
+    delete gProfile;
+    gProfile = 0;
+    if (!file) return kRCX_OK;
+
+    gProfile = new RCX_Profile();
+    if (!gProfile->Read(file)) {
+        fprintf(MyCompiler::Get()->GetErrorStream(), "Error: could not read profile \"%s\"\n", file);
+        delete gProfile;
+        gProfile = 0;
+        return kQuietError;
+    }
+
+    return kRCX_OK;
+}
+
+
+void SetStatsMode(StatsMode mode)
+{
+    gStatsMode = mode;
+    CompileStats::SetTiming(mode != kNoStats);
+}
+
+
+void PrintStats(const char *sourceFile)
+{
+    if (gStatsMode == kNoStats) return;
+
+    const char *name = sourceFile ? sourceFile : "<stdin>";
+    FILE *fp = MyCompiler::Get()->GetErrorStream();
+    const CompileStats &stats = CompileStats::Get();
+
+    if (gStatsMode == kJSONStats)
+        stats.PrintJSON(fp, name);
+    else
+        stats.Print(fp, name);
+}
+
+
+/**
+ * Write the tokens of a header file to a precompiled header (.nqp) file.
+ *
+ * @param outputFile name of the precompiled header to create
+ * @param sourceFile the header file to lex
+ * @return kRCX_OK on success, otherwise kQuietError
+ */
+RCX_Result Precompile(const char *outputFile, const char *sourceFile)
+{
+    Buffer *b = new Buffer();
+
+    if (!b->Create(sourceFile, sourceFile)) {
+        fprintf(gErrorStream, "Error: could not open file \"%s\" (%d)\n",
+            sourceFile, errno);
+        delete b;
+        return kQuietError;
+    }
+
+    ErrorHandler::Get()->Reset();
+
+    // the buffer is owned by the compiler once it has been lexed
+    errno = 0;
+    bool ok = PrecompiledHeader::Create(b, outputFile);
+    int errors = ErrorHandler::Get()->GetErrorCount();
+
+    Compiler::Get()->Reset();
+
+    if (errors) {
+        fprintf(gErrorStream, "# %d error%s during compilation\n", errors, errors==1 ? "" : "s");
+        remove(outputFile);
+        return kQuietError;
+    }
+
+    if (!ok) {
+        fprintf(gErrorStream, "Error: could not create output file \"%s\" (%d)\n", outputFile, errno);
+        return kQuietError;
+    }
+
+    return kRCX_OK;
+}
+
+/**
+ * Time one stage of the front end on a source file, without the API
+ * header, and print the tokens (and nodes) per second.  "lex" reads the
+ * tokens straight from the lexer, "preproc" through the preprocessor,
+ * and "parse" parses them as well.
+ *
+ * @param stage lex, preproc or parse
+ * @param sourceFile the file to read
+ * @param flags the compiler flags
+ * @return kRCX_OK on success, otherwise kUsageError or kQuietError
+ */
+RCX_Result BenchFrontEnd(const char *stage, const char *sourceFile, int flags)
+{
+    bool parse = strcmp(stage, "parse") == 0;
+    bool preprocess = strcmp(stage, "preproc") == 0;
+
+    if (!parse && !preprocess && strcmp(stage, "lex") != 0)
+        return kUsageError;
+
+    Buffer *b = new Buffer();
+
+    if (!b->Create(sourceFile, sourceFile)) {
+        fprintf(gErrorStream, "Error: could not open file \"%s\" (%d)\n",
+            sourceFile, errno);
+        delete b;
+        return kQuietError;
+    }
+
+    const RCX_Target *target = getTarget(gTargetType);
+    long tokens;
+    long nodes = 0;
+    double seconds;
+
+    CompileStats::SetTiming(true);
+
+    if (parse) {
+        // the parse phase includes the lexing and preprocessing, but
+        // not the code generation
+        delete Compiler::Get()->Compile(b, target, flags | Compiler::kNoSysFile_Flag);
+        const CompileStats &stats = CompileStats::Get();
+        tokens = stats.GetCount(CompileStats::kTokenCounter);
+        nodes = stats.GetCount(CompileStats::kNodeCounter);
+        seconds = stats.GetTime(CompileStats::kParsePhase);
+    }
+    else {
+        double start = CompileStats::Now();
+        tokens = Compiler::Get()->Scan(b, target, preprocess);
+        seconds = CompileStats::Now() - start;
+    }
+
+    int errors = ErrorHandler::Get()->GetErrorCount();
+    Compiler::Get()->Reset();
+
+    fprintf(stdout, "%s: %ld tokens", stage, tokens);
+    if (parse)
+        fprintf(stdout, ", %ld nodes", nodes);
+    fprintf(stdout, " in %.3f ms", seconds * 1000);
+    if (seconds > 0) {
+        fprintf(stdout, ", %.0f tokens/sec", tokens / seconds);
+        if (parse)
+            fprintf(stdout, ", %.0f nodes/sec", nodes / seconds);
+    }
+    fprintf(stdout, "\n");
+
+    if (errors) {
+        PrintErrorCount();
+        return kQuietError;
+    }
+
+    return kRCX_OK;
+}
+
+#ifdef __wasm__
+
+/*
+ * A C API for the web page.  Calling nqc_compile() for each edit keeps
+ * the compiler and its snapshot of the API header loaded between
+ * compiles, and the source and results are passed in memory instead
+ * of through files and main().  The results stay valid until the next
+ * call to nqc_compile().  nqc_download() sends the last program (or one
+ * given to nqc_load_image() by a page that compiles in workers) to the
+ * brick through the page's serial port (see PSerial_web.cpp).
+ */
+enum {
+    kWebListing = 1 << 0,       // make a listing
+    kWebSourceListing = 1 << 1, // with the source in it
+    kWebCompat = 1 << 2,        // NQC API 1.x compatibility mode
+    kWebNoSysFile = 1 << 3      // don't include the API header
+};
+
+static struct {
+    bool fDone;
+    string fSource;
+    string fTarget;
+    int fOptions;
+    int fResult;
+    RCX_Image *fProgram;
+    string fImage;
+    string fListing;
+    string fErrors;
+} sWeb;
+
+
+EM_JS(int, web_download_progress, (int soFar, int total), {
+    if (!Module.nqcProgress) return 1;
+    return (Module.nqcProgress(soFar, total) === false) ? 0 : 1;
+});
+
+
+// passes the progress of a download to the page, which can stop it
+class WebLink : public RCX_Link
+{
+public:
+    bool DownloadProgress(int soFar, int total, int /* chunkSize */) {
+        return web_download_progress(soFar, total) != 0;
+    }
+};
+
+
+/**
+ * Take what was written to a stream from open_memstream() and close it.
+ */
+static void TakeStream(FILE *fp, char *&data, size_t &size, string &text)
+{
+    fclose(fp);
+    text.assign(data ? data : "", size);
+    free(data);
+}
+
+
+extern "C" {
+
+/**
+ * Compile a program.
+ *
+ * @param source the program's text
+ * @param target a target name, as for -T (RCX2 if null)
+ * @param options kWebListing and the other kWeb flags
+ * @return the number of errors, or -1 for an unknown target
+ */
+EMSCRIPTEN_KEEPALIVE
+int nqc_compile(const char *source, const char *target, int options)
+{
+    if (!source) source = "";
+    if (!target) target = "RCX2";
+
+    // nothing to do if the editor asks for the same compile again
+    if (sWeb.fDone && sWeb.fSource == source && sWeb.fTarget == target &&
+        sWeb.fOptions == options)
+        return sWeb.fResult;
+
+    sWeb.fDone = true;
+    sWeb.fSource = source;
+    sWeb.fTarget = target;
+    sWeb.fOptions = options;
+    delete sWeb.fProgram;
+    sWeb.fProgram = 0;
+    sWeb.fImage.clear();
+    sWeb.fListing.clear();
+    sWeb.fErrors.clear();
+
+    if (RCX_ERROR(SetTarget(target))) {
+        sWeb.fErrors = "Error: unknown target\n";
+        return sWeb.fResult = -1;
+    }
+
+    int flags = 0;
+    if (options & kWebCompat) flags |= Compiler::kCompat_Flag;
+    if (options & kWebNoSysFile) flags |= Compiler::kNoSysFile_Flag;
+
+    char *errorData = 0;
+    size_t errorSize = 0;
+    FILE *errors = open_memstream(&errorData, &errorSize);
+    gMyCompiler.SetErrorStream(errors);
+    Compiler::Get()->SetSnapshotsEnabled(true);
+
+    // the buffer takes its own copy of the source
+    Buffer *buf = new Buffer();
+    buf->Create("<input>", source, (int)strlen(source));
+    RCX_Image *image = Compiler::Get()->Compile(buf, getTarget(gTargetType), flags);
+
+    if (image) {
+        vector<UByte> data;
+        image->Write(data);
+        sWeb.fImage.assign(data.begin(), data.end());
+
+        if (options & kWebListing) {
+            RCX_BufferPrinter dst;
+            image->Print(&dst, (options & kWebSourceListing) ? Compiler::Get() : 0, false);
+            sWeb.fListing.assign(dst.GetText(), dst.GetLength());
+        }
+        sWeb.fProgram = image;
+    }
+    else {
+        PrintErrorCount();
+    }
+    sWeb.fResult = ErrorHandler::Get()->GetErrorCount();
+
+    // after the listing, which may need the source buffers
+    Compiler::Get()->Reset();
+    gMyCompiler.SetErrorStream(0);
+    TakeStream(errors, errorData, errorSize, sWeb.fErrors);
+
+    return sWeb.fResult;
+}
+
+
+/// the .rcx image from the last compile (empty if it failed)
+EMSCRIPTEN_KEEPALIVE
+const char *nqc_image() { return sWeb.fImage.data(); }
+
+EMSCRIPTEN_KEEPALIVE
+int nqc_image_size() { return (int)sWeb.fImage.size(); }
+
+/// the listing from the last compile, if one was asked for
+EMSCRIPTEN_KEEPALIVE
+const char *nqc_listing() { return sWeb.fListing.c_str(); }
+
+/// the errors and warnings from the last compile
+EMSCRIPTEN_KEEPALIVE
+const char *nqc_errors() { return sWeb.fErrors.c_str(); }
+
+
+/**
+ * Make an image compiled elsewhere (by another instance of the module,
+ * such as one in a worker) the program that nqc_download() sends.
+ *
+ * @param data the .rcx image
+ * @param size its length in bytes
+ * @param target the target it was compiled for (RCX2 if null)
+ * @return 0, or an RCX_Result error
+ */
+EMSCRIPTEN_KEEPALIVE
+int nqc_load_image(const UByte *data, int size, const char *target)
+{
+    if (!target) target = "RCX2";
+
+    // the next compile must not take itself for a repeat
+    sWeb.fDone = false;
+    delete sWeb.fProgram;
+    sWeb.fProgram = 0;
+
+    RCX_Result result = SetTarget(target);
+    if (RCX_ERROR(result)) return result;
+
+    RCX_Image *image = new RCX_Image();
+    result = image->Read(data, size);
+    if (RCX_ERROR(result)) {
+        delete image;
+        return result;
+    }
+
+    sWeb.fProgram = image;
+    return 0;
+}
+
+
+/**
+ * Send the program from the last compile to the brick.  This waits
+ * for the serial port, so it has to be called with ccall's async
+ * option.  Module.nqcProgress(soFar, total) is called as the download
+ * goes, if the page has one, and can return false to stop it.
+ *
+ * @param program the program slot (1-5), or 0 for the current one
+ * @return 0, or an RCX_Result error
+ */
+EMSCRIPTEN_KEEPALIVE
+int nqc_download(int program)
+{
+    if (!sWeb.fProgram) return kUsageError;
+
+    WebLink link;
+    RCX_Result result = link.Open(gTargetType, "serial:web", gTimeout & RCX_Link::kRxTimeoutMask);
+    if (RCX_ERROR(result)) return result;
+
+    result = sWeb.fProgram->Download(&link, program);
+    link.Close();
+
+    return RCX_ERROR(result) ? result : 0;
+}
+
+}
+
+#endif
+
+
+// There is no communication with the brick from WebAssembly
+#ifndef __wasm__
+
+/**
+ * Compile a file, then again each time it or a file it included
+ * changes, until SIGINT or SIGTERM.  The compiler keeps its parse of
+ * the API header between compiles, and the link stays open.  If the
+ * program is downloaded, later downloads send just the tasks and subs
+ * that changed (unless -delta already keeps a history).
+ *
+ * @param sourceFile the file to compile
+ * @param req the compilation options
+ * @return the result of the last compile
+ */
+RCX_Result WatchFile(const char *sourceFile, const Request &req)
+{
+    FileWatcher watcher;
+    RCX_Result result;
+    RCX_DownloadHistory *history = 0;
+
+    if (req.fDownload && !gDownloadHistory) {
+        history = new RCX_DownloadHistory("");
+        gLink.SetDownloadHistory(history);
+    }
+
+    Compiler::Get()->SetSnapshotsEnabled(true);
+    Compiler::Get()->SetFragmentCacheEnabled(true);
+
+    do {
+        result = ProcessFile(sourceFile, req);
+        PrintError(result, sourceFile);
+
+        // whatever was included, even by a compile that failed
+        vector<string> files(1, sourceFile);
+        const vector<string> &includes = MyCompiler::Get()->GetIncludePaths();
+        files.insert(files.end(), includes.begin(), includes.end());
+        watcher.Watch(files);
+
+        fprintf(STDERR, "# Watching %d file%s for changes\n", (int)files.size(),
+            files.size()==1 ? "" : "s");
+        fflush(STDERR);
+    } while(watcher.Wait());
+
+    Compiler::Get()->SetFragmentCacheEnabled(false);
+    Compiler::Get()->SetSnapshotsEnabled(false);
+
+    if (history) {
+        gLink.SetDownloadHistory(0);
+        delete history;
+    }
+
+    // the errors have been reported
+    return RCX_ERROR(result) ? kQuietError : result;
+}
+
+
+/**
+ * Run as a persistent compile server.
+ *
+ * Each line read from stdin is treated as a complete nqc command line
+ * (without the leading "nqc") and processed exactly as if it had been
+ * passed to a fresh invocation, except that the process, the compiler
+ * and any open link to the brick stay resident between requests.  The
+ * end of each request is marked on stdout by a line "#done <status>",
+ * where status is 0 for success or the (positive) error number.  The
+ * server exits on EOF or when it reads a line consisting of "quit".
+ *
+ * @return kRCX_OK once stdin is exhausted
+ */
+RCX_Result RunServer()
+{
+    char line[kMaxServerLine];
+
+    gServerMode = true;
+    SaveRequestState();
+
+    // keep the parsed API header, and the code of unchanged tasks
+    // and subs, around between requests
+    Compiler::Get()->SetSnapshotsEnabled(true);
+    Compiler::Get()->SetFragmentCacheEnabled(true);
+
+    while(fgets(line, sizeof(line), stdin)) {
+        // strip the line terminator
+        size_t n = strlen(line);
+        while(n && (line[n-1]=='\n' || line[n-1]=='\r'))
+            line[--n] = 0;
+
+        if (strcmp(line, kServerQuit)==0) break;
+
+        CmdLine args;
+        args.Parse(line);
+        if (args.Remain()==0) continue;
+
+        RCX_Result result = RunRequest(args);
+        printf("%s %d\n", kServerDone, RCX_ERROR(result) ? -result : 0);
+        fflush(stdout);
+    }
+
+    Compiler::Get()->SetFragmentCacheEnabled(false);
+    Compiler::Get()->SetSnapshotsEnabled(false);
+    gServerMode = false;
+    return kRCX_OK;
+}
+
+
+/*
+ * Run one request of the server or daemon.  Each request starts from
+ * the same state as a new process, except for the link: it stays open
+ * on the last port given until a request names another.
+ */
+RCX_Result RunRequest(CmdLine &args)
+{
+    RestoreRequestState();
+
+    RCX_Result result = ProcessArgs(args);
+    PrintError(result);
+    PrintLinkTrace(gErrorStream, result);
+    if (gMetrics) gMetrics->AddRequest(!RCX_ERROR(result));
+
+    if (gErrorStream != gRequestState.fErrorStream) {
+        if (gErrorStream != stderr && gErrorStream != stdout)
+            fclose(gErrorStream);
+        gErrorStream = gRequestState.fErrorStream;
+    }
+
+    fflush(gErrorStream);
+    return result;
+}
+
+
+/*
+ * Note what the server or daemon was started with, for
+ * RestoreRequestState() to go back to before each request.
+ */
+void SaveRequestState()
+{
+    gRequestState.fTargetType = gTargetType;
+    gRequestState.fErrorStream = gErrorStream;
+    gRequestState.fTimeout = gTimeout;
+    gRequestState.fVerifyDownload = gVerifyDownload;
+    gRequestState.fRepairDownload = gRepairDownload;
+    gRequestState.fFleet = gFleet;
+    gRequestState.fDatalogStore = gDatalogStore;
+    gRequestState.fDownloadHistory = gDownloadHistory;
+    gRequestState.fTimeoutHistory = gTimeoutHistory;
+    gRequestState.fBrickProfiles = gBrickProfiles;
+    gRequestState.fLinkStats = gLinkStats;
+    gRequestState.fLinkTrace = gLinkTrace;
+    gRequestState.fLink.CopySettings(gLink);
+}
+
+
+/*
+ * Undo whatever the options of the last request set.  The compiler's
+ * Reset() keeps the snapshots of the API header, so it is not parsed
+ * again for each request.
+ */
+void RestoreRequestState()
+{
+    Compiler::Get()->Reset();
+    gMyCompiler.ClearDirs();
+    AddDefaultDirs();
+    gVerbose = false;
+    gQuiet = false;
+    SetCacheDir(0);
+    UseProfile(0);
+    SetStatsMode(kNoStats);
+    CompileStats::SetMemoryLimit(0);
+    gErrorsJSON = false;
+
+    gTimeout = gRequestState.fTimeout;
+    gVerifyDownload = gRequestState.fVerifyDownload;
+    gRepairDownload = gRequestState.fRepairDownload;
+    gFleet = gRequestState.fFleet;
+    gDatalogStore = gRequestState.fDatalogStore;
+    gLink.CopySettings(gRequestState.fLink);
+
+    if (gDownloadHistory != gRequestState.fDownloadHistory) {
+        delete gDownloadHistory;
+        gDownloadHistory = gRequestState.fDownloadHistory;
+        gLink.SetDownloadHistory(gDownloadHistory);
+    }
+    if (gTimeoutHistory != gRequestState.fTimeoutHistory) {
+        delete gTimeoutHistory;
+        gTimeoutHistory = gRequestState.fTimeoutHistory;
+        gLink.SetTimeoutHistory(gTimeoutHistory);
+    }
+    if (gBrickProfiles != gRequestState.fBrickProfiles) {
+        delete gBrickProfiles;
+        gBrickProfiles = gRequestState.fBrickProfiles;
+        gLink.SetBrickProfiles(gBrickProfiles);
+    }
+
+    // a daemon with metrics keeps stats for each tower instead
+    if (!gMetrics) gLink.SetStats(gRequestState.fLinkStats);
+    gLink.SetTrace(gRequestState.fLinkTrace);
+
+    gTargetType = gRequestState.fTargetType;
+    gTargetGiven = false;
+    UseProfileTarget();
+}
+
+
+/*
+ * Keep the link open for other nqc commands, which find the daemon
+ * through NQC_DAEMON.
+ */
+RCX_Result RunDaemon(const char *path)
+{
+    gDaemonMode = true;
+    SaveRequestState();
+    Compiler::Get()->SetSnapshotsEnabled(true);
+    Compiler::Get()->SetFragmentCacheEnabled(true);
+    if (gMetricsPort) gMetrics = new LinkMetrics();
+
+    bool ok = LinkDaemon::Serve(path, RunRequest, gMetricsPort, ReportMetrics);
+    if (!ok)
+        fprintf(STDERR, "Error: could not listen on '%s'%s: %s\n", path,
+            gMetricsPort ? " or the metrics port" : "", strerror(errno));
+
+    // the link's stats belong to the metrics
+    gLink.Close();
+    gLink.SetStats(gLinkStats);
+    delete gMetrics;
+    gMetrics = 0;
+
+    Compiler::Get()->SetFragmentCacheEnabled(false);
+    Compiler::Get()->SetSnapshotsEnabled(false);
+    gDaemonMode = false;
+    return ok ? kRCX_OK : kQuietError;
+}
+
+
+/*
+ * The daemon's metrics page, with the reply timeout of the tower the
+ * link is open on brought up to date.
+ */
+void ReportMetrics(string &text)
+{
+    if (!gMetrics) return;
+
+    if (gLink.IsOpen())
+        gMetrics->SetTimeout(gLink.GetPortName(), gLink.GetRxTimeout());
+    gMetrics->Print(text);
+}
+
+
+/*
+ * With NQC_DAEMON set, the daemon runs the command instead (unless
+ * there's no daemon listening).
+ */
+bool ForwardToDaemon(int argc, char **argv, int &exitCode)
+{
+    const char *path = getenv(kDaemonEnv);
+    if (!path || !*path) return false;
+
+    // the daemon itself runs here, of course
+    for (int i=1; i<argc; ++i)
+        if (strcmp(argv[i], "-daemon") == 0) return false;
+
+    CmdLine args;
+    args.Parse(getenv(kOptionsEnv));
+    args.Add(argc-1, argv+1);
+    return LinkDaemon::Forward(path, args, exitCode);
+}
+
+
+/**
+ * Set the clock/watch on the target
+ *
+ * @param timeSpec a string to be converted into 24h hh:mm time, or "now" for current
+ *  local time
+ * @return the RCX_Result from running kRCX_SetWatchOp
+ */
+RCX_Result SetWatch(const char *timeSpec)
+{
+    int hour;
+    int minute;
+    RCX_Cmd cmd;
+
+    if (strcmp(timeSpec, "now")==0) {
+        time_t t;
+        struct tm *tmp;
+
+        time(&t);
+        tmp = localtime(&t);
+        hour = tmp->tm_hour;
+        minute = tmp->tm_min;
+    }
+    else {
+        int t = atoi(timeSpec);
+        hour = t / 100;
+        minute = t % 100;
+    }
+
+    return gLink.Send(cmd.Set(kRCX_SetWatchOp, (UByte)hour, (UByte)minute));
+}
+
+RCX_Result GetBatteryLevel()
+{
+    RCX_Result result;
+
+    result = gLink.Open();
+    if (RCX_ERROR(result)) return result;
+
+    result = gLink.GetBatteryLevel();
+    if (!RCX_ERROR(result)) {
+        if (gMetrics) gMetrics->SetBattery(gLink.GetPortName(), result);
+        fprintf(STDERR, "Battery Level = %3.3fV\n", (double)result / 1000);
+        int lowBatt = (gTargetType == kRCX_SpyboticsTarget) ? kLow45Battery : kLowBattery;
+        if (result < lowBatt)
+            fprintf(STDERR, "Warning: battery level is low.\n");
+
+        return kRCX_OK;
+    }
+    else {
+        fprintf(STDERR, "Error: Could not fetch battery status.\n");
+        return result;
+    }
+}
+
+RCX_Result Download(RCX_Image *image)
+{
+    RCX_Result result;
+    RCX_Cmd cmd;
+
+    fprintf(STDERR, "Sending program [%d bytes]:\n", image->GetSize());
+
+    if (!gFleet.empty()) return FleetDownload(image, 0, 0, false);
+
+    result = gLink.Open();
+    if (result != kRCX_OK) goto ErrorReturn;
+
+    if (gVerifyDownload) {
+        result = gLink.Verify(*image, 0);
+        if (RCX_ERROR(result)) goto ErrorReturn;
+
+        if (result == 1) {
+            fprintf(STDERR, "Ok (already there)\n");
+            return kRCX_OK;
+        }
+    }
+
+    // if it can't be read back, the whole program is sent after all
+    if (gRepairDownload) {
+        result = gLink.Repair(*image, 0);
+        if (RCX_ERROR(result)) goto ErrorReturn;
+
+        if (result == 1) {
+            fprintf(STDERR, "Ok (checked)\n");
+            return kRCX_OK;
+        }
+    }
+
+    result = image->Download(&gLink);
+    gLink.EndProgress();
+    if (result != kRCX_OK) goto ErrorReturn;
+
+    fprintf(STDERR, "Ok\n");
+
+    return kRCX_OK;
+
+ErrorReturn:
+    fprintf(STDERR, "Error: program transfer failed (%d)\n", result);
+    return result;
+}
+
+RCX_Result Download(const RCX_Bundle &bundle)
+{
+    RCX_Result result;
+
+    // the firmware and the programs share one session on the link
+    if (bundle.GetFirmware()) {
+        result = DownloadFirmware(bundle.GetFirmware(), false);
+        if (RCX_ERROR(result)) return result;
+    }
+
+    if (!bundle.GetProgramCount()) return kRCX_OK;
+
+    fprintf(STDERR, "Sending %d programs [%d bytes]:\n", bundle.GetProgramCount(), bundle.GetSize());
+
+    if (!gFleet.empty()) return FleetDownload(0, &bundle, 0, false);
+
+    result = gLink.Open();
+    if (result != kRCX_OK) goto ErrorReturn;
+
+    result = bundle.Download(&gLink);
+    gLink.EndProgress();
+    if (result != kRCX_OK) goto ErrorReturn;
+
+    fprintf(STDERR, "Ok\n");
+
+    return kRCX_OK;
+
+ErrorReturn:
+    fprintf(STDERR, "Error: program transfer failed (%d)\n", result);
+    return result;
+}
+
+RCX_Result UploadDatalog(bool verbose)
+{
+    RCX_Log log;
+    RCX_Result result;
+
+    if (!gFleet.empty()) return FleetDatalog(verbose);
+
+    fprintf(STDERR, "Fetching Datalog:\n");
+
+    result = gLink.Open();
+    if (RCX_ERROR(result)) return result;
+
+    result = FetchDatalog(&gLink, log);
+    gLink.EndProgress();
+    if (RCX_ERROR(result)) return result;
+
+    return OutputDatalog(gLink.GetPortName().c_str(), log, verbose);
+}
+
+
+/**
+ * Upload the datalog over an open link.  A failed upload picks up where
+ * it stopped, a few times.
+ */
+RCX_Result FetchDatalog(RCX_Link *link, RCX_Log &log)
+{
+    RCX_Result result;
+
+    result = log.Upload(link);
+    for (int i=0; i<kDatalogResumes && RCX_ERROR(result) &&
+        result != kRCX_RequestError; ++i) {
+        result = log.Upload(link, true);
+    }
+
+    return result;
+}
+
+
+/**
+ * Print an uploaded datalog, or add it to the -datalog_store.
+ *
+ * @param port the port it came from
+ */
+RCX_Result OutputDatalog(const char *port, const RCX_Log &log, bool verbose)
+{
+    if (gDatalogStore) {
+        RCX_Result result = RCX_LogStore::Append(gDatalogStore, port,
+            (ULong)time(0), log);
+        if (RCX_ERROR(result)) {
+            fprintf(STDERR, "Error: could not add to datalog store %s\n", gDatalogStore);
+            return kQuietError;
         }
 
-        mainBuf = new Buffer();
-        mainBuf->Create(sourceFile, fp);
-        fclose(fp);
+        if (!gQuiet)
+            fprintf(STDERR, "%s: %d datalog entries stored\n", port, log.GetLength());
+        return kRCX_OK;
     }
-    else {
-        mainBuf = new Buffer();
-        mainBuf->Create("<stdin>", stdin);
+
+    for (int i=0; i<log.GetLength(); i++) {
+        char line[256];
+        log.SPrintEntry(line, i, verbose);
+        printf("%s\n", line);
     }
 
-#ifdef TEST_LEXER
-    LexPush(mainBuf);
+    return kRCX_OK;
+}
 
-    int t;
-    TokenVal v;
-    LexLocation loc;
 
-#if TEST_LEXER > 1
-    while((t=gPreProc->Get(v)) != 0) {
-#else
-    while((t=yylex(v)) != 0) {
-#endif
-        LexCurrentLocation(loc);
-        printf("%3d (%2d) : ", loc.fOffset, loc.fLength);
-        PrintToken(t, v);
+/**
+ * Print every datalog in a store (see -datalog_store), each after a
+ * line with its port and when it was uploaded.
+ */
+RCX_Result ReadDatalogStore(const char *file)
+{
+    RCX_LogStore store;
+    RCX_Result result;
+    RCX_Log log;
+    string port;
+    ULong when;
+
+    result = store.Open(file);
+    if (RCX_ERROR(result)) {
+        fprintf(STDERR, "Error: could not read datalog store %s\n", file);
+        return kQuietError;
     }
 
-    LexCurrentLocation(loc);
-    printf("%3d (%2d) : EOF\n", loc.fOffset, loc.fLength);
+    while((result = store.Next(port, when, log)) > 0) {
+        time_t t = (time_t)when;
+        char date[32];
+        strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S", localtime(&t));
+        printf("# %s %s\n", port.c_str(), date);
 
-    return 0;
-#else
-    Buffer *b = new Buffer();
-    b->Create(mainBuf->GetName(), mainBuf->GetData(), mainBuf->GetLength());
+        for (int i=0; i<log.GetLength(); i++) {
+            char line[256];
+            log.SPrintEntry(line, i, true);
+            printf("%s\n", line);
+        }
+    }
 
-    return Compiler::Get()->Compile(mainBuf, getTarget(gTargetType), flags);
-#endif
+    if (RCX_ERROR(result)) {
+        fprintf(STDERR, "Error: datalog store %s is damaged\n", file);
+        return kQuietError;
+    }
+
+    return kRCX_OK;
 }
 
-// There is no communication with the brick from WebAssembly
-#ifndef __wasm__
+
+RCX_Result ClearMemory()
+{
+    RCX_Result result;
+    RCX_Cmd cmd;
+
+    // halt all tasks
+    result = gLink.StopAll();
+    if (RCX_ERROR(result)) return result;
+
+    for (UByte p=0; p<5; p++) {
+        // select and delete program
+        result = gLink.Send(cmd.Set(kRCX_SelectProgramOp, p));
+        if (RCX_ERROR(result)) return result;
+
+        result = gLink.Send(cmd.MakeDeleteSubs());
+        if (RCX_ERROR(result)) return result;
+
+        result = gLink.Send(cmd.MakeDeleteTasks());
+        if (RCX_ERROR(result)) return result;
+    }
+
+    result = gLink.Send(cmd.Set(kRCX_SetDatalogOp, 0, 0));
+    return result;
+}
+
+RCX_Result GetVersion()
+{
+    RCX_Result result;
+    ULong rom, ram;
+
+    result = gLink.Open();
+    if (RCX_ERROR(result)) return result;
+
+    result = gLink.GetVersion(rom, ram);
+    if (RCX_ERROR(result)) return result;
+
+    fprintf(STDERR, "Current Version [ROM/Firmware]: %08lx/%08lx\n", rom, ram);
+
+    return result;  
+}
 
 /**
- * Set the clock/watch on the target
- *
- * @param timeSpec a string to be converted into 24h hh:mm time, or "now" for current
- *  local time
- * @return the RCX_Result from running kRCX_SetWatchOp
+ * Get a firmware file ready to send.  Firmware that was prepared
+ * before, earlier in this run or in the compile cache, is used again
+ * as long as the file hasn't changed, along with the message sizes
+ * worked out the last time it was sent.
+ * @param key receives the key of the firmware
+ * @return the firmware, or 0 if the file couldn't be read
  */
-RCX_Result SetWatch(const char *timeSpec)
+RCX_Firmware *LoadFirmware(const char *filename, char *key)
 {
-    int hour;
-    int minute;
-    RCX_Cmd cmd;
+    Buffer file;
+    if (!file.Create(filename, filename)) {
+        fprintf(STDERR, "Error: could not open file \'%s\'\n", filename);
+        return 0;
+    }
 
-    if (strcmp(timeSpec, "now")==0) {
-        time_t t;
-        struct tm *tmp;
+    CompileCache::MakeFirmwareKey(&file, key);
+    RCX_Firmware *&firmware = gFirmware[key];
+    if (firmware) return firmware;
 
-        time(&t);
-        tmp = localtime(&t);
-        hour = tmp->tm_hour;
-        minute = tmp->tm_min;
+    if (gCompileCache) {
+        firmware = gCompileCache->FindFirmware(key);
+        if (firmware) return firmware;
     }
-    else {
-        int t = atoi(timeSpec);
-        hour = t / 100;
-        minute = t % 100;
+
+    SRecord srec;
+    srec.Begin(kMaxFirmware);
+    if (!srec.Feed(file.GetData(), file.GetLength()) || !srec.End()) {
+        fprintf(STDERR, "Error: \'%s\' is not a valid S-Record file\n", filename);
+        gFirmware.erase(key);
+        return 0;
     }
 
-    return gLink.Send(cmd.Set(kRCX_SetWatchOp, (UByte)hour, (UByte)minute));
+    firmware = new RCX_Firmware(srec.GetData(), srec.GetLength(), srec.GetStart());
+    return firmware;
 }
 
-RCX_Result GetBatteryLevel()
+
+RCX_Result DownloadFirmware(const char *filename, bool fast)
 {
+    char key[CompileCache::kKeyLength+1];
+    RCX_Firmware *firmware;
     RCX_Result result;
 
+    firmware = LoadFirmware(filename, key);
+    if (!firmware) return kQuietError;
+
+    fprintf(STDERR, "Sending firmware [%d bytes]:\n", firmware->GetLength());
+
+    if (!gFleet.empty()) {
+        result = FleetDownload(0, 0, firmware, fast);
+        if (!RCX_ERROR(result) && gCompileCache)
+            gCompileCache->StoreFirmware(key, *firmware);
+        return result;
+    }
+
     result = gLink.Open();
-    if (RCX_ERROR(result)) return result;
+    if (RCX_ERROR(result)) goto ErrorReturn;
 
-    result = gLink.GetBatteryLevel();
+    result = gLink.DownloadFirmware(*firmware, fast);
+    gLink.EndProgress();
+    if (RCX_ERROR(result)) goto ErrorReturn;
+
+    // save the sizes that were just worked out for next time
+    if (gCompileCache)
+        gCompileCache->StoreFirmware(key, *firmware);
+
+    fprintf(STDERR, "Ok\n");
+    return kRCX_OK;
+
+ErrorReturn:
+    fprintf(STDERR, "Error: firmware transfer failed (%d)\n", result);
+    return result;
+}
+
+
+/**
+ * Send a program, the programs of a bundle, or firmware to every brick
+ * of the -fleet at once, each on its own thread (and link).  They all
+ * send from the same copy of the download, and the first brick to plan
+ * the firmware's messages shares the plan with the rest.  The progress
+ * is reported for the whole fleet, and each brick reports its own
+ * result.
+ *
+ * @param image the program to send, or 0
+ * @param bundle the bundle to send, or 0
+ * @param firmware the firmware to send, or 0; its plan is updated
+ * @param fast send the firmware at quad speed
+ * @return kRCX_OK if every brick got the download
+ */
+RCX_Result FleetDownload(const RCX_Image *image, const RCX_Bundle *bundle,
+    RCX_Firmware *firmware, bool fast)
+{
+    vector<FleetJob *> jobs;
+    FleetProgress progress((int)gFleet.size());
+
+    for(size_t i=0; i<gFleet.size(); ++i) {
+        FleetJob *job = NewFleetJob(gFleet[i]);
+        job->fLink.fProgress = &progress;
+        job->fLink.fIndex = (int)i;
+        job->fImage = image;
+        job->fBundle = bundle;
+        job->fFirmware = firmware;
+        job->fFast = fast;
+        jobs.push_back(job);
+    }
+
+    RunFleetJobs(jobs);
+
+    RCX_Result result = kRCX_OK;
+
+    for(size_t i=0; i<jobs.size(); ++i) {
+        FleetJob *job = jobs[i];
+
+        if (RCX_ERROR(job->fResult)) {
+            fprintf(STDERR, "%s: Error: %s transfer failed (%d)\n", job->fLink.fName,
+                firmware ? "firmware" : "program", job->fResult);
+            result = kQuietError;
+        }
+        else {
+            fprintf(STDERR, "%s: Ok\n", job->fLink.fName);
+        }
+
+        delete job;
+    }
+
+    return result;
+}
+
+
+/**
+ * Upload the datalog of every brick of the -fleet at once.  The logs
+ * are printed (or stored) one brick after another, in the order of the
+ * ports, once they are all in.
+ *
+ * @return kRCX_OK if every brick's datalog was uploaded
+ */
+RCX_Result FleetDatalog(bool verbose)
+{
+    vector<FleetJob *> jobs;
+
+    for(size_t i=0; i<gFleet.size(); ++i) {
+        FleetJob *job = NewFleetJob(gFleet[i]);
+        job->fLog = new RCX_Log;
+        jobs.push_back(job);
+    }
+
+    RunFleetJobs(jobs);
+
+    RCX_Result result = kRCX_OK;
+
+    for(size_t i=0; i<jobs.size(); ++i) {
+        FleetJob *job = jobs[i];
+
+        if (RCX_ERROR(job->fResult)) {
+            fprintf(STDERR, "%s: Error: datalog upload failed (%d)\n", job->fLink.fName,
+                job->fResult);
+            result = kQuietError;
+        }
+        else {
+            if (!gDatalogStore)
+                printf("# %s\n", job->fLink.fName);
+            if (RCX_ERROR(OutputDatalog(job->fLink.fName, *job->fLog, verbose)))
+                result = kQuietError;
+        }
+
+        delete job->fLog;
+        delete job;
+    }
+
+    return result;
+}
+
+
+/**
+ * @return a job for the brick on port, with the link set up like gLink
+ *  and nothing to do yet
+ */
+FleetJob *NewFleetJob(const string &port)
+{
+    FleetJob *job = new FleetJob;
+
+    job->fLink.SetSerialPort(port.c_str());
+    job->fLink.CopySettings(gLink);
+    job->fLink.fName = port.c_str();
+    job->fImage = 0;
+    job->fBundle = 0;
+    job->fFirmware = 0;
+    job->fFast = false;
+    job->fLog = 0;
+    job->fResult = kRCX_OK;
+
+    return job;
+}
+
+
+/**
+ * Run the jobs, each on its own thread, and wait for them all.
+ */
+void RunFleetJobs(const vector<FleetJob *> &jobs)
+{
+#ifndef NO_THREADS
+    vector<std::thread *> threads;
+    for(size_t i=0; i<jobs.size(); ++i)
+        threads.push_back(new std::thread(RunFleetJob, jobs[i]));
+
+    for(size_t i=0; i<threads.size(); ++i) {
+        threads[i]->join();
+        delete threads[i];
+    }
+#else
+    for(size_t i=0; i<jobs.size(); ++i)
+        RunFleetJob(jobs[i]);
+#endif
+}
+
+
+/**
+ * Worker for FleetDownload() and FleetDatalog(): open one brick's link
+ * and send it the download, or upload its datalog.
+ *
+ * @param job the brick and what it gets
+ */
+void RunFleetJob(FleetJob *job)
+{
+    RCX_Result result;
+
+    result = job->fLink.Open();
     if (!RCX_ERROR(result)) {
-        fprintf(STDERR, "Battery Level = %3.3fV\n", (double)result / 1000);
-        int lowBatt = (gTargetType == kRCX_SpyboticsTarget) ? kLow45Battery : kLowBattery;
-        if (result < lowBatt)
-            fprintf(STDERR, "Warning: battery level is low.\n");
+        if (job->fLog)
+            result = FetchDatalog(&job->fLink, *job->fLog);
+        else if (job->fFirmware)
+            result = job->fLink.DownloadFirmware(*job->fFirmware, job->fFast);
+        else if (job->fBundle)
+            result = job->fBundle->Download(&job->fLink);
+        else
+            result = job->fImage->Download(&job->fLink);
+    }
 
-        return kRCX_OK;
+    job->fLink.Close();
+    job->fResult = result;
+}
+
+
+/*
+ * Several packets can be given, separated by commas.  They are sent
+ * as a batch and the reply to each is printed on a line of its own.
+ */
+RCX_Result SendRawCommand(const char *text, bool retry)
+{
+    RCX_Result result;
+
+    size_t count = 1;
+    for (const char *c = text; *c; ++c)
+        if (*c == ',') ++count;
+    vector<RCX_Cmd> cmds(count);
+
+    for (size_t n=0; n<count; ++n) {
+        const char *end = strchr(text, ',');
+        int length = end ? (int)(end - text) : (int)strlen(text);
+
+        // we need an even number of chars in text
+        if (length == 0 || (length & 1)) return kUsageError;
+
+        // determine actual length of command
+        length /= 2;
+        RCX_Cmd &cmd = cmds[n];
+        cmd.SetLength(length);
+
+        for (int i=0; i<length; i++) {
+            int byte = SRecord::ReadHexByte(text);
+            if (byte == -1) return kUsageError;
+            cmd[i] = (UByte) byte;
+            text+=2;
+        }
+
+        if (end) text = end + 1;
     }
-    else {
-        fprintf(STDERR, "Error: Could not fetch battery status.\n");
+
+    if (cmds.size() == 1) {
+        result = gLink.Send(&cmds[0], retry);
+
+        if (result > 0) {
+            for (int i=0; i<result; i++)
+                printf("%02x ", gLink.GetReplyByte(i));
+            printf("\n");
+        }
+
         return result;
     }
+
+    vector<const RCX_Cmd*> cmdPtrs;
+    for (size_t i=0; i<cmds.size(); ++i)
+        cmdPtrs.push_back(&cmds[i]);
+    vector<RCX_Result> results(cmds.size());
+    vector<UByte> replies;
+
+    result = gLink.Send(&cmdPtrs[0], (int)cmdPtrs.size(), &results[0], &replies, retry);
+
+    const UByte *reply = replies.empty() ? 0 : &replies[0];
+    for (size_t i=0; i<results.size(); ++i) {
+        if (RCX_ERROR(results[i]))
+            printf("error %d", results[i]);
+        for (int j=0; j<results[i]; j++)
+            printf("%02x ", *reply++);
+        printf("\n");
+    }
+
+    return result;
 }
 
-RCX_Result Download(RCX_Image *image)
+
+RCX_Result SendRemote(const char *event, int repeat)
 {
-    RCX_Result result;
     RCX_Cmd cmd;
+    int low, high;
 
-    fprintf(STDERR, "Sending program [%d bytes]:\n", image->GetSize());
+    if (repeat <= 0) return kUsageError;
 
-    result = gLink.Open();
-    if (result != kRCX_OK) goto ErrorReturn;
+    if (strlen(event) != 4)
+        return kUsageError;
 
-    result = image->Download(&gLink);
-    fputc('\n', STDERR);
-    if (result != kRCX_OK) goto ErrorReturn;
+    high = SRecord::ReadHexByte(event);
+    low = SRecord::ReadHexByte(event+2);
+    if (high==-1 || low==-1) return kUsageError;
+
+
+    cmd.Set(kRCX_Remote, low, high);
+
+    RCX_Result result = gLink.Open();
+    if (RCX_ERROR(result)) return result;
 
-    fprintf(STDERR, "Ok\n");
+    // the repeats go out together, nothing answers them
+    vector<const RCX_Cmd*> cmds(repeat, &cmd);
+    vector<RCX_Result> results(repeat);
+    gLink.Stream(&cmds[0], repeat, &results[0]);
 
     return kRCX_OK;
-
-ErrorReturn:
-    fprintf(STDERR, "Error: program transfer failed (%d)\n", result);
-    return result;
 }
 
-RCX_Result UploadDatalog(bool verbose)
+
+RCX_Result SendMessage(int message)
 {
-    RCX_Log log;
+    RCX_Cmd cmd;
+    const RCX_Cmd *cmds[1] = { cmd.Set(kRCX_Message, (UByte)message) };
     RCX_Result result;
-    int i;
-
-    fprintf(STDERR, "Fetching Datalog");
 
     result = gLink.Open();
     if (RCX_ERROR(result)) return result;
 
-    result = log.Upload(&gLink);
-    if (RCX_ERROR(result)) return result;
-
-    fputc('\n', STDERR);
-
-    for (i=0; i<log.GetLength(); i++) {
-        char line[256];
-        log.SPrintEntry(line, i, verbose);
-        printf("%s\n", line);
-    }
-
-    return kRCX_OK;
+    return gLink.Stream(cmds, 1, &result);
 }
 
 
-RCX_Result ClearMemory()
+/*
+ * Sources are given as type:data pairs separated by commas (9:0 is the
+ * first sensor's value, 0:3 is var[3]).  Each round is written to
+ * stdout as it's taken; with 0 rounds polling goes on until nothing
+ * has been read for kPollGiveUp rounds in a row.
+ */
+RCX_Result PollValues(const char *sources, int rounds, bool binary)
 {
+    RCX_Poller poller(&gLink);
+    RCX_Poller::Format format = binary ? RCX_Poller::kBinaryFormat :
+        RCX_Poller::kCSVFormat;
     RCX_Result result;
-    RCX_Cmd cmd;
 
-    // halt all tasks
-    result = gLink.Send(cmd.Set(kRCX_StopAllOp));
+    if (rounds < 0) return kUsageError;
+
+    const char *ptr = sources;
+    while (true) {
+        char *end;
+        long type = strtol(ptr, &end, 0);
+        if (end == ptr || *end != ':') return kUsageError;
+        ptr = end + 1;
+        long data = strtol(ptr, &end, 0);
+        if (end == ptr || (*end && *end != ',')) return kUsageError;
+        poller.AddSource(RCX_VALUE(type, data));
+        if (!*end) break;
+        ptr = end + 1;
+    }
+
+    result = gLink.Open();
     if (RCX_ERROR(result)) return result;
 
-    for (UByte p=0; p<5; p++) {
-        // select and delete program
-        result = gLink.Send(cmd.Set(kRCX_SelectProgramOp, p));
-        if (RCX_ERROR(result)) return result;
+    poller.WriteHeader(stdout, format);
+    int failed = 0;
+    for (int i=0; rounds == 0 || i < rounds; ++i) {
+        result = poller.Poll();
+        int written = poller.Write(stdout, format);
+        fflush(stdout);
 
-        result = gLink.Send(cmd.MakeDeleteSubs());
-        if (RCX_ERROR(result)) return result;
+        // no round at all, or not even an echo: the link is gone
+        if (written == 0 || result == kRCX_IREchoError) return result;
 
-        result = gLink.Send(cmd.MakeDeleteTasks());
-        if (RCX_ERROR(result)) return result;
+        failed = RCX_ERROR(result) ? failed + 1 : 0;
+        if (failed == kPollGiveUp) return result;
     }
 
-    result = gLink.Send(cmd.Set(kRCX_SetDatalogOp, 0, 0));
-    return result;
+    return kRCX_OK;
 }
 
-RCX_Result GetVersion()
+
+/*
+ * Each line of fp sets some of the channel's slots, as msg=<n> for the
+ * message or v<var>=<n> for a variable (separated by spaces or commas),
+ * and the ones that changed are sent before the next line is read.  A
+ * blank line sends them all again.  The rate is printed at the end.
+ */
+RCX_Result StreamValues(FILE *fp)
 {
+    RCX_Channel channel(&gLink);
+    char line[kMaxServerLine];
     RCX_Result result;
-    ULong rom, ram;
+    int failed = 0;
 
     result = gLink.Open();
     if (RCX_ERROR(result)) return result;
 
-    result = gLink.GetVersion(rom, ram);
-    if (RCX_ERROR(result)) return result;
-
-    fprintf(STDERR, "Current Version [ROM/Firmware]: %08lx/%08lx\n", rom, ram);
+    while (fgets(line, sizeof(line), fp)) {
+        const char *ptr = line + strspn(line, " \t,\r\n");
+        bool all = (*ptr == 0);
 
-    return result;  
-}
+        while (*ptr) {
+            char *end;
+            int slot;
 
-RCX_Result DownloadFirmware(const char *filename, bool fast)
-{
-    FILE *fp;
-    SRecord srec;
-    bool ok;
-    RCX_Result result;
+            if (strncmp(ptr, "msg=", 4) == 0) {
+                slot = channel.AddMessage();
+                ptr += 4;
+            }
+            else if (*ptr == 'v') {
+                long var = strtol(ptr + 1, &end, 10);
+                if (end == ptr + 1 || *end != '=' || var < 0 || var > 255)
+                    return kUsageError;
+                slot = channel.AddVariable((int)var);
+                ptr = end + 1;
+            }
+            else
+                return kUsageError;
 
-    fp = fopen(filename, "rb");
-    if (!fp) {
-        fprintf(STDERR, "Error: could not open file \'%s\'\n", filename);
-        return kQuietError;
-    }
+            long value = strtol(ptr, &end, 0);
+            if (end == ptr) return kUsageError;
+            channel.Set(slot, (int)value);
+            ptr = end + strspn(end, " \t,\r\n");
+        }
 
-    ok = srec.Read(fp, kMaxFirmware);
-    fclose(fp);
+        result = channel.Flush(all);
 
-    if (!ok) {
-        fprintf(STDERR, "Error: \'%s\' is not a valid S-Record file\n", filename);
-        return kQuietError;
+        // not even an echo: the link is gone
+        if (result == kRCX_IREchoError) break;
+        failed = RCX_ERROR(result) ? failed + 1 : 0;
+        if (failed == kPollGiveUp) break;
     }
 
-    fprintf(STDERR, "Sending firmware [%d bytes]:\n", srec.GetLength());
-
-    result = gLink.Open();
-    if (RCX_ERROR(result)) goto ErrorReturn;
-
-    result = gLink.DownloadFirmware(srec.GetData(), srec.GetLength(), srec.GetStart(), fast);
-    fputc('\n', STDERR);
-    if (RCX_ERROR(result)) goto ErrorReturn;
-
-    fprintf(STDERR, "Ok\n");
-    return kRCX_OK;
+    fprintf(STDERR, "%ld updates in %ld flushes (%ld lost), %.1f updates/s\n",
+        channel.GetUpdates(), channel.GetFlushes(), channel.GetLost(), channel.GetRate());
 
-ErrorReturn:
-    fprintf(STDERR, "Error: firmware transfer failed (%d)\n", result);
-    return result;
+    return RCX_ERROR(result) ? result : kRCX_OK;
 }
 
 
-RCX_Result SendRawCommand(const char *text, bool retry)
+void UseLinkStats()
 {
-    int length = (int)strlen(text);
-    RCX_Cmd cmd;
-    RCX_Result result;
-
-    // we need an even number of chars in text
-    if (length & 1) return kUsageError;
+    // a daemon with metrics keeps stats for each tower instead
+    if (gMetrics) return;
 
-    // determine actual length of command
-    length /= 2;
-    cmd.SetLength(length);
+    if (!gLinkStats) gLinkStats = new RCX_LinkStats();
+    gLink.SetStats(gLinkStats);
+}
 
-    for (int i=0; i<length; i++) {
-        int byte = SRecord::ReadHexByte(text);
-        if (byte == -1) return kUsageError;
-        cmd[i] = (UByte) byte;
-        text+=2;
-    }
 
-    result = gLink.Send(&cmd, retry);
+/**
+ * Without -T, target the brick that was last found on the port (if
+ * -brick_profiles has a profile for it).
+ */
+void UseProfileTarget()
+{
+    RCX_BrickProfiles::Profile profile;
 
-    if (result > 0) {
-        for (int i=0; i<result; i++)
-            printf("%02x ", gLink.GetReplyByte(i));
-        printf("\n");
-    }
+    if (!gBrickProfiles || gTargetGiven) return;
 
-    return result;
+    if (gBrickProfiles->Find(RCX_Link::FindPortName(gLink.GetSerialPort()), profile))
+        gTargetType = profile.fTarget;
 }
 
 
-RCX_Result SendRemote(const char *event, int repeat)
+void PrintLinkStats()
 {
-    RCX_Cmd cmd;
-    int low, high;
-
-    if (repeat == 0) return kUsageError;
-
-    if (strlen(event) != 4)
-        return kUsageError;
+    if (gLinkStats && gLinkStats->GetPackets()) gLinkStats->Print(stderr);
+}
 
-    high = SRecord::ReadHexByte(event);
-    low = SRecord::ReadHexByte(event+2);
-    if (high==-1 || low==-1) return kUsageError;
 
+void UseLinkTrace()
+{
+    if (!gLinkTrace) gLinkTrace = new RCX_Trace();
+    gLink.SetTrace(gLinkTrace);
+}
 
-    cmd.Set(kRCX_Remote, low, high);
 
-    while(repeat--) {
-        gLink.Send(&cmd, false);
-    }
+/**
+ * Print the trace if the link failed (or always, when verbose), then
+ * start it again for the next request.
+ */
+void PrintLinkTrace(FILE *fp, RCX_Result result)
+{
+    if (!gLinkTrace || gLinkTrace->IsEmpty()) return;
 
-    return kRCX_OK;
+    if (RCX_ERROR(result) || gVerbose) gLinkTrace->Print(fp);
+    gLinkTrace->Clear();
 }
 #endif
 
@@ -1060,6 +4192,9 @@ void DefineMacro(const char *text)
 
 int GetActionCode(const char *arg)
 {
+    // long names may also be given with two dashes
+    if (arg[0]=='-' && arg[1]) ++arg;
+
     for (int i=0; i< (int)(sizeof(sActionNames)/sizeof(const char *)); ++i)
         if (strcmp(sActionNames[i], arg)==0)
             return i+kFirstActionCode;
@@ -1068,6 +4203,53 @@ int GetActionCode(const char *arg)
 }
 
 
+bool IsLongOption(int code)
+{
+    switch(code) {
+        case kCacheCode:
+        case kStatsCode:
+        case kStatsJSONCode:
+        case kMemoryLimitCode:
+        case kSizeReportCode:
+        case kListJSONCode:
+        case kErrorsJSONCode:
+        case kDepFileCode:
+        case kDepFileNameCode:
+        case kEmulateCode:
+        case kProfileCode:
+        case kSaveProfileCode:
+        case kBricksCode:
+        case kCheckOptCode:
+        case kOptCode:
+        case kUseProfileCode:
+        case kBundleCode:
+        case kBundleFirmwareCode:
+        case kObjectCode:
+        case kLinkCode:
+#ifndef __wasm__
+        case kDeltaCode:
+        case kAdaptiveCode:
+        case kFleetCode:
+        case kBroadcastCode:
+        case kMainFirstCode:
+        case kVerifyCode:
+        case kRepairCode:
+        case kWatchFilesCode:
+        case kLinkStatsCode:
+        case kLinkTraceCode:
+        case kMetricsCode:
+        case kDatalogStoreCode:
+        case kTimeoutsCode:
+        case kTimeoutPolicyCode:
+        case kBrickProfilesCode:
+#endif
+            return true;
+        default:
+            return false;
+    }
+}
+
+
 void PrintError(RCX_Result error, const char *filename)
 {
     const char *targetName = getTarget(gTargetType)->fName;
@@ -1166,38 +4348,83 @@ void PrintUsage()
     fprintf(stdout,"Help Options:\n");
     fprintf(stdout,"   -help: display command line options\n");
     fprintf(stdout,"   -api: dump the standard API header file to stdout\n");
+    fprintf(stdout,"   -pch <outfile> <header>: write a precompiled header for #include\n");
+    fprintf(stdout,"   -frontend_bench <lex|preproc|parse> <file>: time the front end on <file>\n");
     fprintf(stdout,"Compilation Options:\n");
-    fprintf(stdout,"   -T<target>: target is one of:");
+    fprintf(stdout,"   -T<target>[,<target>...]: target is one of:");
     for (unsigned i=0; i < sizeof(sTargetNames) / sizeof(const char *); ++i) {
         fprintf(stdout, " %s", sTargetNames[i]);
     }
     fprintf(stdout, " (target=%s)\n", targetName);
+    fprintf(stdout,"      several targets write <name>.<target>.rcx for each\n");
     fprintf(stdout,"   -n: prevent the API header file from being included\n");
     fprintf(stdout,"   -D<sym>[=<value>] : define macro <sym>\n");
     fprintf(stdout,"   -U<sym>: undefine macro <sym>\n");
     fprintf(stdout,"   -E[<filename>] : write compiler errors to <filename> (or stdout)\n");
+    fprintf(stdout,"   -errors_json: write compiler errors and warnings as JSON, one per line\n");
     fprintf(stdout,"   -R<filename> : redirect text output (datalog, etc) to <filename>\n");
     fprintf(stdout,"   -I<path>: search <path> for include files\n");
     fprintf(stdout,"   -L[<filename>] : generate code listing to <filename> (or stdout)\n");
     fprintf(stdout,"   -l : generate code listing to stdout\n");
     fprintf(stdout,"   -s: include source code in listings if possible\n");
     fprintf(stdout,"   -c: generate LASM compatible listings\n");
+    fprintf(stdout,"      a .lasm file (such as an edited -c listing) is assembled, not compiled\n");
+    fprintf(stdout,"   -list_json: generate listings as JSON, with source locations\n");
+    fprintf(stdout,"   -emulate <ms>: run the program on the host for <ms> of simulated time\n");
+    fprintf(stdout,"   -profile <ms>: emulate, then report the time spent in each task, sub and line\n");
+    fprintf(stdout,"   -save_profile <file>: save how often each line ran when emulating, for -use_profile\n");
+    fprintf(stdout,"   -bricks <n>: emulate <n> bricks running the program, each hearing the others' messages\n");
+    fprintf(stdout,"   -check_opt <ms>: emulate the program built at -opt 0 and as asked, and report where they differ\n");
+    fprintf(stdout,"   -use_profile <file>: lay out branches and inline calls for the lines that ran most\n");
+    fprintf(stdout,"   -g: save source file names and line numbers in .rcx output\n");
     fprintf(stdout,"   -v: verbose\n");
     fprintf(stdout,"   -q: quiet; suppress action sounds\n");
-    fprintf(stdout,"   -O<outfile>: specify output file\n");
+    fprintf(stdout,"   -O<outfile>: specify output file (-O- writes the program to stdout)\n");
+    fprintf(stdout,"   -MD: write the files the output depends on as a make rule, to <outfile>.d\n");
+    fprintf(stdout,"   -MF <file>: write the make rule to <file> (implies -MD)\n");
+    fprintf(stdout,"   -opt <level>: 0 (none, the default), 1 (basic), 2 (full) or s (size, and report the size of each task and sub)\n");
+    fprintf(stdout,"   -size_report: report the bytes and variables of each task and sub, and the bytes of each inline function\n");
     fprintf(stdout,"   -1: use NQC API 1.x compatibility mode\n");
+    fprintf(stdout,"   -j <n>: compile several files, using up to <n> threads\n");
+    fprintf(stdout,"   -cache <dir>: reuse unchanged compiles and firmware from the cache in <dir>\n");
+    fprintf(stdout,"   -stats: print compile times and counts (-stats_json for JSON)\n");
+    fprintf(stdout,"   -memory_limit <KB>: stop a compile that needs more memory than this\n");
+    fprintf(stdout,"   -bundle <file>: put the programs for slots 1, 2, ... in a bundle\n");
+    fprintf(stdout,"   -bundle_firmware <file>: firmware to download before a bundle's programs\n");
+    fprintf(stdout,"   -object: compile to an object file (.rco) instead of a program\n");
+    fprintf(stdout,"   -link <file>: link the object (or source) files that follow into program <file>\n");
 #ifndef __wasm__
-    fprintf(stdout,"   -b: treat input file as a binary file (don't compile it)\n");
+    fprintf(stdout,"   -server: read command lines from stdin and process each in turn\n");
+    fprintf(stdout,"   -daemon <socket>: keep the link open for the nqc commands run with NQC_DAEMON=<socket>\n");
+    fprintf(stdout,"   -metrics <port>: serve the -daemon's link metrics for Prometheus on TCP <port>\n");
+    fprintf(stdout,"   -towerserver <port> <tower> ...: share the towers over TCP on <port>, <port>+1, ...\n");
+    fprintf(stdout,"   -editor: answer an editor's requests for diagnostics, definitions and sizes on stdin\n");
+    fprintf(stdout,"   -b: treat input file as a binary file (don't compile it); -b - reads it from stdin\n");
     fprintf(stdout,"Communication Options:\n");
     fprintf(stdout,"   -d: send program to \%s\n", targetName);
     fprintf(stdout,"   -x: omit packet header (RCX, RCX2 targets only)\n");
     fprintf(stdout,"   -f<size>: set firmware chunk size in bytes\n");
+    fprintf(stdout,"   -adaptive: shrink firmware chunks when the link needs retries\n");
     fprintf(stdout,"   -w<ms>: set the download wait timeout in milliseconds\n");
+    fprintf(stdout,"   -delta <file>: only download the tasks and subs that changed, as recorded in <file>\n");
     fprintf(stdout,"   -S<portname>: specify tower serial port\n");
+    fprintf(stdout,"   -fleet <ports>: send downloads to each of the (space separated) ports at once\n");
+    fprintf(stdout,"   -broadcast <n>: send programs to every %s in range, each message <n> times\n", targetName);
+    fprintf(stdout,"   -main_first: send main and what it calls first, and run it as soon as it has them\n");
+    fprintf(stdout,"   -verify: only send a program to a %s that doesn't have it yet\n", targetName);
+    fprintf(stdout,"   -repair: read a program back and only send the tasks and subs that differ\n");
+    fprintf(stdout,"   -watch_files: compile (and download) again each time the source or its includes change\n");
+    fprintf(stdout,"   -timeouts <file>: start each port at the reply timeout it had last time, as recorded in <file>\n");
+    fprintf(stdout,"   -timeout_policy aimd | ewma | fixed: shrink and double, average or keep the reply timeout\n");
+    fprintf(stdout,"   -brick_profiles <file>: open each port tuned (and without -T, targeted) for the brick found there last time, as recorded in <file>\n");
+    fprintf(stdout,"   -link_stats: print packet timings, tries and timeouts when done (also with -v)\n");
+    fprintf(stdout,"   -link_trace: print the last link events if the link fails (always with -v)\n");
+    fprintf(stdout,"   -datalog_store <file>: add fetched datalogs to <file> (with port and time) instead of printing them\n");
     fprintf(stdout,"Actions:\n");
     fprintf(stdout,"   -run: run current program\n");
     fprintf(stdout,"   -pgm <number>: select program number\n");
-    fprintf(stdout,"   -datalog | -datalog_full: fetch datalog from %s\n", targetName);
+    fprintf(stdout,"   -datalog | -datalog_full: fetch datalog from %s (from each brick with -fleet)\n", targetName);
+    fprintf(stdout,"   -datalog_read <file>: print the datalogs in a -datalog_store file\n");
     fprintf(stdout,"   -near | -far: set IR tower to near or far mode\n");
     fprintf(stdout,"   -watch <hhmm> | now: set %s clock to <hhmm> or system time\n", targetName);
     fprintf(stdout,"   -firmware <filename>: send firmware to %s\n", targetName);
@@ -1206,8 +4433,11 @@ void PrintUsage()
     fprintf(stdout,"   -batterylevel: report battery level in volts\n");
     fprintf(stdout,"   -sleep <timeout>: set %s sleep timeout in minutes\n", targetName);
     fprintf(stdout,"   -msg <number>: send IR message to %s\n", targetName);
-    fprintf(stdout,"   -raw <data>: format data as a packet and send to %s\n", targetName);
+    fprintf(stdout,"   -raw <data>[,<data>...]: format data as packets and send to %s\n", targetName);
     fprintf(stdout,"   -remote <value> <repeat>: invoke a remote command on the %s\n", targetName);
+    fprintf(stdout,"   -poll <type:data,...> <rounds>: read values from %s as fast as possible, print as CSV\n", targetName);
+    fprintf(stdout,"   -pollbin <type:data,...> <rounds>: like -poll, but print binary records\n");
+    fprintf(stdout,"   -stream: send each line of stdin (msg=<n> v<var>=<n> ...) to %s as it comes, unconfirmed\n", targetName);
     fprintf(stdout,"   -clear: erase all programs and datalog on %s\n", targetName);
 #endif
 }
@@ -1218,14 +4448,26 @@ RCX_Result AutoLink::Open()
 {
     RCX_Result result;
 
+    // in server and daemon mode the link stays open between requests
+    if (fOpen && (fOpenPort != fSerialPort || fOpenTarget != gTargetType))
+        Close();
+
     if (!fOpen) {
         ULong options = gTimeout & RCX_Link::kRxTimeoutMask;
         if (gVerbose) options |= RCX_Link::kVerboseMode;
 
-        result = RCX_Link::Open(gTargetType, fSerialPort, options);
+        result = RCX_Link::Open(gTargetType,
+            fSerialPort.empty() ? 0 : fSerialPort.c_str(), options);
         if (RCX_ERROR(result)) return result;
 
         fOpen = true;
+        fOpenPort = fSerialPort;
+        fOpenTarget = gTargetType;
+
+        if (gMetrics) {
+            SetStats(gMetrics->GetStats(GetPortName()));
+            gMetrics->SetTarget(GetPortName(), getTarget(gTargetType)->fName);
+        }
     }
     return kRCX_OK;
 }
@@ -1234,6 +4476,7 @@ RCX_Result AutoLink::Open()
 void AutoLink::Close()
 {
     if (fOpen) {
+        if (gMetrics) gMetrics->SetTimeout(GetPortName(), GetRxTimeout());
         RCX_Link::Close();
         fOpen = false;
     }
@@ -1258,89 +4501,270 @@ RCX_Result AutoLink::Send(const RCX_Cmd *cmd, bool retry)
 }
 
 
-bool AutoLink::DownloadProgress(int /* soFar */, int /* total */, int chunkSize)
+RCX_Result AutoLink::Send(const RCX_Cmd *const *cmds, int count, RCX_Result *results,
+    std::vector<UByte> *replies, bool retry)
 {
-    char c;
-    if (chunkSize <= 20) {
-        c = '-';
-    } else if (chunkSize <= 80) {
-        c = '.';
-    } else if (chunkSize <= 140) {
-        c = '+';
-    } else if (chunkSize <= 200) {
-        c = '*';
-    } else {
-        c = '#';
+    RCX_Result result;
+
+    result = Open();
+    if (!RCX_ERROR(result) && retry)
+        result = Sync();
+
+    if (RCX_ERROR(result)) {
+        for (int i=0; i<count; ++i)
+            results[i] = result;
+        return result;
     }
 
-    fputc(c, STDERR);
+    result = RCX_Link::Send(cmds, count, results, replies, retry);
+
+    return retry ? result : kRCX_OK;
+}
+
+
+/*
+ * One line on stderr for each transfer, rewritten in place as it goes
+ * on, with how fast it's going, the chunk size, the retries so far and
+ * the time left, so that a slow tower or a brick that's out of line
+ * shows up early.  It ends with a summary once everything is through.
+ */
+bool AutoLink::DownloadProgress(int soFar, int total, int chunkSize)
+{
+    double ms = GetProgressTime();
+    bool first = soFar <= chunkSize;
+    bool done = soFar >= total;
+
+    if (!first && !done && ms - fProgressShown < kProgressInterval)
+        return true;
+    fProgressShown = ms;
+
+    // a bundle sends several programs
+    if (first) EndProgress();
+    fProgressLine = true;
+
+    long rate = ms > 0 ? (long)(soFar * 1000.0 / ms) : 0;
+    long retries = GetProgressRetries();
+    const char *retryName = (retries == 1) ? "retry" : "retries";
+
+    if (done) {
+        fprintf(STDERR, "\r%d in %.1f s, %ld/s, %ld %s%24s", total, ms / 1000,
+            rate, retries, retryName, "");
+    }
+    else if (rate > 0) {
+        fprintf(STDERR, "\r%d/%d, %ld/s, chunk %d, %ld %s, %ld s left   ", soFar,
+            total, rate, chunkSize, retries, retryName, (total - soFar + rate - 1) / rate);
+    }
+    else {
+        fprintf(STDERR, "\r%d/%d, chunk %d, %ld %s   ", soFar, total,
+            chunkSize, retries, retryName);
+    }
     fflush(STDERR);
 
     return true;
 }
+
+
+void AutoLink::EndProgress()
+{
+    if (!fProgressLine) return;
+
+    fputc('\n', STDERR);
+    fProgressLine = false;
+}
+
+
+bool FleetLink::DownloadProgress(int soFar, int total, int /* chunkSize */)
+{
+    if (fProgress)
+        fProgress->Update(fIndex, total ? (int)((long)soFar * 100 / total) : 100);
+
+    return true;
+}
+
+
+void FleetProgress::Update(int brick, int percent)
+{
+#ifndef NO_THREADS
+    std::lock_guard<std::mutex> lock(fMutex);
+#endif
+
+    // a brick starts over for each program of a bundle, so the
+    // average can drop; only a new high is shown
+    fPercent[brick] = percent;
+
+    long sum = 0;
+    for(size_t i=0; i<fPercent.size(); ++i)
+        sum += fPercent[i];
+    int average = (int)(sum / (long)fPercent.size());
+
+    if (average / 10 > fShown / 10) {
+        fprintf(STDERR, "all %d: %d%%\n", (int)fPercent.size(), average);
+        fShown = average;
+    }
+}
 #endif
 
 void MyCompiler::AddError(const Error &e, const LexLocation *loc)
 {
+    Diagnostic d;
+
+    d.fKind = e.IsWarning() ? Diagnostic::kWarning : Diagnostic::kError;
+    d.fCode = e.GetCode();
+    d.fLoc.fIndex = kIllegalSrcIndex;
+
     // check the error count
     if (!e.IsWarning()) {
         int errorCount = ErrorHandler::Get()->GetErrorCount();
         // only print the first few errors
         if (errorCount > kMaxPrintedErrors) {
-            if (errorCount == kMaxPrintedErrors+1)
-                fprintf(gErrorStream, "Too many errors - only first %d reported\n", kMaxPrintedErrors);
+            if (errorCount != kMaxPrintedErrors+1) return;
+            d.fKind = Diagnostic::kTooMany;
+            fDiagnostics.push_back(d);
             return;
         }
     }
 
+    // the message is made now, since the data may not outlive the
+    // error; the rest waits for Flush()
     char msg[Error::kMaxErrorMsg];
     e.SPrint(msg);
+    d.fMessage = msg;
+    if (loc)
+        d.fLoc = *loc;
+
+    fDiagnostics.push_back(d);
+}
+
+
+void MyCompiler::Flush()
+{
+    if (fDiagnostics.empty()) return;
+
+    string out;
+    for(size_t i=0; i<fDiagnostics.size(); ++i) {
+        if (gErrorsJSON)
+            FormatJSON(fDiagnostics[i], out);
+        else
+            FormatText(fDiagnostics[i], out);
+    }
+    fDiagnostics.clear();
 
-    const char *errorType = e.IsWarning() ? "Warning" : "Error";
-    fprintf(gErrorStream, "# %s: %s\n", errorType, msg);
+    FILE *fp = GetErrorStream();
+    fwrite(out.data(), 1, out.size(), fp);
 
-    if (loc && loc->fIndex!=kIllegalSrcIndex) {
+    // this is a hack for Windows!
+    fflush(fp);
+}
+
+
+void MyCompiler::FormatText(const Diagnostic &d, string &out) const
+{
+    char line[Error::kMaxErrorMsg + 64];
+
+    if (d.fKind == Diagnostic::kTooMany) {
+        sprintf(line, "Too many errors - only first %d reported\n", kMaxPrintedErrors);
+        out += line;
+        return;
+    }
+
+    out += (d.fKind == Diagnostic::kWarning) ? "# Warning: " : "# Error: ";
+    out += d.fMessage;
+    out += '\n';
+
+    const LexLocation *loc = &d.fLoc;
+    if (loc->fIndex!=kIllegalSrcIndex) {
         Buffer *b = Compiler::Get()->GetBuffer(loc->fIndex);
         int lineStart = loc->fOffset;
-        int line = b->FindLine(lineStart);
+        int lineNumber = b->FindLine(lineStart);
         const char *ptr;
-        int i;
 
-        // print file/line info
-        fprintf(gErrorStream, "File \"%s\" ; line %d\n", b->GetName(), line);
+        // file/line info
+        out += "File \"";
+        out += b->GetName();
+        sprintf(line, "\" ; line %d\n", lineNumber);
+        out += line;
 
-        // print the code line
-        fprintf(gErrorStream, "# ");
-        for (ptr=b->GetData() + lineStart; *ptr != '\n'; ++ptr) {
-            putc((*ptr == '\t') ? ' ' : *ptr, gErrorStream);
-        }
+        // the code line
+        out += "# ";
+        for (ptr=b->GetData() + lineStart; *ptr != '\n' && *ptr != '\r'; ++ptr)
+            out += (*ptr == '\t') ? ' ' : *ptr;
 
         // mark the token
-        fprintf(gErrorStream,"\n# ");
-        for (i=0; i<(loc->fOffset-lineStart); i++)
-            putc(' ', gErrorStream);
-        for (i=0; i<loc->fLength; i++)
-            putc('^', gErrorStream);
-        fprintf(gErrorStream,"\n");
+        out += "\n# ";
+        out.append(loc->fOffset - lineStart, ' ');
+        out.append(loc->fLength, '^');
+        out += '\n';
     }
 
-    fprintf(gErrorStream, "#----------------------------------------------------------\n");
+    out += "#----------------------------------------------------------\n";
+}
 
-    // this is a hack for Windows!
-    fflush(gErrorStream);
+
+static void AppendJSONString(string &out, const char *s)
+{
+    out += '"';
+    for(; *s; ++s) {
+        unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += (char)c;
+        }
+        else if (c < 0x20) {
+            char hex[8];
+            sprintf(hex, "\\u%04x", c);
+            out += hex;
+        }
+        else
+            out += (char)c;
+    }
+    out += '"';
+}
+
+
+void MyCompiler::FormatJSON(const Diagnostic &d, string &out) const
+{
+    char number[128];
+
+    if (d.fKind == Diagnostic::kTooMany) {
+        sprintf(number, "{\"severity\":\"note\",\"message\":\"only the first %d errors are reported\"}\n", kMaxPrintedErrors);
+        out += number;
+        return;
+    }
+
+    out += (d.fKind == Diagnostic::kWarning) ? "{\"severity\":\"warning\"" : "{\"severity\":\"error\"";
+    sprintf(number, ",\"code\":%d,\"message\":", d.fCode);
+    out += number;
+    AppendJSONString(out, d.fMessage.c_str());
+
+    const LexLocation *loc = &d.fLoc;
+    if (loc->fIndex!=kIllegalSrcIndex) {
+        Buffer *b = Compiler::Get()->GetBuffer(loc->fIndex);
+        int lineStart = loc->fOffset;
+        int lineNumber = b->FindLine(lineStart);
+
+        out += ",\"file\":";
+        AppendJSONString(out, b->GetName());
+        sprintf(number, ",\"line\":%d,\"column\":%d,\"length\":%d",
+            lineNumber, (int)(loc->fOffset - lineStart) + 1, loc->fLength);
+        out += number;
+    }
+
+    out += "}\n";
 }
 
 
 Buffer *MyCompiler::CreateBuffer(const char *name)
 {
-    static char pathname[DirList::kMaxPathname];
+    string pathname;
 
     if (!fDirs.Find(name, pathname))
         return nil;
 
     Buffer *buf = new Buffer();
 
-    if (buf->Create(name, pathname)) {
+    if (buf->Create(name, pathname.c_str())) {
+        fIncludes.push_back(buf);
+        fIncludePaths.push_back(pathname);
         return buf;
     }
     else {
@@ -1350,6 +4774,107 @@ Buffer *MyCompiler::CreateBuffer(const char *name)
 }
 
 
+bool MyCompiler::GetIncludePath(const char *name, string &path)
+{
+    string pathname;
+
+    if (!fDirs.Find(name, pathname))
+        return false;
+
+    // the same file may be reached through different directories
+#ifdef WIN32
+    char full[_MAX_PATH];
+    path = _fullpath(full, pathname.c_str(), _MAX_PATH) ? full : pathname;
+#else
+    char *full = realpath(pathname.c_str(), 0);
+    path = full ? full : pathname;
+    free(full);
+#endif
+
+    return true;
+}
+
+
+/**
+ * A file's device and inode identify it however it is reached (links
+ * included), and are found once per name for each compile.
+ */
+bool MyCompiler::GetFileId(const char *name, string &id)
+{
+    map<string, string>::const_iterator i = fFileIds.find(name);
+    if (i != fFileIds.end()) {
+        id = i->second;
+        return !id.empty();
+    }
+
+#ifdef WIN32
+    // Windows has no inodes to go by
+    if (!GetIncludePath(name, id))
+        id.clear();
+#else
+    string pathname;
+    struct stat s;
+
+    id.clear();
+    if (fDirs.Find(name, pathname) && stat(pathname.c_str(), &s) == 0) {
+        char text[64];
+        snprintf(text, sizeof(text), "%lu:%lu", (unsigned long)s.st_dev, (unsigned long)s.st_ino);
+        id = text;
+    }
+#endif
+
+    fFileIds[name] = id;
+    return !id.empty();
+}
+
+
+PrecompiledHeader *MyCompiler::CreatePrecompiled(const char *name, const Buffer *source)
+{
+    string pathname;
+    struct stat sourceStat, pchStat;
+
+    if (fTokens && GetIncludePath(name, pathname)) {
+        if (PrecompiledHeader *h = OpenTokens(pathname, source))
+            return h;
+    }
+
+    if (!fDirs.Find(name, pathname) || stat(pathname.c_str(), &sourceStat) != 0)
+        return 0;
+
+    // foo.nqh is precompiled to foo.nqp, other names get .nqp appended
+    char *pchName = CreateFilename(pathname.c_str(), kNQHFileExtension, kNQPFileExtension);
+    PrecompiledHeader *h = 0;
+
+    if (stat(pchName, &pchStat) == 0 && pchStat.st_mtime >= sourceStat.st_mtime) {
+        h = new PrecompiledHeader();
+        if (!h->Open(pchName, source->GetLength())) {
+            delete h;
+            h = 0;
+        }
+    }
+
+    delete [] pchName;
+    return h;
+}
+
+
+PrecompiledHeader *MyCompiler::OpenTokens(const string &path, const Buffer *source) const
+{
+    if (!fTokens) return 0;
+
+    TokenCache::const_iterator i = fTokens->find(path);
+    if (i == fTokens->end() || i->second.empty()) return 0;
+
+    PrecompiledHeader *h = new PrecompiledHeader();
+    if (!h->Open(&i->second[0], i->second.size(), source->GetLength())) {
+        delete h;
+        return 0;
+    }
+
+    return h;
+}
+
+
 #ifdef TEST_LEXER
 void PrintToken(int t, TokenVal v)
 {
@@ -1369,7 +4894,11 @@ void PrintToken(int t, TokenVal v)
                 printf("if");
                 break;
             case STRING:
+#if TEST_LEXER == 3
                 printf("%s", v.fString);
+#else
+                printf("%s", LexGetString(v.fInt));
+#endif
                 break;
             default:
                 printf("0x%08x", v.fInt);
@@ -12,11 +12,13 @@
  *
  */
 #include <cstring>
+#include <new>
 #include "PHashTable.h"
 
-#ifdef DEBUG
+using std::memcmp;
+using std::memcpy;
+using std::memset;
 using std::strcmp;
-#endif
 
 PHashable::~PHashable() {
 }
@@ -27,23 +29,47 @@ bool PHashable::MatchKey(const char *key) {
 }
 
 
+bool PHashable::MatchKey(const char *key, size_t length) {
+    return memcmp(key, fKey, length)==0 && fKey[length]==0;
+}
+
+
 P_HashTable::P_HashTable(int size) {
-    fBuckets = new PListSS<PHashable>[size];
-    fSize = size;
+    fSize = 8;
+    while(fSize < size)
+        fSize *= 2;
+
+    fCount = 0;
+    fSlots = new Slot[fSize];
+    memset(fSlots, 0, fSize * sizeof(Slot));
+    fPool = nil;
 }
 
 
 P_HashTable::~P_HashTable() {
-    delete [] fBuckets;
+    delete [] fSlots;
+    FreePool();
+}
+
+
+PHashable* P_HashTable::_Find(const char *key, ULong hash) {
+    int mask = fSize - 1;
+
+    for (int i = (int)(hash & mask); fSlots[i].fItem; i = (i+1) & mask) {
+        if (fSlots[i].fHash == hash && fSlots[i].fItem->MatchKey(key))
+            return fSlots[i].fItem;
+    }
+
+    return nil;
 }
 
 
-PHashable* P_HashTable::_Find(const char *key) {
-    PHashable *ptr;
-    int hash = Hash(key);
+PHashable* P_HashTable::_Find(const char *key, size_t length, ULong hash) {
+    int mask = fSize - 1;
 
-    for (ptr=fBuckets[hash].GetHead(); ptr; ptr=ptr->GetNext()) {
-        if (ptr->MatchKey(key)) return ptr;
+    for (int i = (int)(hash & mask); fSlots[i].fItem; i = (i+1) & mask) {
+        if (fSlots[i].fHash == hash && fSlots[i].fItem->MatchKey(key, length))
+            return fSlots[i].fItem;
     }
 
     return nil;
@@ -51,42 +77,134 @@ PHashable* P_HashTable::_Find(const char *key) {
 
 
 void P_HashTable::Add(PHashable *item) {
-    int hash = Hash(item->GetKey());
+    // keep at least a quarter of the slots empty so probes stay short
+    if ((fCount + 1) * 4 > fSize * 3)
+        Grow();
 
-    fBuckets[hash].InsertHead(item);
+    Insert(Hash(item->GetKey()), item);
+    ++fCount;
 }
 
 
 bool P_HashTable::Remove(PHashable *item) {
-    int hash = Hash(item->GetKey());
+    int mask = fSize - 1;
+    int i;
+
+    for (i = (int)(Hash(item->GetKey()) & mask); fSlots[i].fItem != item; i = (i+1) & mask) {
+        if (!fSlots[i].fItem) return false;
+    }
+
+    // shift later items of the probe sequence back into the hole
+    // so that lookups never stop early
+    int hole = i;
+    for (i = (hole+1) & mask; fSlots[i].fItem; i = (i+1) & mask) {
+        int home = (int)(fSlots[i].fHash & mask);
+
+        // move the item unless its home lies cyclically in (hole, i]
+        if (((i - home) & mask) >= ((i - hole) & mask)) {
+            fSlots[hole] = fSlots[i];
+            hole = i;
+        }
+    }
 
-    return fBuckets[hash].Remove(item);
+    fSlots[hole].fItem = nil;
+    --fCount;
+    return true;
 }
 
 
 void P_HashTable::DeleteAll() {
-    int i;
-    PHashable *item;
+    for (int i=0; i<fSize; i++) {
+        delete fSlots[i].fItem;
+        fSlots[i].fItem = nil;
+    }
+
+    fCount = 0;
+    FreePool();
+}
+
+
+const char* P_HashTable::Intern(const char *key, size_t length) {
+    size_t n = length + 1;
+
+    if (!fPool || fPool->fSize - fPool->fUsed < n) {
+        size_t size = (n > kPoolChunkSize) ? n : kPoolChunkSize;
+        PoolChunk *c = (PoolChunk *) ::operator new(sizeof(PoolChunk) + size);
 
-    for (i=0; i<fSize; i++) {
-        while((item = fBuckets[i].RemoveHead()) != nil)
-            delete item;
+        c->fPrev = fPool;
+        c->fSize = size;
+        c->fUsed = 0;
+        fPool = c;
     }
+
+    char *ptr = fPool->Data() + fPool->fUsed;
+    memcpy(ptr, key, length);
+    ptr[length] = 0;
+    fPool->fUsed += n;
+
+    return ptr;
 }
 
 
-int P_HashTable::Hash(const char *string) {
-    unsigned long h=0,g;
-    const char *p;
+ULong P_HashTable::Hash(const char *string) {
+    // FNV-1a
+    ULong h = 2166136261UL;
 
-    for (p=string; *p != 0; p++) {
-        h = (h <<4) + (*p);
-        if ((g= h & 0xf0000000) != 0) {
-            h = h ^ (g >> 24);
-            h = h ^ g;
-        }
+    for (const char *p=string; *p != 0; p++) {
+        h = ((h ^ (UByte)*p) * 16777619UL) & 0xffffffffUL;
+    }
+
+    return h;
+}
+
+
+ULong P_HashTable::Hash(const char *key, size_t length) {
+    // the same hash as above, for a key whose length is known
+    ULong h = 2166136261UL;
+    const UByte *p = (const UByte *)key;
+    const UByte *end = p + length;
+
+    while(p < end)
+        h = ((h ^ *p++) * 16777619UL) & 0xffffffffUL;
+
+    return h;
+}
+
+
+void P_HashTable::Insert(ULong hash, PHashable *item) {
+    int mask = fSize - 1;
+    int i = (int)(hash & mask);
+
+    while(fSlots[i].fItem)
+        i = (i+1) & mask;
+
+    fSlots[i].fHash = hash;
+    fSlots[i].fItem = item;
+}
+
+
+void P_HashTable::Grow() {
+    Slot *old = fSlots;
+    int oldSize = fSize;
+
+    fSize *= 2;
+    fSlots = new Slot[fSize];
+    memset(fSlots, 0, fSize * sizeof(Slot));
+
+    for (int i=0; i<oldSize; i++) {
+        if (old[i].fItem)
+            Insert(old[i].fHash, old[i].fItem);
     }
 
-    return (int)(h % fSize);
+    delete [] old;
 }
 
+
+void P_HashTable::FreePool() {
+    while(fPool) {
+        PoolChunk *c = fPool;
+
+        fPool = c->fPrev;
+        ::operator delete((void *)c);
+    }
+}
@@ -14,27 +14,42 @@
 #ifndef __PHashTable_h
 #define __PHashTable_h
 
-#ifndef __PListS_h
-#include "PListS.h"
-#endif
-
 #ifndef __PTypes_h
 #include "PTypes.h"
 #endif
 
+#include <cstddef>
+#include <cstring>
+
+using std::size_t;
 
-class PHashable : public PLinkS<PHashable> {
+
+class PHashable {
 public:
 	virtual	~PHashable();
 
 	bool		MatchKey(const char *key);
+	// key need not be terminated; its length is known
+	bool		MatchKey(const char *key, size_t length);
 	const char*	GetKey() const { return fKey; }
 
 protected:
-	char*	fKey;
+	const char*	fKey;
 };
 
 
+/*
+ * An open addressing hash table with linear probing.  Each slot keeps
+ * the full hash of its key so that most mismatches are rejected
+ * without touching the item, and the table doubles in size when it
+ * becomes 3/4 full.
+ *
+ * The table also keeps a pool for the keys of its items (see Intern).
+ * Keys in the pool live as long as the table, or until DeleteAll().
+ *
+ * Slots are unordered; to visit every item, check each slot from 0
+ * to GetSlotCount()-1 and skip the empty ones.
+ */
 class P_HashTable {
 public:
 				P_HashTable(int size);
@@ -45,17 +60,48 @@ public:
 
 	void		DeleteAll();
 
-	int			Hash(const char *key);
+	/// Copy key into the table's pool
+	const char*	Intern(const char *key)	{ return Intern(key, std::strlen(key)); }
+	const char*	Intern(const char *key, size_t length);
+
+	static ULong	Hash(const char *key);
+	static ULong	Hash(const char *key, size_t length);
 
-	int			GetBucketCount() const	{ return fSize; }
+	int			GetSlotCount() const	{ return fSize; }
+	int			GetCount() const		{ return fCount; }
 
 protected:
-	PHashable*	_GetBucket(int i)	{ return fBuckets[i].GetHead(); }
-	PHashable*	_Find(const char *key);
+	PHashable*	_GetSlot(int i)		{ return fSlots[i].fItem; }
+	PHashable*	_Find(const char *key)	{ return _Find(key, Hash(key)); }
+	PHashable*	_Find(const char *key, ULong hash);
+	PHashable*	_Find(const char *key, size_t length, ULong hash);
 
 private:
-	int					fSize;
-	PListSS<PHashable>*	fBuckets;
+	struct Slot {
+		ULong		fHash;
+		PHashable*	fItem;
+	};
+
+	struct PoolChunk {
+		PoolChunk*	fPrev;
+		size_t		fSize;
+		size_t		fUsed;
+
+		char*		Data()	{ return (char *)(this + 1); }
+	};
+
+	enum {
+		kPoolChunkSize = 16 * 1024
+	};
+
+	void		Insert(ULong hash, PHashable *item);
+	void		Grow();
+	void		FreePool();
+
+	int			fSize;		// always a power of 2
+	int			fCount;
+	Slot*		fSlots;
+	PoolChunk*	fPool;
 };
 
 
@@ -65,7 +111,9 @@ public:
 				PHashTable(int size) : P_HashTable(size) {}
 
 	T*			Find(const char *key)	{ return (T*) _Find(key); }
-	T*			GetBucket(int i)		{ return (T*) _GetBucket(i); }
+	T*			Find(const char *key, ULong hash)	{ return (T*) _Find(key, hash); }
+	T*			Find(const char *key, size_t length, ULong hash)	{ return (T*) _Find(key, length, hash); }
+	T*			GetSlot(int i)			{ return (T*) _GetSlot(i); }
 };
 
 
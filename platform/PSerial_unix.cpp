@@ -24,6 +24,9 @@
 #include <sys/ioctl.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <poll.h>
+#include <time.h>
+#include <errno.h>
 #include <cstring>
 #include <termios.h>
 
@@ -47,6 +50,7 @@ public:
 	virtual void	Close();
 	virtual long	Write(const void *ptr, long count);
 	virtual void	FlushWrite();
+	virtual void	FlushRead();
 
 	virtual long	Read(void *ptr, long count);
 	virtual bool	SetTimeout(long timeout_ms);
@@ -65,8 +69,7 @@ private:
 };
 
 
-static int tv_ge(const struct timeval *a, const struct timeval *b);
-static void tv_sub(const struct timeval *a, struct timeval *b);
+static long NowMs();
 static bool SetTermiosSpeed(termios &tios, int speed);
 
 
@@ -225,6 +228,12 @@ void PSerial_unix::FlushWrite()
 }
 
 
+void PSerial_unix::FlushRead()
+{
+	tcflush(fTerm, TCIFLUSH);
+}
+
+
 bool PSerial_unix::SetTimeout(long timeout_ms)
 {
 	fTimeout = timeout_ms;
@@ -241,59 +250,42 @@ long PSerial_unix::Read(void *ptr, long count)
 		return rval;
 	}
 
-	// time limited read
+	// time limited read: wait for whatever has arrived and read all of
+	// it straight into the caller's buffer, until count bytes have come
+	// or the time is up
 	char *cur = (char *) ptr;
-	struct timeval expire;
-	struct timezone tz;
-
-	if (gettimeofday(&expire, &tz) < 0)
-	{
-		return -1;
-	}
-
-	expire.tv_sec += fTimeout / 1000;
-	expire.tv_usec += (fTimeout % 1000) * 1000;
+	long expire = NowMs() + fTimeout;
+	long remain = fTimeout;
 
 	while (count)
 	{
-		fd_set rfds;
-		FD_ZERO(&rfds);
-		FD_SET(fTerm, &rfds);
-		struct timeval delay;
-		long nread;
+		struct pollfd pfd;
+		pfd.fd = fTerm;
+		pfd.events = POLLIN;
 
-		if (gettimeofday(&delay, &tz) < 0)
+		int ready = poll(&pfd, 1, (int)remain);
+		if (ready < 0 && errno != EINTR)
 		{
 			return -1;
 		}
 
-		if (tv_ge(&delay, &expire))
-		{
-			// delay (current time) >= expire
-		  	break;
-		}
-
-		tv_sub(&expire, &delay);	// delay = expire - delay
-
-		if (select(fTerm + 1, &rfds, NULL, NULL, &delay))
+		if (ready > 0)
 		{
-			if (ioctl(fTerm, FIONREAD, &nread) < 0)
+			long nread = read(fTerm, cur, count);
+			if (nread < 0 && errno != EINTR && errno != EAGAIN)
 			{
 				return -1;
-		  	}
-
-		  	nread = (count < nread) ? count : nread;
-		  	if ((nread = read(fTerm, cur, nread)) < 0)
-		  	{
-				return -1;
-		  	}
-			count -= nread;
-			cur += nread;
+			}
+			if (nread > 0)
+			{
+				count -= nread;
+				cur += nread;
+			}
 		}
-		else
+
+		if (!count || (remain = expire - NowMs()) <= 0)
 		{
-		  // timeout
-		  break;
+			break;
 		}
 	} // while
 
@@ -370,32 +362,18 @@ bool SetTermiosSpeed(termios &tios, int speed)
 }
 
 
-int tv_ge(const struct timeval *a, const struct timeval *b)
+long NowMs()
 {
-	if (a->tv_sec < b->tv_sec)
-	return 0;			// asec < bsec
+#ifdef CLOCK_MONOTONIC
+	struct timespec ts;
 
-	if (a->tv_sec == b->tv_sec)
+	if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0)
 	{
-  		if (a->tv_usec < b->tv_usec)
-  		{
-			return 0;		// ausec < busec
-  		}
-		return 1;			// ausec >= busec
+		return (long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
 	}
-	return 1;			// asec > bsec
-}
-
+#endif
+	struct timeval tv;
 
-void tv_sub(const struct timeval *a, struct timeval *b)
-{
-	b->tv_sec = a->tv_sec - b->tv_sec;
-	b->tv_usec = a->tv_usec - b->tv_usec;
-	if (b->tv_usec < 0)
-	{
-		b->tv_usec += 1000000;
-		b->tv_sec--;
-	}
+	gettimeofday(&tv, 0);
+	return (long)tv.tv_sec * 1000 + tv.tv_usec / 1000;
 }
-
-
@@ -0,0 +1,177 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+
+/*
+ * PSerial for the WebAssembly build.  The page provides the port as
+ * Module.nqcSerial, an object with these methods (the ones that take
+ * time return promises):
+ *
+ *	open(name)				true if the port could be opened
+ *	setSpeed(speed, parity)	parity is "none", "odd" or "even"
+ *	setSignals(dtr, rts)
+ *	write(bytes)
+ *	read(count, timeout)	a Uint8Array of up to count bytes, once count
+ *							bytes have arrived or timeout ms have passed
+ *							(timeout < 0 waits for at least one byte)
+ *	flush()					discard whatever has arrived
+ *	close()
+ *
+ * emscripten/webserial.js implements it over WebSerial.
+ * The calls are made through Asyncify, so the rest of nqc can wait
+ * for the port as it would for any other.
+ */
+
+#include <emscripten.h>
+
+#include "PSerial.h"
+
+
+EM_ASYNC_JS(int, web_serial_open, (const char *name), {
+	if (!Module.nqcSerial) return 0;
+	return (await Module.nqcSerial.open(UTF8ToString(name))) ? 1 : 0;
+});
+
+EM_ASYNC_JS(int, web_serial_speed, (int speed, int parity), {
+	return (await Module.nqcSerial.setSpeed(speed, ["none", "odd", "even"][parity])) ? 1 : 0;
+});
+
+EM_ASYNC_JS(int, web_serial_signals, (int dtr, int rts), {
+	return (await Module.nqcSerial.setSignals(!!dtr, !!rts)) ? 1 : 0;
+});
+
+EM_ASYNC_JS(int, web_serial_write, (const void *ptr, int count), {
+	await Module.nqcSerial.write(HEAPU8.slice(ptr, ptr + count));
+	return count;
+});
+
+EM_ASYNC_JS(int, web_serial_read, (void *ptr, int count, int timeout), {
+	const data = await Module.nqcSerial.read(count, timeout);
+	HEAPU8.set(data, ptr);
+	return data.length;
+});
+
+EM_JS(void, web_serial_flush, (), {
+	Module.nqcSerial.flush();
+});
+
+EM_ASYNC_JS(void, web_serial_close, (), {
+	await Module.nqcSerial.close();
+});
+
+
+class PSerial_web : public PSerial
+{
+public:
+			PSerial_web(void);
+	virtual	bool	Open(const char *name);
+	virtual void	Close();
+	virtual long	Write(const void *ptr, long count);
+	virtual void	FlushRead();
+
+	virtual long	Read(void *ptr, long count);
+	virtual bool	SetTimeout(long timeout_ms);
+	virtual bool	SetSpeed(int speed, int opts = 0);
+	virtual bool	SetDTR(bool state);
+	virtual bool	SetRTS(bool state);
+
+private:
+	long	fTimeout;
+	bool	fDTR;
+	bool	fRTS;
+};
+
+
+PSerial* PSerial::NewSerial()
+{
+	return new PSerial_web();
+}
+
+
+const char *PSerial::GetDefaultName()
+{
+	return "web";
+}
+
+
+PSerial_web::PSerial_web(void) :
+	fTimeout(kPStream_NeverTimeout),
+	fDTR(false),
+	fRTS(false)
+{
+}
+
+
+bool PSerial_web::Open(const char *name)
+{
+	if (!web_serial_open(name)) return false;
+
+	fOpen = true;
+	return SetSpeed(2400, kPSerial_ParityOdd);
+}
+
+
+void PSerial_web::Close()
+{
+	if (fOpen) web_serial_close();
+	fOpen = false;
+}
+
+
+bool PSerial_web::SetSpeed(int speed, int opts)
+{
+	int parity = (opts & kPSerial_ParityMask) >> kPSerial_ParityShift;
+	if (parity > 2) return false;
+
+	return web_serial_speed(speed, parity) != 0;
+}
+
+
+bool PSerial_web::SetDTR(bool state)
+{
+	fDTR = state;
+	return web_serial_signals(fDTR, fRTS) != 0;
+}
+
+
+bool PSerial_web::SetRTS(bool state)
+{
+	fRTS = state;
+	return web_serial_signals(fDTR, fRTS) != 0;
+}
+
+
+long PSerial_web::Write(const void *ptr, long count)
+{
+	return web_serial_write(ptr, (int)count);
+}
+
+
+void PSerial_web::FlushRead()
+{
+	web_serial_flush();
+}
+
+
+bool PSerial_web::SetTimeout(long timeout_ms)
+{
+	fTimeout = timeout_ms;
+	return true;
+}
+
+
+long PSerial_web::Read(void *ptr, long count)
+{
+	return web_serial_read(ptr, (int)count,
+		(fTimeout == kPStream_NeverTimeout) ? -1 : (int)fTimeout);
+}
@@ -27,6 +27,7 @@ public:
 	virtual long	Read(void *ptr, long count);
 	virtual long	Write(const void *ptr, long count);
 	virtual void	FlushWrite();
+	virtual void	FlushRead();
 
 	virtual bool	SetTimeout(long timeout_ms);
 
@@ -211,3 +212,9 @@ void PSerial_win::FlushWrite()
 {
 	FlushFileBuffers(fFile);
 }
+
+
+void PSerial_win::FlushRead()
+{
+	PurgeComm(fFile, PURGE_RXCLEAR);
+}
@@ -13,6 +13,10 @@
  */
 #include "PStream.h"
 
+#include <cstring>
+
+using std::memcpy;
+
 bool PStream::ReadLine(char *ptr, int max)
 {
     bool ok = false;
@@ -48,3 +52,56 @@ bool PStream::SetBlocking(bool blocking)
 void PStream::FlushWrite()
 {
 }
+
+
+void PStream::FlushRead()
+{
+}
+
+
+long PStream::Put(const void *ptr, long count)
+{
+	if (count <= 0) return 0;
+
+	if (fHeld + count > kPStream_PutSize) {
+		if (!Flush()) return -1;
+
+		// too big to hold, so it goes now
+		if (count > kPStream_PutSize) {
+			bool ok = WriteAll(ptr, count);
+			FlushWrite();
+			return ok ? count : -1;
+		}
+	}
+
+	memcpy(fHeldData + fHeld, ptr, count);
+	fHeld += count;
+	return count;
+}
+
+
+bool PStream::Flush()
+{
+	if (fHeld == 0) return true;
+
+	bool ok = WriteAll(fHeldData, fHeld);
+	fHeld = 0;
+	FlushWrite();
+	return ok;
+}
+
+
+bool PStream::WriteAll(const void *ptr, long count)
+{
+	const UByte *data = (const UByte *)ptr;
+
+	// a Write() may take only part of it
+	while(count > 0) {
+		long n = Write(data, count);
+		if (n <= 0) return false;
+		data += n;
+		count -= n;
+	}
+
+	return true;
+}
@@ -21,11 +21,14 @@
 // timeout modes
 #define kPStream_NeverTimeout	-1
 
+// bytes Put() holds before it has to send them
+#define kPStream_PutSize		512
+
 
 class PStream
 {
 public:
-					PStream()	{ fOpen = false; }
+					PStream()	{ fOpen = false; fHeld = 0; }
 	virtual 		~PStream()	{ Close(); }
 
 	// Open(...) methods declared in subclasses
@@ -35,14 +38,28 @@ public:
 	virtual long	Write(const void *ptr, long count) = 0;
 
 	virtual void	FlushWrite();
+	virtual void	FlushRead();	// discard pending input without waiting
 	virtual bool	SetTimeout(long timeout_ms = kPStream_NeverTimeout);
 
 	virtual bool	ReadLine(char *ptr, int max);
 
 			bool	SetBlocking(bool blocking = true);	// backwards compat. call to SetTimeout()
 
+	// Put() holds what it's given until Flush() sends all of it with as
+	// few Write() calls as the system allows and then FlushWrite(), so a
+	// message put in pieces leaves without gaps between them.  Read()
+	// doesn't flush by itself, and Close() drops whatever is held.
+			long	Put(const void *ptr, long count);
+			bool	Flush();
+
 protected:
 	bool	fOpen;
+
+private:
+	bool	WriteAll(const void *ptr, long count);
+
+	UByte	fHeldData[kPStream_PutSize];
+	long	fHeld;
 };
 
 class PSeekStream : public PStream
@@ -0,0 +1,346 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "RCX_Asm.h"
+#include "RCX_Image.h"
+#include "RCX_Target.h"
+
+using std::sprintf;
+
+// the directives that begin and end each kind of chunk
+static const char *sBeginNames[kRCX_ChunkTypeCount] = { "task", "sub", "sound", "mood" };
+static const char *sEndNames[kRCX_ChunkTypeCount] = { "endt", "ends", "ends", "endm" };
+
+static string Trim(const string &s);
+static bool IsName(const string &s);
+static bool GetNumber(const string &text, int &value);
+static bool SameName(const string &a, const char *b);
+
+
+RCX_Asm::RCX_Asm(RCX_TargetType targetType) :
+    fTarget(targetType),
+    fDisasm(targetType),
+    fImage(0),
+    fInChunk(false),
+    fType(kRCX_TaskChunk),
+    fNumber(0),
+    fErrorLine(0)
+{
+}
+
+
+bool RCX_Asm::Assemble(const char *text, int length, RCX_Image &image)
+{
+    image.Clear();
+    image.SetTargetType(fTarget);
+
+    fImage = &image;
+    fInChunk = false;
+    fComment.clear();
+    fError.clear();
+    fErrorLine = 0;
+    memset(fDefined, 0, sizeof(fDefined));
+
+    const char *end = text + length;
+    int lineNumber = 0;
+
+    while(text < end) {
+        const char *eol = (const char *)memchr(text, '\n', end - text);
+        if (!eol) eol = end;
+
+        if (!ParseLine(string(text, eol - text), ++lineNumber))
+            return false;
+
+        text = eol + 1;
+    }
+
+    if (fInChunk)
+        return Fail(lineNumber, "missing \"%s\" at the end", sEndNames[fType]);
+
+    return true;
+}
+
+
+bool RCX_Asm::ParseLine(string line, int lineNumber)
+{
+    string comment;
+    size_t semi = line.find(';');
+
+    if (semi != string::npos) {
+        comment = Trim(line.substr(semi + 1));
+        line.erase(semi);
+    }
+    line = Trim(line);
+
+    // a chunk may be named by a comment on the line before it
+    string name = fComment;
+    fComment = line.empty() ? comment : "";
+    if (line.empty()) return true;
+
+    Statement s;
+    s.fLine = lineNumber;
+
+    // a label, which names the pc of the next instruction
+    size_t colon = line.find(':');
+    if (colon != string::npos) {
+        string label = Trim(line.substr(0, colon));
+        if (!IsName(label))
+            return Fail(lineNumber, "bad label \"%s\"", label.c_str());
+        if (!fInChunk || fType == kRCX_AnimationChunk)
+            return Fail(lineNumber, "label \"%s\" outside of a task, sub or sound", label.c_str());
+        if (fLabels.count(label))
+            return Fail(lineNumber, "label \"%s\" is defined twice", label.c_str());
+
+        fLabels[label] = (int)fStatements.size();
+        line = Trim(line.substr(colon + 1));
+        if (line.empty()) return true;
+    }
+
+    // a mood is just bytes, up to its end
+    if (fInChunk && fType == kRCX_AnimationChunk && !SameName(line, sEndNames[fType])) {
+        for(size_t i=0; i<line.size(); ) {
+            size_t n = line.find_first_of(" \t,", i);
+            if (n == string::npos) n = line.size();
+            if (n > i) s.fOperands.push_back(line.substr(i, n - i));
+            i = n + 1;
+        }
+        fStatements.push_back(s);
+        return true;
+    }
+
+    size_t n = 0;
+    while(n < line.size() && (isalnum((unsigned char)line[n]) || line[n] == '_'))
+        ++n;
+    if (n == 0)
+        return Fail(lineNumber, "expected an instruction instead of \"%s\"", line.c_str());
+
+    s.fName = line.substr(0, n);
+    string rest = Trim(line.substr(n));
+    for(size_t i=0; !rest.empty() && i<=rest.size(); ) {
+        size_t comma = rest.find(',', i);
+        if (comma == string::npos) comma = rest.size();
+
+        string operand = Trim(rest.substr(i, comma - i));
+        if (operand.empty())
+            return Fail(lineNumber, "missing operand for \"%s\"", s.fName.c_str());
+        s.fOperands.push_back(operand);
+        i = comma + 1;
+    }
+
+    // inside a chunk these are instructions (the Swan has a sub)
+    if (!fInChunk) {
+        for(int type=0; type<kRCX_ChunkTypeCount; ++type) {
+            if (SameName(s.fName, sBeginNames[type])) {
+                fName = IsName(name) ? name : "";
+                return BeginChunk(s);
+            }
+        }
+
+        return Fail(lineNumber, "\"%s\" outside of a task, sub, sound or mood", s.fName.c_str());
+    }
+
+    if (SameName(s.fName, sEndNames[fType]))
+        return EndChunk(s);
+
+    fStatements.push_back(s);
+    return true;
+}
+
+
+bool RCX_Asm::BeginChunk(const Statement &s)
+{
+    RCX_ChunkType type = kRCX_TaskChunk;
+    while(!SameName(s.fName, sBeginNames[type]))
+        type = (RCX_ChunkType)(type + 1);
+
+    int number;
+    if (s.fOperands.size() != 1 || !GetNumber(s.fOperands[0], number))
+        return Fail(s.fLine, "expected the number of the %s", sBeginNames[type]);
+
+    const RCX_Target::Range &range = getTarget(fTarget)->fRanges[type];
+    if (number < range.fBase || number >= range.fBase + range.fCount)
+        return Fail(s.fLine, "%s number out of range for the target", sBeginNames[type]);
+
+    char chunk[32];
+    sprintf(chunk, "%s %d", sBeginNames[type], number);
+    if (fDefined[type][number])
+        return Fail(s.fLine, "%s is defined twice", chunk);
+    fDefined[type][number] = true;
+
+    fInChunk = true;
+    fType = type;
+    fNumber = number;
+    fStatements.clear();
+    fLabels.clear();
+
+    if (fName.empty()) {
+        sprintf(chunk, "%s%d", sBeginNames[type], number);
+        fName = chunk;
+    }
+
+    return true;
+}
+
+
+bool RCX_Asm::EndChunk(const Statement &s)
+{
+    if (!s.fOperands.empty())
+        return Fail(s.fLine, "\"%s\" doesn't take operands", s.fName.c_str());
+
+    vector<UByte> code;
+    bool ok = (fType == kRCX_AnimationChunk) ? AssembleData(code) : AssembleCode(code);
+    if (!ok) return false;
+
+    fImage->AddChunk(fType, (UByte)fNumber, code.empty() ? 0 : &code[0], (int)code.size(),
+        fName.c_str(), 0, 0);
+    fInChunk = false;
+
+    return true;
+}
+
+
+/*
+ * The first pass places the labels: the length of an instruction
+ * doesn't depend on its operands, so each label is taken to be where
+ * it's used until then.  The second pass encodes the jumps.
+ */
+bool RCX_Asm::AssembleCode(vector<UByte> &code)
+{
+    vector<int> pcs(fStatements.size() + 1);
+
+    for(int pass=0; pass<2; ++pass) {
+        code.clear();
+
+        for(size_t i=0; i<fStatements.size(); ++i) {
+            const Statement &s = fStatements[i];
+            vector<int> operands(s.fOperands.size());
+
+            pcs[i] = (int)code.size();
+            for(size_t j=0; j<operands.size(); ++j) {
+                if (!GetValue(s.fOperands[j], pass ? &pcs : 0, pcs[i], operands[j]))
+                    return Fail(s.fLine, "unknown label \"%s\"", s.fOperands[j].c_str());
+            }
+
+            switch(fDisasm.Encode(fType, s.fName.c_str(), operands, code)) {
+                case RCX_Disasm::kUnknownInstruction:
+                    return Fail(s.fLine, "unknown instruction \"%s\" for the target", s.fName.c_str());
+                case RCX_Disasm::kWrongOperandCount:
+                    return Fail(s.fLine, "wrong number of operands for \"%s\"", s.fName.c_str());
+                case RCX_Disasm::kOperandRange:
+                    return Fail(s.fLine, "operand out of range for \"%s\"", s.fName.c_str());
+                case RCX_Disasm::kNoLASMOperands:
+                    return Fail(s.fLine, "\"%s\" can't be assembled", s.fName.c_str());
+                default:
+                    break;
+            }
+        }
+
+        pcs.back() = (int)code.size();
+    }
+
+    return true;
+}
+
+
+bool RCX_Asm::AssembleData(vector<UByte> &code)
+{
+    for(size_t i=0; i<fStatements.size(); ++i) {
+        const Statement &s = fStatements[i];
+
+        for(size_t j=0; j<s.fOperands.size(); ++j) {
+            int value;
+            if (!GetNumber(s.fOperands[j], value) || value < -128 || value > 255)
+                return Fail(s.fLine, "expected a byte instead of \"%s\"", s.fOperands[j].c_str());
+            code.push_back((UByte)value);
+        }
+    }
+
+    return true;
+}
+
+
+/*
+ * A number, or the pc of a label (pc itself if pcs is 0, for the first
+ * pass).
+ */
+bool RCX_Asm::GetValue(const string &text, const vector<int> *pcs, int pc, int &value) const
+{
+    if (GetNumber(text, value)) return true;
+
+    map<string, int>::const_iterator label = fLabels.find(text);
+    if (label == fLabels.end()) return false;
+
+    value = pcs ? (*pcs)[label->second] : pc;
+    return true;
+}
+
+
+bool RCX_Asm::Fail(int lineNumber, const char *format, const char *arg)
+{
+    char buf[256];
+
+    snprintf(buf, sizeof(buf), format, arg);
+    fError = buf;
+    fErrorLine = lineNumber;
+
+    return false;
+}
+
+
+string Trim(const string &s)
+{
+    size_t start = s.find_first_not_of(" \t\r");
+    if (start == string::npos) return "";
+
+    size_t end = s.find_last_not_of(" \t\r");
+    return s.substr(start, end - start + 1);
+}
+
+
+bool IsName(const string &s)
+{
+    if (s.empty() || isdigit((unsigned char)s[0])) return false;
+
+    for(size_t i=0; i<s.size(); ++i)
+        if (!isalnum((unsigned char)s[i]) && s[i] != '_') return false;
+
+    return true;
+}
+
+
+bool GetNumber(const string &text, int &value)
+{
+    char *end;
+    long n = strtol(text.c_str(), &end, 0);
+
+    if (text.empty() || *end || n < -32768 || n > 65535) return false;
+
+    value = (int)n;
+    return true;
+}
+
+
+bool SameName(const string &a, const char *b)
+{
+    if (a.size() != strlen(b)) return false;
+
+    for(size_t i=0; i<a.size(); ++i)
+        if (tolower((unsigned char)a[i]) != b[i]) return false;
+
+    return true;
+}
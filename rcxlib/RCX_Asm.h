@@ -0,0 +1,95 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __RCX_Asm_h
+#define __RCX_Asm_h
+
+#ifndef __RCX_Disasm_h
+#include "RCX_Disasm.h"
+#endif
+
+#include <map>
+#include <string>
+#include <vector>
+
+using std::map;
+using std::string;
+using std::vector;
+
+class RCX_Image;
+
+/*
+ * Assembles LASM, in the form of a -c listing, straight into an image:
+ *
+ *  ;main
+ *      task    0
+ *      setv    0, 2, 10
+ *  t0000:
+ *      sumv    0, 2, 1
+ *      jmpl    t0000
+ *      endt
+ *
+ * Tasks, subs and sounds hold one instruction per line, named as in the
+ * disassembler's tables (for the image's target), with their operands
+ * as the listing prints them.  A jump's target is a label in the same
+ * chunk or a pc.  Moods hold their bytes as numbers.  A comment that is
+ * just a name, on the line before a chunk, names the chunk.
+ */
+class RCX_Asm
+{
+public:
+    RCX_Asm(RCX_TargetType targetType);
+
+    /// Replace the image's contents with the chunks assembled from
+    /// text.  Returns false if there is an error, which GetError() and
+    /// GetErrorLine() describe.
+    bool    Assemble(const char *text, int length, RCX_Image &image);
+
+    const char* GetError() const    { return fError.c_str(); }
+    int     GetErrorLine() const    { return fErrorLine; }
+
+private:
+    struct Statement {
+        int             fLine;
+        string          fName;
+        vector<string>  fOperands;
+    };
+
+    bool    ParseLine(string line, int lineNumber);
+    bool    BeginChunk(const Statement &s);
+    bool    EndChunk(const Statement &s);
+    bool    AssembleCode(vector<UByte> &code);
+    bool    AssembleData(vector<UByte> &code);
+    bool    GetValue(const string &text, const vector<int> *pcs, int pc, int &value) const;
+    bool    Fail(int lineNumber, const char *format, const char *arg = "");
+
+    RCX_TargetType  fTarget;
+    RCX_Disasm      fDisasm;
+    RCX_Image*      fImage;
+
+    // the chunk being assembled
+    bool            fInChunk;
+    RCX_ChunkType   fType;
+    int             fNumber;
+    string          fName;
+    vector<Statement>   fStatements;
+    map<string, int>    fLabels;    // statement each one is before
+
+    string          fComment;       // of the line before, if it was one
+    bool            fDefined[kRCX_ChunkTypeCount][256];
+
+    string          fError;
+    int             fErrorLine;
+};
+
+#endif
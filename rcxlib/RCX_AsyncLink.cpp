@@ -0,0 +1,387 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include <deque>
+
+#include "RCX_AsyncLink.h"
+#include "RCX_Cmd.h"
+#include "RCX_Log.h"
+
+// RCX_AsyncLink.h decides whether there are threads
+#ifndef NO_THREADS
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#endif
+
+using std::deque;
+
+/*
+ * The link the requests are carried out on.  Downloads report their
+ * progress through it, which is also where a cancel stops them.
+ */
+class RCX_AsyncLink_Link : public RCX_Link
+{
+public:
+    RCX_AsyncLink_Link() : fCancel(false), fSoFar(0), fTotal(0) {}
+
+    bool DownloadProgress(int soFar, int total, int chunkSize);
+
+    void Begin();
+    void Cancel();
+    void GetProgress(int &soFar, int &total);
+
+private:
+#ifndef NO_THREADS
+    std::mutex  fMutex;
+#endif
+    bool        fCancel;
+    int         fSoFar;
+    int         fTotal;
+};
+
+
+#ifndef NO_THREADS
+#define LOCK(m) std::lock_guard<std::mutex> lock(m)
+#else
+#define LOCK(m)
+#endif
+
+
+bool RCX_AsyncLink_Link::DownloadProgress(int soFar, int total, int /* chunkSize */)
+{
+    LOCK(fMutex);
+    fSoFar = soFar;
+    fTotal = total;
+    return !fCancel;
+}
+
+
+void RCX_AsyncLink_Link::Begin()
+{
+    LOCK(fMutex);
+    fCancel = false;
+    fSoFar = 0;
+    fTotal = 0;
+}
+
+
+void RCX_AsyncLink_Link::Cancel()
+{
+    LOCK(fMutex);
+    fCancel = true;
+}
+
+
+void RCX_AsyncLink_Link::GetProgress(int &soFar, int &total)
+{
+    LOCK(fMutex);
+    soFar = fSoFar;
+    total = fTotal;
+}
+
+
+struct RCX_AsyncLink::Worker {
+    RCX_AsyncLink_Link      fLink;
+    deque<Request*>         fQueue;     // waiting to be carried out
+    deque<Request*>         fDone;      // waiting to be dispatched
+    int                     fPending;
+#ifndef NO_THREADS
+    std::mutex              fMutex;
+    std::condition_variable fWake;
+    std::thread             fThread;
+    bool                    fStop;
+    bool                    fBusy;
+
+    void Run(RCX_AsyncLink *owner);
+#endif
+};
+
+
+RCX_AsyncLink::RCX_AsyncLink()
+{
+    fWorker = new Worker;
+    fWorker->fPending = 0;
+#ifndef NO_THREADS
+    fWorker->fStop = false;
+    fWorker->fBusy = false;
+    fWorker->fThread = std::thread(&Worker::Run, fWorker, this);
+#endif
+}
+
+
+RCX_AsyncLink::~RCX_AsyncLink()
+{
+#ifndef NO_THREADS
+    {
+        LOCK(fWorker->fMutex);
+        fWorker->fStop = true;
+    }
+    fWorker->fLink.Cancel();
+    fWorker->fWake.notify_one();
+    fWorker->fThread.join();
+#endif
+
+    // the completions of anything left over are never delivered
+    while (!fWorker->fQueue.empty()) {
+        delete fWorker->fQueue.front();
+        fWorker->fQueue.pop_front();
+    }
+    while (!fWorker->fDone.empty()) {
+        delete fWorker->fDone.front();
+        fWorker->fDone.pop_front();
+    }
+
+    delete fWorker;
+}
+
+
+#ifndef NO_THREADS
+void RCX_AsyncLink::Worker::Run(RCX_AsyncLink *owner)
+{
+    while (true) {
+        Request *r;
+        {
+            std::unique_lock<std::mutex> lock(fMutex);
+            while (!fStop && fQueue.empty())
+                fWake.wait(lock);
+            if (fStop) return;
+            r = fQueue.front();
+            fQueue.pop_front();
+            fBusy = true;
+            fLink.Begin();
+        }
+
+        owner->Perform(r);
+
+        LOCK(fMutex);
+        fBusy = false;
+        fDone.push_back(r);
+    }
+}
+#endif
+
+
+RCX_AsyncLink::Request* RCX_AsyncLink::NewRequest(Kind kind, Completion done, void *context)
+{
+    Request *r = new Request;
+    r->fKind = kind;
+    r->fDone = done;
+    r->fContext = context;
+    r->fTarget = kRCX_RCXTarget;
+    r->fOptions = 0;
+    r->fRetry = true;
+    r->fImage = 0;
+    r->fProgram = 0;
+    r->fFirmware = 0;
+    r->fFast = false;
+    r->fValue = 0;
+    r->fLog = 0;
+    r->fResult = kRCX_OK;
+    return r;
+}
+
+
+void RCX_AsyncLink::Submit(Request *r)
+{
+#ifndef NO_THREADS
+    {
+        LOCK(fWorker->fMutex);
+        fWorker->fQueue.push_back(r);
+        fWorker->fPending++;
+    }
+    fWorker->fWake.notify_one();
+#else
+    fWorker->fPending++;
+    fWorker->fLink.Begin();
+    Perform(r);
+    fWorker->fDone.push_back(r);
+#endif
+}
+
+
+void RCX_AsyncLink::Perform(Request *r)
+{
+    RCX_Link &link = fWorker->fLink;
+
+    switch(r->fKind) {
+        case kOpen:
+            r->fResult = link.Open(r->fTarget, r->fPort.c_str(), r->fOptions);
+            break;
+        case kClose:
+            link.Close();
+            break;
+        case kSend:
+            r->fResult = link.Send(&r->fData[0], (int)r->fData.size(), r->fRetry);
+            r->fData.clear();
+            if (r->fResult > 0) {
+                r->fData.resize(r->fResult);
+                link.GetReply(&r->fData[0], r->fResult);
+            }
+            break;
+        case kDownload:
+            r->fResult = link.Download(*r->fImage, r->fProgram);
+            break;
+        case kFirmware:
+            r->fResult = link.DownloadFirmware(*r->fFirmware, r->fFast);
+            break;
+        case kGetValue:
+            r->fResult = link.GetValue(r->fValue);
+            break;
+        case kBattery:
+            r->fResult = link.GetBatteryLevel();
+            break;
+        case kUpload:
+            r->fResult = r->fLog->Upload(&link);
+            break;
+    }
+}
+
+
+void RCX_AsyncLink::Open(RCX_TargetType target, const char *portName, ULong options,
+    Completion done, void *context)
+{
+    Request *r = NewRequest(kOpen, done, context);
+    r->fTarget = target;
+    if (portName) r->fPort = portName;
+    r->fOptions = options;
+    Submit(r);
+}
+
+
+void RCX_AsyncLink::Close(Completion done, void *context)
+{
+    Submit(NewRequest(kClose, done, context));
+}
+
+
+void RCX_AsyncLink::Send(const RCX_Cmd *cmd, bool retry, Completion done, void *context)
+{
+    Send(cmd->GetBody(), cmd->GetLength(), retry, done, context);
+}
+
+
+void RCX_AsyncLink::Send(const UByte *data, int length, bool retry, Completion done,
+    void *context)
+{
+    Request *r = NewRequest(kSend, done, context);
+    r->fData.assign(data, data + length);
+    r->fRetry = retry;
+    Submit(r);
+}
+
+
+void RCX_AsyncLink::Download(const RCX_Image &image, int programNumber,
+    Completion done, void *context)
+{
+    Request *r = NewRequest(kDownload, done, context);
+    r->fImage = &image;
+    r->fProgram = programNumber;
+    Submit(r);
+}
+
+
+void RCX_AsyncLink::DownloadFirmware(RCX_Firmware &firmware, bool fast,
+    Completion done, void *context)
+{
+    Request *r = NewRequest(kFirmware, done, context);
+    r->fFirmware = &firmware;
+    r->fFast = fast;
+    Submit(r);
+}
+
+
+void RCX_AsyncLink::GetValue(RCX_Value value, Completion done, void *context)
+{
+    Request *r = NewRequest(kGetValue, done, context);
+    r->fValue = value;
+    Submit(r);
+}
+
+
+void RCX_AsyncLink::GetBatteryLevel(Completion done, void *context)
+{
+    Submit(NewRequest(kBattery, done, context));
+}
+
+
+void RCX_AsyncLink::UploadDatalog(RCX_Log &log, Completion done, void *context)
+{
+    Request *r = NewRequest(kUpload, done, context);
+    r->fLog = &log;
+    Submit(r);
+}
+
+
+int RCX_AsyncLink::Dispatch()
+{
+    deque<Request*> done;
+    {
+        LOCK(fWorker->fMutex);
+        done.swap(fWorker->fDone);
+    }
+
+    int count = (int)done.size();
+    while (!done.empty()) {
+        Request *r = done.front();
+        done.pop_front();
+        {
+            LOCK(fWorker->fMutex);
+            fWorker->fPending--;
+        }
+        if (r->fDone) {
+            const UByte *reply = r->fData.empty() ? 0 : &r->fData[0];
+            r->fDone(r->fResult, reply, (int)r->fData.size(), r->fContext);
+        }
+        delete r;
+    }
+
+    return count;
+}
+
+
+int RCX_AsyncLink::Pending() const
+{
+    LOCK(fWorker->fMutex);
+    return fWorker->fPending;
+}
+
+
+void RCX_AsyncLink::Cancel()
+{
+    LOCK(fWorker->fMutex);
+    while (!fWorker->fQueue.empty()) {
+        Request *r = fWorker->fQueue.front();
+        fWorker->fQueue.pop_front();
+        r->fResult = kRCX_AbortError;
+        r->fData.clear();
+        fWorker->fDone.push_back(r);
+    }
+#ifndef NO_THREADS
+    // only stop the request in progress, not the next one submitted
+    if (fWorker->fBusy)
+#endif
+        fWorker->fLink.Cancel();
+}
+
+
+void RCX_AsyncLink::GetProgress(int &soFar, int &total) const
+{
+    fWorker->fLink.GetProgress(soFar, total);
+}
+
+
+RCX_Link& RCX_AsyncLink::GetLink()
+{
+    return fWorker->fLink;
+}
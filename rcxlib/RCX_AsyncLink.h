@@ -0,0 +1,137 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __RCX_AsyncLink_h
+#define __RCX_AsyncLink_h
+
+#ifndef __RCX_Link_h
+#include "RCX_Link.h"
+#endif
+
+#include <string>
+#include <vector>
+
+// the worker thread needs C++11 (<thread> and <mutex>), and emscripten
+// only supports threads when building with pthreads
+#if !defined(NO_THREADS) && (__cplusplus < 201103L || \
+    (defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)))
+#define NO_THREADS
+#endif
+
+class RCX_Cmd;
+class RCX_Image;
+class RCX_Firmware;
+class RCX_Log;
+
+/*
+ * An RCX_Link that doesn't block the caller.  Each call queues a
+ * request and returns at once; a worker thread owned by the link
+ * carries the requests out in order, and their completions are
+ * handed back on the caller's thread by Dispatch().  One thread can
+ * drive many links this way by calling Dispatch() on each of them
+ * (from its UI timer or event loop, for example).
+ *
+ * Completions get the result of the request (as returned by the
+ * blocking RCX_Link call) and, for Send(), the reply data.  The
+ * image, firmware or log passed to a request must stay valid until
+ * its completion has been dispatched.  Settings on GetLink() should
+ * only be changed while nothing is pending.
+ *
+ * Without threads (NO_THREADS) each request is carried out when it
+ * is queued, so the calls block, but completions are still only
+ * delivered by Dispatch().
+ */
+class RCX_AsyncLink
+{
+public:
+    typedef void (*Completion)(RCX_Result result, const UByte *reply,
+        int length, void *context);
+
+    RCX_AsyncLink();
+    ~RCX_AsyncLink();
+
+    void Open(RCX_TargetType target, const char *portName, ULong options,
+        Completion done = 0, void *context = 0);
+    void Close(Completion done = 0, void *context = 0);
+
+    void Send(const RCX_Cmd *cmd, bool retry, Completion done,
+        void *context = 0);
+    void Send(const UByte *data, int length, bool retry, Completion done,
+        void *context = 0);
+    void Download(const RCX_Image &image, int programNumber,
+        Completion done, void *context = 0);
+    void DownloadFirmware(RCX_Firmware &firmware, bool fast,
+        Completion done, void *context = 0);
+    void GetValue(RCX_Value value, Completion done, void *context = 0);
+    void GetBatteryLevel(Completion done, void *context = 0);
+    void UploadDatalog(RCX_Log &log, Completion done, void *context = 0);
+
+    /// deliver the completions of finished requests, returns how many
+    int Dispatch();
+    /// requests queued or in progress whose completions haven't been
+    /// dispatched yet
+    int Pending() const;
+    /// drop the queued requests and stop the one in progress at the
+    /// next download message; their completions get kRCX_AbortError
+    void Cancel();
+    /// how far the download in progress has got (both 0 if none)
+    void GetProgress(int &soFar, int &total) const;
+
+    RCX_Link& GetLink();
+
+private:
+    enum Kind {
+        kOpen,
+        kClose,
+        kSend,
+        kDownload,
+        kFirmware,
+        kGetValue,
+        kBattery,
+        kUpload
+    };
+
+    struct Request {
+        Kind fKind;
+        Completion fDone;
+        void *fContext;
+
+        RCX_TargetType fTarget;
+        std::string fPort;
+        ULong fOptions;
+        std::vector<UByte> fData;   // command, then reply
+        bool fRetry;
+        const RCX_Image *fImage;
+        int fProgram;
+        RCX_Firmware *fFirmware;
+        bool fFast;
+        RCX_Value fValue;
+        RCX_Log *fLog;
+
+        RCX_Result fResult;
+    };
+
+    struct Worker;
+
+    Request* NewRequest(Kind kind, Completion done, void *context);
+    void Submit(Request *r);
+    void Perform(Request *r);
+
+    Worker* fWorker;
+
+    // not copyable
+    RCX_AsyncLink(const RCX_AsyncLink&);
+    RCX_AsyncLink& operator=(const RCX_AsyncLink&);
+};
+
+#endif
@@ -0,0 +1,127 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include <cstdio>
+#include <cstring>
+#include "RCX_BrickProfiles.h"
+
+using std::fopen;
+using std::strlen;
+using std::sscanf;
+
+#define kProfilesHeader "nqc-profiles 1\n"
+#define kMaxLine        1024
+
+// RAM versions of RCX firmware from 2.0 on
+#define kRCX2Firmware   0x00030200UL
+
+
+RCX_BrickProfiles::RCX_BrickProfiles(const char *filename) :
+    fFilename(filename)
+{
+    Load();
+}
+
+
+bool RCX_BrickProfiles::Find(const string &port, Profile &profile) const
+{
+    map<string, Profile>::const_iterator i = fProfiles.find(port);
+    if (i == fProfiles.end()) return false;
+
+    profile = i->second;
+    return true;
+}
+
+
+void RCX_BrickProfiles::Store(const string &port, const Profile &profile)
+{
+    map<string, Profile>::iterator i = fProfiles.find(port);
+    if (i != fProfiles.end() && i->second == profile)
+        return;
+
+    fProfiles[port] = profile;
+    Save();
+}
+
+
+RCX_TargetType RCX_BrickProfiles::GetTarget(RCX_TargetType target, ULong rom, ULong ram)
+{
+    // the Swan runs firmware of its own, and without firmware there's
+    // nothing to go on
+    if ((target != kRCX_RCXTarget && target != kRCX_RCX2Target) || ram == 0 || rom == 0)
+        return target;
+
+    return ram >= kRCX2Firmware ? kRCX_RCX2Target : kRCX_RCXTarget;
+}
+
+
+/*
+ * The file holds one line per port:
+ *
+ *  <target> <rom> <ram> <fast> <chunk> <timeout> <port name>
+ *
+ * with the versions in hex.  Anything that doesn't parse ends the file.
+ */
+void RCX_BrickProfiles::Load()
+{
+    FILE *fp = fopen(fFilename.c_str(), "r");
+    if (!fp) return;
+
+    char line[kMaxLine];
+
+    if (!fgets(line, sizeof(line), fp) || strcmp(line, kProfilesHeader) != 0) {
+        fclose(fp);
+        return;
+    }
+
+    while(fgets(line, sizeof(line), fp)) {
+        size_t n = strlen(line);
+        if (n && line[n-1]=='\n') line[--n] = 0;
+
+        Profile p;
+        unsigned long rom, ram;
+        int target, port = 0;
+
+        if (sscanf(line, "%d %lx %lx %d %d %d %n", &target, &rom, &ram,
+                &p.fFast, &p.fChunk, &p.fTimeout, &port) < 6 || port == 0 ||
+            target < 0 || target > kRCX_SwanTarget || p.fFast < -1 || p.fFast > 1 ||
+            p.fChunk < 0 || p.fTimeout < 0 || p.fTimeout > 0xffff || !line[port])
+            break;
+
+        p.fTarget = (RCX_TargetType)target;
+        p.fRom = rom;
+        p.fRam = ram;
+        fProfiles[line + port] = p;
+    }
+
+    fclose(fp);
+}
+
+
+void RCX_BrickProfiles::Save() const
+{
+    FILE *fp = fopen(fFilename.c_str(), "w");
+    if (!fp) return;
+
+    fputs(kProfilesHeader, fp);
+
+    map<string, Profile>::const_iterator i;
+    for(i = fProfiles.begin(); i != fProfiles.end(); ++i) {
+        const Profile &p = i->second;
+        fprintf(fp, "%d %08lx %08lx %d %d %d %s\n", (int)p.fTarget,
+            (unsigned long)p.fRom, (unsigned long)p.fRam, p.fFast, p.fChunk,
+            p.fTimeout, i->first.c_str());
+    }
+
+    fclose(fp);
+}
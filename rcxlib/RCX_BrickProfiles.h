@@ -0,0 +1,85 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __RCX_BrickProfiles_h
+#define __RCX_BrickProfiles_h
+
+#ifndef __PTypes_h
+#include "PTypes.h"
+#endif
+
+#ifndef __RCX_Target_h
+#include "RCX_Target.h"
+#endif
+
+#include <string>
+#include <map>
+
+using std::string;
+using std::map;
+
+/*
+ * What was learned about the brick on each port, saved in a file so
+ * that the next link on the port opens already tuned for it instead of
+ * finding out again through retries and timeouts.  A port's profile is
+ * the brick that last answered on it: its target (as told by its
+ * versions), whether it can take a fast firmware download, the largest
+ * firmware message that went through there without retries, and the
+ * reply timeout the port settled on.  When another brick answers the
+ * rest is learned over.
+ */
+class RCX_BrickProfiles
+{
+public:
+    struct Profile {
+        RCX_TargetType fTarget;
+        ULong fRom;
+        ULong fRam;
+        int fFast;      ///< 1 if fast mode worked, 0 if it didn't, -1 if not tried
+        int fChunk;     ///< largest reliable firmware message, 0 if not known
+        int fTimeout;   ///< reply timeout in ms, 0 if not known
+
+        void Clear(RCX_TargetType target) {
+            fTarget = target;
+            fRom = fRam = 0;
+            fFast = -1;
+            fChunk = fTimeout = 0;
+        }
+        bool SameBrick(const Profile &p) const {
+            return fRom == p.fRom && fRam == p.fRam;
+        }
+        bool operator==(const Profile &p) const {
+            return fTarget == p.fTarget && SameBrick(p) && fFast == p.fFast &&
+                fChunk == p.fChunk && fTimeout == p.fTimeout;
+        }
+    };
+
+    RCX_BrickProfiles(const char *filename);
+
+    bool Find(const string &port, Profile &profile) const;
+    // the file is saved each time a profile changes
+    void Store(const string &port, const Profile &profile);
+
+    /// the target a brick with these versions runs as, given the one it
+    /// was opened for (only an RCX tells the firmware apart)
+    static RCX_TargetType GetTarget(RCX_TargetType target, ULong rom, ULong ram);
+
+private:
+    void Load();
+    void Save() const;
+
+    string fFilename;
+    map<string, Profile> fProfiles;
+};
+
+#endif
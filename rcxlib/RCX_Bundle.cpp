@@ -0,0 +1,206 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include <cstring>
+#include <cstdio>
+#include "RCX_Bundle.h"
+#include "RCX_Image.h"
+#include "RCX_Link.h"
+
+#include "rcxifile.h"
+
+using std::fopen;
+using std::memchr;
+
+#define kBundleHeaderSize   12
+#define kProgramHeaderSize  8
+
+// from RCX_Image.cpp
+void Write4(ULong d, FILE *fp);
+void Write2(UShort d, FILE *fp);
+
+static ULong Get4(const UByte *ptr);
+static UShort Get2(const UByte *ptr);
+static void WritePadding(int length, FILE *fp);
+
+
+void RCX_Bundle::Clear()
+{
+    for(int i=0; i<(int)fPrograms.size(); ++i) {
+        delete fPrograms[i].fImage;
+    }
+    fPrograms.resize(0);
+
+    fFirmware.erase();
+}
+
+
+void RCX_Bundle::AddProgram(int slot, RCX_Image *image)
+{
+    Program p;
+    p.fSlot = slot;
+    p.fImage = image;
+    fPrograms.push_back(p);
+}
+
+
+int RCX_Bundle::GetSize() const
+{
+    int size = 0;
+
+    for(int i=0; i<(int)fPrograms.size(); ++i)
+        size += fPrograms[i].fImage->GetSize();
+
+    return size;
+}
+
+
+RCX_Result RCX_Bundle::Download(RCX_Link *link) const
+{
+    return link->Download(*this);
+}
+
+
+RCX_Result RCX_Bundle::Read(const char *filename)
+{
+    Clear();
+
+    FILE *fp = fopen(filename, "rb");
+    if (!fp) return kRCX_FileError;
+
+    fseek(fp, 0, SEEK_END);
+    long length = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+
+    UByte *data = new UByte[length > 0 ? length : 1];
+    bool ok = (length >= 0 && fread(data, 1, length, fp) == (size_t)length);
+    fclose(fp);
+
+    RCX_Result result = ok ? Parse(data, length) : kRCX_FileError;
+    delete [] data;
+
+    if (RCX_ERROR(result)) Clear();
+    return result;
+}
+
+
+RCX_Result RCX_Bundle::Parse(const UByte *data, long length)
+{
+    const UByte *ptr = data;
+    const UByte *end = data + length;
+
+    if (end - ptr < kBundleHeaderSize) return kRCX_FormatError;
+    if (Get4(ptr) != kRCXB_Signature) return kRCX_FormatError;
+    if (Get2(ptr + 4) > kRCXB_CurrentVersion) return kRCX_FormatError;
+
+    int count = Get2(ptr + 6);
+    int nameLength = Get2(ptr + 8);
+    ptr += kBundleHeaderSize;
+
+    if (end - ptr < RCXI_PADDED_LENGTH(nameLength)) return kRCX_FormatError;
+    if (nameLength) {
+        const char *name = (const char *)ptr;
+        const char *nul = (const char *)memchr(name, 0, nameLength);
+        fFirmware.assign(name, nul ? nul - name : nameLength);
+    }
+    ptr += RCXI_PADDED_LENGTH(nameLength);
+
+    for(int i=0; i<count; ++i) {
+        if (end - ptr < kProgramHeaderSize) return kRCX_FormatError;
+
+        int slot = ptr[0];
+        ULong imageLength = Get4(ptr + 4);
+        ptr += kProgramHeaderSize;
+        if ((ULong)(end - ptr) < imageLength) return kRCX_FormatError;
+
+        RCX_Image *image = new RCX_Image();
+        RCX_Result result = image->Read(ptr, (long)imageLength);
+        if (RCX_ERROR(result)) {
+            delete image;
+            return result;
+        }
+        AddProgram(slot, image);
+
+        // the padding of the last image may be missing
+        ULong padded = RCXI_PADDED_LENGTH(imageLength);
+        ptr = ((ULong)(end - ptr) < padded) ? end : ptr + padded;
+    }
+
+    return kRCX_OK;
+}
+
+
+bool RCX_Bundle::Write(const char *filename) const
+{
+    FILE *fp = fopen(filename, "wb");
+    if (!fp) return false;
+
+    int nameLength = fFirmware.empty() ? 0 : fFirmware.size() + 1;
+
+    // write header
+    Write4(kRCXB_Signature, fp);
+    Write2(kRCXB_CurrentVersion, fp);
+    Write2((UShort)fPrograms.size(), fp);
+    Write2((UShort)nameLength, fp);
+    Write2(0, fp);
+
+    if (nameLength)
+        fwrite(fFirmware.c_str(), (size_t)nameLength, 1, fp);
+    WritePadding(nameLength, fp);
+
+    // write the programs, each length is filled in after its image
+    for(int i=0; i<(int)fPrograms.size(); ++i) {
+        long start = ftell(fp);
+
+        putc(fPrograms[i].fSlot, fp);
+        putc(0, fp);
+        Write2(0, fp);
+        Write4(0, fp);
+
+        fPrograms[i].fImage->Write(fp);
+
+        long imageLength = ftell(fp) - start - kProgramHeaderSize;
+        fseek(fp, start + 4, SEEK_SET);
+        Write4((ULong)imageLength, fp);
+        fseek(fp, 0, SEEK_END);
+
+        WritePadding(imageLength, fp);
+    }
+
+    bool ok = !ferror(fp);
+    if (fclose(fp) != 0) ok = false;
+    return ok;
+}
+
+
+void WritePadding(int length, FILE *fp)
+{
+    long zeros = 0;
+    int pad = RCXI_PAD_BYTES(length);
+
+    if (pad)
+        fwrite(&zeros, (size_t)pad, 1, fp);
+}
+
+
+ULong Get4(const UByte *ptr)
+{
+    return (ULong)ptr[0] + ((ULong)ptr[1] << 8) +
+        ((ULong)ptr[2] << 16) + ((ULong)ptr[3] << 24);
+}
+
+
+UShort Get2(const UByte *ptr)
+{
+    return (UShort)(ptr[0] + (ptr[1] << 8));
+}
@@ -0,0 +1,81 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __RCX_Bundle_h
+#define __RCX_Bundle_h
+
+#ifndef __RCX_Result_h
+#include "RCX_Result.h"
+#endif
+
+#ifndef __PTypes_h
+#include "PTypes.h"
+#endif
+
+#include <vector>
+#include <string>
+
+using std::vector;
+using std::string;
+
+class RCX_Image;
+class RCX_Link;
+
+/*
+ * The images for several program slots, and optionally the name of a
+ * firmware file, so they can all be downloaded in one session.
+ */
+class RCX_Bundle
+{
+public:
+    enum {
+        kMaxPrograms = 5
+    };
+
+    RCX_Bundle() {}
+    ~RCX_Bundle() { Clear(); }
+
+    RCX_Result Read(const char *filename);
+    bool Write(const char *filename) const;
+
+    RCX_Result Download(RCX_Link *link) const;
+
+    /// the bundle takes ownership of the image, slots start at 1
+    void AddProgram(int slot, RCX_Image *image);
+    int GetProgramCount() const { return fPrograms.size(); }
+    int GetSlot(int i) const { return fPrograms[i].fSlot; }
+    const RCX_Image &GetImage(int i) const { return *fPrograms[i].fImage; }
+
+    /// firmware to download before the programs, 0 if there isn't any
+    void SetFirmware(const char *filename) { fFirmware = filename ? filename : ""; }
+    const char *GetFirmware() const { return fFirmware.empty() ? 0 : fFirmware.c_str(); }
+
+    /// total size of the programs
+    int GetSize() const;
+
+    void Clear();
+
+private:
+    RCX_Result Parse(const UByte *data, long length);
+
+    struct Program {
+        int fSlot;
+        RCX_Image* fImage;
+    };
+
+    vector<Program> fPrograms;
+    string fFirmware;
+};
+
+
+#endif
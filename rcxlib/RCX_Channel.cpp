@@ -0,0 +1,106 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include "RCX_Channel.h"
+#include "RCX_Link.h"
+#include "RCX_LinkStats.h"
+
+
+RCX_Channel::RCX_Channel(RCX_Link *link) :
+    fLink(link),
+    fUpdates(0),
+    fLost(0),
+    fFlushes(0),
+    fStart(0),
+    fEnd(0)
+{
+}
+
+
+int RCX_Channel::AddMessage()
+{
+    return AddVariable(kMessageSlot);
+}
+
+
+int RCX_Channel::AddVariable(int var)
+{
+    for (int i=0; i<(int)fSlots.size(); ++i)
+        if (fSlots[i].fVar == var) return i;
+
+    Slot s;
+    s.fVar = var;
+    s.fValue = 0;
+    s.fChanged = false;
+    fSlots.push_back(s);
+
+    fCmds.resize(fSlots.size());
+    fCmdPtrs.resize(fSlots.size());
+    fResults.resize(fSlots.size());
+    return (int)fSlots.size() - 1;
+}
+
+
+void RCX_Channel::Set(int slot, int value)
+{
+    Slot &s = fSlots[slot];
+
+    if (s.fValue == value) return;
+    s.fValue = value;
+    s.fChanged = true;
+}
+
+
+RCX_Result RCX_Channel::Flush(bool all)
+{
+    int n = 0;
+
+    // the message goes last, after the variables it may be about
+    for (int pass=0; pass<2; ++pass) {
+        for (size_t i=0; i<fSlots.size(); ++i) {
+            Slot &s = fSlots[i];
+            if ((s.fVar == kMessageSlot) != (pass == 1)) continue;
+            if (!s.fChanged && !all) continue;
+
+            if (s.fVar == kMessageSlot)
+                fCmdPtrs[n] = fCmds[n].Set(kRCX_Message, (UByte)s.fValue);
+            else
+                fCmdPtrs[n] = fCmds[n].Set((UByte)kRCX_VarOp(kRCX_SetVar), (UByte)s.fVar,
+                    kRCX_ConstantType, (UByte)s.fValue, (UByte)(s.fValue >> 8));
+            s.fChanged = false;
+            ++n;
+        }
+    }
+    if (n == 0) return 0;
+
+    if (fFlushes++ == 0) fStart = RCX_LinkStats::Now();
+    RCX_Result result = fLink->Stream(&fCmdPtrs[0], n, &fResults[0]);
+    fEnd = RCX_LinkStats::Now();
+
+    int sent = 0;
+    for (int i=0; i<n; ++i) {
+        if (RCX_ERROR(fResults[i]))
+            ++fLost;
+        else
+            ++sent;
+    }
+    fUpdates += sent;
+
+    return sent ? sent : result;
+}
+
+
+double RCX_Channel::GetRate() const
+{
+    return fEnd > fStart ? fUpdates * 1000.0 / (fEnd - fStart) : 0;
+}
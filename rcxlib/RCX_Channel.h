@@ -0,0 +1,84 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __RCX_Channel_h
+#define __RCX_Channel_h
+
+#ifndef __RCX_Result_h
+#include "RCX_Result.h"
+#endif
+
+#ifndef __RCX_Cmd_h
+#include "RCX_Cmd.h"
+#endif
+
+#include <vector>
+
+class RCX_Link;
+
+/*
+ * Streams control values to a running program, for driving a brick
+ * from the host (with a joystick, say).  Each slot is the message or
+ * a variable; Set() keeps the latest value for a slot and Flush() sends
+ * the slots that changed since the last one with RCX_Link::Stream():
+ * one try each, since an update that gets lost is overtaken by the next
+ * one anyway.  Messages aren't answered, so they go out back to back;
+ * a variable waits for the brick to answer.
+ *
+ * The channel counts the updates that went through from the start of
+ * the first flush to the end of the last, for GetRate().
+ */
+class RCX_Channel
+{
+public:
+    RCX_Channel(RCX_Link *link);
+
+    /// returns the index of the slot; a slot added twice is only kept once
+    int AddMessage();
+    int AddVariable(int var);
+    int GetSlotCount() const { return (int)fSlots.size(); }
+
+    void Set(int slot, int value);
+    /// send the slots that changed (all of them if all is set), returns
+    /// how many went through (or the first error if none did)
+    RCX_Result Flush(bool all = false);
+
+    long GetUpdates() const { return fUpdates; }
+    long GetLost() const { return fLost; }
+    long GetFlushes() const { return fFlushes; }
+    /// updates per second, 0 until a flush is done
+    double GetRate() const;
+
+private:
+    enum { kMessageSlot = -1 };
+
+    struct Slot {
+        int fVar;       // kMessageSlot for the message
+        int fValue;
+        bool fChanged;
+    };
+
+    RCX_Link* fLink;
+    std::vector<Slot> fSlots;
+    std::vector<RCX_Cmd> fCmds;
+    std::vector<const RCX_Cmd*> fCmdPtrs;
+    std::vector<RCX_Result> fResults;
+
+    long fUpdates;
+    long fLost;
+    long fFlushes;
+    double fStart;      // when the first flush began, in ms
+    double fEnd;        // and the last one ended
+};
+
+#endif
@@ -27,8 +27,8 @@ RCX_ValueType GetRcxValueType(int v)
 {
     RCX_ValueType result = RCX_VALUE_TYPE(v);
     if (result == kRCX_VariableType || result == kRCX_IndirectType) {
-        const RCX_Target *t = gProgram->GetTarget();
-        if (t->fType == kRCX_SwanTarget) {
+        // commands made outside of a compile (no program) are never Swan
+        if (gProgram && gProgram->GetTarget()->fType == kRCX_SwanTarget) {
             result = (result == kRCX_VariableType)
                 ? kRCX_GlobalVariableType : kRCX_IndirectGlobalVarType;
         }
@@ -36,24 +36,42 @@ RCX_ValueType GetRcxValueType(int v)
     return result;
 }
 
+RCX_Cmd::RCX_Cmd(const RCX_Cmd &other) :
+    fLength(0),
+    fCapacity(kRCX_Cmd_MaxShortLength),
+    fPtr(0)
+{
+    Set(other.GetBody(), other.fLength);
+}
+
+
 RCX_Cmd::~RCX_Cmd()
 {
-    if (fLength > kRCX_Cmd_MaxShortLength)
-        delete [] fBody.fPtr;
+    delete [] fPtr;
 }
 
 
-void RCX_Cmd::SetLength(int length)
+RCX_Cmd& RCX_Cmd::operator=(const RCX_Cmd &other)
 {
-    if (fLength == length) return;
+    if (this != &other)
+        Set(other.GetBody(), other.fLength);
+    return *this;
+}
 
-    if (fLength > kRCX_Cmd_MaxShortLength)
-        delete [] fBody.fPtr;
 
-    fLength = length;
+/*
+ * The body isn't kept when it has to grow, so callers fill it in
+ * after setting the length.
+ */
+void RCX_Cmd::SetLength(int length)
+{
+    if (length > fCapacity) {
+        delete [] fPtr;
+        fPtr = new UByte[length];
+        fCapacity = length;
+    }
 
-    if (fLength > kRCX_Cmd_MaxShortLength)
-        fBody.fPtr = new UByte[fLength];
+    fLength = length;
 }
 
 
@@ -75,7 +93,8 @@ RCX_Cmd* RCX_Cmd::Set(const UByte *data, int length)
 RCX_Cmd* RCX_Cmd::Set(UByte d0)
 {
     SetLength(1);
-    fBody.fData[0] = d0;
+    UByte *body = GetBody();
+    body[0] = d0;
     return this;
 }
 
@@ -83,8 +102,9 @@ RCX_Cmd* RCX_Cmd::Set(UByte d0)
 RCX_Cmd* RCX_Cmd::Set(UByte d0, UByte d1)
 {
     SetLength(2);
-    fBody.fData[0] = d0;
-    fBody.fData[1] = d1;
+    UByte *body = GetBody();
+    body[0] = d0;
+    body[1] = d1;
     return this;
 }
 
@@ -92,9 +112,10 @@ RCX_Cmd* RCX_Cmd::Set(UByte d0, UByte d1)
 RCX_Cmd* RCX_Cmd::Set(UByte d0, UByte d1, UByte d2)
 {
     SetLength(3);
-    fBody.fData[0] = d0;
-    fBody.fData[1] = d1;
-    fBody.fData[2] = d2;
+    UByte *body = GetBody();
+    body[0] = d0;
+    body[1] = d1;
+    body[2] = d2;
     return this;
 }
 
@@ -102,10 +123,11 @@ RCX_Cmd* RCX_Cmd::Set(UByte d0, UByte d1, UByte d2)
 RCX_Cmd* RCX_Cmd::Set(UByte d0, UByte d1, UByte d2, UByte d3)
 {
     SetLength(4);
-    fBody.fData[0] = d0;
-    fBody.fData[1] = d1;
-    fBody.fData[2] = d2;
-    fBody.fData[3] = d3;
+    UByte *body = GetBody();
+    body[0] = d0;
+    body[1] = d1;
+    body[2] = d2;
+    body[3] = d3;
     return this;
 }
 
@@ -113,11 +135,12 @@ RCX_Cmd* RCX_Cmd::Set(UByte d0, UByte d1, UByte d2, UByte d3)
 RCX_Cmd* RCX_Cmd::Set(UByte d0, UByte d1, UByte d2, UByte d3, UByte d4)
 {
     SetLength(5);
-    fBody.fData[0] = d0;
-    fBody.fData[1] = d1;
-    fBody.fData[2] = d2;
-    fBody.fData[3] = d3;
-    fBody.fData[4] = d4;
+    UByte *body = GetBody();
+    body[0] = d0;
+    body[1] = d1;
+    body[2] = d2;
+    body[3] = d3;
+    body[4] = d4;
     return this;
 }
 
@@ -126,12 +149,13 @@ RCX_Cmd* RCX_Cmd::Set(UByte d0, UByte d1, UByte d2, UByte d3, UByte d4,
     UByte d5)
 {
     SetLength(6);
-    fBody.fData[0] = d0;
-    fBody.fData[1] = d1;
-    fBody.fData[2] = d2;
-    fBody.fData[3] = d3;
-    fBody.fData[4] = d4;
-    fBody.fData[5] = d5;
+    UByte *body = GetBody();
+    body[0] = d0;
+    body[1] = d1;
+    body[2] = d2;
+    body[3] = d3;
+    body[4] = d4;
+    body[5] = d5;
     return this;
 }
 
@@ -139,13 +163,14 @@ RCX_Cmd* RCX_Cmd::Set(UByte d0, UByte d1, UByte d2, UByte d3, UByte d4,
     UByte d5, UByte d6)
 {
     SetLength(7);
-    fBody.fData[0] = d0;
-    fBody.fData[1] = d1;
-    fBody.fData[2] = d2;
-    fBody.fData[3] = d3;
-    fBody.fData[4] = d4;
-    fBody.fData[5] = d5;
-    fBody.fData[6] = d6;
+    UByte *body = GetBody();
+    body[0] = d0;
+    body[1] = d1;
+    body[2] = d2;
+    body[3] = d3;
+    body[4] = d4;
+    body[5] = d5;
+    body[6] = d6;
     return this;
 }
 
@@ -153,14 +178,15 @@ RCX_Cmd* RCX_Cmd::Set(UByte d0, UByte d1, UByte d2, UByte d3, UByte d4,
     UByte d5, UByte d6, UByte d7)
 {
     SetLength(8);
-    fBody.fData[0] = d0;
-    fBody.fData[1] = d1;
-    fBody.fData[2] = d2;
-    fBody.fData[3] = d3;
-    fBody.fData[4] = d4;
-    fBody.fData[5] = d5;
-    fBody.fData[6] = d6;
-    fBody.fData[7] = d7;
+    UByte *body = GetBody();
+    body[0] = d0;
+    body[1] = d1;
+    body[2] = d2;
+    body[3] = d3;
+    body[4] = d4;
+    body[5] = d5;
+    body[6] = d6;
+    body[7] = d7;
     return this;
 }
 
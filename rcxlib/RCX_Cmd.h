@@ -22,24 +22,35 @@
 #include "RCX_Constants.h"
 #endif
 
-#define kRCX_Cmd_MaxShortLength 8
+// long enough for every bytecode and system command except downloads
+#define kRCX_Cmd_MaxShortLength 16
 
 
+/*
+ * A command is kept inline up to kRCX_Cmd_MaxShortLength bytes.  A
+ * longer one goes in a buffer that only ever grows, so a command that
+ * is reused (for the chunks of a download, say) allocates once for the
+ * largest of them, and short commands made with it afterwards just
+ * use the front of that buffer.
+ */
 class RCX_Cmd
 {
 public:
-    RCX_Cmd() { fLength = 0; };
+    RCX_Cmd() : fLength(0), fCapacity(kRCX_Cmd_MaxShortLength), fPtr(0) {}
+    RCX_Cmd(const RCX_Cmd &other);
     ~RCX_Cmd();
 
+    RCX_Cmd& operator=(const RCX_Cmd &other);
+
     int GetLength() const {
         return fLength;
     }
 
     UByte* GetBody() {
-        return (fLength <= kRCX_Cmd_MaxShortLength) ? fBody.fData : fBody.fPtr;
+        return fPtr ? fPtr : fData;
     }
     const UByte* GetBody() const {
-        return (fLength <= kRCX_Cmd_MaxShortLength) ? fBody.fData : fBody.fPtr;
+        return fPtr ? fPtr : fData;
     }
 
     int CopyOut(UByte *dst);
@@ -127,6 +138,8 @@ public:
     RCX_Cmd* MakeDownload(UShort seq, const UByte *data, UShort length);
     RCX_Cmd* MakeDeleteTasks() { return Set(kRCX_DeleteTasksOp); }
     RCX_Cmd* MakeDeleteSubs() { return Set(kRCX_DeleteSubsOp); }
+    RCX_Cmd* MakeDeleteTask(UByte task) { return Set(kRCX_DeleteTaskOp, task); }
+    RCX_Cmd* MakeDeleteSub(UByte sub) { return Set(kRCX_DeleteSubOp, sub); }
     RCX_Cmd* MakePing() { return Set(kRCX_PingOp); }
     RCX_Cmd* MakeUploadDatalog(UShort start, UShort count);
     RCX_Cmd* MakeBoot();
@@ -141,11 +154,10 @@ private:
     RCX_Cmd* MakeValue16(UByte opcode, RCX_Value value);
     RCX_Cmd* MakeValue8(UByte opcode, RCX_Value value);
 
-    int fLength;
-    union {
-        UByte   fData[kRCX_Cmd_MaxShortLength];
-        UByte*  fPtr;
-    } fBody;
+    int     fLength;
+    int     fCapacity;  // of the body, inline or not
+    UByte*  fPtr;       // 0 until a command is longer than fData
+    UByte   fData[kRCX_Cmd_MaxShortLength];
 };
 
 
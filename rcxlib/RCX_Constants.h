@@ -77,6 +77,8 @@
 #define kRCX_DownloadOp 0x45
 #define kRCX_DeleteTasksOp 0x40
 #define kRCX_DeleteSubsOp 0x70
+#define kRCX_DeleteTaskOp 0x61
+#define kRCX_DeleteSubOp 0xc1
 //#define kRCX_BootModeOp 0x65              // Not sure what BootModeOp is...
 #define kRCX_DeleteFirmware 0x65            ///< As per Proudfoot's opcode list
 #define kRCX_BeginFirmwareOp 0x75
@@ -13,6 +13,7 @@
  */
 #include <cstdio>
 #include <cstring>
+#include <cctype>
 #include <stack>
 #include <vector>
 
@@ -32,6 +33,10 @@ using std::printf;
 static int ArgsLength(ULong args);
 static void SPrintOutputNames(char *argText, const UByte outs);
 static int ComputeOffset(UByte b1, UByte b2=0, bool lowFirst = true);
+static bool ResourceType(RCX_ChunkType type);
+static int LASMOperandCount(int format);
+static bool SameName(const char *a, const char *b);
+static bool InRange(int value, int low, int high) { return value >= low && value <= high; }
 
 #define LOOKUP(i,a) (((unsigned)(i)<sizeof(a)/sizeof(char*)) ? a[i] : "?")
 #define WORD(ptr)   ((short)((((ptr)[1]) << 8) + ((ptr)[0])))
@@ -492,8 +497,8 @@ public:
     long    fOffset;
 };
 
-/// Swan support code
-const ubyte nSwanInstructionLength[256] = {
+/// Swan support code (filled in by calculateInstructionLengths())
+static ubyte nSwanInstructionLength[256] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -725,10 +730,16 @@ void calculateInstructionLengths()
 }
 
 
-RCX_Disasm::RCX_Disasm(RCX_TargetType targetType) : fTarget(targetType)
+RCX_Disasm::RCX_Disasm(RCX_TargetType targetType) :
+    fTarget(targetType),
+    fGenLASM(false),
+    fCurType(kRCX_TaskChunk),
+    fCurNum(0)
 {
     unsigned i;
 
+    fLabelPrefix[0] = 0;
+
     for (i=0; i<256; ++i) {
         fOpDispatch[i] = 0;
     }
@@ -787,10 +798,8 @@ void RCX_Disasm::LASMOutputFooter(RCX_Printer *dst, RCX_ChunkType type, UShort p
   char line[256];
 
   // output the last label
-  labels_type::iterator p = fLabels.find((int)pc);
-  if (p != fLabels.end()) {
-      string tmp = (*p).second;
-      sprintf(line, "%s:\n", tmp.c_str());
+  if (IsLabel(pc)) {
+      sprintf(line, "%s%04d:\n", fLabelPrefix, pc);
       dst->Print(line);
   }
 
@@ -827,8 +836,9 @@ void RCX_Disasm::Print(RCX_Printer *dst, bool genLASM, string name,
     RCX_Result result;
     stack<SrcListState> stateStack;
 
-    // start with an empty set of labels
-    fLabels.clear();
+    // start with an empty set of labels, one slot per pc including
+    // the end of the chunk
+    fLabels.assign(length + 1, 0);
 
     // ignore tags if no source files
     if (!sf) tagCount = 0;
@@ -838,11 +848,24 @@ void RCX_Disasm::Print(RCX_Printer *dst, bool genLASM, string name,
     if (genLASM) {
         LASMOutputHeader(dst, name, type, ChunkNum);
 
-        // run through the entire chunk once to get a list of required labels
+        switch(type) {
+            case kRCX_TaskChunk:
+                sprintf(fLabelPrefix, "t%03d", ChunkNum);
+                break;
+            case kRCX_SubChunk:
+                sprintf(fLabelPrefix, "s%03d", ChunkNum);
+                break;
+            default:
+                sprintf(fLabelPrefix, "l%03d", ChunkNum);
+                break;
+        }
+
+        // run through the entire chunk once to mark the required labels
         while(true) {
             if (tmpLen <= 0) break;
 
             result = FindLabel(tmpCode, tmpLen, pc);
+            if (result < 1) result = 1;
             pc += result;
             tmpCode += result;
             tmpLen -= result;
@@ -907,46 +930,181 @@ void RCX_Disasm::Print(RCX_Printer *dst, bool genLASM, string name,
 }
 
 
+void RCX_Disasm::PrintJSON(RCX_Printer *dst, RCX_ChunkType type, const UByte *code, int length,
+    RCX_SourceFiles *sf, const RCX_SourceTag *tags, int tagCount)
+{
+    UShort pc = 0;
+    RCX_Result result;
+    stack<SrcListState> stateStack;
+
+    fGenLASM = false;
+    fCurType = type;
+    fLabels.clear();
+
+    dst->Print("[");
+
+    while(length > 0) {
+        // each statement tags the pc of its first instruction, and
+        // anything before the first statement belongs to the fragment
+        // (or inline function) itself
+        while (tagCount && (tags->fAddress <= pc) ) {
+            switch(tags->fType) {
+                case RCX_SourceTag::kBegin:
+                case RCX_SourceTag::kBeginNoList:
+                {
+                    SrcListState ns;
+                    ns.fEnabled = true;
+                    ns.fIndex = tags->fSrcIndex;
+                    ns.fOffset = tags->fSrcOffset;
+                    stateStack.push(ns);
+                    break;
+                }
+                case RCX_SourceTag::kNormal:
+                {
+                    if (stateStack.empty()) break;
+                    SrcListState &s = stateStack.top();
+                    s.fIndex = tags->fSrcIndex;
+                    s.fOffset = tags->fSrcOffset;
+                    break;
+                }
+                case RCX_SourceTag::kEnd:
+                {
+                    if (!stateStack.empty()) stateStack.pop();
+                    break;
+                }
+            }
+
+            tags++;
+            tagCount--;
+        }
+
+        if (pc) dst->Print(",");
+
+        result = PrintJSON1(dst, code, length, pc);
+
+        if (!stateStack.empty()) {
+            const SrcListState &s = stateStack.top();
+            const char *name = sf ? sf->GetName(s.fIndex) : 0;
+
+            dst->Print(",\"src\":{");
+            if (name) {
+                dst->Print("\"file\":");
+                dst->PrintJSONString(name);
+                dst->Print(",\"line\":");
+                dst->PrintDec((int)sf->GetLine(s.fIndex, s.fOffset));
+                dst->Print(",");
+            }
+            dst->Print("\"index\":");
+            dst->PrintDec(s.fIndex);
+            dst->Print(",\"offset\":");
+            dst->PrintDec((int)s.fOffset);
+            dst->Print("}");
+        }
+        dst->Print("}");
+
+        pc += result;
+        code += result;
+        length -= result;
+    }
+
+    dst->Print("]");
+}
+
+
+/*
+ * Print the fields of an instruction's JSON object, leaving the object
+ * open so that the caller can add its source location.
+ */
+RCX_Result RCX_Disasm::PrintJSON1(RCX_Printer *dst, const UByte *code, int length, UShort pc)
+{
+    char argText[256];
+    const Instruction *inst;
+    const UByte *ptr;
+    ULong args;
+    bool argPrinted = false;
+
+    if (ResourceType(fCurType))
+        inst = fResOpDisp[*code];
+    else
+        inst = fOpDispatch[*code];
+
+    int iLength = inst ? ArgsLength(inst->fArgs) + 1 : 1;
+    if (length < iLength) {
+        inst = 0;
+        iLength = 1;
+    }
+
+    dst->Print("{\"pc\":");
+    dst->PrintDec(pc);
+    dst->Print(",\"opcode\":");
+    dst->PrintDec(*code);
+    dst->Print(",\"op\":");
+    dst->PrintJSONString(inst ? inst->fName : "?");
+    dst->Print(",\"size\":");
+    dst->PrintDec(iLength);
+    dst->Print(",\"args\":[");
+
+    if (inst) {
+        ptr = code+1;
+        for (args = inst->fArgs; args; args>>=kArgFormatWidth) {
+            int af = args & kArgFormatMask;
+
+            SPrintArg(argText, af, ptr, pc + (ptr - code));
+            if (argText[0]) {
+                if (argPrinted) dst->Print(",");
+                dst->PrintJSONString(argText);
+                argPrinted = true;
+            }
+
+            ptr += argFormatLengths[af];
+        }
+    }
+
+    dst->Print("]");
+
+    return iLength;
+}
+
+
 RCX_Result RCX_Disasm::Print1(RCX_Printer *dst, const UByte *code, int length, UShort pc)
 {
+    static const char spaces[] = "                                          ";
     char text[256];
-    char line[256];
 
     RCX_Result result = SPrint1(text, code, length, pc);
 
     if (result < 1) {
         result = 1;
-        sprintf(text, "?");
+        strcpy(text, "?");
     }
 
+    int n = (int)strlen(text);
+
     if (fGenLASM) {
-        if (fCurType == kRCX_SoundChunk) {
-            sprintf(line, "\t%s ", text);
+        // does this line have a label???
+        if (fCurType != kRCX_SoundChunk && IsLabel(pc)) {
+            dst->Print(fLabelPrefix);
+            dst->PrintDec(pc, 4);
+            dst->Print(":\n", 2);
         }
-        else {
-            // does this line have a label???
-            labels_type::iterator p = fLabels.find((int)pc);
-            if (p != fLabels.end()) {
-                string tmp = (*p).second;
-                sprintf(line, "%s:\n\t%s ", tmp.c_str(), text);
-            }
-            else
-                sprintf(line, "\t%s ", text);
-        }
-    } else
-        sprintf(line, "%03d %-42s ", pc, text);
-
-    dst->Print(line);
+        dst->Print("\t", 1);
+        dst->Print(text, n);
+        dst->Print(" ", 1);
+    } else {
+        dst->PrintDec(pc, 3);
+        dst->Print(" ", 1);
+        dst->Print(text, n);
+        if (n < (int)sizeof(spaces) - 1)
+            dst->Print(spaces, (int)sizeof(spaces) - 1 - n);
+        dst->Print(" ", 1);
 
-    if (!fGenLASM) {
         for (int i=0; i<result; i++) {
-            sprintf(line, "%02x ", code[i]);
-            dst->Print(line);
+            dst->PrintHex(code[i], 2);
+            dst->Print(" ", 1);
         }
     }
 
-    sprintf(line, "\n");
-    dst->Print(line);
+    dst->Print("\n", 1);
 
     return result;
 }
@@ -1026,64 +1184,16 @@ void RCX_Disasm::SPrintArg(char *text, ULong format, const UByte *code, UShort p
             SPrintCondition(text, code);
             break;
         case kAF_Jump8:
-                        if (fGenLASM)
-                        {
-                            labels_type::iterator p = fLabels.find((int)(pc + ComputeOffset(code[0], 0)));
-                            if (p != fLabels.end())
-                            {
-                                string tmp = (*p).second;
-                                sprintf(text, "%s", tmp.c_str());
-                            }
-                            else
-                                sprintf(text, "%d", pc + ComputeOffset(code[0], 0));
-                        }
-                        else
-                sprintf(text, "%d", pc + ComputeOffset(code[0], 0));
+            SPrintTarget(text, pc + ComputeOffset(code[0], 0));
             break;
         case kAF_Jump16:
-                        if (fGenLASM)
-                        {
-                            labels_type::iterator p = fLabels.find((int)(pc + ComputeOffset(code[0], code[1])));
-                            if (p != fLabels.end())
-                            {
-                                string tmp = (*p).second;
-                                sprintf(text, "%s", tmp.c_str());
-                            }
-                            else
-                                sprintf(text, "%d", pc + ComputeOffset(code[0], code[1]));
-                        }
-                        else
-                            sprintf(text, "%d", pc + ComputeOffset(code[0], code[1]));
+            SPrintTarget(text, pc + ComputeOffset(code[0], code[1]));
             break;
         case kAF_Offset8:
-                        if (fGenLASM)
-                        {
-                            labels_type::iterator p = fLabels.find((int)(pc + (signed char)code[0]));
-                            if (p != fLabels.end())
-                            {
-                                string tmp = (*p).second;
-                                sprintf(text, "%s", tmp.c_str());
-                            }
-                            else
-                                sprintf(text, "%d", pc + (signed char)code[0]);
-                        }
-                        else
-                sprintf(text, "%d", pc + (signed char)code[0]);
+            SPrintTarget(text, pc + (signed char)code[0]);
             break;
         case kAF_Offset16:
-                        if (fGenLASM)
-                        {
-                            labels_type::iterator p = fLabels.find((int)(pc + (short)WORD(code)));
-                            if (p != fLabels.end())
-                            {
-                                string tmp = (*p).second;
-                                sprintf(text, "%s", tmp.c_str());
-                            }
-                            else
-                                sprintf(text, "%d", pc + (short)WORD(code));
-                        }
-                        else
-                sprintf(text, "%d", pc + (short)WORD(code));
+            SPrintTarget(text, pc + (short)WORD(code));
             break;
                 case kAF_GVar:
                         if (fGenLASM)
@@ -1108,10 +1218,16 @@ bool ResourceType(RCX_ChunkType type)
   return type == kRCX_SoundChunk || type == kRCX_AnimationChunk;
 }
 
+void RCX_Disasm::SPrintTarget(char *text, int pc)
+{
+    if (fGenLASM && IsLabel(pc))
+        sprintf(text, "%s%04d", fLabelPrefix, pc);
+    else
+        sprintf(text, "%d", pc);
+}
+
 void RCX_Disasm::FindLabelArg(ULong format, const UByte *code, UShort pc)
 {
-    char text[256];
-    char buf[256];
     int value;
     switch(format) {
         case kAF_Jump8:
@@ -1131,21 +1247,8 @@ void RCX_Disasm::FindLabelArg(ULong format, const UByte *code, UShort pc)
             break;
     }
 
-    if (value != -1) {
-        switch(fCurType) {
-            case kRCX_TaskChunk:
-                sprintf(buf, "t%03d", fCurNum);
-                break;
-            case kRCX_SubChunk:
-                sprintf(buf, "s%03d", fCurNum);
-                break;
-            default:
-                sprintf(buf, "l%03d", fCurNum);
-                break;
-        }
-        sprintf(text, "%s%04d", buf, value);
-        fLabels.insert(value_type(value, string(text)));
-    }
+    if (value >= 0 && value < (int)fLabels.size())
+        fLabels[value] = 1;
 }
 
 RCX_Result RCX_Disasm::FindLabel(const UByte *code, int length, UShort pc)
@@ -1179,6 +1282,250 @@ RCX_Result RCX_Disasm::FindLabel(const UByte *code, int length, UShort pc)
     return iLength;
 }
 
+bool RCX_Disasm::FindReferences(const UByte *code, int length, vector<Reference> &refs) const
+{
+    int pc = 0;
+
+    while(pc < length) {
+        const Instruction *inst = fOpDispatch[code[pc]];
+        if (!inst) return false;
+
+        int iLength = ArgsLength(inst->fArgs) + 1;
+        if (pc + iLength > length) return false;
+
+        // the task or sub number is the only operand
+        Reference r;
+        r.fOffset = pc + 1;
+        switch(code[pc]) {
+            case kRCX_GoSubOp:
+                r.fType = Reference::kSub;
+                refs.push_back(r);
+                break;
+            case kRCX_StartTaskOp:
+            case kRCX_StopTaskOp:
+                r.fType = Reference::kTask;
+                refs.push_back(r);
+                break;
+        }
+
+        int offset = pc + 1;
+        for(ULong args = inst->fArgs; args; args>>=kArgFormatWidth) {
+            int af = args & kArgFormatMask;
+            const UByte *ptr = code + offset;
+
+            switch(af) {
+                case kAF_Value8:
+                case kAF_Value16:
+                    if (!AddValueReference(ptr[0], offset + 1, refs)) return false;
+                    break;
+                case kAF_Var:
+                    if (!AddValueReference(kRCX_VariableType, offset, refs)) return false;
+                    break;
+                case kAF_Condition:
+                    if (!AddValueReference(ptr[0] & 0x3f, offset + 2, refs) ||
+                        !AddValueReference(ptr[1] & 0x3f, offset + 4, refs)) return false;
+                    break;
+                case kAF_SrcRelThresh:
+                case kAF_GVar:
+                case kAF_CondV2V2:
+                case kAF_CondV1V1:
+                case kAF_CondC1V1:
+                case kAF_CondV1C1:
+                case kAF_CondV2C2:
+                case kAF_CondC2V2:
+                    // only Spybotics and Swan have these
+                    return false;
+                default:
+                    break;
+            }
+
+            offset += argFormatLengths[af];
+        }
+
+        pc += iLength;
+    }
+
+    return true;
+}
+
+
+bool RCX_Disasm::AddValueReference(int type, int offset, vector<Reference> &refs)
+{
+    if (type == kRCX_IndirectType) return false;
+
+    if (type == kRCX_VariableType) {
+        Reference r;
+        r.fType = Reference::kVar;
+        r.fOffset = offset;
+        refs.push_back(r);
+    }
+
+    return true;
+}
+
+
+int RCX_Disasm::Encode(RCX_ChunkType type, const char *name, const vector<int> &operands,
+    vector<UByte> &code) const
+{
+    const Instruction* const *dispatch = ResourceType(type) ? fResOpDisp : fOpDispatch;
+    int result = kUnknownInstruction;
+
+    for(int op=0; op<256; ++op) {
+        const Instruction *inst = dispatch[op];
+
+        // each instruction once, and not one that another has replaced
+        if (!inst || inst->fOpcode != op || !SameName(inst->fName, name)) continue;
+
+        int count = 0;
+        bool listed = true;
+        for(ULong args = inst->fArgs; args; args>>=kArgFormatWidth) {
+            int n = LASMOperandCount(args & kArgFormatMask);
+            if (n < 0) listed = false;
+            count += n;
+        }
+
+        if (!listed) {
+            result = kNoLASMOperands;
+            continue;
+        }
+
+        if (count != (int)operands.size()) {
+            if (result == kUnknownInstruction) result = kWrongOperandCount;
+            continue;
+        }
+
+        size_t start = code.size();
+        const int *values = operands.empty() ? 0 : &operands[0];
+
+        code.push_back(inst->fOpcode);
+        for(ULong args = inst->fArgs; args; args>>=kArgFormatWidth) {
+            int af = args & kArgFormatMask;
+
+            if (!EncodeArg(af, values, code)) {
+                code.resize(start);
+                return kOperandRange;
+            }
+            values += LASMOperandCount(af);
+        }
+
+        return (int)(code.size() - start);
+    }
+
+    return result;
+}
+
+
+/*
+ * Append an operand, given as the numbers SPrintArg() prints for it in
+ * a LASM listing.  The operand's pc is code.size().
+ */
+bool RCX_Disasm::EncodeArg(int format, const int *values, vector<UByte> &code)
+{
+    int pc = (int)code.size();
+    int x;
+
+    switch(format) {
+        case kAF_Skip8:
+            code.push_back(0);
+            break;
+        case kAF_Skip16:
+            code.push_back(0);
+            code.push_back(0);
+            break;
+        case kAF_Raw8:
+        case kAF_Var:
+        case kAF_GVar:
+        case kAF_InputType:
+            if (!InRange(values[0], -128, 255)) return false;
+            code.push_back((UByte)values[0]);
+            break;
+        case kAF_Outputs:
+            if (!InRange(values[0], 0, 7)) return false;
+            code.push_back((UByte)values[0]);
+            break;
+        case kAF_Raw16:
+            if (!InRange(values[0], -32768, 65535)) return false;
+            code.push_back((UByte)values[0]);
+            code.push_back((UByte)(values[0] >> 8));
+            break;
+        case kAF_HLRaw16:
+            if (!InRange(values[0], -32768, 65535)) return false;
+            code.push_back((UByte)(values[0] >> 8));
+            code.push_back((UByte)values[0]);
+            break;
+        case kAF_Value8:
+            if (!InRange(values[0], 0, 255) || !InRange(values[1], -128, 255)) return false;
+            code.push_back((UByte)values[0]);
+            code.push_back((UByte)values[1]);
+            break;
+        case kAF_Value16:
+            if (!InRange(values[0], 0, 255) || !InRange(values[1], -32768, 65535)) return false;
+            code.push_back((UByte)values[0]);
+            code.push_back((UByte)values[1]);
+            code.push_back((UByte)(values[1] >> 8));
+            break;
+        case kAF_SrcRelThresh:
+            if (!InRange(values[0], 0, 255) || !InRange(values[1], 0, 3) ||
+                !InRange(values[2], 0, 63) || !InRange(values[3], -32768, 65535)) return false;
+            code.push_back((UByte)values[0]);
+            code.push_back((UByte)((values[1] << 6) | values[2]));
+            code.push_back((UByte)values[3]);
+            code.push_back((UByte)(values[3] >> 8));
+            break;
+        case kAF_OutputMode:
+            if (!InRange(values[0], 0, 7) || !InRange(values[1], 0, 3)) return false;
+            code.push_back((UByte)(values[0] | (values[1] << 6)));
+            break;
+        case kAF_OutputDir:
+            if (!InRange(values[0], 0, 3) || !InRange(values[1], 0, 7)) return false;
+            code.push_back((UByte)((values[0] << 6) | values[1]));
+            break;
+        case kAF_InputMode:
+            if (!InRange(values[0], 0, 7) || !InRange(values[1], 0, 31)) return false;
+            code.push_back((UByte)((values[0] << 5) | values[1]));
+            break;
+        case kAF_Condition:
+            // value 1, relation, value 2; the second value's data is a byte
+            if (!InRange(values[0], 0, 63) || !InRange(values[1], -32768, 65535) ||
+                !InRange(values[2], 0, 3) || !InRange(values[3], 0, 63) ||
+                !InRange(values[4], -128, 255)) return false;
+            code.push_back((UByte)((values[2] << 6) | values[0]));
+            code.push_back((UByte)values[3]);
+            code.push_back((UByte)values[1]);
+            code.push_back((UByte)(values[1] >> 8));
+            code.push_back((UByte)values[4]);
+            break;
+        case kAF_Jump8:
+        case kAF_Jump16:
+            // a magnitude and a sign bit (see ComputeOffset())
+            x = values[0] - pc;
+            if (x < 0) x = -x;
+            if (x > (format == kAF_Jump8 ? 0x7f : 0x7fff)) return false;
+            code.push_back((UByte)((x & 0x7f) | (values[0] < pc ? 0x80 : 0)));
+            if (format == kAF_Jump16)
+                code.push_back((UByte)(x >> 7));
+            break;
+        case kAF_Offset8:
+            x = values[0] - pc;
+            if (!InRange(x, -128, 127)) return false;
+            code.push_back((UByte)x);
+            break;
+        case kAF_Offset16:
+            x = values[0] - pc;
+            if (!InRange(x, -32768, 32767)) return false;
+            code.push_back((UByte)x);
+            code.push_back((UByte)(x >> 8));
+            break;
+        case kAF_None:
+            break;
+        default:
+            return false;
+    }
+
+    return true;
+}
+
+
 RCX_Result RCX_Disasm::SPrint1(char *text, const UByte *code, int length, UShort pc)
 {
     int iLength;
@@ -1281,6 +1628,50 @@ void SPrintOutputNames(char *argText, const UByte outs)
 }
 
 
+/*
+ * How many numbers a LASM listing prints for an operand, or -1 for the
+ * Swan's operands that it leaves out.
+ */
+int LASMOperandCount(int format)
+{
+    switch(format) {
+        case kAF_None:
+        case kAF_Skip8:
+        case kAF_Skip16:
+            return 0;
+        case kAF_Value8:
+        case kAF_Value16:
+        case kAF_OutputMode:
+        case kAF_OutputDir:
+        case kAF_InputMode:
+            return 2;
+        case kAF_SrcRelThresh:
+            return 4;
+        case kAF_Condition:
+            return 5;
+        case kAF_CondV2V2:
+        case kAF_HLOffset16:
+        case kAF_CondV1V1:
+        case kAF_CondC1V1:
+        case kAF_CondV1C1:
+        case kAF_CondV2C2:
+        case kAF_CondC2V2:
+            return -1;
+        default:
+            return 1;
+    }
+}
+
+
+bool SameName(const char *a, const char *b)
+{
+    for( ; *a && *b; ++a, ++b)
+        if (tolower((unsigned char)*a) != tolower((unsigned char)*b)) return false;
+
+    return *a == *b;
+}
+
+
 int ArgsLength(ULong args)
 {
     int length = 0;
@@ -1380,8 +1771,8 @@ const char *RCX_Disasm::GetTypeName(int type)
 
 void RCX_Disasm::SPrintCondition(char *text, const UByte *code)
 {
-    char v1Text[16];
-    char v2Text[16];
+    char v1Text[32];
+    char v2Text[32];
 
     SPrintValue(v1Text, (code[0] & 0x3f), (short)WORD(code+2));
     SPrintValue(v2Text, (code[1] & 0x3f), code[4]);
@@ -1415,3 +1806,102 @@ void RCX_Printer::Print(const char *text)
 {
     Print(text, strlen(text));
 }
+
+
+void RCX_Printer::PrintDec(int value, int width)
+{
+    char buf[16];
+    char *ptr = buf + sizeof(buf);
+    unsigned u = value < 0 ? 0U - (unsigned)value : (unsigned)value;
+
+    do {
+        *--ptr = (char)('0' + u % 10);
+        u /= 10;
+        --width;
+    } while(u);
+
+    while(width-- > 0)
+        *--ptr = '0';
+
+    if (value < 0)
+        *--ptr = '-';
+
+    Print(ptr, (int)(buf + sizeof(buf) - ptr));
+}
+
+
+void RCX_Printer::PrintHex(unsigned value, int width)
+{
+    static const char digits[] = "0123456789abcdef";
+    char buf[16];
+    char *ptr = buf + sizeof(buf);
+
+    do {
+        *--ptr = digits[value & 0xf];
+        value >>= 4;
+        --width;
+    } while(value);
+
+    while(width-- > 0)
+        *--ptr = '0';
+
+    Print(ptr, (int)(buf + sizeof(buf) - ptr));
+}
+
+
+void RCX_Printer::PrintJSONString(const char *text)
+{
+    const char *start = text;
+
+    Print("\"", 1);
+    for(; *text; ++text) {
+        unsigned char c = (unsigned char)*text;
+
+        if (c != '"' && c != '\\' && c >= 0x20) continue;
+
+        Print(start, (int)(text - start));
+        if (c < 0x20) {
+            Print("\\u", 2);
+            PrintHex(c, 4);
+        }
+        else {
+            Print("\\", 1);
+            Print(text, 1);
+        }
+        start = text + 1;
+    }
+    Print(start, (int)(text - start));
+    Print("\"", 1);
+}
+
+
+RCX_BufferPrinter::RCX_BufferPrinter(FILE *fp) :
+    fFile(fp)
+{
+    fBuffer.reserve(kFlushSize);
+}
+
+
+RCX_BufferPrinter::~RCX_BufferPrinter()
+{
+    Flush();
+}
+
+
+void RCX_BufferPrinter::Print(const char *text, int length)
+{
+    if (fFile && fBuffer.size() + length > kFlushSize)
+        Flush();
+
+    fBuffer.insert(fBuffer.end(), text, text + length);
+}
+
+
+void RCX_BufferPrinter::Flush()
+{
+    if (!fFile) return;
+
+    if (!fBuffer.empty())
+        fwrite(&fBuffer[0], fBuffer.size(), 1, fFile);
+    fBuffer.clear();
+}
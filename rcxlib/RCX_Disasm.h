@@ -36,14 +36,13 @@
 using std::FILE;
 #endif
 
+#include <cstring>
+
 #include <string>
 using std::string;
 
-#include <map>
-using std::map;
-
-typedef map<int, string> labels_type;
-typedef labels_type::value_type value_type;
+#include <vector>
+using std::vector;
 
 class RCX_Printer;
 class RCX_SourceFiles;
@@ -62,8 +61,42 @@ public:
         RCX_SourceFiles *sf, const RCX_SourceTag *tags, int tagCount);
 
     RCX_Result Print1(RCX_Printer *dst, const UByte *code, int length, UShort pc);
+
+    // print the chunk's instructions as a JSON array, each with its pc,
+    // opcode, operands, size, and source location (if tagged)
+    void PrintJSON(RCX_Printer *dst, RCX_ChunkType type, const UByte *code, int length,
+        RCX_SourceFiles *sf, const RCX_SourceTag *tags, int tagCount);
     RCX_Result SPrint1(char *text, const UByte *code, int length, UShort pc);
 
+    // an operand that names a variable, sub or task
+    struct Reference {
+        enum Type { kVar, kSub, kTask };
+
+        Type    fType;
+        int     fOffset;    // of the byte holding the number
+    };
+
+    // find the operands of a task or sub's code that name a variable,
+    // sub or task; false if the code reaches a variable some other way
+    // (indirectly) or has an instruction that isn't known
+    bool FindReferences(const UByte *code, int length, vector<Reference> &refs) const;
+
+    // what Encode() returns when it can't encode an instruction
+    enum {
+        kUnknownInstruction = -1,
+        kWrongOperandCount = -2,    // for every instruction of that name
+        kOperandRange = -3,         // or a jump that can't reach
+        kNoLASMOperands = -4        // LASM listings leave the operands out
+    };
+
+    // Encode an instruction for an assembler, from its name and the
+    // numbers of its operands as the LASM listing prints them (a jump's
+    // target is a pc).  It's appended to the chunk's code, so the pc
+    // is code.size().  Returns the instruction's length, or one of the
+    // errors above.
+    int Encode(RCX_ChunkType type, const char *name, const vector<int> &operands,
+        vector<UByte> &code) const;
+
 
     // format of internal instruction information
     // the declaration is public so that a global table may be defined
@@ -78,18 +111,24 @@ private:
     void        SPrintValue(char *text, int type, short data);
     void        SPrintArg(char *text, ULong format, const UByte *code, UShort pc);
     void        SPrintCondition(char *text, const UByte *code);
+    static bool AddValueReference(int type, int offset, vector<Reference> &refs);
+    static bool EncodeArg(int format, const int *values, vector<UByte> &code);
     const char* GetTypeName(int type);
 
     RCX_Result  FindLabel(const UByte *code, int length, UShort pc);
     void        FindLabelArg(ULong format, const UByte *code, UShort pc);
     void        LASMOutputHeader(RCX_Printer *dst, string name, RCX_ChunkType type, int ChunkNum);
     void        LASMOutputFooter(RCX_Printer *dst, RCX_ChunkType type, UShort pc);
+    RCX_Result  PrintJSON1(RCX_Printer *dst, const UByte *code, int length, UShort pc);
+    bool        IsLabel(int pc) const { return pc >= 0 && pc < (int)fLabels.size() && fLabels[pc]; }
+    void        SPrintTarget(char *text, int pc);
 
 
     const Instruction*  fOpDispatch[256];
     const Instruction*  fResOpDisp[256];
 
-    labels_type     fLabels;
+    vector<UByte>   fLabels;        // non-zero for each pc that needs a label
+    char            fLabelPrefix[16];   // label name up to the pc, e.g. "t003"
     RCX_TargetType  fTarget;
     bool            fGenLASM;
     RCX_ChunkType   fCurType;
@@ -103,6 +142,13 @@ public:
     virtual ~RCX_Printer() {}
     virtual void Print(const char *text);
     virtual void Print(const char *text, int length) = 0;
+
+    // print a number, padded with zeros to at least width digits
+    void    PrintDec(int value, int width = 0);
+    void    PrintHex(unsigned value, int width = 0);
+
+    // print text as a quoted JSON string
+    void    PrintJSONString(const char *text);
 };
 
 class RCX_StdioPrinter : public RCX_Printer
@@ -119,11 +165,45 @@ private:
 };
 
 
+/*
+ * Collects everything printed into one buffer, which is written to the
+ * file (if any) by Flush() or when the printer is destroyed.  Listings
+ * print many short fragments, and this saves a stdio call for each.
+ * With a file the buffer is also written out whenever it fills up, so
+ * a listing of any size takes no more than kFlushSize of memory.
+ */
+class RCX_BufferPrinter : public RCX_Printer
+{
+public:
+    enum { kFlushSize = 64 * 1024 };
+
+    RCX_BufferPrinter(FILE *fp = 0);
+    ~RCX_BufferPrinter();
+
+    virtual void Print(const char *text)                { Print(text, (int)strlen(text)); }
+    virtual void Print(const char *text, int length);
+
+    void        Flush();
+
+    const char* GetText() const     { return fBuffer.empty() ? "" : &fBuffer[0]; }
+    int         GetLength() const   { return (int)fBuffer.size(); }
+
+private:
+    vector<char>    fBuffer;
+    FILE*           fFile;
+};
+
+
 class RCX_SourceFiles
 {
 public:
     virtual ~RCX_SourceFiles() {}
     virtual long Print(RCX_Printer *printer, short index, long start, long end) = 0;
+
+    // used to save source information with an image
+    virtual int GetCount() { return 0; }
+    virtual const char* GetName(short /* index */) { return 0; }
+    virtual long GetLine(short /* index */, long /* offset */) { return 0; }
 };
 
 
@@ -0,0 +1,156 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include "RCX_DownloadHistory.h"
+
+using std::fopen;
+using std::strlen;
+using std::strtoul;
+
+#define kHistoryHeader  "nqc-downloads 1\n"
+#define kMaxLine        1024
+
+
+RCX_DownloadHistory::RCX_DownloadHistory(const char *filename) :
+    fFilename(filename)
+{
+    Load();
+}
+
+
+bool RCX_DownloadHistory::Find(const string &brick, Entry &entry) const
+{
+    map<string, Entry>::const_iterator i = fEntries.find(brick);
+    if (i == fEntries.end()) return false;
+
+    entry = i->second;
+    return true;
+}
+
+
+void RCX_DownloadHistory::Store(const string &brick, const Entry &entry)
+{
+    fEntries[brick] = entry;
+    Save();
+}
+
+
+void RCX_DownloadHistory::Forget(const string &brick)
+{
+    if (fEntries.erase(brick))
+        Save();
+}
+
+
+ULong RCX_DownloadHistory::Hash(const UByte *data, int length)
+{
+    // 32 bit FNV-1a, including the length
+    ULong h = 2166136261UL;
+
+    for(int i=0; i<length; ++i)
+        h = ((h ^ data[i]) * 16777619UL) & 0xffffffffUL;
+
+    return ((h ^ (ULong)length) * 16777619UL) & 0xffffffffUL;
+}
+
+
+/*
+ * The file holds one record per brick:
+ *
+ *  brick <name>
+ *  map <memory map in hex>
+ *  chunk <type> <number> <hash>    (one line per chunk)
+ *
+ * Anything that doesn't parse ends the file, so a damaged file only
+ * costs a full download.
+ */
+void RCX_DownloadHistory::Load()
+{
+    if (fFilename.empty()) return;
+
+    FILE *fp = fopen(fFilename.c_str(), "r");
+    if (!fp) return;
+
+    char line[kMaxLine];
+    Entry *entry = 0;
+
+    if (!fgets(line, sizeof(line), fp) || strcmp(line, kHistoryHeader) != 0) {
+        fclose(fp);
+        return;
+    }
+
+    while(fgets(line, sizeof(line), fp)) {
+        size_t n = strlen(line);
+        if (n && line[n-1]=='\n') line[--n] = 0;
+
+        if (strncmp(line, "brick ", 6) == 0) {
+            entry = &fEntries[line + 6];
+            entry->fMemoryMap.resize(0);
+            entry->fChunks.resize(0);
+        }
+        else if (entry && strncmp(line, "map ", 4) == 0) {
+            for(const char *p = line + 4; p[0] && p[1]; p += 2) {
+                char hex[3] = { p[0], p[1], 0 };
+                entry->fMemoryMap.push_back((UByte)strtoul(hex, 0, 16));
+            }
+        }
+        else if (entry && strncmp(line, "chunk ", 6) == 0) {
+            unsigned type, number;
+            unsigned long hash;
+
+            if (sscanf(line + 6, "%u %u %lx", &type, &number, &hash) != 3 ||
+                type >= kRCX_ChunkTypeCount || number > 255)
+                break;
+
+            Chunk c;
+            c.fType = (RCX_ChunkType)type;
+            c.fNumber = (UByte)number;
+            c.fHash = hash;
+            entry->fChunks.push_back(c);
+        }
+        else
+            break;
+    }
+
+    fclose(fp);
+}
+
+
+void RCX_DownloadHistory::Save() const
+{
+    if (fFilename.empty()) return;
+
+    FILE *fp = fopen(fFilename.c_str(), "w");
+    if (!fp) return;
+
+    fputs(kHistoryHeader, fp);
+
+    map<string, Entry>::const_iterator i;
+    for(i = fEntries.begin(); i != fEntries.end(); ++i) {
+        const Entry &e = i->second;
+
+        fprintf(fp, "brick %s\nmap ", i->first.c_str());
+        for(size_t j=0; j<e.fMemoryMap.size(); ++j)
+            fprintf(fp, "%02x", e.fMemoryMap[j]);
+        fputc('\n', fp);
+
+        for(size_t j=0; j<e.fChunks.size(); ++j)
+            fprintf(fp, "chunk %d %d %08lx\n", e.fChunks[j].fType,
+                e.fChunks[j].fNumber, e.fChunks[j].fHash);
+    }
+
+    fclose(fp);
+}
@@ -0,0 +1,74 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __RCX_DownloadHistory_h
+#define __RCX_DownloadHistory_h
+
+#ifndef __PTypes_h
+#include "PTypes.h"
+#endif
+
+#ifndef __RCX_Constants_h
+#include "RCX_Constants.h"
+#endif
+
+#include <vector>
+#include <string>
+#include <map>
+
+using std::vector;
+using std::string;
+using std::map;
+
+/*
+ * What was last downloaded to each brick, saved in a file so that
+ * RCX_Link can send just the chunks that changed.  A brick is named
+ * by the port, target, firmware version and program slot.  Its entry
+ * also keeps the brick's memory map as it was after the download;
+ * if the map has changed since (the brick was reset, or something
+ * else downloaded to it) the entry is of no use.
+ *
+ * A history with no filename is only kept in memory.
+ */
+class RCX_DownloadHistory
+{
+public:
+    struct Chunk {
+        RCX_ChunkType fType;
+        UByte fNumber;
+        ULong fHash;
+    };
+
+    struct Entry {
+        vector<UByte> fMemoryMap;
+        vector<Chunk> fChunks;
+    };
+
+    RCX_DownloadHistory(const char *filename);
+
+    bool Find(const string &brick, Entry &entry) const;
+    // the file is saved each time an entry changes
+    void Store(const string &brick, const Entry &entry);
+    void Forget(const string &brick);
+
+    static ULong Hash(const UByte *data, int length);
+
+private:
+    void Load();
+    void Save() const;
+
+    string fFilename;
+    map<string, Entry> fEntries;
+};
+
+#endif
@@ -0,0 +1,1019 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include <cstdio>
+#include <cstring>
+#include <climits>
+#include <algorithm>
+
+#include "RCX_Emulator.h"
+#include "RCX_Image.h"
+#include "RCX_Profile.h"
+#include "RCX_Constants.h"
+
+#define kChunkSlots     256
+#define kTimerTick      100     // ms per count of the timers
+#define kFastTimerTick  10      // ms per count of the fast timers
+#define kWaitTick       10      // ms per count of a wait
+
+// DecodeOp()'s target for an instruction that doesn't jump
+#define kNoJump         INT_MIN
+
+#define WORD(ptr)   ((short)((((ptr)[1]) << 8) + ((ptr)[0])))
+
+const double RCX_Emulator::kInstructionTime = 0.8;
+const double RCX_Emulator::kOperandTime = 0.1;
+
+static int JumpOffset(UByte b1, UByte b2 = 0);
+static bool MoreTime(const pair<RCX_Emulator::Line, RCX_Emulator::Usage> &a,
+    const pair<RCX_Emulator::Line, RCX_Emulator::Usage> &b);
+
+// bytes in each instruction, or 0 for those that aren't emulated
+static const int sLengths[256] = {
+//  0  1  2  3  4  5  6  7  8  9  a  b  c  d  e  f
+    0, 0, 3, 4, 5, 6, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,   // 0x
+    0, 0, 0, 4, 5, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,   // 1x
+    0, 2, 3, 4, 5, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,   // 2x
+    0, 2, 3, 4, 5, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,   // 3x
+    0, 0, 3, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,   // 4x
+    1, 2, 3, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,   // 5x
+    1, 0, 3, 0, 5, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,   // 6x
+    0, 2, 3, 4, 5, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,   // 7x
+    1, 2, 3, 0, 5, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,   // 8x
+    1, 0, 3, 4, 5, 8, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,   // 9x
+    1, 2, 0, 4, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,   // ax
+    1, 0, 3, 0, 5, 6, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,   // bx
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,   // cx
+    1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,   // dx
+    1, 2, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,   // ex
+    0, 0, 3, 4, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0    // fx
+};
+
+
+RCX_Emulator::RCX_Emulator() :
+    fTarget(getTarget(kRCX_RCX2Target)),
+    fProfiling(false),
+    fTracing(false)
+{
+    Chunk none = { 0, 0 };
+
+    fTaskCode.resize(kChunkSlots, none);
+    fSubCode.resize(kChunkSlots, none);
+    Reset();
+}
+
+
+void RCX_Emulator::Load(const RCX_Image &image)
+{
+    Chunk none = { 0, 0 };
+
+    fTarget = getTarget(image.GetTargetType());
+    fTaskCode.assign(kChunkSlots, none);
+    fSubCode.assign(kChunkSlots, none);
+
+    for(int i=0; i<image.GetChunkCount(); ++i) {
+        const RCX_Image::Chunk &c = image.GetChunk(i);
+        Chunk *code;
+
+        if (c.GetType() == kRCX_TaskChunk)
+            code = &fTaskCode[c.GetNumber()];
+        else if (c.GetType() == kRCX_SubChunk)
+            code = &fSubCode[c.GetNumber()];
+        else
+            continue;
+
+        // everything that can be reached from the start, and the end,
+        // which a sub's return goes to
+        code->fData = c.GetData();
+        code->fLength = c.GetLength();
+        code->fStarts.assign(code->fLength + 1, -1);
+        Decode(*code, 0);
+        Decode(*code, code->fLength);
+    }
+
+    Reset();
+}
+
+
+/*
+ * Decode the instructions from pc on, until one that doesn't go on to
+ * the next or one that was decoded before, and then those they can
+ * jump to.
+ *
+ * @return the op at pc
+ */
+int RCX_Emulator::Decode(Chunk &c, int pc)
+{
+    if (c.fStarts[pc] >= 0) return c.fStarts[pc];
+
+    int first = (int)c.fOps.size();
+    vector<int> jumps;
+
+    while(true) {
+        int i = (int)c.fOps.size();
+        Op op;
+
+        DecodeOp(c, pc, op);
+        c.fStarts[pc] = i;
+        c.fOps.push_back(op);
+
+        if (op.fFault || pc == c.fLength) break;
+        if (op.fTarget != kNoJump) jumps.push_back(i);
+
+        pc += sLengths[op.fCode[0]];
+        if (c.fStarts[pc] >= 0) {
+            c.fOps[i].fNext = c.fStarts[pc];
+            break;
+        }
+        c.fOps[i].fNext = i + 1;
+    }
+
+    for(size_t j=0; j<jumps.size(); ++j) {
+        int target = c.fOps[jumps[j]].fTarget;
+        int op = (target >= 0 && target <= c.fLength) ? Decode(c, target) : -1;
+        c.fOps[jumps[j]].fTarget = op;
+    }
+
+    return first;
+}
+
+
+/*
+ * Fill in op for the instruction at pc (or the end of the chunk), with
+ * the pc a jump goes to as its target, or kNoJump.
+ */
+void RCX_Emulator::DecodeOp(const Chunk &c, int pc, Op &op)
+{
+    const UByte *code = c.fData + pc;
+
+    op.fCode = code;
+    op.fPC = pc;
+    op.fNext = -1;
+    op.fTarget = kNoJump;
+    op.fFault = 0;
+    op.fCost = kInstructionTime;
+    op.fPoll = false;
+
+    if (pc == c.fLength) return;
+
+    int length = sLengths[code[0]];
+    op.fCost = GetCost(code[0]);
+
+    if (length == 0) {
+        op.fFault = "unknown opcode";
+        return;
+    }
+
+    if (pc + length > c.fLength) {
+        op.fFault = "instruction runs past the end";
+        return;
+    }
+
+    switch(code[0]) {
+        case kRCX_SJumpOp:
+            op.fTarget = pc + 1 + JumpOffset(code[1]);
+            break;
+        case kRCX_JumpOp:
+            op.fTarget = pc + 1 + JumpOffset(code[1], code[2]);
+            break;
+        case kRCX_STestOp:
+            op.fTarget = pc + 6 + (signed char)code[6];
+            op.fPoll = (op.fTarget == pc);
+            break;
+        case kRCX_TestOp:
+            op.fTarget = pc + 6 + WORD(code+6);
+            op.fPoll = (op.fTarget == pc);
+            break;
+        case kRCX_SCheckLoopOp:
+            op.fTarget = pc + 1 + (signed char)code[1];
+            break;
+        case kRCX_CheckLoopOp:
+            op.fTarget = pc + 1 + WORD(code+1);
+            break;
+        case kRCX_SDecVarJmpLTZeroOp:
+            op.fTarget = pc + 2 + JumpOffset(code[2]);
+            break;
+        case kRCX_DecVarJmpLTZeroOp:
+            op.fTarget = pc + 2 + JumpOffset(code[2], code[3]);
+            break;
+    }
+}
+
+
+void RCX_Emulator::Reset()
+{
+    Task idle;
+
+    idle.fRunning = false;
+    idle.fWake = 0;
+    idle.fChunk = 0;
+    idle.fOp = 0;
+    idle.fSub = -1;
+    idle.fLocals.resize(fTarget->fMaxTaskVars, 0);
+
+    fTasks.assign(kChunkSlots, idle);
+    fActive.clear();
+    fVars.assign(fTarget->fMaxGlobalVars, 0);
+
+    fClock = 0;
+    fInstructions = 0;
+
+    for(int i=0; i<kTimerCount; ++i)
+        fTimers[i] = 0;
+    for(int i=0; i<kCounterCount; ++i)
+        fCounters[i] = 0;
+    for(int i=0; i<kOutputCount; ++i) {
+        fOutputs[i].fMode = kRCX_OutputFloat;
+        fOutputs[i].fDir = kRCX_OutputForward;
+        fOutputs[i].fPower = 7;
+    }
+    for(int i=0; i<kInputCount; ++i) {
+        fInputs[i].fType = kRCX_InputNone;
+        fInputs[i].fMode = kRCX_InputPercentage;
+        fInputs[i].fValue = 0;
+    }
+
+    fWatch = 0;
+    fMessage = 0;
+    fRandom = 1;
+
+    fSent.clear();
+    fLog.clear();
+    fLogSize = 0;
+    fSounds = 0;
+    fErrors.clear();
+    fTrace.clear();
+    fStepTask = -1;
+    fStep = 0;
+    fStepPC = 0;
+}
+
+
+void RCX_Emulator::Start()
+{
+    // the first task is the one the program starts with (task 0 on
+    // most targets, task 8 on Spybotics)
+    for(int n=0; n<kChunkSlots; ++n) {
+        if (fTaskCode[n].fData) {
+            StartTask(n);
+            return;
+        }
+    }
+}
+
+
+bool RCX_Emulator::IsRunning() const
+{
+    return !fActive.empty();
+}
+
+
+/**
+ * @return the first running task after task n, or -1
+ */
+int RCX_Emulator::NextTask(int n) const
+{
+    vector<int>::const_iterator i = std::upper_bound(fActive.begin(), fActive.end(), n);
+
+    return (i == fActive.end()) ? -1 : *i;
+}
+
+
+bool RCX_Emulator::Run(double ms)
+{
+    while(fClock < ms) {
+        bool ran = false;
+        bool running = false;
+        double wake = ms;
+
+        // one instruction from each task that isn't waiting (a task
+        // that one of them starts gets its turn if it comes later)
+        for(int n=NextTask(-1); n>=0; n=NextTask(n)) {
+            Task &t = fTasks[n];
+
+            running = true;
+
+            if (t.fWake > fClock) {
+                if (t.fWake < wake) wake = t.fWake;
+                continue;
+            }
+
+            Step(n, ms);
+            ran = true;
+        }
+
+        if (!running) return true;
+
+        // every task is waiting, so skip to the first one to wake
+        if (!ran) fClock = wake;
+    }
+
+    return !IsRunning();
+}
+
+
+void RCX_Emulator::StartTask(int n)
+{
+    Task &t = fTasks[n];
+
+    if (!fTaskCode[n].fData) return;
+
+    // starting a running task restarts it
+    if (!t.fRunning)
+        fActive.insert(std::lower_bound(fActive.begin(), fActive.end(), n), n);
+    t.fRunning = true;
+    t.fWake = fClock;
+    t.fChunk = &fTaskCode[n];
+    t.fOp = t.fChunk->fStarts[0];
+    t.fSub = -1;
+    t.fCalls.clear();
+    t.fLoops.clear();
+}
+
+
+void RCX_Emulator::StopTask(int n)
+{
+    Task &t = fTasks[n];
+
+    if (t.fRunning)
+        fActive.erase(std::lower_bound(fActive.begin(), fActive.end(), n));
+    t.fRunning = false;
+    t.fCalls.clear();
+    t.fLoops.clear();
+}
+
+
+void RCX_Emulator::Step(int n, double ms)
+{
+    Task &t = fTasks[n];
+    Chunk &c = *t.fChunk;
+    const Op &op = c.fOps[t.fOp];
+
+    fClock += op.fCost;
+    ++fInstructions;
+
+    if (fProfiling && op.fPC < c.fLength) {
+        if (c.fCounts.empty()) c.fCounts.resize(c.fLength, 0);
+        ++c.fCounts[op.fPC];
+    }
+
+    // running off the end of a sub returns from it, and off the end of
+    // a task stops it
+    if (op.fPC == c.fLength) {
+        if (t.fSub < 0) {
+            StopTask(n);
+            return;
+        }
+
+        const Return &r = t.fCalls.back();
+        t.fSub = r.fSub;
+        t.fChunk = (r.fSub >= 0) ? &fSubCode[r.fSub] : &fTaskCode[n];
+        t.fOp = r.fOp;
+        t.fCalls.pop_back();
+        return;
+    }
+
+    if (op.fFault) {
+        Fail(n, t, op, op.fFault);
+        StopTask(n);
+        return;
+    }
+
+    if (op.fPoll) {
+        Poll(t, n, op, ms);
+        return;
+    }
+
+    if (!Execute(t, n))
+        StopTask(n);
+}
+
+
+/*
+ * Run a test that jumps to itself (as until() and while() with nothing
+ * to do compile to) for as long as it jumps and no other task would
+ * get a turn, which is until one wakes up or the clock reaches ms.
+ * That's the same as going round the tasks, just without the others
+ * being checked each time.  The first test has been counted already.
+ */
+void RCX_Emulator::Poll(Task &t, int n, const Op &op, double ms)
+{
+    double limit = ms;
+    long count = 0;
+
+    for(size_t i=0; i<fActive.size(); ++i) {
+        const Task &other = fTasks[fActive[i]];
+
+        if (fActive[i] != n && other.fWake < limit)
+            limit = other.fWake;
+    }
+
+    while(true) {
+        if (!Compare(t, op.fCode+1)) {
+            t.fOp = op.fNext;
+            break;
+        }
+
+        // it jumps to itself, and goes again if nothing else would run
+        if (!(fClock < limit)) break;
+        fClock += op.fCost;
+        ++count;
+    }
+
+    fInstructions += count;
+    if (fProfiling)
+        t.fChunk->fCounts[op.fPC] += count;
+}
+
+
+/*
+ * Carry out the task's current instruction.  Returns false (having
+ * recorded the error) if the instruction can't be run.
+ */
+bool RCX_Emulator::Execute(Task &t, int n)
+{
+    const Op &o = t.fChunk->fOps[t.fOp];
+    const UByte *code = o.fCode;
+    UByte op = code[0];
+
+    t.fOp = o.fNext;
+    fStepTask = n;
+    fStep = &t;
+    fStepPC = o.fPC;
+
+    switch(op) {
+        // outputs
+        case kRCX_OutputModeOp:
+        case kRCX_GOutputModeOp:
+            SetOutputs(code[1] & 7, code[1] & 0xc0, 0xff, -1);
+            break;
+        case kRCX_OutputDirOp:
+        case kRCX_GOutputDirOp:
+            SetOutputs(code[1] & 7, 0xff, code[1] & 0xc0, -1);
+            break;
+        case kRCX_OutputPowerOp:
+        case kRCX_GOutputPowerOp:
+            SetOutputs(code[1] & 7, 0xff, 0xff, GetValue(t, code[2], code[3]));
+            break;
+
+        // inputs
+        case kRCX_InputModeOp:
+            if (code[1] < kInputCount) fInputs[code[1]].fMode = code[2];
+            break;
+        case kRCX_InputTypeOp:
+            if (code[1] < kInputCount) fInputs[code[1]].fType = code[2];
+            break;
+        case kRCX_ClearSensorOp:
+            if (code[1] < kInputCount) fInputs[code[1]].fValue = 0;
+            break;
+
+        // sound and display, which only need counting
+        case kRCX_PlaySoundOp:
+        case kRCX_PlayToneOp:
+        case 0x02:      // playv
+            ++fSounds;
+            if (fTracing) Trace(kSoundEvent, op, code[1]);
+            break;
+        case kRCX_DisplayOp:
+        case 0xe5:      // disp
+        case 0x80:      // playz
+        case 0xd0:      // mute
+        case 0xe0:      // speak
+        case kRCX_IRModeOp:
+            break;
+
+        // variables
+        case 0x14: case 0x24: case 0x34: case 0x44: case 0x54:
+        case 0x64: case 0x74: case 0x84: case 0x94:
+            VarOp(t, (op - 0x14) >> 4, code[1], GetValue(t, code[2], WORD(code+3)));
+            break;
+        case kRCX_SetSrcValueOp:
+            SetValue(t, code[1], code[2], GetValue(t, code[3], WORD(code+4)));
+            break;
+
+        // timing
+        case kRCX_DelayOp:
+            t.fWake = fClock + GetValue(t, code[1], WORD(code+2)) * kWaitTick;
+            break;
+        case kRCX_ClearTimerOp:
+            if (code[1] < kTimerCount) fTimers[code[1]] = fClock;
+            break;
+        case kRCX_SetWatchOp:
+            fWatch = code[1] * 60 + code[2] - (int)(fClock / 60000);
+            break;
+
+        // counters
+        case 0xa7:      // cntd
+            if (code[1] < kCounterCount) --fCounters[code[1]];
+            break;
+        case 0x97:      // cnti
+            if (code[1] < kCounterCount) ++fCounters[code[1]];
+            break;
+        case 0xb7:      // cntz
+            if (code[1] < kCounterCount) fCounters[code[1]] = 0;
+            break;
+
+        // messages and the datalog
+        case kRCX_ClearMsgOp:
+            fMessage = 0;
+            break;
+        case kRCX_SendMsgOp:
+            {
+                Message m = { fClock, (UByte)GetValue(t, code[1], code[2]) };
+                fSent.push_back(m);
+                if (fTracing) Trace(kMessageEvent, 0, m.fValue);
+            }
+            break;
+        case kRCX_SetDatalogOp:
+            fLogSize = WORD(code+1);
+            fLog.clear();
+            break;
+        case kRCX_DatalogOp:
+            if ((int)fLog.size() < fLogSize) {
+                fLog.push_back(GetValue(t, code[1], code[2]));
+                if (fTracing) Trace(kDatalogEvent, 0, fLog.back());
+            }
+            break;
+
+        // tasks
+        case kRCX_StartTaskOp:
+            if (!fTaskCode[code[1]].fData) {
+                Fail(n, t, o, "start of a missing task");
+                return false;
+            }
+            StartTask(code[1]);
+            break;
+        case kRCX_StopTaskOp:
+            StopTask(code[1]);
+            break;
+        case kRCX_StopAllOp:
+        case 0x60:      // offp
+            while(!fActive.empty())
+                StopTask(fActive.back());
+            break;
+
+        // subs
+        case kRCX_GoSubOp:
+            if (!fSubCode[code[1]].fData) {
+                Fail(n, t, o, "call of a missing sub");
+                return false;
+            }
+            if ((int)t.fCalls.size() >= kMaxCallDepth) {
+                Fail(n, t, o, "subs nested too deeply");
+                return false;
+            }
+            {
+                Return r = { t.fSub, t.fOp };
+                t.fCalls.push_back(r);
+            }
+            t.fSub = code[1];
+            t.fChunk = &fSubCode[code[1]];
+            t.fOp = t.fChunk->fStarts[0];
+            break;
+        case 0xf6:      // rets
+            if (t.fSub >= 0) t.fOp = t.fChunk->fStarts[t.fChunk->fLength];
+            break;
+
+        // jumps
+        case kRCX_SJumpOp:
+        case kRCX_JumpOp:
+            return Jump(t, n, o);
+        case kRCX_STestOp:
+        case kRCX_TestOp:
+            if (Compare(t, code+1))
+                return Jump(t, n, o);
+            break;
+
+        // loops
+        case kRCX_SetLoopOp:
+            if ((int)t.fLoops.size() >= kMaxLoopDepth) {
+                Fail(n, t, o, "loops nested too deeply");
+                return false;
+            }
+            t.fLoops.push_back(GetValue(t, code[1], code[2]));
+            break;
+        case kRCX_SCheckLoopOp:
+        case kRCX_CheckLoopOp:
+            if (t.fLoops.empty()) {
+                Fail(n, t, o, "loop check without a loop");
+                return false;
+            }
+            if (t.fLoops.back() <= 0) {
+                t.fLoops.pop_back();
+                return Jump(t, n, o);
+            }
+            --t.fLoops.back();
+            break;
+        case kRCX_SDecVarJmpLTZeroOp:
+        case kRCX_DecVarJmpLTZeroOp:
+        {
+            short v = GetValue(t, kRCX_VariableType, code[1]) - 1;
+
+            SetValue(t, kRCX_VariableType, code[1], v);
+            if (v >= 0) break;
+            return Jump(t, n, o);
+        }
+
+        // events and resources: events never fire, and resources are
+        // always free, so the handlers never run
+        case 0x03:      // event
+        case 0x06:      // dele
+        case 0x93:      // sete
+        case 0x04:      // cale
+        case kRCX_SStartEventMonOp:
+        case kRCX_StartEventMonOp:
+        case kRCX_ExitEventCheckOp:
+        case kRCX_EnterAccessCtrlOp:
+        case kRCX_ExitAccessCtrlOp:
+            break;
+
+        default:
+            // in the table, but only on some targets
+            Fail(n, t, o, "unknown opcode");
+            return false;
+    }
+
+    return true;
+}
+
+
+bool RCX_Emulator::Jump(Task &t, int n, const Op &op)
+{
+    if (op.fTarget < 0) {
+        Fail(n, t, op, "jump out of the chunk");
+        return false;
+    }
+
+    t.fOp = op.fTarget;
+    return true;
+}
+
+
+void RCX_Emulator::Fail(int n, const Task &t, const Op &op, const char *what)
+{
+    char text[128];
+
+    if (t.fSub >= 0)
+        snprintf(text, sizeof(text), "task %d, sub %d, pc %d (opcode %02x): %s",
+            n, t.fSub, op.fPC, op.fCode[0], what);
+    else
+        snprintf(text, sizeof(text), "task %d, pc %d (opcode %02x): %s",
+            n, op.fPC, op.fCode[0], what);
+
+    fErrors.push_back(text);
+}
+
+
+short RCX_Emulator::GetValue(const Task &t, int type, short data)
+{
+    int i = data;
+
+    switch(type) {
+        case kRCX_VariableType:
+            if (i >= 0 && i < (int)fVars.size()) return fVars[i];
+            i -= (int)fVars.size();
+            if (i >= 0 && i < (int)t.fLocals.size()) return t.fLocals[i];
+            return 0;
+        case kRCX_IndirectType:
+            return GetValue(t, kRCX_VariableType, GetValue(t, kRCX_VariableType, data));
+        case kRCX_ConstantType:
+            return data;
+        case kRCX_TimerType:
+            if (i < 0 || i >= kTimerCount) return 0;
+            return (short)((fClock - fTimers[i]) / kTimerTick);
+        case kRCX_TenMSTimerType:
+            if (i < 0 || i >= kTimerCount) return 0;
+            return (short)((fClock - fTimers[i]) / kFastTimerTick);
+        case kRCX_RandomType:
+            fRandom ^= (fRandom << 13) & 0xffffffffUL;
+            fRandom ^= fRandom >> 17;
+            fRandom ^= (fRandom << 5) & 0xffffffffUL;
+            return data > 0 ? (short)(fRandom % (data + 1)) : 0;
+        case kRCX_OutputStatusType:
+            return (i >= 0 && i < kOutputCount) ? GetOutputStatus(i) : 0;
+        case kRCX_InputValueType:
+        case kRCX_InputRawType:
+            return (i >= 0 && i < kInputCount) ? fInputs[i].fValue : 0;
+        case kRCX_InputBooleanType:
+            return (i >= 0 && i < kInputCount) ? fInputs[i].fValue != 0 : 0;
+        case kRCX_InputTypeType:
+            return (i >= 0 && i < kInputCount) ? fInputs[i].fType : 0;
+        case kRCX_InputModeType:
+            return (i >= 0 && i < kInputCount) ? fInputs[i].fMode : 0;
+        case kRCX_CounterType:
+            return (i >= 0 && i < kCounterCount) ? fCounters[i] : 0;
+        case kRCX_WatchType:
+            return (short)((fWatch + (int)(fClock / 60000)) % (24 * 60));
+        case kRCX_MessageType:
+            return fMessage;
+        default:
+            return 0;
+    }
+}
+
+
+void RCX_Emulator::SetValue(Task &t, int type, short data, short value)
+{
+    int i = data;
+
+    switch(type) {
+        case kRCX_VariableType:
+            if (i >= 0 && i < (int)fVars.size()) {
+                fVars[i] = value;
+                if (fTracing) Trace(kVarEvent, i, value);
+                break;
+            }
+            i -= (int)fVars.size();
+            if (i >= 0 && i < (int)t.fLocals.size())
+                t.fLocals[i] = value;
+            break;
+        case kRCX_IndirectType:
+            SetValue(t, kRCX_VariableType, GetValue(t, kRCX_VariableType, data), value);
+            break;
+        case kRCX_TimerType:
+            if (i >= 0 && i < kTimerCount) fTimers[i] = fClock - value * kTimerTick;
+            break;
+        case kRCX_TenMSTimerType:
+            if (i >= 0 && i < kTimerCount) fTimers[i] = fClock - value * kFastTimerTick;
+            break;
+        case kRCX_CounterType:
+            if (i >= 0 && i < kCounterCount) fCounters[i] = value;
+            break;
+        case kRCX_MessageType:
+            fMessage = (UByte)value;
+            break;
+        default:
+            break;
+    }
+}
+
+
+void RCX_Emulator::VarOp(Task &t, int code, int var, short value)
+{
+    short v = GetValue(t, kRCX_VariableType, var);
+
+    switch(code) {
+        case kRCX_SetVar:   v = value; break;
+        case kRCX_AddVar:   v = v + value; break;
+        case kRCX_SubVar:   v = v - value; break;
+        case kRCX_DivVar:   if (value) v = v / value; break;
+        case kRCX_MulVar:   v = v * value; break;
+        case kRCX_SgnVar:   v = value > 0 ? 1 : value < 0 ? -1 : 0; break;
+        case kRCX_AbsVar:   v = value < 0 ? -value : value; break;
+        case kRCX_AndVar:   v = v & value; break;
+        case kRCX_OrVar:    v = v | value; break;
+    }
+
+    SetValue(t, kRCX_VariableType, var, v);
+}
+
+
+/*
+ * cond is v1 type (with the relation in the top two bits), v2 type,
+ * v1 data (16 bits), and v2 data (8 bits).  The branch is taken when
+ * the relation holds.
+ */
+bool RCX_Emulator::Compare(const Task &t, const UByte *cond)
+{
+    short v1 = GetValue(t, cond[0] & 0x3f, WORD(cond+2));
+    short v2 = GetValue(t, cond[1] & 0x3f, cond[4]);
+
+    switch((cond[0] >> 6) & 3) {
+        case kRCX_LessOrEqual:      return v1 <= v2;
+        case kRCX_GreaterOrEqual:   return v1 >= v2;
+        case kRCX_NotEqualTo:       return v1 != v2;
+        default:                    return v1 == v2;
+    }
+}
+
+
+void RCX_Emulator::SetOutputs(int mask, UByte mode, UByte dir, int power)
+{
+    for(int i=0; i<kOutputCount; ++i) {
+        Output &o = fOutputs[i];
+
+        if (!(mask & (1 << i))) continue;
+
+        UByte status = GetOutputStatus(i);
+
+        if (mode != 0xff) o.fMode = mode;
+        if (dir == kRCX_OutputToggle)
+            o.fDir = (o.fDir == kRCX_OutputForward) ? kRCX_OutputBackward : kRCX_OutputForward;
+        else if (dir != 0xff)
+            o.fDir = dir;
+        if (power >= 0) o.fPower = power > 7 ? 7 : power;
+
+        if (fTracing && GetOutputStatus(i) != status)
+            Trace(kOutputEvent, i, GetOutputStatus(i));
+    }
+}
+
+
+UByte RCX_Emulator::GetOutputStatus(int i) const
+{
+    const Output &o = fOutputs[i];
+
+    return o.fMode | (o.fDir == kRCX_OutputForward ? 0x08 : 0) | o.fPower;
+}
+
+
+/*
+ * Add an event done by the instruction being run.
+ */
+void RCX_Emulator::Trace(int kind, int index, short value)
+{
+    if (fTrace.size() >= (size_t)kMaxEvents) return;
+
+    Event e = { fClock, (UByte)kind, (short)index, value, fStepTask,
+        fStep ? fStep->fSub : -1, fStepPC };
+    fTrace.push_back(e);
+}
+
+
+void RCX_Emulator::PrintState(FILE *fp, const RCX_Image *image) const
+{
+    static const char *modeNames[] = { "Float", "Off", "On" };
+
+    fprintf(fp, "Time: %.0f ms, %ld instructions, %s\n", fClock, fInstructions,
+        IsRunning() ? "still running" : "stopped");
+
+    for(int i=0; i<(int)fVars.size(); ++i) {
+        const char *name = image ? image->GetVariableName(i) : 0;
+
+        if (name)
+            fprintf(fp, "Var %d = %d (%s)\n", i, fVars[i], name);
+        else if (fVars[i])
+            fprintf(fp, "Var %d = %d\n", i, fVars[i]);
+    }
+
+    for(int i=0; i<kOutputCount; ++i) {
+        const Output &o = fOutputs[i];
+
+        fprintf(fp, "Output %c: %s, %s, power %d\n", 'A' + i,
+            modeNames[(o.fMode >> 6) & 3],
+            o.fDir == kRCX_OutputForward ? "Fwd" : "Rev", o.fPower);
+    }
+
+    if (fSounds)
+        fprintf(fp, "Sounds: %d\n", fSounds);
+
+    if (!fSent.empty()) {
+        fprintf(fp, "Messages:");
+        for(size_t i=0; i<fSent.size(); ++i)
+            fprintf(fp, " %d", fSent[i].fValue);
+        fprintf(fp, "\n");
+    }
+
+    if (!fLog.empty()) {
+        fprintf(fp, "Datalog:");
+        for(size_t i=0; i<fLog.size(); ++i)
+            fprintf(fp, " %d", fLog[i]);
+        fprintf(fp, "\n");
+    }
+
+    for(size_t i=0; i<fErrors.size(); ++i)
+        fprintf(fp, "Error: %s\n", fErrors[i].c_str());
+}
+
+
+double RCX_Emulator::GetCost(UByte op)
+{
+    // the firmware spends most of its time fetching and decoding, so
+    // the longer instructions take longer
+    int length = sLengths[op];
+
+    return length ? kInstructionTime + kOperandTime * (length - 1) : kInstructionTime;
+}
+
+
+void RCX_Emulator::PrintProfile(FILE *fp, const RCX_Image &image) const
+{
+    map<Line, Usage> lines;
+    vector<Usage> chunks(image.GetChunkCount());
+    Usage total = { 0, 0 };
+
+    for(int i=0; i<image.GetChunkCount(); ++i) {
+        const RCX_Image::Chunk &c = image.GetChunk(i);
+        const Chunk *code;
+
+        if (c.GetType() == kRCX_TaskChunk)
+            code = &fTaskCode[c.GetNumber()];
+        else if (c.GetType() == kRCX_SubChunk)
+            code = &fSubCode[c.GetNumber()];
+        else
+            continue;
+
+        for(int pc=0; pc<(int)code->fCounts.size(); ++pc) {
+            long count = code->fCounts[pc];
+            if (!count) continue;
+
+            double time = count * GetCost(code->fData[pc]);
+            chunks[i].fCount += count;
+            chunks[i].fTime += time;
+
+            Line l;
+            if (c.FindLine(pc, l.first, l.second)) {
+                Usage &u = lines[l];
+                u.fCount += count;
+                u.fTime += time;
+            }
+        }
+
+        total.fCount += chunks[i].fCount;
+        total.fTime += chunks[i].fTime;
+    }
+
+    fprintf(fp, "Profile: %ld instructions, %.1f ms\n", total.fCount, total.fTime);
+    if (!total.fCount) return;
+
+    fprintf(fp, "%10s %10s %6s  %s\n", "count", "ms", "%", "task or sub");
+    for(int i=0; i<image.GetChunkCount(); ++i) {
+        const RCX_Image::Chunk &c = image.GetChunk(i);
+        const Usage &u = chunks[i];
+
+        if (!u.fCount) continue;
+        fprintf(fp, "%10ld %10.1f %6.1f  %s %d %s\n", u.fCount, u.fTime,
+            100 * u.fTime / total.fTime,
+            c.GetType() == kRCX_TaskChunk ? "task" : "sub",
+            c.GetNumber(), c.GetName());
+    }
+
+    if (lines.empty()) return;
+
+    // the hottest lines first
+    vector<pair<Line, Usage> > sorted(lines.begin(), lines.end());
+    std::stable_sort(sorted.begin(), sorted.end(), MoreTime);
+
+    fprintf(fp, "%10s %10s %6s  %s\n", "count", "ms", "%", "line");
+    for(size_t i=0; i<sorted.size(); ++i) {
+        const Line &l = sorted[i].first;
+        const Usage &u = sorted[i].second;
+        const char *name = image.GetSourceName(l.first);
+
+        fprintf(fp, "%10ld %10.1f %6.1f  %s:%ld\n", u.fCount, u.fTime,
+            100 * u.fTime / total.fTime, name ? name : "?", l.second);
+    }
+}
+
+
+void RCX_Emulator::GetProfile(const RCX_Image &image, RCX_Profile &profile) const
+{
+    map<Line, long> lines;
+
+    for(int i=0; i<image.GetChunkCount(); ++i) {
+        const RCX_Image::Chunk &c = image.GetChunk(i);
+        const Chunk *code;
+
+        if (c.GetType() == kRCX_TaskChunk)
+            code = &fTaskCode[c.GetNumber()];
+        else if (c.GetType() == kRCX_SubChunk)
+            code = &fSubCode[c.GetNumber()];
+        else
+            continue;
+
+        for(int pc=0; pc<(int)code->fCounts.size(); ++pc) {
+            long count = code->fCounts[pc];
+            Line l;
+
+            if (count && c.FindLine(pc, l.first, l.second)) {
+                long &n = lines[l];
+                if (count > n) n = count;
+            }
+        }
+    }
+
+    map<Line, long>::const_iterator i;
+    for(i = lines.begin(); i != lines.end(); ++i) {
+        const char *name = image.GetSourceName(i->first.first);
+        if (name) profile.Add(name, i->first.second, i->second);
+    }
+}
+
+
+bool MoreTime(const pair<RCX_Emulator::Line, RCX_Emulator::Usage> &a,
+    const pair<RCX_Emulator::Line, RCX_Emulator::Usage> &b)
+{
+    return a.second.fTime > b.second.fTime;
+}
+
+
+/*
+ * The jumps keep their direction in the sign bit of the first byte,
+ * with 7 bits of distance there and 8 more in the second byte.
+ */
+int JumpOffset(UByte b1, UByte b2)
+{
+    int x = (b1 & 0x7f) + (b2 << 7);
+
+    return (b1 & 0x80) ? -x : x;
+}
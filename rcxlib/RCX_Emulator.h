@@ -0,0 +1,271 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __RCX_Emulator_h
+#define __RCX_Emulator_h
+
+#ifndef __PTypes_h
+#include "PTypes.h"
+#endif
+
+#ifndef __RCX_Target_h
+#include "RCX_Target.h"
+#endif
+
+#include <cstdio>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+using std::map;
+using std::pair;
+using std::string;
+using std::vector;
+
+class RCX_Image;
+class RCX_Profile;
+
+/*
+ * Runs the tasks and subs of an image on the host, so programs can be
+ * tested without a brick.  The tasks take turns one instruction at a
+ * time, as they do in the firmware, and each instruction takes the
+ * simulated time GetCost() estimates for it.  Waits and timers use the
+ * simulated clock, so a run takes as long as the instructions do
+ * rather than as long as the program would on a brick.  When every task
+ * is waiting the clock skips to the first to wake, and a task polling
+ * a condition while the others wait goes round without taking turns.
+ *
+ * With SetProfiling() the instructions run at each address are counted,
+ * and PrintProfile() totals them by task or sub and by source line.
+ * GetProfile() keeps how often each line ran, for the compiler.
+ *
+ * With SetTracing() what the program does that can be seen from
+ * outside (outputs, sounds, messages, the datalog and the global
+ * variables) is also kept as a list of events, each saying which task
+ * did it and where, so two builds of a program can be compared.
+ *
+ * Each chunk is decoded once, when it is loaded, into instructions that
+ * know what they cost and where they jump to, so running them only has
+ * to carry them out.
+ *
+ * The inputs read whatever SetInput() gave them (0 to start with), and
+ * the outputs, sounds, messages and datalog are only recorded (an
+ * RCX_EmulatorFleet passes the messages between bricks).  Events
+ * never fire, and acquire always gets its resources at once.
+ *
+ * The instructions are those that nqc generates for the RCX, RCX2,
+ * CyberMaster, Scout and Spybotics.  A task that reaches anything else
+ * stops, and the error is kept for GetErrors().  The Swan's programs
+ * use its own instructions from the start, so CanRun() turns them away.
+ */
+class RCX_Emulator
+{
+public:
+    enum {
+        kInputCount = 3,
+        kOutputCount = 3,
+        kTimerCount = 4,
+        kCounterCount = 3,
+        kMaxCallDepth = 8,
+        kMaxLoopDepth = 4,
+        kMaxEvents = 100000     // traced at most, for a program that runs on
+    };
+
+    // milliseconds of simulated time per instruction, and for each
+    // byte of its operands, roughly what the RCX firmware takes
+    static const double kInstructionTime;
+    static const double kOperandTime;
+
+    // a source file index and line number, and what ran there
+    typedef pair<int, long> Line;
+    struct Usage {
+        long fCount;
+        double fTime;
+    };
+
+    // a message the program sent, and when
+    struct Message {
+        double fTime;
+        UByte fValue;
+    };
+
+    // something the program did, when tracing
+    enum EventKind {
+        kOutputEvent,       // fIndex is the output, fValue its status
+        kSoundEvent,        // fIndex is the opcode, fValue its operand
+        kMessageEvent,      // fValue was sent
+        kDatalogEvent,      // fValue was logged
+        kVarEvent           // global fIndex was set to fValue
+    };
+
+    struct Event {
+        double fTime;
+        UByte fKind;
+        short fIndex;
+        short fValue;
+        int fTask;
+        int fSub;           // -1 for the task's own code
+        int fPC;
+    };
+
+    /// estimated ms the firmware takes to run an instruction
+    static double GetCost(UByte op);
+
+    /// @return false for a target whose programs the emulator can't run
+    static bool CanRun(RCX_TargetType type) { return type != kRCX_SwanTarget; }
+
+    RCX_Emulator();
+
+    /// take the tasks and subs of an image, and reset the brick
+    void Load(const RCX_Image &image);
+
+    /// start the first task, as the Run button does
+    void Start();
+
+    /// run until every task has stopped or the clock reaches ms
+    /// @return true if the tasks have all stopped
+    bool Run(double ms);
+
+    void SetInput(int i, short value) { fInputs[i].fValue = value; }
+    void SetMessage(int m) { fMessage = (UByte)m; }
+    /// seed Random() (Load starts it over at the same seed)
+    void SetSeed(ULong seed) { fRandom = seed ? seed : 1; }
+    /// count the instructions run at each address (from the next Load)
+    void SetProfiling(bool p) { fProfiling = p; }
+    /// keep a trace of events (from the next Load)
+    void SetTracing(bool t) { fTracing = t; }
+
+    bool IsRunning() const;
+    double GetClock() const { return fClock; }
+    long GetInstructionCount() const { return fInstructions; }
+    short GetVar(int i) const { return fVars[i]; }
+    int GetVarCount() const { return (int)fVars.size(); }
+    const vector<string>& GetErrors() const { return fErrors; }
+    /// the messages sent so far, in order
+    const vector<Message>& GetSent() const { return fSent; }
+    /// the events so far, in the order they happened
+    const vector<Event>& GetTrace() const { return fTrace; }
+
+    /// print the clock, the variables and outputs, and what was sent
+    void PrintState(FILE *fp, const RCX_Image *image = 0) const;
+    /// print the instructions and time spent in each task and sub, and
+    /// on each source line (if the image has source information), for
+    /// the image that was loaded
+    void PrintProfile(FILE *fp, const RCX_Image &image) const;
+    /// add how many times each source line ran to profile (a line runs
+    /// as often as its most run instruction)
+    void GetProfile(const RCX_Image &image, RCX_Profile &profile) const;
+
+private:
+    // a decoded instruction
+    struct Op {
+        const UByte *fCode;
+        int fPC;                // offset in the chunk
+        int fNext;              // the op that follows
+        int fTarget;            // the op a jump goes to, or -1 if outside
+        const char *fFault;     // why it can't be run, or 0
+        double fCost;
+        bool fPoll;             // a test that jumps to itself
+    };
+
+    struct Chunk {
+        const UByte *fData;
+        int fLength;
+        vector<Op> fOps;        // the end of the chunk is an op too
+        vector<int> fStarts;    // op at each pc, or -1 (pc fLength is the end)
+        vector<long> fCounts;   // instructions run at each pc (if profiling)
+    };
+
+    // where a sub returns to
+    struct Return {
+        int fSub;               // -1 for the task
+        int fOp;
+    };
+
+    struct Task {
+        bool fRunning;
+        double fWake;           // clock at which a wait ends
+        Chunk *fChunk;
+        int fOp;
+        int fSub;               // sub being run, or -1
+        vector<short> fLocals;  // task variables (RCX2 and Scout)
+        vector<Return> fCalls;
+        vector<int> fLoops;     // loop counters
+    };
+
+    struct Output {
+        UByte fMode;
+        UByte fDir;
+        UByte fPower;
+    };
+
+    struct Input {
+        UByte fType;
+        UByte fMode;
+        short fValue;
+    };
+
+    static int  Decode(Chunk &c, int pc);
+    static void DecodeOp(const Chunk &c, int pc, Op &op);
+
+    void    Reset();
+    int     NextTask(int n) const;
+    void    StartTask(int n);
+    void    StopTask(int n);
+    void    Step(int n, double ms);
+    bool    Execute(Task &t, int n);
+    void    Poll(Task &t, int n, const Op &op, double ms);
+    bool    Jump(Task &t, int n, const Op &op);
+    void    Fail(int n, const Task &t, const Op &op, const char *what);
+
+    short   GetValue(const Task &t, int type, short data);
+    void    SetValue(Task &t, int type, short data, short value);
+    void    VarOp(Task &t, int code, int var, short value);
+    bool    Compare(const Task &t, const UByte *cond);
+    void    SetOutputs(int mask, UByte mode, UByte dir, int power);
+    UByte   GetOutputStatus(int i) const;
+    void    Trace(int kind, int index, short value);
+
+    const RCX_Target *fTarget;
+    bool fProfiling;
+    bool fTracing;
+    vector<Chunk> fTaskCode;
+    vector<Chunk> fSubCode;
+
+    double fClock;
+    long fInstructions;
+    vector<Task> fTasks;
+    vector<int> fActive;    // the running tasks, in order
+    vector<short> fVars;
+    double fTimers[kTimerCount];    // clock when each timer was zero
+    short fCounters[kCounterCount];
+    Output fOutputs[kOutputCount];
+    Input fInputs[kInputCount];
+    int fWatch;             // minutes at clock 0
+    UByte fMessage;         // last message received
+    ULong fRandom;
+
+    // what the program did
+    vector<Message> fSent;  // messages sent
+    vector<short> fLog;     // datalog
+    int fLogSize;
+    int fSounds;
+    vector<string> fErrors;
+    vector<Event> fTrace;
+    int fStepTask;          // the task running an instruction, and where
+    const Task *fStep;
+    int fStepPC;
+};
+
+#endif
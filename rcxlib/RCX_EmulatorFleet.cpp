@@ -0,0 +1,201 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include "RCX_EmulatorFleet.h"
+
+#include <algorithm>
+
+#ifndef NO_THREADS
+#include <atomic>
+#include <thread>
+#endif
+
+// too few bricks to be worth a thread of their own
+#define kMinBricksPerJob    4
+
+const double RCX_EmulatorFleet::kMessageTime = 9 * 11 * 1000.0 / 2400;
+
+// a message to be passed on, and the brick that sent it
+struct FleetMessage {
+    double fTime;
+    int fBrick;
+    UByte fValue;
+
+    bool operator<(const FleetMessage &s) const {
+        return fTime < s.fTime || (fTime == s.fTime && fBrick < s.fBrick);
+    }
+};
+
+
+RCX_EmulatorFleet::~RCX_EmulatorFleet()
+{
+    for(size_t i=0; i<fBricks.size(); ++i)
+        delete fBricks[i];
+}
+
+
+void RCX_EmulatorFleet::Add(const RCX_Image &image, int count)
+{
+    for(int i=0; i<count; ++i) {
+        RCX_Emulator *e = new RCX_Emulator;
+        e->Load(image);
+        // spread out, the first numbers of nearby seeds are alike
+        e->SetSeed(((ULong)fBricks.size() + 1) * 2654435761UL & 0xffffffffUL);
+        fBricks.push_back(e);
+        fPassed.push_back(0);
+    }
+}
+
+
+void RCX_EmulatorFleet::Start()
+{
+    for(size_t i=0; i<fBricks.size(); ++i)
+        fBricks[i]->Start();
+}
+
+
+bool RCX_EmulatorFleet::IsRunning() const
+{
+    for(size_t i=0; i<fBricks.size(); ++i)
+        if (fBricks[i]->IsRunning()) return true;
+
+    return false;
+}
+
+
+bool RCX_EmulatorFleet::Run(double ms, int jobs)
+{
+#ifndef NO_THREADS
+    if (jobs <= 0)
+        jobs = (int)std::thread::hardware_concurrency();
+#endif
+
+    while(fClock < ms && IsRunning()) {
+        double end = std::min(fClock + kMessageTime, ms);
+
+        RunSlice(end, jobs);
+        PassMessages();
+        fClock = end;
+    }
+
+    return !IsRunning();
+}
+
+
+#ifndef NO_THREADS
+
+struct SliceQueue
+{
+    const vector<RCX_Emulator *> *fBricks;
+    double fEnd;
+    std::atomic<size_t> fNext;
+};
+
+static void RunBricks(SliceQueue *queue)
+{
+    size_t i;
+    while((i = queue->fNext++) < queue->fBricks->size())
+        (*queue->fBricks)[i]->Run(queue->fEnd);
+}
+
+#endif
+
+
+/*
+ * The bricks don't share anything while they run, so a slice is split
+ * among the threads a brick at a time, and a thread whose bricks are
+ * quick takes on more of them.
+ */
+void RCX_EmulatorFleet::RunSlice(double ms, int jobs)
+{
+#ifndef NO_THREADS
+    if ((size_t)jobs > fBricks.size() / kMinBricksPerJob)
+        jobs = (int)(fBricks.size() / kMinBricksPerJob);
+
+    if (jobs > 1) {
+        SliceQueue queue;
+        queue.fBricks = &fBricks;
+        queue.fEnd = ms;
+        queue.fNext = 0;
+
+        // the calling thread is one of the workers
+        vector<std::thread *> threads;
+        for(int i=1; i<jobs; ++i)
+            threads.push_back(new std::thread(RunBricks, &queue));
+
+        RunBricks(&queue);
+
+        for(size_t i=0; i<threads.size(); ++i) {
+            threads[i]->join();
+            delete threads[i];
+        }
+        return;
+    }
+#else
+    (void)jobs;
+#endif
+
+    for(size_t i=0; i<fBricks.size(); ++i)
+        fBricks[i]->Run(ms);
+}
+
+
+/*
+ * Only the last message a brick hears matters, which is the last one
+ * sent, unless the brick sent that itself.
+ */
+void RCX_EmulatorFleet::PassMessages()
+{
+    vector<FleetMessage> sent;
+
+    for(size_t i=0; i<fBricks.size(); ++i) {
+        const vector<RCX_Emulator::Message> &m = fBricks[i]->GetSent();
+
+        for(; fPassed[i] < m.size(); ++fPassed[i]) {
+            FleetMessage s = { m[fPassed[i]].fTime, (int)i, m[fPassed[i]].fValue };
+            sent.push_back(s);
+        }
+    }
+
+    if (sent.empty()) return;
+    fMessages += (long)sent.size();
+
+    std::sort(sent.begin(), sent.end());
+
+    const FleetMessage &last = sent.back();
+    const FleetMessage *other = 0;  // what the sender of last hears
+    for(size_t i=sent.size(); i-- > 0; ) {
+        if (sent[i].fBrick != last.fBrick) {
+            other = &sent[i];
+            break;
+        }
+    }
+
+    for(size_t i=0; i<fBricks.size(); ++i) {
+        if ((int)i != last.fBrick)
+            fBricks[i]->SetMessage(last.fValue);
+        else if (other)
+            fBricks[i]->SetMessage(other->fValue);
+    }
+}
+
+
+void RCX_EmulatorFleet::PrintState(FILE *fp, const RCX_Image *image) const
+{
+    fprintf(fp, "Bricks: %d, %ld messages passed\n", (int)fBricks.size(), fMessages);
+
+    for(size_t i=0; i<fBricks.size(); ++i) {
+        fprintf(fp, "\nBrick %d:\n", (int)i + 1);
+        fBricks[i]->PrintState(fp, image);
+    }
+}
@@ -0,0 +1,73 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __RCX_EmulatorFleet_h
+#define __RCX_EmulatorFleet_h
+
+#ifndef __RCX_Emulator_h
+#include "RCX_Emulator.h"
+#endif
+
+/*
+ * Runs many emulated bricks side by side, passing the messages each
+ * one sends to all of the others as IR would.  The bricks run a slice
+ * of simulated time (as long as a message takes to send) each, shared
+ * among threads, then the messages sent during the slice are passed
+ * on.  A brick hears the last message sent by any other brick, so a
+ * message can be lost to a later one just as on the real thing.
+ *
+ * Each brick's Random() gets a seed of its own, so bricks running the
+ * same program don't all make the same choices.
+ */
+class RCX_EmulatorFleet
+{
+public:
+    // ms for a message packet (9 bytes, 11 bits each at 2400 baud) to
+    // get from one brick to the others
+    static const double kMessageTime;
+
+            RCX_EmulatorFleet() : fClock(0), fMessages(0) {}
+            ~RCX_EmulatorFleet();
+
+    /// add count bricks running the tasks and subs of image, which must
+    /// outlive the fleet
+    void    Add(const RCX_Image &image, int count = 1);
+
+    /// start the first task of every brick
+    void    Start();
+
+    /// run until every brick has stopped or the clock reaches ms
+    /// @param jobs threads to share the bricks among (0 = one per
+    ///  processor)
+    /// @return true if the bricks have all stopped
+    bool    Run(double ms, int jobs = 0);
+
+    bool    IsRunning() const;
+    int     GetBrickCount() const   { return (int)fBricks.size(); }
+    const RCX_Emulator& GetBrick(int i) const   { return *fBricks[i]; }
+    long    GetMessageCount() const { return fMessages; }
+
+    /// print how many messages were passed, then each brick's state
+    void    PrintState(FILE *fp, const RCX_Image *image = 0) const;
+
+private:
+    void    RunSlice(double ms, int jobs);
+    void    PassMessages();
+
+    vector<RCX_Emulator *>  fBricks;
+    vector<size_t>  fPassed;    // messages of each brick already passed on
+    double  fClock;
+    long    fMessages;
+};
+
+#endif
@@ -0,0 +1,241 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include <cstdio>
+#include "RCX_Firmware.h"
+
+#include "rcxifile.h"
+
+using std::fopen;
+
+#define kFirmwareSignature      0x46584352  // "RCXF"
+#define kFirmwareVersion        0x100
+#define kFirmwareHeaderSize     20
+#define kPlanHeaderSize         8
+
+// the checksum sent with the begin firmware command only covers this much
+#define kMaxChecksumLength      0x4c00
+
+// from RCX_Image.cpp
+void Write4(ULong d, FILE *fp);
+void Write2(UShort d, FILE *fp);
+
+static ULong Get4(const UByte *ptr);
+static UShort Get2(const UByte *ptr);
+
+#ifndef NO_THREADS
+#define LOCK(m) std::lock_guard<std::mutex> lock(m)
+#else
+#define LOCK(m)
+#endif
+
+
+void RCX_Firmware::Set(const UByte *data, int length, int start)
+{
+    fData.assign(data, data + length);
+    fStart = start;
+    fPlans.resize(0);
+
+    int check = 0;
+    int n = length < kMaxChecksumLength ? length : kMaxChecksumLength;
+    for(int i=0; i<n; ++i)
+        check += data[i];
+    fChecksum = check & 0xffff;
+}
+
+
+const RCX_Firmware::Plan *RCX_Firmware::FindPlan(int chunk, int maxZeros, int maxOnes) const
+{
+    for(int i=0; i<(int)fPlans.size(); ++i) {
+        const Plan &p = fPlans[i];
+        if (p.fChunk == chunk && p.fMaxZeros == maxZeros && p.fMaxOnes == maxOnes)
+            return &p;
+    }
+
+    return 0;
+}
+
+
+bool RCX_Firmware::GetSizes(int chunk, int maxZeros, int maxOnes, vector<UShort> &sizes) const
+{
+    LOCK(fMutex);
+
+    const Plan *p = FindPlan(chunk, maxZeros, maxOnes);
+    if (!p) {
+        sizes.resize(0);
+        return false;
+    }
+
+    sizes = p->fSizes;
+    return true;
+}
+
+
+void RCX_Firmware::SetSizes(int chunk, int maxZeros, int maxOnes, const vector<UShort> &sizes)
+{
+    LOCK(fMutex);
+
+    if (sizes.empty() || FindPlan(chunk, maxZeros, maxOnes)) return;
+
+    Plan p;
+    p.fChunk = chunk;
+    p.fMaxZeros = maxZeros;
+    p.fMaxOnes = maxOnes;
+    p.fSizes = sizes;
+    fPlans.push_back(p);
+}
+
+
+int RCX_Firmware::GetPlanCount() const
+{
+    LOCK(fMutex);
+    return (int)fPlans.size();
+}
+
+
+RCX_Result RCX_Firmware::Read(const char *filename)
+{
+    FILE *fp = fopen(filename, "rb");
+    if (!fp) return kRCX_FileError;
+
+    fseek(fp, 0, SEEK_END);
+    long length = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+
+    UByte *data = new UByte[length > 0 ? length : 1];
+    bool ok = (length >= 0 && fread(data, 1, length, fp) == (size_t)length);
+    fclose(fp);
+
+    RCX_Result result = ok ? Parse(data, length) : kRCX_FileError;
+    delete [] data;
+
+    if (RCX_ERROR(result)) {
+        fData.resize(0);
+        fPlans.resize(0);
+    }
+    return result;
+}
+
+
+RCX_Result RCX_Firmware::Parse(const UByte *data, long length)
+{
+    const UByte *ptr = data;
+    const UByte *end = data + length;
+
+    if (end - ptr < kFirmwareHeaderSize) return kRCX_FormatError;
+    if (Get4(ptr) != kFirmwareSignature) return kRCX_FormatError;
+    if (Get2(ptr + 4) > kFirmwareVersion) return kRCX_FormatError;
+
+    int count = Get2(ptr + 6);
+    fStart = (int)Get4(ptr + 8);
+    fChecksum = Get2(ptr + 12);
+    ULong dataLength = Get4(ptr + 16);
+    ptr += kFirmwareHeaderSize;
+
+    if ((ULong)(end - ptr) < RCXI_PADDED_LENGTH(dataLength)) return kRCX_FormatError;
+    fData.assign(ptr, ptr + dataLength);
+    ptr += RCXI_PADDED_LENGTH(dataLength);
+
+    fPlans.resize(0);
+    for(int i=0; i<count; ++i) {
+        if (end - ptr < kPlanHeaderSize) return kRCX_FormatError;
+
+        Plan p;
+        p.fChunk = Get2(ptr);
+        p.fMaxZeros = Get2(ptr + 2);
+        p.fMaxOnes = Get2(ptr + 4);
+        int n = Get2(ptr + 6);
+        ptr += kPlanHeaderSize;
+
+        if (end - ptr < 2 * n) return kRCX_FormatError;
+
+        // the sizes must cover the data exactly, one chunk at a time
+        ULong total = 0;
+        for(int j=0; j<n; ++j) {
+            UShort size = Get2(ptr + 2 * j);
+            if (size == 0 || size > p.fChunk) return kRCX_FormatError;
+            p.fSizes.push_back(size);
+            total += size;
+        }
+        if (total != dataLength) return kRCX_FormatError;
+
+        fPlans.push_back(p);
+        ptr += RCXI_PADDED_LENGTH(2 * n);
+        if (ptr > end) ptr = end;
+    }
+
+    return kRCX_OK;
+}
+
+
+bool RCX_Firmware::Write(const char *filename) const
+{
+    LOCK(fMutex);
+
+    FILE *fp = fopen(filename, "wb");
+    if (!fp) return false;
+
+    long zeros = 0;
+    int length = GetLength();
+
+    // only the plans that were filled in are worth keeping
+    int count = 0;
+    for(int i=0; i<(int)fPlans.size(); ++i) {
+        if (!fPlans[i].fSizes.empty()) ++count;
+    }
+
+    Write4(kFirmwareSignature, fp);
+    Write2(kFirmwareVersion, fp);
+    Write2((UShort)count, fp);
+    Write4((ULong)fStart, fp);
+    Write2((UShort)fChecksum, fp);
+    Write2(0, fp);
+    Write4((ULong)length, fp);
+
+    if (length)
+        fwrite(&fData[0], (size_t)length, 1, fp);
+    if (RCXI_PAD_BYTES(length))
+        fwrite(&zeros, (size_t)RCXI_PAD_BYTES(length), 1, fp);
+
+    for(int i=0; i<(int)fPlans.size(); ++i) {
+        const Plan &p = fPlans[i];
+        int n = (int)p.fSizes.size();
+        if (n == 0) continue;
+
+        Write2((UShort)p.fChunk, fp);
+        Write2((UShort)p.fMaxZeros, fp);
+        Write2((UShort)p.fMaxOnes, fp);
+        Write2((UShort)n, fp);
+        for(int j=0; j<n; ++j)
+            Write2(p.fSizes[j], fp);
+        if (RCXI_PAD_BYTES(2 * n))
+            fwrite(&zeros, (size_t)RCXI_PAD_BYTES(2 * n), 1, fp);
+    }
+
+    bool ok = !ferror(fp);
+    if (fclose(fp) != 0) ok = false;
+    return ok;
+}
+
+
+ULong Get4(const UByte *ptr)
+{
+    return (ULong)ptr[0] + ((ULong)ptr[1] << 8) +
+        ((ULong)ptr[2] << 16) + ((ULong)ptr[3] << 24);
+}
+
+
+UShort Get2(const UByte *ptr)
+{
+    return (UShort)(ptr[0] + (ptr[1] << 8));
+}
@@ -0,0 +1,102 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __RCX_Firmware_h
+#define __RCX_Firmware_h
+
+#ifndef __RCX_Result_h
+#include "RCX_Result.h"
+#endif
+
+#ifndef __PTypes_h
+#include "PTypes.h"
+#endif
+
+#include <vector>
+
+// the plans are shared between threads (a -fleet sends the same image
+// to every brick at once), which needs C++11's <mutex>
+#if !defined(NO_THREADS) && (__cplusplus < 201103L || \
+    (defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)))
+#define NO_THREADS
+#endif
+
+#ifndef NO_THREADS
+#include <mutex>
+#endif
+
+using std::vector;
+
+/*
+ * A firmware image ready to be sent: the data, its start address and
+ * checksum, and the size of each download message.  When the data is
+ * sent without complementing (fast mode or USB) the messages are cut
+ * short around long runs of zeros and sparse bytes, and finding those
+ * means scanning every chunk.  The sizes are recorded the first time
+ * the image is sent with a given chunk size and set of limits, so the
+ * next transfer (to another brick, say) can skip the scan.  The whole
+ * thing can be saved to a file and read back.
+ *
+ * The data never changes once set, and the plans are locked, so one
+ * image can be sent to several bricks at once from different threads.
+ */
+class RCX_Firmware
+{
+public:
+    struct Plan {
+        int fChunk;
+        int fMaxZeros;  // both limits are 0 when nothing is scanned
+        int fMaxOnes;
+        vector<UShort> fSizes;
+    };
+
+    RCX_Firmware() : fStart(0), fChecksum(0) {}
+    RCX_Firmware(const UByte *data, int length, int start) {
+        Set(data, length, start);
+    }
+
+    void Set(const UByte *data, int length, int start);
+
+    RCX_Result Read(const char *filename);
+    bool Write(const char *filename) const;
+
+    const UByte *GetData() const { return fData.empty() ? 0 : &fData[0]; }
+    int GetLength() const { return (int)fData.size(); }
+    int GetStart() const { return fStart; }
+    int GetChecksum() const { return fChecksum; }
+
+    /// copy the sizes of the plan for the given settings into sizes,
+    /// returns false (and clears sizes) if there isn't one yet
+    bool GetSizes(int chunk, int maxZeros, int maxOnes, vector<UShort> &sizes) const;
+    /// record the sizes worked out for the given settings, unless
+    /// another transfer already did
+    void SetSizes(int chunk, int maxZeros, int maxOnes, const vector<UShort> &sizes);
+    int GetPlanCount() const;
+
+private:
+    RCX_Firmware(const RCX_Firmware &);
+    RCX_Firmware &operator=(const RCX_Firmware &);
+
+    RCX_Result Parse(const UByte *data, long length);
+    const Plan *FindPlan(int chunk, int maxZeros, int maxOnes) const;
+
+    vector<UByte> fData;
+    int fStart;
+    int fChecksum;
+    vector<Plan> fPlans;
+#ifndef NO_THREADS
+    mutable std::mutex fMutex;  // for fPlans
+#endif
+};
+
+#endif
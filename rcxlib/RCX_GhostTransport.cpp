@@ -86,10 +86,12 @@ void RCX_GhostTransport::Close()
 }
 
 
-RCX_Result RCX_GhostTransport::Send(const UByte *txData, int txLength, UByte *rxData, int rxExpected, int rxMax, bool retry)
+RCX_Result RCX_GhostTransport::Send(const UByte *txData, int txLength, UByte *rxData, int rxExpected, int rxMax, bool retry, int timeout)
 {
+#pragma unused(timeout)
+
 	RCX_Result result = kRCX_RequestError;
-	PBKRESULT err;
+	GHCOMMAND command;
 
 	GHQUEUE queue = CreateQueue(txData, txLength, rxExpected);
 	PREQUIRE(queue, Fail_CreateQueue);
@@ -102,47 +104,115 @@ RCX_Result RCX_GhostTransport::Send(const UByte *txData, int txLength, UByte *rx
 
 	if (rxExpected == 0) retry = false;	// can't retry a one-way packet
 
-	if (retry)
+	result = Execute(queue, retry);
+
+	if (result == kRCX_OK && rxExpected)
 	{
-		err = GhExecute(fStack, queue);
+		if (GhGetFirstCommand(queue, &command))
+			result = kRCX_ReplyError;
+		else
+			result = ExtractReply(command, rxData, rxMax);
 	}
-	else
+
+	GhDestroyCommandQueue(queue);
+
+Fail_CreateQueue:
+	return result;
+}
+
+
+int RCX_GhostTransport::SendFrames(const RCX_Frames &frames, int first, int count, const int *rxExpected, UByte *rxData, int rxMax, RCX_Result *results, bool retry, int timeout)
+{
+#pragma unused(timeout)
+
+	PBKRESULT err;
+	GHQUEUE queue;
+	GHCOMMAND command;
+	int i;
+
+	if (count > kQueueLength) count = kQueueLength;
+
+	err = GhCreateCommandQueue(&queue);
+	PREQUIRENOT(err, Fail_GhCreateCommandQueue);
+
+	for(i=0; i<count; ++i)
 	{
-		GhSetRetries(fStack, 0, 0);
-		err = GhExecute(fStack, queue);
-		GhSetRetries(fStack, fExRetries, fDownRetries);
+		const UByte *txData = frames.GetData(first + i);
+		int txLength = frames.GetLength(first + i);
+
+		err = GhAppendCommand(queue, (UByte *)txData, (ULong)txLength, (ULong)rxExpected[i]);
+		PREQUIRENOT(err, Fail_GhAppendCommand);
+
+		if (fVerbose)
+		{
+			printf("Tx: ");
+			DumpData(txData, txLength);
+		}
+
+		if (rxExpected[i] == 0) retry = false;	// can't retry a one-way packet
 	}
 
-	if (err)
+	// the driver doesn't say which command of a queue failed, so a
+	// failure counts against the first
+	results[0] = Execute(queue, retry);
+	if (results[0] != kRCX_OK)
 	{
-		result = kRCX_ReplyError;
+		GhDestroyCommandQueue(queue);
+		return 1;
 	}
-	else if (rxExpected)
+
+	err = GhGetFirstCommand(queue, &command);
+	for(i=0; i<count; ++i)
 	{
-		result = ExtractReply(queue, rxData, rxMax);
+		if (err)
+		{
+			results[i] = kRCX_ReplyError;
+			break;
+		}
+
+		results[i] = rxExpected[i] ? ExtractReply(command, rxData + i * rxMax, rxMax) : kRCX_OK;
+		if (RCX_ERROR(results[i])) break;
+
+		if (i+1 < count) err = GhGetNextCommand(command, &command);
+	}
+
+	GhDestroyCommandQueue(queue);
+	return i < count ? i + 1 : count;
+
+Fail_GhAppendCommand:
+	GhDestroyCommandQueue(queue);
+
+Fail_GhCreateCommandQueue:
+	results[0] = kRCX_RequestError;
+	return 1;
+}
+
+
+RCX_Result RCX_GhostTransport::Execute(GHQUEUE queue, bool retry)
+{
+	PBKRESULT err;
+
+	if (retry)
+	{
+		err = GhExecute(fStack, queue);
 	}
 	else
 	{
-		result = kRCX_OK;
+		GhSetRetries(fStack, 0, 0);
+		err = GhExecute(fStack, queue);
+		GhSetRetries(fStack, fExRetries, fDownRetries);
 	}
 
-	GhDestroyCommandQueue(queue);
-
-Fail_CreateQueue:
-	return result;
+	return err ? kRCX_ReplyError : kRCX_OK;
 }
 
 
-RCX_Result RCX_GhostTransport::ExtractReply(GHQUEUE queue, UByte *rxData, int rxMax)
+RCX_Result RCX_GhostTransport::ExtractReply(GHCOMMAND command, UByte *rxData, int rxMax)
 {
-	GHCOMMAND command;
 	PBKRESULT err;
 
 	uint32 rxLength;
 
-	err = GhGetFirstCommand(queue, &command);
-	PREQUIRENOT(err, Fail_GhGetFirstCommand);
-
 	err = GhGetCommandReplyLen(command, &rxLength);
 	PREQUIRENOT(err, Fail_GhGetCommandReplyLen);
 
@@ -163,7 +233,6 @@ RCX_Result RCX_GhostTransport::ExtractReply(GHQUEUE queue, UByte *rxData, int rx
 
 Fail_GhGetCommandReply:
 Fail_GhGetCommandReplyLen:
-Fail_GhGetFirstCommand:
 	return kRCX_ReplyError;
 }
 
@@ -47,11 +47,18 @@ public:
 	virtual RCX_Result 	Open(RCX_TargetType target, const char *deviceName, ULong options);
 	virtual void		Close();
 
-	virtual RCX_Result	Send(const UByte *txData, int txLength, UByte *rxData, int rxExpected, int rxMax, bool retry);
+	virtual RCX_Result	Send(const UByte *txData, int txLength, UByte *rxData, int rxExpected, int rxMax, bool retry, int timeout);
+
+	// a run of frames goes to the driver as one command queue
+	virtual int			SendFrames(const RCX_Frames &frames, int first, int count, const int *rxExpected, UByte *rxData, int rxMax, RCX_Result *results, bool retry, int timeout);
+	virtual int			GetQueueLength() const { return kQueueLength; }
 
 private:
+	enum { kQueueLength = 32 };	// commands per queue
+
 	GHQUEUE		CreateQueue(const UByte *txData, int txLength, int rxExpected);
-	RCX_Result	ExtractReply(GHQUEUE queue, UByte *rxData, int rxMax);
+	RCX_Result	Execute(GHQUEUE queue, bool retry);
+	RCX_Result	ExtractReply(GHCOMMAND command, UByte *rxData, int rxMax);
 
 	GHSTACK	fStack;
 	bool	fVerbose;
@@ -13,23 +13,49 @@
  */
 #include <cstring>
 #include <cstdio>
+#include <algorithm>
 #include "RCX_Image.h"
 #include "RCX_Disasm.h"
 #include "RCX_Link.h"
 #include "RCX_Cmd.h"
+#include "RCX_SpyboticsLinker.h"
 #include "PDebug.h"
 
 #include "rcxifile.h"
 
+#if defined(WIN32) || defined(macintosh)
+#define NO_MMAP
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 using std::sprintf;
 using std::fopen;
 using std::memcpy;
+using std::stable_sort;
+using std::lower_bound;
+
+#define kHeaderSize         12
+#define kChunkHeaderSize    4
+#define kSymbolHeaderSize   4
+#define kDebugOffsetSize    4
+#define kDebugHeaderSize    16
+#define kFileHeaderSize     4
+#define kDebugChunkSize     4
+#define kDebugTagSize       12
+#define kDebugLineSize      8
 
 void Write4(ULong d, FILE *fp);
 void Write2(UShort d, FILE *fp);
-ULong Read4(FILE *fp);
-UShort Read2(FILE *fp);
-void WriteSymbol(UByte type, UByte index, const char *name, FILE *fp);
+static ULong Get4(const UByte *ptr);
+static UShort Get2(const UByte *ptr);
+static void Add4(vector<UByte> &data, ULong d);
+static void Add2(vector<UByte> &data, UShort d);
+static void Set4(vector<UByte> &data, size_t offset, ULong d);
+static void AddSymbol(vector<UByte> &data, UByte type, UByte index, const char *name);
 
 static bool IsCodeChunkType(RCX_ChunkType type);
 static void GetChunkTypeName(char *dst, RCX_ChunkType type);
@@ -37,7 +63,14 @@ static void HexDump(RCX_Printer *dst, bool genLASM, string name,
   RCX_ChunkType type, int ChunkNum, const UByte *data, int count);
 
 
-RCX_Image::RCX_Image()
+RCX_Image::RCX_Image() :
+    fTargetType(kRCX_RCXTarget),
+    fStartChunks(0),
+    fBlock(0),
+    fBlockLeft(0),
+    fFile(0),
+    fFileLength(0),
+    fFileMapped(false)
 {
 }
 
@@ -48,8 +81,20 @@ void RCX_Image::Clear()
         delete fChunks[i];
     }
     fChunks.resize(0);
+    fIndex.resize(0);
+
+    for(size_t i=0; i<fBlocks.size(); ++i)
+        delete [] fBlocks[i];
+    fBlocks.resize(0);
+    fBlock = 0;
+    fBlockLeft = 0;
 
     fVars.resize(0);
+    fSourceNames.resize(0);
+    fStartChunks = 0;
+    fLinked.resize(0);
+
+    ReleaseFile();
 }
 
 
@@ -63,26 +108,55 @@ void RCX_Image::AddChunk(
     int tagCount
 ){
     Chunk *f = new Chunk();
+    UByte *copy = Allocate(length);
 
-    f->fData = new UByte[length];
+    // even an empty chunk has data, which tells it from a missing one
+    memcpy(copy, data, (size_t)length);
+    f->fData = copy;
     f->fLength = length;
     f->fType = type;
     f->fNumber = number;
-    memcpy(f->fData, data, (size_t)length);
 
     f->fName = name;
 
-    if (tags && tagCount) {
-        f->fTagCount = tagCount;
-        f->fTags = new RCX_SourceTag[tagCount];
-        memcpy(f->fTags, tags, tagCount * sizeof(RCX_SourceTag));
+    SetTags(f, tags, tagCount);
+
+    fChunks.push_back(f);
+    fLinked.resize(0);
+}
+
+
+UByte* RCX_Image::Allocate(int length)
+{
+    // big chunks get a block of their own, so that the rest of the
+    // current block isn't wasted
+    if (length > kBlockSize / 4) {
+        UByte *block = new UByte[length];
+        fBlocks.push_back(block);
+        return block;
     }
-    else {
-        f->fTags = 0;
-        f->fTagCount = 0;
+
+    if (length > fBlockLeft || !fBlock) {
+        fBlock = new UByte[kBlockSize];
+        fBlocks.push_back(fBlock);
+        fBlockLeft = kBlockSize;
     }
 
-    fChunks.push_back(f);
+    UByte *ptr = fBlock + (kBlockSize - fBlockLeft);
+    fBlockLeft -= length;
+    return ptr;
+}
+
+
+const vector<UByte>& RCX_Image::GetSpyboticsImage() const
+{
+    // a linked image always has the TOC, so empty means not linked yet
+    if (fLinked.empty()) {
+        RCX_SpyboticsLinker linker;
+        linker.Generate(*this, fLinked);
+    }
+
+    return fLinked;
 }
 
 
@@ -95,11 +169,110 @@ void RCX_Image::SetVariable(int index, const char *name)
 }
 
 
+const char* RCX_Image::GetVariableName(int index) const
+{
+    for (size_t i=0; i<fVars.size(); i++)
+        if (fVars[i].fIndex == index) return fVars[i].fName.c_str();
+    return 0;
+}
+
+
+void RCX_Image::SetSourceInfo(RCX_SourceFiles *sf)
+{
+    fSourceNames.resize(0);
+    for (int i=0; i<(int)fChunks.size(); ++i)
+        fChunks[i]->fLines.resize(0);
+
+    if (!sf) return;
+
+    int count = sf->GetCount();
+    for (int i=0; i<count; ++i) {
+        const char *name = sf->GetName(i);
+        fSourceNames.push_back(name ? name : "");
+    }
+
+    for (int i=0; i<(int)fChunks.size(); ++i) {
+        Chunk *f = fChunks[i];
+        vector<Chunk::Line> lines;
+        vector<RCX_SourceTag> tags;
+
+        // the code of an inline function is tagged between a begin and
+        // an end inside those of the task or sub, so the statement it
+        // came from is the last tag with at most the chunk's begin open
+        int depth = 0;
+        int callSrcIndex = -1;
+        long callLine = 0;
+
+        f->GetTags(tags);
+        for (int j=0; j<(int)tags.size(); ++j) {
+            const RCX_SourceTag &tag = tags[j];
+            if (tag.fType == RCX_SourceTag::kEnd) {
+                if (depth) --depth;
+                continue;
+            }
+
+            bool begin = (tag.fType != RCX_SourceTag::kNormal);
+            long line = sf->GetLine(tag.fSrcIndex, tag.fSrcOffset);
+            if (line > 0 && (depth == 0 || (depth == 1 && !begin))) {
+                callSrcIndex = tag.fSrcIndex;
+                callLine = line;
+            }
+            if (begin) ++depth;
+            if (line <= 0) continue;
+
+            Chunk::Line l;
+            l.fAddress = (UShort)tag.fAddress;
+            l.fSrcIndex = tag.fSrcIndex;
+            l.fLine = line;
+            l.fCallSrcIndex = callSrcIndex;
+            l.fCallLine = callLine;
+            lines.push_back(l);
+        }
+
+        // the last tag at an address wins, and an entry that continues
+        // the line before it isn't needed
+        std::stable_sort(lines.begin(), lines.end());
+        for (int j=0; j<(int)lines.size(); ++j) {
+            const Chunk::Line &l = lines[j];
+            if (j+1 < (int)lines.size() && lines[j+1].fAddress == l.fAddress)
+                continue;
+            if (!f->fLines.empty() &&
+                f->fLines.back().fSrcIndex == l.fSrcIndex &&
+                f->fLines.back().fLine == l.fLine &&
+                f->fLines.back().fCallSrcIndex == l.fCallSrcIndex &&
+                f->fLines.back().fCallLine == l.fCallLine)
+                continue;
+            f->fLines.push_back(l);
+        }
+    }
+}
+
+
+const char* RCX_Image::GetSourceName(int i) const
+{
+    if (i < 0 || i >= (int)fSourceNames.size() || fSourceNames[i].empty())
+        return 0;
+    return fSourceNames[i].c_str();
+}
+
+
+void RCX_Image::DiscardSourceInfo()
+{
+    fSourceNames.resize(0);
+
+    for (int i=0; i<(int)fChunks.size(); ++i) {
+        Chunk *f = fChunks[i];
+        SetTags(f, 0, 0);
+        f->fLines.resize(0);
+    }
+}
+
+
 void RCX_Image::Print(RCX_Printer *dst, RCX_SourceFiles *sf, bool genLASM) const
 {
     RCX_Disasm disasm(fTargetType);
     char line[256];
-    const Chunk **index = BuildIndex();
+    const vector<const Chunk*> &index = GetIndex();
 
     for (size_t i=0; i<fVars.size(); i++) {
         sprintf(line, "%s Var %d = %s\n",
@@ -121,8 +294,10 @@ void RCX_Image::Print(RCX_Printer *dst, RCX_SourceFiles *sf, bool genLASM) const
 
         if (IsCodeChunkType(f.fType)) {
             PDEBUGSTR("Found a code chunk");
+            vector<RCX_SourceTag> tags;
+            f.GetTags(tags);
             disasm.Print(dst, genLASM, f.fName, f.fType, f.fNumber, f.fData,
-                f.fLength, sf, f.fTags, f.fTagCount);
+                f.fLength, sf, tags.empty() ? 0 : &tags[0], (int)tags.size());
         }
         else {
             PDEBUGSTR("Found a non-code chunk");
@@ -132,36 +307,99 @@ void RCX_Image::Print(RCX_Printer *dst, RCX_SourceFiles *sf, bool genLASM) const
 
     sprintf(line, "\n%sTotal size: %d bytes\n", genLASM ? ";" : "", GetSize());
     dst->Print(line);
-
-    delete [] index;
 }
 
 
-const RCX_Image::Chunk **RCX_Image::BuildIndex() const
+void RCX_Image::PrintJSON(RCX_Printer *dst, RCX_SourceFiles *sf) const
 {
-    // build a sorted index for fragments
-    const Chunk **index;
+    RCX_Disasm disasm(fTargetType);
+    const vector<const Chunk*> &index = GetIndex();
 
-    // start with order in image
-    index = new const Chunk*[fChunks.size()];
-    for (int i=0; i<(int)fChunks.size(); ++i)
-        index[i] = fChunks[i];
+    dst->Print("{\"target\":");
+    dst->PrintJSONString(getTarget(fTargetType)->fName);
+    dst->Print(",\"size\":");
+    dst->PrintDec(GetSize());
 
-    // now bubble sort
-    bool dirty;
-    do {
-        dirty = false;
-        for (int i=0; i<(int)fChunks.size()-1; ++i) {
-            if (*index[i+1] < *index[i]) {
-                const Chunk *f = index[i+1];
-                index[i+1] = index[i];
-                index[i] = f;
-                dirty = true;
-            }
+    dst->Print(",\"vars\":[");
+    for (size_t i=0; i<fVars.size(); i++) {
+        dst->Print(i ? ",{\"index\":" : "{\"index\":");
+        dst->PrintDec(fVars[i].fIndex);
+        dst->Print(",\"name\":");
+        dst->PrintJSONString(fVars[i].fName.c_str());
+        dst->Print("}");
+    }
+
+    dst->Print("],\"chunks\":[");
+    for (int i=0; i<(int)fChunks.size(); i++) {
+        const Chunk &f = *index[i];
+        char typeName[10];
+
+        GetChunkTypeName(typeName, f.fType);
+        dst->Print(i ? ",{\"type\":" : "{\"type\":");
+        dst->PrintJSONString(typeName);
+        dst->Print(",\"number\":");
+        dst->PrintDec(f.fNumber);
+        dst->Print(",\"name\":");
+        dst->PrintJSONString(f.fName.c_str());
+        dst->Print(",\"size\":");
+        dst->PrintDec(f.fLength);
+
+        if (IsCodeChunkType(f.fType)) {
+            dst->Print(",\"code\":");
+            vector<RCX_SourceTag> tags;
+            f.GetTags(tags);
+            disasm.PrintJSON(dst, f.fType, f.fData, f.fLength, sf,
+                tags.empty() ? 0 : &tags[0], (int)tags.size());
         }
-    } while(dirty);
+        dst->Print("}");
+    }
+    dst->Print("]}\n");
+}
+
+
+void RCX_Image::PrintSizes(FILE *fp) const
+{
+    const RCX_Target *target = getTarget(fTargetType);
+    const vector<const Chunk*> &index = GetIndex();
+    int total = GetSize();
+    int counts[kRCX_ChunkTypeCount];
+    int i;
+
+    for (i=0; i<kRCX_ChunkTypeCount; ++i)
+        counts[i] = 0;
+
+    for (i=0; i<(int)fChunks.size(); i++) {
+        const Chunk &f = *index[i];
+        char typeName[10];
+
+        GetChunkTypeName(typeName, f.fType);
+        fprintf(fp, "%-9s %3d %-24s %6d bytes %5.1f%%\n", typeName, f.fNumber,
+            f.fName.c_str(), f.fLength, total ? 100.0 * f.fLength / total : 0.0);
+        counts[f.fType]++;
+    }
+
+    for (i=0; i<kRCX_ChunkTypeCount; ++i) {
+        if (target->fRanges[i].fCount == 0) continue;
+
+        char typeName[10];
+        GetChunkTypeName(typeName, (RCX_ChunkType)i);
+        fprintf(fp, "%s chunks: %d of %d\n", typeName, counts[i],
+            target->fRanges[i].fCount);
+    }
+
+    fprintf(fp, "Total size: %d bytes\n", total);
+}
+
 
-    return index;
+const vector<const RCX_Image::Chunk*>& RCX_Image::GetIndex() const
+{
+    // chunks are only ever added, so a short index is out of date
+    if (fIndex.size() != fChunks.size()) {
+        fIndex.assign(fChunks.begin(), fChunks.end());
+        stable_sort(fIndex.begin(), fIndex.end(), IndexLess);
+    }
+
+    return fIndex;
 }
 
 
@@ -183,99 +421,298 @@ RCX_Result RCX_Image::Download(RCX_Link *link, int programNumber) const
 
 RCX_Result RCX_Image::Read(const char *filename)
 {
-    FILE *fp;
+    Clear();
+
+    if (!LoadFile(filename)) return kRCX_FileError;
+
+    return Parse();
+}
+
+
+RCX_Result RCX_Image::Read(const UByte *data, long length)
+{
+    Clear();
+
+    UByte *copy = new UByte[length > 0 ? length : 1];
+    memcpy(copy, data, (size_t)length);
+    fFile = copy;
+    fFileLength = length;
+
+    return Parse();
+}
+
+
+RCX_Result RCX_Image::Read(FILE *fp)
+{
+    vector<UByte> data;
+    UByte block[4096];
+    size_t n;
+
+    while((n = fread(block, 1, sizeof(block), fp)) > 0)
+        data.insert(data.end(), block, block + n);
+
+    if (ferror(fp)) {
+        Clear();
+        return kRCX_FileError;
+    }
+
+    return Read(data.empty() ? 0 : &data[0], (long)data.size());
+}
+
+
+RCX_Result RCX_Image::Parse()
+{
+    UShort version;
     UShort count;
     UShort symbolCount;
+    ULong debugOffset = 0;
     int i;
 
-    Clear();
+    const UByte *ptr = fFile;
+    const UByte *end = fFile + fFileLength;
 
-    fp = fopen(filename, "rb");
-    if (!fp) return kRCX_FileError;
+    if (end - ptr < kHeaderSize) goto ErrorReturn;
 
     // check signature
-    if (Read4(fp) != kRCXI_Signature) goto ErrorReturn;
+    if (Get4(ptr) != kRCXI_Signature) goto ErrorReturn;
 
     // check version
-    if (Read2(fp) > kRCXI_CurrentVersion) goto ErrorReturn;
+    version = Get2(ptr + 4);
+    if (version > kRCXI_CurrentVersion) goto ErrorReturn;
 
     // get counts
-    count = Read2(fp);
-    symbolCount = Read2(fp);
+    count = Get2(ptr + 6);
+    symbolCount = Get2(ptr + 8);
 
-    // target type
-    fTargetType = (RCX_TargetType)getc(fp);
+    // target type, followed by a reserved byte
+    fTargetType = (RCX_TargetType)ptr[10];
+    ptr += kHeaderSize;
 
-    // reserved byte
-    getc(fp);
+    if (version >= kRCXI_DebugVersion) {
+        if (end - ptr < kDebugOffsetSize) goto ErrorReturn;
+        debugOffset = Get4(ptr);
+        ptr += kDebugOffsetSize;
+    }
 
     fChunks.reserve(count);
 
     for (i=0; i<count; i++) {
-        UByte type;
-        UByte number;
         UShort length;
         Chunk *f;
 
-        type = (UByte) getc(fp);
-        if (type > 2) goto ErrorReturn;
-
-        number = (UByte)getc(fp);
-        length = Read2(fp);
+        if (end - ptr < kChunkHeaderSize) goto ErrorReturn;
+        if (ptr[0] > 2) goto ErrorReturn;
 
-        if (feof(fp) && (length != 0)) goto ErrorReturn;
+        length = Get2(ptr + 2);
+        if (end - ptr - kChunkHeaderSize < length) goto ErrorReturn;
 
         f = new Chunk();
-        f->fType = (RCX_ChunkType)type;
-        f->fNumber = number;
+        f->fType = (RCX_ChunkType)ptr[0];
+        f->fNumber = ptr[1];
         f->fLength = length;
+        ptr += kChunkHeaderSize;
 
         if (length) {
-            f->fData = new UByte[length];
-            if ((UShort)fread(f->fData, 1, length, fp) != length) {
-                goto ErrorReturn;
-            }
-            fseek(fp, RCXI_PAD_BYTES(length),SEEK_CUR);
+            f->fData = ptr;
+
+            // the padding of the last chunk may be missing
+            int padded = length + RCXI_PAD_BYTES(length);
+            ptr = (end - ptr < padded) ? end : ptr + padded;
         }
-        else
-            f->fData = nil;
 
         fChunks.push_back(f);
     }
 
-    for (i=0; i<symbolCount; ++i) {
-        UByte type;
-        UByte index;
-        UByte length;
-        string *stringPtr;
+    // a truncated symbol table just ends early
+    for (i=0; i<symbolCount && end - ptr >= kSymbolHeaderSize; ++i) {
+        UByte type = ptr[0];
+        UByte index = ptr[1];
+        UByte length = ptr[2];
 
-        // read symbol headers
-        type = getc(fp);
-        index = getc(fp);
-        length = getc(fp);
-        (void)getc(fp);	// reserved
+        ptr += kSymbolHeaderSize;
+        if (end - ptr < length) break;
 
         if (length) {
-            stringPtr = GetNameString(type, index);
+            string *stringPtr = GetNameString(type, index);
             if (stringPtr) {
-                char buf[256];
-                fread(buf, length, 1, fp);
-                *stringPtr = buf;
-            } else {
-                fseek(fp, length, SEEK_CUR);
+                // the name includes its nul
+                const char *name = (const char *)ptr;
+                const char *nul = (const char *)memchr(name, 0, length);
+                stringPtr->assign(name, nul ? nul - name : length);
             }
+            ptr += length;
         }
     }
 
-    fclose(fp);
+    // a damaged debug section doesn't spoil the code
+    if (debugOffset && !ReadSourceInfo(debugOffset))
+        DiscardSourceInfo();
+
     return kRCX_OK;
 
 ErrorReturn:
-    fclose(fp);
+    Clear();
     return kRCX_FormatError;
 }
 
 
+bool RCX_Image::ReadSourceInfo(ULong offset)
+{
+    const UByte *end = fFile + fFileLength;
+    ULong length = (ULong)fFileLength;
+
+    if (offset > length || length - offset < kDebugHeaderSize)
+        return false;
+
+    const UByte *ptr = fFile + offset;
+    int fileCount = Get2(ptr);
+    ULong tagOffset = Get4(ptr + 4);
+    int tagFragments = Get2(ptr + 8);
+    int lineFragments = Get2(ptr + 10);
+    ULong lineOffset = Get4(ptr + 12);
+    ptr += kDebugHeaderSize;
+
+    for (int i=0; i<fileCount; ++i) {
+        if (end - ptr < kFileHeaderSize) return false;
+
+        int nameLength = Get2(ptr);
+        int padded = RCXI_PADDED_LENGTH(nameLength);
+        ptr += kFileHeaderSize;
+        if (end - ptr < padded) return false;
+
+        const char *name = (const char *)ptr;
+        const char *nul = (const char *)memchr(name, 0, nameLength);
+        fSourceNames.push_back(string(name, nul ? nul - name : nameLength));
+        ptr += padded;
+    }
+
+    if (tagOffset > length || lineOffset > length) return false;
+
+    return ReadLines(fFile + tagOffset, end, tagFragments, true) &&
+        ReadLines(fFile + lineOffset, end, lineFragments, false);
+}
+
+
+bool RCX_Image::ReadLines(const UByte *ptr, const UByte *end, int count, bool tags)
+{
+    int size = tags ? kDebugTagSize : kDebugLineSize;
+
+    for (int i=0; i<count; ++i) {
+        if (end - ptr < kDebugChunkSize) return false;
+
+        // entries for a chunk the image doesn't have are skipped
+        Chunk *f = const_cast<Chunk *>(FindChunk((RCX_ChunkType)ptr[0], ptr[1]));
+        int n = Get2(ptr + 2);
+        ptr += kDebugChunkSize;
+        if ((end - ptr) / size < n) return false;
+
+        vector<RCX_SourceTag> tagList;
+        if (f && tags)
+            tagList.resize(n);
+        else if (f)
+            f->fLines.resize(n);
+
+        for (int j=0; j<n; ++j, ptr += size) {
+            if (!f) continue;
+
+            if (tags) {
+                if (ptr[0] > RCX_SourceTag::kEnd) return false;
+
+                RCX_SourceTag &tag = tagList[j];
+                tag.fType = ptr[0];
+                tag.fAddress = (short)Get2(ptr + 2);
+                tag.fSrcIndex = (short)Get2(ptr + 4);
+                tag.fSrcOffset = (long)Get4(ptr + 8);
+            }
+            else {
+                Chunk::Line &line = f->fLines[j];
+                line.fAddress = Get2(ptr);
+                line.fSrcIndex = Get2(ptr + 2);
+                line.fLine = (long)Get4(ptr + 4);
+                line.fCallSrcIndex = -1;
+                line.fCallLine = 0;
+            }
+        }
+
+        if (f && tags)
+            SetTags(f, tagList.empty() ? 0 : &tagList[0], n);
+    }
+
+    return true;
+}
+
+
+bool RCX_Image::LoadFile(const char *filename)
+{
+#ifdef NO_MMAP
+    FILE *fp = fopen(filename, "rb");
+    if (!fp) return false;
+
+    fseek(fp, 0, SEEK_END);
+    long length = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+
+    UByte *data = new UByte[length > 0 ? length : 1];
+    if (length < 0 || fread(data, 1, length, fp) != (size_t)length) {
+        fclose(fp);
+        delete [] data;
+        return false;
+    }
+    fclose(fp);
+
+    fFile = data;
+    fFileLength = length;
+#else
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat stat_buf;
+    if (fstat(fd, &stat_buf) != 0) {
+        close(fd);
+        return false;
+    }
+
+    // mmap() won't map an empty file, which isn't an image anyway
+    fFileLength = stat_buf.st_size;
+    if (fFileLength == 0) {
+        close(fd);
+        fFile = new UByte[1];
+        return true;
+    }
+
+    void *ptr = mmap(0, fFileLength, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (ptr == MAP_FAILED) {
+        fFileLength = 0;
+        return false;
+    }
+
+    fFile = (const UByte *)ptr;
+    fFileMapped = true;
+#endif
+
+    return true;
+}
+
+
+void RCX_Image::ReleaseFile()
+{
+    if (fFile) {
+#ifndef NO_MMAP
+        if (fFileMapped)
+            munmap((void *)fFile, fFileLength);
+        else
+#endif
+            delete [] fFile;
+    }
+
+    fFile = 0;
+    fFileLength = 0;
+    fFileMapped = false;
+}
+
+
 string *RCX_Image::GetNameString(UByte type, UByte index)
 {
     switch(type) {
@@ -301,52 +738,150 @@ string *RCX_Image::GetNameString(UByte type, UByte index)
 }
 
 
-bool RCX_Image::Write(const char *filename)
+bool RCX_Image::Write(const char *filename) const
 {
-    FILE *fp;
-    Chunk *f;
-    int pad;
-    long zeros = 0;
-
-    fp = fopen(filename, "wb");
+    FILE *fp = fopen(filename, "wb");
     if (!fp) return false;
 
+    Write(fp);
+
+    fclose(fp);
+    return true;
+}
+
+
+void RCX_Image::Write(FILE *fp) const
+{
+    // the image is put together in memory, since the offsets in its
+    // header can't be filled in later on a pipe
+    vector<UByte> data;
+    Write(data);
+
+    if (!data.empty())
+        fwrite(&data[0], 1, data.size(), fp);
+}
+
+
+void RCX_Image::Write(vector<UByte> &data) const
+{
+    Chunk *f;
+    bool debug = HasSourceInfo();
+    size_t base = data.size();
+
     // write header
-    Write4(kRCXI_Signature, fp);
-    Write2(kRCXI_CurrentVersion, fp);
-    Write2((UShort)fChunks.size(), fp);
-    Write2((UShort)fChunks.size() + fVars.size(), fp);
-    putc(fTargetType, fp);
-    putc(0, fp);
+    Add4(data, kRCXI_Signature);
+    Add2(data, debug ? kRCXI_DebugVersion : kRCXI_PlainVersion);
+    Add2(data, (UShort)fChunks.size());
+    Add2(data, (UShort)fChunks.size() + fVars.size());
+    data.push_back(fTargetType);
+    data.push_back(0);
+
+    // the offset of the debug section is filled in once it's written
+    if (debug)
+        Add4(data, 0);
 
     // write fragments
     for (int i=0; i<(int)fChunks.size(); i++) {
         f = fChunks[i];
-        putc(f->fType, fp);	// this assumes that internal fragment types match the file format
-        putc(f->fNumber, fp);
-        Write2((UShort)f->fLength, fp);
-        if (f->fLength)
-            fwrite(f->fData, 1, (size_t)f->fLength, fp);
-        pad = RCXI_PAD_BYTES(f->fLength);
-        if (pad)
-            fwrite(&zeros, (ULong) pad, 1, fp);
+        data.push_back(f->fType);  // this assumes that internal fragment types match the file format
+        data.push_back(f->fNumber);
+        Add2(data, (UShort)f->fLength);
+        data.insert(data.end(), f->fData, f->fData + f->fLength);
+        data.resize(data.size() + RCXI_PAD_BYTES(f->fLength), 0);
     }
 
     // write code symbols
     for (int i=0; i<(int)fChunks.size(); i++) {
         f = fChunks[i];
         // this assumes that internal fragment types match the file format
-        WriteSymbol(f->fType, f->fNumber, f->fName.c_str(), fp);
+        AddSymbol(data, f->fType, f->fNumber, f->fName.c_str());
     }
 
     // write var symbols
     for (size_t i=0; i<fVars.size(); i++) {
-        WriteSymbol(kRCXI_VarSymbol, fVars[i].fIndex,
-            fVars[i].fName.c_str(), fp);
+        AddSymbol(data, kRCXI_VarSymbol, fVars[i].fIndex,
+            fVars[i].fName.c_str());
     }
 
-    fclose(fp);
-    return true;
+    // offsets are from the start of the image
+    if (debug) {
+        Set4(data, base + kHeaderSize, (ULong)(data.size() - base));
+        WriteSourceInfo(data, base);
+    }
+}
+
+
+void RCX_Image::WriteSourceInfo(vector<UByte> &data, size_t base) const
+{
+    size_t start = data.size();
+    int tagFragments = 0;
+    int lineFragments = 0;
+    int i;
+
+    for (i=0; i<(int)fChunks.size(); ++i) {
+        if (fChunks[i]->GetTagCount()) ++tagFragments;
+        if (!fChunks[i]->fLines.empty()) ++lineFragments;
+    }
+
+    // header, the offsets are filled in at the end
+    Add2(data, (UShort)fSourceNames.size());
+    Add2(data, 0);
+    Add4(data, 0);
+    Add2(data, (UShort)tagFragments);
+    Add2(data, (UShort)lineFragments);
+    Add4(data, 0);
+
+    // file names
+    for (i=0; i<(int)fSourceNames.size(); ++i) {
+        int length = fSourceNames[i].empty() ? 0 : fSourceNames[i].size() + 1;
+        Add2(data, (UShort)length);
+        Add2(data, 0);
+        const char *name = fSourceNames[i].c_str();
+        data.insert(data.end(), name, name + length);
+        data.resize(data.size() + RCXI_PAD_BYTES(length), 0);
+    }
+
+    // source tags
+    size_t tagOffset = data.size();
+    for (i=0; i<(int)fChunks.size(); ++i) {
+        const Chunk *f = fChunks[i];
+        if (!f->GetTagCount()) continue;
+
+        vector<RCX_SourceTag> tags;
+        f->GetTags(tags);
+
+        data.push_back(f->fType);
+        data.push_back(f->fNumber);
+        Add2(data, (UShort)tags.size());
+        for (int j=0; j<(int)tags.size(); ++j) {
+            const RCX_SourceTag &tag = tags[j];
+            data.push_back(tag.fType);
+            data.push_back(0);
+            Add2(data, (UShort)tag.fAddress);
+            Add2(data, (UShort)tag.fSrcIndex);
+            Add2(data, 0);
+            Add4(data, (ULong)tag.fSrcOffset);
+        }
+    }
+
+    // line index
+    size_t lineOffset = data.size();
+    for (i=0; i<(int)fChunks.size(); ++i) {
+        const Chunk *f = fChunks[i];
+        if (f->fLines.empty()) continue;
+
+        data.push_back(f->fType);
+        data.push_back(f->fNumber);
+        Add2(data, (UShort)f->fLines.size());
+        for (int j=0; j<(int)f->fLines.size(); ++j) {
+            Add2(data, (UShort)f->fLines[j].fAddress);
+            Add2(data, (UShort)f->fLines[j].fSrcIndex);
+            Add4(data, (ULong)f->fLines[j].fLine);
+        }
+    }
+
+    Set4(data, start + 4, (ULong)(tagOffset - base));
+    Set4(data, start + 12, (ULong)(lineOffset - base));
 }
 
 
@@ -364,13 +899,46 @@ int RCX_Image::GetSize() const
 
 const RCX_Image::Chunk* RCX_Image::FindChunk(RCX_ChunkType type, UByte number) const
 {
-    for (int i=0; i<(int)fChunks.size(); ++i) {
-        if (fChunks[i]->fType==type &&
-            fChunks[i]->fNumber == number)
-            return fChunks[i];
+    const vector<const Chunk*> &index = GetIndex();
+    Chunk key;
+
+    key.fType = type;
+    key.fNumber = number;
+
+    vector<const Chunk*>::const_iterator it =
+        lower_bound(index.begin(), index.end(), &key, IndexLess);
+
+    if (it == index.end() || IndexLess(&key, *it)) return 0;
+    return *it;
+}
+
+
+bool RCX_Image::Chunk::FindLine(int address, int &srcIndex, long &line, bool callSite) const
+{
+    // find the last entry that starts at or before the address
+    int lo = 0;
+    int hi = fLines.size();
+
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (fLines[mid].fAddress <= address)
+            lo = mid + 1;
+        else
+            hi = mid;
     }
 
-    return 0;
+    if (lo == 0) return false;
+
+    const Line &l = fLines[lo-1];
+    if (callSite && l.fCallSrcIndex >= 0) {
+        srcIndex = l.fCallSrcIndex;
+        line = l.fCallLine;
+    }
+    else {
+        srcIndex = l.fSrcIndex;
+        line = l.fLine;
+    }
+    return true;
 }
 
 
@@ -378,15 +946,96 @@ RCX_Image::Chunk::Chunk()
 {
     fData = nil;
     fLength = 0;
-    fTags = nil;
+    fTagData = nil;
     fTagCount = 0;
 }
 
 
-RCX_Image::Chunk::~Chunk()
+static void PutTagNumber(vector<UByte> &data, long n)
+{
+    // zigzag, so small negative changes are short too
+    ULong u = n < 0 ? ((ULong)(-(n + 1)) << 1) | 1 : (ULong)n << 1;
+
+    while (u >= 0x80) {
+        data.push_back((UByte)(u | 0x80));
+        u >>= 7;
+    }
+    data.push_back((UByte)u);
+}
+
+
+static long GetTagNumber(const UByte *&ptr)
+{
+    ULong u = 0;
+    int shift = 0;
+
+    do {
+        u |= (ULong)(*ptr & 0x7f) << shift;
+        shift += 7;
+    } while (*ptr++ & 0x80);
+
+    return (u & 1) ? -(long)(u >> 1) - 1 : (long)(u >> 1);
+}
+
+
+void RCX_Image::SetTags(Chunk *f, const RCX_SourceTag *tags, int count)
 {
-    delete [] fData;
-    delete [] fTags;
+    vector<UByte> data;
+    long address = 0;
+    long srcIndex = 0;
+    long srcOffset = 0;
+
+    f->fTagData = nil;
+    f->fTagCount = tags ? count : 0;
+
+    for (int i=0; i<f->fTagCount; ++i) {
+        const RCX_SourceTag &tag = tags[i];
+        bool newSource = tag.fSrcIndex != srcIndex;
+
+        data.push_back((UByte)(tag.fType | (newSource ? 0x80 : 0)));
+        if (newSource)
+            PutTagNumber(data, tag.fSrcIndex - srcIndex);
+        PutTagNumber(data, tag.fAddress - address);
+        PutTagNumber(data, tag.fSrcOffset - srcOffset);
+
+        address = tag.fAddress;
+        srcIndex = tag.fSrcIndex;
+        srcOffset = tag.fSrcOffset;
+    }
+
+    // tags replaced later (which is rare) leave theirs until Clear()
+    if (!data.empty()) {
+        UByte *copy = Allocate((int)data.size());
+        memcpy(copy, &data[0], data.size());
+        f->fTagData = copy;
+    }
+}
+
+
+void RCX_Image::Chunk::GetTags(vector<RCX_SourceTag> &tags) const
+{
+    tags.resize(fTagCount);
+    if (!fTagCount) return;
+
+    const UByte *ptr = fTagData;
+    long address = 0;
+    long srcIndex = 0;
+    long srcOffset = 0;
+
+    for (int i=0; i<fTagCount; ++i) {
+        RCX_SourceTag &tag = tags[i];
+        UByte type = *ptr++;
+
+        if (type & 0x80)
+            srcIndex += GetTagNumber(ptr);
+        address += GetTagNumber(ptr);
+        srcOffset += GetTagNumber(ptr);
+
+        tag.fType = type & 0x7f;
+        tag.fAddress = (short)address;
+        tag.fSrcIndex = (short)srcIndex;
+        tag.fSrcOffset = srcOffset;
+    }
 }
 
 
@@ -406,39 +1055,53 @@ void Write2(UShort d, FILE *fp)
 }
 
 
-void WriteSymbol(UByte type, UByte index, const char *name, FILE *fp)
+void Add4(vector<UByte> &data, ULong d)
 {
-    int length = name ? strlen(name)+1 : 0;
-    putc(type, fp);
-    putc(index, fp);
-    putc((UByte)length, fp);
-    putc(0, fp);
+    data.push_back((UByte)d);
+    data.push_back((UByte)(d>>8));
+    data.push_back((UByte)(d>>16));
+    data.push_back((UByte)(d>>24));
+}
+
 
-    if (length)
-        fwrite(name, length, 1, fp);
+void Add2(vector<UByte> &data, UShort d)
+{
+    data.push_back((UByte)d);
+    data.push_back((UByte)(d>>8));
 }
 
 
-ULong Read4(FILE *fp)
+void Set4(vector<UByte> &data, size_t offset, ULong d)
 {
-    ULong d;
+    data[offset] = (UByte)d;
+    data[offset+1] = (UByte)(d>>8);
+    data[offset+2] = (UByte)(d>>16);
+    data[offset+3] = (UByte)(d>>24);
+}
 
-    d = (UByte)getc(fp);
-    d += (UByte)getc(fp) << 8;
-    d += (UByte)getc(fp) << 16;
-    d += (UByte)getc(fp) << 24;
 
-    return d;
+void AddSymbol(vector<UByte> &data, UByte type, UByte index, const char *name)
+{
+    int length = name ? strlen(name)+1 : 0;
+    data.push_back(type);
+    data.push_back(index);
+    data.push_back((UByte)length);
+    data.push_back(0);
+
+    data.insert(data.end(), name, name + length);
 }
 
-UShort Read2(FILE *fp)
+
+ULong Get4(const UByte *ptr)
 {
-    UShort d;
+    return (ULong)ptr[0] + ((ULong)ptr[1] << 8) +
+        ((ULong)ptr[2] << 16) + ((ULong)ptr[3] << 24);
+}
 
-    d = (UByte)getc(fp);
-    d += (UByte)getc(fp) << 8;
 
-    return d;
+UShort Get2(const UByte *ptr)
+{
+    return (UShort)(ptr[0] + (ptr[1] << 8));
 }
 
 
@@ -490,8 +1153,6 @@ void HexDump(
     int count
 ){
     char line[256];
-    char *ptr;
-
     int offset = 0;
 
     if (genLASM) {
@@ -512,17 +1173,15 @@ void HexDump(
                 n = 2;
 
             // print tab
-            sprintf(line, "\t");
-            ptr = line + strlen(line);
+            dst->Print("\t", 1);
 
             // print data bytes
             for (int i=0; i<n; ++i) {
-                sprintf(ptr, "%d ", *data++);
-                ptr += strlen(ptr);
+                dst->PrintDec(*data++);
+                dst->Print(" ", 1);
             }
 
-            strcat(ptr, "\n");
-            dst->Print(line);
+            dst->Print("\n", 1);
 
             count -= n;
         }
@@ -541,17 +1200,16 @@ void HexDump(
             }
 
             // print offset
-            sprintf(line, "%03x  ", offset);
-            ptr = line + strlen(line);
+            dst->PrintHex(offset, 3);
+            dst->Print("  ", 2);
 
             // print data bytes
             for (int i=0; i<n; ++i) {
-                sprintf(ptr, "%02x ", *data++);
-                ptr += strlen(ptr);
+                dst->PrintHex(*data++, 2);
+                dst->Print(" ", 1);
             }
 
-            strcat(ptr, "\n");
-            dst->Print(line);
+            dst->Print("\n", 1);
 
             count -= n;
             offset += count;
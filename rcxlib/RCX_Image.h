@@ -54,13 +54,30 @@ public:
     class Chunk;
 
     RCX_Image();
-    ~RCX_Image() { Clear(); }
+    virtual ~RCX_Image() { Clear(); }
 
+    // the chunks of a read image refer to the file's contents, which
+    // are mapped into memory where possible rather than copied
     RCX_Result Read(const char *filename);
-    bool Write(const char *filename);
+    // read an image held in memory (the data is copied)
+    RCX_Result Read(const UByte *data, long length);
+    // read an image from the rest of a stream, such as a pipe
+    RCX_Result Read(FILE *fp);
+    // images with source information (see SetSourceInfo()) are written
+    // in the newer format, everything else as before
+    bool Write(const char *filename) const;
+    // write the image at the current position of fp, which may be a pipe
+    void Write(FILE *fp) const;
+    // append the image, as it would be written to a file, to data
+    void Write(vector<UByte> &data) const;
 
     RCX_Result Download(RCX_Link *link, int programNumber=0) const;
     void Print(RCX_Printer *dst, RCX_SourceFiles *sf=0, bool genLASM=false) const;
+    // the listing as a single line JSON object, for tools; sf supplies
+    // the file names and line numbers for the source tags
+    void PrintJSON(RCX_Printer *dst, RCX_SourceFiles *sf=0) const;
+    // bytes per chunk, and chunks used of what the target allows
+    void PrintSizes(FILE *fp) const;
 
     int GetChunkCount() const { return fChunks.size(); }
     void AddChunk(RCX_ChunkType type, UByte number,
@@ -70,11 +87,33 @@ public:
     const Chunk& GetChunk(int i) const { return *fChunks[i]; }
 
     void SetVariable(int index, const char *name);
+    /// name of a global variable, or 0 if it doesn't have one
+    const char* GetVariableName(int index) const;
     void SetTargetType(RCX_TargetType t) { fTargetType = t; }
+    RCX_TargetType GetTargetType() const { return fTargetType; }
+
+    /// Keep the names of the source files and the line of each source
+    /// tag, so they are saved along with the image
+    void SetSourceInfo(RCX_SourceFiles *sf);
+    bool HasSourceInfo() const { return !fSourceNames.empty(); }
+    int GetSourceCount() const { return fSourceNames.size(); }
+    /// name of a source file, or 0 if it isn't known
+    const char* GetSourceName(int i) const;
 
     void Clear();
     int GetSize() const;
 
+    /// how many of the first chunks the main task needs, if the rest
+    /// can be sent after it has started (0 if it needs all of them);
+    /// the compiler knows this, so it isn't saved with the image
+    void SetStartChunks(int n) { fStartChunks = n; }
+    int GetStartChunks() const { return fStartChunks; }
+
+    /// the chunks linked into the single block a Spybotics takes; it's
+    /// linked the first time it's asked for, and kept until the image
+    /// changes
+    const vector<UByte>& GetSpyboticsImage() const;
+
     class   Chunk
     {
     public:
@@ -82,21 +121,45 @@ public:
         int GetLength() const { return fLength; }
         UByte GetNumber() const { return fNumber; }
         RCX_ChunkType GetType() const { return fType; }
+        const char* GetName() const { return fName.c_str(); }
+
+        /// find the source file and line of the code at address (with
+        /// callSite, of the task or sub's own statement it's part of,
+        /// which for the code of an inline function is the call)
+        bool FindLine(int address, int &srcIndex, long &line, bool callSite = false) const;
+
+        /// the source tags, decoded from their compact form
+        void GetTags(vector<RCX_SourceTag> &tags) const;
+        int GetTagCount() const { return fTagCount; }
 
     private:
+        struct Line {
+            int fAddress;
+            int fSrcIndex;
+            long fLine;
+            int fCallSrcIndex;  // -1 if not known
+            long fCallLine;
+
+            bool operator<(const Line &rhs) const { return fAddress < rhs.fAddress; }
+        };
+
         Chunk();
-        ~Chunk();
 
         // partial ordering for sorting
         bool operator<(const Chunk &rhs) const;
 
         int  fLength;
-        UByte* fData;
+        const UByte* fData;     // in the image's file or its blocks
         UByte fNumber;
         RCX_ChunkType fType;
         string fName;
-        RCX_SourceTag* fTags;
+        // each tag is a byte holding its type (and whether the source
+        // file changed), then the changes from the tag before it in
+        // source file, address and offset as signed variable length
+        // numbers; most tags take 3 or 4 bytes rather than 16
+        const UByte* fTagData;  // in the image's blocks
         int fTagCount;
+        vector<Line> fLines;    // in order of address
 
         friend class RCX_Image;
     };
@@ -107,14 +170,46 @@ private:
         string  fName;
     };
 
+    enum {
+        kBlockSize = 4096
+    };
+
     const Chunk* FindChunk(RCX_ChunkType type, UByte number) const;
     std::string* GetNameString(UByte type, UByte index);
 
-    const Chunk** BuildIndex() const;
+    /// the chunks sorted by type and number
+    const vector<const Chunk*>& GetIndex() const;
+    static bool IndexLess(const Chunk *a, const Chunk *b) { return *a < *b; }
+
+    UByte* Allocate(int length);
+    void SetTags(Chunk *f, const RCX_SourceTag *tags, int count);
+
+    bool LoadFile(const char *filename);
+    void ReleaseFile();
+    bool ReadSourceInfo(ULong offset);
+    void DiscardSourceInfo();
+    bool ReadLines(const UByte *ptr, const UByte *end, int count, bool tags);
+    RCX_Result Parse();
+    void WriteSourceInfo(vector<UByte> &data, size_t base) const;
 
     vector<Chunk*> fChunks;
+    mutable vector<const Chunk*> fIndex;    // rebuilt when chunks are added
     vector<Variable> fVars;
     RCX_TargetType fTargetType;
+    vector<string> fSourceNames;    // empty if there's no source info
+    int fStartChunks;
+    mutable vector<UByte> fLinked;  // empty until GetSpyboticsImage()
+
+    // the data and tags of added chunks are carved from a few large
+    // blocks rather than allocated one by one
+    vector<UByte*> fBlocks;
+    UByte* fBlock;          // the block being filled
+    int fBlockLeft;
+
+    // contents of the file that was read
+    const UByte* fFile;
+    long fFileLength;
+    bool fFileMapped;
 };
 
 
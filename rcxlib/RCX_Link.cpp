@@ -26,9 +26,15 @@
 #include "rcxnub_odd.h"
 #include "RCX_PipeTransport.h"
 #include "RCX_SerialPipe.h"
+#include "RCX_SimPipe.h"
 #include "PDebug.h"
 #include "RCX_Image.h"
-#include "RCX_SpyboticsLinker.h"
+#include "RCX_Bundle.h"
+#include "RCX_DownloadHistory.h"
+#include "RCX_TimeoutHistory.h"
+#include "RCX_Firmware.h"
+#include "RCX_LinkStats.h"
+#include "RCX_Trace.h"
 
 #ifdef GHOST
 #include "RCX_GhostTransport.h"
@@ -38,6 +44,7 @@ using std::printf;
 using std::getenv;
 using std::tolower;
 using std::ifstream;
+using std::sprintf;
 
 #define kSerialPortEnv "RCX_PORT"
 
@@ -46,12 +53,21 @@ using std::ifstream;
 #define kSpyboticsChunk 16
 #define kFirmwareChunk 200
 #define kDownloadWaitTime 300
-#define kMaxZerosUSB 23       ///< Max number of zeros when downloading over USB @see AdjustChunkSize
-#define kMaxZerosSerial 30    ///< Max number of zeros when downloading over serial @see AdjustChunkSize
-#define kMaxOnes 90           ///< Max number of sparse bytes when downloading fast @see AdjustChunkSize 
+#define kMaxZerosUSB 23       ///< Max number of zeros when downloading over USB @see PlanChunks
+#define kMaxZerosSerial 30    ///< Max number of zeros when downloading over serial @see PlanChunks
+#define kMaxOnes 90           ///< Max number of sparse bytes when downloading fast @see PlanChunks 
+#define kMinAdaptiveChunk 20  ///< Smallest firmware message when adapting @see DownloadAdaptive
+#define kAdaptiveGrowRun 8    ///< First try successes before an adaptive message grows
+#define kBroadcastWait 100    ///< ms to let the bricks answer a broadcast message @see Broadcast
+#define kMapTasks 40          ///< memory map index of the first task (the subs come first)
+#define kMapLength 188        ///< size of an RCX memory map
 
 #define kNubStart 0x8000
 
+// ms without a command getting through before what's known of the
+// brick is forgotten
+#define kSessionIdle 5000
+
 #define kDeviceUserConfFile "/.rcx/device.conf"
 #define kDeviceEtcConfFile "/etc/rcx/device.conf"
 
@@ -59,8 +75,6 @@ extern bool gQuiet;
 
 static int Checksum(const UByte *data, int length);
 
-static bool gUSB = false;
-
 RCX_Link::RCX_Link()
 {
     fTransport = 0;
@@ -68,8 +82,41 @@ RCX_Link::RCX_Link()
     fRCXProgramChunkSize = kFragmentChunk;
     fRCXFirmwareChunkSize = kFirmwareChunk;
     fDownloadWaitTime = kDownloadWaitTime;
+    fAdaptiveChunkSize = false;
     fVerbose = false;
+    fHistory = 0;
+    fStats = 0;
+    fTrace = 0;
+    fProgressTime = 0;
+    fProgressStart = 0;
+    fProgressRetries = 0;
+    fTimeoutPolicy = RCX_Transport::kAdaptiveTimeout;
+    fTimeouts = 0;
+    fProfiles = 0;
+    fProfile.Clear(kRCX_RCXTarget);
+    fProbed = false;
+    fUSB = false;
+    fProgramMode = false;
+    fBroadcast = 0;
+    fStartMain = false;
     fMaxOnes = kMaxOnes;
+    fSynced = false;
+    fFastLoader = false;
+    fSession.Clear();
+    fSession.fLastTime = 0;
+}
+
+
+void RCX_Link::CopySettings(const RCX_Link &link)
+{
+    SetOmitHeader(link.fOmitHeader);
+    fRCXProgramChunkSize = link.fRCXProgramChunkSize;
+    fRCXFirmwareChunkSize = link.fRCXFirmwareChunkSize;
+    fDownloadWaitTime = link.fDownloadWaitTime;
+    fAdaptiveChunkSize = link.fAdaptiveChunkSize;
+    fBroadcast = link.fBroadcast;
+    fStartMain = link.fStartMain;
+    fTimeoutPolicy = link.fTimeoutPolicy;
 }
 
 
@@ -79,13 +126,8 @@ RCX_Link::~RCX_Link()
 }
 
 
-RCX_Result RCX_Link::Open(RCX_TargetType target, const char *portName, ULong options)
+string RCX_Link::FindPortName(const char *portName)
 {
-    PDEBUGVAR("RCX_Link::Open target type", (int)target);
-    PDEBUGSTR(portName);
-    fVerbose = (options & kVerboseMode);
-    fTarget = target;
-
     // see if an environment variable is set, otherwise use default serial device
     if (!portName) portName = getenv(kSerialPortEnv);
 
@@ -120,13 +162,25 @@ RCX_Result RCX_Link::Open(RCX_TargetType target, const char *portName, ULong opt
 
     // if a default device has not yet been found, use the compiled default
     if (!portName) portName = DEFAULT_DEVICE_NAME;
+    return portName;
+}
+
+
+RCX_Result RCX_Link::Open(RCX_TargetType target, const char *portName, ULong options)
+{
+    if (fTrace) fTrace->Add(RCX_Trace::kOpenEvent, target);
+    fVerbose = (options & kVerboseMode);
+    fTarget = target;
+
+    fPortName = FindPortName(portName);
+    portName = fPortName.c_str();
 
     const char *devName;
 
     if (portName && ((devName=CheckPrefix(portName, "usb")) != 0))
     {
         // USB Tower
-        gUSB = true;
+        fUSB = true;
 #ifdef GHOST
         fTransport = new RCX_GhostTransport();
 #else
@@ -135,10 +189,16 @@ RCX_Result RCX_Link::Open(RCX_TargetType target, const char *portName, ULong opt
         fTransport = new RCX_PipeTransport(pipe);
 #endif
     }
+    else if (portName && ((devName=CheckPrefix(portName, "sim")) != 0))
+    {
+        // simulated brick
+        fUSB = RCX_SimPipe::HasOption(devName, "usb");
+        fTransport = new RCX_PipeTransport(new RCX_SimPipe());
+    }
     else if (portName && ((devName=CheckPrefix(portName, "tcp")) != 0))
     {
         // TCP
-        gUSB = false;
+        fUSB = false;
 
         RCX_Pipe *pipe = RCX_NewTcpPipe();
         if (!pipe) return kRCX_TcpUnsupportedError;
@@ -147,7 +207,7 @@ RCX_Result RCX_Link::Open(RCX_TargetType target, const char *portName, ULong opt
     else
     {
         // Serial Tower
-        gUSB = false;
+        fUSB = false;
         if (portName) {
             // strip off "serial:" prefix if present
             devName = CheckPrefix(portName, "serial");
@@ -160,9 +220,28 @@ RCX_Result RCX_Link::Open(RCX_TargetType target, const char *portName, ULong opt
     }
 
     fTransport->SetOmitHeader(fOmitHeader);
+    fTransport->SetStats(fStats);
+    fTransport->SetTrace(fTrace);
+    fTransport->SetTimeoutPolicy(fTimeoutPolicy);
+
+    // start from what's known of the port's brick
+    if (!fProfiles || !fProfiles->Find(fPortName, fProfile))
+        fProfile.Clear(target);
+    fProbed = false;
+
+    // and from the timeout the port settled on last time, unless one
+    // was asked for
+    int timeout;
+    if ((options & kRxTimeoutMask) == 0) {
+        if (fProfile.fTimeout)
+            options |= (fProfile.fTimeout & kRxTimeoutMask);
+        else if (fTimeouts && fTimeouts->Find(fPortName, timeout))
+            options |= (timeout & kRxTimeoutMask);
+    }
 
     RCX_Result result;
     result = fTransport->Open(target, devName, options);
+    if (fTrace) fTrace->Add(RCX_Trace::kOpenResultEvent, result);
     PREQUIRENOT(result, Fail_Open);
 
     if (fTarget == kRCX_SpyboticsTarget) {
@@ -174,9 +253,11 @@ RCX_Result RCX_Link::Open(RCX_TargetType target, const char *portName, ULong opt
 
     // Tweak maximums for detecting too many zeros in a transfer, which
     // can cause sync problems at higher transfer speeds.
-    fMaxZeros = gUSB ? kMaxZerosUSB : kMaxZerosSerial;
+    fMaxZeros = fUSB ? kMaxZerosUSB : kMaxZerosSerial;
 
     fSynced = false;
+    fFastLoader = false;
+    fSession.Clear();
     fResult = kRCX_OK;
     return kRCX_OK;
 
@@ -190,6 +271,14 @@ Fail_Open:
 void RCX_Link::Close()
 {
     if (fTransport) {
+        if (fTimeoutPolicy != RCX_Transport::kFixedTimeout &&
+            fTransport->GetRxTimeout() > 0) {
+            if (fTimeouts) fTimeouts->Store(fPortName, fTransport->GetRxTimeout());
+            fProfile.fTimeout = fTransport->GetRxTimeout();
+            StoreProfile();
+        }
+
+        if (fTrace) fTrace->Add(RCX_Trace::kCloseEvent, fTransport->GetRxTimeout());
         fTransport->Close();
         delete fTransport;
         fTransport = 0;
@@ -204,6 +293,7 @@ RCX_Result RCX_Link::Sync()
 
     // We are already synced.
     if (fSynced) return kRCX_OK;
+    if (fTrace) fTrace->Add(RCX_Trace::kSyncEvent, fTarget);
 
     // always start with a ping
     result = Send(cmd.MakePing());
@@ -223,10 +313,150 @@ RCX_Result RCX_Link::Sync()
     }
 
     fSynced = true;
+    if (fProfiles) ProbeBrick();
     return kRCX_OK;
 }
 
 
+/*
+ * Check the versions of the brick that just answered against the
+ * port's profile.  The ROM tells one kind of brick from another, so if
+ * it's different the profile starts over; the firmware (and so the
+ * target) may have changed since without the rest being any different.
+ */
+void RCX_Link::ProbeBrick()
+{
+    RCX_BrickProfiles::Profile p = fProfile;
+
+    fProbed = true;
+    if (fTarget == kRCX_RCXTarget || fTarget == kRCX_RCX2Target || fTarget == kRCX_SwanTarget) {
+        ULong rom, ram;
+        if (RCX_ERROR(GetVersion(rom, ram))) return;
+
+        if (rom != p.fRom) {
+            p.Clear(fTarget);
+            p.fRom = rom;
+            p.fTimeout = fProfile.fTimeout;
+        }
+        p.fRam = ram;
+    }
+    else if (p.fTarget != fTarget) {
+        // nothing to tell these bricks apart by but the target
+        p.Clear(fTarget);
+        p.fTimeout = fProfile.fTimeout;
+    }
+
+    p.fTarget = RCX_BrickProfiles::GetTarget(fTarget, p.fRom, p.fRam);
+    if (fVerbose && p.fTarget != fTarget)
+        printf("brick on %s runs as %s\n", fPortName.c_str(), getTarget(p.fTarget)->fName);
+
+    fProfile = p;
+    StoreProfile();
+}
+
+
+void RCX_Link::StoreProfile()
+{
+    if (fProfiles && fProbed)
+        fProfiles->Store(fPortName, fProfile);
+}
+
+
+/*
+ * Firmware messages are no bigger than the last adaptive download to the
+ * port's brick found would go through without retries.
+ */
+int RCX_Link::FirmwareChunkSize() const
+{
+    if (fProfile.fChunk > 0 && fProfile.fChunk < fRCXFirmwareChunkSize)
+        return fProfile.fChunk;
+
+    return fRCXFirmwareChunkSize;
+}
+
+
+RCX_Result RCX_Link::StopAll()
+{
+    RCX_Cmd cmd;
+
+    ExpireSession();
+    if (fSession.fTasksStopped) return kRCX_OK;
+
+    return Send(cmd.Set(kRCX_StopAllOp));
+}
+
+
+RCX_Result RCX_Link::SelectProgram(int program)
+{
+    RCX_Cmd cmd;
+
+    ExpireSession();
+    if (fSession.fProgram == program) return kRCX_OK;
+
+    return Send(cmd.Set(kRCX_SelectProgramOp, (UByte)program));
+}
+
+
+/*
+ * Follow what a command that was sent did to the brick.
+ */
+void RCX_Link::NoteSent(const UByte *data, int length, RCX_Result result)
+{
+    if (RCX_ERROR(result) || length < 1) {
+        // it may or may not have been carried out
+        fSession.Clear();
+        return;
+    }
+
+    ExpireSession();
+    fSession.fLastTime = RCX_LinkStats::Now();
+
+    switch (data[0]) {
+        case kRCX_StopAllOp:
+            fSession.fTasksStopped = true;
+            break;
+        case kRCX_StartTaskOp:
+            fSession.fTasksStopped = false;
+            break;
+        case kRCX_SelectProgramOp:
+            fSession.fProgram = length > 1 ? data[1] : -1;
+            break;
+
+        // these leave the tasks and the selected program alone
+        case kRCX_PingOp:
+        case kRCX_ReadOp:
+        case kRCX_GetVersions:
+        case kRCX_GetMemMap:
+        case kRCX_BatteryLevelOp:
+        case kRCX_PlaySoundOp:
+        case kRCX_PlayToneOp:
+        case kRCX_DeleteTasksOp:
+        case kRCX_DeleteSubsOp:
+        case kRCX_DeleteTaskOp:
+        case kRCX_DeleteSubOp:
+        case kRCX_BeginTaskOp:
+        case kRCX_BeginSubOp:
+        case kRCX_DownloadOp:
+        case kRCX_SetWatchOp:
+        case kRCX_IRModeOp:
+        case kRCX_SetDatalogOp:
+        case kRCX_UploadDatalogOp:
+            break;
+
+        default:
+            fSession.Clear();
+            break;
+    }
+}
+
+
+void RCX_Link::ExpireSession()
+{
+    if (RCX_LinkStats::Now() - fSession.fLastTime > kSessionIdle)
+        fSession.Clear();
+}
+
+
 bool RCX_Link::WasErrorFromMissingFirmware()
 {
     // if not RCX, RCX2, or Swan then firmware isn't required
@@ -260,19 +490,22 @@ RCX_Result RCX_Link::Download(const RCX_Image &image, int programNumber)
     RCX_Result result;
     RCX_Cmd cmd;
 
+    if (fBroadcast && fTarget != kRCX_SpyboticsTarget)
+        return DownloadBroadcast(image, programNumber);
+
     // sync with RCX
     result = Sync();
     if (RCX_ERROR(result)) return result;
 
     // stop any running tasks
-    result = Send(cmd.Set(kRCX_StopAllOp));
+    result = StopAll();
     if (RCX_ERROR(result)) return result;
 
     if (fTarget == kRCX_SpyboticsTarget) {
         result = DownloadSpybotics(image);
     }
     else {
-        result = DownloadByChunk(image, programNumber);
+        result = DownloadByChunk(image, programNumber, fStartMain);
     }
 
     if (RCX_ERROR(result)) return result;
@@ -285,14 +518,46 @@ RCX_Result RCX_Link::Download(const RCX_Image &image, int programNumber)
 }
 
 
+RCX_Result RCX_Link::Download(const RCX_Bundle &bundle)
+{
+    RCX_Result result;
+    RCX_Cmd cmd;
+
+    // Spybotics has a single program
+    if (fTarget == kRCX_SpyboticsTarget && bundle.GetProgramCount() > 1)
+        return kRCX_RequestError;
+
+    result = Sync();
+    if (RCX_ERROR(result)) return result;
+
+    result = StopAll();
+    if (RCX_ERROR(result)) return result;
+
+    for (int i=0; i<bundle.GetProgramCount(); ++i) {
+        if (fTarget == kRCX_SpyboticsTarget) {
+            result = DownloadSpybotics(bundle.GetImage(i));
+        }
+        else {
+            result = DownloadByChunk(bundle.GetImage(i), bundle.GetSlot(i));
+        }
+
+        if (RCX_ERROR(result)) return result;
+    }
+
+    if (!gQuiet) {
+        Send(cmd.MakePlaySound(5));
+    }
+    return kRCX_OK;
+}
+
+
 RCX_Result RCX_Link::DownloadSpybotics(const RCX_Image &image)
 {
-    RCX_SpyboticsLinker linker;
-    vector<UByte> output;
+    // the image keeps what it linked, so downloading it again is cheap
+    const vector<UByte> &output = image.GetSpyboticsImage();
     RCX_Result result;
     RCX_Cmd cmd;
 
-    linker.Generate(image, output);
     int length = output.size();
     const UByte* data = &output[0];
 
@@ -303,24 +568,26 @@ RCX_Result RCX_Link::DownloadSpybotics(const RCX_Image &image)
     if (RCX_ERROR(result)) return result;
 
     BeginProgress(length);
-    result = Download(data, length, gUSB ? kSpyboticsSmallChunk : kSpyboticsChunk);
+    result = Download(data, length, fUSB ? kSpyboticsSmallChunk : kSpyboticsChunk);
     if (RCX_ERROR(result)) return result;
 
     return kRCX_OK;
 }
 
 // TODO: this is an odd way to set a boolean property...
-bool gProgramMode = false;
 class ProgramMode
 {
   public:
-  ProgramMode() { gProgramMode = true; }
-  ~ProgramMode() { gProgramMode = false; }
+  ProgramMode(bool &mode) : fMode(mode) { fMode = true; }
+  ~ProgramMode() { fMode = false; }
+  private:
+  bool &fMode;
 };
 
-RCX_Result RCX_Link::DownloadByChunk(const RCX_Image &image, int programNumber)
+RCX_Result RCX_Link::DownloadByChunk(const RCX_Image &image, int programNumber,
+    bool start)
 {
-    ProgramMode x = ProgramMode();
+    ProgramMode x(fProgramMode);
 
     RCX_Result result;
     RCX_Cmd cmd;
@@ -328,10 +595,16 @@ RCX_Result RCX_Link::DownloadByChunk(const RCX_Image &image, int programNumber)
 
     // select program
     if (programNumber) {
-        result = Send(cmd.Set(kRCX_SelectProgramOp, (UByte)(programNumber-1)));
+        result = SelectProgram(programNumber-1);
         if (RCX_ERROR(result)) return result;
     }
 
+    if (fHistory && CanReplaceChunks(image)) {
+        result = DownloadChanged(image, programNumber);
+        if (RCX_ERROR(result) || !start) return result;
+        return StartMain();
+    }
+
     // clear existing tasks and/or subs
     result = Send(cmd.MakeDeleteTasks());
     if (RCX_ERROR(result)) return result;
@@ -341,184 +614,762 @@ RCX_Result RCX_Link::DownloadByChunk(const RCX_Image &image, int programNumber)
 
     int total = image.GetSize();
 
+    // these run a program while the rest of it is downloaded, so main
+    // can start once the chunks it needs are there
+    int startAfter = image.GetChunkCount();
+    if (image.GetStartChunks() && (fTarget == kRCX_RCXTarget ||
+        fTarget == kRCX_RCX2Target || fTarget == kRCX_SwanTarget))
+        startAfter = image.GetStartChunks();
+
     for (i=0; i<image.GetChunkCount(); i++) {
         const RCX_Image::Chunk &f = image.GetChunk(i);
         result = DownloadChunk(f.GetType(), f.GetNumber(), f.GetData(),
             f.GetLength(), i==0 ? total : -1);
         if (RCX_ERROR(result)) return result;
+
+        if (start && i+1 == startAfter) {
+            result = StartMain();
+            if (RCX_ERROR(result)) return result;
+        }
     }
 
     return kRCX_OK;
 }
 
 
-RCX_Result RCX_Link::DownloadChunk(RCX_ChunkType type, UByte number,
-    const UByte *data, int length, int total)
+RCX_Result RCX_Link::StartMain()
 {
     RCX_Cmd cmd;
-    RCX_Result result;
-
-    result = Sync();
-    if (RCX_ERROR(result)) return result;
-
-    result = Send(cmd.MakeBegin(type, number, (UShort)length));
-    if (RCX_ERROR(result)) return result;
-
-    // make sure we have enough room
-    if (result != 1 ||
-        GetReplyByte(0) != 0) return kRCX_MemFullError;
-
-    if (total == 0)
-        total = length;
-
-    if (total > 0)
-        BeginProgress(total);
 
-    result = Download(data, length, fRCXProgramChunkSize);
-    return result;
+    return Send(cmd.Set(kRCX_StartTaskOp,
+        (UByte)getTarget(fTarget)->fRanges[kRCX_TaskChunk].fBase));
 }
 
 
-RCX_Result RCX_Link::GetVersion(ULong &rom, ULong &ram)
+/*
+ * Download() to every brick in range of the tower.  The same messages
+ * go out as for DownloadByChunk(), except that nothing waits for a
+ * reply, so a brick that misses a message isn't noticed.  Verify()
+ * tells afterwards which bricks got the whole program.
+ */
+RCX_Result RCX_Link::DownloadBroadcast(const RCX_Image &image, int programNumber)
 {
-    RCX_Cmd cmd;
+    ProgramMode x(fProgramMode);
+
     RCX_Result result;
-    UByte reply[8];
+    RCX_Cmd cmd;
+    vector<UShort> sizes;
+    int i;
 
-    result = Sync();
+    result = Broadcast(cmd.Set(kRCX_StopAllOp));
     if (RCX_ERROR(result)) return result;
 
-    result = Send(cmd.MakeGetVersions());
+    if (programNumber) {
+        result = Broadcast(cmd.Set(kRCX_SelectProgramOp, (UByte)(programNumber-1)));
+        if (RCX_ERROR(result)) return result;
+    }
+
+    result = Broadcast(cmd.MakeDeleteTasks());
     if (RCX_ERROR(result)) return result;
 
-    if (result != 8) return kRCX_ReplyError;
+    result = Broadcast(cmd.MakeDeleteSubs());
+    if (RCX_ERROR(result)) return result;
 
-    GetReply(reply,8);
+    BeginProgress(image.GetSize());
 
-    rom =   ((ULong)reply[0] << 24) |
-            ((ULong)reply[1] << 16) |
-            ((ULong)reply[2] << 8) |
-            ((ULong)reply[3]);
+    for (i=0; i<image.GetChunkCount(); i++) {
+        const RCX_Image::Chunk &f = image.GetChunk(i);
+        const UByte *data = f.GetData();
+        int remain = f.GetLength();
 
-    ram =   ((ULong)reply[4] << 24) |
-            ((ULong)reply[5] << 16) |
-            ((ULong)reply[6] << 8) |
-            ((ULong)reply[7]);
+        result = Broadcast(cmd.MakeBegin(f.GetType(), f.GetNumber(), (UShort)remain));
+        if (RCX_ERROR(result)) return result;
+
+        sizes.resize(0);
+        PlanChunks(data, remain, fRCXProgramChunkSize,
+            fTransport->GetComplementData(), sizes);
 
+        for (size_t step = 0; step < sizes.size(); ++step) {
+            int n = sizes[step];
+
+            // the last message has sequence number 0
+            cmd.MakeDownload((UShort)(remain > n ? step+1 : 0), data, (UShort)n);
+            result = Broadcast(&cmd);
+            if (RCX_ERROR(result)) return result;
+
+            if (!IncrementProgress(n)) return kRCX_AbortError;
+
+            remain -= n;
+            data += n;
+        }
+    }
+
+    if (!gQuiet) {
+        Broadcast(cmd.MakePlaySound(5));
+    }
     return kRCX_OK;
 }
 
 
-RCX_Result RCX_Link::GetValue(RCX_Value value)
+/*
+ * Send a message fBroadcast times without waiting for it to be taken.
+ * Each copy is the same frame, so a brick that got an earlier one
+ * takes the rest as retries.  With several bricks answering at once the
+ * replies garble each other; they are only waited for so the next
+ * message doesn't go out while the bricks are still talking.
+ */
+RCX_Result RCX_Link::Broadcast(const RCX_Cmd *cmd)
 {
-    RCX_Cmd cmd;
-    RCX_Result result;
+    RCX_Frames frames;
 
-    result = Sync();
-    if (RCX_ERROR(result)) return result;
+    // the brick that answers might not be the one the session is about
+    fSession.Clear();
 
-    result = Send(cmd.MakeRead(value));
-    if (RCX_ERROR(result)) return result;
-    if (result != 2) return kRCX_ReplyError;
+    frames.Clear(fTransport->GetLastCommand());
+    fTransport->Frame(cmd->GetBody(), cmd->GetLength(), true, frames);
 
-    result = (int)GetReplyByte(0) + ((int)GetReplyByte(1) << 8);
-    return result;
+    int expected = ExpectedReplyLength(cmd->GetBody(), cmd->GetLength());
+
+    for (int i=0; i<fBroadcast; ++i) {
+        RCX_Result result = fTransport->SendFrame(frames, 0, fReply, expected,
+            kMaxReplyLength, false, kBroadcastWait);
+
+        // not even an echo, so the tower isn't working
+        if (result == kRCX_IREchoError) return result;
+    }
+
+    return kRCX_OK;
 }
 
 
-RCX_Result RCX_Link::GetBatteryLevel()
+/*
+ * The memory map holds the address of each sub (8 per program) and then
+ * each task (10 per program).  The tail of every chunk is read back and
+ * compared: a brick takes download messages in order only, so if the
+ * last one made it the rest did too.
+ */
+RCX_Result RCX_Link::Verify(const RCX_Image &image, int programNumber)
 {
-    RCX_Cmd cmd;
     RCX_Result result;
+    vector<UByte> map;
+    int slot;
+    int i;
 
-    result = Sync();
-    if (RCX_ERROR(result)) return result;
+    if (!CanReplaceChunks(image)) return 0;
 
-    if (fTarget == kRCX_ScoutTarget) {
-        result = Send(cmd.Set(kRCX_PollMemoryOp, 0x3a, 0x01, 0x01));
-        if (result != 1) return kRCX_ReplyError;
-        result = (int)GetReplyByte(0) * 109;
-    }
-    else {
-        result = Send(cmd.Set(kRCX_BatteryLevelOp));
-        if (result != 2) return kRCX_ReplyError;
-        result = (int)GetReplyByte(0) + ((int)GetReplyByte(1) << 8);
+    result = ReadProgramMap(programNumber, slot, map);
+    if (result != 1) return result;
+
+    for (i=0; i<image.GetChunkCount(); i++) {
+        const RCX_Image::Chunk &f = image.GetChunk(i);
+        int index = MapIndex(slot, f.GetType(), f.GetNumber());
+        if (index < 0) return 0;
+
+        int address = (map[2*index] << 8) | map[2*index+1];
+        int length = f.GetLength();
+        int n = length < fRCXProgramChunkSize ? length : fRCXProgramChunkSize;
+        if (address == 0) return 0;
+
+        result = CompareMemory(address + length - n, f.GetData() + length - n, n);
+        if (result != 1) return result;
     }
 
-    return result;
+    return 1;
 }
 
 
-RCX_Result RCX_Link::DownloadFirmware(const UByte *data, int length, int start, bool fast)
+/*
+ * Reads back all of every task and sub, rather than the tails Verify()
+ * looks at, and sends again only the ones that differ or are missing.
+ * Tasks and subs the program has on the brick that the image doesn't
+ * are deleted.
+ */
+RCX_Result RCX_Link::Repair(const RCX_Image &image, int programNumber)
 {
     RCX_Result result;
+    RCX_Cmd cmd;
+    vector<UByte> map;
+    vector<bool> present;
+    vector<int> bad;
+    vector<int> extra;
+    int slot;
+    int total = 0;
+    int i;
 
-    if (fast) {
-        // check for fast mode support
-        if (!fTransport->FastModeSupported()) return kRCX_PipeModeError;
+    if (!CanReplaceChunks(image)) return 0;
+
+    result = ReadProgramMap(programNumber, slot, map);
+    if (result != 1) return result;
 
-        // send the nub first
-        if (fTransport->FastModeOddParity()) {
-            result = TransferFirmware(rcxnub_odd, sizeof(rcxnub_odd), kNubStart, false);
+    present.resize(map.size() / 2);
+    for (i=0; i<image.GetChunkCount(); i++) {
+        const RCX_Image::Chunk &f = image.GetChunk(i);
+        int index = MapIndex(slot, f.GetType(), f.GetNumber());
+        if (index < 0) return 0;
+        present[index] = true;
+
+        int address = (map[2*index] << 8) | map[2*index+1];
+        if (address != 0) {
+            result = CompareMemory(address, f.GetData(), f.GetLength());
+            if (RCX_ERROR(result)) return result;
         }
-        else {
-            result = TransferFirmware(rcxnub, sizeof(rcxnub), kNubStart, false);
+
+        if (address == 0 || result == 0) {
+            bad.push_back(i);
+            total += f.GetLength();
         }
+    }
+
+    for (i=0; i<18; ++i) {
+        RCX_ChunkType type = i < 8 ? kRCX_SubChunk : kRCX_TaskChunk;
+        int index = MapIndex(slot, type, i < 8 ? i : i - 8);
+
+        if (!present[index] && (map[2*index] | map[2*index+1]))
+            extra.push_back(i);
+    }
+
+    if (bad.empty() && extra.empty()) return 1;
+
+    if (fVerbose)
+        printf("replacing %d of %d chunks\n", (int)bad.size(), image.GetChunkCount());
+
+    result = StopAll();
+    if (RCX_ERROR(result)) return result;
+
+    for (i=0; i<(int)extra.size(); ++i) {
+        int n = extra[i];
+        result = Send(n < 8 ? cmd.MakeDeleteSub((UByte)n) : cmd.MakeDeleteTask((UByte)(n - 8)));
         if (RCX_ERROR(result)) return result;
+    }
 
-        // switch to fast mode
-        fTransport->SetFastMode(true);
+    for (i=0; i<(int)bad.size(); ++i) {
+        const RCX_Image::Chunk &f = image.GetChunk(bad[i]);
 
-        // download
-        result = TransferFirmware(data, length, start, true);
+        result = Send(f.GetType() == kRCX_TaskChunk ?
+            cmd.MakeDeleteTask(f.GetNumber()) : cmd.MakeDeleteSub(f.GetNumber()));
+        if (RCX_ERROR(result)) return result;
 
-        fTransport->SetFastMode(false);
+        result = DownloadChunk(f.GetType(), f.GetNumber(), f.GetData(),
+            f.GetLength(), i==0 ? total : -1);
+        if (RCX_ERROR(result)) return result;
     }
-    else {
-        result = TransferFirmware(data, length, start, true);
+
+    // the brick's memory map is different now, so the history's entry
+    // for it would no longer be trusted anyway
+    if (fHistory) {
+        string brick;
+        if (!RCX_ERROR(GetBrickName(programNumber, brick)))
+            fHistory->Forget(brick);
     }
 
-    return result;
+    return 1;
 }
 
 
-RCX_Result RCX_Link::TransferFirmware(const UByte *data, int length, int start, bool progress)
+/*
+ * Select the program and read the memory map.  Returns 1 with the
+ * program's slot (counting from 0) and the map, or 0 if the brick's map
+ * isn't one that can be used.
+ */
+RCX_Result RCX_Link::ReadProgramMap(int programNumber, int &slot, vector<UByte> &map)
 {
-    PDEBUGVAR("RCX_Link::TransferFirmware, length", length);
-    RCX_Cmd cmd;
     RCX_Result result;
 
-    // Sync takes care of the Ping and any necessary unlock ops.
     result = Sync();
-    PDEBUGVAR("result after Sync", result);
     if (RCX_ERROR(result)) return result;
 
-    // Delete the existing FW
-    result = Send(cmd.Set(kRCX_DeleteFirmware, 1, 3, 5, 7, 0xb));
-    PDEBUGVAR("result after DeleteFirmware", result);
-    if (RCX_ERROR(result)) return result;
+    if (programNumber) {
+        result = SelectProgram(programNumber-1);
+        if (RCX_ERROR(result)) return result;
+    }
 
-    // Make a checksum and transfer the FW
-    int check = Checksum(data, length < 0x4c00 ? length : 0x4c00);
-    result = Send(cmd.Set(kRCX_BeginFirmwareOp,
-        (UByte)(start), (UByte)(start>>8), (UByte)check, (UByte)(check>>8), 0));
-    PDEBUGVAR("result after BeginFirmwareOp", result);
+    result = GetValue(RCX_VALUE(kRCX_ProgramType, 0));
     if (RCX_ERROR(result)) return result;
+    slot = result;
 
-    BeginProgress(progress ? length : 0);
-    result = Download(data, length, fRCXFirmwareChunkSize);
-    PDEBUGVAR("result after Download", result);
+    result = GetMemoryMap(map);
     if (RCX_ERROR(result)) return result;
+    if (map.size() < kMapLength || slot < 0 || slot > 4) return 0;
 
-    // last packet is no-retry with an extra long delay
-    // this gives the RCX time to respond and makes sure response doesn't get trampled
+    return 1;
+}
+
+
+/*
+ * Index in the memory map of a task or sub of the program in slot, or
+ * -1 if there isn't one for it.
+ */
+int RCX_Link::MapIndex(int slot, RCX_ChunkType type, int number)
+{
+    if (type == kRCX_TaskChunk)
+        return number < 10 ? kMapTasks + slot * 10 + number : -1;
+    else
+        return number < 8 ? slot * 8 + number : -1;
+}
+
+
+/*
+ * Read length bytes of the brick's memory from address, a message's
+ * worth at a time.  Returns 1 if they are the same as data, 0 if not.
+ */
+RCX_Result RCX_Link::CompareMemory(int address, const UByte *data, int length)
+{
+    RCX_Result result;
+    RCX_Cmd cmd;
+
+    while (length > 0) {
+        int n = length < fRCXProgramChunkSize ? length : fRCXProgramChunkSize;
+
+        result = Send(cmd.Set(kRCX_PollMemoryOp, (UByte)address,
+            (UByte)(address >> 8), (UByte)n));
+        if (RCX_ERROR(result)) return result;
+        if (result != n) return 0;
+
+        for (int j=0; j<n; ++j) {
+            if (GetReplyByte(j) != data[j]) return 0;
+        }
+
+        address += n;
+        data += n;
+        length -= n;
+    }
+
+    return 1;
+}
+
+
+bool RCX_Link::CanReplaceChunks(const RCX_Image &image) const
+{
+    // these have commands to delete a single task or sub
+    if (fTarget != kRCX_RCXTarget &&
+        fTarget != kRCX_RCX2Target &&
+        fTarget != kRCX_SwanTarget) return false;
+
+    for (int i=0; i<image.GetChunkCount(); i++) {
+        RCX_ChunkType type = image.GetChunk(i).GetType();
+        if (type != kRCX_TaskChunk && type != kRCX_SubChunk) return false;
+    }
+
+    return true;
+}
+
+
+/*
+ * Part of DownloadByChunk(), once the program has been selected.  A
+ * chunk is left alone if the history says the brick already has it,
+ * which is only trusted if the brick's memory map is the same as it was
+ * after that download.
+ */
+RCX_Result RCX_Link::DownloadChanged(const RCX_Image &image, int programNumber)
+{
+    RCX_Result result;
+    RCX_Cmd cmd;
+    RCX_DownloadHistory::Entry last;
+    RCX_DownloadHistory::Entry now;
+    vector<int> changed;
+    string brick;
+    int total = 0;
+    int i;
+
+    result = GetBrickName(programNumber, brick);
+    if (RCX_ERROR(result)) return result;
+
+    result = GetMemoryMap(now.fMemoryMap);
+    if (RCX_ERROR(result)) return result;
+
+    bool known = fHistory->Find(brick, last) &&
+        last.fMemoryMap == now.fMemoryMap;
+
+    // if the download fails part way the brick's contents are unknown
+    fHistory->Forget(brick);
+
+    if (!known) {
+        last.fChunks.resize(0);
+
+        result = Send(cmd.MakeDeleteTasks());
+        if (RCX_ERROR(result)) return result;
+
+        result = Send(cmd.MakeDeleteSubs());
+        if (RCX_ERROR(result)) return result;
+    }
+
+    for (i=0; i<image.GetChunkCount(); i++) {
+        const RCX_Image::Chunk &f = image.GetChunk(i);
+        RCX_DownloadHistory::Chunk c;
+
+        c.fType = f.GetType();
+        c.fNumber = f.GetNumber();
+        c.fHash = RCX_DownloadHistory::Hash(f.GetData(), f.GetLength());
+        now.fChunks.push_back(c);
+    }
+
+    // delete the chunks that are gone or have changed
+    for (i=0; i<(int)last.fChunks.size(); ++i) {
+        const RCX_DownloadHistory::Chunk &c = last.fChunks[i];
+        int j;
+
+        for (j=0; j<(int)now.fChunks.size(); ++j) {
+            if (now.fChunks[j].fType == c.fType &&
+                now.fChunks[j].fNumber == c.fNumber) break;
+        }
+
+        if (j < (int)now.fChunks.size() && now.fChunks[j].fHash == c.fHash)
+            continue;
+
+        result = Send(c.fType == kRCX_TaskChunk ?
+            cmd.MakeDeleteTask(c.fNumber) : cmd.MakeDeleteSub(c.fNumber));
+        if (RCX_ERROR(result)) return result;
+    }
+
+    // then send the ones the brick doesn't have
+    for (i=0; i<(int)now.fChunks.size(); ++i) {
+        const RCX_DownloadHistory::Chunk &c = now.fChunks[i];
+        int j;
+
+        for (j=0; j<(int)last.fChunks.size(); ++j) {
+            if (last.fChunks[j].fType == c.fType &&
+                last.fChunks[j].fNumber == c.fNumber &&
+                last.fChunks[j].fHash == c.fHash) break;
+        }
+
+        if (j == (int)last.fChunks.size()) {
+            changed.push_back(i);
+            total += image.GetChunk(i).GetLength();
+        }
+    }
+
+    for (i=0; i<(int)changed.size(); ++i) {
+        const RCX_Image::Chunk &f = image.GetChunk(changed[i]);
+        result = DownloadChunk(f.GetType(), f.GetNumber(), f.GetData(),
+            f.GetLength(), i==0 ? total : -1);
+        if (RCX_ERROR(result)) return result;
+    }
+
+    result = GetMemoryMap(now.fMemoryMap);
+    if (RCX_ERROR(result)) return result;
+
+    fHistory->Store(brick, now);
+    return kRCX_OK;
+}
+
+
+RCX_Result RCX_Link::GetBrickName(int programNumber, string &name)
+{
+    RCX_Result result;
+    ULong rom, ram;
+    char text[64];
+
+    result = GetVersion(rom, ram);
+    if (RCX_ERROR(result)) return result;
+
+    // slot 0 is whichever program is selected
+    if (programNumber == 0) {
+        result = GetValue(RCX_VALUE(kRCX_ProgramType, 0));
+        if (RCX_ERROR(result)) return result;
+        programNumber = result + 1;
+    }
+
+    sprintf(text, " %s %08lx/%08lx %d", getTarget(fTarget)->fName, rom, ram,
+        programNumber);
+    name = fPortName + text;
+    return kRCX_OK;
+}
+
+
+RCX_Result RCX_Link::GetMemoryMap(vector<UByte> &memoryMap)
+{
+    RCX_Cmd cmd;
+    RCX_Result result;
+
+    result = Send(cmd.Set(kRCX_GetMemMap));
+    if (RCX_ERROR(result)) return result;
+    if (result <= 0) return kRCX_ReplyError;
+
+    memoryMap.resize(result);
+    GetReply(&memoryMap[0], result);
+    return kRCX_OK;
+}
+
+
+RCX_Result RCX_Link::DownloadChunk(RCX_ChunkType type, UByte number,
+    const UByte *data, int length, int total)
+{
+    RCX_Cmd cmd;
+    RCX_Result result;
+
+    result = Sync();
+    if (RCX_ERROR(result)) return result;
+
+    result = Send(cmd.MakeBegin(type, number, (UShort)length));
+    if (RCX_ERROR(result)) return result;
+
+    // make sure we have enough room
+    if (result != 1 ||
+        GetReplyByte(0) != 0) return kRCX_MemFullError;
+
+    if (total == 0)
+        total = length;
+
+    if (total > 0)
+        BeginProgress(total);
+
+    result = Download(data, length, fRCXProgramChunkSize);
+    return result;
+}
+
+
+RCX_Result RCX_Link::GetVersion(ULong &rom, ULong &ram)
+{
+    RCX_Cmd cmd;
+    RCX_Result result;
+    UByte reply[8];
+
+    result = Sync();
+    if (RCX_ERROR(result)) return result;
+
+    result = Send(cmd.MakeGetVersions());
+    if (RCX_ERROR(result)) return result;
+
+    if (result != 8) return kRCX_ReplyError;
+
+    GetReply(reply,8);
+
+    rom =   ((ULong)reply[0] << 24) |
+            ((ULong)reply[1] << 16) |
+            ((ULong)reply[2] << 8) |
+            ((ULong)reply[3]);
+
+    ram =   ((ULong)reply[4] << 24) |
+            ((ULong)reply[5] << 16) |
+            ((ULong)reply[6] << 8) |
+            ((ULong)reply[7]);
+
+    return kRCX_OK;
+}
+
+
+RCX_Result RCX_Link::GetValue(RCX_Value value)
+{
+    RCX_Cmd cmd;
+    RCX_Result result;
+
+    result = Sync();
+    if (RCX_ERROR(result)) return result;
+
+    result = Send(cmd.MakeRead(value));
+    if (RCX_ERROR(result)) return result;
+    if (result != 2) return kRCX_ReplyError;
+
+    result = (int)GetReplyByte(0) + ((int)GetReplyByte(1) << 8);
+    return result;
+}
+
+
+RCX_Result RCX_Link::GetValues(const RCX_Value *values, int count, RCX_Result *results)
+{
+    RCX_Result result;
+
+    result = Sync();
+    if (RCX_ERROR(result)) return result;
+
+    vector<RCX_Cmd> cmds(count);
+    vector<const RCX_Cmd*> cmdPtrs(count);
+    for (int i=0; i<count; ++i)
+        cmdPtrs[i] = cmds[i].MakeRead(values[i]);
+
+    vector<UByte> replies;
+    result = Send(count ? &cmdPtrs[0] : 0, count, results, &replies);
+
+    const UByte *reply = replies.empty() ? 0 : &replies[0];
+    for (int i=0; i<count; ++i) {
+        if (RCX_ERROR(results[i])) continue;
+        int length = results[i];
+        if (length != 2) {
+            results[i] = kRCX_ReplyError;
+            if (!RCX_ERROR(result)) result = kRCX_ReplyError;
+        }
+        else
+            results[i] = (int)reply[0] + ((int)reply[1] << 8);
+        reply += length;
+    }
+
+    return RCX_ERROR(result) ? result : kRCX_OK;
+}
+
+
+RCX_Result RCX_Link::GetBatteryLevel()
+{
+    RCX_Cmd cmd;
+    RCX_Result result;
+
+    result = Sync();
+    if (RCX_ERROR(result)) return result;
+
+    if (fTarget == kRCX_ScoutTarget) {
+        result = Send(cmd.Set(kRCX_PollMemoryOp, 0x3a, 0x01, 0x01));
+        if (result != 1) return kRCX_ReplyError;
+        result = (int)GetReplyByte(0) * 109;
+    }
+    else {
+        result = Send(cmd.Set(kRCX_BatteryLevelOp));
+        if (result != 2) return kRCX_ReplyError;
+        result = (int)GetReplyByte(0) + ((int)GetReplyByte(1) << 8);
+    }
+
+    return result;
+}
+
+
+RCX_Result RCX_Link::DownloadFirmware(const UByte *data, int length, int start, bool fast)
+{
+    RCX_Firmware firmware(data, length, start);
+    return DownloadFirmware(firmware, fast);
+}
+
+
+RCX_Result RCX_Link::DownloadFirmware(RCX_Firmware &firmware, bool fast)
+{
+    RCX_Result result;
+
+    if (fast) {
+        // check for fast mode support
+        if (!fTransport->FastModeSupported()) return kRCX_PipeModeError;
+
+        // a port that can't run at the fast speed (some serial ports),
+        // or a brick that couldn't hear it last time, can still get the
+        // firmware at the normal one
+        if (fProfile.fFast == 0 || RCX_ERROR(fTransport->SetFastMode(true))) {
+            return TransferFirmware(firmware);
+        }
+        fTransport->SetFastMode(false);
+
+        result = StartFastLoader();
+        if (RCX_ERROR(result)) return result;
+
+        // download
+        result = TransferFirmware(firmware);
+        if (!RCX_ERROR(result)) fFastLoader = false;
+
+        fTransport->SetFastMode(false);
+    }
+    else {
+        result = TransferFirmware(firmware);
+    }
+
+    return result;
+}
+
+
+RCX_Result RCX_Link::StartFastLoader()
+{
+    RCX_Cmd cmd;
+    RCX_Result result;
+
+    // a download that failed part way leaves the nub running, so a
+    // retry only has to find it at the fast speed
+    if (fFastLoader) {
+        fTransport->SetFastMode(true);
+        if (!RCX_ERROR(Send(cmd.MakePing(), false))) return kRCX_OK;
+        fTransport->SetFastMode(false);
+        fFastLoader = false;
+    }
+
+    // send the nub at the normal speed
+    if (fTransport->FastModeOddParity()) {
+        result = TransferFirmware(rcxnub_odd, sizeof(rcxnub_odd), kNubStart, false);
+    }
+    else {
+        result = TransferFirmware(rcxnub, sizeof(rcxnub), kNubStart, false);
+    }
+    if (RCX_ERROR(result)) return result;
+
+    // switch to fast mode, and make sure the brick did too: if it
+    // still answers at the normal speed, the nub didn't take
+    fTransport->SetFastMode(true);
+    result = Send(cmd.MakePing());
+    if (RCX_ERROR(result)) {
+        fTransport->SetFastMode(false);
+        result = Send(cmd.MakePing());
+        if (RCX_ERROR(result)) return result;
+        fProfile.fFast = 0;
+    }
+    else {
+        fFastLoader = true;
+        fProfile.fFast = 1;
+    }
+    StoreProfile();
+
+    return kRCX_OK;
+}
+
+
+RCX_Result RCX_Link::TransferFirmware(RCX_Firmware &firmware)
+{
+    // the message sizes change as it goes, so there is no plan to keep
+    if (fAdaptiveChunkSize) {
+        return TransferFirmware(firmware.GetData(), firmware.GetLength(),
+            firmware.GetStart(), firmware.GetChecksum(), 0, true);
+    }
+
+    // the sizes only depend on the limits when the data gets scanned
+    bool scan = !fTransport->GetComplementData();
+    int chunk = FirmwareChunkSize();
+    int maxZeros = scan ? fMaxZeros : 0;
+    int maxOnes = scan ? fMaxOnes : 0;
+
+    // a copy, so other links can send the same firmware meanwhile;
+    // the first one to plan it shares the plan with the rest
+    std::vector<UShort> sizes;
+    if (!firmware.GetSizes(chunk, maxZeros, maxOnes, sizes)) {
+        PlanChunks(firmware.GetData(), firmware.GetLength(), chunk, !scan, sizes);
+        firmware.SetSizes(chunk, maxZeros, maxOnes, sizes);
+    }
+
+    return TransferFirmware(firmware.GetData(), firmware.GetLength(),
+        firmware.GetStart(), firmware.GetChecksum(), &sizes, true);
+}
+
+
+RCX_Result RCX_Link::TransferFirmware(const UByte *data, int length, int start, bool progress)
+{
+    return TransferFirmware(data, length, start,
+        Checksum(data, length < 0x4c00 ? length : 0x4c00), 0, progress);
+}
+
+
+RCX_Result RCX_Link::TransferFirmware(const UByte *data, int length, int start,
+    int check, std::vector<UShort> *sizes, bool progress)
+{
+    if (fTrace) fTrace->Add(RCX_Trace::kFirmwareEvent, length);
+    RCX_Cmd cmd;
+    RCX_Result result;
+
+    // Sync takes care of the Ping and any necessary unlock ops.
+    result = Sync();
+    if (RCX_ERROR(result)) return result;
+
+    // Delete the existing FW
+    result = Send(cmd.Set(kRCX_DeleteFirmware, 1, 3, 5, 7, 0xb));
+    if (RCX_ERROR(result)) return result;
+
+    // Transfer the FW
+    result = Send(cmd.Set(kRCX_BeginFirmwareOp,
+        (UByte)(start), (UByte)(start>>8), (UByte)check, (UByte)(check>>8), 0));
+    if (RCX_ERROR(result)) return result;
+
+    BeginProgress(progress ? length : 0);
+    result = fAdaptiveChunkSize ?
+        DownloadAdaptive(data, length, fRCXFirmwareChunkSize) :
+        Download(data, length, FirmwareChunkSize(), sizes);
+    if (RCX_ERROR(result)) return result;
+
+    // last packet is no-retry with an extra long delay
+    // this gives the RCX time to respond and makes sure response doesn't get trampled
     result = Send(cmd.MakeUnlock(), false, RCX_PipeTransport::kMaxTimeout);
-    PDEBUGVAR("result after unlock", result);
     if (fTransport->GetFastMode()) {
         return kRCX_OK;
     }
 
-    PDEBUGVAR("RCX_Link::TransferFirmware, result", result);
     return result;
 }
 
@@ -543,9 +1394,72 @@ const int nOnesDensity[256] = {
 
 #define max(x, y) ((x) > (y)) ? (x) : (y)
 
-int RCX_Link::AdjustChunkSize(const int n, const UByte *data, bool bComplement)
+// a sparse byte has fewer than 3 bits set
+#define IsSparse(b) (nOnesDensity[b] < 3)
+
+void RCX_Link::FindRuns(const UByte *data, int length, Runs &runs) const
+{
+    // For every position, where the next run that is too long begins.
+    // These are filled in with one pass from the end of the data, so
+    // a message only has to look up the runs past its own start.
+    const int kOnesPlusMinusScore = 3;
+    int zeros = 0;
+
+    runs.fNextZeros.resize(length + 1);
+    runs.fNextSparse.resize(length + 1);
+    runs.fNextZeros[length] = runs.fNextSparse[length] = Runs::kNone;
+
+    for (int i = length - 1; i >= 0; --i) {
+        zeros = data[i] ? 0 : zeros + 1;
+        runs.fNextZeros[i] = (zeros >= fMaxZeros) ? i : runs.fNextZeros[i+1];
+
+        // A sparse run starts at a sparse byte and goes on for fMaxOnes
+        // bytes, although a few dense bytes may be mixed in.
+        bool sparse = false;
+        if (IsSparse(data[i]) && length - i >= fMaxOnes) {
+            int nLotsOfOnes = 0;
+            int j;
+            for (j = 0; j < fMaxOnes; ++j) {
+                if (!IsSparse(data[i + j])) {
+                    if (++nLotsOfOnes > kOnesPlusMinusScore) break;
+                } else {
+                    nLotsOfOnes -= 2;
+                    nLotsOfOnes = max(0, nLotsOfOnes);
+                }
+            }
+            sparse = (j >= fMaxOnes);
+        }
+        runs.fNextSparse[i] = sparse ? i : runs.fNextSparse[i+1];
+    }
+}
+
+
+int RCX_Link::MessageSize(const Runs &runs, int start, int size) const
+{
+    // only runs that begin far enough from the end of the message count
+    int z = runs.fNextZeros[start];
+    if (z != Runs::kNone && z - start < size - fMaxZeros) {
+        // Too many consecutive zeros. Shorten the message size.
+        size = z - start + fMaxZeros;
+        if (fVerbose) printf("too many consecutive zeros (%d)\n", fMaxZeros);
+    }
+
+    int s = runs.fNextSparse[start];
+    if (s != Runs::kNone && s - start < size - fMaxOnes) {
+        // Too many consecutive sparse bytes. Shorten the message size.
+        size = max(s - start, fMaxOnes);
+        if (fVerbose) printf("too many consecutive sparse bytes (%d)\n", fMaxOnes);
+    }
+
+    return size;
+}
+
+
+void RCX_Link::PlanChunks(const UByte *data, int length, int chunk,
+    bool bComplement, std::vector<UShort> &sizes) const
 {
-    int size = n;
+    sizes.resize(0);
+
     //
     // Avoid long strings of zeroes -- fast downloading doesn't like it and messaging
     // can lose sync. Especially with short distances and transmitter set to long
@@ -553,88 +1467,137 @@ int RCX_Link::AdjustChunkSize(const int n, const UByte *data, bool bComplement)
     //
     // Only need this check when complement byte transmission is disabled
     //
-    if (!bComplement) {
-        const int kOnesPlusMinusScore = 3;
+    if (bComplement) {
+        for (int start = 0; start < length; start += chunk)
+            sizes.push_back((UShort)(length - start < chunk ? length - start : chunk));
+        return;
+    }
 
-        int i;
-        for (i = 0; i < (size - fMaxZeros); ++i) {
-            int j;
+    Runs runs;
+    FindRuns(data, length, runs);
 
-            UByte * p = (UByte*)data + i;
-            if (*p != 0) {
-                continue;
-            }
+    for (int start = 0; start < length; ) {
+        int size = MessageSize(runs, start,
+            length - start < chunk ? length - start : chunk);
+        sizes.push_back((UShort)size);
+        start += size;
+    }
+}
 
-            // Found a zero -- check to see how many consecutive
-            for (j = 0; j < fMaxZeros; ++j) {
-                UByte * q = (UByte*)data + i + j;
-                if (*q != 0) {
-                    break;
-                }
-            }
+RCX_Result RCX_Link::Download(const UByte *data, int length, int chunk,
+    std::vector<UShort> *sizes)
+{
+    RCX_Result result;
+    UShort seq;
+    int remain = length;
+    int n;
 
-            if (j >= fMaxZeros) {
-                // Too many consecutive zeros. Shorten the message size.
-                size = i + fMaxZeros;
-                if (fVerbose) printf("too many consecutive zeros (%d)\n", j);
-                break;
+    // sizes from an earlier transfer of the same data are used as is,
+    // otherwise they are all worked out before sending anything
+    std::vector<UShort> plan;
+    if (!sizes) sizes = &plan;
+    if (sizes->empty())
+        PlanChunks(data, length, chunk, fTransport->GetComplementData(), *sizes);
+
+    // frame every message before sending the first, so the next one
+    // can go out as soon as a reply arrives
+    RCX_Frames frames;
+    frames.Clear(fTransport->GetLastCommand());
+
+    seq = 1;
+    for (size_t step = 0; remain > 0; ++step) {
+        // Transfer the remaining bytes if what is left to send
+        // is less than the current chunk size.
+        if (remain <= chunk) {
+            // TODO: I have no clear idea what fProgramMode is for, but
+            // it is almost always true.
+            if (!gQuiet || fProgramMode) {
+                seq = 0;
             }
         }
 
-        for (i = 0; i < (size - fMaxOnes); ++i) {
-            int j;
-            ubyte aByte;
-            int nLotsOfOnes;
+        if (step >= sizes->size()) return kRCX_FormatError;
+        n = (*sizes)[step];
+        if (n > remain) return kRCX_FormatError;
 
-            aByte = *(data + i);
-            if (nOnesDensity[aByte] >= 3) {
-                continue;
-            }
+        // the message is the data between a 5 byte header and a checksum
+        if (n + 6 > (int)kMaxCmdLength) return kRCX_RequestError;
+        fTransport->FrameDownload(seq++, data, n, true, frames);
 
-            // Found a sparse byte -- check to see how many consecutive.
-            nLotsOfOnes = 0;
-            for (j = 0; j < fMaxOnes; ++j) {
-                aByte = *(data + i + j);
-                if (nOnesDensity[aByte] >= 3) {
-                    ++nLotsOfOnes;
-                    if (nLotsOfOnes > kOnesPlusMinusScore) {
-                        break;
-                    }
-                } else {
-                    nLotsOfOnes -= 2;
-                    nLotsOfOnes = max(0, nLotsOfOnes);
-                }
+        remain -= n;
+        data += n;
+    }
+
+    if (frames.GetCount() == 0) return kRCX_OK;
+    UByte op = kRCX_DownloadOp;
+
+    // a transport that queues messages gets as many at a time as it
+    // takes, and the progress is counted once they have all gone
+    int queue = fTransport->GetQueueLength();
+    std::vector<int> expected(queue, ExpectedReplyLength(&op, 1));
+    std::vector<RCX_Result> results(queue);
+    std::vector<UByte> replies;
+    UByte *rxData = fReply;
+    if (queue > 1) {
+        replies.resize(queue * kMaxReplyLength);
+        rxData = &replies[0];
+    }
+
+    for (int i = 0; i < frames.GetCount(); ) {
+        int count = frames.GetCount() - i;
+        if (count > queue) count = queue;
+
+        int sent = fTransport->SendFrames(frames, i, count, &expected[0],
+            rxData, kMaxReplyLength, &results[0], true, fDownloadWaitTime);
+
+        for (int j = 0; j < sent; ++j, ++i) {
+            n = (*sizes)[i];
+
+            result = fResult = results[j];
+            if (fTrace) {
+                fTrace->Add(RCX_Trace::kCommandEvent, op);
+                fTrace->Add(RCX_Trace::kResultEvent, result);
             }
+            if (RCX_ERROR(result))
+                return result;
 
-            if (j >= fMaxOnes) {
-                // Too many consecutive sparse bytes. Shorten the message size.
-                size = max(i, fMaxOnes);
-                if (fVerbose) printf("too many consecutive sparse bytes (%d)\n", j);
-                break;
+            if (!IncrementProgress(n)) {
+                return kRCX_AbortError;
             }
         }
     }
 
-    return size;
+    return kRCX_OK;
 }
 
-RCX_Result RCX_Link::Download(const UByte *data, int length, int chunk)
+
+/*
+ * Like Download(), except that the chunk size follows the link's error
+ * rate the way RCX_PipeTransport::AdjustTimeout() follows its reply
+ * times: each message that needs a retry halves the chunk size, and a
+ * run of kAdaptiveGrowRun messages that went through on the first try
+ * lets it grow again, up to maxChunk.
+ */
+RCX_Result RCX_Link::DownloadAdaptive(const UByte *data, int length, int maxChunk)
 {
-    PDEBUGVAR("RCX_Link::Download chunk", chunk);
     RCX_Cmd cmd;
     RCX_Result result;
-    UShort seq;
+    UShort seq = 1;
     int remain = length;
-    int n;
+    int minChunk = maxChunk < kMinAdaptiveChunk ? maxChunk : kMinAdaptiveChunk;
+    // start where the last download to the brick settled
+    int chunk = maxChunk;
+    if (fProfile.fChunk >= minChunk && fProfile.fChunk < maxChunk) chunk = fProfile.fChunk;
+    int clean = 0;
+    bool scan = !fTransport->GetComplementData();
+    Runs runs;
+
+    if (scan) FindRuns(data, length, runs);
 
-    seq = 1;
     while (remain > 0) {
-        // Transfer the remaining bytes if what is left to send
-        // is less than the current chunk size.
+        int n;
         if (remain <= chunk) {
-            // TODO: I have no clear idea what gProgramMode is for, but
-            // it is almost always true.
-            if (!gQuiet || gProgramMode) {
+            if (!gQuiet || fProgramMode) {
                 seq = 0;
             }
             n = remain;
@@ -643,17 +1606,31 @@ RCX_Result RCX_Link::Download(const UByte *data, int length, int chunk)
             n = chunk;
         }
 
-        n = AdjustChunkSize(n, data, fTransport->GetComplementData());
-        PDEBUGVAR("sending bytes", n);
-        if (fVerbose) {
-            // printf("sending %d bytes\n", n);
-        }
+        if (scan) n = MessageSize(runs, length - remain, n);
 
         result = Send(cmd.MakeDownload(seq++, data, (UShort)n),
             true, fDownloadWaitTime);
         if (RCX_ERROR(result))
             return result;
 
+        int newChunk = chunk;
+        if (fTransport->GetLastTries() > 1) {
+            // had to retry - send less at a time
+            newChunk = max(chunk / 2, minChunk);
+            clean = 0;
+        }
+        else if (++clean >= kAdaptiveGrowRun) {
+            // several in a row worked on the first try - send more
+            newChunk = chunk + chunk / 4 + 1;
+            if (newChunk > maxChunk) newChunk = maxChunk;
+            clean = 0;
+        }
+
+        if (newChunk != chunk) {
+            chunk = newChunk;
+            if (fVerbose) printf("chunk size now %d\n", chunk);
+        }
+
         remain -= n;
         data += n;
         if (!IncrementProgress(n)) {
@@ -661,6 +1638,8 @@ RCX_Result RCX_Link::Download(const UByte *data, int length, int chunk)
         }
     }
 
+    fProfile.fChunk = chunk;
+    StoreProfile();
     return kRCX_OK;
 }
 
@@ -681,15 +1660,144 @@ RCX_Result RCX_Link::Send(const UByte *data, int length, bool retry, int timeout
         return kRCX_RequestError;
     }
 
+    if (fTrace) fTrace->Add(RCX_Trace::kCommandEvent, data[0]);
+
     // TODO: why are we setting this property here?
     fResult = fTransport->Send(data, length, fReply, expected,
         kMaxReplyLength, retry, timeout);
+    NoteSent(data, length, fResult);
 
-    PDEBUGVAR("RCX_Link::Send fResult", fResult);
+    if (fTrace) fTrace->Add(RCX_Trace::kResultEvent, fResult);
     return fResult;
 }
 
 
+/*
+ * The IR link is half duplex and a brick doesn't listen while it
+ * replies, so the commands of a batch can't overlap.  What can be
+ * saved is the time between them: with every message framed ahead,
+ * each one goes out as soon as the last byte of the reply before it
+ * has come in.
+ */
+RCX_Result RCX_Link::Send(const RCX_Cmd *const *cmds, int count, RCX_Result *results,
+    vector<UByte> *replies, bool retry)
+{
+    RCX_Frames frames;
+    vector<int> expected(count);
+    int i;
+
+    frames.Clear(fTransport->GetLastCommand());
+    for (i=0; i<count; ++i) {
+        const RCX_Cmd *cmd = cmds[i];
+        expected[i] = ExpectedReplyLength(cmd->GetBody(), cmd->GetLength());
+        if (cmd->GetLength() > (int)kMaxCmdLength ||
+            expected[i] > (int)kMaxReplyLength) {
+            return kRCX_RequestError;
+        }
+        fTransport->Frame(cmd->GetBody(), cmd->GetLength(), retry, frames);
+    }
+
+    if (replies) replies->resize(0);
+
+    // a transport that queues messages is given as many at a time as it
+    // takes; those after one that failed go in the next queue
+    int queue = fTransport->GetQueueLength();
+    vector<UByte> queueReplies;
+    UByte *rxData = fReply;
+    if (queue > 1) {
+        queueReplies.resize(queue * kMaxReplyLength);
+        rxData = &queueReplies[0];
+    }
+
+    RCX_Result first = kRCX_OK;
+    bool stop = false;
+    for (i=0; i<count && !stop; ) {
+        int n = count - i < queue ? count - i : queue;
+        int sent = fTransport->SendFrames(frames, i, n, &expected[i],
+            rxData, kMaxReplyLength, &results[i], retry, 0);
+
+        for (int j=0; j<sent; ++j, ++i) {
+            RCX_Result result = fResult = results[i];
+            const UByte *reply = rxData + j * kMaxReplyLength;
+            if (fTrace) {
+                fTrace->Add(RCX_Trace::kCommandEvent, cmds[i]->GetBody()[0]);
+                fTrace->Add(RCX_Trace::kResultEvent, result);
+            }
+            NoteSent(cmds[i]->GetBody(), cmds[i]->GetLength(), result);
+
+            if (RCX_ERROR(result)) {
+                if (!RCX_ERROR(first)) first = result;
+                // not even an echo, so the tower isn't working
+                if (result == kRCX_IREchoError) stop = true;
+            }
+            else if (replies)
+                replies->insert(replies->end(), reply + 1, reply + 1 + result);
+        }
+    }
+
+    for (; i<count; ++i)
+        results[i] = first;
+
+    return first;
+}
+
+
+RCX_Result RCX_Link::Stream(const RCX_Cmd *const *cmds, int count, RCX_Result *results)
+{
+    RCX_Frames frames;
+    vector<int> expected(count);
+    int i;
+
+    // framed as for a retry, so that the same command twice in a row
+    // isn't taken for a repeat and ignored
+    frames.Clear(fTransport->GetLastCommand());
+    for (i=0; i<count; ++i) {
+        const RCX_Cmd *cmd = cmds[i];
+        if (cmd->GetLength() > (int)kMaxCmdLength) return kRCX_RequestError;
+
+        switch (cmd->GetBody()[0] & 0xf7) {
+            // the brick doesn't answer these, though Send() waits anyway
+            case kRCX_Message:
+            case kRCX_Remote:
+                expected[i] = 0;
+                break;
+            default:
+                expected[i] = ExpectedReplyLength(cmd->GetBody(), cmd->GetLength());
+                if (expected[i] > (int)kMaxReplyLength) return kRCX_RequestError;
+                break;
+        }
+        fTransport->Frame(cmd->GetBody(), cmd->GetLength(), true, frames);
+    }
+
+    vector<UByte> replies(count * kMaxReplyLength);
+    RCX_Result first = kRCX_OK;
+    for (i=0; i<count; ) {
+        int sent = fTransport->SendFrames(frames, i, count - i, &expected[i],
+            &replies[0], kMaxReplyLength, &results[i], false, 0);
+
+        for (int j=0; j<sent; ++j, ++i) {
+            if (fTrace) {
+                fTrace->Add(RCX_Trace::kCommandEvent, cmds[i]->GetBody()[0]);
+                fTrace->Add(RCX_Trace::kResultEvent, results[i]);
+            }
+            NoteSent(cmds[i]->GetBody(), cmds[i]->GetLength(), results[i]);
+
+            if (RCX_ERROR(results[i])) {
+                if (!RCX_ERROR(first)) first = results[i];
+                // not even an echo, so the tower isn't working
+                if (results[i] == kRCX_IREchoError) {
+                    for (++i; i<count; ++i)
+                        results[i] = first;
+                    return first;
+                }
+            }
+        }
+    }
+
+    return first;
+}
+
+
 RCX_Result RCX_Link::GetReply(UByte *data, int maxLength)
 {
     if (fResult < 0) return fResult;
@@ -703,7 +1811,6 @@ RCX_Result RCX_Link::GetReply(UByte *data, int maxLength)
         *data++ = *src++;
     }
 
-    PDEBUGVAR("length on exit from RCX_Link::GetReply", length);
     return length;
 }
 
@@ -712,12 +1819,33 @@ void RCX_Link::BeginProgress(int total)
 {
     fDownloadTotal = total;
     fDownloadSoFar = 0;
+    fProgressTime = fStats ? RCX_LinkStats::Now() : 0;
+    fProgressStart = RCX_LinkStats::Now();
+    fProgressRetries = fTransport ? fTransport->GetRetries() : 0;
+}
+
+
+double RCX_Link::GetProgressTime() const
+{
+    return RCX_LinkStats::Now() - fProgressStart;
+}
+
+
+long RCX_Link::GetProgressRetries() const
+{
+    return (fTransport ? fTransport->GetRetries() : 0) - fProgressRetries;
 }
 
 
 bool RCX_Link::IncrementProgress(int delta)
 {
     fDownloadSoFar += delta;
+    if (fStats && fProgressTime > 0) {
+        double now = RCX_LinkStats::Now();
+        fStats->AddDownload(delta, now - fProgressTime);
+        fProgressTime = now;
+    }
+
     return fDownloadTotal ?
         DownloadProgress(fDownloadSoFar, fDownloadTotal, delta) : true;
 }
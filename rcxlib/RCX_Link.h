@@ -39,8 +39,22 @@
 #include "RCX_Transport.h"
 #endif
 
+#ifndef __RCX_BrickProfiles_h
+#include "RCX_BrickProfiles.h"
+#endif
+
+#include <vector>
+#include <string>
+#include <climits>
+
 class RCX_Cmd;
 class RCX_Image;
+class RCX_Bundle;
+class RCX_DownloadHistory;
+class RCX_LinkStats;
+class RCX_Trace;
+class RCX_TimeoutHistory;
+class RCX_Firmware;
 
 class RCX_Link
 {
@@ -61,11 +75,35 @@ public:
         ULong options=0);
     void Close();
 
+    /// the port Open() uses for portName: itself if given, or else the
+    /// one named by RCX_PORT, a device.conf file or the default
+    static std::string FindPortName(const char *portName);
+
+    RCX_TargetType GetTarget() const { return fTarget; }
+    /// the port the link was last opened on (as found if none was given)
+    const std::string& GetPortName() const { return fPortName; }
+    /// the transport's reply timeout, or 0 if it isn't open or has none
+    int GetRxTimeout() const { return fTransport ? fTransport->GetRxTimeout() : 0; }
+
     RCX_Result Sync();
 
     RCX_Result Send(const RCX_Cmd *cmd, bool retry=true, int timeout=0);
     RCX_Result Send(const UByte *data, int length, bool retry=true,
         int timeout=0);
+    /// Send count commands one after the other, all framed before the
+    /// first goes out.  results gets each command's result and replies
+    /// (if not null) their reply data, one after another.  Returns the
+    /// first error, if any; the other commands are still sent.
+    RCX_Result Send(const RCX_Cmd *const *cmds, int count, RCX_Result *results,
+        std::vector<UByte> *replies = 0, bool retry=true);
+
+    /// Send count commands that are each overtaken by the next one of
+    /// their kind (the message, a variable being set...), so that losing
+    /// one does no harm: each is tried once, and only the ones the brick
+    /// answers are waited for.  Runs of unanswered commands (messages,
+    /// remote commands) go out together.  results gets each command's
+    /// result.  Returns the first error, if any.
+    RCX_Result Stream(const RCX_Cmd *const *cmds, int count, RCX_Result *results);
 
     /**
      * Only looks at the reply data - the
@@ -82,14 +120,49 @@ public:
     UByte GetReplyByte(int index) const { return fReply[index + 1]; }
 
     RCX_Result Download(const RCX_Image &image, int programNumber);
+    /// stop all tasks, unless they are known to be stopped already
+    RCX_Result StopAll();
+    /// select program (counting from 0), unless it's known to be selected
+    RCX_Result SelectProgram(int program);
+    /// download each program of a bundle into its slot, syncing only once
+    RCX_Result Download(const RCX_Bundle &bundle);
     RCX_Result DownloadFirmware(const UByte *data, int length, int start,
         bool fast);
+    /// the message sizes are recorded in (or taken from) the firmware's
+    /// plan for the current settings
+    RCX_Result DownloadFirmware(RCX_Firmware &firmware, bool fast);
+
+    /// Check that the brick in range has the tasks and subs of an image
+    /// in the given program (0 for the current one) by reading back the
+    /// end of each.  Returns 1 if it does, 0 if not (or it can't tell).
+    RCX_Result Verify(const RCX_Image &image, int programNumber);
+    /// Like Verify(), but reads back all of each task and sub, and sends
+    /// again only the ones that differ.  Returns 1 if the brick has the
+    /// image now, 0 if it can't be checked this way.
+    RCX_Result Repair(const RCX_Image &image, int programNumber);
 
     virtual bool DownloadProgress(int soFar, int total, int chunkSize);
 
+    /// Start timing a transfer of total bytes (or datalog entries) that
+    /// is reported to DownloadProgress(), 0 if it isn't.  Downloads call
+    /// this themselves.
+    void BeginProgress(int total);
+    /// milliseconds since BeginProgress()
+    double GetProgressTime() const;
+    /// transmissions repeated since BeginProgress()
+    long GetProgressRetries() const;
+
+    /// The size of each message used to send data in chunks of at most
+    /// chunk bytes.  Without complemented bytes the messages also end
+    /// before long runs of zeros or sparse bytes.
+    void PlanChunks(const UByte *data, int length, int chunk,
+        bool bComplement, std::vector<UShort> &sizes) const;
+
     RCX_Result GetVersion(ULong &rom, ULong &ram);
     RCX_Result GetBatteryLevel();
     RCX_Result GetValue(RCX_Value value);
+    /// read several values at once, results gets each value (or error)
+    RCX_Result GetValues(const RCX_Value *values, int count, RCX_Result *results);
 
     /// This function should only be called after Sync() has been called.
     /// It can be used to determine if an kRCX_ReplyError error was due
@@ -110,29 +183,147 @@ public:
     void SetDownloadWaitTime(int value) {
         fDownloadWaitTime = value;
     }
+    /// When adaptive, firmware messages get smaller each time one has to
+    /// be retried, and grow back (up to the firmware chunk size) after a
+    /// run of messages that went through on the first try
+    void SetAdaptiveChunkSize(bool value) {
+        fAdaptiveChunkSize = value;
+    }
+    /// With a history, program downloads only send the tasks and subs
+    /// that changed since the last download to the same brick (on
+    /// targets that can replace them one at a time)
+    void SetDownloadHistory(RCX_DownloadHistory *history) {
+        fHistory = history;
+    }
+    /// With stats, the transport times every packet and counts its
+    /// tries (see RCX_LinkStats)
+    void SetStats(RCX_LinkStats *stats) {
+        fStats = stats;
+        if (fTransport) fTransport->SetStats(stats);
+    }
+    /// With a trace, the link and its transport note each command, try,
+    /// read and timeout change there (see RCX_Trace)
+    void SetTrace(RCX_Trace *trace) {
+        fTrace = trace;
+        if (fTransport) fTransport->SetTrace(trace);
+    }
+    /// how the reply timeout follows the replies, from the next Open()
+    void SetTimeoutPolicy(RCX_Transport::TimeoutPolicy policy) {
+        fTimeoutPolicy = policy;
+    }
+    /// With timeouts, Open() starts from the reply timeout the port
+    /// had when it was last closed (unless the options give one)
+    void SetTimeoutHistory(RCX_TimeoutHistory *timeouts) {
+        fTimeouts = timeouts;
+    }
+    /// With profiles, Open() starts from what the port's profile knows
+    /// of the brick (reply timeout, firmware message size, fast mode),
+    /// the first Sync() checks the brick's versions, and what the link
+    /// learns is kept there for the next time
+    void SetBrickProfiles(RCX_BrickProfiles *profiles) {
+        fProfiles = profiles;
+    }
+    /// When repeat is set, program downloads go to every brick in range:
+    /// each message is sent repeat times and no replies are waited for
+    /// (nor could they be told apart).  Verify() each brick afterwards.
+    void SetBroadcast(int repeat) {
+        fBroadcast = repeat;
+    }
+    /// When set, downloading a program (rather than a bundle) starts its
+    /// main task, as soon as the chunks it needs are sent on the targets
+    /// that take the rest while it runs (see RCX_Image::GetStartChunks())
+    void SetStartMain(bool value) {
+        fStartMain = value;
+    }
+    /// take the chunk sizes, wait time, header, broadcast and timeout policy
+    /// settings of another link (but not its histories, stats or trace)
+    void CopySettings(const RCX_Link &link);
 
 private:
-    RCX_Result DownloadByChunk(const RCX_Image &image, int programNumber);
+    /*
+     * What the commands sent since the link was opened say about the
+     * brick, so that downloads can leave out commands that wouldn't
+     * change anything.  It's forgotten when a command fails, when one
+     * is sent that may change it in ways not followed here, after a
+     * broadcast, and after a quiet spell long enough for the brick to
+     * have been switched off and on.
+     */
+    struct Session {
+        bool fTasksStopped;
+        int fProgram;       // selected program, -1 if not known
+        double fLastTime;   // when a command last went through
+
+        void Clear() { fTasksStopped = false; fProgram = -1; }
+    };
+
+    void NoteSent(const UByte *data, int length, RCX_Result result);
+    void ExpireSession();
+
+    void ProbeBrick();
+    void StoreProfile();
+    int FirmwareChunkSize() const;
+
+    RCX_Result DownloadByChunk(const RCX_Image &image, int programNumber,
+        bool start=false);
+    RCX_Result StartMain();
+    RCX_Result DownloadBroadcast(const RCX_Image &image, int programNumber);
+    RCX_Result Broadcast(const RCX_Cmd *cmd);
     RCX_Result DownloadSpybotics(const RCX_Image &image);
+    bool CanReplaceChunks(const RCX_Image &image) const;
+    RCX_Result DownloadChanged(const RCX_Image &image, int programNumber);
+    RCX_Result ReadProgramMap(int programNumber, int &slot, std::vector<UByte> &map);
+    static int MapIndex(int slot, RCX_ChunkType type, int number);
+    RCX_Result CompareMemory(int address, const UByte *data, int length);
+    RCX_Result GetBrickName(int programNumber, std::string &name);
+    RCX_Result GetMemoryMap(std::vector<UByte> &memoryMap);
     RCX_Result DownloadChunk(RCX_ChunkType type, UByte taskNumber,
         const UByte *data, int length, int total=0);
     RCX_Result TransferFirmware(const UByte *data, int length, int start,
         bool progress);
-    RCX_Result Download(const UByte *data, int length, int chunk);
+    RCX_Result StartFastLoader();
+    RCX_Result TransferFirmware(RCX_Firmware &firmware);
+    RCX_Result TransferFirmware(const UByte *data, int length, int start,
+        int check, std::vector<UShort> *sizes, bool progress);
+    RCX_Result Download(const UByte *data, int length, int chunk,
+        std::vector<UShort> *sizes=0);
+    RCX_Result DownloadAdaptive(const UByte *data, int length, int maxChunk);
 
     int ExpectedReplyLength(const UByte *data, int length);
-    int AdjustChunkSize(const int n, const UByte *data, bool bComplement);
-    void BeginProgress(int total);
+    // where the long runs of zeros and sparse bytes begin
+    struct Runs {
+        enum { kNone = INT_MAX };
+        std::vector<int> fNextZeros;
+        std::vector<int> fNextSparse;
+    };
+    void FindRuns(const UByte *data, int length, Runs &runs) const;
+    int MessageSize(const Runs &runs, int start, int size) const;
+
     bool IncrementProgress(int delta);
 
     RCX_Transport* fTransport;
     bool fSynced;
+    bool fFastLoader;       // the nub is running on the brick, as far as we know
+    Session fSession;
     RCX_TargetType fTarget;
     bool fOmitHeader;
     int fRCXProgramChunkSize;
     int fRCXFirmwareChunkSize;
     int fDownloadWaitTime;
+    bool fAdaptiveChunkSize;
     bool fVerbose;
+    RCX_DownloadHistory* fHistory;
+    RCX_LinkStats* fStats;
+    RCX_Trace* fTrace;
+    RCX_Transport::TimeoutPolicy fTimeoutPolicy;
+    RCX_TimeoutHistory* fTimeouts;
+    RCX_BrickProfiles* fProfiles;
+    RCX_BrickProfiles::Profile fProfile;    // of the brick on the open port
+    bool fProbed;           // the brick has answered since the link was opened
+    std::string fPortName;
+    bool fUSB;
+    bool fProgramMode;      // set while sending a program
+    int fBroadcast;         // copies of each broadcast message, 0 if not broadcasting
+    bool fStartMain;
 
     RCX_Result fResult;
     UByte fReply[kMaxReplyLength];  // includes command and data
@@ -140,6 +331,9 @@ private:
     // new fields to track download progress;
     int fDownloadTotal;
     int fDownloadSoFar;
+    double fProgressTime;   // when the download last moved on, for the stats
+    double fProgressStart;
+    long fProgressRetries;  // the transport's, when the download began
 
     // Fields to control how we adjust for large runs of zeros and sparse bytes
     int fMaxOnes;
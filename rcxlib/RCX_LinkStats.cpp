@@ -0,0 +1,171 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include "RCX_LinkStats.h"
+
+#include <cstring>
+
+#if __cplusplus >= 201103L
+#include <chrono>
+#else
+#include <ctime>
+#endif
+
+using std::fprintf;
+using std::fputs;
+using std::memset;
+
+static const char *sTimingNames[] = {
+    "transmit",
+    "first_byte",
+    "reply"
+};
+
+static const char *sBucketNames[] = {
+    "<1", "1", "2", "4", "8", "16", "32", "64", "128", "256", "512", "1024", "2048+"
+};
+
+
+RCX_LinkStats::RCX_LinkStats()
+{
+    Reset();
+}
+
+
+void RCX_LinkStats::Reset()
+{
+    memset(fTimes, 0, sizeof(fTimes));
+    memset(fTries, 0, sizeof(fTries));
+    fFailed = 0;
+    fTimeoutUps = 0;
+    fTimeoutDowns = 0;
+    fTimeoutFirst = 0;
+    fTimeoutLast = 0;
+    fTimeoutMin = 0;
+    fTimeoutMax = 0;
+    fDownloadBytes = 0;
+    fDownloadTime = 0;
+}
+
+
+double RCX_LinkStats::Now()
+{
+#if __cplusplus >= 201103L
+    return std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#else
+    return (double)std::time(0) * 1000;
+#endif
+}
+
+
+void RCX_LinkStats::AddTime(Timing t, double ms)
+{
+    Histogram &h = fTimes[t];
+    int bucket = 0;
+
+    if (ms < 0) ms = 0;
+    for(double limit = 1; bucket < kBucketCount-1 && ms >= limit; limit *= 2)
+        ++bucket;
+
+    if (h.fCount == 0 || ms < h.fMin) h.fMin = ms;
+    if (h.fCount == 0 || ms > h.fMax) h.fMax = ms;
+    h.fCount++;
+    h.fSum += ms;
+    h.fBuckets[bucket]++;
+}
+
+
+void RCX_LinkStats::AddPacket(int tries, bool ok)
+{
+    if (!ok) {
+        fFailed++;
+        return;
+    }
+
+    if (tries < 1) tries = 1;
+    if (tries > kMaxTries) tries = kMaxTries;
+    fTries[tries-1]++;
+}
+
+
+void RCX_LinkStats::AddTimeout(int ms)
+{
+    if (fTimeoutFirst == 0) {
+        fTimeoutFirst = ms;
+        fTimeoutMin = ms;
+        fTimeoutMax = ms;
+    }
+    if (ms < fTimeoutMin) fTimeoutMin = ms;
+    if (ms > fTimeoutMax) fTimeoutMax = ms;
+    fTimeoutLast = ms;
+}
+
+
+long RCX_LinkStats::GetPackets() const
+{
+    long n = fFailed;
+
+    for(int i=0; i<kMaxTries; ++i)
+        n += fTries[i];
+    return n;
+}
+
+
+long RCX_LinkStats::GetRetries() const
+{
+    long n = 0;
+
+    for(int i=1; i<kMaxTries; ++i)
+        n += i * fTries[i];
+    return n;
+}
+
+
+void RCX_LinkStats::Print(FILE *fp) const
+{
+    int i, b;
+
+    fprintf(fp, "# Link stats for %ld packets\n", GetPackets());
+    fprintf(fp, "%-12s %8s %9s %9s %9s ms\n", "", "count", "min", "avg", "max");
+    for(i=0; i<kTimingCount; ++i) {
+        const Histogram &h = fTimes[i];
+        fprintf(fp, "%-12s %8ld %9.1f %9.1f %9.1f\n", sTimingNames[i], h.fCount,
+            h.fMin, h.fCount ? h.fSum / h.fCount : 0.0, h.fMax);
+    }
+
+    fprintf(fp, "%-12s", "ms");
+    for(b=0; b<kBucketCount; ++b)
+        fprintf(fp, " %6s", sBucketNames[b]);
+    fputs("\n", fp);
+    for(i=0; i<kTimingCount; ++i) {
+        fprintf(fp, "%-12s", sTimingNames[i]);
+        for(b=0; b<kBucketCount; ++b)
+            fprintf(fp, " %6ld", fTimes[i].fBuckets[b]);
+        fputs("\n", fp);
+    }
+
+    fprintf(fp, "%-12s", "tries");
+    for(i=0; i<kMaxTries; ++i) {
+        if (fTries[i]) fprintf(fp, " %d:%ld", i+1, fTries[i]);
+    }
+    fprintf(fp, " failed:%ld\n", fFailed);
+
+    fprintf(fp, "%-12s start %d, now %d, range %d-%d ms, %ld down, %ld up\n", "timeout",
+        fTimeoutFirst, fTimeoutLast, fTimeoutMin, fTimeoutMax, fTimeoutDowns, fTimeoutUps);
+
+    if (fDownloadBytes) {
+        fprintf(fp, "%-12s %ld bytes in %.1f ms, %.1f bytes/s\n", "download", fDownloadBytes,
+            fDownloadTime, fDownloadTime > 0 ? fDownloadBytes * 1000 / fDownloadTime : 0.0);
+    }
+}
@@ -0,0 +1,92 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __RCX_LinkStats_h
+#define __RCX_LinkStats_h
+
+#include <cstdio>
+
+using std::FILE;
+
+/**
+ * Timings of the packets a transport sends, kept in histograms with
+ * power of two millisecond buckets, along with how many tries each
+ * packet took, how the dynamic reply timeout moved and how fast
+ * downloads went.  It's meant
+ * for tuning the timeouts, so only the transport's own hot path adds
+ * to it, and only if a link has been given one (see RCX_Link::SetStats()).
+ */
+class RCX_LinkStats
+{
+public:
+    enum Timing {
+        kTxTiming = 0,      ///< writing a packet to the pipe
+        kFirstByteTiming,   ///< from the end of the write to the first byte of the reply
+        kReplyTiming,       ///< from the end of the write to the complete reply
+        kTimingCount
+    };
+
+    enum {
+        kBucketCount = 13,  ///< <1, 1, 2-3, 4-7, ... 1024-2047, 2048+ ms
+        kMaxTries = 8
+    };
+
+            RCX_LinkStats();
+
+    void    Reset();
+
+    /// milliseconds on a clock that only moves forward
+    static double   Now();
+
+    void    AddTime(Timing t, double ms);
+    /// a packet that went through after tries transmissions, or didn't
+    void    AddPacket(int tries, bool ok);
+    /// the dynamic reply timeout a try waited with
+    void    AddTimeout(int ms);
+    /// the dynamic timeout moved up or down after a reply
+    void    AddAdjustment(bool up)  { ++(up ? fTimeoutUps : fTimeoutDowns); }
+    /// bytes of a download that took ms to go through
+    void    AddDownload(int bytes, double ms) { fDownloadBytes += bytes; fDownloadTime += ms; }
+
+    long    GetPackets() const;
+    long    GetFailed() const   { return fFailed; }
+    /// transmissions beyond the first of the packets that went through
+    long    GetRetries() const;
+    long    GetDownloadBytes() const    { return fDownloadBytes; }
+    double  GetDownloadTime() const     { return fDownloadTime; }
+
+    void    Print(FILE *fp) const;
+
+private:
+    struct Histogram {
+        long    fCount;
+        double  fSum;
+        double  fMin;
+        double  fMax;
+        long    fBuckets[kBucketCount];
+    };
+
+    Histogram   fTimes[kTimingCount];
+    long        fTries[kMaxTries];  // packets that took 1, 2, ... tries
+    long        fFailed;            // packets that never got a reply
+    long        fTimeoutUps;
+    long        fTimeoutDowns;
+    int         fTimeoutFirst;
+    int         fTimeoutLast;
+    int         fTimeoutMin;
+    int         fTimeoutMax;
+    long        fDownloadBytes;
+    double      fDownloadTime;
+};
+
+#endif
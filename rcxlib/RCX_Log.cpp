@@ -21,11 +21,15 @@
 using std::sprintf;
 using std::strlen;
 
+// fewest entries asked for at a time before giving up
 #define kPointsPerUpload	10
+// uploads in a row that have to go through before asking for more
+#define kGrowRun			4
 
 RCX_Log::RCX_Log()
 {
 	fLength = 0;
+	fUploaded = 0;
 	fData = nil;
 	fTypes = nil;
 }
@@ -56,16 +60,44 @@ void RCX_Log::SetLength(int length)
 	}
 
 	fLength = length;
+	fUploaded = 0;
 }
 
 
-RCX_Result RCX_Log::Upload(RCX_Link *link)
+int RCX_Log::GetMaxPoints(RCX_TargetType target)
+{
+	switch(target) {
+		case kRCX_RCXTarget:
+		case kRCX_RCX2Target:
+		case kRCX_SwanTarget:
+			// as many as fit in a reply (3 bytes each, after the command)
+			return (RCX_Link::kMaxReplyLength - 1) / 3;
+		default:
+			return 0;
+	}
+}
+
+
+/*
+ * Entries are asked for as many at a time as the target allows.  A
+ * reply that doesn't make it halves the number (a long reply is more
+ * likely to be garbled), down to kPointsPerUpload; after a run of
+ * kGrowRun replies that did, it doubles again, but stays below the
+ * size that failed.
+ */
+RCX_Result RCX_Log::Upload(RCX_Link *link, bool resume)
 {
 	RCX_Result result;
 	RCX_Cmd cmd;
 	int length;
 	int i;
 	int pos, n;
+	int points = GetMaxPoints(link->GetTarget());
+	int run = 0;
+
+	// other targets are asked for kPointsPerUpload at a time, as always
+	if (points == 0) points = kPointsPerUpload;
+	int limit = points;
 
 	link->Sync();
 
@@ -76,18 +108,34 @@ RCX_Result RCX_Log::Upload(RCX_Link *link)
 
 	// figure out length of data (don't include the length entry itself)
 	length = (link->GetReplyByte(1) + (link->GetReplyByte(2) << 8)) - 1;
-	SetLength(length);
+	if (!resume || length != fLength)
+		SetLength(length);
+	link->BeginProgress(length);
 
-	for (pos = 0; pos<length; ) {
+	for (pos = fUploaded; pos<length; ) {
 		// how many points to upload
 		n = length - pos;
-		if (n > kPointsPerUpload)
-			n = kPointsPerUpload;
+		if (n > points)
+			n = points;
 
 		// upload the data itself
 		result = link->Send(cmd.MakeUploadDatalog(pos+1, n));
-		if (result < 0) return result;
-		if (result != n * 3) return kRCX_ReplyError;
+		if (result != n * 3) {
+			if (n > kPointsPerUpload) {
+				limit = n - 1;
+				points = n / 2;
+				if (points < kPointsPerUpload) points = kPointsPerUpload;
+				run = 0;
+				continue;
+			}
+			return (result < 0) ? result : kRCX_ReplyError;
+		}
+
+		if (++run == kGrowRun && points < limit) {
+			points *= 2;
+			if (points > limit) points = limit;
+			run = 0;
+		}
 
 		// copy data into log
 		for (i=0; i<n; i++) {
@@ -97,6 +145,7 @@ RCX_Result RCX_Log::Upload(RCX_Link *link)
 		}
 
 		pos += n;
+		fUploaded = pos;
 		if (!link->DownloadProgress(pos, length, n)) break;
 	}
 
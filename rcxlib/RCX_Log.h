@@ -22,6 +22,10 @@
 #include "PTypes.h"
 #endif
 
+#ifndef __RCX_Target_h
+#include "RCX_Target.h"
+#endif
+
 
 class RCX_Link;
 
@@ -31,17 +35,28 @@ public:
 				RCX_Log();
 				~RCX_Log();
 
-	RCX_Result	Upload(RCX_Link *link);
+	/// With resume, an upload that failed part way carries on where it
+	/// stopped, as long as the brick's datalog is still the same length.
+	RCX_Result	Upload(RCX_Link *link, bool resume = false);
+	/// entries uploaded so far
+	int			GetUploaded() const	{ return fUploaded; }
+
+	/// the most entries a target is asked for at a time (0 if it only
+	/// gets the fixed size requests)
+	static int	GetMaxPoints(RCX_TargetType target);
 
 	void		SetLength(int length);
 
 	int			GetLength() const	{ return fLength; }
 	UByte		GetType(int index) const	{ return fTypes[index]; }
 	short		GetData(int index) const	{ return fData[index]; }
+	/// for a log read back from a store, after SetLength()
+	void		SetEntry(int index, UByte type, short data)	{ fTypes[index] = type; fData[index] = data; }
 	void		SPrintEntry(char *buf, int index, bool verbose) const;
 
 private:
 	int			fLength;
+	int			fUploaded;
 	UByte*		fTypes;
 	short*		fData;
 };
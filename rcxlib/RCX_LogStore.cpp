@@ -0,0 +1,174 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include <cstring>
+#include <vector>
+#include "RCX_LogStore.h"
+#include "RCX_Log.h"
+
+#include "rcxifile.h"
+
+using std::fopen;
+using std::memchr;
+using std::vector;
+
+#define kStoreHeaderSize    8
+#define kRecordHeaderSize   12
+
+// from RCX_Image.cpp
+void Write4(ULong d, FILE *fp);
+void Write2(UShort d, FILE *fp);
+
+static ULong Get4(const UByte *ptr);
+static UShort Get2(const UByte *ptr);
+static void WritePadding(int length, FILE *fp);
+
+
+RCX_Result RCX_LogStore::Append(const char *filename, const string &port,
+    ULong time, const RCX_Log &log)
+{
+    FILE *fp = fopen(filename, "a+b");
+    if (!fp) return kRCX_FileError;
+
+    // a new store gets a header, an old one has to have one
+    fseek(fp, 0, SEEK_END);
+    if (ftell(fp) == 0) {
+        Write4(kRCXL_Signature, fp);
+        Write2(kRCXL_CurrentVersion, fp);
+        Write2(0, fp);
+    }
+    else {
+        UByte header[kStoreHeaderSize];
+        fseek(fp, 0, SEEK_SET);
+        if (fread(header, 1, kStoreHeaderSize, fp) != kStoreHeaderSize ||
+            Get4(header) != kRCXL_Signature) {
+            fclose(fp);
+            return kRCX_FormatError;
+        }
+        fseek(fp, 0, SEEK_END);
+    }
+
+    int count = log.GetLength();
+    int portLength = port.size() + 1;
+    int i;
+
+    Write4(time, fp);
+    Write2((UShort)portLength, fp);
+    Write2(0, fp);
+    Write4((ULong)count, fp);
+
+    fwrite(port.c_str(), (size_t)portLength, 1, fp);
+    WritePadding(portLength, fp);
+
+    for(i=0; i<count; ++i)
+        putc(log.GetType(i), fp);
+    WritePadding(count, fp);
+
+    for(i=0; i<count; ++i)
+        Write2((UShort)log.GetData(i), fp);
+    WritePadding(count * 2, fp);
+
+    bool ok = !ferror(fp);
+    if (fclose(fp) != 0) ok = false;
+    return ok ? kRCX_OK : kRCX_FileError;
+}
+
+
+RCX_Result RCX_LogStore::Open(const char *filename)
+{
+    Close();
+
+    fFile = fopen(filename, "rb");
+    if (!fFile) return kRCX_FileError;
+
+    UByte header[kStoreHeaderSize];
+    if (fread(header, 1, kStoreHeaderSize, fFile) != kStoreHeaderSize ||
+        Get4(header) != kRCXL_Signature ||
+        Get2(header + 4) > kRCXL_CurrentVersion) {
+        Close();
+        return kRCX_FormatError;
+    }
+
+    return kRCX_OK;
+}
+
+
+void RCX_LogStore::Close()
+{
+    if (fFile) {
+        fclose(fFile);
+        fFile = 0;
+    }
+}
+
+
+RCX_Result RCX_LogStore::Next(string &port, ULong &time, RCX_Log &log)
+{
+    if (!fFile) return kRCX_FileError;
+
+    UByte header[kRecordHeaderSize];
+    size_t n = fread(header, 1, kRecordHeaderSize, fFile);
+    if (n == 0) return 0;
+    if (n != kRecordHeaderSize) return kRCX_FormatError;
+
+    time = Get4(header);
+    int portLength = Get2(header + 4);
+    ULong count = Get4(header + 8);
+
+    // the record, after its header
+    long length = RCXI_PADDED_LENGTH(portLength) + RCXI_PADDED_LENGTH(count) +
+        RCXI_PADDED_LENGTH(count * 2);
+    if (count > 0xffff || length <= 0) return kRCX_FormatError;
+
+    vector<UByte> data(length);
+    if (fread(&data[0], 1, length, fFile) != (size_t)length)
+        return kRCX_FormatError;
+
+    const UByte *ptr = &data[0];
+    const char *name = (const char *)ptr;
+    const char *nul = (const char *)memchr(name, 0, portLength);
+    port.assign(name, nul ? nul - name : portLength);
+    ptr += RCXI_PADDED_LENGTH(portLength);
+
+    const UByte *types = ptr;
+    const UByte *values = ptr + RCXI_PADDED_LENGTH(count);
+
+    log.SetLength((int)count);
+    for(ULong i=0; i<count; ++i)
+        log.SetEntry((int)i, types[i], (short)Get2(values + 2 * i));
+
+    return 1;
+}
+
+
+void WritePadding(int length, FILE *fp)
+{
+    long zeros = 0;
+    int pad = RCXI_PAD_BYTES(length);
+
+    if (pad)
+        fwrite(&zeros, (size_t)pad, 1, fp);
+}
+
+
+ULong Get4(const UByte *ptr)
+{
+    return (ULong)ptr[0] + ((ULong)ptr[1] << 8) +
+        ((ULong)ptr[2] << 16) + ((ULong)ptr[3] << 24);
+}
+
+
+UShort Get2(const UByte *ptr)
+{
+    return (UShort)(ptr[0] + (ptr[1] << 8));
+}
@@ -0,0 +1,61 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __RCX_LogStore_h
+#define __RCX_LogStore_h
+
+#ifndef __RCX_Result_h
+#include "RCX_Result.h"
+#endif
+
+#ifndef __PTypes_h
+#include "PTypes.h"
+#endif
+
+#include <cstdio>
+#include <string>
+
+using std::FILE;
+using std::string;
+
+class RCX_Log;
+
+/**
+ * A file of uploaded datalogs, each kept with the port it came from and
+ * when, that grows as more are appended (see rcxifile.h for the format).
+ * A log is stored by column, the types and then the values, so a
+ * store can be read without going through it entry by entry.
+ */
+class RCX_LogStore
+{
+public:
+            RCX_LogStore() : fFile(0) {}
+            ~RCX_LogStore()     { Close(); }
+
+    /// add log, uploaded from the brick on port at time (seconds since
+    /// 1970), to the end of the store, which is created if need be
+    static RCX_Result   Append(const char *filename, const string &port,
+                            ULong time, const RCX_Log &log);
+
+    /// start reading the records of a store
+    RCX_Result  Open(const char *filename);
+    void        Close();
+    /// read the next record: 1 if there was one, 0 at the end of the
+    /// store, or an error
+    RCX_Result  Next(string &port, ULong &time, RCX_Log &log);
+
+private:
+    FILE*   fFile;
+};
+
+#endif
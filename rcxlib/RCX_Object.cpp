@@ -0,0 +1,639 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include <cstring>
+#include <cstdio>
+#include <map>
+#include <set>
+#include "RCX_Object.h"
+#include "RCX_Target.h"
+
+#include "rcxifile.h"
+
+using std::fopen;
+using std::map;
+using std::memchr;
+using std::make_pair;
+using std::set;
+using std::sprintf;
+using std::strcmp;
+
+#define kObjectHeaderSize   16
+#define kSymbolHeaderSize   4
+#define kRelocationSize     8
+
+// from RCX_Image.cpp
+void Write4(ULong d, FILE *fp);
+void Write2(UShort d, FILE *fp);
+
+static ULong Get4(const UByte *ptr);
+static UShort Get2(const UByte *ptr);
+static void WritePadding(int length, FILE *fp);
+
+
+/*
+ * Places the objects of a program.  Each object's numbers are mapped
+ * to the ones they get in the linked image.
+ */
+class ObjectLinker
+{
+public:
+    ObjectLinker(const vector<const RCX_Object*> &objects) :
+        fObjects(objects), fMaps(objects.size()), fTarget(0) {}
+
+    RCX_Image*  Link(string &error);
+
+private:
+    typedef map<int, int> Map;
+
+    // the numbers of one object
+    struct Maps
+    {
+        Map fVars;
+        Map fChunks[kRCX_ChunkTypeCount];
+    };
+
+    // where a sub or task came from
+    struct Definition
+    {
+        int fNumber;
+        size_t fObject;
+        const RCX_Image::Chunk *fChunk;
+    };
+
+    typedef map<string, Definition> Definitions;
+
+    bool    PlaceChunks(string &error);
+    bool    ResolveImports(string &error);
+    bool    PlaceVars(string &error);
+    bool    CheckTaskVars(string &error);
+    RCX_Image*  Build();
+
+    void    FindTaskVars(size_t object, const RCX_Image::Chunk &c, set<int> &vars) const;
+    const Definition*   FindSub(int number) const;
+
+    const vector<const RCX_Object*>& fObjects;
+    vector<Maps>        fMaps;
+    const RCX_Target*   fTarget;
+    Definitions         fDefinitions[kRCX_ChunkTypeCount];
+    map<string, RCX_Object::Symbol> fGlobals;   // fIndex is where it was placed
+};
+
+
+void RCX_Object::AddGlobal(int index, int count, const char *name)
+{
+    Symbol s;
+    s.fType = kGlobal;
+    s.fIndex = index;
+    s.fCount = count;
+    s.fName = name;
+    fSymbols.push_back(s);
+}
+
+
+void RCX_Object::AddImport(RCX_ChunkType type, int number, const char *name)
+{
+    Symbol s;
+    s.fType = (type == kRCX_TaskChunk) ? kTaskImport : kSubImport;
+    s.fIndex = number;
+    s.fCount = 0;
+    s.fName = name;
+    fSymbols.push_back(s);
+}
+
+
+bool RCX_Object::CanRelocate(RCX_TargetType target)
+{
+    // Spybotics code is linked into one block, and Swan has global
+    // variable and condition operands the relocations don't follow
+    return target != kRCX_SpyboticsTarget && target != kRCX_SwanTarget;
+}
+
+
+bool RCX_Object::FindRelocations(string &bad)
+{
+    RCX_Disasm disasm(GetTargetType());
+
+    fRelocations.clear();
+    for(int i=0; i<GetChunkCount(); ++i) {
+        const Chunk &c = GetChunk(i);
+        if (c.GetType() != kRCX_TaskChunk && c.GetType() != kRCX_SubChunk)
+            continue;
+
+        vector<RCX_Disasm::Reference> refs;
+        if (!disasm.FindReferences(c.GetData(), c.GetLength(), refs)) {
+            bad = c.GetName();
+            return false;
+        }
+
+        for(size_t j=0; j<refs.size(); ++j) {
+            Relocation r;
+            r.fType = refs[j].fType;
+            r.fChunkType = c.GetType();
+            r.fChunkNumber = c.GetNumber();
+            r.fOffset = refs[j].fOffset;
+            fRelocations.push_back(r);
+        }
+    }
+
+    return true;
+}
+
+
+const RCX_Image::Chunk* RCX_Object::FindCode(RCX_ChunkType type, int number) const
+{
+    for(int i=0; i<GetChunkCount(); ++i) {
+        const Chunk &c = GetChunk(i);
+        if (c.GetType() == type && c.GetNumber() == number)
+            return &c;
+    }
+
+    return 0;
+}
+
+
+RCX_Result RCX_Object::Read(const char *filename)
+{
+    FILE *fp = fopen(filename, "rb");
+    if (!fp) return kRCX_FileError;
+
+    fseek(fp, 0, SEEK_END);
+    long length = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+
+    UByte *data = new UByte[length > 0 ? length : 1];
+    bool ok = (length >= 0 && fread(data, 1, length, fp) == (size_t)length);
+    fclose(fp);
+
+    RCX_Result result = ok ? Parse(data, length) : kRCX_FileError;
+    delete [] data;
+
+    if (RCX_ERROR(result)) {
+        Clear();
+        fSymbols.clear();
+        fRelocations.clear();
+    }
+    return result;
+}
+
+
+RCX_Result RCX_Object::Parse(const UByte *data, long length)
+{
+    const UByte *ptr = data;
+    const UByte *end = data + length;
+
+    fSymbols.clear();
+    fRelocations.clear();
+
+    if (end - ptr < kObjectHeaderSize) return kRCX_FormatError;
+    if (Get4(ptr) != kRCXO_Signature) return kRCX_FormatError;
+    if (Get2(ptr + 4) > kRCXO_CurrentVersion) return kRCX_FormatError;
+
+    int symbolCount = Get2(ptr + 6);
+    int relocationCount = Get2(ptr + 8);
+    ULong imageLength = Get4(ptr + 12);
+    ptr += kObjectHeaderSize;
+
+    if ((ULong)(end - ptr) < RCXI_PADDED_LENGTH(imageLength)) return kRCX_FormatError;
+    RCX_Result result = RCX_Image::Read(ptr, (long)imageLength);
+    if (RCX_ERROR(result)) return result;
+    ptr += RCXI_PADDED_LENGTH(imageLength);
+
+    for(int i=0; i<symbolCount; ++i) {
+        if (end - ptr < kSymbolHeaderSize) return kRCX_FormatError;
+
+        Symbol s;
+        if (ptr[0] > kRCXO_TaskImport) return kRCX_FormatError;
+        s.fType = (SymbolType)ptr[0];
+        s.fIndex = ptr[1];
+        s.fCount = ptr[2];
+        int nameLength = ptr[3];
+        ptr += kSymbolHeaderSize;
+
+        if (end - ptr < RCXI_PADDED_LENGTH(nameLength)) return kRCX_FormatError;
+        const char *name = (const char *)ptr;
+        const char *nul = (const char *)memchr(name, 0, nameLength);
+        s.fName.assign(name, nul ? nul - name : nameLength);
+        ptr += RCXI_PADDED_LENGTH(nameLength);
+
+        fSymbols.push_back(s);
+    }
+
+    if (end - ptr < relocationCount * kRelocationSize) return kRCX_FormatError;
+    for(int i=0; i<relocationCount; ++i) {
+        Relocation r;
+        if (ptr[0] > kRCXO_TaskRelocation) return kRCX_FormatError;
+        r.fType = (RCX_Disasm::Reference::Type)ptr[0];
+        r.fChunkType = (RCX_ChunkType)ptr[1];
+        r.fChunkNumber = ptr[2];
+        r.fOffset = Get2(ptr + 4);
+        ptr += kRelocationSize;
+
+        const Chunk *c = FindCode(r.fChunkType, r.fChunkNumber);
+        if (!c || r.fOffset >= c->GetLength()) return kRCX_FormatError;
+
+        fRelocations.push_back(r);
+    }
+
+    return kRCX_OK;
+}
+
+
+bool RCX_Object::Write(const char *filename) const
+{
+    FILE *fp = fopen(filename, "wb");
+    if (!fp) return false;
+
+    // write header, the image length is filled in after the image
+    Write4(kRCXO_Signature, fp);
+    Write2(kRCXO_CurrentVersion, fp);
+    Write2((UShort)fSymbols.size(), fp);
+    Write2((UShort)fRelocations.size(), fp);
+    Write2(0, fp);
+    Write4(0, fp);
+
+    long start = ftell(fp);
+    RCX_Image::Write(fp);
+
+    long imageLength = ftell(fp) - start;
+    fseek(fp, start - 4, SEEK_SET);
+    Write4((ULong)imageLength, fp);
+    fseek(fp, 0, SEEK_END);
+    WritePadding(imageLength, fp);
+
+    for(size_t i=0; i<fSymbols.size(); ++i) {
+        const Symbol &s = fSymbols[i];
+        int nameLength = s.fName.size() + 1;
+
+        putc(s.fType, fp);
+        putc(s.fIndex, fp);
+        putc(s.fCount, fp);
+        putc(nameLength, fp);
+        fwrite(s.fName.c_str(), (size_t)nameLength, 1, fp);
+        WritePadding(nameLength, fp);
+    }
+
+    for(size_t i=0; i<fRelocations.size(); ++i) {
+        const Relocation &r = fRelocations[i];
+
+        putc(r.fType, fp);
+        putc(r.fChunkType, fp);
+        putc(r.fChunkNumber, fp);
+        putc(0, fp);
+        Write2((UShort)r.fOffset, fp);
+        Write2(0, fp);
+    }
+
+    bool ok = !ferror(fp);
+    if (fclose(fp) != 0) ok = false;
+    return ok;
+}
+
+
+RCX_Image* RCX_Object::Link(const vector<const RCX_Object*> &objects, string &error)
+{
+    ObjectLinker linker(objects);
+    return linker.Link(error);
+}
+
+
+RCX_Image* ObjectLinker::Link(string &error)
+{
+    if (fObjects.empty()) {
+        error = "there are no objects to link";
+        return 0;
+    }
+
+    RCX_TargetType type = fObjects[0]->GetTargetType();
+    for(size_t i=1; i<fObjects.size(); ++i) {
+        if (fObjects[i]->GetTargetType() != type) {
+            error = "the objects were compiled for different targets";
+            return 0;
+        }
+    }
+
+    if (!RCX_Object::CanRelocate(type)) {
+        error = "objects can't be linked for this target";
+        return 0;
+    }
+    fTarget = getTarget(type);
+
+    if (!PlaceChunks(error) || !ResolveImports(error) || !PlaceVars(error) ||
+        !CheckTaskVars(error))
+        return 0;
+
+    return Build();
+}
+
+
+/*
+ * Subs and tasks are numbered in the order of the objects, except that
+ * main gets the first task number.  Resources keep their numbers.
+ */
+bool ObjectLinker::PlaceChunks(string &error)
+{
+    char text[128];
+    int next[kRCX_ChunkTypeCount];
+
+    for(int t=0; t<kRCX_ChunkTypeCount; ++t)
+        next[t] = fTarget->fRanges[t].fBase;
+    next[kRCX_TaskChunk]++; // leave room for main
+
+    bool main = false;
+    set<int> resources[kRCX_ChunkTypeCount];
+
+    for(size_t i=0; i<fObjects.size(); ++i) {
+        const RCX_Object *o = fObjects[i];
+
+        for(int j=0; j<o->GetChunkCount(); ++j) {
+            const RCX_Image::Chunk &c = o->GetChunk(j);
+            RCX_ChunkType type = c.GetType();
+
+            if (type != kRCX_TaskChunk && type != kRCX_SubChunk) {
+                if (!resources[type].insert(c.GetNumber()).second) {
+                    sprintf(text, "more than one object has resource %d of type %d", c.GetNumber(), type);
+                    error = text;
+                    return false;
+                }
+                continue;
+            }
+
+            const char *kind = (type == kRCX_TaskChunk) ? "task" : "sub";
+            Definition d;
+            d.fObject = i;
+            d.fChunk = &c;
+
+            if (type == kRCX_TaskChunk && strcmp(c.GetName(), "main") == 0) {
+                d.fNumber = fTarget->fRanges[type].fBase;
+                main = true;
+            }
+            else
+                d.fNumber = next[type]++;
+
+            if (!fDefinitions[type].insert(Definitions::value_type(c.GetName(), d)).second) {
+                error = string(kind) + " '" + c.GetName() + "' is defined by more than one object";
+                return false;
+            }
+
+            fMaps[i].fChunks[type][c.GetNumber()] = d.fNumber;
+        }
+    }
+
+    if (!main) {
+        error = "no object defines task 'main'";
+        return false;
+    }
+
+    if (next[kRCX_TaskChunk] > fTarget->GetChunkLimit(kRCX_TaskChunk)) {
+        sprintf(text, "maximum of %d tasks exceeded", fTarget->fRanges[kRCX_TaskChunk].fCount);
+        error = text;
+        return false;
+    }
+
+    if (next[kRCX_SubChunk] > fTarget->GetChunkLimit(kRCX_SubChunk)) {
+        sprintf(text, "maximum of %d subroutines exceeded", fTarget->fRanges[kRCX_SubChunk].fCount);
+        error = text;
+        return false;
+    }
+
+    return true;
+}
+
+
+bool ObjectLinker::ResolveImports(string &error)
+{
+    for(size_t i=0; i<fObjects.size(); ++i) {
+        const RCX_Object *o = fObjects[i];
+
+        for(int j=0; j<o->GetSymbolCount(); ++j) {
+            const RCX_Object::Symbol &s = o->GetSymbol(j);
+            if (s.fType == RCX_Object::kGlobal) continue;
+
+            RCX_ChunkType type = (s.fType == RCX_Object::kTaskImport) ? kRCX_TaskChunk : kRCX_SubChunk;
+            Definitions::const_iterator d = fDefinitions[type].find(s.fName);
+
+            if (d == fDefinitions[type].end()) {
+                error = string((type == kRCX_TaskChunk) ? "task" : "sub") +
+                    " '" + s.fName + "' is not defined by any object";
+                return false;
+            }
+
+            fMaps[i].fChunks[type][s.fIndex] = d->second.fNumber;
+        }
+    }
+
+    return true;
+}
+
+
+/*
+ * Globals with the same name are the same variable, and are placed
+ * first.  The rest of an object's variables below the task variables
+ * (its temps, and any locals that didn't fit in the task variables)
+ * are given places of their own after them.
+ */
+bool ObjectLinker::PlaceVars(string &error)
+{
+    char text[128];
+    int next = 0;
+
+    for(size_t i=0; i<fObjects.size(); ++i) {
+        const RCX_Object *o = fObjects[i];
+
+        for(int j=0; j<o->GetSymbolCount(); ++j) {
+            const RCX_Object::Symbol &s = o->GetSymbol(j);
+            if (s.fType != RCX_Object::kGlobal) continue;
+
+            map<string, RCX_Object::Symbol>::iterator g = fGlobals.find(s.fName);
+            if (g == fGlobals.end()) {
+                RCX_Object::Symbol placed = s;
+                placed.fIndex = next;
+                next += s.fCount;
+                g = fGlobals.insert(make_pair(s.fName, placed)).first;
+            }
+            else if (g->second.fCount != s.fCount) {
+                error = "global '" + s.fName + "' has a different size in another object";
+                return false;
+            }
+
+            for(int k=0; k<s.fCount; ++k)
+                fMaps[i].fVars[s.fIndex + k] = g->second.fIndex + k;
+        }
+    }
+
+    for(size_t i=0; i<fObjects.size(); ++i) {
+        const RCX_Object *o = fObjects[i];
+        Map &vars = fMaps[i].fVars;
+
+        for(int j=0; j<o->GetRelocationCount(); ++j) {
+            const RCX_Object::Relocation &r = o->GetRelocation(j);
+            if (r.fType != RCX_Disasm::Reference::kVar) continue;
+
+            int v = o->FindCode(r.fChunkType, r.fChunkNumber)->GetData()[r.fOffset];
+            if (vars.count(v)) continue;
+
+            vars[v] = (v < fTarget->fMaxGlobalVars) ? next++ : v;
+        }
+    }
+
+    if (next > fTarget->fMaxGlobalVars) {
+        sprintf(text, "the objects need %d variables, but only %d are available", next, fTarget->fMaxGlobalVars);
+        error = text;
+        return false;
+    }
+
+    return true;
+}
+
+
+/*
+ * A task's variables stay in use while it runs a sub, so a sub from
+ * another object (which the compiler couldn't check) mustn't use any
+ * of them.
+ */
+bool ObjectLinker::CheckTaskVars(string &error)
+{
+    for(size_t i=0; i<fObjects.size(); ++i) {
+        const RCX_Object *o = fObjects[i];
+
+        for(int j=0; j<o->GetChunkCount(); ++j) {
+            const RCX_Image::Chunk &task = o->GetChunk(j);
+            if (task.GetType() != kRCX_TaskChunk) continue;
+
+            set<int> taskVars;
+            FindTaskVars(i, task, taskVars);
+
+            for(int k=0; k<o->GetRelocationCount(); ++k) {
+                const RCX_Object::Relocation &r = o->GetRelocation(k);
+                if (r.fType != RCX_Disasm::Reference::kSub ||
+                    r.fChunkType != kRCX_TaskChunk || r.fChunkNumber != task.GetNumber())
+                    continue;
+
+                const Definition *sub = FindSub(fMaps[i].fChunks[kRCX_SubChunk][task.GetData()[r.fOffset]]);
+                if (!sub || sub->fObject == i) continue;
+
+                set<int> subVars;
+                FindTaskVars(sub->fObject, *sub->fChunk, subVars);
+
+                for(set<int>::const_iterator v=subVars.begin(); v!=subVars.end(); ++v) {
+                    if (taskVars.count(*v)) {
+                        error = string("task '") + task.GetName() + "' and sub '" +
+                            sub->fChunk->GetName() + "' use the same task variables";
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+
+void ObjectLinker::FindTaskVars(size_t object, const RCX_Image::Chunk &c, set<int> &vars) const
+{
+    const RCX_Object *o = fObjects[object];
+
+    for(int i=0; i<o->GetRelocationCount(); ++i) {
+        const RCX_Object::Relocation &r = o->GetRelocation(i);
+
+        if (r.fType == RCX_Disasm::Reference::kVar && r.fChunkType == c.GetType() &&
+            r.fChunkNumber == c.GetNumber()) {
+            int v = c.GetData()[r.fOffset];
+            if (v >= fTarget->fMaxGlobalVars)
+                vars.insert(v);
+        }
+    }
+}
+
+
+const ObjectLinker::Definition* ObjectLinker::FindSub(int number) const
+{
+    const Definitions &subs = fDefinitions[kRCX_SubChunk];
+
+    for(Definitions::const_iterator d=subs.begin(); d!=subs.end(); ++d)
+        if (d->second.fNumber == number) return &d->second;
+
+    return 0;
+}
+
+
+RCX_Image* ObjectLinker::Build()
+{
+    RCX_Image *image = new RCX_Image();
+    image->SetTargetType(fTarget->fType);
+
+    for(size_t i=0; i<fObjects.size(); ++i) {
+        const RCX_Object *o = fObjects[i];
+        Maps &maps = fMaps[i];
+
+        for(int j=0; j<o->GetChunkCount(); ++j) {
+            const RCX_Image::Chunk &c = o->GetChunk(j);
+            RCX_ChunkType type = c.GetType();
+            vector<UByte> code(c.GetData(), c.GetData() + c.GetLength());
+
+            for(int k=0; k<o->GetRelocationCount(); ++k) {
+                const RCX_Object::Relocation &r = o->GetRelocation(k);
+                if (r.fChunkType != type || r.fChunkNumber != c.GetNumber()) continue;
+
+                UByte &b = code[r.fOffset];
+                switch(r.fType) {
+                    case RCX_Disasm::Reference::kVar:
+                        b = (UByte)maps.fVars[b];
+                        break;
+                    case RCX_Disasm::Reference::kSub:
+                        b = (UByte)maps.fChunks[kRCX_SubChunk][b];
+                        break;
+                    case RCX_Disasm::Reference::kTask:
+                        b = (UByte)maps.fChunks[kRCX_TaskChunk][b];
+                        break;
+                }
+            }
+
+            int number = c.GetNumber();
+            if (type == kRCX_TaskChunk || type == kRCX_SubChunk)
+                number = maps.fChunks[type][number];
+
+            image->AddChunk(type, (UByte)number, code.empty() ? 0 : &code[0],
+                code.size(), c.GetName(), 0, 0);
+        }
+    }
+
+    for(map<string, RCX_Object::Symbol>::const_iterator g=fGlobals.begin(); g!=fGlobals.end(); ++g)
+        image->SetVariable(g->second.fIndex, g->first.c_str());
+
+    return image;
+}
+
+
+void WritePadding(int length, FILE *fp)
+{
+    long zeros = 0;
+    int pad = RCXI_PAD_BYTES(length);
+
+    if (pad)
+        fwrite(&zeros, (size_t)pad, 1, fp);
+}
+
+
+ULong Get4(const UByte *ptr)
+{
+    return (ULong)ptr[0] + ((ULong)ptr[1] << 8) +
+        ((ULong)ptr[2] << 16) + ((ULong)ptr[3] << 24);
+}
+
+
+UShort Get2(const UByte *ptr)
+{
+    return (UShort)(ptr[0] + (ptr[1] << 8));
+}
@@ -0,0 +1,101 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __RCX_Object_h
+#define __RCX_Object_h
+
+#ifndef __RCX_Image_h
+#include "RCX_Image.h"
+#endif
+
+#ifndef __RCX_Disasm_h
+#include "RCX_Disasm.h"
+#endif
+
+#include <vector>
+#include <string>
+
+using std::vector;
+using std::string;
+
+/*
+ * The image of a source file compiled on its own, to be linked with
+ * others into one program.  Its variables, subs and tasks are numbered
+ * as if it were the whole program, so along with the image it keeps
+ * the globals it declares, the subs and tasks it uses without defining
+ * them, and the bytes of its code that hold any of those numbers.
+ *
+ * Link() gives each global name one place, each other variable of an
+ * object one of its own, and numbers the subs and tasks of all the
+ * objects in turn (main first).  Task variables stay where they are,
+ * since every task has its own.
+ */
+class RCX_Object : public RCX_Image
+{
+public:
+    // these match the file format
+    enum SymbolType {
+        kGlobal = 0,    // fIndex is the first variable, fCount how many
+        kSubImport,     // fIndex is the number the code uses for it
+        kTaskImport
+    };
+
+    struct Symbol {
+        SymbolType fType;
+        int fIndex;
+        int fCount;
+        string fName;
+    };
+
+    struct Relocation {
+        RCX_Disasm::Reference::Type fType;
+        RCX_ChunkType fChunkType;
+        int fChunkNumber;
+        int fOffset;
+    };
+
+    RCX_Object() {}
+
+    RCX_Result Read(const char *filename);
+    bool Write(const char *filename) const;
+
+    void AddGlobal(int index, int count, const char *name);
+    void AddImport(RCX_ChunkType type, int number, const char *name);
+    int GetSymbolCount() const { return fSymbols.size(); }
+    const Symbol& GetSymbol(int i) const { return fSymbols[i]; }
+
+    /// find the relocations of the tasks and subs, false (with the
+    /// name of the chunk in bad) if some code can't be relocated
+    bool FindRelocations(string &bad);
+    int GetRelocationCount() const { return fRelocations.size(); }
+    const Relocation& GetRelocation(int i) const { return fRelocations[i]; }
+
+    /// the task or sub a relocation is in, 0 if there isn't one
+    const Chunk* FindCode(RCX_ChunkType type, int number) const;
+
+    /// the targets that objects can be compiled for
+    static bool CanRelocate(RCX_TargetType target);
+
+    /// link the objects of a program into an image, or return 0 and
+    /// say why in error
+    static RCX_Image* Link(const vector<const RCX_Object*> &objects, string &error);
+
+private:
+    RCX_Result Parse(const UByte *data, long length);
+
+    vector<Symbol> fSymbols;
+    vector<Relocation> fRelocations;
+};
+
+
+#endif
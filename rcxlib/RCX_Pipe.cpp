@@ -21,10 +21,7 @@
 
 void RCX_Pipe::FlushRead(int delay)
 {
-    const int BUFFSIZE = 512;
-    UByte * buff = new UByte[BUFFSIZE];
+    UByte buff[512];
 
-    while (Read(buff, BUFFSIZE, delay) > 0) {;}
-
-    delete[] buff;
+    while (Read(buff, sizeof(buff), delay) > 0) {;}
 }
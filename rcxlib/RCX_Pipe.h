@@ -56,6 +56,9 @@ public:
 
     virtual long Read(void *ptr, long count, long timeout_ms) = 0;
     virtual long Write(const void *ptr, long count) = 0;
+    /// send whatever Write() has been holding back (a Read() does too)
+    virtual void FlushWrite() {}
+    /// discard pending input, then wait until nothing arrives for delay ms
     virtual void FlushRead(int delay);
     virtual bool IsUSB() const { return false; }
 
@@ -18,15 +18,25 @@
 #include "RCX_PipeTransport.h"
 #include "RCX_Link.h"
 #include "RCX_SerialPipe.h"
+#include "RCX_LinkStats.h"
+#include "RCX_Trace.h"
+
+// the byte loops of framing and replies run 16 bytes at a time where
+// there are vector instructions for it
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PIPE_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define PIPE_NEON
+#include <arm_neon.h>
+#elif defined(__wasm_simd128__)
+#define PIPE_WASM_SIMD
+#include <wasm_simd128.h>
+#endif
 
-#include "PDebug.h"
-
+using std::memcpy;
 using std::printf;
 
-#ifdef DEBUG
-#define DEBUG_TIMEOUT
-#endif
-
 #define kMaxTxData  ((int)(2 * RCX_Link::kMaxCmdLength + 6))
 #define kMaxRxData  ((int)(kMaxTxData + 2 * RCX_Link::kMaxReplyLength + 5))
 
@@ -37,8 +47,10 @@ static UByte rcxSync[] = { 3, 0x55, 0xff, 0x00 };
 static UByte rcxNo55Sync[] = { 2, 0xff, 0x00 };
 static UByte spyboticsSync[] = {1, 0x98 };
 
-static int FindSync(const UByte *data, int length, const UByte *sync, const UByte cmd);
+static int FindSync(const UByte *data, int length, const UByte *sync, const UByte cmd, int &matched);
 static UByte ComputeChecksum(UByte dataSum, RCX_TargetType targetType);
+static UByte CopyBytes(UByte *dst, const UByte *src, int length, bool complement);
+static void CopyEvenBytes(UByte *dst, const UByte *src, int length);
 
 /// receive states
 enum {
@@ -53,9 +65,16 @@ enum {
 RCX_PipeTransport::RCX_PipeTransport(RCX_Pipe *pipe) : fPipe(pipe)
 {
     fTxData = new UByte[kMaxTxData];
+    fTx = fTxData;
+    fTxLength = 0;
     fRxData = new UByte[kMaxRxData];
+    fRxScan = 0;
     fVerbose = false;
     fTxLastCommand = 0;
+    fLastTries = 0;
+    fRetries = 0;
+    fRxStale = false;
+    fSentTime = 0;
     fFastMode = false;
     fOmitHeader = false;
 }
@@ -102,7 +121,10 @@ RCX_Result RCX_PipeTransport::Open(RCX_TargetType target, const char *deviceName
     fRxTimeout = (options & RCX_Link::kRxTimeoutMask);
     if (fRxTimeout==0) fRxTimeout = kMaxTimeout;
 
-    fDynamicTimeout = true;
+    fDynamicTimeout = (fTimeoutPolicy != kFixedTimeout);
+    fReplyAverage = -1;
+    fReplyDeviation = 0;
+    fRxStale = false;
 
     fRxState = kReplyState;
     return kRCX_OK;
@@ -121,13 +143,14 @@ bool RCX_PipeTransport::FastModeSupported() const
 }
 
 
-void RCX_PipeTransport::SetFastMode(bool fast)
+RCX_Result RCX_PipeTransport::SetFastMode(bool fast)
 {
-    if (fast == fFastMode) return;
+    if (fast == fFastMode) return kRCX_OK;
 
     if (fast) {
+        RCX_Result result = fPipe->SetMode(RCX_Pipe::kFastIrMode);
+        if (RCX_ERROR(result)) return result;
         fComplementData = false;
-        fPipe->SetMode(RCX_Pipe::kFastIrMode);
     }
     else {
         fComplementData = (fTarget != kRCX_SpyboticsTarget);
@@ -135,27 +158,101 @@ void RCX_PipeTransport::SetFastMode(bool fast)
     }
 
     fFastMode = fast;
+    return kRCX_OK;
 }
 
 
 RCX_Result RCX_PipeTransport::Send(const UByte *txData, int txLength, UByte *rxData,
     int rxExpected, int rxMax, bool retry, int timeout)
 {
-    PDEBUGVAR("RCX_PipeTransport::Send retry", (int)retry);
-    PDEBUGVAR("timeout", timeout);
+    // format the command
+    BuildTxData(txData, txLength, retry);
+
+    return Transmit(rxData, rxExpected, rxMax, retry, timeout);
+}
+
+
+void RCX_PipeTransport::Frame(const UByte *txData, int txLength, bool retry,
+    RCX_Frames &frames) const
+{
+    UByte lastCommand = frames.GetLastCommand();
+    UByte *frame = frames.Add(2 * txLength + 6);
+    int length = BuildFrame(txData, txLength, retry, lastCommand, frame);
+    frames.Finish(length, lastCommand);
+}
+
 
+RCX_Result RCX_PipeTransport::SendFrame(const RCX_Frames &frames, int index,
+    UByte *rxData, int rxExpected, int rxMax, bool retry, int timeout)
+{
+    fTx = frames.GetData(index);
+    fTxLength = frames.GetLength(index);
+    fTxLastCommand = frames.GetCommand(index);
+
+    RCX_Result result = Transmit(rxData, rxExpected, rxMax, retry, timeout);
+    fTx = fTxData;
+    return result;
+}
+
+
+/*
+ * Frames that expect no reply can't fail (short of the tower), so a run
+ * of them at the start is written all at once: with the header and the
+ * gaps between writes gone, a stream of them goes out as fast as the
+ * port allows.  Anything else is sent one frame at a time.
+ */
+int RCX_PipeTransport::SendFrames(const RCX_Frames &frames, int first, int count,
+    const int *rxExpected, UByte *rxData, int rxMax, RCX_Result *results,
+    bool retry, int timeout)
+{
+    int n = 0;
+    while (n < count && rxExpected[n] == 0) ++n;
+    if (n < 2)
+        return RCX_Transport::SendFrames(frames, first, count, rxExpected,
+            rxData, rxMax, results, retry, timeout);
+
+    const UByte *start = frames.GetData(first);
+    const UByte *end = frames.GetData(first + n - 1) + frames.GetLength(first + n - 1);
+
+    fPipe->FlushRead((fFastMode && fRxStale) ? kQuietTime : 0);
+    fPipe->Write(start, end - start);
+    fPipe->FlushWrite();
+    if (fVerbose) DumpData(start, (int)(end - start));
+
+    fTxLastCommand = frames.GetCommand(first + n - 1);
+    fLastTries = 1;
+    for (int i=0; i<n; ++i) {
+        if (fTrace) fTrace->Add(RCX_Trace::kTriesEvent, 1);
+        if (fStats) fStats->AddPacket(1, true);
+        results[i] = kRCX_OK;
+    }
+
+    return n;
+}
+
+
+RCX_Result RCX_PipeTransport::Transmit(UByte *rxData, int rxExpected, int rxMax,
+    bool retry, int timeout)
+{
     RCX_Result result;
     int originalTimeout = fRxTimeout;
-
-    // format the command
-    BuildTxData(txData, txLength, retry);
+    bool timed = fStats || (fDynamicTimeout && fTimeoutPolicy == kAverageTimeout);
 
     // Try sending
     int tries = retry ? kDefaultRetryCount : 1;
-    PDEBUGVAR("tries", tries);
+    if (fTrace) fTrace->Add(RCX_Trace::kTriesEvent, tries);
     for (int i=0; i<tries; i++) {
-        PDEBUGVAR("Transmitting from buffer; try", i);
-        SendFromTxBuffer(fFastMode ? 100 : 0);
+        if (fTrace) fTrace->Add(RCX_Trace::kTryEvent, i);
+        fLastTries = i + 1;
+        if (i > 0) ++fRetries;
+
+        // In fast mode the late end of a missed reply can garble the
+        // next one, so let it finish first.  Otherwise whatever is
+        // buffered is simply dropped.
+        double start = timed ? RCX_LinkStats::Now() : 0;
+        SendFromTxBuffer((fFastMode && fRxStale) ? kQuietTime : 0);
+        if (timed) fSentTime = RCX_LinkStats::Now();
+        if (fStats) fStats->AddTime(RCX_LinkStats::kTxTiming, fSentTime - start);
 
         // if no reply is expected, we can just return now (no retries, no errors, etc)
         if (!rxExpected) return kRCX_OK;
@@ -163,28 +260,36 @@ RCX_Result RCX_PipeTransport::Send(const UByte *txData, int txLength, UByte *rxD
         // Get the expected reply. Use the passed-in timeout, if set.
         // Otherwise, we will use the dynamically adjusted timeout.
         int replyOffset;
-        result = ReceiveReply(rxExpected, 
-            (timeout > 0) ? timeout : fRxTimeout, replyOffset);
+        int rxTimeout = (timeout > 0) ? timeout : fRxTimeout;
+        result = ReceiveReply(rxExpected, rxTimeout, replyOffset);
+        fRxStale = RCX_ERROR(result);
+        double replyTime = timed ? RCX_LinkStats::Now() - fSentTime : 0;
+        if (fStats) {
+            if (timeout <= 0) fStats->AddTimeout(rxTimeout);
+            if (!RCX_ERROR(result))
+                fStats->AddTime(RCX_LinkStats::kReplyTiming, replyTime);
+        }
 
         // Adjust the timeout appropriately, if dynamic adjustment is
         // enabled. This adjusts the fRxTimeut property for any following
         // transfers. Only bother to do this if we aren't just using a hard-
         // coded timeout.
         if (fDynamicTimeout && timeout == 0) {
-            AdjustTimeout(result, i);
+            AdjustTimeout(result, i, replyTime);
         }
 
         if (!RCX_ERROR(result)) {
-            PDEBUGSTR("Reply received");
+            if (fTrace) fTrace->Add(RCX_Trace::kReplyEvent, result);
             if (rxData) {
                 int length = result + 1;
                 if (length > rxMax) length = rxMax;
                 CopyReply(rxData, replyOffset, length);
             }
 
+            if (fStats) fStats->AddPacket(i + 1, true);
             return result;
         }
-        PDEBUGVAR("Reply result", result);
+        if (fTrace) fTrace->Add(RCX_Trace::kRetryEvent, result);
 
         // only the second kRCX_IREchoError is catastrophic
         // this is somewhat of a hack - I really should keep track
@@ -201,6 +306,8 @@ RCX_Result RCX_PipeTransport::Send(const UByte *txData, int txLength, UByte *rxD
         }
     }
 
+    if (fStats) fStats->AddPacket(fLastTries, false);
+
     if (retry) {
         // retries exceeded, restore original timeout and lose the sync
         if (fDynamicTimeout) {
@@ -209,18 +316,89 @@ RCX_Result RCX_PipeTransport::Send(const UByte *txData, int txLength, UByte *rxD
         fSynced = false;
     }
 
-    PDEBUGVAR("RCX_PipeTransport::Send result", result);
+    if (fTrace) fTrace->Add(RCX_Trace::kFailEvent, result);
     return result;
 }
 
 
 void RCX_PipeTransport::BuildTxData(const UByte *data, int length, bool duplicateReduction)
 {
-    int i;
+    fTxLength = BuildFrame(data, length, duplicateReduction, fTxLastCommand, fTxData);
+    fTx = fTxData;
+}
+
+
+int RCX_PipeTransport::BuildFrame(const UByte *data, int length, bool duplicateReduction,
+    UByte &lastCommand, UByte *frame) const
+{
     UByte dataSum = 0;
     UByte byte;
-    UByte *ptr = fTxData;
+    UByte *ptr = BeginFrame(frame);
+
+    // interleaved data & inverse data
+    if (length > 0) {
+        byte = *data++;
+        if (duplicateReduction && byte==lastCommand)
+            byte ^= 8;
+        lastCommand = byte;
+
+        *ptr++ = byte;
+        if (fComplementData)
+            *ptr++ = (UByte)~byte;
+        dataSum = byte;
+
+        dataSum += CopyBytes(ptr, data, length - 1, fComplementData);
+        ptr += (length - 1) * (fComplementData ? 2 : 1);
+    }
+
+    return EndFrame(ptr, dataSum) - frame;
+}
+
 
+/*
+ * The download message is framed as it's made, so the data is only
+ * read once, for both its own checksum and the frame's.
+ */
+void RCX_PipeTransport::FrameDownload(UShort seq, const UByte *data, int length,
+    bool retry, RCX_Frames &frames) const
+{
+    UByte lastCommand = frames.GetLastCommand();
+    UByte *frame = frames.Add(2 * (length + 6) + 6);
+    UByte *ptr = BeginFrame(frame);
+    int width = fComplementData ? 2 : 1;
+    UByte header[5];
+    UByte checksum;
+    UByte dataSum;
+
+    header[0] = kRCX_DownloadOp;
+    if (retry && header[0]==lastCommand)
+        header[0] ^= 8;
+    lastCommand = header[0];
+    header[1] = (UByte)(seq & 0xff);
+    header[2] = (UByte)(seq >> 8);
+    header[3] = (UByte)(length & 0xff);
+    header[4] = (UByte)(length >> 8);
+
+    dataSum = CopyBytes(ptr, header, 5, fComplementData);
+    ptr += 5 * width;
+
+    checksum = CopyBytes(ptr, data, length, fComplementData);
+    ptr += length * width;
+
+    // the data and then the message's checksum, which is the sum of
+    // the data, both count towards the frame's checksum
+    *ptr++ = checksum;
+    if (fComplementData)
+        *ptr++ = (UByte)~checksum;
+    dataSum += 2 * checksum;
+
+    frames.Finish(EndFrame(ptr, dataSum) - frame, lastCommand);
+}
+
+
+/// write the sync pattern, and return where the message goes
+UByte* RCX_PipeTransport::BeginFrame(UByte *ptr) const
+{
     if (fTarget == kRCX_CMTarget) {
         // CM sync pattern
         *ptr++ = 0xfe;
@@ -243,31 +421,20 @@ void RCX_PipeTransport::BuildTxData(const UByte *data, int length, bool duplicat
         }
     }
 
-    // interleaved data & inverse data
-    for (i=0; i<length; i++) {
-        byte = *data++;
-
-        if (i==0) {
-            if (duplicateReduction && byte==fTxLastCommand)
-                byte ^= 8;
-            fTxLastCommand = byte;
-        }
-
+    return ptr;
+}
 
-        *ptr++ = byte;
-        if (fComplementData)
-            *ptr++ = (UByte)~byte;
-        dataSum += byte;
-    }
 
+/// write the checksum of the message's bytes, and return the end
+UByte* RCX_PipeTransport::EndFrame(UByte *ptr, UByte dataSum) const
+{
     UByte checksum = ComputeChecksum(dataSum, fTarget);
 
-    // checksum
     *ptr++ = checksum;
     if (fComplementData)
         *ptr++ = (UByte)~checksum;
 
-    fTxLength = ptr - fTxData;
+    return ptr;
 }
 
 
@@ -277,60 +444,69 @@ void RCX_PipeTransport::SendFromTxBuffer(int delay)
     fPipe->FlushRead(delay);
 
     // send command
-    fPipe->Write(fTxData, fTxLength);
+    fPipe->Write(fTx, fTxLength);
+    fPipe->FlushWrite();
     if (fVerbose) {
         // printf("Tx: ");
-        DumpData(fTxData, fTxLength);
+        DumpData(fTx, fTxLength);
     }
 }
 
 
 RCX_Result RCX_PipeTransport::ReceiveReply(int rxExpected, int timeout, int &replyOffset)
 {
-    PDEBUGVAR("CX_PipeTransport::ReceiveReply rxExpected", rxExpected);
     int receiveLen = ExpectedReceiveLen(rxExpected);
+    int echoLen = 0;
     if (!((fTarget == kRCX_SpyboticsTarget) || fPipe->IsUSB())) {
-        receiveLen += fTxLength; // serial tower echoes the sent bytes
+        echoLen = fTxLength; // serial tower echoes the sent bytes
+        receiveLen += echoLen;
     }
-    PDEBUGVAR("receiveLen", receiveLen);
 
     // get the reply
     fRxState = kReplyState;
     fRxLength = 0;
+    fRxScan = 0;
     int length = 0;
-    bool bFirstRead = true;
+    int count = receiveLen;
     while (fRxLength < kMaxRxData) {
-        PDEBUGVAR("fRxLength", fRxLength);
-        if (bFirstRead) {
-            bFirstRead = false;
-            // if (fVerbose) printf("expecting %d bytes, timeout = %d\n", receiveLen, timeout);
-
-            int bytesRead = fPipe->Read(fRxData+fRxLength, receiveLen, timeout);
-            PDEBUGVAR("bytesRead", bytesRead);
-            if (bytesRead == 0) {
-                break;
-            }
-
-            fRxLength += bytesRead;
-            // if (fVerbose) printf("read %d bytes, total = %d\n", bytesRead, fRxLength);
+        if (count > kMaxRxData - fRxLength) {
+            count = kMaxRxData - fRxLength;
         }
-        else {
-            // if (fVerbose) printf("expecting 1 byte, timeout = %d\n", timeout);
 
-            if (fPipe->Read(fRxData+fRxLength, 1, timeout) != 1) {
-                break;
-            }
+        // if (fVerbose) printf("expecting %d bytes, timeout = %d\n", count, timeout);
+        int bytesRead = fPipe->Read(fRxData+fRxLength, count, timeout);
+        if (fTrace) fTrace->Add(RCX_Trace::kReadEvent, bytesRead);
+        if (bytesRead <= 0) {
+            break;
+        }
 
-            fRxLength++;
-            // if (fVerbose) printf("read 1 byte, total = %d\n", fRxLength);
+        // the echo doesn't count as the first byte of the reply
+        if (fStats && fRxLength <= echoLen && fRxLength + bytesRead > echoLen) {
+            fStats->AddTime(RCX_LinkStats::kFirstByteTiming, RCX_LinkStats::Now() - fSentTime);
         }
+        fRxLength += bytesRead;
+        // if (fVerbose) printf("read %d bytes, total = %d\n", bytesRead, fRxLength);
 
         // check for replies
         length = FindReply(rxExpected, replyOffset);
-        PDEBUGVAR("length", length);
         if (length == rxExpected) {
             break;
         }
+
+        // Ask for the rest of the reply in one read.  Until the reply
+        // has been located, all we know is that it hasn't fully arrived,
+        // and a serial pipe waits for every byte asked for, so take one
+        // at a time.
+        count = receiveLen - fRxLength;
+        if (length > 0) {
+            count = replyOffset + receiveLen - 3 - fRxLength;
+            if (!((fTarget == kRCX_SpyboticsTarget) || fPipe->IsUSB())) {
+                count -= fTxLength;
+            }
+        }
+        if (count < 1) {
+            count = 1;
+        }
     }
 
     if (fVerbose) {
@@ -355,10 +531,12 @@ RCX_Result RCX_PipeTransport::ReceiveReply(int rxExpected, int timeout, int &rep
 int RCX_PipeTransport::FindReply(const int rxExpected, int &offset)
 {
     int length;
+    bool skip = true;
 
-    offset = 0;
+    offset = fRxScan;
     while (1) {
-        int start = FindSync(fRxData + offset, fRxLength - offset, fSync, fTxLastCommand);
+        int matched;
+        int start = FindSync(fRxData + offset, fRxLength - offset, fSync, fTxLastCommand, matched);
 
         if (start == 0) {
             return 0;
@@ -366,11 +544,22 @@ int RCX_PipeTransport::FindReply(const int rxExpected, int &offset)
 
         offset += start;
 
-        length = VerifyReply(rxExpected, fRxData + offset, fRxLength - offset, fTxLastCommand);
+        bool settled;
+        length = VerifyReply(rxExpected, fRxData + offset, fRxLength - offset, fTxLastCommand, settled);
 
         if (length > 0) {
             return length;
         }
+
+        // A candidate behind the full sync that more data can't turn into
+        // a reply will be found (and rejected) every time, so the next
+        // search starts after it.
+        if (skip && settled && matched == fSync[0]) {
+            fRxScan = offset;
+        }
+        else {
+            skip = false;
+        }
     }
 }
 
@@ -379,38 +568,58 @@ void RCX_PipeTransport::CopyReply(UByte *dst, int offset, RCX_Result length)
 {
     const UByte *src = fRxData + offset;
 
-    while (length>0) {
-        *dst++ = *src++;
-        if (fComplementData) src++;
-        length--;
-    }
+    if (length <= 0) return;
+
+    if (fComplementData)
+        CopyEvenBytes(dst, src, length);
+    else
+        memcpy(dst, src, length);
 }
 
 
-void RCX_PipeTransport::AdjustTimeout(RCX_Result result, int attempt)
+void RCX_PipeTransport::AdjustTimeout(RCX_Result result, int attempt, double replyTime)
 {
     int newTimeout = fRxTimeout;
 
-    if (!RCX_ERROR(result) && attempt == 0) {
+    if (fTimeoutPolicy == kAverageTimeout && !RCX_ERROR(result)) {
+        // Only a first try reply can be timed; after a retry it might be
+        // the late answer to an earlier try.  The timeout leaves room for
+        // four times the usual variation, as TCP's does.
+        if (attempt == 0) {
+            if (fReplyAverage < 0) {
+                fReplyAverage = replyTime;
+                fReplyDeviation = replyTime / 2;
+            }
+            else {
+                double error = replyTime - fReplyAverage;
+                fReplyAverage += error / 8;
+                fReplyDeviation += ((error < 0 ? -error : error) - fReplyDeviation) / 4;
+            }
+
+            newTimeout = (int)(fReplyAverage + 4 * fReplyDeviation) + 1;
+            if (newTimeout < kMinTimeout)
+                newTimeout = kMinTimeout;
+            if (newTimeout > kMaxTimeout)
+                newTimeout = kMaxTimeout;
+        }
+    }
+    else if (!RCX_ERROR(result) && attempt == 0) {
         // worked on first try, lets see if we can go faster next time
         newTimeout = fRxTimeout - (fRxTimeout / 10);
         if (newTimeout < kMinTimeout)
             newTimeout = kMinTimeout;
-        PDEBUGVAR("Adjusting Rx timeout down, newTimeout", newTimeout);
     }
     else if (RCX_ERROR(result) && attempt > 0) {
         // failed on try other than first - slow down
         newTimeout *= 2;
         if (newTimeout > kMaxTimeout)
             newTimeout = kMaxTimeout;
-        PDEBUGVAR("Adjusting Rx timeout up, newTimeout", newTimeout);
     }
 
     if (newTimeout != fRxTimeout) {
+        if (fStats) fStats->AddAdjustment(newTimeout > fRxTimeout);
         fRxTimeout = newTimeout;
-        #ifdef DEBUG_TIMEOUT
-            PDEBUGVAR("New Rx timeout", fRxTimeout);
-        #endif
+        if (fTrace) fTrace->Add(RCX_Trace::kTimeoutEvent, fRxTimeout);
     }
 }
 
@@ -531,7 +740,7 @@ int RCX_PipeTransport::ExpectedReceiveLen(const int rxExpected)
     return result;
 }
 
-int RCX_PipeTransport::VerifyReply(const int rxExpected, const UByte *data, int length, UByte cmd)
+int RCX_PipeTransport::VerifyReply(const int rxExpected, const UByte *data, int length, UByte cmd, bool &settled)
 {
     UByte dataSum = data[0];
     const UByte *ptr = data;
@@ -548,6 +757,9 @@ int RCX_PipeTransport::VerifyReply(const int rxExpected, const UByte *data, int
         complementCmd = fComplementData;
     }
 
+    // settled means more data can't change the answer
+    settled = false;
+
     // always need a cmd and a checksum
     if (length < ((complementCmd ? 2 : 1) + width)) {
         return 0;
@@ -561,6 +773,7 @@ int RCX_PipeTransport::VerifyReply(const int rxExpected, const UByte *data, int
 
     if (complementCmd) {
         if ((*ptr & 0xf7) != (cmd & 0xf7)) {
+            settled = true;
             return 0;
         }
         ptr++;
@@ -568,6 +781,7 @@ int RCX_PipeTransport::VerifyReply(const int rxExpected, const UByte *data, int
 
     while (ptr < end) {
         if (fComplementData && ((ptr[0] & 0xf7) != (~ptr[1] & 0xf7))) {
+            settled = true;
             break;
         }
 
@@ -585,6 +799,7 @@ int RCX_PipeTransport::VerifyReply(const int rxExpected, const UByte *data, int
         if (length == rxExpected+1) {
             match = end - 1;
         }
+        settled = false;
     }
 
     if (!match) {
@@ -607,7 +822,7 @@ UByte ComputeChecksum(UByte dataSum, RCX_TargetType targetType)
     }
 }
 
-int FindSync(const UByte *data, int length, const UByte *sync, const UByte cmd)
+int FindSync(const UByte *data, int length, const UByte *sync, const UByte cmd, int &matched)
 {
     int syncLen = *sync++;
     while (syncLen > 0) {
@@ -625,6 +840,7 @@ int FindSync(const UByte *data, int length, const UByte *sync, const UByte cmd)
             // check the next byte to see if it matches the command.
             // if it doesn't then we haven't really found the sync
             if ((i==syncLen) && ((ptr[syncLen] & 0xf7) == (~cmd & 0xf7))) {
+                matched = syncLen;
                 return ptr - data + syncLen;
             }
         }
@@ -634,3 +850,133 @@ int FindSync(const UByte *data, int length, const UByte *sync, const UByte cmd)
 
     return 0;
 }
+
+
+/*
+ * Copy length bytes from src to dst, each followed by its complement if
+ * complement is set, and return the sum of the bytes.
+ */
+UByte CopyBytes(UByte *dst, const UByte *src, int length, bool complement)
+{
+    UByte sum = 0;
+    int i = 0;
+
+#if defined(PIPE_SSE2)
+    __m128i total = _mm_setzero_si128();
+    const __m128i ones = _mm_set1_epi8(-1);
+
+    for (; i + 16 <= length; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+
+        // the lanes wrap around, which is all a byte sum needs
+        total = _mm_add_epi8(total, v);
+        if (complement) {
+            __m128i c = _mm_xor_si128(v, ones);
+            _mm_storeu_si128((__m128i *)dst, _mm_unpacklo_epi8(v, c));
+            _mm_storeu_si128((__m128i *)(dst + 16), _mm_unpackhi_epi8(v, c));
+            dst += 32;
+        }
+        else {
+            _mm_storeu_si128((__m128i *)dst, v);
+            dst += 16;
+        }
+    }
+
+    // add up the lanes, 8 at a time
+    total = _mm_sad_epu8(total, _mm_setzero_si128());
+    sum = (UByte)(_mm_cvtsi128_si32(total) + _mm_cvtsi128_si32(_mm_srli_si128(total, 8)));
+#elif defined(PIPE_NEON)
+    uint8x16_t total = vdupq_n_u8(0);
+    UByte lanes[16];
+
+    for (; i + 16 <= length; i += 16) {
+        uint8x16_t v = vld1q_u8(src + i);
+
+        total = vaddq_u8(total, v);
+        if (complement) {
+            uint8x16x2_t pairs;
+            pairs.val[0] = v;
+            pairs.val[1] = vmvnq_u8(v);
+            vst2q_u8(dst, pairs);
+            dst += 32;
+        }
+        else {
+            vst1q_u8(dst, v);
+            dst += 16;
+        }
+    }
+
+    vst1q_u8(lanes, total);
+    for (int j=0; j<16; j++)
+        sum += lanes[j];
+#elif defined(PIPE_WASM_SIMD)
+    v128_t total = wasm_i8x16_splat(0);
+    UByte lanes[16];
+
+    for (; i + 16 <= length; i += 16) {
+        v128_t v = wasm_v128_load(src + i);
+
+        total = wasm_i8x16_add(total, v);
+        if (complement) {
+            v128_t c = wasm_v128_not(v);
+            wasm_v128_store(dst, wasm_i8x16_shuffle(v, c,
+                0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23));
+            wasm_v128_store(dst + 16, wasm_i8x16_shuffle(v, c,
+                8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31));
+            dst += 32;
+        }
+        else {
+            wasm_v128_store(dst, v);
+            dst += 16;
+        }
+    }
+
+    wasm_v128_store(lanes, total);
+    for (int j=0; j<16; j++)
+        sum += lanes[j];
+#endif
+
+    for (; i<length; i++) {
+        UByte b = src[i];
+
+        *dst++ = b;
+        if (complement)
+            *dst++ = (UByte)~b;
+        sum += b;
+    }
+
+    return sum;
+}
+
+
+/*
+ * Copy every other byte of src, starting with the first, to length
+ * bytes of dst (dropping the complements of complemented data).
+ */
+void CopyEvenBytes(UByte *dst, const UByte *src, int length)
+{
+    int i = 0;
+
+#if defined(PIPE_SSE2)
+    const __m128i mask = _mm_set1_epi16(0x00ff);
+
+    for (; i + 16 <= length; i += 16) {
+        __m128i lo = _mm_and_si128(_mm_loadu_si128((const __m128i *)(src + 2*i)), mask);
+        __m128i hi = _mm_and_si128(_mm_loadu_si128((const __m128i *)(src + 2*i + 16)), mask);
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(lo, hi));
+    }
+#elif defined(PIPE_NEON)
+    for (; i + 16 <= length; i += 16)
+        vst1q_u8(dst + i, vld2q_u8(src + 2*i).val[0]);
+#elif defined(PIPE_WASM_SIMD)
+    for (; i + 16 <= length; i += 16) {
+        v128_t lo = wasm_v128_load(src + 2*i);
+        v128_t hi = wasm_v128_load(src + 2*i + 16);
+        wasm_v128_store(dst + i, wasm_i8x16_shuffle(lo, hi,
+            0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30));
+    }
+#endif
+
+    for (; i<length; i++)
+        dst[i] = src[2*i];
+}
@@ -28,7 +28,8 @@ class RCX_PipeTransport : public RCX_Transport
 public:
     enum {
         kMinTimeout = 50,   ///< Minimum value, in ms, that Rx timeouts will be set to dynamically
-        kMaxTimeout = 500   ///< Maximum value, in ms, that Rx timeouts will be set to dynamically  
+        kMaxTimeout = 500,  ///< Maximum value, in ms, that Rx timeouts will be set to dynamically  
+        kQuietTime = 100    ///< Silence, in ms, awaited in fast mode before sending after a missed reply
     };
 
     RCX_PipeTransport(RCX_Pipe *pipe);
@@ -41,11 +42,25 @@ public:
     virtual RCX_Result Send(const UByte *txData, int txLength, UByte *rxData,
         int rxExpected, int rxMax, bool retry, int timeout);
 
+    virtual int GetRxTimeout() const { return fRxTimeout; }
+
     virtual bool FastModeSupported() const;
     virtual bool FastModeOddParity() const { return fPipe->GetCapabilities() & RCX_Pipe::kFastOddParityFlag; }
-    virtual void SetFastMode(bool fast);
+    virtual RCX_Result SetFastMode(bool fast);
     virtual bool GetFastMode() const { return fFastMode; }
     virtual bool GetComplementData() const { return fComplementData; }
+    virtual int GetLastTries() const { return fLastTries; }
+    virtual long GetRetries() const { return fRetries; }
+
+    virtual void Frame(const UByte *txData, int txLength, bool retry, RCX_Frames &frames) const;
+    virtual void FrameDownload(UShort seq, const UByte *data, int length, bool retry, RCX_Frames &frames) const;
+    virtual UByte GetLastCommand() const { return fTxLastCommand; }
+    virtual RCX_Result SendFrame(const RCX_Frames &frames, int index, UByte *rxData,
+        int rxExpected, int rxMax, bool retry, int timeout);
+    /// a run of frames that nothing answers goes out in one write
+    virtual int SendFrames(const RCX_Frames &frames, int first, int count,
+        const int *rxExpected, UByte *rxData, int rxMax, RCX_Result *results,
+        bool retry, int timeout);
 
     /// the Receive() interface is still experiemental
     RCX_Result Receive(UByte *data, int maxLength, bool echo);
@@ -53,23 +68,30 @@ public:
 private:
     int ExpectedReceiveLen(const int rxExpected);
     void BuildTxData(const UByte *data, int length, bool duplicateReduction);
+    int BuildFrame(const UByte *data, int length, bool duplicateReduction,
+        UByte &lastCommand, UByte *frame) const;
+    UByte* BeginFrame(UByte *ptr) const;
+    UByte* EndFrame(UByte *ptr, UByte dataSum) const;
+    RCX_Result Transmit(UByte *rxData, int rxExpected, int rxMax, bool retry, int timeout);
     void SendFromTxBuffer(int delay);
     RCX_Result ReceiveReply(int rxExpected, int timeout, int &replyOffset);
 
     int FindReply(const int rxExpected, int &offset);
     void CopyReply(UByte *dst, int offset, int length);
-    void AdjustTimeout(RCX_Result result, int attempt);
+    void AdjustTimeout(RCX_Result result, int attempt, double replyTime);
 
     void ProcessRxByte(UByte b);
-    int VerifyReply(const int rxExpected, const UByte *data, int length, UByte cmd);
+    int VerifyReply(const int rxExpected, const UByte *data, int length, UByte cmd, bool &settled);
 
     RCX_Pipe* fPipe;
     UByte* fTxData;
+    const UByte* fTx;       ///< what gets sent, either fTxData or a prepared frame
     int fTxLength;
     UByte fTxLastCommand;
 
     UByte* fRxData;
     int  fRxLength;
+    int  fRxScan;           ///< where FindReply() starts looking
 
     /// Used by the Receive() state machine
     int fRxState;
@@ -82,10 +104,16 @@ private:
     bool fSynced;           ///< Flag that indicates we have a sync with the remote brick
     RCX_TargetType fTarget; ///< Current target type.
     int fRxTimeout;         ///< Receive reply timeouts if dynamic timeouts are enabled @see fDynamicTimeout
-
-    /// Adjust receive timeouts based on reply success/failure; always true on Open.
+    int fLastTries;         ///< Transmissions made by the last Send()
+    long fRetries;          ///< Transmissions repeated by all of them
+    bool fRxStale;          ///< a reply to an earlier transmission may still arrive
+    double fSentTime;       ///< when the last transmission finished, if it's being timed
+    double fReplyAverage;   ///< running average of the reply times for kAverageTimeout, < 0 until the first
+    double fReplyDeviation; ///< running average of their distance from the average
+
+    /// Adjust receive timeouts based on reply success/failure; true on Open
+    /// unless the timeout policy is kFixedTimeout.
     /// @see fRxTimeout
-    // TODO: maybe make this a user-settable option?
     bool fDynamicTimeout;
 
     /// use for fast download
@@ -0,0 +1,184 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include <ctime>
+#if __cplusplus >= 201103L
+#include <chrono>
+#endif
+
+#include "RCX_Poller.h"
+#include "RCX_Link.h"
+
+using std::fprintf;
+using std::fputc;
+
+// milliseconds on a clock that only goes forward
+static double Now()
+{
+#if __cplusplus >= 201103L
+    return std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#else
+    return (double)std::time(0) * 1000;
+#endif
+}
+
+
+static void Write2(int value, FILE *fp)
+{
+    fputc(value & 0xff, fp);
+    fputc((value >> 8) & 0xff, fp);
+}
+
+
+RCX_Poller::RCX_Poller(RCX_Link *link, int capacity) :
+    fLink(link),
+    fCapacity(capacity > 0 ? capacity : 1),
+    fStart(0),
+    fCount(0),
+    fUnwritten(0),
+    fDropped(0),
+    fTimes(fCapacity),
+    fEpoch(0)
+{
+}
+
+
+int RCX_Poller::AddSource(RCX_Value value)
+{
+    for (int i=0; i<(int)fSources.size(); ++i)
+        if (fSources[i] == value) return i;
+
+    fSources.push_back(value);
+    int n = (int)fSources.size();
+
+    // reads are short commands, so they can be copied as the vector grows
+    fCmds.resize(n);
+    fCmdPtrs.resize(n);
+    for (int i=0; i<n; ++i)
+        fCmdPtrs[i] = fCmds[i].MakeRead(fSources[i]);
+
+    fValues.resize(fCapacity * n);
+    fResults.resize(n);
+    fStart = 0;
+    fCount = 0;
+    fUnwritten = 0;
+    return n - 1;
+}
+
+
+RCX_Result RCX_Poller::Poll()
+{
+    int n = (int)fSources.size();
+    if (n == 0) return kRCX_OK;
+
+    RCX_Result result = fLink->Sync();
+    if (RCX_ERROR(result)) return result;
+
+    double now = Now();
+    result = fLink->Send(&fCmdPtrs[0], n, &fResults[0], &fReplies);
+
+    if (fCount == 0) fEpoch = now;
+
+    // make room for the round
+    int round;
+    if (fCount < fCapacity)
+        round = Index(fCount++);
+    else {
+        round = fStart;
+        fStart = Index(1);
+    }
+    if (fUnwritten == fCapacity)
+        ++fDropped;
+    else
+        ++fUnwritten;
+
+    fTimes[round] = (ULong)(now - fEpoch);
+
+    const UByte *reply = fReplies.empty() ? 0 : &fReplies[0];
+    RCX_Result *values = &fValues[round * n];
+    int read = 0;
+    for (int i=0; i<n; ++i) {
+        RCX_Result r = fResults[i];
+        if (RCX_ERROR(r))
+            values[i] = r;
+        else if (r != 2)
+            values[i] = kRCX_ReplyError;
+        else {
+            values[i] = (RCX_Result)(reply[0] | (reply[1] << 8));
+            ++read;
+        }
+        if (!RCX_ERROR(r)) reply += r;
+    }
+
+    if (read == 0)
+        return RCX_ERROR(result) ? result : kRCX_ReplyError;
+    return read;
+}
+
+
+ULong RCX_Poller::GetTime(int round) const
+{
+    return fTimes[Index(round)];
+}
+
+
+RCX_Result RCX_Poller::GetValue(int round, int source) const
+{
+    return fValues[Index(round) * fSources.size() + source];
+}
+
+
+void RCX_Poller::WriteHeader(FILE *fp, Format format) const
+{
+    if (format != kCSVFormat) return;
+
+    fprintf(fp, "time");
+    for (int i=0; i<(int)fSources.size(); ++i)
+        fprintf(fp, ",%d:%d", RCX_VALUE_TYPE(fSources[i]), RCX_VALUE_DATA(fSources[i]));
+    fputc('\n', fp);
+}
+
+
+int RCX_Poller::Write(FILE *fp, Format format)
+{
+    int n = (int)fSources.size();
+    int written = fUnwritten;
+
+    for (int round = fCount - fUnwritten; round < fCount; ++round) {
+        ULong time = GetTime(round);
+
+        if (format == kCSVFormat) {
+            fprintf(fp, "%lu", (unsigned long)time);
+            for (int i=0; i<n; ++i) {
+                RCX_Result v = GetValue(round, i);
+                if (RCX_ERROR(v))
+                    fputc(',', fp);
+                else
+                    fprintf(fp, ",%d", (short)v);
+            }
+            fputc('\n', fp);
+        }
+        else {
+            Write2((int)(time & 0xffff), fp);
+            Write2((int)(time >> 16), fp);
+            for (int i=0; i<n; ++i) {
+                RCX_Result v = GetValue(round, i);
+                Write2(RCX_ERROR(v) ? (int)kBadValue : v, fp);
+            }
+        }
+    }
+
+    fUnwritten = 0;
+    return written;
+}
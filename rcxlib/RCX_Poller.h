@@ -0,0 +1,106 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __RCX_Poller_h
+#define __RCX_Poller_h
+
+#ifndef __RCX_Result_h
+#include "RCX_Result.h"
+#endif
+
+#ifndef __RCX_Constants_h
+#include "RCX_Constants.h"
+#endif
+
+#ifndef __RCX_Cmd_h
+#include "RCX_Cmd.h"
+#endif
+
+#include <cstdio>
+#include <vector>
+
+class RCX_Link;
+
+/*
+ * Samples a set of values (sensors, variables, timers...) over and
+ * over, as fast as the link allows.  Each Poll() reads every source
+ * once, as one batch of commands built when the sources were added,
+ * and keeps the round along with the time it was taken.  The last
+ * capacity rounds are kept; the oldest are dropped to make room.
+ *
+ * Write() streams the rounds not written yet, either as CSV (a line
+ * per round: the time in ms followed by each value, empty when it
+ * couldn't be read) or binary (per round a 4 byte time followed by a
+ * 2 byte value per source, all little endian, with kBadValue for a
+ * value that couldn't be read).
+ */
+class RCX_Poller
+{
+public:
+    enum {
+        kDefaultCapacity = 1024,
+        kBadValue = -32768      ///< binary value of a failed read
+    };
+
+    enum Format {
+        kCSVFormat,
+        kBinaryFormat
+    };
+
+    RCX_Poller(RCX_Link *link, int capacity = kDefaultCapacity);
+
+    /// returns the index of the source; a value added twice is only
+    /// read once.  Adding a source drops the rounds taken so far.
+    int AddSource(RCX_Value value);
+    int GetSourceCount() const { return (int)fSources.size(); }
+    RCX_Value GetSource(int i) const { return fSources[i]; }
+
+    /// read every source once, returns how many were read (or the first
+    /// error if none were)
+    RCX_Result Poll();
+
+    /// rounds kept, oldest first
+    int GetCount() const { return fCount; }
+    /// ms since the first round
+    ULong GetTime(int round) const;
+    /// the 16 bit value read for a source, unsigned like the result of
+    /// RCX_Link::GetValue() (or the error)
+    RCX_Result GetValue(int round, int source) const;
+    /// rounds dropped before they were written
+    long GetDropped() const { return fDropped; }
+
+    void WriteHeader(FILE *fp, Format format) const;
+    /// write the rounds taken since the last Write(), returns how many
+    int Write(FILE *fp, Format format);
+
+private:
+    int Index(int round) const { return (fStart + round) % fCapacity; }
+
+    RCX_Link* fLink;
+    std::vector<RCX_Value> fSources;
+    std::vector<RCX_Cmd> fCmds;
+    std::vector<const RCX_Cmd*> fCmdPtrs;
+
+    int fCapacity;
+    int fStart;
+    int fCount;
+    int fUnwritten;
+    long fDropped;
+    std::vector<ULong> fTimes;          // fCapacity rounds
+    std::vector<RCX_Result> fValues;    // fCapacity rounds of each source
+    std::vector<RCX_Result> fResults;   // the round being taken
+    std::vector<UByte> fReplies;
+    double fEpoch;                      // time of the first round
+};
+
+#endif
@@ -0,0 +1,112 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include "RCX_Profile.h"
+
+using std::fopen;
+using std::strlen;
+using std::strtol;
+
+#define kProfileHeader  "nqc-profile 1\n"
+#define kMaxLine        1024
+
+
+void RCX_Profile::Add(const char *file, long line, long count)
+{
+    long &c = fCounts[Line(LeafName(file), line)];
+
+    // the same file name may have been included from two places
+    if (count > c) c = count;
+    if (c > fMax) fMax = c;
+}
+
+
+long RCX_Profile::GetCount(const char *file, long line) const
+{
+    if (!file) return 0;
+
+    map<Line, long>::const_iterator i = fCounts.find(Line(LeafName(file), line));
+    return (i == fCounts.end()) ? 0 : i->second;
+}
+
+
+/*
+ * The file holds one line per source line that ran:
+ *
+ *  <count> <line> <file name>
+ *
+ * A file that doesn't parse is an error, unlike the histories, since
+ * it was asked for by name.
+ */
+bool RCX_Profile::Read(const char *filename)
+{
+    FILE *fp = fopen(filename, "r");
+    if (!fp) return false;
+
+    char line[kMaxLine];
+    bool ok = fgets(line, sizeof(line), fp) && strcmp(line, kProfileHeader) == 0;
+
+    while(ok && fgets(line, sizeof(line), fp)) {
+        size_t n = strlen(line);
+        if (n && line[n-1]=='\n') line[--n] = 0;
+
+        char *end;
+        long count = strtol(line, &end, 10);
+        if (end == line || *end != ' ' || count < 0) {
+            ok = false;
+            break;
+        }
+
+        char *file;
+        long lineNumber = strtol(end + 1, &file, 10);
+        if (file == end + 1 || *file != ' ' || lineNumber <= 0) {
+            ok = false;
+            break;
+        }
+
+        Add(file + 1, lineNumber, count);
+    }
+
+    fclose(fp);
+    return ok;
+}
+
+
+bool RCX_Profile::Write(const char *filename) const
+{
+    FILE *fp = fopen(filename, "w");
+    if (!fp) return false;
+
+    fputs(kProfileHeader, fp);
+
+    map<Line, long>::const_iterator i;
+    for(i = fCounts.begin(); i != fCounts.end(); ++i)
+        fprintf(fp, "%ld %ld %s\n", i->second, i->first.second, i->first.first.c_str());
+
+    return fclose(fp) == 0;
+}
+
+
+string RCX_Profile::LeafName(const char *file)
+{
+    const char *leaf = file;
+
+    for(const char *p = file; *p; ++p)
+        if (*p == '/' || *p == '\\' || *p == ':')
+            leaf = p + 1;
+
+    return leaf;
+}
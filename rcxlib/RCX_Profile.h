@@ -0,0 +1,59 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __RCX_Profile_h
+#define __RCX_Profile_h
+
+#include <string>
+#include <map>
+
+using std::string;
+using std::map;
+using std::pair;
+
+/*
+ * How many times each source line ran, from an emulated run (see
+ * RCX_Emulator::GetProfile()), saved in a file so that a later compile
+ * can lay out its branches for the lines that are run most.
+ *
+ * A line's count is that of its most run instruction, so a line runs
+ * as often as its hottest part whatever the number of instructions in
+ * it.  Files are matched by their names without directories, since a
+ * program is often emulated and compiled from different places.
+ */
+class RCX_Profile
+{
+public:
+    RCX_Profile() : fMax(0) {}
+
+    void Add(const char *file, long line, long count);
+
+    // 0 if the line never ran or isn't in the profile
+    long GetCount(const char *file, long line) const;
+    // the count of the most run line
+    long GetMax() const { return fMax; }
+    bool IsEmpty() const { return fCounts.empty(); }
+
+    bool Read(const char *filename);
+    bool Write(const char *filename) const;
+
+private:
+    typedef pair<string, long> Line;
+
+    static string LeafName(const char *file);
+
+    map<Line, long> fCounts;
+    long fMax;
+};
+
+#endif
@@ -53,6 +53,7 @@ void RCX_SerialPipe::Close()
 {
 	if (!fSerial) return;
 
+	fSerial->Flush();
 	fSerial->Close();
 	delete fSerial;
 	fSerial = 0;
@@ -67,6 +68,8 @@ int RCX_SerialPipe::GetCapabilities() const
 
 RCX_Result RCX_SerialPipe::SetMode(int mode)
 {
+	// held bytes go at the speed they were written for
+	fSerial->Flush();
 	fSerial->SetIsSpy(false);
 	switch(mode)
 	{
@@ -74,7 +77,10 @@ RCX_Result RCX_SerialPipe::SetMode(int mode)
 			fSerial->SetSpeed(2400, kPSerial_ParityOdd);
 			return kRCX_OK;
 		case kFastIrMode:
-			fSerial->SetSpeed(4800);
+			// not every serial port can do 4800 baud; no parity
+			// matches the (non-odd) nub
+			if (!fSerial->SetSpeed(4800, kPSerial_ParityNone))
+				return kRCX_PipeModeError;
 			return kRCX_OK;
 		case kCyberMasterMode:
 			fSerial->SetSpeed(2400, kPSerial_ParityOdd);
@@ -95,14 +101,36 @@ RCX_Result RCX_SerialPipe::SetMode(int mode)
 
 long RCX_SerialPipe::Read(void *ptr, long count, long timeout_ms)
 {
+	fSerial->Flush();
 	fSerial->SetTimeout(timeout_ms);
 	return fSerial->Read(ptr, count);
 }
 
 
+void RCX_SerialPipe::FlushRead(int delay)
+{
+	// a zero timeout read returns nothing on a serial port, so
+	// have the driver throw away what it has
+	fSerial->FlushRead();
+
+	if (delay > 0)
+		RCX_Pipe::FlushRead(delay);
+}
+
+
+/*
+ * Writes are held until FlushWrite() or the next Read(), so that a
+ * message written in pieces goes to the port in one write and is
+ * drained once, rather than leaving gaps in the IR frame between the
+ * pieces.
+ */
 long RCX_SerialPipe::Write(const void *ptr, long count)
 {
-	long n = fSerial->Write(ptr, count);
-        fSerial->FlushWrite();
-	return n;
+	return fSerial->Put(ptr, count);
+}
+
+
+void RCX_SerialPipe::FlushWrite()
+{
+	fSerial->Flush();
 }
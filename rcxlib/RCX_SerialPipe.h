@@ -37,6 +37,8 @@ public:
 
 	virtual long		Read(void *ptr, long count, long timeout_ms);
 	virtual long		Write(const void *ptr, long count);
+	virtual void		FlushWrite();
+	virtual void		FlushRead(int delay);
 
 private:
 	PSerial*	fSerial;
@@ -0,0 +1,456 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+
+#include "RCX_SimPipe.h"
+#include "RCX_Constants.h"
+
+using std::strchr;
+using std::strncmp;
+using std::strlen;
+using std::memcpy;
+using std::memcmp;
+using std::atoi;
+
+#define kNormalBaud         2400
+#define kFastBaud           4800
+#define kDefaultLogLength   100
+#define kMemMapLength       188
+#define kMapTasks           40      // the subs come first, 8 for each program
+#define kMemoryStart        0x8000  // program memory
+#define kMemoryEnd          0xcc00
+#define kBatteryLevel       9000    // millivolts
+
+static const char kUnlockReply[] = "Just a bit off the block!";
+
+static const UByte kVersions[] = { 0, 3, 0, 1, 0, 3, 3, 2 };
+
+
+RCX_SimPipe::RCX_SimPipe()
+{
+    fOpen = false;
+    fReport = false;
+}
+
+
+RCX_Result RCX_SimPipe::Open(const char *name, int mode)
+{
+    int value;
+
+    fUSB = HasOption(name, "usb");
+    fOddParity = HasOption(name, "odd");
+    fReport = HasOption(name, "report");
+    fLoss = HasOption(name, "loss", &value) ? value : 0;
+    fNoise = HasOption(name, "noise", &value) ? value : 0;
+    fLatency = HasOption(name, "latency", &value) ? value : 0;
+    fLogLength = HasOption(name, "log", &value) ? value : kDefaultLogLength;
+    fRandom = HasOption(name, "seed", &value) ? (ULong)value : 1;
+    if (fRandom == 0) fRandom = 1;
+
+    RCX_Result result = SetMode(mode);
+    if (RCX_ERROR(result)) return result;
+
+    fClock = 0;
+    fPending.resize(0);
+    fPendingPos = 0;
+    fLastFrame.resize(0);
+    fLastReply.resize(0);
+    fLastDone = false;
+    fProgram = 0;
+    fMemory.assign(kMemoryEnd, 0);
+    fMap.assign(kMemMapLength / 2, 0);
+    fFree = kMemoryStart;
+    fLoad = -1;
+    fLoadSeq = 0;
+
+    fMessages = 0;
+    fRetries = 0;
+    fLost = 0;
+    fDownloaded = 0;
+    fUploaded = 0;
+
+    fOpen = true;
+    return kRCX_OK;
+}
+
+
+void RCX_SimPipe::Close()
+{
+    if (!fOpen) return;
+    fOpen = false;
+
+    if (fReport) {
+        long bytes = fDownloaded + fUploaded;
+        double seconds = fClock / 1000;
+
+        fprintf(stderr, "sim: %ld messages, %ld retries, %ld lost\n",
+            fMessages, fRetries, fLost);
+        fprintf(stderr, "sim: %ld bytes in %.1f s (%.0f bytes/s)\n",
+            bytes, seconds, seconds > 0 ? bytes / seconds : 0.0);
+    }
+}
+
+
+int RCX_SimPipe::GetCapabilities() const
+{
+    int caps = kNormalIrMode + kFastIrMode;
+
+    if (!fUSB) caps += kTxEchoFlag;
+    if (fOddParity) caps += kFastOddParityFlag;
+    return caps;
+}
+
+
+RCX_Result RCX_SimPipe::SetMode(int mode)
+{
+    switch(mode) {
+        case kNormalIrMode:
+            fFast = false;
+            return kRCX_OK;
+        case kFastIrMode:
+            fFast = true;
+            return kRCX_OK;
+        default:
+            return kRCX_PipeModeError;
+    }
+}
+
+
+long RCX_SimPipe::Read(void *ptr, long count, long timeout_ms)
+{
+    long available = (long)(fPending.size() - fPendingPos);
+
+    if (available == 0) {
+        // nothing is coming, so the whole timeout goes by
+        fClock += timeout_ms;
+        return 0;
+    }
+
+    if (count > available) count = available;
+    memcpy(ptr, &fPending[fPendingPos], (size_t)count);
+    fPendingPos += count;
+
+    if (fPendingPos == fPending.size()) {
+        fPending.resize(0);
+        fPendingPos = 0;
+    }
+
+    return count;
+}
+
+
+long RCX_SimPipe::Write(const void *ptr, long count)
+{
+    const UByte *data = (const UByte *)ptr;
+
+    fClock += count * ByteTime();
+
+    // a serial tower hears itself
+    if (!fUSB) fPending.insert(fPending.end(), data, data + count);
+
+    // a write can hold several messages
+    for(long done = 0; done < count; ) {
+        int n = FrameLength(data + done, (int)(count - done));
+        Receive(data + done, n);
+        done += n;
+    }
+    return count;
+}
+
+
+/*
+ * Where the message at data ends: after its header, the complemented
+ * pairs stop at the next header (or the end).
+ */
+int RCX_SimPipe::FrameLength(const UByte *data, int length) const
+{
+    if (fFast || length < 3 || data[0] != 0x55 || data[1] != 0xff || data[2] != 0)
+        return length;
+
+    int n = 3;
+    while(n + 1 < length && (UByte)(data[n] + data[n+1]) == 0xff)
+        n += 2;
+
+    return n > 3 ? n : length;
+}
+
+
+void RCX_SimPipe::Receive(const UByte *data, int length)
+{
+    const UByte *ptr = data;
+    const UByte *end = data + length;
+    vector<UByte> msg;
+
+    // take the message out of its frame
+    if (fFast) {
+        if (ptr < end && *ptr == 0xff) ++ptr;
+        msg.assign(ptr, end);
+    }
+    else {
+        if (end - ptr >= 3 && ptr[0] == 0x55 && ptr[1] == 0xff && ptr[2] == 0)
+            ptr += 3;
+        if ((end - ptr) & 1) return;
+
+        for(; ptr < end; ptr += 2) {
+            if ((UByte)(ptr[0] + ptr[1]) != 0xff) return;
+            msg.push_back(ptr[0]);
+        }
+    }
+
+    if (msg.size() < 2) return;
+
+    UByte sum = 0;
+    for(size_t i=0; i<msg.size()-1; ++i)
+        sum += msg[i];
+    if (sum != msg.back()) return;
+    msg.pop_back();
+
+    // a message sent again, exactly as before, is a retry
+    bool retry = (fLastFrame.size() == (size_t)length &&
+        memcmp(&fLastFrame[0], data, (size_t)length) == 0);
+
+    ++fMessages;
+    if (retry) ++fRetries;
+    fLastFrame.assign(data, end);
+
+    // either the message or its reply can get lost
+    bool lost = Lose(length);
+    bool replyLost = lost && (fRandom & 0x10000);
+
+    if (lost) ++fLost;
+    if (lost && !replyLost) {
+        if (!retry) fLastDone = false;
+        return;
+    }
+
+    // messages and remote commands aren't answered
+    UByte op = msg[0] & 0xf7;
+    if (op == kRCX_Message || op == kRCX_Remote) {
+        fLastDone = true;
+        return;
+    }
+
+    // the brick answers a retry without carrying it out again
+    if (!retry || !fLastDone) {
+        vector<UByte> reply;
+        Process(&msg[0], (int)msg.size(), reply);
+
+        size_t start = fPending.size();
+        QueueReply((UByte)~msg[0], reply);
+        fLastReply.assign(fPending.begin() + start, fPending.end());
+        fPending.resize(start);
+        fLastDone = true;
+    }
+
+    if (replyLost) return;
+
+    fClock += fLatency + fLastReply.size() * ByteTime();
+    fPending.insert(fPending.end(), fLastReply.begin(), fLastReply.end());
+}
+
+
+void RCX_SimPipe::Process(const UByte *msg, int length, vector<UByte> &reply)
+{
+    const UByte *args = msg + 1;
+    int n = length - 1;
+
+    switch(msg[0] & 0xf7) {
+        case kRCX_GetVersions:
+            reply.assign(kVersions, kVersions + sizeof(kVersions));
+            break;
+        case kRCX_GetMemMap:
+            for(size_t i=0; i<fMap.size(); ++i) {
+                reply.push_back((UByte)(fMap[i] >> 8));
+                reply.push_back((UByte)fMap[i]);
+            }
+            break;
+        case kRCX_ReadOp:
+            reply.assign(2, 0);
+            if (n >= 1 && args[0] == kRCX_ProgramType)
+                reply[0] = (UByte)fProgram;
+            break;
+        case kRCX_BatteryLevelOp:
+            reply.push_back(kBatteryLevel & 0xff);
+            reply.push_back(kBatteryLevel >> 8);
+            break;
+        case kRCX_SelectProgramOp:
+            if (n >= 1 && args[0] < 5) fProgram = args[0];
+            break;
+        case kRCX_DeleteTasksOp:
+            for(int i=0; i<10; ++i)
+                fMap[kMapTasks + fProgram * 10 + i] = 0;
+            break;
+        case kRCX_DeleteSubsOp:
+            for(int i=0; i<8; ++i)
+                fMap[fProgram * 8 + i] = 0;
+            break;
+        case kRCX_DeleteTaskOp:
+            if (n >= 1 && args[0] < 10)
+                fMap[kMapTasks + fProgram * 10 + args[0]] = 0;
+            break;
+        case kRCX_DeleteSubOp:
+            if (n >= 1 && args[0] < 8)
+                fMap[fProgram * 8 + args[0]] = 0;
+            break;
+        case kRCX_BeginTaskOp:
+        case kRCX_BeginSubOp:
+            if (n >= 5) {
+                bool task = ((msg[0] & 0xf7) == kRCX_BeginTaskOp);
+                int number = args[1];
+                int size = args[3] + (args[4] << 8);
+
+                if (number >= (task ? 10 : 8) || fFree + size > kMemoryEnd) {
+                    reply.push_back(1);
+                    break;
+                }
+
+                fMap[task ? kMapTasks + fProgram * 10 + number : fProgram * 8 + number] = (UShort)fFree;
+                fLoad = fFree;
+                fLoadSeq = 1;
+                fFree += size;
+            }
+            reply.push_back(0);
+            break;
+        case kRCX_BeginFirmwareOp:
+            fLoad = -1;
+            reply.push_back(0);
+            break;
+        case kRCX_DownloadOp:
+            if (n >= 4) {
+                int seq = args[0] + (args[1] << 8);
+                int size = args[2] + (args[3] << 8);
+
+                fDownloaded += size;
+
+                // program messages are only taken in order
+                if (fLoad >= 0) {
+                    if ((seq != 0 && seq != fLoadSeq) || n < 4 + size ||
+                        fLoad + size > kMemoryEnd) {
+                        reply.push_back(3);
+                        break;
+                    }
+                    memcpy(&fMemory[fLoad], args + 4, (size_t)size);
+                    fLoad = seq ? fLoad + size : -1;
+                    ++fLoadSeq;
+                }
+            }
+            reply.push_back(0);
+            break;
+        case kRCX_UnlockOp:
+            reply.assign(kUnlockReply, kUnlockReply + strlen(kUnlockReply));
+            break;
+        case kRCX_PollMemoryOp:
+            if (n >= 3) {
+                int address = args[0] + (args[1] << 8);
+
+                for(int i=0; i<args[2]; ++i)
+                    reply.push_back((address + i < kMemoryEnd) ? fMemory[address + i] : 0);
+            }
+            break;
+        case kRCX_UploadDatalogOp:
+            if (n >= 4) {
+                int start = args[0] + (args[1] << 8);
+                int count = args[2] + (args[3] << 8);
+
+                // entry 0 holds the length, which includes itself
+                for(int i=start; i<start+count; ++i) {
+                    int value = (i == 0) ? fLogLength + 1 : i;
+                    reply.push_back(i == 0 ? 0xff : 0);
+                    reply.push_back((UByte)value);
+                    reply.push_back((UByte)(value >> 8));
+                }
+                fUploaded += 3 * count;
+            }
+            break;
+    }
+}
+
+
+void RCX_SimPipe::QueueReply(UByte cmd, const vector<UByte> &data)
+{
+    // fast mode replies aren't complemented, except for the command of
+    // an unlock reply
+    bool complement = !fFast;
+    UByte sum = cmd;
+
+    fPending.push_back(0x55);
+    fPending.push_back(0xff);
+    fPending.push_back(0x00);
+
+    fPending.push_back(cmd);
+    if (complement || (UByte)(~cmd & 0xf7) == kRCX_UnlockOp)
+        fPending.push_back((UByte)~cmd);
+
+    for(size_t i=0; i<data.size(); ++i) {
+        fPending.push_back(data[i]);
+        if (complement) fPending.push_back((UByte)~data[i]);
+        sum += data[i];
+    }
+
+    fPending.push_back(sum);
+    if (complement) fPending.push_back((UByte)~sum);
+}
+
+
+bool RCX_SimPipe::Lose(int bytes)
+{
+    // xorshift, so runs can be repeated
+    fRandom ^= (fRandom << 13) & 0xffffffffUL;
+    fRandom ^= fRandom >> 17;
+    fRandom ^= (fRandom << 5) & 0xffffffffUL;
+
+    double kept = (100 - fLoss) / 100.0;
+    for(int i=0; i<bytes && fNoise; ++i)
+        kept *= (10000 - fNoise) / 10000.0;
+
+    return (fRandom & 0xffff) >= kept * 0x10000;
+}
+
+
+double RCX_SimPipe::ByteTime() const
+{
+    // start and stop bits, plus parity except in plain fast mode
+    int bits = (fFast && !fOddParity) ? 10 : 11;
+    int baud = fFast ? kFastBaud : kNormalBaud;
+
+    return bits * 1000.0 / baud;
+}
+
+
+bool RCX_SimPipe::HasOption(const char *name, const char *option, int *value)
+{
+    size_t length = strlen(option);
+
+    while(name && *name) {
+        const char *next = strchr(name, ',');
+        size_t n = next ? (size_t)(next - name) : strlen(name);
+
+        if (n >= length && strncmp(name, option, length) == 0) {
+            if (n == length) {
+                if (value) *value = 0;
+                return true;
+            }
+            if (name[length] == '=') {
+                if (value) *value = atoi(name + length + 1);
+                return true;
+            }
+        }
+
+        name = next ? next + 1 : 0;
+    }
+
+    return false;
+}
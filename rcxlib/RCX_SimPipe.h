@@ -0,0 +1,113 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __RCX_SimPipe_h
+#define __RCX_SimPipe_h
+
+#ifndef __RCX_Pipe_h
+#include "RCX_Pipe.h"
+#endif
+
+#include <vector>
+
+using std::vector;
+
+/*
+ * A pipe to a simulated RCX, so downloads can be tried (and timed)
+ * without a tower or a brick.  The brick answers the commands used for
+ * downloading programs and firmware and for uploading the datalog.
+ * It keeps the tasks and subs it is sent, so they can be found through
+ * the memory map and read back.
+ * Time is simulated: bytes take as long as they would at the IR link's
+ * baud rate, each reply comes after a latency, and a read that finds
+ * nothing waits out its whole timeout.  Results are the same from one
+ * run to the next.
+ *
+ * The port name is "sim" followed by options separated by commas,
+ * e.g. "sim:usb,loss=5,latency=20":
+ *
+ *  usb         act like a USB tower (no echo) rather than a serial one
+ *  odd         fast mode uses odd parity
+ *  loss=<n>    percent of the messages (or of their replies) that get lost
+ *  noise=<n>   chance in 10000 of each byte being garbled, which loses
+ *              its message, so long messages get lost more often
+ *  latency=<n> milliseconds the brick takes to start a reply
+ *  log=<n>     number of datalog entries to upload
+ *  seed=<n>    start for the random numbers that decide the losses
+ *  report      print the message counts and throughput on closing
+ */
+class RCX_SimPipe : public RCX_Pipe
+{
+public:
+    RCX_SimPipe();
+    virtual ~RCX_SimPipe() { Close(); }
+
+    virtual RCX_Result Open(const char *name, int mode);
+    virtual void Close();
+
+    virtual int GetCapabilities() const;
+    virtual RCX_Result SetMode(int mode);
+
+    virtual long Read(void *ptr, long count, long timeout_ms);
+    virtual long Write(const void *ptr, long count);
+    virtual bool IsUSB() const { return fUSB; }
+
+    /// check a port name (without the "sim:") for an option
+    static bool HasOption(const char *name, const char *option, int *value=0);
+
+private:
+    int FrameLength(const UByte *data, int length) const;
+    void Receive(const UByte *data, int length);
+    void Process(const UByte *msg, int length, vector<UByte> &reply);
+    void QueueReply(UByte cmd, const vector<UByte> &data);
+    bool Lose(int bytes);
+    double ByteTime() const;
+
+    // options
+    bool fUSB;
+    bool fOddParity;
+    bool fReport;
+    int fLoss;
+    int fNoise;
+    int fLatency;
+    int fLogLength;
+    ULong fRandom;
+
+    bool fOpen;
+    bool fFast;
+    double fClock;          // simulated milliseconds since Open()
+    vector<UByte> fPending; // bytes waiting to be read
+    size_t fPendingPos;
+
+    // the last message, so a retry isn't carried out twice
+    vector<UByte> fLastFrame;
+    vector<UByte> fLastReply;
+    bool fLastDone;
+
+    // brick state
+    int fProgram;
+    vector<UByte> fMemory;
+    vector<UShort> fMap;    // addresses of the subs and tasks of each program
+    int fFree;              // where the next task or sub goes
+    int fLoad;              // where a task or sub being downloaded is up to, -1 if none
+    int fLoadSeq;           // the download message it needs next
+
+    // counts for the report
+    long fMessages;
+    long fRetries;
+    long fLost;
+    long fDownloaded;
+    long fUploaded;
+};
+
+#endif
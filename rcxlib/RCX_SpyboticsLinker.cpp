@@ -85,15 +85,15 @@ RCX_SpyboticsLinker::~RCX_SpyboticsLinker()
 
 void RCX_SpyboticsLinker::Generate(const RCX_Image &image, std::vector<UByte> &output)
 {
-	int tocSize = (fSlotCount+2) * 2;
+	PlaceChunks(image);
 
+	// the TOC has an entry per slot, one for the data area and the
+	// end marker
 	fTocOffset = 0;
-	fContentOffset = tocSize;
-	fOutput = &output;
-	fOutput->reserve(tocSize + 1000);
-	fOutput->resize(fContentOffset);
+	fContentOffset = (fSlotCount+2) * 2;
+	output.resize(fContentOffset + GetContentSize());
+	fOutput = &output[0];
 
-	PlaceChunks(image);
 	GenerateSlots();
 
 	// data area
@@ -102,11 +102,14 @@ void RCX_SpyboticsLinker::Generate(const RCX_Image &image, std::vector<UByte> &o
 	// end marker
 	AddEntry();
 
+	PASSERT(fContentOffset == (int)output.size());
+	fOutput = 0;
+
 
 	// dump the binary image for debugging
 /*
-	int length = fOutput->size();
-	const UByte* data = &(*fOutput)[0];
+	int length = output.size();
+	const UByte* data = &output[0];
 	for(int i=0; i<length; ++i) {
 		if ((i%16)==0) printf("\n%04x: ", i);
 		printf("%02x ", data[i]);
@@ -121,6 +124,9 @@ void RCX_SpyboticsLinker::PlaceChunks(const RCX_Image &image)
 {
 	int i;
 
+	for(i=0; i<fSlotCount; ++i)
+		fSlots[i].fChunk = 0;
+
 	for(i=0; i<image.GetChunkCount(); ++i)
 	{
 		const RCX_Image::Chunk &c = image.GetChunk(i);
@@ -141,6 +147,26 @@ void RCX_SpyboticsLinker::PlaceChunks(const RCX_Image &image)
 }
 
 
+// bytes GenerateSlots() will add after the TOC
+int RCX_SpyboticsLinker::GetContentSize() const
+{
+	int size = 0;
+
+	for(int i=0; i<fSlotCount; ++i)
+	{
+		const RCX_Image::Chunk* c = fSlots[i].fChunk;
+		RCX_ChunkType type = fSlots[i].fType;
+
+		if (c)
+			size += c->GetLength() + (type == kRCX_SubChunk ? 1 : 0);
+		else
+			size += sEmptyChunkDefs[type].fLength + (type == kRCX_TaskChunk ? 2 : 0);
+	}
+
+	return size;
+}
+
+
 void RCX_SpyboticsLinker::GenerateSlots()
 {
 	for(int i=0; i<fSlotCount; ++i)
@@ -182,8 +208,8 @@ void RCX_SpyboticsLinker::AddEntry(const UByte *data, int length)
 {
 	// add TOC entry
 	int address = fContentOffset + 0x8100;
-	(*fOutput)[fTocOffset++] = (address) & 0xff;
-	(*fOutput)[fTocOffset++] = (address >> 8) & 0xff;
+	fOutput[fTocOffset++] = (address) & 0xff;
+	fOutput[fTocOffset++] = (address >> 8) & 0xff;
 
 	if (length) AddData(data, length);
 }
@@ -193,8 +219,7 @@ void RCX_SpyboticsLinker::AddData(const UByte *data, int length)
 {
 	if (!length) return;
 
-	// add data
-	fOutput->resize(fContentOffset + length);
-	memcpy(&(*fOutput)[fContentOffset], data, length);
+	// add data (the space was allocated by Generate())
+	memcpy(fOutput + fContentOffset, data, length);
 	fContentOffset += length;
 }
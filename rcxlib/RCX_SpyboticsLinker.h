@@ -48,6 +48,7 @@ private:
 	};
 
 	void	PlaceChunks(const RCX_Image &image);
+	int	GetContentSize() const;
 	void	GenerateSlots();
 
 	void	AddEntry(const UByte *data=0, int length=0);
@@ -59,7 +60,7 @@ private:
 	Slot*	fSlots;
 	int	fSectionStarts[kRCX_ChunkTypeCount];
 
-	vector<UByte>*	fOutput;
+	UByte*	fOutput;	// sized for the whole image before anything is written
 	int	fTocOffset;	// current offset into TOC
 	int	fContentOffset;	// current offset for new data
 };
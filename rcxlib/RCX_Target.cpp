@@ -24,37 +24,37 @@ static const class RCX_Target sTargets[] = {
     {
         kRCX_RCXTarget, "RCX", "__RCX", "1",
         { {0, 10}, {0, 8}, {0, 0}, {0, 0} },
-        32, 0, false, false, false, true, false, false
+        32, 0, false, false, false, true, false, false, true, false
     },
 
     {
         kRCX_CMTarget, "CyberMaster", "__CM", "1",
         { {0, 4}, {0, 4}, {0, 0}, {0, 0} },
-        32, 0, false, false, false, true, false, false
+        32, 0, false, false, false, true, false, false, true, false
     },
 
     {
         kRCX_ScoutTarget, "Scout", "__SCOUT", "1",
         { {0, 6}, {0, 3}, {0, 0}, {0, 0} },
-        10, 8, true, true, false, true, false, false
+        10, 8, true, true, false, true, false, false, false, true
     },
 
     {
         kRCX_RCX2Target, "RCX2", "__RCX", "2",
         { {0, 10}, {0, 8}, {0, 0}, {0, 0} },
-        32, 16, true, true, true, false, false, false
+        32, 16, true, true, true, false, false, false, false, true
     },
 
     {
         kRCX_SpyboticsTarget, "Spybotics", "__SPY", "1",
         { {8, 8}, {128, 32}, {64, 16}, {8, 8} },
-        32, 4, true, true, true, false, true, false
+        32, 4, true, true, true, false, true, false, false, true
     },
 
     {
         kRCX_SwanTarget, "Swan", "__SWAN", "1",
         { {0, 10}, {0, 8}, {0, 0}, {0, 0} },
-        256, 0, true, true, true, false, true, true
+        256, 0, true, true, true, false, true, true, false, false
     },
 };
 
@@ -74,15 +74,53 @@ const RCX_Target *getTarget(RCX_TargetType type)
 };
 
 
+/*
+ * The sources each target can write, one bit per source, so that
+ * SourceWritable() (asked for each assignment that codegen emits) is
+ * a lookup rather than the switch in IsWritable().
+ */
+enum { kSourceCount = 64, kTargetTypeCount = kRCX_SwanTarget + 1 };
+
+struct RCX_WritableSources
+{
+    RCX_WritableSources();
+
+    unsigned long long  fMasks[kTargetTypeCount];
+};
+
+static bool IsWritable(RCX_TargetType type, int source);
+
+
+RCX_WritableSources::RCX_WritableSources()
+{
+    for(int type=0; type<kTargetTypeCount; ++type) {
+        fMasks[type] = 0;
+        for(int source=0; source<kSourceCount; ++source)
+            if (IsWritable((RCX_TargetType)type, source))
+                fMasks[type] |= 1ULL << source;
+    }
+}
+
+
 bool RCX_Target::SourceWritable(int source) const
+{
+    static const RCX_WritableSources sWritable;
+
+    if (source < 0 || source >= kSourceCount) return false;
+
+    return (sWritable.fMasks[fType] >> source) & 1;
+}
+
+
+bool IsWritable(RCX_TargetType type, int source)
 {
     // vars are always writable
     if (source == kRCX_VariableType) return true;
 
     // only RCX2/Spybotics support generic writable sources
-    if (fType != kRCX_RCX2Target
-        && fType != kRCX_SpyboticsTarget
-        && fType != kRCX_SwanTarget)
+    if (type != kRCX_RCX2Target
+        && type != kRCX_SpyboticsTarget
+        && type != kRCX_SwanTarget)
     {
             return false;
     }
@@ -114,7 +152,7 @@ bool RCX_Target::SourceWritable(int source) const
         case 40: // datalog value direct (RCX2 and Swan)
         case 41: // datalog byte indirect (RCX2 and Swan)
         case 42: // datalog byte direct (RCX2 and Swan)
-            return (fType == kRCX_RCX2Target) || (fType == kRCX_SwanTarget);
+            return (type == kRCX_RCX2Target) || (type == kRCX_SwanTarget);
 
         case 18: // Spybot Stack or Event Type (Swan)
         case 19: // Spybot Timer control or Event (Swan)
@@ -126,7 +164,7 @@ bool RCX_Target::SourceWritable(int source) const
         case 52: // Spybot Beacon Control or Function Return Value Long (Swan)
         case 53: // Spybot Sound Control or Function Return Value Float (Swan)
         case 54: // Spybot Indirect EEPROM or Var Byte (Swan)
-            return (fType == kRCX_SpyboticsTarget) || (fType == kRCX_SwanTarget);
+            return (type == kRCX_SpyboticsTarget) || (type == kRCX_SwanTarget);
 
         case 3: // Motor State (Swan makes this source writeable)
         case 5: // Motor Power Signed (Swan)
@@ -150,7 +188,7 @@ bool RCX_Target::SourceWritable(int source) const
         case 60: // Task Var (Swan)
         case 61: // Task Stack Address (Swan)
         case 62: // Task Stack Size (Swan)
-            return fType == kRCX_SwanTarget;
+            return type == kRCX_SwanTarget;
     }
 
     return false;
@@ -56,7 +56,9 @@ public:
     bool fArrays;
     bool fRestrictedMath;
     bool fSubParams;
-    bool fHasExtendedMathOps;
+    bool fHasExtendedMathOps;   ///< %, <<, >>, ^, ~ and math on any writable source
+    bool fLoopCounter;          ///< repeat can use the loop counter
+    bool fDecJumps;             ///< repeat can use decrement and jump on a variable
 
     bool SourceWritable(int source) const;
     int GetChunkLimit(RCX_ChunkType type) const;
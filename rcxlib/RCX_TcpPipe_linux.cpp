@@ -34,12 +34,18 @@
 
 #include <sys/socket.h>
 #include <netinet/in.h>
+#include <netinet/tcp.h>
 #include <arpa/inet.h>
 #include <netdb.h>
-
-#include <limits.h>
+#include <poll.h>
+#include <errno.h>
 
 #include <cstdio>
+#include <string>
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
 
 class RCX_TcpPipe_linux : public RCX_Pipe
 {
@@ -58,10 +64,9 @@ public:
         virtual bool            IsUSB() const { return true; };
 
 private:
-	void		SetTimeout(long timeout_ms);
+	RCX_Result	Connect(const struct addrinfo *ai);
+
 	int		fd;
-	fd_set		fds;
-	struct timeval	tv;
 };
 
 
@@ -78,71 +83,75 @@ RCX_Pipe* RCX_NewTcpPipe()
 #define DEFAULT_PORT 50637
 #endif
 
+// how long to wait for each address of the host to accept
+#ifndef TCP_CONNECT_TIMEOUT
+#define TCP_CONNECT_TIMEOUT 3000
+#endif
+
+/*
+ * The name is host, host:port or [address]:port; an IPv6 address
+ * without brackets is taken as the whole host.  Every address the
+ * host resolves to is tried in turn.
+ */
 RCX_Result RCX_TcpPipe_linux::Open(const char *name, int mode)
 {
-	char name_buf[PATH_MAX];
-	int port = 0;
-	struct hostent *h;
-	struct sockaddr_in localAddr, ttyAddr;
+	std::string host = DEFAULT_HOST;
+	std::string port;
 
-	if (0 == name || 0 == *name)
+	if (name && *name)
 	{
-		h = gethostbyname(DEFAULT_HOST);
-		port = DEFAULT_PORT;
-	}
-	else
-	{
-		strcpy(name_buf, name);
-		char *portStr = strchr(name_buf, ':');
-		if (portStr)
+		host = name;
+		if (host[0] == '[')
 		{
-			port = atoi(portStr + 1);
-
-			// Since we have the port, we can remove that from the name string
-			// Change the ':' in name to the null (end-of-string) character
-			*portStr = 0;
+			std::string::size_type end = host.find(']');
+			if (end == std::string::npos)
+				return kRCX_UnknownTcpHostError;
+			if (host.compare(end + 1, 1, ":") == 0)
+				port = host.substr(end + 2);
+			host = host.substr(1, end - 1);
 		}
 		else
 		{
-			port = DEFAULT_PORT;
+			std::string::size_type colon = host.find(':');
+			if (colon != std::string::npos && host.find(':', colon + 1) == std::string::npos)
+			{
+				port = host.substr(colon + 1);
+				host.erase(colon);
+			}
 		}
-
-		h = gethostbyname(name_buf);
 	}
 
-	// Verify the host
-	if (!h)
+	if (port.empty())
 	{
-		return kRCX_UnknownTcpHostError;
+		char buf[16];
+		sprintf(buf, "%d", DEFAULT_PORT);
+		port = buf;
 	}
 
-	// Create the socket
-	fd = socket(AF_INET, SOCK_STREAM, 0);
-	if (fd < 0)
+	struct addrinfo hints;
+	memset(&hints, 0, sizeof(hints));
+	hints.ai_family = AF_UNSPEC;
+	hints.ai_socktype = SOCK_STREAM;
+
+	struct addrinfo *list;
+	if (getaddrinfo(host.c_str(), port.c_str(), &hints, &list) != 0)
 	{
-		return kRCX_OpenSocketError;
+		return kRCX_UnknownTcpHostError;
 	}
 
-	// Bind any port number
-	localAddr.sin_family = AF_INET;
-	localAddr.sin_addr.s_addr = htonl(INADDR_ANY);
-	localAddr.sin_port = htons(0);
-
-	if (bind(fd, (struct sockaddr *) &localAddr, sizeof(localAddr)) < 0)
+	RCX_Result result = kRCX_TcpConnectError;
+	for(struct addrinfo *ai = list; ai; ai = ai->ai_next)
 	{
-		return kRCX_BindPortError;
+		result = Connect(ai);
+		if (result == kRCX_OK) break;
 	}
+	freeaddrinfo(list);
 
-	ttyAddr.sin_family = h->h_addrtype;
-	memcpy((char *) &ttyAddr.sin_addr.s_addr, h->h_addr_list[0], h->h_length);
-	ttyAddr.sin_port = htons(port);
-
-	if (connect(fd, (struct sockaddr *) &ttyAddr, sizeof(ttyAddr)) < 0)
+	if (result != kRCX_OK)
 	{
-		return kRCX_TcpConnectError;
+		return result;
 	}
 
-
         RCX_Result err = SetMode(mode);
         if (err != kRCX_OK)
         {
@@ -153,6 +162,52 @@ RCX_Result RCX_TcpPipe_linux::Open(const char *name, int mode)
 }
 
 
+/*
+ * The connect is done non-blocking so that a host that doesn't answer
+ * gives up after TCP_CONNECT_TIMEOUT rather than the system's own
+ * (much longer) timeout.  Nagle is turned off: every RCX message is a
+ * few bytes that the brick has to answer before the next one goes out,
+ * so holding them back for a delayed ACK only adds latency.
+ */
+RCX_Result RCX_TcpPipe_linux::Connect(const struct addrinfo *ai)
+{
+	fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+	if (fd < 0)
+	{
+		return kRCX_OpenSocketError;
+	}
+
+	int flags = fcntl(fd, F_GETFL, 0);
+	fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+
+	if (connect(fd, ai->ai_addr, ai->ai_addrlen) < 0)
+	{
+		struct pollfd pfd;
+		int err = 0;
+		socklen_t len = sizeof(err);
+
+		pfd.fd = fd;
+		pfd.events = POLLOUT;
+
+		if (errno != EINPROGRESS ||
+			poll(&pfd, 1, TCP_CONNECT_TIMEOUT) <= 0 ||
+			getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &len) < 0 ||
+			err != 0)
+		{
+			Close();
+			return kRCX_TcpConnectError;
+		}
+	}
+
+	fcntl(fd, F_SETFL, flags);
+
+	int one = 1;
+	setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+	return kRCX_OK;
+}
+
+
 void RCX_TcpPipe_linux::Close()
 {
 	if (fd < 0) return;
@@ -169,7 +224,9 @@ long RCX_TcpPipe_linux::Write(const void *ptr, long count)
 
 	actual = 0;
 	while(count > 0) {
-		if ((i = write(fd, (void *) &((char *)ptr)[actual], (size_t)count)) < 0)
+		// a brick that hangs up is an error, not a SIGPIPE that takes
+		// down every other link in the process
+		if ((i = send(fd, (void *) &((char *)ptr)[actual], (size_t)count, MSG_NOSIGNAL)) < 0)
 		{
 			return -1;
 		}
@@ -183,29 +240,15 @@ long RCX_TcpPipe_linux::Write(const void *ptr, long count)
 
 long RCX_TcpPipe_linux::Read(void *ptr, long count, long timeout_ms)
 {
-	int selectResult;
+	struct pollfd pfd;
 	ssize_t actual = 0;
 
-	FD_ZERO(&fds);
-	FD_SET(fd, &fds);
+	pfd.fd = fd;
+	pfd.events = POLLIN;
 
-	tv.tv_sec = (timeout_ms / 1000);
-	tv.tv_usec = (timeout_ms % 1000) * 1000;
-
-	selectResult = select(fd+1, &fds, NULL, NULL, &tv);
-
-	if (!FD_ISSET(fd, &fds))
+	// < 0 is an error, 0 a timeout
+	if (poll(&pfd, 1, (int)timeout_ms) > 0)
 	{
-		// fprintf(stderr, "NOT SET ERROR\n");
-	}
-
-
-	// selectResult  < 0 is a SELECT ERROR
-	// selectResult == 0 is a TIMEOUT
-	// selectResult >  0 is BYTES DETECTED
-	if (selectResult > 0)
-	{
-		// Bytes detected
 		if ((actual = read(fd, ptr, count)) < 0)
 		{
 			return 0;
@@ -241,25 +284,3 @@ RCX_Result RCX_TcpPipe_linux::SetMode(int mode)
 			return kRCX_PipeModeError;
 	}
 }
-
-/*
-void RCX_TcpPipe_linux::SetTimeout(long timeout_ms)
-{
-fprintf(stderr, "TCP Set Timeout\n");
-	FD_ZERO(&fds);
-	FD_SET(fd, &fds);
-
-	tv.tv_sec = (timeout_ms / 1000) + 2;
-	tv.tv_usec = (timeout_ms % 1000) * 1000;
-
-	if (select(fd+1, &fds, NULL, NULL, &tv) < 0)
-	{
-fprintf(stderr, "SELECT ERROR\n");
-	}
-
-	if (!FD_ISSET(fd, &fds))
-	{
-fprintf(stderr, "NOT SET ERROR\n");
-	}
-}
-*/
@@ -0,0 +1,101 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include "RCX_TimeoutHistory.h"
+
+using std::fopen;
+using std::strlen;
+using std::strtol;
+
+#define kTimeoutsHeader "nqc-timeouts 1\n"
+#define kMaxLine        1024
+
+
+RCX_TimeoutHistory::RCX_TimeoutHistory(const char *filename) :
+    fFilename(filename)
+{
+    Load();
+}
+
+
+bool RCX_TimeoutHistory::Find(const string &port, int &timeout) const
+{
+    map<string, int>::const_iterator i = fTimeouts.find(port);
+    if (i == fTimeouts.end()) return false;
+
+    timeout = i->second;
+    return true;
+}
+
+
+void RCX_TimeoutHistory::Store(const string &port, int timeout)
+{
+    map<string, int>::iterator i = fTimeouts.find(port);
+    if (i != fTimeouts.end() && i->second == timeout) return;
+
+    fTimeouts[port] = timeout;
+    Save();
+}
+
+
+/*
+ * The file holds one line per port:
+ *
+ *  <timeout in ms> <port name>
+ *
+ * Anything that doesn't parse ends the file.
+ */
+void RCX_TimeoutHistory::Load()
+{
+    FILE *fp = fopen(fFilename.c_str(), "r");
+    if (!fp) return;
+
+    char line[kMaxLine];
+
+    if (!fgets(line, sizeof(line), fp) || strcmp(line, kTimeoutsHeader) != 0) {
+        fclose(fp);
+        return;
+    }
+
+    while(fgets(line, sizeof(line), fp)) {
+        size_t n = strlen(line);
+        if (n && line[n-1]=='\n') line[--n] = 0;
+
+        char *port;
+        long timeout = strtol(line, &port, 10);
+        if (port == line || *port != ' ' || timeout <= 0 || timeout > 0xffff)
+            break;
+
+        fTimeouts[port + 1] = (int)timeout;
+    }
+
+    fclose(fp);
+}
+
+
+void RCX_TimeoutHistory::Save() const
+{
+    FILE *fp = fopen(fFilename.c_str(), "w");
+    if (!fp) return;
+
+    fputs(kTimeoutsHeader, fp);
+
+    map<string, int>::const_iterator i;
+    for(i = fTimeouts.begin(); i != fTimeouts.end(); ++i)
+        fprintf(fp, "%d %s\n", i->second, i->first.c_str());
+
+    fclose(fp);
+}
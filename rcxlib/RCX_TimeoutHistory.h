@@ -0,0 +1,45 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __RCX_TimeoutHistory_h
+#define __RCX_TimeoutHistory_h
+
+#include <string>
+#include <map>
+
+using std::string;
+using std::map;
+
+/*
+ * The reply timeout each port's transport settled on, saved in a file
+ * so that the next time the port is opened RCX_Link can start from it
+ * instead of learning it all over again.
+ */
+class RCX_TimeoutHistory
+{
+public:
+    RCX_TimeoutHistory(const char *filename);
+
+    bool Find(const string &port, int &timeout) const;
+    // the file is saved each time a timeout changes
+    void Store(const string &port, int timeout);
+
+private:
+    void Load();
+    void Save() const;
+
+    string fFilename;
+    map<string, int> fTimeouts;
+};
+
+#endif
@@ -0,0 +1,62 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#include "RCX_Trace.h"
+#include "RCX_LinkStats.h"
+
+using std::fprintf;
+
+static const char *sEventNames[] = {
+    "open",
+    "open_result",
+    "close",
+    "command",
+    "result",
+    "sync",
+    "tries",
+    "try",
+    "read",
+    "reply",
+    "retry",
+    "fail",
+    "timeout",
+    "firmware"
+};
+
+
+RCX_Trace::RCX_Trace() : fNext(0)
+{
+}
+
+
+double RCX_Trace::Now()
+{
+    return RCX_LinkStats::Now();
+}
+
+
+void RCX_Trace::Print(FILE *fp) const
+{
+    unsigned long first = (fNext > kSize) ? fNext - kSize : 0;
+
+    fprintf(fp, "# Link trace, last %lu of %lu events\n", fNext - first, fNext);
+    if (first == fNext) return;
+
+    double start = fEntries[first & (kSize - 1)].fTime;
+    for(unsigned long i=first; i<fNext; ++i) {
+        const Entry &e = fEntries[i & (kSize - 1)];
+        const char *name = (e.fEvent >= 0 && e.fEvent < kEventCount) ?
+            sEventNames[e.fEvent] : "?";
+        fprintf(fp, "%10.1f %-12s %d\n", e.fTime - start, name, e.fValue);
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+#ifndef __RCX_Trace_h
+#define __RCX_Trace_h
+
+#include <cstdio>
+
+using std::FILE;
+
+/**
+ * The last few hundred things a link and its transport did, each as a
+ * time, an event and a number, kept in memory until something asks for
+ * them.  Unlike PDEBUGVAR() output it costs next to nothing to add to,
+ * so timing problems on the link don't go away while it's watching.
+ * Only a link that has been given one (see RCX_Link::SetTrace()) adds
+ * to it.
+ */
+class RCX_Trace
+{
+public:
+    enum Event {
+        kOpenEvent = 0,     ///< link opened for a target
+        kOpenResultEvent,   ///< result of opening the port
+        kCloseEvent,        ///< link closed with this reply timeout
+        kCommandEvent,      ///< link sends a command with this opcode
+        kResultEvent,       ///< result of the command
+        kSyncEvent,         ///< link pings (and unlocks) the brick
+        kTriesEvent,        ///< transport sends a message up to this many times
+        kTryEvent,          ///< transport transmits the message, try number
+        kReadEvent,         ///< bytes read from the pipe, or 0 after a timeout
+        kReplyEvent,        ///< reply found, its length
+        kRetryEvent,        ///< try failed with this result
+        kFailEvent,         ///< gave up with this result
+        kTimeoutEvent,      ///< the reply timeout moved to this
+        kFirmwareEvent,     ///< firmware transfer of this many bytes
+        kEventCount
+    };
+
+    enum {
+        kSize = 512         ///< entries kept, a power of two
+    };
+
+            RCX_Trace();
+
+    void    Clear()         { fNext = 0; }
+    bool    IsEmpty() const { return fNext == 0; }
+
+    void    Add(Event event, int value) {
+        Entry &e = fEntries[fNext++ & (kSize - 1)];
+        e.fTime = Now();
+        e.fEvent = event;
+        e.fValue = value;
+    }
+
+    /// the entries still kept, oldest first, with times from the first
+    void    Print(FILE *fp) const;
+
+private:
+    struct Entry {
+        double  fTime;
+        int     fEvent;
+        int     fValue;
+    };
+
+    static double   Now();
+
+    Entry           fEntries[kSize];
+    unsigned long   fNext;      // entries ever added
+};
+
+#endif
@@ -12,11 +12,63 @@
  *
  */
 #include <cstdio>
+#include <cstring>
 #include "RCX_Transport.h"
 #include "RCX_Target.h"
 
 using std::printf;
 using std::putchar;
+using std::memcpy;
+
+
+void RCX_Transport::Frame(const UByte *txData, int txLength, bool /* retry */, RCX_Frames &frames) const
+{
+    memcpy(frames.Add(txLength), txData, txLength);
+    frames.Finish(txLength, txLength ? txData[0] : 0);
+}
+
+
+void RCX_Transport::FrameDownload(UShort seq, const UByte *data, int length,
+    bool /* retry */, RCX_Frames &frames) const
+{
+    UByte *ptr = frames.Add(length + 6);
+    UByte checksum = 0;
+
+    *ptr++ = kRCX_DownloadOp;
+    *ptr++ = (UByte)(seq & 0xff);
+    *ptr++ = (UByte)(seq >> 8);
+    *ptr++ = (UByte)(length & 0xff);
+    *ptr++ = (UByte)(length >> 8);
+
+    for (int i=0; i<length; i++) {
+        checksum += data[i];
+        *ptr++ = data[i];
+    }
+    *ptr = checksum;
+
+    frames.Finish(length + 6, kRCX_DownloadOp);
+}
+
+
+RCX_Result RCX_Transport::SendFrame(const RCX_Frames &frames, int index, UByte *rxData, int rxExpected, int rxMax, bool retry, int timeout)
+{
+    return Send(frames.GetData(index), frames.GetLength(index), rxData,
+        rxExpected, rxMax, retry, timeout);
+}
+
+
+int RCX_Transport::SendFrames(const RCX_Frames &frames, int first, int count, const int *rxExpected, UByte *rxData, int rxMax, RCX_Result *results, bool retry, int timeout)
+{
+    int i;
+
+    for (i=0; i<count; ++i) {
+        results[i] = SendFrame(frames, first + i, rxData + i * rxMax,
+            rxExpected[i], rxMax, retry, timeout);
+        if (RCX_ERROR(results[i])) return i + 1;
+    }
+
+    return count;
+}
 
 int bababooey = -3;
 
@@ -30,11 +30,76 @@
 #include "RCX_Target.h"
 #endif
 
+#include <vector>
+
+/*
+ * Messages framed ahead of time by RCX_Transport::Frame(), each with
+ * the command byte it goes out with.
+ */
+class RCX_Frames
+{
+public:
+    int GetCount() const { return (int)fFrames.size(); }
+    const UByte *GetData(int i) const { return &fData[fFrames[i].fOffset]; }
+    int GetLength(int i) const { return fFrames[i].fLength; }
+    UByte GetCommand(int i) const { return fFrames[i].fCommand; }
+
+    /// the command of the last frame, or the one last sent if there
+    /// are no frames
+    UByte GetLastCommand() const { return fLastCommand; }
+
+    void Clear(UByte lastCommand) {
+        fData.resize(0);
+        fFrames.resize(0);
+        fLastCommand = lastCommand;
+    }
+
+    /// start a frame of up to maxLength bytes and return where they go
+    UByte *Add(int maxLength) {
+        Frame f;
+        f.fOffset = (int)fData.size();
+        f.fLength = 0;
+        f.fCommand = 0;
+        fFrames.push_back(f);
+        fData.resize(fData.size() + maxLength);
+        return &fData[f.fOffset];
+    }
+
+    /// finish the frame started by Add()
+    void Finish(int length, UByte command) {
+        fData.resize(fFrames.back().fOffset + length);
+        fFrames.back().fLength = length;
+        fFrames.back().fCommand = command;
+        fLastCommand = command;
+    }
+
+private:
+    struct Frame {
+        int fOffset;
+        int fLength;
+        UByte fCommand;
+    };
+
+    std::vector<UByte> fData;
+    std::vector<Frame> fFrames;
+    UByte fLastCommand;
+};
+
+
+class RCX_LinkStats;
+class RCX_Trace;
 
 class RCX_Transport
 {
 public:
-    RCX_Transport() {}
+    /// how a transport moves its reply timeout as replies come and go
+    enum TimeoutPolicy {
+        kAdaptiveTimeout = 0,   ///< shrink by a tenth after a first try reply, double after a failed retry
+        kAverageTimeout,        ///< follow a running average of the reply times, double after a failed retry
+        kFixedTimeout           ///< keep the timeout it was opened with
+    };
+
+    RCX_Transport() : fStats(0), fTrace(0), fTimeoutPolicy(kAdaptiveTimeout) {}
     virtual ~RCX_Transport() {};
 
     virtual RCX_Result Open(RCX_TargetType target, const char *deviceName, ULong options) = 0;
@@ -42,16 +107,61 @@ public:
 
     virtual RCX_Result Send(const UByte *txData, int txLength, UByte *rxData, int rxExpected, int rxMax, bool retry, int timeout) = 0;
 
+    /*
+     * A series of messages can be framed before any of them is sent, so
+     * that nothing needs to be built between one reply and the next
+     * message.  Frames are added to frames (which must be cleared with
+     * the transport's last command first) and have to be sent in order
+     * with nothing else sent in between.  By default the frame is just
+     * the message and SendFrame() calls Send().
+     */
+    virtual void Frame(const UByte *txData, int txLength, bool retry, RCX_Frames &frames) const;
+    /// frame the download message for length bytes of data, the same
+    /// as Frame() of RCX_Cmd::MakeDownload() but straight from the data
+    virtual void FrameDownload(UShort seq, const UByte *data, int length, bool retry, RCX_Frames &frames) const;
+    virtual UByte GetLastCommand() const { return 0; }
+    virtual RCX_Result SendFrame(const RCX_Frames &frames, int index, UByte *rxData, int rxExpected, int rxMax, bool retry, int timeout);
+
+    /*
+     * Send count frames starting at first, as SendFrame() would each.
+     * Frame i (counting from first) expects rxExpected[i] bytes, its
+     * reply goes to rxData + i * rxMax and its result to results[i].
+     * Sending stops after the first frame that fails; the return is how
+     * many frames were sent (at least one), so only the last of them can
+     * have failed.  Transports whose driver takes several messages at
+     * once send up to GetQueueLength() frames in one go; the default
+     * just calls SendFrame() for each.
+     */
+    virtual int SendFrames(const RCX_Frames &frames, int first, int count, const int *rxExpected, UByte *rxData, int rxMax, RCX_Result *results, bool retry, int timeout);
+    /// most frames SendFrames() hands over together (1 if it doesn't queue)
+    virtual int GetQueueLength() const { return 1; }
+
     virtual bool FastModeSupported() const { return false; }
     virtual bool FastModeOddParity() const { return false; }
-    virtual void SetFastMode(bool /* fast */) { }
+    /// fails if the pipe can't be switched to fast mode
+    virtual RCX_Result SetFastMode(bool fast) { return fast ? kRCX_PipeModeError : kRCX_OK; }
     virtual bool GetFastMode() const { return false; }
     void SetOmitHeader(bool value) { fOmitHeader = value; }
+    /// timings of each packet are added to stats, if there are any
+    void SetStats(RCX_LinkStats *stats) { fStats = stats; }
+    /// what happens to each packet is added to trace, if there is one
+    void SetTrace(RCX_Trace *trace) { fTrace = trace; }
+    /// takes effect when the transport is opened
+    void SetTimeoutPolicy(TimeoutPolicy policy) { fTimeoutPolicy = policy; }
+    /// the reply timeout the transport has arrived at, or 0 if it doesn't have one
+    virtual int GetRxTimeout() const { return 0; }
     virtual bool GetComplementData() const { return false; }
+    /// number of times the last Send() had to transmit its message
+    virtual int GetLastTries() const { return 1; }
+    /// transmissions beyond the first of all the messages sent so far
+    virtual long GetRetries() const { return 0; }
 
 protected:
     static void DumpData(const UByte *ptr, int length);
     bool fOmitHeader;
+    RCX_LinkStats *fStats;
+    RCX_Trace *fTrace;
+    TimeoutPolicy fTimeoutPolicy;
 
 private:
 };
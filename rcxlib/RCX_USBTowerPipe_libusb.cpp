@@ -0,0 +1,421 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * The Initial Developer of this code is David Baum.
+ * Portions created by David Baum are Copyright (C) 1999 David Baum.
+ * All Rights Reserved.
+ *
+ * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
+ * All Rights Reserved.
+ *
+ */
+
+ /**
+  * @file RCX_USBTowerPipe_libusb.cpp
+  * @brief USB tower pipe for any platform libusb-1.0 supports
+  */
+
+/*
+ * The tower is driven straight from libusb rather than through a
+ * platform driver, so the Linux legousbtower module (and its fixed read
+ * timeout) isn't needed.  As in the OS X pipe, a read of the interrupt
+ * endpoint is kept outstanding and each packet goes into a ring, so
+ * Read() returns bytes that have already arrived at once, and otherwise
+ * waits only until the next packet comes in.
+ */
+
+#include <libusb.h>
+#include <chrono>
+#include <cstring>
+#include "RCX_Pipe.h"
+#include "PTypes.h"
+
+#include "PDebug.h"
+
+using std::strcmp;
+
+#define kVendorID       0x0694 // 1684 (Lego Group)
+#define kProductID      0x0001
+#define kConfiguration  0
+#define kInterface      0
+#define kReadEndpoint   (LIBUSB_ENDPOINT_IN | 1)
+#define kWriteEndpoint  (LIBUSB_ENDPOINT_OUT | 2)
+#define kWriteTimeout   1000    // ms for each packet written
+#define kControlTimeout 1000
+#define kCloseTimeout   1000    // ms for a cancelled read to come back
+
+// these should come from a LEGO include
+#define LTW_REQ_GET_PARM    1
+#define LTW_REQ_SET_PARM    2
+#define LTW_PARM_RANGE      2
+#define LTW_RANGE_SHORT     1
+#define LTW_RANGE_MEDIUM    2
+
+
+#define LTW_REQ_SET_TX_SPEED    0xEF
+#define LTW_REQ_SET_RX_SPEED    0xF1
+
+#define SPEED_COMM_BAUD_2400    0x0008
+#define SPEED_COMM_BAUD_4800    0x0010
+
+#define LTW_REQ_SET_TX_CARRIER_FREQUENCY    0xF4
+
+/**
+ * LEGO tower reply header
+ */
+typedef struct LTW_REQ_REPLY_HEADER {
+    UShort wNoOfBytes;      ///< Number of bytes in the reply
+    UByte bErrCode;         ///< Request return code
+    UByte bValue;           ///< Request return value
+} LTW_REQ_REPLY_HEADER;
+
+typedef LTW_REQ_REPLY_HEADER LTW_REQ_GET_SET_PARM_REPLY;
+
+
+class RCX_USBTowerPipe_libusb : public RCX_Pipe
+{
+public:
+    RCX_USBTowerPipe_libusb();
+    ~RCX_USBTowerPipe_libusb() {
+        Close();
+    }
+
+    virtual RCX_Result  Open(const char *name, int mode);
+    virtual void        Close();
+
+    virtual int         GetCapabilities() const;
+    virtual RCX_Result  SetMode(int mode);
+
+    virtual long        Read(void *ptr, long count, long timeout_ms);
+    virtual long        Write(const void *ptr, long count);
+    virtual bool        IsUSB() const { return true; };
+
+private:
+    enum
+    {
+        kReadPacketSize = 8,
+        kRingSize = 256         // a power of two
+    };
+
+    static void LIBUSB_CALL ReadCompletionGlue(libusb_transfer *transfer);
+    void        ReadCompletion(libusb_transfer *transfer);
+    void        StartRead();
+    void        HandleEvents(double timeout_ms);
+    long        ConsumeRing(unsigned char *ptr, long length);
+
+    int         Configure(int index);
+    int         ControlRequest(UByte request, UShort value);
+    int         ControlRequest(UByte request, UByte loByte, UByte hiByte) {
+                    return ControlRequest(request, loByte + (hiByte << 8));
+                }
+
+    static double Now();
+
+    libusb_context*         fContext;
+    libusb_device_handle*   fHandle;
+    bool                    fClaimed;
+
+    // the outstanding read, and the packets it has brought in
+    libusb_transfer*        fTransfer;
+    unsigned char           fInBuffer[kReadPacketSize];
+    bool                    fReadPending;
+
+    unsigned char   fRing[kRingSize];
+    unsigned        fRingHead;      // next byte to read
+    unsigned        fRingTail;      // next byte to fill
+};
+
+
+RCX_Pipe* RCX_NewUSBTowerPipe()
+{
+    return new RCX_USBTowerPipe_libusb();
+}
+
+
+RCX_USBTowerPipe_libusb::RCX_USBTowerPipe_libusb()
+    : fContext(0), fHandle(0), fClaimed(false), fTransfer(0),
+      fReadPending(false), fRingHead(0), fRingTail(0)
+{
+}
+
+
+RCX_Result RCX_USBTowerPipe_libusb::Open(const char *name, int mode)
+{
+    PDEBUGVAR("RCX_USBTowerPipe_libusb::Open mode", mode);
+    int err;
+    RCX_Result err2;
+
+    err = libusb_init(&fContext);
+    PREQUIRENOT(err, Fail_Init);
+
+    fHandle = libusb_open_device_with_vid_pid(fContext, kVendorID, kProductID);
+    PREQUIRE(fHandle, Fail_Open);
+
+    // take the tower from a kernel driver (legousbtower on Linux) while
+    // it's open; not every platform supports this, which is fine
+    libusb_set_auto_detach_kernel_driver(fHandle, 1);
+
+    err = Configure(kConfiguration);
+    PREQUIRENOT(err, Fail_Configure);
+
+    err = libusb_claim_interface(fHandle, kInterface);
+    PREQUIRENOT(err, Fail_Claim);
+    fClaimed = true;
+
+    fTransfer = libusb_alloc_transfer(0);
+    PREQUIRE(fTransfer, Fail_Alloc);
+
+    UByte range;
+    range = (name && strcmp(name, "short")==0) ? LTW_RANGE_SHORT : LTW_RANGE_MEDIUM;
+    ControlRequest(LTW_REQ_SET_PARM, LTW_PARM_RANGE, range);
+
+    // clear the input buffer
+    fRingHead = fRingTail = 0;
+
+    err2 = SetMode(mode);
+    if (err2 != kRCX_OK) {
+        Close();
+        return err2;
+    }
+    return kRCX_OK;
+
+Fail_Alloc:
+Fail_Claim:
+Fail_Configure:
+Fail_Open:
+Fail_Init:
+    Close();
+    return kRCX_OpenSerialError;
+}
+
+
+void RCX_USBTowerPipe_libusb::Close()
+{
+    if (fReadPending) {
+        // the cancelled read still completes, and that has to happen
+        // while the pipe is around to hear about it
+        libusb_cancel_transfer(fTransfer);
+        double end = Now() + kCloseTimeout;
+        while (fReadPending && Now() < end)
+            HandleEvents(end - Now());
+        fReadPending = false;
+    }
+
+    if (fTransfer) {
+        libusb_free_transfer(fTransfer);
+        fTransfer = 0;
+    }
+
+    if (fClaimed) {
+        libusb_release_interface(fHandle, kInterface);
+        fClaimed = false;
+    }
+
+    if (fHandle) {
+        libusb_close(fHandle);
+        fHandle = 0;
+    }
+
+    if (fContext) {
+        libusb_exit(fContext);
+        fContext = 0;
+    }
+}
+
+
+int RCX_USBTowerPipe_libusb::GetCapabilities() const
+{
+    return kNormalIrMode | kFastIrMode | kSpyboticsMode | kFastOddParityFlag | kAbsorb55Flag;
+}
+
+
+RCX_Result RCX_USBTowerPipe_libusb::SetMode(int mode)
+{
+    switch(mode) {
+        case kNormalIrMode:
+            ControlRequest(LTW_REQ_SET_TX_SPEED, SPEED_COMM_BAUD_2400);
+            ControlRequest(LTW_REQ_SET_RX_SPEED, SPEED_COMM_BAUD_2400);
+            return kRCX_OK;
+        case kFastIrMode:
+            ControlRequest(LTW_REQ_SET_PARM, LTW_PARM_RANGE, LTW_RANGE_SHORT);
+            ControlRequest(LTW_REQ_SET_TX_SPEED, SPEED_COMM_BAUD_4800);
+            ControlRequest(LTW_REQ_SET_RX_SPEED, SPEED_COMM_BAUD_4800);
+            ControlRequest(LTW_REQ_SET_TX_CARRIER_FREQUENCY, 38);
+            return kRCX_OK;
+        case kSpyboticsMode:
+            ControlRequest(LTW_REQ_SET_PARM, LTW_PARM_RANGE, LTW_RANGE_SHORT);
+            ControlRequest(LTW_REQ_SET_TX_SPEED, SPEED_COMM_BAUD_4800);
+            ControlRequest(LTW_REQ_SET_RX_SPEED, SPEED_COMM_BAUD_4800);
+            return kRCX_OK;
+        default:
+            return kRCX_PipeModeError;
+    }
+}
+
+
+#define MAX_PACKET 200
+
+long RCX_USBTowerPipe_libusb::Write(const void *ptr, long length)
+{
+    PDEBUGVAR("RCX_USBTowerPipe_libusb::Write length", length);
+    unsigned char *data = (unsigned char *)ptr;
+
+    int total = 0;
+
+    while (length > 0) {
+        int err;
+        int actual = 0;
+        int count = length;
+        if (count > MAX_PACKET) count = MAX_PACKET;
+
+        // libusb handles the read's events while it waits, so a reply
+        // that starts early still lands in the ring
+        err = libusb_interrupt_transfer(fHandle, kWriteEndpoint, data, count,
+            &actual, kWriteTimeout);
+        total += actual;
+        PREQUIRENOT(err, Fail_WritePipe);
+        if (actual != count) break;
+
+        length -= count;
+        data += count;
+    }
+
+Fail_WritePipe:
+    PDEBUGVAR("RCX_USBTowerPipe_libusb::Write total", total);
+    return total;
+}
+
+
+long RCX_USBTowerPipe_libusb::Read(void *data, long length, long timeout_ms)
+{
+    PDEBUGVAR("RCX_USBTowerPipe_libusb::Read", length);
+
+    // collect packets that came in since the last read
+    HandleEvents(0);
+
+    long n = ConsumeRing((unsigned char *)data, length);
+    if (n) return n;
+
+    // otherwise wait for the next packet with anything in it
+    StartRead();
+    double end = Now() + timeout_ms;
+    while (fRingHead == fRingTail && fReadPending) {
+        double left = end - Now();
+        if (left <= 0) break;
+        HandleEvents(left);
+    }
+
+    // if the time ran out the read is left outstanding, and whatever
+    // it gets is kept for next time
+    return ConsumeRing((unsigned char *)data, length);
+}
+
+
+void RCX_USBTowerPipe_libusb::HandleEvents(double timeout_ms)
+{
+    struct timeval tv;
+    long us = (long)(timeout_ms * 1000);
+
+    tv.tv_sec = us / 1000000;
+    tv.tv_usec = us % 1000000;
+    libusb_handle_events_timeout_completed(fContext, &tv, 0);
+}
+
+
+long RCX_USBTowerPipe_libusb::ConsumeRing(unsigned char *ptr, long length)
+{
+    long n = 0;
+
+    while (n < length && fRingHead != fRingTail) {
+        ptr[n++] = fRing[fRingHead++ & (kRingSize - 1)];
+    }
+
+    return n;
+}
+
+
+void RCX_USBTowerPipe_libusb::ReadCompletion(libusb_transfer *transfer)
+{
+    fReadPending = false;
+
+    switch (transfer->status) {
+        case LIBUSB_TRANSFER_COMPLETED:
+            for (int i = 0; i < transfer->actual_length; ++i) {
+                // a full ring loses its oldest byte, which would be stale anyway
+                if (fRingTail - fRingHead == kRingSize) ++fRingHead;
+                fRing[fRingTail++ & (kRingSize - 1)] = fInBuffer[i];
+            }
+            // right away, so nothing the tower sends is missed
+            StartRead();
+            break;
+        case LIBUSB_TRANSFER_TIMED_OUT:
+            StartRead();
+            break;
+        default:
+            // cancelled, or the tower has gone; Read() starts over
+            break;
+    }
+}
+
+
+void RCX_USBTowerPipe_libusb::StartRead()
+{
+    if (fReadPending) return;
+
+    libusb_fill_interrupt_transfer(fTransfer, fHandle, kReadEndpoint,
+        fInBuffer, kReadPacketSize, ReadCompletionGlue, this, 0);
+    int err = libusb_submit_transfer(fTransfer);
+    PREQUIRENOT(err, Fail_Submit);
+    fReadPending = true;
+
+Fail_Submit:
+    return;
+}
+
+
+void LIBUSB_CALL RCX_USBTowerPipe_libusb::ReadCompletionGlue(libusb_transfer *transfer)
+{
+    RCX_USBTowerPipe_libusb* pipe = (RCX_USBTowerPipe_libusb*)transfer->user_data;
+    pipe->ReadCompletion(transfer);
+}
+
+
+int RCX_USBTowerPipe_libusb::Configure(int index)
+{
+    libusb_config_descriptor *confDesc;
+    int current;
+    int err;
+
+    err = libusb_get_config_descriptor(libusb_get_device(fHandle), index, &confDesc);
+    PREQUIRENOT(err, Fail_GetConfiguration);
+
+    // setting the configuration the device already has resets it
+    err = libusb_get_configuration(fHandle, &current);
+    if (!err && current != confDesc->bConfigurationValue)
+        err = libusb_set_configuration(fHandle, confDesc->bConfigurationValue);
+    libusb_free_config_descriptor(confDesc);
+
+Fail_GetConfiguration:
+    return err;
+}
+
+
+int RCX_USBTowerPipe_libusb::ControlRequest(UByte request, UShort value)
+{
+    LTW_REQ_GET_SET_PARM_REPLY reply;
+
+    int n = libusb_control_transfer(fHandle,
+        LIBUSB_ENDPOINT_IN | LIBUSB_REQUEST_TYPE_VENDOR | LIBUSB_RECIPIENT_DEVICE,
+        request, value, 0, (unsigned char *)&reply, sizeof(reply), kControlTimeout);
+
+    return n < 0 ? n : 0;
+}
+
+
+double RCX_USBTowerPipe_libusb::Now()
+{
+    return std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
@@ -16,6 +16,8 @@
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <sys/ioctl.h>
+#include <poll.h>
+#include <errno.h>
 #include "RCX_Pipe.h"
 
 
@@ -36,7 +38,6 @@ public:
         virtual bool            IsUSB() const { return true; };
 
 private:
-	void		SetTimeout(long timeout_ms);
 	int		fd;
 };
 
@@ -116,8 +117,22 @@ long RCX_USBTowerPipe_linux::Write(const void *ptr, long count)
 long RCX_USBTowerPipe_linux::Read(void *ptr, long count, long timeout_ms)
 {
 	ssize_t actual;
-
-	SetTimeout(timeout_ms);
+	struct pollfd pfd;
+	int ready;
+
+	// wait until the driver has something for us (or the time is up)
+	// so a reply that is already there is read right away
+	pfd.fd = fd;
+	pfd.events = POLLIN;
+	do {
+		pfd.revents = 0;
+		ready = poll(&pfd, 1, (int)timeout_ms);
+	} while (ready < 0 && errno == EINTR);
+
+	if (ready <= 0 || !(pfd.revents & POLLIN))
+	{
+		return 0;
+	}
 
 	if ((actual = read(fd, ptr, count)) < 0)
 	{
@@ -151,17 +166,3 @@ RCX_Result RCX_USBTowerPipe_linux::SetMode(int mode)
 			return kRCX_PipeModeError;
 	}
 }
-
-
-void RCX_USBTowerPipe_linux::SetTimeout(long timeout_ms)
-{
-	usleep(timeout_ms * 1000 / 2);
-
-	if (timeout_ms == 0) {
-		timeout_ms = 20;
-	}
-
-	timeout_ms = ioctl(fd, LEGO_TOWER_SET_READ_TIMEOUT, timeout_ms);
-	return;
-}
-
@@ -96,14 +96,15 @@ public:
 private:
     enum
     {
-        kReadPacketSize = 8
+        kReadPacketSize = 8,
+        kRingSize = 256         // a power of two
     };
 
     static void ReadCompletionGlue(void *refCon, IOReturn result, void *arg0);
     void        ReadCompletion(IOReturn result, UInt32 n);
     void        StartRead();
-    void        ConsumeInBuffer();
-    void        SetTimeout(long timeout_ms);
+    void        RunPending(CFTimeInterval seconds);
+    long        ConsumeRing(unsigned char *ptr, long length);
 
     IOReturn    OpenDevice(short vendorID, short productID);
     IOReturn    Configure(int config);
@@ -116,15 +117,15 @@ private:
     IOUSBDeviceInterface**          fDevice;
     IOUSBInterfaceInterface182**    fInterface;
 
-    // buffered read data (sometimes more data is read from the endpoint than is needed)
+    // a read of the endpoint is kept outstanding whenever the pipe is
+    // being read, and each packet it gets goes into the ring, so bytes
+    // that arrive between calls to Read() are waiting for the next one
     unsigned char   fInBuffer[kReadPacketSize];
-    unsigned char*  fInBufferStart;
-    unsigned char*  fInBufferEnd;
+    bool            fReadPending;
 
-    // the pending read request
-    unsigned char*  fReadPtr;
-    int             fReadRemain;
-    bool            fReadDone;
+    unsigned char   fRing[kRingSize];
+    unsigned        fRingHead;      // next byte to read
+    unsigned        fRingTail;      // next byte to fill
 };
 
 
@@ -135,7 +136,7 @@ RCX_Pipe* RCX_NewUSBTowerPipe()
 
 
 RCX_USBTowerPipe_osx::RCX_USBTowerPipe_osx()
-    : fDevice(0), fInterface(0)
+    : fDevice(0), fInterface(0), fReadPending(false), fRingHead(0), fRingTail(0)
 {
 }
 
@@ -161,7 +162,7 @@ RCX_Result RCX_USBTowerPipe_osx::Open(const char *name, int mode)
     ControlRequest(LTW_REQ_SET_PARM, LTW_PARM_RANGE, range);
 
     // clear the input buffer
-    fInBufferStart = fInBufferEnd = fInBuffer;
+    fRingHead = fRingTail = 0;
 
     err2 = SetMode(mode);
     if (err2 != kRCX_OK) {
@@ -182,6 +183,14 @@ Fail_OpenDevice:
 void RCX_USBTowerPipe_osx::Close()
 {
     if (fInterface) {
+        // the aborted read still completes, and that has to happen
+        // while the pipe is around to hear about it
+        if (fReadPending) {
+            (*fInterface)->AbortPipe(fInterface, kReadPipe);
+            RunPending(1.0);
+            fReadPending = false;
+        }
+
         (*fInterface)->USBInterfaceClose(fInterface);
         (*fInterface)->Release(fInterface);
         fInterface = 0;
@@ -253,86 +262,91 @@ Fail_WritePipe:
 }
 
 
-void RCX_USBTowerPipe_osx::SetTimeout(long timeout_ms)
+long RCX_USBTowerPipe_osx::Read(void *data, long length, long timeout_ms)
 {
-    //usleep(timeout_ms * 1000 / 2);
-    sleep(timeout_ms / 1000);
+    PDEBUGVAR("RCX_USBTowerPipe_osx::Read", length);
+
+    // collect packets that came in since the last read
+    RunPending(0);
+
+    long n = ConsumeRing((unsigned char *)data, length);
+    if (n) return n;
+
+    // otherwise wait for the next packet with anything in it
+    StartRead();
+    CFAbsoluteTime end = CFAbsoluteTimeGetCurrent() + timeout_ms / 1000.0;
+    while (fRingHead == fRingTail && fReadPending) {
+        CFTimeInterval left = end - CFAbsoluteTimeGetCurrent();
+        if (left <= 0) break;
+        CFRunLoopRunInMode(kCFRunLoopDefaultMode, left, true);
+    }
+
+    // if the time ran out the read is left outstanding, and whatever
+    // it gets is kept for next time
+    return ConsumeRing((unsigned char *)data, length);
 }
 
 
-long RCX_USBTowerPipe_osx::Read(void *data, long length, long timeout_ms)
+/*
+ * Handle the completions that are ready, or that turn up within seconds
+ * while a read is outstanding.
+ */
+void RCX_USBTowerPipe_osx::RunPending(CFTimeInterval seconds)
 {
-    PDEBUGVAR("RCX_USBTowerPipe_osx::Read", length);
-    fReadPtr = (unsigned char *)data;
-    fReadRemain = length;
-    fReadDone = false;
-
-    // This doesn't seem to work
-    //SetTimeout(timeout_ms);
-
-    // consume any previously buffered data
-    ConsumeInBuffer();
-
-    if (!fReadDone) {
-        StartRead();
-        do {
-            SInt32 reason = CFRunLoopRunInMode(kCFRunLoopDefaultMode,
-                timeout_ms / 1000.0, true);
-            if (reason == kCFRunLoopRunTimedOut) {
-                (*fInterface)->AbortPipe(fInterface, kReadPipe);
-                fReadDone = true;
-            }
-        } while(!fReadDone);
-    }
+    CFAbsoluteTime end = CFAbsoluteTimeGetCurrent() + seconds;
 
-    return fReadPtr - (unsigned char *)data;
+    while (fReadPending) {
+        CFTimeInterval left = end - CFAbsoluteTimeGetCurrent();
+        if (left < 0) left = 0;
+        if (CFRunLoopRunInMode(kCFRunLoopDefaultMode, left, true)
+            != kCFRunLoopRunHandledSource) break;
+    }
 }
 
 
-void RCX_USBTowerPipe_osx::ConsumeInBuffer()
+long RCX_USBTowerPipe_osx::ConsumeRing(unsigned char *ptr, long length)
 {
-    while(fReadRemain && (fInBufferStart < fInBufferEnd)) {
-        *fReadPtr++ = *fInBufferStart++;
-        fReadRemain--;
+    long n = 0;
+
+    while (n < length && fRingHead != fRingTail) {
+        ptr[n++] = fRing[fRingHead++ & (kRingSize - 1)];
     }
 
-    if (fReadRemain==0) fReadDone = true;
+    return n;
 }
 
 
 void RCX_USBTowerPipe_osx::ReadCompletion(IOReturn result, UInt32 n)
 {
+    fReadPending = false;
     if (result == kIOReturnAborted) return;
 
     PREQUIRENOT(result, Fail_ReadCompletion);
 
-    // consume input buffer
-    fInBufferEnd = fInBuffer + n;
-    ConsumeInBuffer();
-
-    if (!fReadDone) {
-        StartRead();
+    for (UInt32 i = 0; i < n; ++i) {
+        // a full ring loses its oldest byte, which would be stale anyway
+        if (fRingTail - fRingHead == kRingSize) ++fRingHead;
+        fRing[fRingTail++ & (kRingSize - 1)] = fInBuffer[i];
     }
 
-    return;
+    // right away, so nothing the tower sends is missed
+    StartRead();
 
 Fail_ReadCompletion:
-    fReadDone = true;
+    return;
 }
 
 
 void RCX_USBTowerPipe_osx::StartRead()
 {
-    // clear the input buffer
-    fInBufferStart = fInBufferEnd = fInBuffer;
+    if (fReadPending) return;
 
     IOReturn err = (*fInterface)->ReadPipeAsync(fInterface, kReadPipe,
         fInBuffer, kReadPacketSize, ReadCompletionGlue ,this);
     PREQUIRENOT(err, Fail_ReadPipe);
-    return;
+    fReadPending = true;
 
 Fail_ReadPipe:
-    fReadDone = true;
     return;
 }
 
@@ -12,19 +12,32 @@
  *
  */
 #include <windows.h>
+#include <cstring>
+#include <vector>
 #include "RCX_Pipe.h"
 #include "PTypes.h"
 #include "USBTowerWin.h"
 
+using std::memcpy;
+using std::memset;
+using std::vector;
 
-#define K_WRITE_WAIT 40
+#define K_USB_READ_FIRST 70
 #define K_USB_WRITE 0
 #define K_USB_READ  20
 
+#define K_READ_AHEAD 256
+
 /*
  * This file provides USB tower support by thunking over to the
  * \\.\LEGOTOWER1 device which is almost like a serial port.
  *
+ * The device is opened for overlapped I/O.  A read is always left
+ * outstanding into a read-ahead buffer, so Read() returns as soon as
+ * the driver hands over the first bytes of a reply (or whatever arrived
+ * while nobody was reading), rather than sleeping for part of the
+ * timeout first.  Write() returns once the driver has the message, and
+ * the write is finished off before the next one or a read.
  */
 
 class RCX_USBTowerPipe_win : public RCX_Pipe
@@ -46,11 +59,23 @@ public:
 
 protected:
 private:
-	void	SetTimeout(long);
+	bool	StartRead();
+	void	FinishRead(bool wait);
+	void	FinishWrite();
+	void	CancelRead();
         void    FlushWrite();
 	HANDLE	fFile;
-        DWORD   fLastWrite;
         bool TowerAPILoaded;
+
+	OVERLAPPED	fReadOverlapped;
+	bool	fReadPending;
+	UByte	fReadAhead[K_READ_AHEAD];
+	int	fReadStart;	// bytes of fReadAhead not yet returned by Read()
+	int	fReadEnd;
+
+	OVERLAPPED	fWriteOverlapped;
+	bool	fWritePending;
+	vector<UByte>	fWriteData;	// has to stay put until the write is done
 };
 
 
@@ -65,6 +90,11 @@ RCX_Pipe* RCX_NewUSBTowerPipe()
 
 RCX_USBTowerPipe_win::RCX_USBTowerPipe_win() : fFile(INVALID_HANDLE_VALUE)
 {
+	memset(&fReadOverlapped, 0, sizeof(fReadOverlapped));
+	memset(&fWriteOverlapped, 0, sizeof(fWriteOverlapped));
+	fReadPending = false;
+	fWritePending = false;
+	fReadStart = fReadEnd = 0;
 }
 
 RCX_Result RCX_USBTowerPipe_win::Open(const char *name, int mode)
@@ -76,10 +106,28 @@ RCX_Result RCX_USBTowerPipe_win::Open(const char *name, int mode)
 	}
 
 	fFile = CreateFile(name, GENERIC_READ | GENERIC_WRITE,
-		0, 0, OPEN_EXISTING, 0, 0);
+		0, 0, OPEN_EXISTING, FILE_FLAG_OVERLAPPED, 0);
 
 	if (fFile == INVALID_HANDLE_VALUE) return kRCX_OpenSerialError;
 
+	// manual reset events, so a finished read stays signalled until
+	// it's been collected
+	fReadOverlapped.hEvent = CreateEvent(0, TRUE, FALSE, 0);
+	fWriteOverlapped.hEvent = CreateEvent(0, TRUE, FALSE, 0);
+	if (!fReadOverlapped.hEvent || !fWriteOverlapped.hEvent)
+	{
+		Close();
+		return kRCX_OpenSerialError;
+	}
+
+	// usb tower doesn't support SetCommTimeouts; the driver's own
+	// timeouts only decide when a read with nothing to show finishes,
+	// Read() waits as long as it was asked to
+	if (TowerAPILoaded)
+	{
+		TOWER.SetTimeouts(fFile, K_USB_READ_FIRST, K_USB_READ, K_USB_WRITE);
+	}
+
         RCX_Result err = SetMode(mode);
         if (RCX_ERROR(err))
         {
@@ -94,27 +142,58 @@ void RCX_USBTowerPipe_win::Close()
 {
 	if (fFile == INVALID_HANDLE_VALUE) return;
 
+	CancelRead();
+	FinishWrite();
+
 	CloseHandle(fFile);
 	fFile = INVALID_HANDLE_VALUE;
+
+	if (fReadOverlapped.hEvent) CloseHandle(fReadOverlapped.hEvent);
+	if (fWriteOverlapped.hEvent) CloseHandle(fWriteOverlapped.hEvent);
+	fReadOverlapped.hEvent = 0;
+	fWriteOverlapped.hEvent = 0;
 }
 
 
 long RCX_USBTowerPipe_win::Write(const void *ptr, long count)
 {
-        DWORD actual = 10;
+	DWORD actual;
 
-        long result;
+	// the last message's buffer is reused
+	FinishWrite();
 
-        if (!WriteFile(fFile, ptr, count, &actual, 0))
-            result = -1;
-        else
-            result = actual;
+	fWriteData.assign((const UByte *)ptr, (const UByte *)ptr + count);
+	ResetEvent(fWriteOverlapped.hEvent);
 
-        FlushWrite();
+	if (WriteFile(fFile, &fWriteData[0], count, &actual, &fWriteOverlapped))
+	{
+		// done already
+		FlushWrite();
+		return actual;
+	}
 
-        return result;
+	if (GetLastError() != ERROR_IO_PENDING) return -1;
+
+	fWritePending = true;
+	return count;
 }
 
+
+void RCX_USBTowerPipe_win::FinishWrite()
+{
+	DWORD actual;
+
+	if (!fWritePending) return;
+
+	// a write that failed leaves the reply missing, which the
+	// transport already deals with
+	GetOverlappedResult(fFile, &fWriteOverlapped, &actual, TRUE);
+	fWritePending = false;
+
+	FlushWrite();
+}
+
+
 void RCX_USBTowerPipe_win::FlushWrite()
 {
   if (TowerAPILoaded)
@@ -129,21 +208,95 @@ void RCX_USBTowerPipe_win::FlushWrite()
 
 long RCX_USBTowerPipe_win::Read(void *ptr, long count, long timeout_ms)
 {
-	DWORD actual = 10;
+	DWORD start = GetTickCount();
+
+	FinishWrite();
+
+	while(fReadStart == fReadEnd)
+	{
+		if (!fReadPending && !StartRead()) return 0;
+
+		DWORD elapsed = GetTickCount() - start;
+
+		if (!fReadPending)
+		{
+			// finished right away, perhaps with nothing
+			if (fReadStart == fReadEnd && (long)elapsed >= timeout_ms) return 0;
+			continue;
+		}
+
+		if ((long)elapsed >= timeout_ms) return 0;
+
+		// the read stays outstanding if the time runs out, and
+		// whatever it gets is kept for the next Read()
+		if (WaitForSingleObject(fReadOverlapped.hEvent,
+			timeout_ms - elapsed) != WAIT_OBJECT_0) return 0;
+
+		FinishRead(false);
+	}
+
+	int n = fReadEnd - fReadStart;
+	if (n > count) n = count;
+	memcpy(ptr, fReadAhead + fReadStart, n);
+	fReadStart += n;
+
+	return n;
+}
+
+
+/*
+ * Issue a read into the (empty) read-ahead buffer.  It may finish right
+ * away, otherwise it's left pending.
+ */
+bool RCX_USBTowerPipe_win::StartRead()
+{
+	DWORD actual;
 
-	SetTimeout(timeout_ms);
+	fReadStart = fReadEnd = 0;
+	ResetEvent(fReadOverlapped.hEvent);
 
-	if (!ReadFile(fFile, ptr, count, &actual, 0))
+	if (ReadFile(fFile, fReadAhead, K_READ_AHEAD, &actual, &fReadOverlapped))
 	{
-		GetLastError();
-		DWORD Errors;
-		COMSTAT cstat;
-		ClearCommError( fFile, &Errors, &cstat );
+		fReadEnd = actual;
+		return true;
+	}
 
-		return 0;
+	if (GetLastError() == ERROR_IO_PENDING)
+	{
+		fReadPending = true;
+		return true;
 	}
 
-	return actual;
+	DWORD Errors;
+	COMSTAT cstat;
+	ClearCommError( fFile, &Errors, &cstat );
+
+	return false;
+}
+
+
+void RCX_USBTowerPipe_win::FinishRead(bool wait)
+{
+	DWORD actual = 0;
+
+	if (!GetOverlappedResult(fFile, &fReadOverlapped, &actual, wait))
+		actual = 0;
+
+	fReadPending = false;
+	fReadStart = 0;
+	fReadEnd = actual;
+}
+
+
+void RCX_USBTowerPipe_win::CancelRead()
+{
+	if (fReadPending)
+	{
+		CancelIo(fFile);
+		FinishRead(true);
+	}
+
+	fReadStart = fReadEnd = 0;
 }
 
 
@@ -190,20 +343,11 @@ RCX_Result RCX_USBTowerPipe_win::SetMode(int mode)
 }
 
 
-void RCX_USBTowerPipe_win::SetTimeout(long ms)
-{
-	Sleep(ms / 2);
-	// usb tower doesn't support SetCommTimeouts
-	if (TowerAPILoaded)
-	{
-		TOWER.SetTimeouts(fFile, 70, K_USB_READ, K_USB_WRITE);
-	}
-}
-
 void RCX_USBTowerPipe_win::FlushRead(int delay)
 {
 	if (TowerAPILoaded)
 	{
+		CancelRead();
 		TOWER.Flush(fFile, LT_FLUSH_RX_BUFFER);
 	}
 	else
@@ -44,7 +44,9 @@ long rcx_pipe_read(void *pipe, void *ptr, long count, long timeout_ms)
 
 long rcx_pipe_write(void *pipe, const void *ptr, long count)
 {
-  return ((RCX_Pipe *) pipe)->Write(ptr, count);
+  long n = ((RCX_Pipe *) pipe)->Write(ptr, count);
+  ((RCX_Pipe *) pipe)->FlushWrite();
+  return n;
 }
 
 #ifdef USE_TRANSPORT
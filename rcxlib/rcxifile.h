@@ -41,11 +41,22 @@
  *
  * @version 1.02 -
  *  added fTargetType field in RCXIHeader
+ *
+ * @version 1.03 -
+ *  added an optional debug section.  A 1.03 header is followed by a long
+ *  holding the file offset of an RCXIDebugHeader, then the fragments and
+ *  symbols as before.  The debug header is followed by the names of the
+ *  source files (each an RCXIFileHeader and the padded name), and gives
+ *  the offsets of the source tags and the line index.  Both of those are
+ *  lists of fragments, each an RCXIDebugFragment followed by its entries.
+ *  Files without debug information are still written as version 1.02.
  */
 
 /* Constants for the RCXIHeader */
 #define kRCXI_Signature         0x49584352  ///< "RCXI"
-#define kRCXI_CurrentVersion    0x102       ///< Version 1.02
+#define kRCXI_CurrentVersion    0x103       ///< Version 1.03
+#define kRCXI_DebugVersion      0x103       ///< first version with a debug section
+#define kRCXI_PlainVersion      0x102       ///< written when there's no debug section
 
 /* Fragment types */
 enum
@@ -93,6 +104,189 @@ struct RCXISymbolHeader
 };
 
 
+/* RCX Image Debug Header (version 1.03) */
+struct RCXIDebugHeader
+{
+    unsigned short  fFileCount;     ///< Number of source file names
+    unsigned short  fReserved_;     ///< Should be 0
+    unsigned long   fTagOffset;     ///< File offset of the source tags
+    unsigned short  fTagFragments;  ///< Fragments with source tags
+    unsigned short  fLineFragments; ///< Fragments with line entries
+    unsigned long   fLineOffset;    ///< File offset of the line index
+};
+
+
+/* Source file name, followed by the padded name */
+struct RCXIFileHeader
+{
+    unsigned short  fLength;        ///< Length including terminating null, 0 if unknown
+    unsigned short  fReserved_;     ///< Should be 0
+};
+
+
+/* Start of the tags or lines of one fragment */
+struct RCXIDebugFragment
+{
+    unsigned char   fType;          ///< Fragment type
+    unsigned char   fIndex;         ///< Fragment index
+    unsigned short  fCount;         ///< Number of entries that follow
+};
+
+
+/* Source tag, as in RCX_SourceTag */
+struct RCXITag
+{
+    unsigned char   fType;          ///< RCX_SourceTag type
+    unsigned char   fReserved_;     ///< Should be 0
+    unsigned short  fAddress;       ///< Bytecode offset
+    unsigned short  fSourceIndex;   ///< Source file index
+    unsigned short  fReserved2_;    ///< Should be 0
+    unsigned long   fSourceOffset;  ///< Offset within the source file
+};
+
+
+/* Line index entry: the code from fAddress up to the next entry's
+   address comes from line fLine (starting at 1) of the source file */
+struct RCXILine
+{
+    unsigned short  fAddress;       ///< Bytecode offset
+    unsigned short  fSourceIndex;   ///< Source file index
+    unsigned long   fLine;          ///< Line number
+};
+
+
+/*
+ * An RCX bundle file holds the images for several program slots, to be
+ * downloaded in one session.  It consists of an RCXBHeader, the padded
+ * name of an optional firmware file, and then each program: an
+ * RCXBProgramHeader followed by a complete (padded) RCX Image.
+ */
+
+/* Constants for the RCXBHeader */
+#define kRCXB_Signature         0x42584352  ///< "RCXB"
+#define kRCXB_CurrentVersion    0x100       ///< Version 1.00
+
+
+/* RCX Bundle Header */
+struct RCXBHeader
+{
+    unsigned long   fSignature;     ///< Signature (must be kRCXB_Signature)
+    unsigned short  fVersion;       ///< Version (kRCXB_CurrentVersion)
+    unsigned short  fProgramCount;  ///< Number of programs
+    unsigned short  fFirmwareLength;///< Length of firmware name including nul, 0 if none
+    unsigned short  fReserved_;     ///< Should be 0
+};
+
+
+/* RCX Bundle Program Header */
+struct RCXBProgramHeader
+{
+    unsigned char   fSlot;          ///< Program slot (starting at 1, 0 = current)
+    unsigned char   fReserved_;     ///< Should be 0
+    unsigned short  fReserved2_;    ///< Should be 0
+    unsigned long   fLength;        ///< Unpadded length of the image
+};
+
+
+/*
+ * An RCX object file holds the image of a single source file compiled
+ * on its own, to be linked with others into one program.  It consists
+ * of an RCXOHeader, the (padded) RCX Image, the symbols (each an
+ * RCXOSymbolHeader followed by the padded name) and the relocations.
+ * The image's variables, subs and tasks are numbered as if it were a
+ * whole program; each relocation gives a byte of its code that holds
+ * one of those numbers.
+ */
+
+/* Constants for the RCXOHeader */
+#define kRCXO_Signature         0x4f584352  ///< "RCXO"
+#define kRCXO_CurrentVersion    0x100       ///< Version 1.00
+
+
+/* Object symbol types */
+enum
+{
+    kRCXO_GlobalSymbol = 0,     ///< a global variable the object declares
+    kRCXO_SubImport,            ///< a sub the object calls but doesn't define
+    kRCXO_TaskImport            ///< a task the object uses but doesn't define
+};
+
+
+/* Relocation types */
+enum
+{
+    kRCXO_VarRelocation = 0,
+    kRCXO_SubRelocation,
+    kRCXO_TaskRelocation
+};
+
+
+/* RCX Object Header */
+struct RCXOHeader
+{
+    unsigned long   fSignature;     ///< Signature (must be kRCXO_Signature)
+    unsigned short  fVersion;       ///< Version (kRCXO_CurrentVersion)
+    unsigned short  fSymbolCount;   ///< Number of symbols
+    unsigned short  fRelocationCount;   ///< Number of relocations
+    unsigned short  fReserved_;     ///< Should be 0
+    unsigned long   fImageLength;   ///< Unpadded length of the image
+};
+
+
+/* RCX Object Symbol Header, followed by the padded name */
+struct RCXOSymbolHeader
+{
+    unsigned char   fType;          ///< Object symbol type
+    unsigned char   fIndex;         ///< First variable, or the sub or task number
+    unsigned char   fCount;         ///< Number of variables (globals only)
+    unsigned char   fLength;        ///< Length including terminating null
+};
+
+
+/* RCX Object Relocation */
+struct RCXORelocation
+{
+    unsigned char   fType;          ///< Relocation type
+    unsigned char   fChunkType;     ///< Fragment type of the code
+    unsigned char   fChunkIndex;    ///< Fragment index of the code
+    unsigned char   fReserved_;     ///< Should be 0
+    unsigned short  fOffset;        ///< Offset of the byte within the code
+    unsigned short  fReserved2_;    ///< Should be 0
+};
+
+
+/*
+ * An RCX log store holds datalogs as they were uploaded, one record
+ * after another, so that more can be appended.  It starts with an
+ * RCXLHeader; each record is an RCXLRecordHeader followed by the
+ * padded port name and then the log by column: the (padded) entry
+ * types, one byte each, and the (padded) values, two bytes each.
+ */
+
+/* Constants for the RCXLHeader */
+#define kRCXL_Signature         0x4c584352  ///< "RCXL"
+#define kRCXL_CurrentVersion    0x100       ///< Version 1.00
+
+
+/* RCX Log Store Header */
+struct RCXLHeader
+{
+    unsigned long   fSignature;     ///< Signature (must be kRCXL_Signature)
+    unsigned short  fVersion;       ///< Version (kRCXL_CurrentVersion)
+    unsigned short  fReserved_;     ///< Should be 0
+};
+
+
+/* RCX Log Store Record Header */
+struct RCXLRecordHeader
+{
+    unsigned long   fTime;          ///< When the log was uploaded, in seconds since 1970
+    unsigned short  fPortLength;    ///< Length of the port name including nul
+    unsigned short  fReserved_;     ///< Should be 0
+    unsigned long   fCount;         ///< Number of entries
+};
+
+
 /** A macro to compute padded data length. */
 #define RCXI_PADDED_LENGTH(len) (((len) + 3) & ~3)
 
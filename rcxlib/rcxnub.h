@@ -0,0 +1,7 @@
+static const unsigned char rcxnub[]={
+0x79,0x06,0x00,0x0f,0x6b,0x86,0xee,0x80,0x79,0x06,0xee,0x64,0x6d,0xf6,0x79,0x06,
+0xee,0x74,0x5e,0x00,0x3b,0x9a,0x0b,0x87,0x79,0x06,0xee,0x5e,0x5e,0x00,0x06,0x88,
+0x7f,0xd8,0x72,0x50,0xfe,0x67,0x3e,0xd9,0x18,0xee,0x6a,0x8e,0xef,0x51,0xfe,0x02,
+0x6a,0x8e,0xef,0x06,0xfe,0x0d,0x6a,0x8e,0xee,0x5e,0x54,0x70,0x44,0x6f,0x20,0x79,
+0x6f,0x75,0x20,0x62,0x79,0x74,0x65,0x2c,0x20,0x77,0x68,0x65,0x6e,0x20,0x49,0x20,
+0x6b,0x6e,0x6f,0x63,0x6b,0x3f,0x00,0x00,};
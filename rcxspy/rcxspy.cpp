@@ -10,69 +10,282 @@
  * Portions created by John Hansen are Copyright (C) 2005 John Hansen.
  * All Rights Reserved.
  *
- */#include <cstdio>
+ */
+
+/*
+ * rcxspy listens to the IR traffic in front of a tower and prints each
+ * command and reply that goes by, the programs that are downloaded, and
+ * (when it's stopped) how long the replies took and how often commands
+ * had to be sent again.
+ *
+ *	rcxspy [-v] [-T<target>] [-w <file>] [<device>]	capture (and record to <file>)
+ *	rcxspy [-v] [-T<target>] -r <file>		decode a recording
+ *
+ * Capturing is split from decoding: the capture thread does nothing
+ * but read frames off the tower, stamp them and hand them over (and
+ * write them to the recording), so printing a long disassembly never
+ * makes it miss a frame.  The decoder takes the frames from a ring
+ * buffer that needs no locks, since there's only one of each.
+ *
+ * A recording is the 8 byte header "RCXSPY1\n" followed by the frames,
+ * each a 4 byte time in ms and 2 byte length (both little endian) and
+ * then the frame's bytes, checksum taken out.
+ */
+#include <cstdio>
+#include <cstring>
+#include <csignal>
+#include <vector>
+#include <map>
+#include <string>
 #include "RCX_Disasm.h"
 #include "RCX_Pipe.h"
 #include "RCX_PipeTransport.h"
 #include "RCX_Link.h"
 
-class Reader
+#if !defined(NO_THREADS) && (__cplusplus < 201103L || \
+	(defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)))
+#define NO_THREADS
+#endif
+
+#ifndef NO_THREADS
+#include <atomic>
+#include <chrono>
+#include <thread>
+#else
+#include <ctime>
+#endif
+
+using std::vector;
+using std::map;
+using std::string;
+
+#define kFileHeader	"RCXSPY1\n"
+#define kFileHeaderSize	8
+
+static const int MAX_PACKET = 1024;
+
+/// These MUST be in the same order as the RCX_TargetType values
+static const char *sTargetNames[] = {
+	"RCX",
+	"CM",
+	"Scout",
+	"RCX2",
+	"Spy",
+	"Swan"
+};
+
+static volatile sig_atomic_t sStop = 0;
+
+static void Stop(int /* sig */)
 {
-public:
-	Reader();
-	~Reader();
+	sStop = 1;
+}
 
-	bool open(const char *name);
-	void close();
+struct Frame
+{
+	ULong	time;
+	int	length;
+	UByte	data[MAX_PACKET];
+};
+
+
+#ifndef NO_THREADS
+/*
+ * Frames on their way from the capture thread to the decoder.  Only
+ * the capture thread moves fHead and only the decoder moves fTail.
+ */
+class FrameRing
+{
+public:
+	FrameRing(int size) : fFrames(size), fHead(0), fTail(0) {}
 
-	void poll();
+	// the frame to fill in next, or 0 if the decoder is that far behind
+	Frame*	Reserve();
+	void	Commit();
 
-	void beginDownload();
-	void continueDownload();
+	// the oldest frame not yet decoded, or 0 if there are none
+	Frame*	Peek();
+	void	Release();
 
 private:
-	static const int MAX_PACKET = 1024;
+	vector<Frame>		fFrames;
+	std::atomic<unsigned>	fHead;
+	std::atomic<unsigned>	fTail;
+};
+
 
+Frame* FrameRing::Reserve()
+{
+	unsigned head = fHead.load(std::memory_order_relaxed);
+	if (head - fTail.load(std::memory_order_acquire) == fFrames.size()) return 0;
+	return &fFrames[head % fFrames.size()];
+}
+
+
+void FrameRing::Commit()
+{
+	fHead.store(fHead.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+
+Frame* FrameRing::Peek()
+{
+	unsigned tail = fTail.load(std::memory_order_relaxed);
+	if (tail == fHead.load(std::memory_order_acquire)) return 0;
+	return &fFrames[tail % fFrames.size()];
+}
+
+
+void FrameRing::Release()
+{
+	fTail.store(fTail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+#endif
+
+
+/*
+ * Reads frames off the tower and stamps them with the time since the
+ * capture started.
+ */
+class Capture
+{
+public:
+	Capture();
+	~Capture();
+
+	bool open(RCX_TargetType target, const char *name, const char *recording);
+	void close();
+
+	// wait up to 100ms for a frame
+	bool read(Frame &frame);
+
+private:
 	RCX_PipeTransport*	transport;
+	FILE*			file;
+	ULong			start;
+};
+
 
-	UByte packet[MAX_PACKET];
-	int packetLength;
+/*
+ * Prints the frames it's given, commands disassembled with the
+ * target's opcode tables and replies matched up with the command they
+ * answer.  Follows the downloads too, printing each program once all of
+ * it has gone by.
+ */
+class Decoder
+{
+public:
+	Decoder(RCX_TargetType target, bool verbose);
+	~Decoder();
 
-	UByte* code;
-	ULong codeLength;
-	ULong codePos;
-	ULong lastBlock;
+	void decode(const Frame &frame);
+	void printStats() const;
+
+private:
+	struct OpStats {
+		string	name;
+		ULong	commands;
+		ULong	retries;
+		ULong	replies;
+		ULong	totalLatency;
+		ULong	minLatency;
+		ULong	maxLatency;
+	};
+
+	void decodeCommand(const Frame &frame);
+	void decodeReply(const Frame &frame);
+	void printFrame(const Frame &frame, const char *dir, const char *text);
+
+	void beginDownload(const Frame &frame, RCX_ChunkType type);
+	void continueDownload(const Frame &frame);
+
+	RCX_Disasm	disasm;
+	bool		verbose;
+
+	map<int, OpStats>	stats;
+	UByte		lastCommand[MAX_PACKET];
+	int		lastCommandLength;
+	ULong		lastCommandTime;
+	bool		replied;
+
+	RCX_ChunkType	type;
+	int		number;
+	UByte*		code;
+	ULong		codeLength;
+	ULong		codePos;
+	ULong		lastBlock;
 };
 
 
-Reader::Reader()
+static ULong Now()
+{
+#ifndef NO_THREADS
+	return (ULong)std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+#else
+	return (ULong)std::time(0) * 1000;
+#endif
+}
+
+
+static void PutLE(UByte *ptr, ULong value, int bytes)
+{
+	for (int i=0; i<bytes; ++i)
+		ptr[i] = (UByte)(value >> (8 * i));
+}
+
+
+static ULong GetLE(const UByte *ptr, int bytes)
+{
+	ULong value = 0;
+	for (int i=bytes-1; i>=0; --i)
+		value = (value << 8) | ptr[i];
+	return value;
+}
+
+
+Capture::Capture() : transport(0), file(0), start(0)
 {
 }
 
-Reader::~Reader()
+Capture::~Capture()
 {
 	close();
 }
 
 
-bool Reader::open(const char *name)
+bool Capture::open(RCX_TargetType target, const char *name, const char *recording)
 {
 	RCX_Pipe *pipe = RCX_NewUSBTowerPipe();
+	if (!pipe) return false;
 	transport = new RCX_PipeTransport(pipe);
 
-	if (transport->Open(kRCX_RCX2Target, name, RCX_Link::kVerboseMode) != kRCX_OK) {
+	if (transport->Open(target, name, 0) != kRCX_OK) {
 		delete transport;
 		transport = 0;
 		return false;
 	}
 
+	if (recording) {
+		file = fopen(recording, "wb");
+		if (!file || fwrite(kFileHeader, kFileHeaderSize, 1, file) != 1) {
+			close();
+			return false;
+		}
+	}
+
+	start = Now();
 	return true;
 }
 
 
-
-void Reader::close()
+void Capture::close()
 {
+	if (file) {
+		fclose(file);
+		file = 0;
+	}
+
 	if (!transport) return;
 
 	transport->Close();
@@ -81,100 +294,384 @@ void Reader::close()
 }
 
 
+bool Capture::read(Frame &frame)
+{
+	RCX_Result r = transport->Receive(frame.data, MAX_PACKET, false);
+	if (r <= 0) return false;
+
+	frame.time = Now() - start;
+	frame.length = r;
+
+	if (file) {
+		UByte header[6];
+		PutLE(header, frame.time, 4);
+		PutLE(header + 4, (ULong)frame.length, 2);
+		fwrite(header, sizeof(header), 1, file);
+		fwrite(frame.data, (size_t)frame.length, 1, file);
+		// capturing only stops when rcxspy is killed
+		fflush(file);
+	}
+
+	return true;
+}
 
-Reader reader;
 
-int main(int, char **)
+Decoder::Decoder(RCX_TargetType target, bool v) :
+	disasm(target),
+	verbose(v),
+	lastCommandLength(0),
+	lastCommandTime(0),
+	replied(false),
+	type(kRCX_TaskChunk),
+	number(0),
+	code(0),
+	codeLength(0),
+	codePos(0),
+	lastBlock((ULong)-1)
 {
-	if (!reader.open("")) {
-		printf("Error opening USB IR tower\n");
-		return -1;
-	}
+}
 
-	while(1) {
-		reader.poll();
-	}
+Decoder::~Decoder()
+{
+	delete [] code;
+}
 
-	reader.close();
 
-	return 0;
+void Decoder::decode(const Frame &frame)
+{
+	// a reply starts with the complement of the command's opcode
+	if (lastCommandLength && frame.data[0] == (UByte)~lastCommand[0])
+		decodeReply(frame);
+	else
+		decodeCommand(frame);
+}
+
+
+void Decoder::printFrame(const Frame &frame, const char *dir, const char *text)
+{
+	printf("%8lu.%03lu %s %s", (unsigned long)frame.time / 1000,
+		(unsigned long)frame.time % 1000, dir, text);
+	if (verbose) {
+		printf("  [");
+		for (int i=0; i<frame.length; ++i)
+			printf(i ? " %02x" : "%02x", frame.data[i]);
+		printf("]");
+	}
+	printf("\n");
 }
 
 
-void Reader::poll()
+void Decoder::decodeCommand(const Frame &frame)
 {
-	RCX_Result r = transport->Receive(packet, MAX_PACKET, false);
-	if (r <= 0) return;
+	// the toggle bit only tells a new command from the same one again
+	UByte op = frame.data[0] & 0xf7;
+	UByte cmd[MAX_PACKET];
+	char text[300];
+
+	memcpy(cmd, frame.data, (size_t)frame.length);
+	cmd[0] = op;
+	if (op == 0x45 && frame.length >= 5) {
+		// not in the tables, since it's never part of a program
+		sprintf(text, "_data    %d, %d", frame.data[1] + (frame.data[2] << 8),
+			frame.data[3] + (frame.data[4] << 8));
+	}
+	else if (disasm.SPrint1(text, cmd, frame.length, 0) < 1)
+		sprintf(text, "?? %02x", op);
+
+	for (int n = (int)strlen(text); n > 0 && text[n-1] == ' '; --n)
+		text[n-1] = 0;
 
-	UByte cmd = packet[0];
-	UByte data[9];
-	UByte *ptr = data;
+	bool retry = (frame.length == lastCommandLength &&
+		memcmp(frame.data, lastCommand, (size_t)frame.length) == 0);
+
+	OpStats &st = stats[op];
+	if (st.name.empty()) {
+		st.name.assign(text, strcspn(text, " \t"));
+		st.commands = st.retries = st.replies = 0;
+		st.totalLatency = st.maxLatency = 0;
+		st.minLatency = (ULong)-1;
+	}
+	++st.commands;
+	if (retry) ++st.retries;
 
-	*ptr++ = ~cmd;
+	memcpy(lastCommand, frame.data, (size_t)frame.length);
+	lastCommandLength = frame.length;
+	lastCommandTime = frame.time;
+	replied = false;
 
-	cmd &= 0xf7;
+	if (retry) strcat(text, "  (again)");
+	printFrame(frame, ">", text);
 
-	switch(cmd) {
-		case 0x15:	// firmware version
-			*ptr++ = 0;
-			*ptr++ = 3;
-			*ptr++ = 0;
-			*ptr++ = 1;
-			*ptr++ = 0;
-			*ptr++ = 3;
-			*ptr++ = 3;
-			*ptr++ = 0;
+	switch(op) {
+		case 0x25:	// begin task download
+			beginDownload(frame, kRCX_TaskChunk);
 			break;
-		case 0x25:	// begin download
-			beginDownload();
-			*ptr++ = 0;
+		case 0x35:	// begin sub download
+			beginDownload(frame, kRCX_SubChunk);
 			break;
 		case 0x45:	// continue download
-			continueDownload();
-			*ptr++ = 0;
-			break;
-		case 0x30:	// battery level
-			*ptr++ = 35;
-			*ptr++ = 40;
+			continueDownload(frame);
 			break;
 		default:
 			break;
 	}
+}
+
 
-//	link.Send1(data, ptr-data);
-//	printf("%02x\n", cmd);
+void Decoder::decodeReply(const Frame &frame)
+{
+	UByte op = lastCommand[0] & 0xf7;
+	const UByte *data = frame.data + 1;
+	int length = frame.length - 1;
+	ULong latency = frame.time - lastCommandTime;
+	char text[300];
+
+	if (length == 0) {
+		sprintf(text, "ok");
+	}
+	else if (length == 1) {
+		sprintf(text, "status %d", data[0]);
+	}
+	else if (op == 0x12 && length == 2) {
+		sprintf(text, "value %d", (short)(data[0] + (data[1] << 8)));
+	}
+	else if (op == 0x30 && length == 2) {
+		sprintf(text, "battery %d mV", data[0] + (data[1] << 8));
+	}
+	else if (op == 0x15 && length == 8) {
+		sprintf(text, "rom %d.%d, firmware %d.%d",
+			(data[0] << 8) + data[1], (data[2] << 8) + data[3],
+			(data[4] << 8) + data[5], (data[6] << 8) + data[7]);
+	}
+	else if (op == 0xa4) {
+		sprintf(text, "%d datalog entries", length / 3);
+	}
+	else {
+		sprintf(text, "%d bytes", length);
+	}
+
+	// only the first reply to a command says how long it took
+	if (!replied) {
+		OpStats &st = stats[op];
+		++st.replies;
+		st.totalLatency += latency;
+		if (latency < st.minLatency) st.minLatency = latency;
+		if (latency > st.maxLatency) st.maxLatency = latency;
+		replied = true;
+		sprintf(text + strlen(text), "  (%lu ms)", (unsigned long)latency);
+	}
+
+	printFrame(frame, "<", text);
 }
 
 
-void Reader::beginDownload()
+void Decoder::printStats() const
 {
-	UByte number = packet[2];
-	codeLength = packet[4] + ((ULong)packet[5] << 8);
+	if (stats.empty()) return;
+
+	printf("\nop  command     sent  again  replies  latency ms (min/avg/max)\n");
+	for (map<int, OpStats>::const_iterator i = stats.begin(); i != stats.end(); ++i) {
+		const OpStats &st = i->second;
+		printf("%02x  %-8s %7lu %6lu %8lu", i->first, st.name.c_str(),
+			(unsigned long)st.commands, (unsigned long)st.retries,
+			(unsigned long)st.replies);
+		if (st.replies) {
+			printf("  %lu/%lu/%lu", (unsigned long)st.minLatency,
+				(unsigned long)(st.totalLatency / st.replies),
+				(unsigned long)st.maxLatency);
+		}
+		printf("\n");
+	}
+}
+
+
+void Decoder::beginDownload(const Frame &frame, RCX_ChunkType t)
+{
+	if (frame.length < 6) return;
+
+	type = t;
+	number = frame.data[2];
+	codeLength = frame.data[4] + ((ULong)frame.data[5] << 8);
 
 	delete [] code;
 
 	code = new UByte[codeLength];
 	codePos = 0;
-	lastBlock = -1;
+	lastBlock = (ULong)-1;
 }
 
 
-void Reader::continueDownload()
+void Decoder::continueDownload(const Frame &frame)
 {
-	ULong block = packet[1] + ((ULong)packet[2] << 8);
-	ULong length = packet[3] + ((ULong)packet[4] << 8);
+	if (!code || frame.length < 5) return;
 
+	ULong block = frame.data[1] + ((ULong)frame.data[2] << 8);
+	ULong length = frame.data[3] + ((ULong)frame.data[4] << 8);
+
+	// a retry of the last block
 	if (block == lastBlock) return;
 
 	lastBlock = block;
 
-	for (int i=0; i<length && codePos < codeLength; ++i) {
-		code[codePos++] = packet[5 + i];
+	for (ULong i=0; i<length && 5 + (int)i < frame.length && codePos < codeLength; ++i) {
+		code[codePos++] = frame.data[5 + i];
 	}
 
 	if (block == 0) {
 		RCX_StdioPrinter dst(stdout);
-		gRCX_Disasm.Print(&dst, code, codeLength);
+
+		printf("\n*** %s %d, size: %lu bytes\n", (type == kRCX_TaskChunk) ? "Task" : "Sub",
+			number, (unsigned long)codeLength);
+		disasm.Print(&dst, false, "", type, number, code, (int)codePos);
+		fflush(stdout);
+
+		delete [] code;
+		code = 0;
 	}
 }
 
+
+/*
+ * Decode a recording made with -w.
+ */
+static int Replay(const char *recording, RCX_TargetType target, bool verbose)
+{
+	FILE *file = fopen(recording, "rb");
+	char header[kFileHeaderSize];
+
+	if (!file) {
+		printf("Error opening %s\n", recording);
+		return -1;
+	}
+
+	if (fread(header, kFileHeaderSize, 1, file) != 1 ||
+		memcmp(header, kFileHeader, kFileHeaderSize) != 0) {
+		printf("%s is not an rcxspy recording\n", recording);
+		fclose(file);
+		return -1;
+	}
+
+	Decoder decoder(target, verbose);
+	Frame frame;
+	UByte buf[6];
+
+	while (fread(buf, sizeof(buf), 1, file) == 1) {
+		frame.time = GetLE(buf, 4);
+		frame.length = (int)GetLE(buf + 4, 2);
+		if (frame.length < 1 || frame.length > MAX_PACKET ||
+			fread(frame.data, (size_t)frame.length, 1, file) != 1) {
+			printf("%s is cut short\n", recording);
+			break;
+		}
+		decoder.decode(frame);
+	}
+
+	fclose(file);
+	decoder.printStats();
+	return 0;
+}
+
+
+static int Usage()
+{
+	printf("Usage: rcxspy [-v] [-T<target>] [-w <file>] [<device>]\n");
+	printf("       rcxspy [-v] [-T<target>] -r <file>\n");
+	printf("<target> is one of:");
+	for (unsigned i=0; i < sizeof(sTargetNames) / sizeof(const char *); ++i)
+		printf(" %s", sTargetNames[i]);
+	printf(" (default RCX2)\n");
+	return -1;
+}
+
+
+Capture capture;
+
+int main(int argc, char **argv)
+{
+	const char *device = "";
+	const char *recording = 0;
+	const char *replay = 0;
+	bool verbose = false;
+	int target = kRCX_RCX2Target;
+
+	for (int i=1; i<argc; ++i) {
+		if (strcmp(argv[i], "-v") == 0)
+			verbose = true;
+		else if (strncmp(argv[i], "-T", 2) == 0) {
+			for (target = 0; target < (int)(sizeof(sTargetNames) / sizeof(const char *)); ++target)
+				if (strcmp(argv[i] + 2, sTargetNames[target]) == 0) break;
+			if (target == (int)(sizeof(sTargetNames) / sizeof(const char *)))
+				return Usage();
+		}
+		else if (strcmp(argv[i], "-w") == 0 && i+1 < argc)
+			recording = argv[++i];
+		else if (strcmp(argv[i], "-r") == 0 && i+1 < argc)
+			replay = argv[++i];
+		else if (argv[i][0] == '-')
+			return Usage();
+		else
+			device = argv[i];
+	}
+
+	if (replay) return Replay(replay, (RCX_TargetType)target, verbose);
+
+	if (!capture.open((RCX_TargetType)target, device, recording)) {
+		printf("Error opening USB IR tower\n");
+		return -1;
+	}
+
+	Decoder decoder((RCX_TargetType)target, verbose);
+
+	// stop the capture to see the statistics
+	signal(SIGINT, Stop);
+	signal(SIGTERM, Stop);
+
+#ifndef NO_THREADS
+	FrameRing ring(4096);
+	std::atomic<unsigned long> dropped(0);
+
+	std::thread reader([&]() {
+		Frame spare;
+		while(!sStop) {
+			Frame *frame = ring.Reserve();
+			if (!frame) {
+				// still read it (and record it), just don't decode it
+				if (capture.read(spare)) ++dropped;
+				continue;
+			}
+			if (capture.read(*frame)) ring.Commit();
+		}
+	});
+
+	unsigned long reported = 0;
+	while(!sStop) {
+		Frame *frame = ring.Peek();
+		if (!frame) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			continue;
+		}
+		decoder.decode(*frame);
+		ring.Release();
+
+		if (dropped != reported) {
+			reported = dropped;
+			fprintf(stderr, "%lu frames not decoded\n", reported);
+		}
+	}
+
+	reader.join();
+
+	for (Frame *frame; (frame = ring.Peek()) != 0; ring.Release())
+		decoder.decode(*frame);
+#else
+	Frame frame;
+	while(!sStop) {
+		if (capture.read(frame)) decoder.decode(frame);
+	}
+#endif
+
+	capture.close();
+	decoder.printStats();
+
+	return 0;
+}